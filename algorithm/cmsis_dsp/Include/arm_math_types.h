@@ -109,6 +109,15 @@ extern "C"
   #endif
 #endif
 
+/* SSE/AVX kernels for x86 host builds, ignored on other targets */
+#if defined(ARM_MATH_X86_SIMD)
+  #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <immintrin.h>
+  #else
+    #undef ARM_MATH_X86_SIMD
+  #endif
+#endif
+
 #if !defined(ARM_MATH_AUTOVECTORIZE)
 
 
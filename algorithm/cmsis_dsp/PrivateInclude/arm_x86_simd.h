@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_x86_simd.h
+ * Description:  SSE/AVX helpers for the ARM_MATH_X86_SIMD host backend
+ *
+ * Target Processor: x86-64 hosts (simulation and unit tests)
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ARM_X86_SIMD_H_
+#define _ARM_X86_SIMD_H_
+
+#include "arm_math_types.h"
+
+#if defined(ARM_MATH_X86_SIMD)
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Vector of ARM_X86_LANES floats: __m256 when the compiler targets AVX
+ * (-mavx2, -march=native), __m128 (SSE2, always present on x86-64) otherwise.
+ * Multiply and add are kept separate, FMA contraction would change the
+ * rounding against the generic C kernels.
+ */
+#if defined(__AVX__)
+#define ARM_X86_LANES 8
+typedef __m256 f32xn_t;
+#define x86_loadn(p)        _mm256_loadu_ps(p)
+#define x86_storen(p, v)    _mm256_storeu_ps((p), (v))
+#define x86_dupn(x)         _mm256_set1_ps(x)
+#define x86_zeron()         _mm256_setzero_ps()
+#define x86_addn(a, b)      _mm256_add_ps((a), (b))
+#define x86_muln(a, b)      _mm256_mul_ps((a), (b))
+
+__STATIC_FORCEINLINE float32_t x86_hsumn(f32xn_t v)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+    return _mm_cvtss_f32(s);
+}
+#else
+#define ARM_X86_LANES 4
+typedef __m128 f32xn_t;
+#define x86_loadn(p)        _mm_loadu_ps(p)
+#define x86_storen(p, v)    _mm_storeu_ps((p), (v))
+#define x86_dupn(x)         _mm_set1_ps(x)
+#define x86_zeron()         _mm_setzero_ps()
+#define x86_addn(a, b)      _mm_add_ps((a), (b))
+#define x86_muln(a, b)      _mm_mul_ps((a), (b))
+
+__STATIC_FORCEINLINE float32_t x86_hsumn(f32xn_t v)
+{
+    __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+    return _mm_cvtss_f32(s);
+}
+#endif
+
+/*
+ * Two interleaved complex values {re0, im0, re1, im1} in one __m128.
+ */
+
+/* Loads the complex values at p0 and p1 into the low and high half */
+__STATIC_FORCEINLINE __m128 x86_cplx_load2(const float32_t *p0, const float32_t *p1)
+{
+    return _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((const double *)p0)), (const __m64 *)p1);
+}
+
+__STATIC_FORCEINLINE void x86_cplx_store2(float32_t *p0, float32_t *p1, __m128 v)
+{
+    _mm_storel_pi((__m64 *)p0, v);
+    _mm_storeh_pi((__m64 *)p1, v);
+}
+
+/* (re, im) -> (im, -re), multiplication by -j */
+__STATIC_FORCEINLINE __m128 x86_cplx_mul_mj(__m128 v)
+{
+    const __m128 sign = _mm_castsi128_ps(_mm_setr_epi32(0, (int)0x80000000, 0, (int)0x80000000));
+    return _mm_xor_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)), sign);
+}
+
+/*
+ * v * w, the same products and sums as the scalar complex multiply:
+ *   re = re * w.re - im * w.im, im = im * w.re + re * w.im
+ */
+__STATIC_FORCEINLINE __m128 x86_cplx_mul(__m128 v, __m128 w)
+{
+    const __m128 sign = _mm_castsi128_ps(_mm_setr_epi32((int)0x80000000, 0, (int)0x80000000, 0));
+    __m128 p = _mm_mul_ps(v, _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 0, 0)));
+    __m128 q = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)),
+                          _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 1, 1)));
+    /* p + (-q) is exactly p - q */
+    return _mm_add_ps(p, _mm_xor_ps(q, sign));
+}
+
+/*
+ * v * conj(w) for w = {cos, sin} as used by the CFFT butterflies:
+ *   re = re * cos + im * sin, im = im * cos - re * sin
+ * Same operations and order as the scalar code, so the results are equal.
+ */
+__STATIC_FORCEINLINE __m128 x86_cplx_mul_conj(__m128 v, __m128 w)
+{
+    const __m128 sign = _mm_castsi128_ps(_mm_setr_epi32(0, (int)0x80000000, 0, (int)0x80000000));
+    __m128 c = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 0, 0));
+    __m128 s = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 1, 1));
+    __m128 p = _mm_mul_ps(v, c);
+    __m128 q = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)), s);
+    return _mm_add_ps(p, _mm_xor_ps(q, sign));
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
+#endif /* _ARM_X86_SIMD_H_ */
@@ -28,6 +28,10 @@
 
 #include "dsp/basic_math_functions.h"
 
+#if defined(ARM_MATH_X86_SIMD)
+#include "arm_x86_simd.h"
+#endif
+
 /**
   @ingroup groupMath
  */
@@ -170,6 +174,33 @@ void arm_dot_prod_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+    f32xn_t accum0 = x86_zeron();
+    f32xn_t accum1 = x86_zeron();
+
+    /* Compute 2 * ARM_X86_LANES products at a time, two accumulators hide
+       the add latency */
+    blkCnt = blockSize / (2 * ARM_X86_LANES);
+
+    while (blkCnt > 0U)
+    {
+        accum0 = x86_addn(accum0, x86_muln(x86_loadn(pSrcA), x86_loadn(pSrcB)));
+        accum1 = x86_addn(accum1, x86_muln(x86_loadn(pSrcA + ARM_X86_LANES),
+                                           x86_loadn(pSrcB + ARM_X86_LANES)));
+
+        /* Increment pointers */
+        pSrcA += 2 * ARM_X86_LANES;
+        pSrcB += 2 * ARM_X86_LANES;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    sum = x86_hsumn(x86_addn(accum0, accum1));
+
+    /* Tail */
+    blkCnt = blockSize % (2 * ARM_X86_LANES);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL) && !defined(ARM_MATH_AUTOVECTORIZE)
 
@@ -204,7 +235,7 @@ void arm_dot_prod_f32(
   blkCnt = blockSize;
 
 #endif /* #if defined (ARM_MATH_LOOPUNROLL) */
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD) */
 
   while (blkCnt > 0U)
   {
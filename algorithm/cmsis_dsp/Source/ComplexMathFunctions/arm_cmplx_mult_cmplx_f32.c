@@ -28,6 +28,10 @@
 
 #include "dsp/complex_math_functions.h"
 
+#if defined(ARM_MATH_X86_SIMD)
+#include "arm_x86_simd.h"
+#endif
+
 /**
   @ingroup groupCmplxMath
  */
@@ -223,6 +227,56 @@ void arm_cmplx_mult_cmplx_f32(
     /* Tail */
     blkCnt = numSamples & 3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+    /* With p = A * {c, c}, q = {b, a} * {d, d}: Re = p - q, Im = q + p,
+       the same products and sums as the generic code */
+#if defined(__AVX__)
+    __m256 va, vb, p, q;
+
+    /* Compute 4 outputs at a time */
+    blkCnt = numSamples >> 2U;
+
+    while (blkCnt > 0U)
+    {
+        va = _mm256_loadu_ps(pSrcA);
+        vb = _mm256_loadu_ps(pSrcB);
+
+        p = _mm256_mul_ps(va, _mm256_moveldup_ps(vb));
+        q = _mm256_mul_ps(_mm256_permute_ps(va, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_movehdup_ps(vb));
+        _mm256_storeu_ps(pDst, _mm256_addsub_ps(p, q));
+
+        /* Increment pointers */
+        pSrcA += 8;
+        pSrcB += 8;
+        pDst += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = numSamples & 3;
+#else
+    /* Compute 2 outputs at a time */
+    blkCnt = numSamples >> 1U;
+
+    while (blkCnt > 0U)
+    {
+        _mm_storeu_ps(pDst, x86_cplx_mul(_mm_loadu_ps(pSrcA), _mm_loadu_ps(pSrcB)));
+
+        /* Increment pointers */
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = numSamples & 1;
+#endif /* #if defined(__AVX__) */
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL) && !defined(ARM_MATH_AUTOVECTORIZE)
 
@@ -276,7 +330,7 @@ void arm_cmplx_mult_cmplx_f32(
   blkCnt = numSamples;
 
 #endif /* #if defined (ARM_MATH_LOOPUNROLL) */
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD) */
 
   while (blkCnt > 0U)
   {
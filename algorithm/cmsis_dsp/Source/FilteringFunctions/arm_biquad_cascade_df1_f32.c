@@ -501,6 +501,124 @@ void arm_biquad_cascade_df1_f32(
   }
 }
 
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_biquad_cascade_df1_f32(
+  const arm_biquad_casd_df1_inst_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pState = S->pState;                 /* pState pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t acc, out;                            /* Accumulators */
+        float32_t b0, b1, b2, a1, a2;                  /* Coefficients of the first stage of a pair */
+        float32_t d0, d1, d2, c1, c2;                  /* Coefficients of the second stage of a pair */
+        float32_t Xn1, Xn2, Yn1, Yn2;                  /* State of the first stage */
+        float32_t Pn1, Pn2, Qn1, Qn2;                  /* State of the second stage */
+        float32_t Xn;                                  /* Temporary input */
+        uint32_t sample, stage = S->numStages;         /* Loop counters */
+
+  /* The recursion is bound by the latency of a1 * y[n-1], not by the
+     arithmetic. Two stages run in the same sample loop, the second one works
+     on the output of the first while the first one already computes the next
+     sample, so the two dependency chains overlap. Every stage keeps the
+     generic order of operations and the results are equal. */
+  while (stage >= 2U)
+  {
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+    d0 = pCoeffs[5];
+    d1 = pCoeffs[6];
+    d2 = pCoeffs[7];
+    c1 = pCoeffs[8];
+    c2 = pCoeffs[9];
+    pCoeffs += 10U;
+
+    Xn1 = pState[0];
+    Xn2 = pState[1];
+    Yn1 = pState[2];
+    Yn2 = pState[3];
+    Pn1 = pState[4];
+    Pn2 = pState[5];
+    Qn1 = pState[6];
+    Qn2 = pState[7];
+
+    for (sample = 0U; sample < blockSize; sample++)
+    {
+      Xn = pIn[sample];
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = acc;
+
+      /* Second stage, its input is acc */
+      out = (d0 * acc) + (d1 * Pn1) + (d2 * Pn2) + (c1 * Qn1) + (c2 * Qn2);
+      Pn2 = Pn1;
+      Pn1 = acc;
+      Qn2 = Qn1;
+      Qn1 = out;
+
+      pDst[sample] = out;
+    }
+
+    /* Store the updated state variables back into the pState array */
+    pState[0] = Xn1;
+    pState[1] = Xn2;
+    pState[2] = Yn1;
+    pState[3] = Yn2;
+    pState[4] = Pn1;
+    pState[5] = Pn2;
+    pState[6] = Qn1;
+    pState[7] = Qn2;
+    pState += 8U;
+
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    stage -= 2U;
+  }
+
+  /* Odd number of stages, the last one alone */
+  if (stage > 0U)
+  {
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    Xn1 = pState[0];
+    Xn2 = pState[1];
+    Yn1 = pState[2];
+    Yn2 = pState[3];
+
+    for (sample = 0U; sample < blockSize; sample++)
+    {
+      Xn = pIn[sample];
+
+      acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = acc;
+
+      pDst[sample] = acc;
+    }
+
+    pState[0] = Xn1;
+    pState[1] = Xn2;
+    pState[2] = Yn1;
+    pState[3] = Yn2;
+  }
+}
+
 #else
 void arm_biquad_cascade_df1_f32(
   const arm_biquad_casd_df1_inst_f32 * S,
@@ -675,7 +793,7 @@ void arm_biquad_cascade_df1_f32(
 
 }
 
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD) */
 #endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
 
 /**
@@ -28,6 +28,10 @@
 
 #include "dsp/filtering_functions.h"
 
+#if defined(ARM_MATH_X86_SIMD)
+#include "arm_x86_simd.h"
+#endif
+
 /**
   @ingroup groupFilters
  */
@@ -907,6 +911,84 @@ uint32_t blockSize)
    }
 
 }
+#elif defined(ARM_MATH_X86_SIMD)
+
+void arm_fir_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  const float32_t *px;                                 /* Temporary pointer for state buffer */
+        float32_t acc0;                                /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t i, n;                                 /* Loop counters */
+
+  /* S->pState holds the previous frame (numTaps - 1) samples, the new block
+     is appended behind them */
+  memcpy(&pState[numTaps - 1U], pSrc, blockSize * sizeof(float32_t));
+
+  /* Every lane computes one output with the same order as the generic code:
+     acc = 0 + x[n] * b[0] + x[n + 1] * b[1] + ..., so the results are equal.
+     Four vectors of outputs at a time hide the add latency. */
+  for (n = 0U; n + 4U * ARM_X86_LANES <= blockSize; n += 4U * ARM_X86_LANES)
+  {
+    f32xn_t acc0v = x86_zeron(), acc1v = x86_zeron();
+    f32xn_t acc2v = x86_zeron(), acc3v = x86_zeron();
+
+    px = &pState[n];
+
+    for (i = 0U; i < numTaps; i++)
+    {
+      f32xn_t c0 = x86_dupn(pCoeffs[i]);
+
+      acc0v = x86_addn(acc0v, x86_muln(x86_loadn(px + i), c0));
+      acc1v = x86_addn(acc1v, x86_muln(x86_loadn(px + i + ARM_X86_LANES), c0));
+      acc2v = x86_addn(acc2v, x86_muln(x86_loadn(px + i + 2U * ARM_X86_LANES), c0));
+      acc3v = x86_addn(acc3v, x86_muln(x86_loadn(px + i + 3U * ARM_X86_LANES), c0));
+    }
+
+    x86_storen(&pDst[n], acc0v);
+    x86_storen(&pDst[n + ARM_X86_LANES], acc1v);
+    x86_storen(&pDst[n + 2U * ARM_X86_LANES], acc2v);
+    x86_storen(&pDst[n + 3U * ARM_X86_LANES], acc3v);
+  }
+
+  for (; n + ARM_X86_LANES <= blockSize; n += ARM_X86_LANES)
+  {
+    f32xn_t acc0v = x86_zeron();
+
+    px = &pState[n];
+
+    for (i = 0U; i < numTaps; i++)
+    {
+      acc0v = x86_addn(acc0v, x86_muln(x86_loadn(px + i), x86_dupn(pCoeffs[i])));
+    }
+
+    x86_storen(&pDst[n], acc0v);
+  }
+
+  /* Remaining outputs */
+  for (; n < blockSize; n++)
+  {
+    acc0 = 0.0f;
+    px = &pState[n];
+
+    for (i = 0U; i < numTaps; i++)
+    {
+      acc0 += px[i] * pCoeffs[i];
+    }
+
+    pDst[n] = acc0;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer.
+     The areas overlap when blockSize < numTaps - 1. */
+  memmove(pState, &pState[blockSize], (numTaps - 1U) * sizeof(float32_t));
+}
+
 #else
 void arm_fir_f32(
   const arm_fir_instance_f32 * S,
@@ -1279,7 +1361,7 @@ void arm_fir_f32(
 
 }
 
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD) */
 #endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
 
 /**
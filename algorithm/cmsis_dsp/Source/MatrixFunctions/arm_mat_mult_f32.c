@@ -28,6 +28,10 @@
 
 #include "dsp/matrix_functions.h"
 
+#if defined(ARM_MATH_X86_SIMD)
+#include "arm_x86_simd.h"
+#endif
+
 #if defined(ARM_MATH_NEON)
 #define GROUPOFROWS 8
 #endif
@@ -872,6 +876,101 @@ arm_status arm_mat_mult_f32(
   /* Return to application */
   return (status);
 }
+#elif defined(ARM_MATH_X86_SIMD)
+/**
+ * @brief Floating-point matrix multiplication.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * Each output row is accumulated as rows of B scaled by a(i,k), ARM_X86_LANES
+ * columns at a time. Every output keeps the k = 0 .. numColsA - 1 order of
+ * the generic code, so the results are the same.
+ */
+arm_status arm_mat_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;          /* Input data matrix pointer A */
+  const float32_t *pInB = pSrcB->pData;          /* Input data matrix pointer B */
+  const float32_t *pIn2;                         /* Row pointer of B */
+  float32_t *pOut = pDst->pData;                 /* Output data matrix pointer */
+  float32_t sum;                                 /* Accumulator */
+  f32xn_t vA, vSum;                              /* Broadcast a(i,k) and accumulator */
+  uint16_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
+  uint32_t row, col, k;                          /* Loop counters */
+  arm_status status;                             /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* row loop */
+    for (row = 0U; row < numRowsA; row++)
+    {
+      col = 0U;
+
+      /* Compute ARM_X86_LANES columns at a time */
+      for (; col + ARM_X86_LANES <= numColsB; col += ARM_X86_LANES)
+      {
+        vSum = x86_zeron();
+        pIn2 = pInB + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          /* c(m,p..p+n) += a(m,k) * b(k,p..p+n) */
+          vA = x86_dupn(pInA[k]);
+          vSum = x86_addn(vSum, x86_muln(vA, x86_loadn(pIn2)));
+          pIn2 += numColsB;
+        }
+
+        x86_storen(pOut + col, vSum);
+      }
+
+      /* Remaining columns */
+      for (; col < numColsB; col++)
+      {
+        sum = 0.0f;
+        pIn2 = pInB + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          sum += pInA[k] * *pIn2;
+          pIn2 += numColsB;
+        }
+
+        pOut[col] = sum;
+      }
+
+      /* Next rows of A and of the output */
+      pInA += numColsA;
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
 #else
 /**
  * @brief Floating-point matrix multiplication.
@@ -1013,7 +1112,7 @@ arm_status arm_mat_mult_f32(
   return (status);
 }
 
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_NEON) || defined(ARM_MATH_X86_SIMD) */
 #endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
 
 /**
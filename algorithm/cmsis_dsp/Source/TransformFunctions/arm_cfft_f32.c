@@ -29,6 +29,10 @@
 #include "dsp/transform_functions.h"
 #include "arm_common_tables.h"
 
+#if defined(ARM_MATH_X86_SIMD)
+#include "arm_x86_simd.h"
+#endif
+
 #if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
 
 #include "arm_helium_utils.h"
@@ -754,6 +758,232 @@ extern void arm_bitreversal_32(
 
  */
 
+#if defined(ARM_MATH_X86_SIMD)
+
+/*
+  The first radix-2 pass, two complex values per __m128. The top half is
+  multiplied by conj(tw[k]), the bottom half uses the vertical symmetry
+  (tw.im, tw.re) of the same twiddle like the generic version.
+*/
+void arm_cfft_radix8by2_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
+{
+  uint32_t    L  = S->fftLen;
+  float32_t * p2 = p1 + L;
+  float32_t * pMid1, * pMid2;
+  const float32_t * tw = (float32_t *) S->pTwiddle;
+  __m128 a, b, c, d, w;
+  uint32_t l;
+
+  /* Define new length */
+  L >>= 1;
+
+  /* Initialize mid pointers */
+  pMid1 = p1 + L;
+  pMid2 = p2 + L;
+
+  for (l = 0; l < L; l += 4)
+  {
+    a = _mm_loadu_ps(p1 + l);
+    b = _mm_loadu_ps(p2 + l);
+    c = _mm_loadu_ps(pMid1 + l);
+    d = _mm_loadu_ps(pMid2 + l);
+    w = _mm_loadu_ps(tw + l);
+
+    _mm_storeu_ps(p1 + l, _mm_add_ps(a, b));
+    _mm_storeu_ps(pMid1 + l, _mm_add_ps(c, d));
+    _mm_storeu_ps(p2 + l, x86_cplx_mul_conj(_mm_sub_ps(a, b), w));
+    w = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 3, 0, 1));
+    _mm_storeu_ps(pMid2 + l, x86_cplx_mul(_mm_sub_ps(d, c), w));
+  }
+
+  /* first col */
+  arm_radix8_butterfly_f32 (p1, L, (float32_t *) S->pTwiddle, 2U);
+
+  /* second col */
+  arm_radix8_butterfly_f32 (p2, L, (float32_t *) S->pTwiddle, 2U);
+}
+
+/*
+  One output k of the first radix-4 pass in the top half (0 <= k <= L/2),
+  the same expressions as the generic version.
+*/
+__STATIC_FORCEINLINE void radix8by4_top_f32 (float32_t * p1, float32_t * p2,
+  float32_t * p3, float32_t * p4, const float32_t * tw2,
+  const float32_t * tw3, const float32_t * tw4)
+{
+  float32_t p1ap3_0, p1sp3_0, p1ap3_1, p1sp3_1;
+  float32_t t2[2], t3[2], t4[2];
+
+  p1ap3_0 = p1[0] + p3[0];
+  p1sp3_0 = p1[0] - p3[0];
+  p1ap3_1 = p1[1] + p3[1];
+  p1sp3_1 = p1[1] - p3[1];
+
+  t2[0] = p1sp3_0 + p2[1] - p4[1];
+  t2[1] = p1sp3_1 - p2[0] + p4[0];
+  t3[0] = p1ap3_0 - p2[0] - p4[0];
+  t3[1] = p1ap3_1 - p2[1] - p4[1];
+  t4[0] = p1sp3_0 - p2[1] + p4[1];
+  t4[1] = p1sp3_1 + p2[0] - p4[0];
+
+  p1[0] = p1ap3_0 + p2[0] + p4[0];
+  p1[1] = p1ap3_1 + p2[1] + p4[1];
+
+  p2[0] = t2[0] * tw2[0] + t2[1] * tw2[1];
+  p2[1] = t2[1] * tw2[0] - t2[0] * tw2[1];
+  p3[0] = t3[0] * tw3[0] + t3[1] * tw3[1];
+  p3[1] = t3[1] * tw3[0] - t3[0] * tw3[1];
+  p4[0] = t4[0] * tw4[0] + t4[1] * tw4[1];
+  p4[1] = t4[1] * tw4[0] - t4[0] * tw4[1];
+}
+
+/*
+  One output L-k of the bottom half, twiddles of k, the same expressions as
+  the generic version.
+*/
+__STATIC_FORCEINLINE void radix8by4_bottom_f32 (float32_t * p1, float32_t * p2,
+  float32_t * p3, float32_t * p4, const float32_t * tw2,
+  const float32_t * tw3, const float32_t * tw4)
+{
+  float32_t p1ap3_0, p1sp3_0, p1ap3_1, p1sp3_1;
+  float32_t t2[2], t3[2], t4[2];
+
+  p1ap3_1 = p1[0] + p3[0];
+  p1sp3_1 = p1[0] - p3[0];
+  p1ap3_0 = p1[1] + p3[1];
+  p1sp3_0 = p1[1] - p3[1];
+
+  t2[0] = p2[1] - p4[1] + p1sp3_1;
+  t2[1] = p1sp3_0 - p2[0] + p4[0];
+  t3[0] = p1ap3_1 - p2[0] - p4[0];
+  t3[1] = p1ap3_0 - p2[1] - p4[1];
+  t4[0] = p2[1] - p4[1] - p1sp3_1;
+  t4[1] = p4[0] - p2[0] - p1sp3_0;
+
+  p1[1] = p1ap3_0 + p2[1] + p4[1];
+  p1[0] = p1ap3_1 + p2[0] + p4[0];
+
+  p2[1] = t2[1] * tw2[1] - t2[0] * tw2[0];
+  p2[0] = t2[0] * tw2[1] + t2[1] * tw2[0];
+  p3[1] = -t3[1] * tw3[0] - t3[0] * tw3[1];
+  p3[0] = t3[1] * tw3[1] - t3[0] * tw3[0];
+  p4[1] = t4[1] * tw4[1] - t4[0] * tw4[0];
+  p4[0] = t4[0] * tw4[1] + t4[1] * tw4[0];
+}
+
+/*
+  The first radix-4 pass, two complex values per __m128, with the same
+  expressions and twiddles as the generic version so the results are equal.
+  Top outputs k < L/2 take conj(tw[k]), conj(tw[2k]), conj(tw[3k]) from the
+  table. The bottom outputs L-k reuse the twiddles of k by symmetry, a pair
+  is loaded for (k, k+1) and reversed to match (L-k-1, L-k) in memory. The
+  middle output L/2 and the bottom output L/2+1 are left over and done one
+  at a time.
+*/
+void arm_cfft_radix8by4_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
+{
+    uint32_t    L  = S->fftLen >> 1;
+    float32_t * p2 = p1 + L;
+    float32_t * p3 = p2 + L;
+    float32_t * p4 = p3 + L;
+    const float32_t * tw = (float32_t *) S->pTwiddle;
+    const __m128 sign_re = _mm_castsi128_ps(_mm_setr_epi32((int)0x80000000, 0, (int)0x80000000, 0));
+    const __m128 sign_im = _mm_castsi128_ps(_mm_setr_epi32(0, (int)0x80000000, 0, (int)0x80000000));
+    const __m128 mask_re = _mm_castsi128_ps(_mm_setr_epi32(-1, 0, -1, 0));
+    __m128 a, b, c, d, ac, amc, x, t, w;
+    uint32_t l, k, n;
+
+    /* n complex values per column */
+    n = L >> 1;
+
+    /* top half, L/2 floats per column */
+    for (l = 0; l < L / 2; l += 4)
+    {
+      a = _mm_loadu_ps(p1 + l);
+      b = _mm_loadu_ps(p2 + l);
+      c = _mm_loadu_ps(p3 + l);
+      d = _mm_loadu_ps(p4 + l);
+      ac  = _mm_add_ps(a, c);
+      amc = _mm_sub_ps(a, c);
+
+      /* col 1 */
+      _mm_storeu_ps(p1 + l, _mm_add_ps(_mm_add_ps(ac, b), d));
+      /* col 2 */
+      w = _mm_loadu_ps(tw + l);
+      a = _mm_sub_ps(_mm_add_ps(amc, x86_cplx_mul_mj(b)), x86_cplx_mul_mj(d));
+      _mm_storeu_ps(p2 + l, x86_cplx_mul_conj(a, w));
+      /* col 3 */
+      w = x86_cplx_load2(tw + 2 * l, tw + 2 * l + 4);
+      a = _mm_sub_ps(_mm_sub_ps(ac, b), d);
+      _mm_storeu_ps(p3 + l, x86_cplx_mul_conj(a, w));
+      /* col 4 */
+      w = x86_cplx_load2(tw + 3 * l, tw + 3 * l + 6);
+      a = _mm_add_ps(_mm_sub_ps(amc, x86_cplx_mul_mj(b)), x86_cplx_mul_mj(d));
+      _mm_storeu_ps(p4 + l, x86_cplx_mul_conj(a, w));
+    }
+
+    /* middle output n/2 */
+    k = n / 2;
+    radix8by4_top_f32 (p1 + 2 * k, p2 + 2 * k, p3 + 2 * k, p4 + 2 * k,
+                       tw + 2 * k, tw + 4 * k, tw + 6 * k);
+
+    /* bottom output n/2+1, twiddles of n/2-1 */
+    k = n / 2 - 1;
+    radix8by4_bottom_f32 (p1 + 2 * (n - k), p2 + 2 * (n - k),
+                          p3 + 2 * (n - k), p4 + 2 * (n - k),
+                          tw + 2 * k, tw + 4 * k, tw + 6 * k);
+
+    /* bottom outputs (n-k-1, n-k) for odd k, twiddles of (k+1, k) */
+    for (k = 1; k < n / 2 - 1; k += 2)
+    {
+      l = 2 * (n - k - 1);
+      a = _mm_loadu_ps(p1 + l);
+      b = _mm_loadu_ps(p2 + l);
+      c = _mm_loadu_ps(p3 + l);
+      d = _mm_loadu_ps(p4 + l);
+      ac  = _mm_add_ps(a, c);
+      amc = _mm_sub_ps(a, c);
+      /* (b.im - d.im, b.re - d.re) */
+      x = _mm_sub_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)),
+                     _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+
+      /* col 1 */
+      _mm_storeu_ps(p1 + l, _mm_add_ps(_mm_add_ps(ac, b), d));
+      /* col 2, re = x.re + amc.re, im as in the top half; w = (sin, cos) */
+      t = _mm_sub_ps(_mm_add_ps(amc, x86_cplx_mul_mj(b)), x86_cplx_mul_mj(d));
+      t = _mm_or_ps(_mm_and_ps(mask_re, _mm_add_ps(x, amc)),
+                    _mm_andnot_ps(mask_re, t));
+      w = _mm_loadu_ps(tw + 2 * k);
+      w = _mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 1, 2, 3));
+      _mm_storeu_ps(p2 + l, x86_cplx_mul_conj(t, w));
+      /* col 3, w = (-cos, sin) */
+      t = _mm_sub_ps(_mm_sub_ps(ac, b), d);
+      w = x86_cplx_load2(tw + 4 * k, tw + 4 * k + 4);
+      w = _mm_xor_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 0, 3, 2)), sign_re);
+      _mm_storeu_ps(p3 + l, x86_cplx_mul_conj(t, w));
+      /* col 4, (x.re - amc.re, -x.im - amc.im); w = (sin, cos) */
+      t = _mm_sub_ps(_mm_xor_ps(x, sign_im), amc);
+      w = x86_cplx_load2(tw + 6 * k, tw + 6 * k + 6);
+      w = _mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 1, 2, 3));
+      _mm_storeu_ps(p4 + l, x86_cplx_mul_conj(t, w));
+    }
+
+    L >>= 1;
+
+    /* first col */
+    arm_radix8_butterfly_f32 (p1, L, (float32_t *) S->pTwiddle, 4U);
+
+    /* second col */
+    arm_radix8_butterfly_f32 (p2, L, (float32_t *) S->pTwiddle, 4U);
+
+    /* third col */
+    arm_radix8_butterfly_f32 (p3, L, (float32_t *) S->pTwiddle, 4U);
+
+    /* fourth col */
+    arm_radix8_butterfly_f32 (p4, L, (float32_t *) S->pTwiddle, 4U);
+}
+
+#else
 void arm_cfft_radix8by2_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
 {
   uint32_t    L  = S->fftLen;
@@ -1111,6 +1341,8 @@ void arm_cfft_radix8by4_f32 (arm_cfft_instance_f32 * S, float32_t * p1)
     arm_radix8_butterfly_f32 (pCol4, L, (float32_t *) S->pTwiddle, 4U);
 }
 
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
 /**
   @addtogroup ComplexFFTF32
   @{
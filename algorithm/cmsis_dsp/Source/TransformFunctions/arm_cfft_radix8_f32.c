@@ -28,6 +28,10 @@
 
 #include "dsp/transform_functions.h"
 
+#if defined(ARM_MATH_X86_SIMD)
+#include "arm_x86_simd.h"
+#endif
+
 
 /* ----------------------------------------------------------------------
  * Internal helper function used by the FFTs
@@ -42,6 +46,113 @@
   return        none
 */
 
+#if defined(ARM_MATH_X86_SIMD)
+
+/*
+  Radix-8 butterfly on two butterflies at once, one complex value of each
+  per __m128 half. x[0..7] are the legs i1..i8. The sums and differences are
+  those of the scalar code below, written on complex values:
+  mj(v) = -j * v gives the (re + s, im - r) pairs of the scalar butterfly.
+*/
+__STATIC_FORCEINLINE void arm_radix8_butterfly_x86(__m128 x[8])
+{
+   const __m128 C81 = _mm_set1_ps(0.70710678118f);
+   __m128 a1, a2, a3, a4, a5, a6, a7, a8;
+   __m128 b1, b2, b3, t, c, d, e, f, g, h;
+
+   a1 = _mm_add_ps(x[0], x[4]);
+   a5 = _mm_sub_ps(x[0], x[4]);
+   a2 = _mm_add_ps(x[1], x[5]);
+   a6 = _mm_sub_ps(x[1], x[5]);
+   a3 = _mm_add_ps(x[2], x[6]);
+   a7 = _mm_sub_ps(x[2], x[6]);
+   a4 = _mm_add_ps(x[3], x[7]);
+   a8 = _mm_sub_ps(x[3], x[7]);
+   t  = _mm_sub_ps(a1, a3);
+   b1 = _mm_add_ps(a1, a3);
+   b3 = _mm_sub_ps(a2, a4);
+   b2 = _mm_add_ps(a2, a4);
+   x[0] = _mm_add_ps(b1, b2);
+   x[4] = _mm_sub_ps(b1, b2);
+   x[2] = _mm_add_ps(t, x86_cplx_mul_mj(b3));
+   x[6] = _mm_sub_ps(t, x86_cplx_mul_mj(b3));
+   c = _mm_mul_ps(_mm_sub_ps(a6, a8), C81);
+   d = _mm_mul_ps(_mm_add_ps(a6, a8), C81);
+   e = _mm_sub_ps(a5, c);
+   f = _mm_add_ps(a5, c);
+   g = _mm_sub_ps(a7, d);
+   h = _mm_add_ps(a7, d);
+   x[1] = _mm_add_ps(f, x86_cplx_mul_mj(h));
+   x[7] = _mm_sub_ps(f, x86_cplx_mul_mj(h));
+   x[5] = _mm_add_ps(e, x86_cplx_mul_mj(g));
+   x[3] = _mm_sub_ps(e, x86_cplx_mul_mj(g));
+}
+
+/*
+  Same stages as the generic version. Stages with twiddles process the
+  butterflies j and j + 1, whose legs are adjacent in memory. j = 0 uses the
+  table entry (1, 0) instead of skipping the multiplication, which gives the
+  same values. The last stage (n2 < 8) pairs the butterflies of two groups.
+*/
+void arm_radix8_butterfly_f32(
+  float32_t * pSrc,
+  uint16_t fftLen,
+  const float32_t * pCoef,
+  uint16_t twidCoefModifier)
+{
+   uint32_t i1, n1, n2, j, k, id;
+   __m128 x[8], w[8];
+
+   n2 = fftLen;
+
+   do
+   {
+      n1 = n2;
+      n2 = n2 >> 3;
+
+      if (n2 < 8)
+      {
+         for (i1 = 0; i1 < fftLen; i1 += 2 * n1)
+         {
+            /* A single butterfly left: both halves load the same values */
+            float32_t *pB = (i1 + n1 < fftLen) ? pSrc + 2 * (i1 + n1) : pSrc + 2 * i1;
+
+            for (k = 0; k < 8; k++)
+               x[k] = x86_cplx_load2(pSrc + 2 * (i1 + k * n2), pB + 2 * k * n2);
+
+            arm_radix8_butterfly_x86(x);
+
+            for (k = 0; k < 8; k++)
+               x86_cplx_store2(pSrc + 2 * (i1 + k * n2), pB + 2 * k * n2, x[k]);
+         }
+         break;
+      }
+
+      for (j = 0; j < n2; j += 2)
+      {
+         /*  twiddles of the butterflies j and j + 1 for the legs 2..8 */
+         id = j * twidCoefModifier;
+         for (k = 1; k < 8; k++)
+            w[k] = x86_cplx_load2(pCoef + 2 * k * id, pCoef + 2 * k * (id + twidCoefModifier));
+
+         for (i1 = j; i1 < fftLen; i1 += n1)
+         {
+            for (k = 0; k < 8; k++)
+               x[k] = _mm_loadu_ps(pSrc + 2 * (i1 + k * n2));
+
+            arm_radix8_butterfly_x86(x);
+
+            _mm_storeu_ps(pSrc + 2 * i1, x[0]);
+            for (k = 1; k < 8; k++)
+               _mm_storeu_ps(pSrc + 2 * (i1 + k * n2), x86_cplx_mul_conj(x[k], w[k]));
+         }
+      }
+
+      twidCoefModifier <<= 3;
+   } while (n2 > 7);
+}
+
+#else
 void arm_radix8_butterfly_f32(
   float32_t * pSrc,
   uint16_t fftLen,
@@ -283,3 +394,5 @@ void arm_radix8_butterfly_f32(
       twidCoefModifier <<= 3;
    } while (n2 > 7);
 }
+
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
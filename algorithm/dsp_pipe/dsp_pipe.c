@@ -0,0 +1,407 @@
+/**
+ * @file dsp_pipe.c
+ * @brief 基于CMSIS-DSP的块处理流水线(多速率)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-16
+ * @note 使用说明见dsp_pipe.h
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "dsp_pipe.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "log.h"
+
+// Private Defines --------------------------
+
+#define FFT_MIN_LEN 32
+#define FFT_MAX_LEN 4096
+
+// Private Functions ------------------------
+
+static float *alloc_floats(uint32_t num) {
+  float *p = m_alloc(num * sizeof(float));
+  if (p != NULL) memset(p, 0, num * sizeof(float));
+  return p;
+}
+
+/**
+ * @brief 取得新级, 输入长度为上一级的输出长度
+ * @retval 新级, 流水线已满时返回NULL
+ */
+static dsp_stage_t *new_stage(dsp_pipe_t *pipe, dsp_stage_type_t type) {
+  if (pipe->num >= DSP_PIPE_CFG_MAX_STAGES) return NULL;
+  dsp_stage_t *s = &pipe->stage[pipe->num];
+  memset(s, 0, sizeof(dsp_stage_t));
+  s->type = type;
+  s->in_len = pipe->num ? pipe->stage[pipe->num - 1].out_len : pipe->block;
+  s->acc_len = s->in_len;
+  s->out_len = s->in_len;
+  return s;
+}
+
+static void free_stage(dsp_stage_t *s) {
+  if (s->acc != NULL) m_free(s->acc);
+  if (s->out != NULL && s->out != s->acc) m_free(s->out);
+  if (s->state != NULL) m_free(s->state);
+  s->acc = s->out = s->state = NULL;
+}
+
+#if !DSP_PIPE_CFG_ARM_TABLES
+/**
+ * @brief 生成FFT旋转因子和位反转表, 并初始化实例
+ * @param  tab              表的存放区(3.5*fft_len个float)
+ * @param  buf              fft_len个float的临时缓冲区
+ * @param  idx              fft_len个uint16_t的临时缓冲区
+ * @note CFFT(L=fft_len/2)旋转因子: tw[2i]=cos(2πi/L), tw[2i+1]=sin(2πi/L)
+ *       RFFT旋转因子: twr[2i]=sin(2πi/N), twr[2i+1]=cos(2πi/N)
+ *       radix-8/4的输出顺序是混合基的数字反转, 直接对单位脉冲做一次不带
+ *       位反转的FFT, 从各位置的相位得到其频点序号, 再生成依次交换的表
+ */
+static int rfft_gen_tables(arm_rfft_fast_instance_f32 *S, uint16_t fft_len,
+                           float *tab, float *buf, uint16_t *idx) {
+  const uint16_t L = fft_len / 2;
+  float *tw = tab;
+  float *twr = tw + 2 * L;
+  uint16_t *rev = (uint16_t *)(twr + fft_len);
+  uint16_t *what = idx;        // 位置p上的频点
+  uint16_t *where = idx + L;   // 频点k所在的位置
+  uint16_t i, n = 0;
+
+  for (i = 0; i < L; i++) {
+    tw[2 * i] = cosf(2 * PI * i / L);
+    tw[2 * i + 1] = sinf(2 * PI * i / L);
+  }
+  for (i = 0; i < L; i++) {
+    twr[2 * i] = sinf(2 * PI * i / fft_len);
+    twr[2 * i + 1] = cosf(2 * PI * i / fft_len);
+  }
+
+  arm_cfft_instance_f32 *c = &S->Sint;
+  c->fftLen = L;
+  c->pTwiddle = tw;
+  c->pBitRevTable = rev;
+  c->bitRevLength = 0;
+  S->fftLenRFFT = fft_len;
+  S->pTwiddleRFFT = twr;
+
+  // x[n]=δ[n-1] => X[k]=exp(-j2πk/L)
+  memset(buf, 0, 2 * L * sizeof(float));
+  buf[2] = 1.0f;
+  arm_cfft_f32(c, buf, 0, 0);
+  for (i = 0; i < L; i++) {
+    int32_t k = lroundf(-atan2f(buf[2 * i + 1], buf[2 * i]) * L / (2 * PI));
+    what[i] = (uint16_t)((k % L + L) % L);
+  }
+  for (i = 0; i < L; i++) where[i] = 0xFFFF;
+  for (i = 0; i < L; i++) {
+    if (where[what[i]] != 0xFFFF) return -1;  // 不是排列
+    where[what[i]] = i;
+  }
+
+  // 依次把频点i换到位置i, 表中为字节偏移
+  for (i = 0; i < L; i++) {
+    uint16_t p = where[i];
+    if (p == i) continue;
+    rev[n++] = i * 8;
+    rev[n++] = p * 8;
+    what[p] = what[i];
+    where[what[p]] = p;
+    what[i] = i;
+    where[i] = i;
+  }
+  c->bitRevLength = n;
+  return 0;
+}
+#endif
+
+/**
+ * @brief 从第idx级开始处理一个块
+ */
+static void run_stages(dsp_pipe_t *pipe, uint8_t idx, const float *in,
+                       uint16_t len) {
+#if DSP_PIPE_CFG_COST_COUNT
+  uint64_t start = m_tick();  // 上一级的结束即下一级的开始
+#endif
+  for (; idx < pipe->num; idx++) {
+    dsp_stage_t *s = &pipe->stage[idx];
+    const float *src = in;
+    uint8_t done = 1;
+    if (s->acc != NULL) {  // 累积到设定长度
+      memcpy(s->acc + s->acc_fill, in, len * sizeof(float));
+      s->acc_fill += len;
+      if (s->acc_fill < s->acc_len) {
+        done = 0;
+      } else {
+        s->acc_fill = 0;
+        src = s->acc;
+      }
+    }
+    if (done) {
+      switch (s->type) {
+        case DSP_STAGE_FIR:
+          arm_fir_f32(&s->inst.fir, src, s->out, len);
+          break;
+        case DSP_STAGE_BIQUAD:
+          arm_biquad_cascade_df1_f32(&s->inst.biquad, src, s->out, len);
+          break;
+        case DSP_STAGE_DECIMATE:
+          arm_fir_decimate_f32(&s->inst.decimate, src, s->out, len);
+          break;
+        case DSP_STAGE_RFFT_MAG: {
+          // 输出{DC, Nyquist, Re1, Im1, ...}, 幅度写回acc(即out)
+          float *spec = s->state;
+          arm_rfft_fast_f32(&s->inst.rfft, s->acc, spec, 0);
+          arm_cmplx_mag_f32(spec, s->out, s->out_len);
+          s->out[0] = fabsf(spec[0]);
+        } break;
+        case DSP_STAGE_STATS: {
+          dsp_stats_t *st = (dsp_stats_t *)s->out;
+          uint32_t index;
+          arm_mean_f32(src, s->acc_len, &st->mean);
+          arm_rms_f32(src, s->acc_len, &st->rms);
+          arm_std_f32(src, s->acc_len, &st->std);
+          arm_min_f32(src, s->acc_len, &st->min, &index);
+          arm_max_f32(src, s->acc_len, &st->max, &index);
+        } break;
+      }
+    }
+#if DSP_PIPE_CFG_COST_COUNT
+    uint64_t now = m_tick();
+    uint64_t cost = now - start;
+    start = now;
+    if (s->max_cost < cost) s->max_cost = cost;
+    s->total_cost += cost;
+    s->run_cnt++;
+#endif
+    if (!done) return;
+    in = s->out;
+    len = s->out_len;
+  }
+  if (pipe->callback != NULL) pipe->callback(pipe, in, len);
+}
+
+/**
+ * @brief 处理一个原始输入块(按输入格式)
+ */
+static void process_raw(dsp_pipe_t *pipe, const void *block) {
+  const float *in = block;
+  if (pipe->in_fmt == DSP_IN_Q15) {
+    arm_q15_to_float(block, pipe->in, pipe->block);
+    in = pipe->in;
+  }
+  run_stages(pipe, 0, in, pipe->block);
+}
+
+// Public Functions -------------------------
+
+int DSP_Pipe_Init(dsp_pipe_t *pipe, uint16_t block, dsp_in_fmt_t in_fmt,
+                  dsp_pipe_cb_t callback) {
+  memset(pipe, 0, sizeof(dsp_pipe_t));
+  if (block == 0) return -1;
+  pipe->block = block;
+  pipe->in_fmt = in_fmt;
+  pipe->callback = callback;
+  // q15输入时raw紧跟在in后面
+  uint32_t size = block * sizeof(float);
+  if (in_fmt == DSP_IN_Q15) size += block * sizeof(int16_t);
+  pipe->in = m_alloc(size);
+  if (pipe->in == NULL) return -1;
+  if (in_fmt == DSP_IN_Q15) pipe->raw = (int16_t *)(pipe->in + block);
+  return 0;
+}
+
+void DSP_Pipe_Deinit(dsp_pipe_t *pipe) {
+  for (uint8_t i = 0; i < pipe->num; i++) free_stage(&pipe->stage[i]);
+  if (pipe->in != NULL) m_free(pipe->in);
+  memset(pipe, 0, sizeof(dsp_pipe_t));
+}
+
+int DSP_Pipe_AddFir(dsp_pipe_t *pipe, const float *coeffs, uint16_t taps) {
+  dsp_stage_t *s = new_stage(pipe, DSP_STAGE_FIR);
+  if (s == NULL || taps == 0) return -1;
+  s->out = alloc_floats(s->out_len);
+  s->state = alloc_floats(taps + s->in_len - 1);
+  if (s->out == NULL || s->state == NULL) {
+    free_stage(s);
+    return -1;
+  }
+  arm_fir_init_f32(&s->inst.fir, taps, coeffs, s->state, s->in_len);
+  pipe->num++;
+  return 0;
+}
+
+int DSP_Pipe_AddBiquad(dsp_pipe_t *pipe, const float *coeffs,
+                       uint8_t sections) {
+  dsp_stage_t *s = new_stage(pipe, DSP_STAGE_BIQUAD);
+  if (s == NULL || sections == 0) return -1;
+  s->out = alloc_floats(s->out_len);
+  s->state = alloc_floats(4 * sections);
+  if (s->out == NULL || s->state == NULL) {
+    free_stage(s);
+    return -1;
+  }
+  arm_biquad_cascade_df1_init_f32(&s->inst.biquad, sections, coeffs, s->state);
+  pipe->num++;
+  return 0;
+}
+
+int DSP_Pipe_AddDecimate(dsp_pipe_t *pipe, const float *coeffs,
+                         uint16_t taps, uint8_t factor) {
+  dsp_stage_t *s = new_stage(pipe, DSP_STAGE_DECIMATE);
+  if (s == NULL || taps == 0 || factor == 0) return -1;
+  if (s->in_len % factor != 0) return -1;
+  s->out_len = s->in_len / factor;
+  s->out = alloc_floats(s->out_len);
+  s->state = alloc_floats(taps + s->in_len - 1);
+  if (s->out == NULL || s->state == NULL) {
+    free_stage(s);
+    return -1;
+  }
+  if (arm_fir_decimate_init_f32(&s->inst.decimate, taps, factor, coeffs,
+                                s->state, s->in_len) != ARM_MATH_SUCCESS) {
+    free_stage(s);
+    return -1;
+  }
+  pipe->num++;
+  return 0;
+}
+
+int DSP_Pipe_AddRfftMag(dsp_pipe_t *pipe, uint16_t fft_len) {
+  dsp_stage_t *s = new_stage(pipe, DSP_STAGE_RFFT_MAG);
+  if (s == NULL) return -1;
+  if (fft_len < FFT_MIN_LEN || fft_len > FFT_MAX_LEN) return -1;
+  if ((fft_len & (fft_len - 1)) != 0 || fft_len % s->in_len != 0) return -1;
+  s->acc_len = fft_len;
+  s->out_len = fft_len / 2;
+  // arm_rfft_fast_f32会改写输入, 输入总是先复制到acc, 幅度谱也写回acc
+  s->acc = alloc_floats(fft_len);
+  s->out = s->acc;
+#if DSP_PIPE_CFG_ARM_TABLES
+  s->state = alloc_floats(fft_len);  // 频谱
+  if (s->acc == NULL || s->state == NULL) {
+    free_stage(s);
+    return -1;
+  }
+  if (arm_rfft_fast_init_f32(&s->inst.rfft, fft_len) != ARM_MATH_SUCCESS) {
+    free_stage(s);
+    return -1;
+  }
+#else
+  // 频谱, CFFT旋转因子, RFFT旋转因子各fft_len个, 位反转表最多fft_len个
+  // uint16_t(L-1次交换, 每次2项), 共3.5*fft_len个float
+  s->state = alloc_floats(fft_len * 3 + fft_len / 2);
+  if (s->acc == NULL || s->state == NULL) {
+    free_stage(s);
+    return -1;
+  }
+  // 频谱区和acc在生成表时作临时缓冲区
+  if (rfft_gen_tables(&s->inst.rfft, fft_len, s->state + fft_len, s->state,
+                      (uint16_t *)s->acc) != 0) {
+    free_stage(s);
+    return -1;
+  }
+#endif
+  pipe->num++;
+  return 0;
+}
+
+int DSP_Pipe_AddStats(dsp_pipe_t *pipe, uint16_t len) {
+  dsp_stage_t *s = new_stage(pipe, DSP_STAGE_STATS);
+  if (s == NULL || len == 0 || len % s->in_len != 0) return -1;
+  s->acc_len = len;
+  s->out_len = sizeof(dsp_stats_t) / sizeof(float);
+  if (len > s->in_len) s->acc = alloc_floats(len);  // 单块时直接统计输入
+  s->out = alloc_floats(s->out_len);
+  if ((len > s->in_len && s->acc == NULL) || s->out == NULL) {
+    free_stage(s);
+    return -1;
+  }
+  pipe->num++;
+  return 0;
+}
+
+void DSP_Pipe_Process(dsp_pipe_t *pipe, const void *block) {
+  process_raw(pipe, block);
+}
+
+uint16_t DSP_Pipe_ProcessFifo(dsp_pipe_t *pipe, lfifo_t *fifo) {
+  const uint8_t sample = pipe->in_fmt == DSP_IN_Q15 ? 2 : 4;
+  const fifo_size_t bytes = pipe->block * sample;
+  uint16_t cnt = 0;
+  while (LFifo_GetUsed(fifo) >= bytes) {
+    // 块在FIFO中连续且对齐时直接处理, 否则先读出
+    fifo_size_t len;
+    uint8_t *p = LFifo_AcquireLinearRead(fifo, &len);
+    if (len >= bytes && ((uintptr_t)p % sample) == 0) {
+      process_raw(pipe, p);
+      LFifo_ReleaseLinearRead(fifo, bytes);
+    } else {
+      void *buf = pipe->in_fmt == DSP_IN_Q15 ? (void *)pipe->raw : pipe->in;
+      LFifo_Read(fifo, buf, bytes);
+      process_raw(pipe, buf);
+    }
+    cnt++;
+  }
+  return cnt;
+}
+
+void DSP_Pipe_AttachDma(dsp_pipe_t *pipe, const void *buf) {
+  pipe->dma_buf = buf;
+  pipe->dma_ready[0] = pipe->dma_ready[1] = 0;
+  pipe->dma_next = 0;
+  pipe->overrun = 0;
+}
+
+void DSP_Pipe_DmaIRQ(dsp_pipe_t *pipe, uint8_t half) {
+  half = half ? 1 : 0;
+  if (pipe->dma_ready[half]) pipe->overrun++;  // 上次的数据还没处理完
+  pipe->dma_ready[half] = 1;
+}
+
+uint8_t DSP_Pipe_Poll(dsp_pipe_t *pipe) {
+  const uint8_t sample = pipe->in_fmt == DSP_IN_Q15 ? 2 : 4;
+  uint8_t cnt = 0;
+  if (pipe->dma_buf == NULL) return 0;
+  // 按DMA写入的顺序处理, 处理完才清除标志, 期间该半区又被写入会记入overrun
+  while (cnt < 2 && pipe->dma_ready[pipe->dma_next]) {
+    const uint8_t *half = (const uint8_t *)pipe->dma_buf +
+                          pipe->dma_next * pipe->block * sample;
+    process_raw(pipe, half);
+    pipe->dma_ready[pipe->dma_next] = 0;
+    pipe->dma_next ^= 1;
+    cnt++;
+  }
+  return cnt;
+}
+
+#if DSP_PIPE_CFG_COST_COUNT
+void DSP_Pipe_PrintCost(dsp_pipe_t *pipe) {
+  static const char *const names[] = {"fir", "biquad", "decimate", "rfft_mag",
+                                      "stats"};
+  LOG_RAWLN("DSP pipe: block %d, %d stages, overrun %u", pipe->block,
+            pipe->num, (unsigned)pipe->overrun);
+  for (uint8_t i = 0; i < pipe->num; i++) {
+    dsp_stage_t *s = &pipe->stage[i];
+    float avg = s->run_cnt ? (float)s->total_cost / s->run_cnt : 0;
+    LOG_RAWLN("  %d %-8s %4d->%-4d run:%-8u avg:%.2fus max:%.2fus", i,
+              names[s->type], s->acc_len, s->out_len, (unsigned)s->run_cnt,
+              avg / m_tick_per_us(float),
+              (float)s->max_cost / m_tick_per_us(float));
+  }
+}
+
+void DSP_Pipe_ResetCost(dsp_pipe_t *pipe) {
+  for (uint8_t i = 0; i < pipe->num; i++) {
+    pipe->stage[i].run_cnt = 0;
+    pipe->stage[i].max_cost = 0;
+    pipe->stage[i].total_cost = 0;
+  }
+}
+#endif
+
+// Source Code End --------------------------
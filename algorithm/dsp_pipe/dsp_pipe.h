@@ -0,0 +1,232 @@
+/**
+ * @file dsp_pipe.h
+ * @brief 基于CMSIS-DSP的块处理流水线(多速率)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-16
+ *
+ * THINK DIFFERENTLY
+ */
+
+/**
+ * @note DSP流水线说明
+ * 1.用途:
+ *  传感器数据逐样本调用arm_fir_f32/arm_biquad_cascade_df1_f32时, 每个样本都
+ *  要付出函数调用和状态搬移的开销. 流水线以固定长度的块为单位依次调用各级
+ *  的CMSIS-DSP块函数, 各级之间由固定大小的块缓冲区连接
+ *
+ * 2.级:
+ *  FIR/双二阶IIR: 输出长度等于输入长度
+ *  抽取: 输出长度为输入的1/M, 之后的级以降低后的速率运行(块长度需为M的倍数)
+ *  FFT幅度谱/统计: 累积若干输入块到设定长度后才处理一次并输出, 输出长度为
+ *  fft_len/2(out[0]为直流分量的幅度)或dsp_stats_t, 未输出时后续级不运行.
+ *  设定长度需为输入块长度的整数倍
+ *
+ * 3.数据来源:
+ *  DSP_Pipe_Process()直接处理一个输入块;
+ *  DSP_Pipe_ProcessFifo()从lfifo中取出所有完整的块处理;
+ *  DMA循环模式下, 缓冲区为2个块(乒乓), 在半传输/传输完成中断中调用
+ *  DSP_Pipe_DmaIRQ()标记就绪的半区, 在任务中调用DSP_Pipe_Poll()处理,
+ *  此时DMA正在写入另一半区. 处理不及时会被记入overrun
+ *  输入为q15时先以arm_q15_to_float()转换为[-1, 1)的浮点数
+ *
+ * 4.耗时统计:
+ *  DSP_PIPE_CFG_COST_COUNT开启时, 每级记录运行次数, 总耗时和最大耗时
+ *  (m_tick()计数), 可由DSP_Pipe_PrintCost()打印
+ *
+ * 5.FFT表:
+ *  项目中的CMSIS-DSP不含arm_common_tables.c(旋转因子/位反转表), 默认在
+ *  添加FFT级时于RAM中生成这些表(3.5*fft_len个float). 链接了完整的
+ *  CMSIS-DSP时可开启DSP_PIPE_CFG_ARM_TABLES, 使用arm_rfft_fast_init_f32()
+ */
+
+#ifndef __DSP_PIPE_H
+#define __DSP_PIPE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "arm_math.h"
+#include "lfifo.h"
+#include "modules.h"
+
+#if !KCONFIG_AVAILABLE  // 由Kconfig配置
+#define DSP_PIPE_CFG_MAX_STAGES 8  // 每条流水线最多级数
+#define DSP_PIPE_CFG_COST_COUNT 1  // 统计每级耗时
+#define DSP_PIPE_CFG_ARM_TABLES 0  // 使用CMSIS-DSP自带的FFT表
+#endif  // !KCONFIG_AVAILABLE
+
+typedef enum {         // 级类型
+  DSP_STAGE_FIR,       // FIR滤波
+  DSP_STAGE_BIQUAD,    // 级联双二阶IIR(DF1)
+  DSP_STAGE_DECIMATE,  // FIR抽取
+  DSP_STAGE_RFFT_MAG,  // 实数FFT幅度谱
+  DSP_STAGE_STATS,     // 块统计
+} dsp_stage_type_t;
+
+typedef enum {  // 输入样本格式
+  DSP_IN_F32,   // float
+  DSP_IN_Q15,   // int16_t, 转换为[-1, 1)
+} dsp_in_fmt_t;
+
+typedef struct {  // 统计级的输出
+  float mean;
+  float rms;
+  float std;
+  float min;
+  float max;
+} dsp_stats_t;
+
+typedef struct {      // 流水线级
+  uint8_t type;       // 级类型(dsp_stage_type_t)
+  uint16_t in_len;    // 每次输入的样本数
+  uint16_t acc_len;   // 累积到该长度才处理, 不累积时等于in_len
+  uint16_t acc_fill;  // 已累积的样本数
+  uint16_t out_len;   // 每次输出的样本数
+  float *acc;         // 累积缓冲区(acc_len)
+  float *out;         // 输出块缓冲区(out_len)
+  float *state;       // 滤波器状态/FFT表
+  union {
+    arm_fir_instance_f32 fir;
+    arm_biquad_casd_df1_inst_f32 biquad;
+    arm_fir_decimate_instance_f32 decimate;
+    arm_rfft_fast_instance_f32 rfft;
+  } inst;
+#if DSP_PIPE_CFG_COST_COUNT
+  uint32_t run_cnt;     // 运行次数
+  uint64_t max_cost;    // 最大耗时(Tick)
+  uint64_t total_cost;  // 总耗时(Tick)
+#endif
+} dsp_stage_t;
+
+typedef struct dsp_pipe dsp_pipe_t;
+
+/**
+ * @brief 最后一级的输出回调
+ * @param  pipe             流水线
+ * @param  out              输出数据(统计级为dsp_stats_t)
+ * @param  len              输出样本数
+ */
+typedef void (*dsp_pipe_cb_t)(dsp_pipe_t *pipe, const float *out,
+                              uint16_t len);
+
+struct dsp_pipe {                 // 流水线
+  uint16_t block;                 // 输入块长度(样本)
+  uint8_t in_fmt;                 // 输入样本格式(dsp_in_fmt_t)
+  uint8_t num;                    // 级数
+  float *in;                      // 输入块缓冲区(格式转换/从FIFO读出)
+  int16_t *raw;                   // q15输入的读出缓冲区
+  const void *dma_buf;            // DMA乒乓缓冲区(2*block个样本)
+  volatile uint8_t dma_ready[2];  // 半区就绪标志(中断置位, 处理后清除)
+  uint8_t dma_next;               // 下一个应处理的半区
+  uint32_t overrun;               // 半区未处理时又被DMA写入的次数
+  dsp_pipe_cb_t callback;         // 最后一级的输出回调
+  void *user;                     // 用户数据
+  dsp_stage_t stage[DSP_PIPE_CFG_MAX_STAGES];
+};
+
+/**
+ * @brief 初始化流水线
+ * @param  pipe             流水线
+ * @param  block            输入块长度(样本)
+ * @param  in_fmt           输入样本格式
+ * @param  callback         最后一级的输出回调(可为NULL)
+ * @retval 0: 成功, -1: 内存不足
+ */
+extern int DSP_Pipe_Init(dsp_pipe_t *pipe, uint16_t block,
+                         dsp_in_fmt_t in_fmt, dsp_pipe_cb_t callback);
+
+/**
+ * @brief 释放流水线及各级的内存
+ */
+extern void DSP_Pipe_Deinit(dsp_pipe_t *pipe);
+
+/**
+ * @brief 添加FIR滤波级
+ * @param  coeffs           系数(时间倒序, 见arm_fir_init_f32), 需保持有效
+ * @param  taps             系数个数
+ * @retval 0: 成功, -1: 参数错误/内存不足
+ */
+extern int DSP_Pipe_AddFir(dsp_pipe_t *pipe, const float *coeffs,
+                           uint16_t taps);
+
+/**
+ * @brief 添加级联双二阶IIR滤波级
+ * @param  coeffs           每节{b0, b1, b2, a1, a2}(a取负号, 见
+ *                          arm_biquad_cascade_df1_init_f32), 需保持有效
+ * @param  sections         节数
+ * @retval 0: 成功, -1: 参数错误/内存不足
+ */
+extern int DSP_Pipe_AddBiquad(dsp_pipe_t *pipe, const float *coeffs,
+                              uint8_t sections);
+
+/**
+ * @brief 添加FIR抽取级
+ * @param  coeffs           抗混叠滤波器系数(时间倒序), 需保持有效
+ * @param  taps             系数个数
+ * @param  factor           抽取倍数, 输入块长度需为其整数倍
+ * @retval 0: 成功, -1: 参数错误/内存不足
+ */
+extern int DSP_Pipe_AddDecimate(dsp_pipe_t *pipe, const float *coeffs,
+                                uint16_t taps, uint8_t factor);
+
+/**
+ * @brief 添加实数FFT幅度谱级
+ * @param  fft_len          FFT长度(32~4096的2的幂), 需为输入块长度的整数倍
+ * @retval 0: 成功, -1: 参数错误/内存不足
+ */
+extern int DSP_Pipe_AddRfftMag(dsp_pipe_t *pipe, uint16_t fft_len);
+
+/**
+ * @brief 添加统计级, 输出dsp_stats_t
+ * @param  len              统计窗口长度, 需为输入块长度的整数倍
+ * @retval 0: 成功, -1: 参数错误/内存不足
+ */
+extern int DSP_Pipe_AddStats(dsp_pipe_t *pipe, uint16_t len);
+
+/**
+ * @brief 处理一个输入块
+ * @param  block            block个输入格式的样本
+ */
+extern void DSP_Pipe_Process(dsp_pipe_t *pipe, const void *block);
+
+/**
+ * @brief 从FIFO中取出所有完整的输入块并处理
+ * @param  fifo             样本FIFO(按输入格式存放)
+ * @retval 处理的块数
+ */
+extern uint16_t DSP_Pipe_ProcessFifo(dsp_pipe_t *pipe, lfifo_t *fifo);
+
+/**
+ * @brief 设置DMA乒乓缓冲区
+ * @param  buf              2*block个输入格式的样本, DMA以循环模式写入
+ */
+extern void DSP_Pipe_AttachDma(dsp_pipe_t *pipe, const void *buf);
+
+/**
+ * @brief DMA半传输/传输完成中断中调用, 标记半区就绪
+ * @param  half             0: 前半(半传输), 1: 后半(传输完成)
+ */
+extern void DSP_Pipe_DmaIRQ(dsp_pipe_t *pipe, uint8_t half);
+
+/**
+ * @brief 处理已就绪的DMA半区
+ * @retval 处理的块数
+ */
+extern uint8_t DSP_Pipe_Poll(dsp_pipe_t *pipe);
+
+#if DSP_PIPE_CFG_COST_COUNT
+/**
+ * @brief 打印每级的耗时统计
+ */
+extern void DSP_Pipe_PrintCost(dsp_pipe_t *pipe);
+
+/**
+ * @brief 清除耗时统计
+ */
+extern void DSP_Pipe_ResetCost(dsp_pipe_t *pipe);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // __DSP_PIPE_H
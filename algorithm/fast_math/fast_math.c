@@ -0,0 +1,301 @@
+/**
+ * @file fast_math.c
+ * @brief 查表与多项式近似的快速数学函数
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-21
+ * @note 使用说明见fast_math.h
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "fast_math.h"
+
+// Private Defines --------------------------
+
+#define SIN_SCALE 40.7436654f  // 128 / pi, 表的间隔为pi/128
+// pi/128拆成两部分(Cody-Waite), |n| < 2^13时n*SIN_STEP_HI是精确的
+#define SIN_STEP_HI 0.0245361328125f
+#define SIN_STEP_LO 7.55979363e-6f
+#define ATAN_N 64  // atan表在[0, 1]上的分段数
+
+typedef union {
+  float f;
+  uint32_t u;
+} fm_bits_t;
+
+// Private Variables ------------------------
+
+// sin(2*pi*i/256), cos为表中后移64项
+static const float sin_table[256] = {
+    0.000000000f, 0.024541229f, 0.049067674f, 0.073564564f, 0.098017140f,
+    0.122410675f, 0.146730474f, 0.170961889f, 0.195090322f, 0.219101240f,
+    0.242980180f, 0.266712757f, 0.290284677f, 0.313681740f, 0.336889853f,
+    0.359895037f, 0.382683432f, 0.405241314f, 0.427555093f, 0.449611330f,
+    0.471396737f, 0.492898192f, 0.514102744f, 0.534997620f, 0.555570233f,
+    0.575808191f, 0.595699304f, 0.615231591f, 0.634393284f, 0.653172843f,
+    0.671558955f, 0.689540545f, 0.707106781f, 0.724247083f, 0.740951125f,
+    0.757208847f, 0.773010453f, 0.788346428f, 0.803207531f, 0.817584813f,
+    0.831469612f, 0.844853565f, 0.857728610f, 0.870086991f, 0.881921264f,
+    0.893224301f, 0.903989293f, 0.914209756f, 0.923879533f, 0.932992799f,
+    0.941544065f, 0.949528181f, 0.956940336f, 0.963776066f, 0.970031253f,
+    0.975702130f, 0.980785280f, 0.985277642f, 0.989176510f, 0.992479535f,
+    0.995184727f, 0.997290457f, 0.998795456f, 0.999698819f, 1.000000000f,
+    0.999698819f, 0.998795456f, 0.997290457f, 0.995184727f, 0.992479535f,
+    0.989176510f, 0.985277642f, 0.980785280f, 0.975702130f, 0.970031253f,
+    0.963776066f, 0.956940336f, 0.949528181f, 0.941544065f, 0.932992799f,
+    0.923879533f, 0.914209756f, 0.903989293f, 0.893224301f, 0.881921264f,
+    0.870086991f, 0.857728610f, 0.844853565f, 0.831469612f, 0.817584813f,
+    0.803207531f, 0.788346428f, 0.773010453f, 0.757208847f, 0.740951125f,
+    0.724247083f, 0.707106781f, 0.689540545f, 0.671558955f, 0.653172843f,
+    0.634393284f, 0.615231591f, 0.595699304f, 0.575808191f, 0.555570233f,
+    0.534997620f, 0.514102744f, 0.492898192f, 0.471396737f, 0.449611330f,
+    0.427555093f, 0.405241314f, 0.382683432f, 0.359895037f, 0.336889853f,
+    0.313681740f, 0.290284677f, 0.266712757f, 0.242980180f, 0.219101240f,
+    0.195090322f, 0.170961889f, 0.146730474f, 0.122410675f, 0.098017140f,
+    0.073564564f, 0.049067674f, 0.024541229f, 0.000000000f, -0.024541229f,
+    -0.049067674f, -0.073564564f, -0.098017140f, -0.122410675f, -0.146730474f,
+    -0.170961889f, -0.195090322f, -0.219101240f, -0.242980180f, -0.266712757f,
+    -0.290284677f, -0.313681740f, -0.336889853f, -0.359895037f, -0.382683432f,
+    -0.405241314f, -0.427555093f, -0.449611330f, -0.471396737f, -0.492898192f,
+    -0.514102744f, -0.534997620f, -0.555570233f, -0.575808191f, -0.595699304f,
+    -0.615231591f, -0.634393284f, -0.653172843f, -0.671558955f, -0.689540545f,
+    -0.707106781f, -0.724247083f, -0.740951125f, -0.757208847f, -0.773010453f,
+    -0.788346428f, -0.803207531f, -0.817584813f, -0.831469612f, -0.844853565f,
+    -0.857728610f, -0.870086991f, -0.881921264f, -0.893224301f, -0.903989293f,
+    -0.914209756f, -0.923879533f, -0.932992799f, -0.941544065f, -0.949528181f,
+    -0.956940336f, -0.963776066f, -0.970031253f, -0.975702130f, -0.980785280f,
+    -0.985277642f, -0.989176510f, -0.992479535f, -0.995184727f, -0.997290457f,
+    -0.998795456f, -0.999698819f, -1.000000000f, -0.999698819f, -0.998795456f,
+    -0.997290457f, -0.995184727f, -0.992479535f, -0.989176510f, -0.985277642f,
+    -0.980785280f, -0.975702130f, -0.970031253f, -0.963776066f, -0.956940336f,
+    -0.949528181f, -0.941544065f, -0.932992799f, -0.923879533f, -0.914209756f,
+    -0.903989293f, -0.893224301f, -0.881921264f, -0.870086991f, -0.857728610f,
+    -0.844853565f, -0.831469612f, -0.817584813f, -0.803207531f, -0.788346428f,
+    -0.773010453f, -0.757208847f, -0.740951125f, -0.724247083f, -0.707106781f,
+    -0.689540545f, -0.671558955f, -0.653172843f, -0.634393284f, -0.615231591f,
+    -0.595699304f, -0.575808191f, -0.555570233f, -0.534997620f, -0.514102744f,
+    -0.492898192f, -0.471396737f, -0.449611330f, -0.427555093f, -0.405241314f,
+    -0.382683432f, -0.359895037f, -0.336889853f, -0.313681740f, -0.290284677f,
+    -0.266712757f, -0.242980180f, -0.219101240f, -0.195090322f, -0.170961889f,
+    -0.146730474f, -0.122410675f, -0.098017140f, -0.073564564f, -0.049067674f,
+    -0.024541229f,
+};
+
+// atan(i/64)
+static const float atan_table[ATAN_N + 1] = {
+    0.000000000f, 0.015623729f, 0.031239833f, 0.046840713f, 0.062418810f,
+    0.077966634f, 0.093476781f, 0.108941957f, 0.124354995f, 0.139708874f,
+    0.154996742f, 0.170211925f, 0.185347950f, 0.200398554f, 0.215357700f,
+    0.230219587f, 0.244978663f, 0.259629629f, 0.274167451f, 0.288587362f,
+    0.302884868f, 0.317055753f, 0.331096077f, 0.345002177f, 0.358770670f,
+    0.372398447f, 0.385882669f, 0.399220770f, 0.412410442f, 0.425449637f,
+    0.438336560f, 0.451069656f, 0.463647609f, 0.476069330f, 0.488333951f,
+    0.500440813f, 0.512389460f, 0.524179629f, 0.535811238f, 0.547284381f,
+    0.558599315f, 0.569756453f, 0.580756354f, 0.591599710f, 0.602287346f,
+    0.612820202f, 0.623199330f, 0.633425883f, 0.643501109f, 0.653426341f,
+    0.663202993f, 0.672832548f, 0.682316555f, 0.691656622f, 0.700854408f,
+    0.709911618f, 0.718830000f, 0.727611333f, 0.736257429f, 0.744770126f,
+    0.753151281f, 0.761402770f, 0.769526480f, 0.777524310f, 0.785398163f,
+};
+
+// atan的导数1/(1+(i/64)^2)
+static const float atan_diff[ATAN_N + 1] = {
+    1.000000000f, 0.999755919f, 0.999024390f, 0.997807552f, 0.996108949f,
+    0.993933511f, 0.991287512f, 0.988178528f, 0.984615385f, 0.980608092f,
+    0.976167779f, 0.971306616f, 0.966037736f, 0.960375147f, 0.954333644f,
+    0.947928720f, 0.941176471f, 0.934093501f, 0.926696833f, 0.919003814f,
+    0.911032028f, 0.902799207f, 0.894323144f, 0.885621622f, 0.876712329f,
+    0.867612794f, 0.858340319f, 0.848911917f, 0.839344262f, 0.829653636f,
+    0.819855885f, 0.809966383f, 0.800000000f, 0.789971070f, 0.779893374f,
+    0.769780117f, 0.759643917f, 0.749496798f, 0.739350181f, 0.729214883f,
+    0.719101124f, 0.709018522f, 0.698976109f, 0.688982338f, 0.679045093f,
+    0.669171704f, 0.659368963f, 0.649643140f, 0.640000000f, 0.630444821f,
+    0.620982414f, 0.611617142f, 0.602352941f, 0.593193338f, 0.584141472f,
+    0.575200112f, 0.566371681f, 0.557658271f, 0.549061662f, 0.540583344f,
+    0.532224532f, 0.523986184f, 0.515869018f, 0.507873528f, 0.500000000f,
+};
+
+// 近似最佳一致逼近的系数(离线由迭代加权最小二乘求得), 低次在前
+#if FAST_MATH_CFG_POLY_ORDER <= 2
+// log2(1+t) = t*P(t), t in [sqrt(0.5)-1, sqrt(2)-1]
+static const float log2_poly[] = {1.48310859f, -0.699146147f};
+// 2^f = 1+f*P(f), f in [-0.5, 0.5]
+static const float exp2_poly[] = {0.7029382f, 0.239861045f};
+#elif FAST_MATH_CFG_POLY_ORDER == 3
+static const float log2_poly[] = {1.44515158f, -0.754076362f, 0.44507082f};
+static const float exp2_poly[] = {0.693282917f, 0.242210631f, 0.05500869f};
+#elif FAST_MATH_CFG_POLY_ORDER == 4
+static const float log2_poly[] = {1.44176076f, -0.724903877f, 0.517507292f,
+                                  -0.329629946f};
+static const float exp2_poly[] = {0.693124196f, 0.240240988f, 0.0559063997f,
+                                  0.00958283011f};
+#elif FAST_MATH_CFG_POLY_ORDER == 5
+static const float log2_poly[] = {1.44257801f, -0.72024183f, 0.486685947f,
+                                  -0.394575023f, 0.252661202f};
+static const float exp2_poly[] = {0.693146978f, 0.240222421f, 0.0555073378f,
+                                  0.00967151147f, 0.00132647088f};
+#else
+static const float log2_poly[] = {1.44271348f,   -0.721131858f, 0.47934798f,
+                                  -0.367489929f, 0.322155286f,  -0.206592692f};
+static const float exp2_poly[] = {0.693147203f,   0.240226479f,
+                                  0.0555033247f,  0.00961843739f,
+                                  0.00133988745f, 0.000153533504f};
+#endif
+#define POLY_N (int8_t)(sizeof(log2_poly) / sizeof(log2_poly[0]))
+
+// Private Functions ------------------------
+
+/**
+ * @brief 拆分x = n*pi/128 + d, 返回表下标n&255, |d| <= pi/256
+ */
+static inline uint8_t sin_reduce(float x, float *d) {
+  float t = x * SIN_SCALE;
+  int32_t n = (int32_t)(t + (t >= 0 ? 0.5f : -0.5f));
+  *d = (x - n * SIN_STEP_HI) - n * SIN_STEP_LO;
+  return (uint8_t)n;
+}
+
+/**
+ * @brief 在表点处展开: sin(x0+d) = s(1-d^2/2) + c(d-d^3/6)
+ */
+static inline float sin_expand(float s, float c, float d) {
+#if FAST_MATH_CFG_TRIG_ORDER <= 1
+  return s + c * d;
+#elif FAST_MATH_CFG_TRIG_ORDER == 2
+  return s + d * (c - 0.5f * s * d);
+#else
+  return s + d * (c - d * (0.5f * s + 0.166666667f * c * d));
+#endif
+}
+
+/**
+ * @brief atan(r), r in [0, 1]
+ * @note 在表点x0处展开, 记D = 1/(1+x0^2), 二阶项系数为-x0*D^2,
+ *  三阶项系数为(x0^2-1/3)*D^3
+ */
+static inline float atan_unit(float r) {
+  uint8_t i = (uint8_t)(r * ATAN_N + 0.5f);
+  float x0 = i * (1.0f / ATAN_N);
+  float d = r - x0;
+  float D = atan_diff[i];
+#if FAST_MATH_CFG_TRIG_ORDER <= 1
+  return atan_table[i] + D * d;
+#elif FAST_MATH_CFG_TRIG_ORDER == 2
+  return atan_table[i] + D * d * (1.0f - x0 * D * d);
+#else
+  float c3 = (x0 * x0 - 0.333333333f) * D * D;
+  return atan_table[i] + D * d * (1.0f - d * (x0 * D - c3 * d));
+#endif
+}
+
+// Public Functions -------------------------
+
+float FM_Sin(float x) {
+  float d;
+  uint8_t i = sin_reduce(x, &d);
+  return sin_expand(sin_table[i], sin_table[(uint8_t)(i + 64)], d);
+}
+
+float FM_Cos(float x) {
+  float d;
+  uint8_t i = sin_reduce(x, &d);
+  // cos(x0+d)的展开与sin相同, 只是表值为cos, 导数为-sin
+  return sin_expand(sin_table[(uint8_t)(i + 64)], -sin_table[i], d);
+}
+
+void FM_SinCos(float x, float *s, float *c) {
+  float d;
+  uint8_t i = sin_reduce(x, &d);
+  float ts = sin_table[i], tc = sin_table[(uint8_t)(i + 64)];
+  *s = sin_expand(ts, tc, d);
+  *c = sin_expand(tc, -ts, d);
+}
+
+float FM_Atan2(float y, float x) {
+  float ax = x < 0 ? -x : x, ay = y < 0 ? -y : y;
+  float a;
+  if (ay <= ax) {
+    if (ax == 0) return 0;
+    a = atan_unit(ay / ax);
+  } else {
+    a = FM_PI / 2 - atan_unit(ax / ay);
+  }
+  if (x < 0) a = FM_PI - a;
+  return y < 0 ? -a : a;
+}
+
+float FM_Asin(float x) {
+  if (x >= 1.0f) return FM_PI / 2;
+  if (x <= -1.0f) return -FM_PI / 2;
+  return FM_Atan2(x, FM_Sqrt(1.0f - x * x));
+}
+
+float FM_Log2(float x) {
+  fm_bits_t v = {.f = x};
+  int32_t e = (int32_t)((v.u >> 23) & 0xFF) - 127;
+  if (x <= 0 || e == -127) return -128.0f;
+  // 尾数m in [1, 2), 再调整到[sqrt(0.5), sqrt(2)), 使多项式区间接近对称
+  v.u = (v.u & 0x007FFFFF) | 0x3F800000;
+  if (v.f > 1.41421356f) {
+    v.f *= 0.5f;
+    e++;
+  }
+  float t = v.f - 1.0f;
+  float p = log2_poly[POLY_N - 1];
+  for (int8_t k = POLY_N - 2; k >= 0; k--) p = p * t + log2_poly[k];
+  return e + t * p;
+}
+
+float FM_Exp2(float x) {
+  if (x < -126.0f) x = -126.0f;
+  if (x > 127.0f) x = 127.0f;
+  int32_t n = (int32_t)(x + 128.5f) - 128;  // 四舍五入, f in [-0.5, 0.5]
+  float f = x - n;
+  float p = exp2_poly[POLY_N - 1];
+  for (int8_t k = POLY_N - 2; k >= 0; k--) p = p * f + exp2_poly[k];
+  fm_bits_t v = {.u = (uint32_t)(n + 127) << 23};
+  return v.f * (1.0f + f * p);
+}
+
+float FM_InvSqrt(float x) {
+  fm_bits_t v = {.f = x};
+  v.u = 0x5F375A86 - (v.u >> 1);
+  float y = v.f;
+  // 先算0.5*x*y, x=0时不会出现0*inf
+  for (uint8_t i = 0; i < FAST_MATH_CFG_RSQRT_ITER; i++) {
+    y = y * (1.5f - 0.5f * x * y * y);
+  }
+  return y;
+}
+
+uint32_t FM_HSVToRGB(uint16_t h, uint8_t s, uint8_t v) {
+  // 以8.8定点计算, x/255近似为x*257/65536
+  uint32_t max = (uint32_t)v << 8;
+  uint32_t min = ((uint32_t)v * (255 - s) * 257) >> 8;
+  uint32_t adj = ((max - min) * (h & 0xFF)) >> 8;
+  uint32_t r, g, b;
+  switch (h >> 8) {
+    case 0:
+      r = max, g = min + adj, b = min;
+      break;
+    case 1:
+      r = max - adj, g = max, b = min;
+      break;
+    case 2:
+      r = min, g = max, b = min + adj;
+      break;
+    case 3:
+      r = min, g = max - adj, b = max;
+      break;
+    case 4:
+      r = min + adj, g = min, b = max;
+      break;
+    default:  // case 5:
+      r = max, g = min, b = max - adj;
+      break;
+  }
+  return ((r >> 8) << 16) | ((g >> 8) << 8) | (b >> 8);
+}
+
+// Source Code End --------------------------
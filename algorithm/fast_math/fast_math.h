@@ -0,0 +1,123 @@
+/**
+ * @file fast_math.h
+ * @brief 查表与多项式近似的快速数学函数
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-21
+ *
+ * THINK DIFFERENTLY
+ */
+
+/**
+ * @note 快速数学函数说明
+ * 1.用途:
+ *  控制环/姿态解算/灯效中的libm调用(logf/atan2f/sqrtf等)在无FPU或FPU较弱
+ *  的芯片上很慢, 而这些场合不需要完整的单精度. 本模块以查表和低阶多项式
+ *  实现常用函数, 精度由Kconfig选择
+ *
+ * 2.实现与误差(主机上对double结果的实测最大误差):
+ *  FM_Sin/FM_Cos: 256点正弦表, 在最近的表点处按FAST_MATH_CFG_TRIG_ORDER阶
+ *   泰勒展开(导数也由同一张表得到), 1阶7.5e-5, 2阶3.2e-7, 3阶6e-8
+ *   输入需满足|x| < 200, 更大时先自行取模
+ *  FM_Atan2: [0, 1]上65点的atan表, 同样按TRIG_ORDER阶展开, 1阶2e-5, 2阶
+ *   3.7e-7, 3阶2.8e-7(受pi附近的单精度舍入限制), 每次调用一次除法
+ *  FM_Asin: 由FM_Atan2和FM_Sqrt得到, 误差还取决于InvSqrt的迭代次数,
+ *   默认配置下为2.3e-6
+ *  FM_Log2/FM_Exp2: 拆出指数后, 对尾数做FAST_MATH_CFG_POLY_ORDER阶的
+ *   近似最佳一致逼近多项式. 阶数2~6时Log2绝对误差为5.6e-3, 8.5e-4, 1e-4,
+ *   1.6e-5, 3.1e-6; Exp2相对误差为2e-3, 1e-4, 2.9e-6, 1.9e-7, 1e-7
+ *  FM_InvSqrt: 整数移位得到初值后做FAST_MATH_CFG_RSQRT_ITER次牛顿迭代,
+ *   相对误差1次1.8e-3, 2次4.7e-6, 3次1.4e-7
+ *  FM_HSVToRGB: 全定点运算, 与浮点公式的偏差不超过1LSB
+ *
+ * 3.替换开关:
+ *  FAST_MATH_CFG_PID: PID(自适应比例)的logf改用FM_Ln
+ *  FAST_MATH_CFG_WS2812: ws2812_spi的HSV_To_RGB改用FM_HSVToRGB
+ *  FAST_MATH_CFG_QUATERNION: quaternion库的InvSqrt/sqrtf/atan2f/asinf改用
+ *   本模块, 欧拉角同时改为单精度计算并使用精确的180/π(原为180/3.14,
+ *   角度相差约0.05%)
+ *  开关默认关闭, 关闭时各模块与原实现完全相同
+ */
+
+#ifndef __FAST_MATH_H
+#define __FAST_MATH_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "modules.h"
+
+#if !KCONFIG_AVAILABLE  // 由Kconfig配置
+#define FAST_MATH_CFG_TRIG_ORDER 2  // 三角函数的展开阶数(1~3)
+#define FAST_MATH_CFG_POLY_ORDER 5  // Log2/Exp2的多项式阶数(2~6)
+#define FAST_MATH_CFG_RSQRT_ITER 2  // InvSqrt的牛顿迭代次数(1~3)
+#define FAST_MATH_CFG_PID 0         // PID使用快速对数
+#define FAST_MATH_CFG_WS2812 0      // WS2812使用定点HSV转换
+#define FAST_MATH_CFG_QUATERNION 0  // quaternion库使用快速函数
+#endif  // !KCONFIG_AVAILABLE
+
+#define FM_PI 3.14159265358979f
+#define FM_HUE_MAX 1536  // FM_HSVToRGB的色相范围(6个扇区, 每个256级)
+
+/**
+ * @brief 正弦/余弦
+ * @param  x                弧度, |x| < 200
+ */
+extern float FM_Sin(float x);
+extern float FM_Cos(float x);
+
+/**
+ * @brief 同时求正弦和余弦(共用一次查表)
+ */
+extern void FM_SinCos(float x, float *s, float *c);
+
+/**
+ * @brief 四象限反正切
+ * @retval 弧度, [-pi, pi], x=y=0时返回0
+ */
+extern float FM_Atan2(float y, float x);
+
+/**
+ * @brief 反正弦
+ * @param  x                超出[-1, 1]时按边界值计算
+ * @retval 弧度, [-pi/2, pi/2]
+ */
+extern float FM_Asin(float x);
+
+/**
+ * @brief 以2为底的对数
+ * @param  x                大于0的规格化数, 否则返回-128
+ */
+extern float FM_Log2(float x);
+
+/**
+ * @brief 2的x次幂
+ * @param  x                限制在[-126, 127]内
+ */
+extern float FM_Exp2(float x);
+
+/**
+ * @brief 1/sqrt(x)
+ * @param  x                大于0
+ */
+extern float FM_InvSqrt(float x);
+
+/**
+ * @brief 自然对数/自然指数/平方根, 由以上函数换算
+ */
+static inline float FM_Ln(float x) { return FM_Log2(x) * 0.693147181f; }
+static inline float FM_Exp(float x) { return FM_Exp2(x * 1.44269504f); }
+static inline float FM_Sqrt(float x) { return x * FM_InvSqrt(x); }
+
+/**
+ * @brief HSV颜色转换为RGB颜色(定点)
+ * @param  h                色相(0 ~ FM_HUE_MAX), 对应0~360度
+ * @param  s                饱和度(0-255)
+ * @param  v                亮度(0-255)
+ * @retval RGB颜色(0xRRGGBB)
+ */
+extern uint32_t FM_HSVToRGB(uint16_t h, uint8_t s, uint8_t v);
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // __FAST_MATH_H
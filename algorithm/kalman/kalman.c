@@ -0,0 +1,319 @@
+/**
+ * @file kalman.c
+ * @brief 定长状态卡尔曼滤波器与互补滤波器(浮点/q31)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-19
+ * @note 使用说明见kalman.h
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "kalman.h"
+
+#include <math.h>
+#include <string.h>
+
+// Private Defines --------------------------
+
+#define KF_INLINE static inline __attribute__((always_inline))
+
+#define Q31_ONE 2147483648.0f
+#define KF_Q_ONE ((float)(1UL << KALMAN_Q_FRAC))
+#define KF_Q_ROUND (1LL << (KALMAN_Q_FRAC - 1))
+#define KF_GAIN_EPS 1e-7f  // 稳态增益的收敛判据(两次迭代的相对差值, 约1ulp)
+
+// Private Functions ------------------------
+
+/**
+ * 以下函数以展平的N*N数组操作矩阵, n为常量, 由各维数的包装函数内联后特化
+ */
+
+KF_INLINE void kf_init(float *x, float *P, float *F, float *Q, float *H,
+                       float *R, uint8_t n) {
+  memset(x, 0, n * sizeof(float));
+  memset(P, 0, n * n * sizeof(float));
+  memset(F, 0, n * n * sizeof(float));
+  memset(Q, 0, n * n * sizeof(float));
+  memset(H, 0, n * sizeof(float));
+  for (uint8_t i = 0; i < n; i++) {
+    P[i * n + i] = 1.0f;
+    F[i * n + i] = 1.0f;
+  }
+  H[0] = 1.0f;
+  *R = 1.0f;
+}
+
+KF_INLINE void kf_kinematic(float *F, float *Q, float *H, float *R, float dt,
+                            float q, float r, uint8_t n) {
+  float g[KALMAN_MAX_N];
+  float t = 1.0f;  // dt^k / k!
+  memset(F, 0, n * n * sizeof(float));
+  memset(H, 0, n * sizeof(float));
+  for (uint8_t k = 0; k < n; k++) {
+    for (uint8_t i = 0; i + k < n; i++) F[i * n + i + k] = t;
+    g[n - 1 - k] = t;
+    t = t * dt / (k + 1);
+  }
+  for (uint8_t i = 0; i < n; i++) {
+    for (uint8_t j = 0; j < n; j++) Q[i * n + j] = q * g[i] * g[j];
+  }
+  H[0] = 1.0f;
+  *R = r;
+}
+
+KF_INLINE void kf_predict(float *x, float *P, const float *F, const float *Q,
+                          uint8_t n) {
+  float fx[KALMAN_MAX_N], fp[KALMAN_MAX_N * KALMAN_MAX_N];
+  for (uint8_t i = 0; i < n; i++) {
+    float acc = 0;
+    for (uint8_t k = 0; k < n; k++) acc += F[i * n + k] * x[k];
+    fx[i] = acc;
+    for (uint8_t j = 0; j < n; j++) {
+      acc = 0;
+      for (uint8_t k = 0; k < n; k++) acc += F[i * n + k] * P[k * n + j];
+      fp[i * n + j] = acc;
+    }
+  }
+  for (uint8_t i = 0; i < n; i++) {
+    x[i] = fx[i];
+    for (uint8_t j = 0; j < n; j++) {
+      float acc = Q[i * n + j];
+      for (uint8_t k = 0; k < n; k++) acc += fp[i * n + k] * F[j * n + k];
+      P[i * n + j] = acc;
+    }
+  }
+}
+
+KF_INLINE void kf_update(float *x, float *P, const float *H, float R,
+                         float *K, float z, uint8_t n) {
+  float hp[KALMAN_MAX_N];  // H P, P对称时也是(P H^T)^T
+  float s = R, y = z;
+  for (uint8_t j = 0; j < n; j++) {
+    float acc = 0;
+    for (uint8_t i = 0; i < n; i++) acc += H[i] * P[i * n + j];
+    hp[j] = acc;
+    s += acc * H[j];
+    y -= H[j] * x[j];
+  }
+  float inv = 1.0f / s;
+  for (uint8_t i = 0; i < n; i++) {
+    K[i] = hp[i] * inv;
+    x[i] += K[i] * y;
+  }
+  // 只算上三角再镜像, 保持P严格对称, 否则舍入误差累积后会逐渐发散
+  for (uint8_t i = 0; i < n; i++) {
+    for (uint8_t j = i; j < n; j++) {
+      P[i * n + j] -= K[i] * hp[j];
+      P[j * n + i] = P[i * n + j];
+    }
+  }
+}
+
+static inline int32_t sat32(int64_t v) {
+  return v > INT32_MAX ? INT32_MAX : v < INT32_MIN ? INT32_MIN : (int32_t)v;
+}
+
+static int32_t sat_q(float v, float one, uint8_t *sat) {
+  v *= one;
+  if (v >= Q31_ONE) {
+    *sat = 1;
+    return INT32_MAX;
+  }
+  if (v < -Q31_ONE) {
+    *sat = 1;
+    return INT32_MIN;
+  }
+  return (int32_t)lrintf(v);
+}
+
+/**
+ * @brief 求定点版本的系数和稳态增益
+ * @note 先将模型换算到各状态的满量程下(x' = x / sc), 再迭代Riccati方程.
+ *  运动学模型按每步变化量缩放后, 协方差各元素的数量级接近, 单精度迭代也
+ *  能收敛到准确的增益
+ */
+KF_INLINE uint8_t kfq_init(int32_t *qx, int32_t *qF, int32_t *qH,
+                           int32_t *qK, const float *P0, const float *F0,
+                           const float *Q0, const float *H0, float R,
+                           const float *scale, uint8_t n) {
+  float x[KALMAN_MAX_N] = {0}, K[KALMAN_MAX_N], last[KALMAN_MAX_N] = {0};
+  float P[KALMAN_MAX_N * KALMAN_MAX_N], F[KALMAN_MAX_N * KALMAN_MAX_N];
+  float Q[KALMAN_MAX_N * KALMAN_MAX_N], H[KALMAN_MAX_N], sc[KALMAN_MAX_N];
+  uint8_t ret = 1, sat = 0;
+  for (uint8_t i = 0; i < n; i++) sc[i] = scale != NULL ? scale[i] : 1.0f;
+  for (uint8_t i = 0; i < n; i++) {
+    for (uint8_t j = 0; j < n; j++) {
+      F[i * n + j] = F0[i * n + j] * sc[j] / sc[i];
+      Q[i * n + j] = Q0[i * n + j] / (sc[i] * sc[j]);
+      P[i * n + j] = P0[i * n + j] / (sc[i] * sc[j]);
+    }
+    H[i] = H0[i] * sc[i];
+  }
+  for (uint32_t it = 0; it < KALMAN_CFG_GAIN_ITER; it++) {
+    kf_predict(x, P, F, Q, n);
+    kf_update(x, P, H, R, K, 0.0f, n);
+    uint8_t done = it > 0;
+    for (uint8_t i = 0; i < n; i++) {
+      if (fabsf(K[i] - last[i]) > KF_GAIN_EPS * fabsf(K[i])) done = 0;
+      last[i] = K[i];
+    }
+    if (done) {
+      ret = 0;
+      break;
+    }
+  }
+  float hsum = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    float fsum = 0;
+    for (uint8_t j = 0; j < n; j++) {
+      qF[i * n + j] = sat_q(F[i * n + j], KF_Q_ONE, &sat);
+      fsum += fabsf(F[i * n + j]);
+    }
+    if (fsum >= 8.0f) sat = 1;
+    qH[i] = sat_q(H[i], KF_Q_ONE, &sat);
+    qK[i] = sat_q(K[i], KF_Q_ONE, &sat);
+    qx[i] = 0;
+    hsum += fabsf(H[i]);
+  }
+  if (hsum >= 8.0f) sat = 1;
+  return sat ? 2 : ret;
+}
+
+KF_INLINE int32_t kfq_step(int32_t *x, const int32_t *F, const int32_t *H,
+                           const int32_t *K, int32_t z, uint8_t n) {
+  int32_t xp[KALMAN_MAX_N];
+  int64_t hx = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    int64_t acc = KF_Q_ROUND;
+    for (uint8_t k = 0; k < n; k++) acc += (int64_t)F[i * n + k] * x[k];
+    xp[i] = sat32(acc >> KALMAN_Q_FRAC);
+    hx += (int64_t)H[i] * xp[i];
+  }
+  // 新息限制在int32内, K*y不会溢出
+  int64_t y = (int64_t)z - ((hx + KF_Q_ROUND) >> KALMAN_Q_FRAC);
+  y = sat32(y);
+  for (uint8_t i = 0; i < n; i++) {
+    x[i] = sat32(xp[i] + ((K[i] * y + KF_Q_ROUND) >> KALMAN_Q_FRAC));
+  }
+  return x[0];
+}
+
+/**
+ * @brief 生成N状态卡尔曼滤波器的函数
+ */
+#define _KALMAN_DEFINE(N)                                                    \
+  void Kalman##N##_Init(kalman##N##_t *kf) {                                 \
+    kf_init(kf->x, &kf->P[0][0], &kf->F[0][0], &kf->Q[0][0], kf->H, &kf->R,  \
+            N);                                                              \
+    memset(kf->K, 0, sizeof(kf->K));                                         \
+  }                                                                          \
+                                                                             \
+  void Kalman##N##_SetKinematic(kalman##N##_t *kf, float dt, float q,        \
+                                float r) {                                   \
+    kf_kinematic(&kf->F[0][0], &kf->Q[0][0], kf->H, &kf->R, dt, q, r, N);    \
+  }                                                                          \
+                                                                             \
+  void Kalman##N##_Predict(kalman##N##_t *kf) {                              \
+    kf_predict(kf->x, &kf->P[0][0], &kf->F[0][0], &kf->Q[0][0], N);          \
+  }                                                                          \
+                                                                             \
+  void Kalman##N##_Update(kalman##N##_t *kf, float z) {                      \
+    kf_update(kf->x, &kf->P[0][0], kf->H, kf->R, kf->K, z, N);               \
+  }                                                                          \
+                                                                             \
+  float Kalman##N##_Step(kalman##N##_t *kf, float z) {                       \
+    kf_predict(kf->x, &kf->P[0][0], &kf->F[0][0], &kf->Q[0][0], N);          \
+    kf_update(kf->x, &kf->P[0][0], kf->H, kf->R, kf->K, z, N);               \
+    return kf->x[0];                                                         \
+  }                                                                          \
+                                                                             \
+  void Kalman##N##_Batch(kalman##N##_t *kf, const float *z, float *out,      \
+                         uint32_t len) {                                     \
+    for (uint32_t i = 0; i < len; i++) {                                     \
+      kf_predict(kf->x, &kf->P[0][0], &kf->F[0][0], &kf->Q[0][0], N);        \
+      kf_update(kf->x, &kf->P[0][0], kf->H, kf->R, kf->K, z[i], N);          \
+      if (out != NULL) out[i] = kf->x[0];                                    \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  uint8_t Kalman##N##Q_Init(kalman##N##_q31_t *kq, const kalman##N##_t *kf, \
+                            const float *scale) {                            \
+    return kfq_init(kq->x, &kq->F[0][0], kq->H, kq->K, &kf->P[0][0],         \
+                    &kf->F[0][0], &kf->Q[0][0], kf->H, kf->R, scale, N);     \
+  }                                                                          \
+                                                                             \
+  int32_t Kalman##N##Q_Step(kalman##N##_q31_t *kq, int32_t z) {              \
+    return kfq_step(kq->x, &kq->F[0][0], kq->H, kq->K, z, N);                \
+  }                                                                          \
+                                                                             \
+  void Kalman##N##Q_Batch(kalman##N##_q31_t *kq, const int32_t *z,           \
+                          int32_t *out, uint32_t len) {                      \
+    for (uint32_t i = 0; i < len; i++) {                                     \
+      int32_t x0 = kfq_step(kq->x, &kq->F[0][0], kq->H, kq->K, z[i], N);     \
+      if (out != NULL) out[i] = x0;                                          \
+    }                                                                        \
+  }
+
+// Public Functions -------------------------
+
+_KALMAN_DEFINE(1)
+_KALMAN_DEFINE(2)
+_KALMAN_DEFINE(3)
+_KALMAN_DEFINE(4)
+
+void CompFilter_Init(comp_filter_t *cf, float tau, float dt, float y0) {
+  cf->alpha = tau / (tau + dt);
+  cf->kRate = cf->alpha * dt;
+  cf->kMeas = 1.0f - cf->alpha;
+  cf->y = y0;
+}
+
+float CompFilter_Update(comp_filter_t *cf, float rate, float meas) {
+  cf->y = cf->alpha * cf->y + cf->kRate * rate + cf->kMeas * meas;
+  return cf->y;
+}
+
+void CompFilter_Batch(comp_filter_t *cf, const float *rate, const float *meas,
+                      float *out, uint32_t len) {
+  float y = cf->y;
+  const float alpha = cf->alpha, kRate = cf->kRate, kMeas = cf->kMeas;
+  for (uint32_t i = 0; i < len; i++) {
+    y = alpha * y + kRate * rate[i] + kMeas * meas[i];
+    if (out != NULL) out[i] = y;
+  }
+  cf->y = y;
+}
+
+uint8_t CompFilterQ_Init(comp_filter_q31_t *cq, float tau, float dt,
+                         float rateFs, float measFs, int32_t y0) {
+  uint8_t sat = 0;
+  float alpha = tau / (tau + dt);
+  cq->alpha = sat_q(alpha, Q31_ONE, &sat);
+  cq->kRate = sat_q(alpha * dt * rateFs / measFs, Q31_ONE, &sat);
+  cq->kMeas = (int32_t)(2147483648LL - cq->alpha);  // alpha + kMeas = 1
+  cq->y = y0;
+  return sat;
+}
+
+int32_t CompFilterQ_Update(comp_filter_q31_t *cq, int32_t rate,
+                           int32_t meas) {
+  int64_t acc = (int64_t)cq->alpha * cq->y + (int64_t)cq->kRate * rate +
+                (int64_t)cq->kMeas * meas;
+  cq->y = sat32((acc + (1LL << 30)) >> 31);
+  return cq->y;
+}
+
+void CompFilterQ_Batch(comp_filter_q31_t *cq, const int32_t *rate,
+                       const int32_t *meas, int32_t *out, uint32_t len) {
+  int32_t y = cq->y;
+  const int64_t alpha = cq->alpha, kRate = cq->kRate, kMeas = cq->kMeas;
+  for (uint32_t i = 0; i < len; i++) {
+    int64_t acc = alpha * y + kRate * rate[i] + kMeas * meas[i];
+    y = sat32((acc + (1LL << 30)) >> 31);
+    if (out != NULL) out[i] = y;
+  }
+  cq->y = y;
+}
+
+// Source Code End --------------------------
@@ -0,0 +1,196 @@
+/**
+ * @file kalman.h
+ * @brief 定长状态卡尔曼滤波器与互补滤波器(浮点/q31)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-19
+ *
+ * THINK DIFFERENTLY
+ */
+
+/**
+ * @note 估计滤波器说明
+ * 1.卡尔曼滤波器:
+ *  状态维数N为1~4, 观测为标量(z = H x + v). 每个N由宏生成独立的类型
+ *  (kalmanN_t)和函数(KalmanN_*), 维数是编译期常量, 循环可被完全展开.
+ *  标量观测的新息协方差也是标量, 每次更新只有一次除法(1/S)
+ *  KalmanN_Init()初始化为F=I, H={1,0,..}, P=I, Q=0, R=1, 之后可直接修改
+ *  F/Q/H/R, 或由KalmanN_SetKinematic()设置为N阶运动学模型(位置, 速度,
+ *  加速度...), 过程噪声为最高阶导数的逐步增量, 方差q. N=1时即为常见的
+ *  一维滤波: P += q; K = P / (P + r)
+ *
+ * 2.定点版本(kalmanN_q31_t):
+ *  用于无FPU的芯片. 线性时不变模型的增益会收敛到稳态值, KalmanNQ_Init()
+ *  在初始化时以浮点迭代Riccati方程求出稳态增益K, 运行时只计算
+ *  x = F x; x += K (z - H x), 没有协方差运算和除法. 因此前若干个样本的
+ *  收敛速度慢于浮点版本, 之后结果一致
+ *  观测和各状态均为q31(值/满量程), 状态i的满量程为观测满量程的scale[i]倍,
+ *  初始化时将F/H/K换算到这些满量程下, 运行时无需再缩放. scale[i]应略大于
+ *  状态i的最大绝对值与观测满量程之比, 取得过大会损失分辨率(高阶状态可能
+ *  不足1LSB). 运动学模型可取scale[i] = (c/dt)^i, 此时换算后的F为
+ *  c^k/k!, c取0.01~1, 信号变化越慢取值越小
+ *  F/H/K为Q2.29, 换算后F每行及H的元素绝对值之和需小于8(64位累加不溢出)
+ *
+ * 3.互补滤波器:
+ *  融合变化率(陀螺仪等, 高频可信)与绝对测量(加速度计倾角等, 低频可信):
+ *  y = alpha (y + rate dt) + (1 - alpha) meas, alpha = tau / (tau + dt),
+ *  tau为时间常数. 系数在初始化时算好, 更新只有乘加
+ *  定点版本中y和meas为同一满量程的q31, rate为另一满量程的q31
+ *
+ * 4.批量接口:
+ *  *_Batch()依次处理一组样本, 输出每个样本更新后的滤波值(卡尔曼滤波器为
+ *  x[0]), 用于DMA/FIFO取出的样本块
+ */
+
+#ifndef __KALMAN_H
+#define __KALMAN_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "modules.h"
+
+#if !KCONFIG_AVAILABLE  // 由Kconfig配置
+#define KALMAN_CFG_GAIN_ITER 10000  // 定点版本求稳态增益的最大迭代次数
+#endif  // !KCONFIG_AVAILABLE
+
+#define KALMAN_MAX_N 4    // 最大状态维数
+#define KALMAN_Q_FRAC 29  // 定点版本F/H/K的小数位数(Q2.29)
+
+/**
+ * @brief 生成N状态卡尔曼滤波器的类型和函数声明
+ */
+#define _KALMAN_DECLARE(N)                                                  \
+  typedef struct {  /* N状态卡尔曼滤波器(浮点) */                           \
+    float x[N];     /* 状态估计 */                                          \
+    float P[N][N];  /* 估计协方差 */                                        \
+    float F[N][N];  /* 状态转移矩阵 */                                      \
+    float Q[N][N];  /* 过程噪声协方差 */                                    \
+    float H[N];     /* 观测向量 */                                          \
+    float R;        /* 观测噪声方差 */                                      \
+    float K[N];     /* 最近一次更新的增益 */                                \
+  } kalman##N##_t;                                                          \
+                                                                            \
+  typedef struct {    /* N状态稳态卡尔曼滤波器(定点) */                     \
+    int32_t x[N];     /* 状态估计(q31) */                                   \
+    int32_t F[N][N];  /* 状态转移矩阵(Q2.29) */                             \
+    int32_t H[N];     /* 观测向量(Q2.29) */                                 \
+    int32_t K[N];     /* 稳态增益(Q2.29) */                                 \
+  } kalman##N##_q31_t;                                                      \
+                                                                            \
+  extern void Kalman##N##_Init(kalman##N##_t *kf);                          \
+  extern void Kalman##N##_SetKinematic(kalman##N##_t *kf, float dt, float q, \
+                                       float r);                            \
+  extern void Kalman##N##_Predict(kalman##N##_t *kf);                       \
+  extern void Kalman##N##_Update(kalman##N##_t *kf, float z);               \
+  extern float Kalman##N##_Step(kalman##N##_t *kf, float z);                \
+  extern void Kalman##N##_Batch(kalman##N##_t *kf, const float *z,          \
+                                float *out, uint32_t len);                  \
+  extern uint8_t Kalman##N##Q_Init(kalman##N##_q31_t *kq,                   \
+                                   const kalman##N##_t *kf,                 \
+                                   const float *scale);                     \
+  extern int32_t Kalman##N##Q_Step(kalman##N##_q31_t *kq, int32_t z);       \
+  extern void Kalman##N##Q_Batch(kalman##N##_q31_t *kq, const int32_t *z,   \
+                                 int32_t *out, uint32_t len)
+
+/**
+ * 以下为各N生成的函数:
+ *
+ * KalmanN_Init(kf)
+ *  x=0, P=I, F=I, Q=0, H={1,0,..}, R=1
+ *
+ * KalmanN_SetKinematic(kf, dt, q, r)
+ *  x[i]为第i阶导数, F为dt的泰勒展开, Q = q G G^T, G[i] = dt^(N-1-i)/(N-1-i)!
+ *  (最高阶导数每步的增量方差为q), H={1,0,..}, R=r. 不修改x和P
+ *
+ * KalmanN_Predict(kf) / KalmanN_Update(kf, z)
+ *  预测(x = F x, P = F P F^T + Q)与观测更新, 缺少观测时只调用预测
+ *
+ * KalmanN_Step(kf, z)
+ *  预测并更新, 返回x[0]
+ *
+ * KalmanN_Batch(kf, z, out, len)
+ *  对len个观测依次Step, out[i]为x[0](可为NULL)
+ *
+ * KalmanNQ_Init(kq, kf, scale)
+ *  由浮点滤波器的F/H/Q/R/P迭代求稳态增益, x清零. 状态i的满量程为观测满量程
+ *  的scale[i]倍(scale为NULL时均为1)
+ *  返回0: 成功 1: 未在KALMAN_CFG_GAIN_ITER次内收敛(使用最后的增益)
+ *      2: 系数超出Q2.29范围(已饱和)
+ *
+ * KalmanNQ_Step(kq, z) / KalmanNQ_Batch(kq, z, out, len)
+ *  同浮点版本, z/out为q31
+ */
+_KALMAN_DECLARE(1);
+_KALMAN_DECLARE(2);
+_KALMAN_DECLARE(3);
+_KALMAN_DECLARE(4);
+
+typedef struct {  // 互补滤波器(浮点)
+  float alpha;    // tau / (tau + dt)
+  float kRate;    // alpha * dt
+  float kMeas;    // 1 - alpha
+  float y;        // 滤波值
+} comp_filter_t;
+
+typedef struct {  // 互补滤波器(定点)
+  int32_t alpha;  // Q31
+  int32_t kRate;  // alpha * dt * rateFs / measFs(Q31)
+  int32_t kMeas;  // 1 - alpha(Q31)
+  int32_t y;      // 滤波值(q31)
+} comp_filter_q31_t;
+
+/**
+ * @brief 初始化互补滤波器
+ * @param  tau              时间常数(s), 大于0
+ * @param  dt               采样周期(s)
+ * @param  y0               初始值
+ */
+extern void CompFilter_Init(comp_filter_t *cf, float tau, float dt, float y0);
+
+/**
+ * @brief 更新互补滤波器
+ * @param  rate             变化率(单位/s)
+ * @param  meas             绝对测量值
+ * @retval 滤波值
+ */
+extern float CompFilter_Update(comp_filter_t *cf, float rate, float meas);
+
+/**
+ * @brief 依次处理len个样本, out[i]为每次更新后的滤波值(可为NULL)
+ */
+extern void CompFilter_Batch(comp_filter_t *cf, const float *rate,
+                             const float *meas, float *out, uint32_t len);
+
+/**
+ * @brief 初始化定点互补滤波器
+ * @param  tau              时间常数(s), 大于0
+ * @param  dt               采样周期(s)
+ * @param  rateFs           变化率的满量程(单位/s, 对应q31的1.0)
+ * @param  measFs           测量值和输出的满量程(对应q31的1.0)
+ * @param  y0               初始值(q31)
+ * @retval 0: 成功 1: alpha*dt*rateFs/measFs超出Q31范围(已饱和)
+ * @note 在初始化时调用, 使用浮点运算
+ */
+extern uint8_t CompFilterQ_Init(comp_filter_q31_t *cq, float tau, float dt,
+                                float rateFs, float measFs, int32_t y0);
+
+/**
+ * @brief 更新定点互补滤波器
+ * @param  rate             变化率(q31)
+ * @param  meas             绝对测量值(q31)
+ * @retval 滤波值(q31)
+ */
+extern int32_t CompFilterQ_Update(comp_filter_q31_t *cq, int32_t rate,
+                                  int32_t meas);
+
+/**
+ * @brief 依次处理len个定点样本, out[i]为每次更新后的滤波值(可为NULL)
+ */
+extern void CompFilterQ_Batch(comp_filter_q31_t *cq, const int32_t *rate,
+                              const int32_t *meas, int32_t *out,
+                              uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // __KALMAN_H
@@ -13,7 +13,18 @@
 
 #include "math.h"
 
-float __attribute__((flatten)) PID_Calculate(pid_t *PIDx, float nextPoint) {
+#if __has_include("fast_math.h")  // 可选, 开启FAST_MATH_CFG_PID时需要
+#include "fast_math.h"
+#endif
+
+#if FAST_MATH_CFG_PID
+#define PID_LOGF FM_Ln
+#else
+#define PID_LOGF logf
+#endif
+
+float __attribute__((flatten))
+PID_Calculate(pid_ctrl_t *PIDx, float nextPoint) {
   PIDx->output = PIDx->base;
   /* Error */
   PIDx->error_1 = PIDx->error_0;
@@ -37,7 +48,7 @@ float __attribute__((flatten)) PID_Calculate(pid_t *PIDx, float nextPoint) {
     case 2:  // 自适应比例值
       PIDx->output +=
           PIDx->proportion *
-          logf(PIDx->pModeK1 * fabsf(PIDx->error_0) + PIDx->pModeK2) *
+          PID_LOGF(PIDx->pModeK1 * fabsf(PIDx->error_0) + PIDx->pModeK2) *
           PIDx->error_0;
       break;
   }
@@ -89,8 +100,7 @@ float __attribute__((flatten)) PID_Calculate(pid_t *PIDx, float nextPoint) {
   return PIDx->output;
 }
 
-float __attribute__((always_inline))
-PID_QuickInc_Calculate(float setPoint, float nextPoint) {
+float PID_QuickInc_Calculate(float setPoint, float nextPoint) {
   const float QUICKINC_P = 1.0f, QUICKINC_I = 0.5f, QUICKINC_D = 0.5f;
   static float error_0 = 0, error_1 = 0, error_2 = 0;
   error_2 = error_1;
@@ -111,7 +121,7 @@ float PID_TimeAdaptive_Calculate(pid_tad_t *PIDx, float nextPoint) {
   return PID_Calculate(&PIDx->pid, nextPoint);
 }
 
-float PID_FeedForward_Calculate(pid_t *PIDx, float nextPoint) {
+float PID_FeedForward_Calculate(pid_ctrl_t *PIDx, float nextPoint) {
   float feed = 0;
   float pid = PID_Calculate(PIDx, nextPoint);
   /****Add model here****/
@@ -121,13 +131,13 @@ float PID_FeedForward_Calculate(pid_t *PIDx, float nextPoint) {
   return pid + feed;
 }
 
-void PID_ResetStartPoint(pid_t *PIDx, float startPoint) {
+void PID_ResetStartPoint(pid_ctrl_t *PIDx, float startPoint) {
   PID_Reset(PIDx);
   PIDx->output = startPoint;
   PIDx->base = startPoint;
 }
 
-void PID_Reset(pid_t *PIDx) {
+void PID_Reset(pid_ctrl_t *PIDx) {
   PIDx->sumI = 0;
   PIDx->sumP = 0;
   PIDx->error_0 = 0;
@@ -137,7 +147,7 @@ void PID_Reset(pid_t *PIDx) {
   PIDx->output = 0;
 }
 
-void PID_SetTuning(pid_t *PIDx, float kp, float ki, float kd) {
+void PID_SetTuning(pid_ctrl_t *PIDx, float kp, float ki, float kd) {
   PIDx->proportion = kp;
   PIDx->derivative = kd;
   PIDx->integral = ki;
@@ -8,7 +8,7 @@
  */
 
 /**
- * @note PID功能说明(pid_t结构体参数介绍)
+ * @note PID功能说明(pid_ctrl_t结构体参数介绍)
  * 1.基础使用(必填参数):
  *  1.1.设定目标 setPoint, 采样周期 Ts: 与常规PID参数一致
  *  1.2.三个K值 proportion,integral,derivative: 与常规PID参数一致,
@@ -39,7 +39,7 @@
  *
  * 5.初始化:
  *  小贴士: C99之后,一个结构体可以被以下面的格式初始化:
- *     pid_t motor_pid = {
+ *     pid_ctrl_t motor_pid = {
  *     .setPoint = 12, // 指定你想设置的值
  *     .proportion = 34,
  *     .integral = 56,
@@ -70,8 +70,8 @@
  *  后需要调用PID_Reset_StartPoint()来保证平滑过渡
  *
  * 9.动态分配malloc()相关:
- *  pid_t为了兼容繁多的功能,内部有大量float,所以占用较大(92+),
- *  如果提供的堆内存(heap)较小,很容易malloc()失败,所以建议尽量
+ *  pid_ctrl_t为了兼容繁多的功能,内部有大量float,所以占用较大(92+),如果
+ *  提供的堆内存(heap)较小,很容易malloc()失败,所以建议尽量
  *  定义为静态变量,而不是动态分配
  *
  * 10.PID_TimeAdaptive_Calculate():
@@ -121,10 +121,14 @@ typedef struct {  // PID结构体(位置式)
   float sumP;       // 比例积分
   float lastPoint;  // 上次输入
   int limitFlag;    // 输出限幅标志(0:未限幅,1:上限,-1:下限)
-} pid_t;
+} pid_ctrl_t;
+
+#if !MOD_HOST_PORT  // 兼容旧名称(主机上pid_t为<sys/types.h>的进程号)
+typedef pid_ctrl_t pid_t;
+#endif
 
 typedef struct {      // 时间自适应PID结构体
-  pid_t pid;          // PID结构体
+  pid_ctrl_t pid;     // PID结构体
   m_time_t lastTime;  // 上次计算时间
 } pid_tad_t;
 
@@ -132,7 +136,7 @@ typedef struct {      // 时间自适应PID结构体
  * @brief 计算位置式PID
  * @retval 输出
  */
-extern float PID_Calculate(pid_t *PIDx, float nextPoint);
+extern float PID_Calculate(pid_ctrl_t *PIDx, float nextPoint);
 
 /**
  * @brief 位置式PID(调度间隔自适应)
@@ -145,7 +149,7 @@ extern float PID_TimeAdaptive_Calculate(pid_tad_t *PIDx, float nextPoint);
  * @brief 前馈PID
  * @note 前馈环节的传递函数需根据实际情况整定，无通用模型
  */
-extern float PID_FeedForward_Calculate(pid_t *PIDx, float nextPoint);
+extern float PID_FeedForward_Calculate(pid_ctrl_t *PIDx, float nextPoint);
 
 /**
  * @brief 快速增量式PID
@@ -158,17 +162,17 @@ extern float PID_QuickInc_Calculate(float setPoint, float nextPoint);
  * @brief 重置PID初始值并清空PID状态
  * @param  startPoint      PID初始值, 防止PID输出突变
  */
-extern void PID_ResetStartPoint(pid_t *PIDx, float startPoint);
+extern void PID_ResetStartPoint(pid_ctrl_t *PIDx, float startPoint);
 
 /**
  * @brief 清空PID状态
  */
-extern void PID_Reset(pid_t *PIDx);
+extern void PID_Reset(pid_ctrl_t *PIDx);
 
 /**
  * @brief 设置PID参数
  */
-extern void PID_SetTuning(pid_t *PIDx, float kp, float ki, float kd);
+extern void PID_SetTuning(pid_ctrl_t *PIDx, float kp, float ki, float kd);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,406 @@
+/**
+ * @file pid_bank.c
+ * @brief 批量PID控制器组(结构体数组->数组结构体)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-08
+ * @note 使用说明见pid_bank.h
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "pid_bank.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#if __has_include("fast_math.h")  // 可选, 开启FAST_MATH_CFG_PID时需要
+#include "fast_math.h"
+#endif
+
+// Private Defines --------------------------
+
+#if FAST_MATH_CFG_PID
+#define PID_LOGF FM_Ln
+#else
+#define PID_LOGF logf
+#endif
+
+#if PID_BANK_CFG_USE_SIMD && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define PID_BANK_SSE2 1
+#elif PID_BANK_CFG_USE_SIMD && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PID_BANK_NEON 1
+#endif
+
+#define ISEP_SLOPE 1e30f  // 积分分离: 误差过阈值时积分系数从1直接跳到0
+
+#define Q15_ONE 32768
+#define Q31_ONE 2147483648.0f
+
+// Private Functions ------------------------
+
+/**
+ * @brief 更新一个浮点通道, 运算顺序与SIMD内核一致
+ * @param  adaptive         是否计算自适应比例(常量, 内联后特化)
+ * @note 只用三元选择, 便于编译器生成条件传送或自动向量化
+ */
+static inline __attribute__((always_inline)) void bank_lane(
+    pid_bank_t *b, uint16_t i, float x, uint8_t adaptive) {
+  float e = b->setPoint[i] - x;
+  e = fabsf(e) < b->deadBand[i] ? 0.0f : e;
+  float ae = fabsf(e);
+  float dx = b->lastPoint[i] != 0 ? x - b->lastPoint[i] : 0.0f;
+  // 比例: 各模式的系数只有一个非0
+  float sumP = b->sumP[i] - b->kpm[i] * dx;
+  float out = b->base[i] + b->kp[i] * e + sumP;
+  if (adaptive) out += b->kpa[i] * PID_LOGF(b->pK1[i] * ae + b->pK2[i]) * e;
+  // 积分: 输出限幅时不积分, 但是允许通过积分退出限幅
+  float flag = b->limitFlag[i];
+  float kie = b->kiTs[i] * e;
+  float w = (b->iK1[i] - ae) * b->iK2Inv[i];
+  w = w < 1.0f ? w : 1.0f;
+  w = w > 0.0f ? w : 0.0f;
+  w = (flag == 0 || flag * kie < 0) ? w : 0.0f;
+  float lim = b->sumILimit[i];
+  float sumI = b->sumI[i] + w * kie;
+  sumI = sumI < lim ? sumI : lim;
+  sumI = sumI > -lim ? sumI : -lim;
+  out += sumI;
+  // 微分
+  out -= b->kdTs[i] * dx;
+  // 输出限幅(max > min, 等价于钳位)
+  float max = b->maxOutput[i], min = b->minOutput[i];
+  flag = out >= max ? 1.0f : out <= min ? -1.0f : 0.0f;
+  out = out < max ? out : max;
+  out = out > min ? out : min;
+  b->error[i] = e;
+  b->sumP[i] = sumP;
+  b->sumI[i] = sumI;
+  b->lastPoint[i] = x;
+  b->limitFlag[i] = flag;
+  b->output[i] = out;
+}
+
+static void bank_scalar(pid_bank_t *b, const float *input, uint16_t start) {
+  if (b->adaptive) {
+    for (uint16_t i = start; i < b->num; i++) bank_lane(b, i, input[i], 1);
+  } else {
+    for (uint16_t i = start; i < b->num; i++) bank_lane(b, i, input[i], 0);
+  }
+}
+
+#if PID_BANK_SSE2 || PID_BANK_NEON
+
+#if PID_BANK_SSE2
+typedef __m128 vf_t;
+#define VLD(p) _mm_load_ps(p)
+#define VLDU(p) _mm_loadu_ps(p)
+#define VST(p, v) _mm_store_ps(p, v)
+#define VDUP(x) _mm_set1_ps(x)
+#define VADD(a, b) _mm_add_ps(a, b)
+#define VSUB(a, b) _mm_sub_ps(a, b)
+#define VMUL(a, b) _mm_mul_ps(a, b)
+#define VMIN(a, b) _mm_min_ps(a, b)
+#define VMAX(a, b) _mm_max_ps(a, b)
+#define VABS(a) _mm_andnot_ps(_mm_set1_ps(-0.0f), a)
+#define VAND(m, a) _mm_and_ps(m, a)                   // m ? a : 0
+#define VSEL(m, a, b) _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define VOR(a, b) _mm_or_ps(a, b)
+#define VLT(a, b) _mm_cmplt_ps(a, b)
+#define VLE(a, b) _mm_cmple_ps(a, b)
+#define VGE(a, b) _mm_cmpge_ps(a, b)
+#define VEQ(a, b) _mm_cmpeq_ps(a, b)
+#define VNE(a, b) _mm_cmpneq_ps(a, b)
+#else
+typedef float32x4_t vf_t;
+#define VLD(p) vld1q_f32(p)
+#define VLDU(p) vld1q_f32(p)
+#define VST(p, v) vst1q_f32(p, v)
+#define VDUP(x) vdupq_n_f32(x)
+#define VADD(a, b) vaddq_f32(a, b)
+#define VSUB(a, b) vsubq_f32(a, b)
+#define VMUL(a, b) vmulq_f32(a, b)
+#define VMIN(a, b) vminq_f32(a, b)
+#define VMAX(a, b) vmaxq_f32(a, b)
+#define VABS(a) vabsq_f32(a)
+#define VMASK(m) vreinterpretq_f32_u32(m)
+#define VAND(m, a) \
+  vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(m), \
+                                  vreinterpretq_u32_f32(a)))
+#define VSEL(m, a, b) vbslq_f32(vreinterpretq_u32_f32(m), a, b)
+#define VOR(a, b) \
+  vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), \
+                                  vreinterpretq_u32_f32(b)))
+#define VLT(a, b) VMASK(vcltq_f32(a, b))
+#define VLE(a, b) VMASK(vcleq_f32(a, b))
+#define VGE(a, b) VMASK(vcgeq_f32(a, b))
+#define VEQ(a, b) VMASK(vceqq_f32(a, b))
+#define VNE(a, b) VMASK(vmvnq_u32(vceqq_f32(a, b)))
+#endif
+
+/**
+ * @brief 每次更新4个通道, 返回已处理的通道数
+ */
+static uint16_t bank_simd(pid_bank_t *b, const float *input) {
+  const vf_t zero = VDUP(0.0f), one = VDUP(1.0f), neg = VDUP(-1.0f);
+  uint16_t i;
+  for (i = 0; i + 4 <= b->num; i += 4) {
+    vf_t x = VLDU(&input[i]);
+    vf_t e = VSUB(VLD(&b->setPoint[i]), x);
+    e = VAND(VGE(VABS(e), VLD(&b->deadBand[i])), e);
+    vf_t ae = VABS(e);
+    vf_t last = VLD(&b->lastPoint[i]);
+    vf_t dx = VAND(VNE(last, zero), VSUB(x, last));
+    // 比例
+    vf_t sumP = VSUB(VLD(&b->sumP[i]), VMUL(VLD(&b->kpm[i]), dx));
+    vf_t out = VADD(VADD(VLD(&b->base[i]), VMUL(VLD(&b->kp[i]), e)), sumP);
+    // 积分
+    vf_t flag = VLD(&b->limitFlag[i]);
+    vf_t kie = VMUL(VLD(&b->kiTs[i]), e);
+    vf_t w = VMUL(VSUB(VLD(&b->iK1[i]), ae), VLD(&b->iK2Inv[i]));
+    w = VMIN(one, VMAX(zero, w));
+    w = VAND(VOR(VEQ(flag, zero), VLT(VMUL(flag, kie), zero)), w);
+    vf_t lim = VLD(&b->sumILimit[i]);
+    vf_t sumI = VADD(VLD(&b->sumI[i]), VMUL(w, kie));
+    sumI = VMIN(lim, VMAX(VSUB(zero, lim), sumI));
+    out = VADD(out, sumI);
+    // 微分
+    out = VSUB(out, VMUL(VLD(&b->kdTs[i]), dx));
+    // 输出限幅
+    vf_t max = VLD(&b->maxOutput[i]), min = VLD(&b->minOutput[i]);
+    vf_t hi = VGE(out, max);
+    vf_t lo = VLE(out, min);
+    out = VSEL(hi, max, VSEL(lo, min, out));
+    flag = VSEL(hi, one, VAND(lo, neg));
+    VST(&b->error[i], e);
+    VST(&b->sumP[i], sumP);
+    VST(&b->sumI[i], sumI);
+    VST(&b->lastPoint[i], x);
+    VST(&b->limitFlag[i], flag);
+    VST(&b->output[i], out);
+  }
+  return i;
+}
+
+#endif  // PID_BANK_SSE2 || PID_BANK_NEON
+
+static int32_t sat_q(float v, float one, int32_t lo, int32_t hi,
+                     uint8_t *sat) {
+  v *= one;
+  if (v >= (float)hi) {
+    if (v > (float)hi) *sat = 1;
+    return hi;
+  }
+  if (v <= (float)lo) {
+    if (v < (float)lo) *sat = 1;
+    return lo;
+  }
+  return (int32_t)lrintf(v);
+}
+
+static inline int32_t sat32(int64_t v) {
+  return v > INT32_MAX ? INT32_MAX : v < INT32_MIN ? INT32_MIN : (int32_t)v;
+}
+
+// Public Functions -------------------------
+
+uint8_t PIDBank_Init(pid_bank_t *bank, uint16_t num) {
+  if (num > PID_BANK_CFG_MAX_NUM) return 1;
+  memset(bank, 0, sizeof(pid_bank_t));
+  bank->num = num;
+  bank->simd = PID_BANK_CFG_USE_SIMD;
+  pid_ctrl_t cfg = {0};
+  for (uint16_t i = 0; i < PID_BANK_LANES; i++) {
+    PIDBank_SetChannel(bank, i, &cfg);
+  }
+  return 0;
+}
+
+void PIDBank_SetChannel(pid_bank_t *bank, uint16_t idx, const pid_ctrl_t *cfg) {
+  bank->setPoint[idx] = cfg->setPoint;
+  bank->base[idx] = cfg->base;
+  bank->kp[idx] = cfg->propMode == 0 ? cfg->proportion : 0;
+  bank->kpm[idx] = cfg->propMode == 1 ? cfg->proportion : 0;
+  bank->kpa[idx] = cfg->propMode == 2 ? cfg->proportion : 0;
+  bank->pK1[idx] = cfg->propMode == 2 ? cfg->pModeK1 : 0;
+  bank->pK2[idx] = cfg->propMode == 2 ? cfg->pModeK2 : 1;  // log(1) = 0
+  bank->kiTs[idx] = cfg->integral * cfg->Ts;
+  bank->kdTs[idx] = cfg->Ts != 0 ? cfg->derivative / cfg->Ts : 0;
+  switch (cfg->integMode) {
+    case 1:  // 积分分离: |e| < K1时系数为1
+      bank->iK1[idx] = cfg->iModeK1;
+      bank->iK2Inv[idx] = ISEP_SLOPE;
+      break;
+    case 2:  // 变速积分: 系数 = clamp((K1 - |e|) / K2, 0, 1)
+      bank->iK1[idx] = cfg->iModeK1;
+      bank->iK2Inv[idx] = 1.0f / cfg->iModeK2;
+      break;
+    default:
+      bank->iK1[idx] = FLT_MAX;
+      bank->iK2Inv[idx] = 1.0f;
+      break;
+  }
+  bank->deadBand[idx] = cfg->deadBand > 0 ? cfg->deadBand : 0;
+  bank->sumILimit[idx] = cfg->sumILimit > 0 ? cfg->sumILimit : FLT_MAX;
+  if (cfg->maxOutput > cfg->minOutput) {
+    bank->maxOutput[idx] = cfg->maxOutput;
+    bank->minOutput[idx] = cfg->minOutput;
+  } else {
+    bank->maxOutput[idx] = FLT_MAX;
+    bank->minOutput[idx] = -FLT_MAX;
+  }
+  bank->adaptive = 0;
+  for (uint16_t i = 0; i < bank->num; i++) {
+    if (bank->kpa[i] != 0) bank->adaptive = 1;
+  }
+}
+
+void PIDBank_Calculate(pid_bank_t *bank, const float *input) {
+  uint16_t done = 0;
+#if PID_BANK_SSE2 || PID_BANK_NEON
+  if (bank->simd && !bank->adaptive) done = bank_simd(bank, input);
+#endif
+  bank_scalar(bank, input, done);
+}
+
+void PIDBank_ResetStartPoint(pid_bank_t *bank, uint16_t idx,
+                             float startPoint) {
+  bank->sumI[idx] = 0;
+  bank->sumP[idx] = 0;
+  bank->error[idx] = 0;
+  bank->limitFlag[idx] = 0;
+  bank->lastPoint[idx] = 0;
+  bank->output[idx] = startPoint;
+  bank->base[idx] = startPoint;
+}
+
+uint8_t PIDBankQ_Init(pid_bank_q_t *bank, uint16_t num) {
+  if (num > PID_BANK_CFG_MAX_NUM) return 1;
+  memset(bank, 0, sizeof(pid_bank_q_t));
+  bank->num = num;
+  for (uint16_t i = 0; i < PID_BANK_LANES; i++) {
+    bank->iK1[i] = INT32_MAX;
+    bank->iK2Inv[i] = 1 << 30;
+    bank->sumILimit[i] = INT32_MAX;
+    bank->maxOutput[i] = INT16_MAX;
+    bank->minOutput[i] = INT16_MIN;
+  }
+  return 0;
+}
+
+uint8_t PIDBankQ_SetChannel(pid_bank_q_t *bank, uint16_t idx,
+                            const pid_ctrl_t *cfg, float inFs,
+                            float outFs) {
+  uint8_t sat = 0;
+  float gain = inFs / outFs;  // 误差(q15) -> 输出(q15)
+  if (cfg->propMode == 2) return 1;
+  bank->setPoint[idx] =
+      sat_q(cfg->setPoint / inFs, Q15_ONE, INT16_MIN, INT16_MAX, &sat);
+  bank->base[idx] =
+      sat_q(cfg->base / outFs, Q15_ONE, INT16_MIN, INT16_MAX, &sat);
+  bank->kp[idx] = cfg->propMode == 0 ? sat_q(cfg->proportion * gain, Q15_ONE,
+                                             -INT32_MAX, INT32_MAX, &sat)
+                                     : 0;
+  bank->kpm[idx] = cfg->propMode == 1 ? sat_q(cfg->proportion * gain, Q15_ONE,
+                                              -INT32_MAX, INT32_MAX, &sat)
+                                      : 0;
+  bank->kiTs[idx] = sat_q(cfg->integral * cfg->Ts * gain, Q31_ONE, -INT32_MAX,
+                          INT32_MAX, &sat);
+  bank->kdTs[idx] =
+      cfg->Ts != 0 ? sat_q(cfg->derivative / cfg->Ts * gain, Q15_ONE,
+                           -INT32_MAX, INT32_MAX, &sat)
+                   : 0;
+  switch (cfg->integMode) {
+    case 1:
+      bank->iK1[idx] =
+          sat_q(cfg->iModeK1 / inFs, Q15_ONE, 0, INT32_MAX, &sat);
+      bank->iK2Inv[idx] = INT32_MAX;
+      break;
+    case 2:  // 1/K2(以q15为单位)的Q30
+      bank->iK1[idx] =
+          sat_q(cfg->iModeK1 / inFs, Q15_ONE, 0, INT32_MAX, &sat);
+      bank->iK2Inv[idx] = sat_q(inFs / cfg->iModeK2 / Q15_ONE, 1 << 30, 0,
+                                INT32_MAX, &sat);
+      break;
+    default:
+      bank->iK1[idx] = INT32_MAX;
+      bank->iK2Inv[idx] = 1 << 30;
+      break;
+  }
+  bank->deadBand[idx] =
+      cfg->deadBand > 0
+          ? sat_q(cfg->deadBand / inFs, Q15_ONE, 0, INT32_MAX, &sat)
+          : 0;
+  bank->sumILimit[idx] =
+      cfg->sumILimit > 0
+          ? sat_q(cfg->sumILimit / outFs, Q31_ONE, 0, INT32_MAX, &sat)
+          : INT32_MAX;
+  if (cfg->maxOutput > cfg->minOutput) {
+    bank->maxOutput[idx] =
+        sat_q(cfg->maxOutput / outFs, Q15_ONE, INT16_MIN, INT16_MAX, &sat);
+    bank->minOutput[idx] =
+        sat_q(cfg->minOutput / outFs, Q15_ONE, INT16_MIN, INT16_MAX, &sat);
+  } else {
+    bank->maxOutput[idx] = INT16_MAX;
+    bank->minOutput[idx] = INT16_MIN;
+  }
+  return sat ? 2 : 0;
+}
+
+void PIDBankQ_Calculate(pid_bank_q_t *bank, const int16_t *input) {
+  pid_bank_q_t *b = bank;
+  for (uint16_t i = 0; i < b->num; i++) {
+    int32_t x = input[i];
+    int32_t e = b->setPoint[i] - x;
+    int32_t ae = e < 0 ? -e : e;
+    if (ae < b->deadBand[i]) e = ae = 0;
+    int32_t dx = b->lastPoint[i] != 0 ? x - b->lastPoint[i] : 0;
+    // 比例, PonM项以Q31累加, 避免截断误差随时间累积
+    int32_t sumP = sat32(b->sumP[i] - (int64_t)dx * b->kpm[i] * 2);
+    int64_t out = b->base[i] + (((int64_t)e * b->kp[i]) >> 15) + (sumP >> 16);
+    // 积分, 系数w为Q15
+    int8_t flag = b->limitFlag[i];
+    int64_t kie = ((int64_t)e * b->kiTs[i]) >> 15;  // Q31
+    int64_t w = ((int64_t)(b->iK1[i] - ae) * b->iK2Inv[i]) >> 15;
+    w = w < 0 ? 0 : w > Q15_ONE ? Q15_ONE : w;
+    if (flag != 0 && flag * kie >= 0) w = 0;
+    int32_t sumI = sat32(b->sumI[i] + ((kie * w) >> 15));
+    if (sumI > b->sumILimit[i]) sumI = b->sumILimit[i];
+    if (sumI < -b->sumILimit[i]) sumI = -b->sumILimit[i];
+    out += sumI >> 16;
+    // 微分
+    out -= ((int64_t)dx * b->kdTs[i]) >> 15;
+    // 输出限幅
+    if (out >= b->maxOutput[i]) {
+      out = b->maxOutput[i];
+      flag = 1;
+    } else if (out <= b->minOutput[i]) {
+      out = b->minOutput[i];
+      flag = -1;
+    } else {
+      flag = 0;
+    }
+    b->error[i] = e;
+    b->sumP[i] = sumP;
+    b->sumI[i] = sumI;
+    b->lastPoint[i] = x;
+    b->limitFlag[i] = flag;
+    b->output[i] = (int16_t)out;
+  }
+}
+
+void PIDBankQ_ResetStartPoint(pid_bank_q_t *bank, uint16_t idx,
+                              int16_t startPoint) {
+  bank->sumI[idx] = 0;
+  bank->sumP[idx] = 0;
+  bank->error[idx] = 0;
+  bank->limitFlag[idx] = 0;
+  bank->lastPoint[idx] = 0;
+  bank->output[idx] = startPoint;
+  bank->base[idx] = startPoint;
+}
+
+// Source Code End --------------------------
@@ -0,0 +1,174 @@
+/**
+ * @file pid_bank.h
+ * @brief 批量PID控制器组(结构体数组->数组结构体)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-08
+ *
+ * THINK DIFFERENTLY
+ */
+
+/**
+ * @note PID控制器组说明
+ * 1.用途:
+ *  多路电机等场合需要在同一中断内以10kHz+更新十几到几十个PID, 逐个调用
+ *  PID_Calculate()时每个控制器都要经过模式switch和大量分支. 控制器组将N个
+ *  控制器的参数和状态按数组存放(SoA), 一次调用更新全部控制器
+ *
+ * 2.配置:
+ *  参数仍使用pid_ctrl_t描述(见pid.h), 由PIDBank_SetChannel()展开为系数
+ *  数组, 模式在此时被特化为统一公式的系数(如常数积分的分离阈值为无穷大),
+ *  计算时没有模式分支. 修改参数后需重新调用PIDBank_SetChannel(), 状态不受影响;
+ *  setPoint数组可直接修改
+ *
+ * 3.计算:
+ *  PIDBank_Calculate()传入num个测量值, 输出在bank->output[]中, 结果与
+ *  PID_Calculate()一致(Ki*Ts, Kd/Ts预先相乘, 存在舍入误差). 自适应比例
+ *  (propMode=2)需要logf, 有此类通道时整个组使用含logf的内核
+ *
+ * 4.SIMD:
+ *  PID_BANK_CFG_USE_SIMD开启时, 在SSE2(x86)/NEON(Cortex-A/ARMv8)上每次
+ *  更新4个控制器; Cortex-M上使用无分支的标量内核(CMSIS-DSP没有比较/选择
+ *  类的向量函数, 逐项调用arm_*_f32需要多次遍历数组, 反而更慢)
+ *
+ * 5.定点版本(pid_bank_q_t):
+ *  用于无FPU的芯片, 输入/输出/设定值为q15(满量程由PIDBankQ_SetChannel的
+ *  inFs/outFs给出), 比例/微分系数为Q15(允许>1), Ki*Ts为Q31, 积分项和PonM
+ *  比例项以Q31累加. 不支持自适应比例
+ */
+
+#ifndef __PID_BANK_H
+#define __PID_BANK_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "pid.h"
+
+#if !KCONFIG_AVAILABLE  // 由Kconfig配置
+#define PID_BANK_CFG_MAX_NUM 24   // 每组最多控制器数
+#define PID_BANK_CFG_USE_SIMD 1   // 使用SSE2/NEON内核
+#endif  // !KCONFIG_AVAILABLE
+
+#define PID_BANK_LANES ((PID_BANK_CFG_MAX_NUM + 3) & ~3)  // 按4路对齐
+
+#define _PID_BANK_ARRAY(type, name) \
+  type name[PID_BANK_LANES] __attribute__((aligned(16)))
+
+typedef struct {  // PID控制器组(浮点)
+  uint16_t num;       // 控制器数量
+  uint8_t adaptive;   // 存在自适应比例通道(使用含logf的内核)
+  uint8_t simd;       // 使用SIMD内核(Init时按PID_BANK_CFG_USE_SIMD设置)
+  /** 设置参数 **/
+  _PID_BANK_ARRAY(float, setPoint);   // 设定目标(可直接修改)
+  /** 由pid_ctrl_t展开的系数 **/
+  _PID_BANK_ARRAY(float, kp);         // 常数比例(其他比例模式为0)
+  _PID_BANK_ARRAY(float, kpm);        // PonM比例(其他比例模式为0)
+  _PID_BANK_ARRAY(float, kpa);        // 自适应比例(其他比例模式为0)
+  _PID_BANK_ARRAY(float, pK1);        // 自适应比例常数1(其他模式为0)
+  _PID_BANK_ARRAY(float, pK2);        // 自适应比例常数2(其他模式为1)
+  _PID_BANK_ARRAY(float, kiTs);       // integral*Ts
+  _PID_BANK_ARRAY(float, kdTs);       // derivative/Ts(Ts为0时为0)
+  _PID_BANK_ARRAY(float, iK1);        // 积分系数为0的误差(常数积分为无穷大)
+  _PID_BANK_ARRAY(float, iK2Inv);     // 积分系数斜率(积分分离为1e30)
+  _PID_BANK_ARRAY(float, deadBand);   // 误差死区(不生效为0)
+  _PID_BANK_ARRAY(float, sumILimit);  // 积分限幅(不生效为FLT_MAX)
+  _PID_BANK_ARRAY(float, maxOutput);  // 输出上限(不生效为FLT_MAX)
+  _PID_BANK_ARRAY(float, minOutput);  // 输出下限(不生效为-FLT_MAX)
+  _PID_BANK_ARRAY(float, base);       // 基准值
+  /** 计算结果 **/
+  _PID_BANK_ARRAY(float, output);     // 输出值
+  _PID_BANK_ARRAY(float, error);      // error
+  _PID_BANK_ARRAY(float, sumI);       // 误差积分
+  _PID_BANK_ARRAY(float, sumP);       // 比例积分
+  _PID_BANK_ARRAY(float, lastPoint);  // 上次输入
+  _PID_BANK_ARRAY(float, limitFlag);  // 输出限幅标志(0:未限幅,1:上限,-1:下限)
+} pid_bank_t;
+
+typedef struct {  // PID控制器组(定点, q15输入输出)
+  uint16_t num;  // 控制器数量
+  /** 设置参数 **/
+  _PID_BANK_ARRAY(int16_t, setPoint);   // 设定目标(q15, 可直接修改)
+  /** 由pid_ctrl_t展开的系数 **/
+  _PID_BANK_ARRAY(int32_t, kp);         // 常数比例(Q15)
+  _PID_BANK_ARRAY(int32_t, kpm);        // PonM比例(Q15)
+  _PID_BANK_ARRAY(int32_t, kiTs);       // integral*Ts(Q31)
+  _PID_BANK_ARRAY(int32_t, kdTs);       // derivative/Ts(Q15)
+  _PID_BANK_ARRAY(int32_t, iK1);        // 积分系数为0的误差(q15)
+  _PID_BANK_ARRAY(int32_t, iK2Inv);     // 积分系数斜率(Q30)
+  _PID_BANK_ARRAY(int32_t, deadBand);   // 误差死区(q15)
+  _PID_BANK_ARRAY(int32_t, sumILimit);  // 积分限幅(Q31)
+  _PID_BANK_ARRAY(int16_t, maxOutput);  // 输出上限(q15)
+  _PID_BANK_ARRAY(int16_t, minOutput);  // 输出下限(q15)
+  _PID_BANK_ARRAY(int16_t, base);       // 基准值(q15)
+  /** 计算结果 **/
+  _PID_BANK_ARRAY(int16_t, output);     // 输出值(q15)
+  _PID_BANK_ARRAY(int32_t, error);      // error(q15, 可超出int16)
+  _PID_BANK_ARRAY(int32_t, sumI);       // 误差积分(Q31)
+  _PID_BANK_ARRAY(int32_t, sumP);       // 比例积分(Q31)
+  _PID_BANK_ARRAY(int16_t, lastPoint);  // 上次输入(q15)
+  _PID_BANK_ARRAY(int8_t, limitFlag);   // 输出限幅标志
+} pid_bank_q_t;
+
+/**
+ * @brief 初始化控制器组, 所有通道参数为0
+ * @param  num              控制器数量(<=PID_BANK_CFG_MAX_NUM)
+ * @retval 0: 成功 1: 数量超出
+ */
+extern uint8_t PIDBank_Init(pid_bank_t *bank, uint16_t num);
+
+/**
+ * @brief 由pid_ctrl_t设置一个通道的参数(包括setPoint和base)
+ * @note 只读取pid_ctrl_t的设置参数, 不修改通道的状态
+ */
+extern void PIDBank_SetChannel(pid_bank_t *bank, uint16_t idx,
+                               const pid_ctrl_t *cfg);
+
+/**
+ * @brief 更新组内所有控制器
+ * @param  input            num个测量值
+ * @note 输出在bank->output[]中
+ */
+extern void PIDBank_Calculate(pid_bank_t *bank, const float *input);
+
+/**
+ * @brief 重置通道初始值并清空状态, 同PID_ResetStartPoint()
+ */
+extern void PIDBank_ResetStartPoint(pid_bank_t *bank, uint16_t idx,
+                                    float startPoint);
+
+/**
+ * @brief 初始化定点控制器组, 所有通道参数为0, 输出范围为q15全范围
+ * @param  num              控制器数量(<=PID_BANK_CFG_MAX_NUM)
+ * @retval 0: 成功 1: 数量超出
+ */
+extern uint8_t PIDBankQ_Init(pid_bank_q_t *bank, uint16_t num);
+
+/**
+ * @brief 由pid_ctrl_t设置定点通道的参数
+ * @param  inFs             输入/设定值满量程(对应q15的1.0)
+ * @param  outFs            输出满量程(对应q15的1.0)
+ * @retval 0: 成功 1: 不支持自适应比例 2: 参数超出定点范围(已饱和)
+ * @note 在初始化时调用, 使用浮点运算
+ */
+extern uint8_t PIDBankQ_SetChannel(pid_bank_q_t *bank, uint16_t idx,
+                                   const pid_ctrl_t *cfg, float inFs,
+                                   float outFs);
+
+/**
+ * @brief 更新组内所有定点控制器
+ * @param  input            num个q15测量值
+ * @note 输出在bank->output[]中
+ */
+extern void PIDBankQ_Calculate(pid_bank_q_t *bank, const int16_t *input);
+
+/**
+ * @brief 重置定点通道初始值(q15)并清空状态
+ */
+extern void PIDBankQ_ResetStartPoint(pid_bank_q_t *bank, uint16_t idx,
+                                     int16_t startPoint);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // __PID_BANK_H
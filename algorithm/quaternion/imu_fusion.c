@@ -0,0 +1,202 @@
+#include "imu_fusion.h"
+
+#define Q30_ONE ((int64_t)1 << 30)
+#define Q31_ONE 2147483648.0f
+
+// arithmetic shift right with rounding to nearest
+#define RSHIFT(x, n) (((x) + ((int64_t)1 << ((n) - 1))) >> (n))
+
+
+void mahony_init(mahony_filter *f, float kp, float ki, float dt)
+{
+    f->q = quaternion_initialize(1.0f, 0.0f, 0.0f, 0.0f);
+    f->integral = vector_3d_initialize(0.0f, 0.0f, 0.0f);
+    f->kp = kp;
+    f->ki = ki;
+    f->dt = dt;
+}
+
+void mahony_update(mahony_filter *f, const imu_sample *samples, uint32_t count)
+{
+    float q0 = f->q.a, q1 = f->q.b, q2 = f->q.c, q3 = f->q.d;
+    float ix = f->integral.a, iy = f->integral.b, iz = f->integral.c;
+    const float kp = f->kp;
+    const float ki_dt = f->ki*f->dt;
+    const float hdt = 0.5f*f->dt;
+
+    for (uint32_t n = 0; n < count; n++)
+    {
+        const imu_sample *s = &samples[n];
+        float gx = s->gx, gy = s->gy, gz = s->gz;
+        float a2 = s->ax*s->ax + s->ay*s->ay + s->az*s->az;
+
+        if (a2 > 0.0f)
+        {
+            float r = InvSqrt(a2);
+            float ax = s->ax*r, ay = s->ay*r, az = s->az*r;
+            // gravity direction estimated from the quaternion
+            float vx = 2.0f*(q1*q3 - q0*q2);
+            float vy = 2.0f*(q0*q1 + q2*q3);
+            float vz = q0*q0 - q1*q1 - q2*q2 + q3*q3;
+            // error is the cross product between measured and estimated gravity
+            float ex = ay*vz - az*vy;
+            float ey = az*vx - ax*vz;
+            float ez = ax*vy - ay*vx;
+            if (ki_dt > 0.0f)
+            {
+                ix += ki_dt*ex;
+                iy += ki_dt*ey;
+                iz += ki_dt*ez;
+                gx += ix;
+                gy += iy;
+                gz += iz;
+            }
+            gx += kp*ex;
+            gy += kp*ey;
+            gz += kp*ez;
+        }
+
+        // q += q * (0, g) * dt / 2
+        gx *= hdt;
+        gy *= hdt;
+        gz *= hdt;
+        float a = q0, b = q1, c = q2;
+        q0 += -b*gx - c*gy - q3*gz;
+        q1 += a*gx + c*gz - q3*gy;
+        q2 += a*gy - b*gz + q3*gx;
+        q3 += a*gz + b*gy - c*gx;
+
+        // the norm only moves by (|g|*dt/2)^2 per step, one Newton step
+        // from 1 is as good as a full inverse square root here
+        float r = 1.5f - 0.5f*(q0*q0 + q1*q1 + q2*q2 + q3*q3);
+        q0 *= r;
+        q1 *= r;
+        q2 *= r;
+        q3 *= r;
+    }
+
+    f->q = quaternion_initialize(q0, q1, q2, q3);
+    f->integral = vector_3d_initialize(ix, iy, iz);
+}
+
+static int32_t q31_from_float(float x)
+{
+    x *= Q31_ONE;
+    if (x >= Q31_ONE)
+        return INT32_MAX;
+    if (x <= -Q31_ONE)
+        return INT32_MIN;
+    return (int32_t)x;
+}
+
+void mahony_q31_init(mahony_q31 *f, float kp, float ki, float dt, float gyro_scale)
+{
+    f->q[0] = (int32_t)Q30_ONE;
+    f->q[1] = f->q[2] = f->q[3] = 0;
+    f->integral[0] = f->integral[1] = f->integral[2] = 0;
+    f->kp_hdt = q31_from_float(0.5f*kp*dt);
+    f->ki_dt = q31_from_float(ki*dt);
+    f->hdt = q31_from_float(0.5f*dt);
+
+    // keep 31 significant bits of the gyro factor
+    float mul = gyro_scale*0.5f*dt*(float)Q30_ONE;
+    int8_t shift = 0;
+    while (mul*2.0f < Q31_ONE && shift < 62)
+    {
+        mul *= 2.0f;
+        shift++;
+    }
+    f->gyro_mul = q31_from_float(mul/Q31_ONE);
+    f->gyro_shift = shift;
+}
+
+// 1/sqrt(x) = y * 2^-shift, y in Q30 (1 < y <= 2), x > 0
+static int64_t inv_sqrt_q30(uint32_t x, int *shift)
+{
+    int s = __builtin_clz(x) & ~1;
+    int64_t m = (x << s) >> 2;   // x = m * 2^(32 - s), m in [0.25, 1) Q30
+    // linear first guess is within 20%, four Newton steps reach 1e-9
+    int64_t y = 2566242140LL - ((m*1503238554LL) >> 30);   // 2.39 - 1.4*m
+    for (int i = 0; i < 4; i++)
+    {
+        int64_t t = (m*((y*y) >> 30)) >> 30;
+        y = (y*(3*Q30_ONE - t)) >> 31;
+    }
+    *shift = 16 - s/2;
+    return y;
+}
+
+void mahony_q31_update(mahony_q31 *f, const imu_raw_sample *samples, uint32_t count)
+{
+    int64_t q0 = f->q[0], q1 = f->q[1], q2 = f->q[2], q3 = f->q[3];
+    int64_t ix = f->integral[0], iy = f->integral[1], iz = f->integral[2];
+    const int64_t gyro_mul = f->gyro_mul;
+    const int gyro_shift = f->gyro_shift;
+    const int64_t kp_hdt = f->kp_hdt, ki_dt = f->ki_dt, hdt = f->hdt;
+
+    for (uint32_t n = 0; n < count; n++)
+    {
+        const imu_raw_sample *s = &samples[n];
+        // half angle of the gyro step, Q30
+        int64_t hx = (s->gx*gyro_mul) >> gyro_shift;
+        int64_t hy = (s->gy*gyro_mul) >> gyro_shift;
+        int64_t hz = (s->gz*gyro_mul) >> gyro_shift;
+        // each square fits int32 but the sum may not, add them unsigned
+        uint32_t a2 = (uint32_t)((int32_t)s->ax*s->ax) +
+                      (uint32_t)((int32_t)s->ay*s->ay);
+        a2 += (uint32_t)((int32_t)s->az*s->az);
+
+        if (a2 > 0)
+        {
+            int shift;
+            int64_t r = inv_sqrt_q30(a2, &shift);
+            int64_t ax = (s->ax*r) >> shift;
+            int64_t ay = (s->ay*r) >> shift;
+            int64_t az = (s->az*r) >> shift;
+            int64_t vx = (q1*q3 - q0*q2) >> 29;
+            int64_t vy = (q0*q1 + q2*q3) >> 29;
+            int64_t vz = (q0*q0 - q1*q1 - q2*q2 + q3*q3) >> 30;
+            int64_t ex = (ay*vz - az*vy) >> 30;
+            int64_t ey = (az*vx - ax*vz) >> 30;
+            int64_t ez = (ax*vy - ay*vx) >> 30;
+            if (ki_dt > 0)
+            {
+                ix += (ex*ki_dt) >> 31;
+                iy += (ey*ki_dt) >> 31;
+                iz += (ez*ki_dt) >> 31;
+                hx += (ix*hdt) >> 31;
+                hy += (iy*hdt) >> 31;
+                hz += (iz*hdt) >> 31;
+            }
+            hx += (ex*kp_hdt) >> 31;
+            hy += (ey*kp_hdt) >> 31;
+            hz += (ez*kp_hdt) >> 31;
+        }
+
+        int64_t a = q0, b = q1, c = q2;
+        q0 += RSHIFT(-b*hx - c*hy - q3*hz, 30);
+        q1 += RSHIFT(a*hx + c*hz - q3*hy, 30);
+        q2 += RSHIFT(a*hy - b*hz + q3*hx, 30);
+        q3 += RSHIFT(a*hz + b*hy - c*hx, 30);
+
+        int64_t r = (3*Q30_ONE - ((q0*q0 + q1*q1 + q2*q2 + q3*q3) >> 30)) >> 1;
+        q0 = RSHIFT(q0*r, 30);
+        q1 = RSHIFT(q1*r, 30);
+        q2 = RSHIFT(q2*r, 30);
+        q3 = RSHIFT(q3*r, 30);
+    }
+
+    f->q[0] = (int32_t)q0;
+    f->q[1] = (int32_t)q1;
+    f->q[2] = (int32_t)q2;
+    f->q[3] = (int32_t)q3;
+    f->integral[0] = (int32_t)ix;
+    f->integral[1] = (int32_t)iy;
+    f->integral[2] = (int32_t)iz;
+}
+
+Quaternion mahony_q31_get_quaternion(const mahony_q31 *f)
+{
+    const float k = 1.0f/(float)Q30_ONE;
+    return quaternion_initialize(f->q[0]*k, f->q[1]*k, f->q[2]*k, f->q[3]*k);
+}
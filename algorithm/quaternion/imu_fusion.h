@@ -0,0 +1,72 @@
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef IMU_FUSION_INCLUDED
+#define IMU_FUSION_INCLUDED
+
+#include "quaternion.h"
+#include <stdint.h>
+
+/*
+ * Mahony attitude filter working on buffers of IMU samples.
+ *
+ * The float version uses only single precision math, the q31 version only
+ * integer math (float is used once in mahony_q31_init) so it also runs on
+ * cores without an FPU. Both keep the state in the filter struct, take the
+ * samples by pointer and normalize the quaternion once per sample.
+ *
+ * Quaternion convention is the same as the rest of this library:
+ * q = a + bi + cj + dk, gyro in the sensor frame, accelerometer measures
+ * the reaction to gravity (z is +1g when lying flat).
+ */
+
+typedef struct imu_sample {
+
+    float ax, ay, az;   // accelerometer, any unit
+    float gx, gy, gz;   // gyroscope, rad/s
+
+} imu_sample;
+
+typedef struct imu_raw_sample {
+
+    int16_t ax, ay, az; // accelerometer, raw LSB
+    int16_t gx, gy, gz; // gyroscope, raw LSB
+
+} imu_raw_sample;
+
+typedef struct mahony_filter {
+
+    Quaternion q;
+    vector_ijk integral;    // integral feedback, rad/s
+    float kp;               // proportional gain
+    float ki;               // integral gain, 0 to disable
+    float dt;               // sample period, s
+
+} mahony_filter;
+
+typedef struct mahony_q31 {
+
+    int32_t q[4];           // quaternion, Q30
+    int32_t integral[3];    // integral feedback, rad/s Q30
+    int32_t gyro_mul;       // raw gyro * gyro_mul >> gyro_shift = half angle, Q30
+    int8_t gyro_shift;
+    int32_t kp_hdt;         // kp * dt / 2, Q31
+    int32_t ki_dt;          // ki * dt, Q31
+    int32_t hdt;            // dt / 2, Q31
+
+} mahony_q31;
+
+void mahony_init(mahony_filter *f, float kp, float ki, float dt);
+void mahony_update(mahony_filter *f, const imu_sample *samples, uint32_t count);
+
+// gyro_scale: rad/s per raw LSB, the accelerometer scale does not matter
+void mahony_q31_init(mahony_q31 *f, float kp, float ki, float dt, float gyro_scale);
+void mahony_q31_update(mahony_q31 *f, const imu_raw_sample *samples, uint32_t count);
+Quaternion mahony_q31_get_quaternion(const mahony_q31 *f);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,7 @@
 #include "quaternion.h"
+#if __has_include("fast_math.h")
+#include "fast_math.h"
+#endif
 
 
 Quaternion quaternion_initialize(float a, float b, float c, float d)
@@ -68,6 +71,19 @@ vector_ijk quaternion_rotate_vector(vector_ijk v, Quaternion q)
 euler_angles quaternion_to_euler_angles(Quaternion q)
 {
     euler_angles result;
+#if FAST_MATH_CFG_QUATERNION
+    const float rad_to_deg = 57.2957795f;
+    float q0 = q.a;
+    float q1 = q.b;
+    float q2 = q.c;
+    float q3 = q.d;
+    result.roll = FM_Atan2(2.0f*(q0*q1 + q2*q3),1.0f - 2.0f*(q1*q1 + q2*q2))*rad_to_deg;
+    result.pitch = FM_Asin(2.0f*(q0*q2 - q3*q1))*rad_to_deg;
+    if (q.d==0)
+        result.yaw = 0.0f;
+    else
+        result.yaw = FM_Atan2(2.0f*(q0*q3 + q1*q2),1.0f - 2.0f*(q2*q2 + q3*q3))*rad_to_deg;
+#else
     double q0 = q.a;
     double q1 = q.b;
     double q2 = q.c;
@@ -78,5 +94,6 @@ euler_angles quaternion_to_euler_angles(Quaternion q)
         result.yaw = 0.0;
     else
         result.yaw = atan2(2*(q0*q3 + q1*q2),1 - 2*(q2*q2 + q3*q3))*180/3.14;
+#endif
     return result;
 }
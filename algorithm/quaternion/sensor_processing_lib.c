@@ -1,4 +1,7 @@
 #include "sensor_processing_lib.h"
+#if __has_include("fast_math.h")
+#include "fast_math.h"
+#endif
 
 Quaternion quaternion_from_accelerometer(float ax, float ay, float az)
 {
@@ -9,7 +12,11 @@ Quaternion quaternion_from_accelerometer(float ax, float ay, float az)
     float norm_u_norm_v = 1.0;
     float cos_theta = -1.0*az;
     //float half_cos = sqrt(0.5*(1.0 + cos_theta));
+#if FAST_MATH_CFG_QUATERNION
+    float half_cos = 0.7071f*FM_Sqrt(1.0f + cos_theta);
+#else
     float half_cos = 0.7071*sqrt(1.0 + cos_theta);
+#endif
     Quaternion orientation;
     orientation.a = half_cos;
     //float temp = 1/(2.0*half_cos);
@@ -1,5 +1,8 @@
 #include "vector_3d.h"
 #include <stdint.h>
+#if __has_include("fast_math.h")
+#include "fast_math.h"
+#endif
 
 vector_ijk vector_3d_initialize(float a, float b, float c)
 {
@@ -66,7 +69,11 @@ vector_ijk vector_3d_scale(vector_ijk v1, float scale)
 
 float InvSqrt(float x)
 {
+#if FAST_MATH_CFG_QUATERNION
+   return FM_InvSqrt(x);
+#else
    uint32_t i = 0x5F1F1412 - (*(uint32_t*)&x >> 1);
    float tmp = *(float*)&i;
    return tmp * (1.69000231f - 0.714158168f * x * tmp * tmp);
+#endif
 }
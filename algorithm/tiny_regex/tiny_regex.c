@@ -653,3 +653,660 @@ static inline pat_size_t __getItemEndPos(const char* _pattern,
 }
 
 #endif
+
+// COMPILED PROGRAM ---------------
+/*
+ * tregex_compile() parses the pattern once into a Thompson NFA program and
+ * tregex_match_prog() runs it as a Pike VM: all threads advance over the
+ * string together, so every character is read once and the work per
+ * character is bounded by the program length (no backtracking).
+ *
+ * The program supports the same syntax as tregex_match_str() plus '(..|..)'
+ * and nested repeats of groups. '?' '*' '+' '{n,m}' are greedy, the first
+ * (leftmost) match is returned.
+ */
+
+#define TR_OP_CHAR 0x01   // match the character Arg
+#define TR_OP_ANY 0x02    // '.'
+#define TR_OP_CLASS 0x03  // match one of the class bitmap X
+#define TR_OP_SPLIT 0x04  // continue at X and at Y, X first
+#define TR_OP_JMP 0x05    // continue at X
+#define TR_OP_BOL 0x06    // '^'
+#define TR_OP_EOL 0x07    // '$'
+#define TR_OP_MATCH 0x08
+
+#define TR_CLASS_SIZE 32  // bytes of a 256 bit class bitmap
+#define TR_PC_NULL 0xFFFF
+
+typedef struct {
+  uint8_t Op;
+  uint8_t Arg;
+  uint16_t X;
+  uint16_t Y;
+} tr_inst_t;
+
+typedef struct {
+  const char* Pat;
+  tr_inst_t* Code;  // NULL while only counting the instructions
+  uint8_t* Class;
+  uint16_t Pc;
+  uint16_t NumClass;
+  uint8_t Level;
+  uint8_t Err;
+} tr_comp_t;
+
+typedef struct {
+  uint16_t Pc;
+  uint32_t Start;
+} tr_thread_t;
+
+static inline uint16_t __emit(tr_comp_t* _c, uint8_t _op, uint8_t _arg,
+                              uint16_t _x, uint16_t _y) {
+  uint16_t pc = _c->Pc;
+  if (pc >= TINY_REGEX_CONFIG_PROG_LEN) {
+    _c->Err = 1;
+    return pc;
+  }
+  if (_c->Code != NULL) {
+    _c->Code[pc].Op = _op;
+    _c->Code[pc].Arg = _arg;
+    _c->Code[pc].X = _x;
+    _c->Code[pc].Y = _y;
+  }
+  _c->Pc++;
+  return pc;
+}
+
+static inline void __patch(tr_comp_t* _c, uint16_t _pc, uint16_t _x,
+                           uint16_t _y) {
+  if (_c->Code != NULL && _pc < TINY_REGEX_CONFIG_PROG_LEN) {
+    _c->Code[_pc].X = _x;
+    _c->Code[_pc].Y = _y;
+  }
+}
+
+/*
+ *   _pos :        position of an atom in the pattern
+ *  _end :         end of the current (sub)pattern
+ *  return:        the position after the atom
+ */
+static inline pat_size_t __skipAtom(tr_comp_t* _c, pat_size_t _pos,
+                                    pat_size_t _end) {
+  const char* p = _c->Pat;
+  uint8_t level = 0;
+  do {
+    if (p[_pos] == '\\') {
+      _pos += 2;
+      continue;
+    }
+    if (p[_pos] == '[') {
+      _pos++;
+      if (_pos < _end && p[_pos] == '^') {
+        _pos++;
+      }
+      if (_pos < _end && p[_pos] == ']') {
+        _pos++;
+      }
+      while (_pos < _end && p[_pos] != ']') {
+        _pos += p[_pos] == '\\' ? 2 : 1;
+      }
+    } else if (p[_pos] == '(') {
+      level++;
+    } else if (p[_pos] == ')' && level > 0) {
+      level--;
+    }
+    _pos++;
+  } while (level > 0 && _pos < _end);
+  if (level > 0 || _pos > _end) {
+    _c->Err = 1;
+    return _end;
+  }
+  return _pos;
+}
+
+static inline void __classSpec(uint8_t* _map, char _spec) {
+  for (uint16_t ch = 0; ch < 256; ch++) {
+    uint8_t in;
+    switch (_spec | 0x20) {
+      case 'd':
+        in = '0' <= ch && ch <= '9';
+        break;
+      case 'w':
+        in = ('a' <= ch && ch <= 'z') || ('A' <= ch && ch <= 'Z') ||
+             ('0' <= ch && ch <= '9') || ch == '_';
+        break;
+      default:  // 's'
+        in = ch == ' ' || ch == '\r' || ch == '\n' || ch == '\t' ||
+             ch == '\f' || ch == '\v';
+        break;
+    }
+    if (in != (_spec < 'a')) {
+      _map[ch >> 3] |= 1 << (ch & 7);
+    }
+  }
+}
+
+static inline uint8_t __isSpec(char _c) {
+  switch (_c) {
+    case 's':
+    case 'S':
+    case 'w':
+    case 'W':
+    case 'd':
+    case 'D':
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+static inline void __emitClass(tr_comp_t* _c, const uint8_t* _map) {
+  if (_c->NumClass >= 255) {
+    _c->Err = 1;
+    return;
+  }
+  if (_c->Class != NULL) {
+    memcpy(&_c->Class[_c->NumClass * TR_CLASS_SIZE], _map, TR_CLASS_SIZE);
+  }
+  __emit(_c, TR_OP_CLASS, 0, _c->NumClass++, 0);
+}
+
+/*
+ *   _pos, _end :  the characters between '[' and ']'
+ */
+static inline void __compClass(tr_comp_t* _c, pat_size_t _pos,
+                               pat_size_t _end) {
+  const char* p = _c->Pat;
+  uint8_t map[TR_CLASS_SIZE] = {0};
+  uint8_t not = 0;
+  if (_pos < _end && p[_pos] == '^') {
+    not = 1;
+    _pos++;
+  }
+  while (_pos < _end) {
+    uint8_t lo = (uint8_t)p[_pos], hi;
+    if (lo == '\\' && _pos + 1 < _end) {
+      _pos++;
+      if (__isSpec(p[_pos])) {
+        __classSpec(map, p[_pos++]);
+        continue;
+      }
+      lo = (uint8_t)p[_pos];
+    }
+    _pos++;
+    hi = lo;
+    if (_pos + 1 < _end && p[_pos] == '-') {
+      hi = (uint8_t)p[_pos + 1];
+      if (hi == '\\' && _pos + 2 < _end) {
+        hi = (uint8_t)p[++_pos + 1];
+      }
+      _pos += 2;
+    }
+    for (uint16_t ch = lo; ch <= hi; ch++) {
+      map[ch >> 3] |= 1 << (ch & 7);
+    }
+  }
+  if (not == 1) {
+    for (uint8_t i = 0; i < TR_CLASS_SIZE; i++) {
+      map[i] = ~map[i];
+    }
+  }
+  __emitClass(_c, map);
+}
+
+static void __compAlt(tr_comp_t* _c, pat_size_t _pos, pat_size_t _end);
+
+static inline void __compAtom(tr_comp_t* _c, pat_size_t _pos,
+                              pat_size_t _end) {
+  const char* p = _c->Pat;
+  switch (p[_pos]) {
+    case '(': {
+      if (++_c->Level > TINY_REGEX_CONFIG_DEPTH_LEVEL) {
+        _c->Err = 1;
+        return;
+      }
+      __compAlt(_c, _pos + 1, _end - 1);
+      _c->Level--;
+    } break;
+    case '[': {
+      __compClass(_c, _pos + 1, _end - 1);
+    } break;
+    case '\\': {
+      if (_pos + 1 >= _end) {
+        _c->Err = 1;
+      } else if (__isSpec(p[_pos + 1])) {
+        uint8_t map[TR_CLASS_SIZE] = {0};
+        __classSpec(map, p[_pos + 1]);
+        __emitClass(_c, map);
+      } else {
+        __emit(_c, TR_OP_CHAR, (uint8_t)p[_pos + 1], 0, 0);
+      }
+    } break;
+    case '.': {
+      __emit(_c, TR_OP_ANY, 0, 0, 0);
+    } break;
+    case '^': {
+      __emit(_c, TR_OP_BOL, 0, 0, 0);
+    } break;
+    case '$': {
+      __emit(_c, TR_OP_EOL, 0, 0, 0);
+    } break;
+    case ')':
+    case '*':
+    case '+':
+    case '?':
+    case '{': {
+      _c->Err = 1;
+    } break;
+    default:
+      __emit(_c, TR_OP_CHAR, (uint8_t)p[_pos], 0, 0);
+      break;
+  }
+}
+
+/*
+ *   _pos :        position after '{'
+ *  _repeat :      the parsed Min and Max, Max < 0 if unlimited
+ *  return:        the position after '}'
+ */
+static inline pat_size_t __compBraces(tr_comp_t* _c, pat_size_t _pos,
+                                      pat_size_t _end, tr_repeat_t* _repeat) {
+  const char* p = _c->Pat;
+  int32_t val = -1, min = -1;
+  uint8_t side = 0;
+  for (; _pos < _end && p[_pos] != '}'; _pos++) {
+    if (p[_pos] == ',' && side == 0) {
+      side = 1;
+      min = val;
+      val = -1;
+    } else if ('0' <= p[_pos] && p[_pos] <= '9' && val < 10000) {
+      val = (val < 0 ? 0 : val * 10) + p[_pos] - '0';
+    } else {
+      break;
+    }
+  }
+  if (_pos >= _end || p[_pos] != '}') {
+    _c->Err = 1;
+    return _end;
+  }
+  if (side == 0) {
+    min = val;
+  }
+  _repeat->Min = min < 0 ? 0 : min;
+  _repeat->Max = side == 0 ? min : val;
+  if (side == 0 && val < 0) {
+    _c->Err = 1;  // '{}'
+  }
+  if (_repeat->Max >= 0 && _repeat->Max < _repeat->Min) {
+    _c->Err = 1;
+  }
+  return _pos + 1;
+}
+
+/*
+ * compiles the atom at [_pos, _aend) repeated _repeat times, the atom is
+ * compiled again for each copy, so no code has to be moved
+ */
+static inline void __compRepeat(tr_comp_t* _c, pat_size_t _pos,
+                                pat_size_t _aend, tr_repeat_t _repeat) {
+  uint16_t split;
+  for (int16_t i = 0; i < _repeat.Min && _c->Err == 0; i++) {
+    __compAtom(_c, _pos, _aend);
+  }
+  if (_repeat.Max < 0) {
+    // L0: SPLIT L1, L2; L1: atom; JMP L0; L2:
+    split = __emit(_c, TR_OP_SPLIT, 0, 0, 0);
+    __compAtom(_c, _pos, _aend);
+    __emit(_c, TR_OP_JMP, 0, split, 0);
+    __patch(_c, split, split + 1, _c->Pc);
+    return;
+  }
+  for (int16_t i = _repeat.Min; i < _repeat.Max && _c->Err == 0; i++) {
+    // SPLIT L1, L2; L1: atom; L2:
+    split = __emit(_c, TR_OP_SPLIT, 0, 0, 0);
+    __compAtom(_c, _pos, _aend);
+    __patch(_c, split, split + 1, _c->Pc);
+  }
+}
+
+static inline void __compConcat(tr_comp_t* _c, pat_size_t _pos,
+                                pat_size_t _end) {
+  const char* p = _c->Pat;
+  while (_pos < _end && _c->Err == 0) {
+    pat_size_t aend = __skipAtom(_c, _pos, _end);
+    tr_repeat_t repeat = {.Min = 1, .Max = 1, .Num = 0};
+    pat_size_t next = aend;
+    if (aend < _end) {
+      switch (p[aend]) {
+        case '?':
+          repeat.Min = 0;
+          next++;
+          break;
+        case '*':
+          repeat.Min = 0;
+          repeat.Max = -1;
+          next++;
+          break;
+        case '+':
+          repeat.Max = -1;
+          next++;
+          break;
+        case '{':
+          next = __compBraces(_c, aend + 1, _end, &repeat);
+          break;
+        default:
+          break;
+      }
+    }
+    if (repeat.Min == 1 && repeat.Max == 1) {
+      __compAtom(_c, _pos, aend);
+    } else if (repeat.Min == 1 && repeat.Max < 0) {
+      // L1: atom; SPLIT L1, L2; L2:
+      uint16_t start = _c->Pc;
+      __compAtom(_c, _pos, aend);
+      __emit(_c, TR_OP_SPLIT, 0, start, _c->Pc + 1);
+    } else {
+      __compRepeat(_c, _pos, aend, repeat);
+    }
+    _pos = next;
+  }
+}
+
+static void __compAlt(tr_comp_t* _c, pat_size_t _pos, pat_size_t _end) {
+  const char* p = _c->Pat;
+  uint16_t jmp = TR_PC_NULL;
+  while (_c->Err == 0) {
+    // find the end of this branch
+    pat_size_t bend = _pos;
+    while (bend < _end && p[bend] != '|' && _c->Err == 0) {
+      bend = __skipAtom(_c, bend, _end);
+    }
+    if (bend >= _end) {
+      __compConcat(_c, _pos, _end);
+      break;
+    }
+    // SPLIT L1, L2; L1: branch; JMP end; L2: next branches
+    uint16_t split = __emit(_c, TR_OP_SPLIT, 0, 0, 0);
+    __compConcat(_c, _pos, bend);
+    // the JMPs to the end are chained through X until it is known
+    jmp = __emit(_c, TR_OP_JMP, 0, jmp, 0);
+    __patch(_c, split, split + 1, _c->Pc);
+    _pos = bend + 1;
+  }
+  while (_c->Code != NULL && jmp != TR_PC_NULL &&
+         jmp < TINY_REGEX_CONFIG_PROG_LEN) {
+    uint16_t prev = _c->Code[jmp].X;
+    _c->Code[jmp].X = _c->Pc;
+    jmp = prev;
+  }
+}
+
+/*
+ * finds what the matcher can skip to while no thread is alive: the literal
+ * prefix of the program, or else the set of characters that the
+ * instructions reachable from the start can consume
+ */
+static inline void __compLead(tr_prog_t* _prog, const tr_inst_t* _code,
+                              const uint8_t* _class) {
+  uint16_t stack[TINY_REGEX_CONFIG_PROG_LEN * 2];
+  uint8_t seen[TINY_REGEX_CONFIG_PROG_LEN] = {0};
+  uint16_t sp = 0, pc;
+  _prog->Prefix = 0;
+  while (_prog->Prefix < 255 && _code[_prog->Prefix].Op == TR_OP_CHAR) {
+    _prog->Prefix++;
+  }
+  memset(_prog->Lead, 0, sizeof(_prog->Lead));
+  stack[sp++] = 0;
+  while (sp > 0) {
+    pc = stack[--sp];
+    if (seen[pc] != 0) {
+      continue;
+    }
+    seen[pc] = 1;
+    switch (_code[pc].Op) {
+      case TR_OP_CHAR: {
+        _prog->Lead[_code[pc].Arg >> 3] |= 1 << (_code[pc].Arg & 7);
+      } break;
+      case TR_OP_CLASS: {
+        for (uint8_t i = 0; i < TR_CLASS_SIZE; i++) {
+          _prog->Lead[i] |= _class[_code[pc].X * TR_CLASS_SIZE + i];
+        }
+      } break;
+      case TR_OP_SPLIT: {
+        stack[sp++] = _code[pc].Y;
+        stack[sp++] = _code[pc].X;
+      } break;
+      case TR_OP_JMP: {
+        stack[sp++] = _code[pc].X;
+      } break;
+      case TR_OP_BOL: {
+        stack[sp++] = pc + 1;
+      } break;
+      default: {  // '.', '$' or an empty match, any position can start one
+        memset(_prog->Lead, 0xFF, sizeof(_prog->Lead));
+        return;
+      } break;
+    }
+  }
+}
+
+/* fn   : tregex_compile
+ * des  : compile the pattern into a program for tregex_match_prog()
+ * args : _pattern : string of regular expression
+ *        _plen    : length of _pattern, when it zero it will be calculated by
+ *                   strlen()
+ *        _buf     : buffer of the program, 4 byte aligned, it is only written
+ *                   when it is at least as large as the returned size
+ *        _size    : size of _buf in bytes
+ * res  : the size of the program in bytes, 0 on a syntax error or when the
+ *        program is longer than TINY_REGEX_CONFIG_PROG_LEN
+ */
+uint32_t tregex_compile(const char* _pattern, pat_size_t _plen, void* _buf,
+                        uint32_t _size) {
+  tr_comp_t comp = {.Pat = _pattern};
+  tr_prog_t* prog = (tr_prog_t*)_buf;
+  uint32_t size;
+  if (_pattern == NULL) {
+    return 0;
+  }
+  if (_plen == 0) {
+    _plen = strlen(_pattern);
+  }
+
+  // count the instructions and classes first
+  __compAlt(&comp, 0, _plen);
+  __emit(&comp, TR_OP_MATCH, 0, 0, 0);
+  if (comp.Err != 0) {
+    return 0;
+  }
+  size = sizeof(tr_prog_t) + sizeof(tr_inst_t) * comp.Pc +
+         TR_CLASS_SIZE * comp.NumClass;
+  if (prog == NULL || _size < size) {
+    return size;
+  }
+
+  prog->Size = size;
+  prog->Len = comp.Pc;
+  prog->Classes = comp.NumClass;
+  comp.Code = (tr_inst_t*)(prog + 1);
+  comp.Class = (uint8_t*)(comp.Code + comp.Pc);
+  comp.Pc = 0;
+  comp.NumClass = 0;
+  __compAlt(&comp, 0, _plen);
+  __emit(&comp, TR_OP_MATCH, 0, 0, 0);
+  __compLead(prog, comp.Code, comp.Class);
+  return size;
+}
+
+/*
+ * adds the thread at _pc and everything reachable from it without reading a
+ * character to _list, in priority order. _mark keeps each pc in the list
+ * once, which also stops empty loops like '(a*)*'
+ */
+static inline void __addThread(const tr_inst_t* _code, tr_thread_t* _list,
+                               uint16_t* _num, uint32_t* _mark, uint32_t _pos,
+                               uint32_t _slen, uint16_t _pc, uint32_t _start) {
+  uint16_t stack[TINY_REGEX_CONFIG_PROG_LEN * 2];
+  uint16_t sp = 0;
+  const uint32_t gen = _pos + 1;
+  if (_code[_pc].Op <= TR_OP_CLASS || _code[_pc].Op == TR_OP_MATCH) {
+    if (_mark[_pc] != gen) {  // the common case, no jumps to follow
+      _mark[_pc] = gen;
+      _list[*_num].Pc = _pc;
+      _list[*_num].Start = _start;
+      (*_num)++;
+    }
+    return;
+  }
+  stack[sp++] = _pc;
+  while (sp > 0) {
+    uint16_t pc = stack[--sp];
+    if (_mark[pc] == gen) {
+      continue;
+    }
+    _mark[pc] = gen;
+    switch (_code[pc].Op) {
+      case TR_OP_JMP: {
+        stack[sp++] = _code[pc].X;
+      } break;
+      case TR_OP_SPLIT: {
+        stack[sp++] = _code[pc].Y;
+        stack[sp++] = _code[pc].X;
+      } break;
+      case TR_OP_BOL: {
+        if (_pos == 0) {
+          stack[sp++] = pc + 1;
+        }
+      } break;
+      case TR_OP_EOL: {
+        if (_pos == _slen) {
+          stack[sp++] = pc + 1;
+        }
+      } break;
+      default: {
+        _list[*_num].Pc = pc;
+        _list[*_num].Start = _start;
+        (*_num)++;
+      } break;
+    }
+  }
+}
+
+/*
+ *  return:        position of the next occurrence of the literal prefix of
+ *                 the program, _slen if there is none
+ */
+static inline uint32_t __findPrefix(const tr_inst_t* _code, uint8_t _prefix,
+                                    const char* _srcstr, uint32_t _pos,
+                                    uint32_t _slen) {
+  while (_slen - _pos >= _prefix) {
+    const char* next = memchr(&_srcstr[_pos], _code[0].Arg, _slen - _pos);
+    uint8_t i = 1;
+    if (next == NULL) {
+      break;
+    }
+    _pos = (uint32_t)(next - _srcstr);
+    if (_slen - _pos < _prefix) {
+      break;
+    }
+    while (i < _prefix && (uint8_t)_srcstr[_pos + i] == _code[i].Arg) {
+      i++;
+    }
+    if (i == _prefix) {
+      return _pos;
+    }
+    _pos++;
+  }
+  return _slen;
+}
+
+/* fn   : tregex_match_prog
+ * des  : match the string with a program from tregex_compile()
+ * args : _prog    : the compiled program
+ *        _srcstr  : sources string
+ *        _slen    : length of sources string, when it zero it will be
+ *                   calculated by strlen()
+ * res  : the first match in the string
+ */
+tr_res_t tregex_match_prog(const tr_prog_t* _prog, const char* _srcstr,
+                           uint32_t _slen) {
+  tr_res_t res = {.Data = NULL, .Size = 0};
+  tr_thread_t list[2][TINY_REGEX_CONFIG_PROG_LEN];
+  uint32_t mark[TINY_REGEX_CONFIG_PROG_LEN];
+  uint16_t num[2] = {0, 0};
+  uint8_t cur = 0;
+  if (_prog == NULL || _srcstr == NULL) {
+    return res;
+  }
+  if (_slen == 0) {
+    _slen = strlen(_srcstr);
+  }
+  const tr_inst_t* code = (const tr_inst_t*)(_prog + 1);
+  const uint8_t* classes = (const uint8_t*)(code + _prog->Len);
+  const uint8_t anchored = code[0].Op == TR_OP_BOL;
+  memset(mark, 0, sizeof(uint32_t) * _prog->Len);
+
+  for (uint32_t pos = 0;; pos++) {
+    // a new thread for a match starting here, after all earlier starts
+    if (res.Data == NULL && (pos == 0 || anchored == 0)) {
+      // nothing alive, skip to where a match can start
+      if (num[cur] == 0 && anchored == 0) {
+        if (_prog->Prefix > 0) {
+          pos = __findPrefix(code, _prog->Prefix, _srcstr, pos, _slen);
+          if (pos >= _slen) {
+            break;
+          }
+        } else {
+          while (pos < _slen && ((_prog->Lead[(uint8_t)_srcstr[pos] >> 3] >>
+                                  ((uint8_t)_srcstr[pos] & 7)) &
+                                 1) == 0) {
+            pos++;
+          }
+        }
+      }
+      __addThread(code, list[cur], &num[cur], mark, pos, _slen, 0, pos);
+    }
+    if (num[cur] == 0) {
+      break;
+    }
+
+    const uint8_t nxt = cur ^ 1;
+    const uint8_t c = pos < _slen ? (uint8_t)_srcstr[pos] : 0;
+    num[nxt] = 0;
+    for (uint16_t i = 0; i < num[cur]; i++) {
+      const tr_inst_t* inst = &code[list[cur][i].Pc];
+      uint8_t hit = 0;
+      switch (inst->Op) {
+        case TR_OP_MATCH: {
+          res.Data = &_srcstr[list[cur][i].Start];
+          res.Size = pos - list[cur][i].Start;
+          i = num[cur];  // drop the threads of lower priority
+        } break;
+        case TR_OP_CHAR: {
+          hit = c == inst->Arg;
+        } break;
+        case TR_OP_ANY: {
+#if TINY_REGEX_CONFIG_DOT_IGNORE_NEWLINE == 1
+          hit = c != '\r' && c != '\n';
+#else
+          hit = 1;
+#endif
+        } break;
+        case TR_OP_CLASS: {
+          hit = (classes[inst->X * TR_CLASS_SIZE + (c >> 3)] >> (c & 7)) & 1;
+        } break;
+        default:
+          break;
+      }
+      if (hit && pos < _slen) {
+        __addThread(code, list[nxt], &num[nxt], mark, pos + 1, _slen,
+                    list[cur][i].Pc + 1, list[cur][i].Start);
+      }
+    }
+    if (pos >= _slen) {
+      break;
+    }
+    cur = nxt;
+  }
+  return res;
+}
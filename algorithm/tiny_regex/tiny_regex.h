@@ -88,6 +88,12 @@ extern "C" {
 #define TINY_REGEX_CONFIG_PATTERN_SIZE 2
 #endif
 
+/* Maximum instructions of a compiled program, this bounds the matcher
+ * state on the stack to about 24 bytes per instruction */
+#ifndef TINY_REGEX_CONFIG_PROG_LEN
+#define TINY_REGEX_CONFIG_PROG_LEN 64
+#endif
+
 // TYPEDEF -----------------------------------------------------
 #if (TINY_REGEX_CONFIG_PATTERN_SIZE == 0)
 typedef uint8_t pat_size_t;
@@ -102,9 +108,25 @@ typedef struct {
   uint32_t Size;
 } tr_res_t;
 
+/* Header of a compiled program, the instructions and the 256 bit character
+ * class bitmaps follow it in the same buffer */
+typedef struct {
+  uint32_t Size;     // size of the whole program in bytes
+  uint16_t Len;      // number of instructions
+  uint8_t Classes;   // number of character class bitmaps
+  uint8_t Prefix;    // number of literal characters every match starts with
+  uint8_t Lead[32];  // bitmap of the characters a match can start with
+} tr_prog_t;
+
 tr_res_t tregex_match_str(const char* _srcstr, uint32_t _slen,
                           const char* _pattern, pat_size_t _plen);
 
+uint32_t tregex_compile(const char* _pattern, pat_size_t _plen, void* _buf,
+                        uint32_t _size);
+
+tr_res_t tregex_match_prog(const tr_prog_t* _prog, const char* _srcstr,
+                           uint32_t _slen);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,236 @@
+/**
+ * @file win_stats.c
+ * @brief 滑动窗口流式统计(均值/方差/最值/百分位)与指数滑动平均
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-23
+ * @note 使用说明见win_stats.h
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "win_stats.h"
+
+#include <string.h>
+
+// Private Defines --------------------------
+
+#define WS_INLINE static inline __attribute__((always_inline))
+
+// Private Functions ------------------------
+
+WS_INLINE uint16_t ring_next(uint16_t i, uint16_t len) {
+  return ++i == len ? 0 : i;
+}
+
+WS_INLINE uint16_t hist_bin(const win_stats_t *ws, float x) {
+  float t = (x - ws->lo) * ws->binScale;
+  if (!(t > 0)) return 0;  // 同时处理NaN
+  if (t >= ws->bins) return ws->bins - 1;
+  return (uint16_t)t;
+}
+
+/**
+ * @brief 样本pos加入单调队列, 先从队尾移除被它支配的样本
+ * @param  is_max           1: 最大值队列(递减) 0: 最小值队列(递增)
+ */
+WS_INLINE void deque_push(win_stats_t *ws, win_stats_deque_t *dq,
+                          uint16_t pos, float x, uint8_t is_max) {
+  while (dq->cnt) {
+    uint16_t tail = dq->head + dq->cnt - 1;
+    if (tail >= ws->len) tail -= ws->len;
+    float v = ws->buf[dq->pos[tail]];
+    if (is_max ? v > x : v < x) break;
+    dq->cnt--;
+  }
+  uint16_t tail = dq->head + dq->cnt;
+  if (tail >= ws->len) tail -= ws->len;
+  dq->pos[tail] = pos;
+  dq->cnt++;
+}
+
+/**
+ * @brief 最旧的样本pos移出窗口, 它只可能在队头
+ */
+WS_INLINE void deque_expire(win_stats_t *ws, win_stats_deque_t *dq,
+                            uint16_t pos) {
+  if (dq->cnt && dq->pos[dq->head] == pos) {
+    dq->head = ring_next(dq->head, ws->len);
+    dq->cnt--;
+  }
+}
+
+/**
+ * @brief 由窗口内的样本重新计算均值和M2, 消除递推的累积误差
+ * @note 用double两遍求和, 每RESYNC个窗口才执行一次, 均摊开销很小
+ */
+static void resum(win_stats_t *ws) {
+  double sum = 0, m2 = 0;
+  for (uint16_t i = 0; i < ws->count; i++) sum += ws->buf[i];
+  double mean = sum / ws->count;
+  for (uint16_t i = 0; i < ws->count; i++) {
+    double d = ws->buf[i] - mean;
+    m2 += d * d;
+  }
+  ws->mean = (float)mean;
+  ws->m2 = (float)m2;
+}
+
+// Public Functions -------------------------
+
+int WinStats_Init(win_stats_t *ws, uint16_t len, uint8_t flags) {
+  memset(ws, 0, sizeof(win_stats_t));
+  if (len == 0) return -1;
+  // 两个单调队列紧跟在样本环后面
+  uint32_t size = len * sizeof(float);
+  if (flags & WIN_STATS_MINMAX) size += 2 * len * sizeof(uint16_t);
+  ws->buf = m_alloc(size);
+  if (ws->buf == NULL) return -1;
+  if (flags & WIN_STATS_MINMAX) {
+    ws->max.pos = (uint16_t *)(ws->buf + len);
+    ws->min.pos = ws->max.pos + len;
+  }
+  ws->len = len;
+  ws->flags = flags;
+  ws->invLen = 1.0f / len;
+  return 0;
+}
+
+int WinStats_EnablePercentile(win_stats_t *ws, float lo, float hi,
+                              uint16_t bins) {
+  if (ws->buf == NULL || bins == 0 || !(hi > lo)) return -1;
+  uint16_t *hist = m_alloc(bins * sizeof(uint16_t));
+  if (hist == NULL) return -1;
+  if (ws->hist != NULL) m_free(ws->hist);
+  memset(hist, 0, bins * sizeof(uint16_t));
+  ws->hist = hist;
+  ws->bins = bins;
+  ws->lo = lo;
+  ws->binScale = bins / (hi - lo);
+  for (uint16_t i = 0; i < ws->count; i++) hist[hist_bin(ws, ws->buf[i])]++;
+  return 0;
+}
+
+void WinStats_Deinit(win_stats_t *ws) {
+  if (ws->buf != NULL) m_free(ws->buf);
+  if (ws->hist != NULL) m_free(ws->hist);
+  memset(ws, 0, sizeof(win_stats_t));
+}
+
+void WinStats_Reset(win_stats_t *ws) {
+  ws->wr = ws->count = 0;
+  ws->mean = ws->m2 = 0;
+  ws->resync = 0;
+  ws->max.head = ws->max.cnt = 0;
+  ws->min.head = ws->min.cnt = 0;
+  if (ws->hist != NULL) memset(ws->hist, 0, ws->bins * sizeof(uint16_t));
+}
+
+void WinStats_Push(win_stats_t *ws, float x) {
+  const uint16_t pos = ws->wr;
+  const uint8_t minmax = ws->flags & WIN_STATS_MINMAX;
+  if (ws->count == ws->len) {
+    // 窗口已满, 写指针处为最旧的样本y, 替换为x
+    const float y = ws->buf[pos];
+    if (minmax) {
+      deque_expire(ws, &ws->max, pos);
+      deque_expire(ws, &ws->min, pos);
+    }
+    if (ws->hist != NULL) ws->hist[hist_bin(ws, y)]--;
+    const float d = x - y;
+    const float mean = ws->mean + d * ws->invLen;
+    ws->m2 += d * (x - mean + y - ws->mean);
+    ws->mean = mean;
+#if WIN_STATS_CFG_RESYNC > 0
+    if (++ws->resync >= (uint32_t)WIN_STATS_CFG_RESYNC * ws->len) {
+      ws->buf[pos] = x;
+      resum(ws);
+      ws->resync = 0;
+    }
+#endif
+  } else {
+    ws->count++;
+    const float d = x - ws->mean;
+    ws->mean += d / ws->count;
+    ws->m2 += d * (x - ws->mean);
+  }
+  ws->buf[pos] = x;
+  ws->wr = ring_next(pos, ws->len);
+  if (minmax) {
+    deque_push(ws, &ws->max, pos, x, 1);
+    deque_push(ws, &ws->min, pos, x, 0);
+  }
+  if (ws->hist != NULL) ws->hist[hist_bin(ws, x)]++;
+}
+
+void WinStats_PushBlock(win_stats_t *ws, const float *x, uint32_t n) {
+  while (n--) WinStats_Push(ws, *x++);
+}
+
+uint32_t WinStats_PushFifo(win_stats_t *ws, lfifo_t *fifo) {
+  uint32_t cnt = 0;
+  while (LFifo_GetUsed(fifo) >= sizeof(float)) {
+    // 连续且对齐的部分直接处理, 跨越环尾的样本先读出
+    fifo_size_t len;
+    uint8_t *p = LFifo_AcquireLinearRead(fifo, &len);
+    uint32_t n = len / sizeof(float);
+    if (n && ((uintptr_t)p % sizeof(float)) == 0) {
+      WinStats_PushBlock(ws, (const float *)p, n);
+      LFifo_ReleaseLinearRead(fifo, n * sizeof(float));
+    } else {
+      float x;
+      LFifo_Read(fifo, (uint8_t *)&x, sizeof(float));
+      WinStats_Push(ws, x);
+      n = 1;
+    }
+    cnt += n;
+  }
+  return cnt;
+}
+
+float WinStats_Percentile(win_stats_t *ws, float p) {
+  if (ws->hist == NULL || ws->count == 0) return 0;
+  if (p < 0) p = 0;
+  if (p > 1) p = 1;
+  const float target = p * ws->count;
+  uint32_t cum = 0;
+  for (uint16_t b = 0; b < ws->bins; b++) {
+    uint16_t h = ws->hist[b];
+    if (h && cum + h >= target) {
+      return ws->lo + (b + (target - cum) / h) / ws->binScale;
+    }
+    cum += h;
+  }
+  return ws->lo + ws->bins / ws->binScale;
+}
+
+void EMA_Init(ema_t *ema, float alpha) {
+  ema->alpha = alpha;
+  ema->mean = ema->var = 0;
+  ema->init = 0;
+}
+
+void EMA_InitTau(ema_t *ema, float tau, float dt) {
+  EMA_Init(ema, dt / (tau + dt));
+}
+
+float EMA_Update(ema_t *ema, float x) {
+  if (!ema->init) {
+    ema->mean = x;
+    ema->var = 0;
+    ema->init = 1;
+    return x;
+  }
+  const float d = x - ema->mean;
+  const float inc = ema->alpha * d;
+  ema->mean += inc;
+  ema->var = (1.0f - ema->alpha) * (ema->var + d * inc);
+  return ema->mean;
+}
+
+float EMA_UpdateBlock(ema_t *ema, const float *x, uint32_t n) {
+  while (n--) EMA_Update(ema, *x++);
+  return ema->mean;
+}
+
+// Source Code End --------------------------
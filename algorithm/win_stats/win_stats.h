@@ -0,0 +1,209 @@
+/**
+ * @file win_stats.h
+ * @brief 滑动窗口流式统计(均值/方差/最值/百分位)与指数滑动平均
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-23
+ *
+ * THINK DIFFERENTLY
+ */
+
+/**
+ * @note 流式统计说明
+ * 1.用途:
+ *  对传感器数据流维护最近len个样本的统计量, 每个样本的更新为O(1), 取代
+ *  每次对整个数组重新求和(arm_mean_f32/arm_var_f32只能按块计算)
+ *
+ * 2.窗口环:
+ *  样本存放在长度为len的环中, 写指针之后即为最旧的样本. 窗口未满时样本数
+ *  逐渐增加, 满后每写入一个样本就移出最旧的样本
+ *  WinStats_PushFifo()从lfifo中取出float样本, 连续且对齐时不拷贝
+ *
+ * 3.均值/方差:
+ *  Welford递推: 加入样本x并移出y时, 均值增加(x-y)/len, 平方和M2增加
+ *  (x-y)(x-新均值+y-旧均值). 单精度递推的舍入误差会缓慢累积, 窗口满后每
+ *  经过WIN_STATS_CFG_RESYNC个窗口长度就对环中样本重新求一次(均摊O(1))
+ *  方差与arm_var_f32相同为样本方差(除以n-1), RMS为sqrt(mean^2 + M2/n)
+ *
+ * 4.最值(WIN_STATS_MINMAX):
+ *  单调队列: 最大值队列中的样本值从头到尾递减, 加入样本时先从尾部移除不大于
+ *  它的样本, 队头移出窗口时出队. 队头即为窗口最大值, 每个样本最多入队出队
+ *  各一次, 均摊O(1). 队列存放样本在窗口环中的位置
+ *
+ * 5.百分位(WinStats_EnablePercentile):
+ *  [lo, hi)上的定宽直方图, 随窗口加入/移出样本增减计数, 查询时累加到目标
+ *  计数并在桶内线性插值, 误差不超过一个桶宽. 范围外的样本计入首/尾桶
+ *  查询为O(bins), 更新为O(1)
+ *
+ * 6.指数滑动平均(ema_t):
+ *  mean += alpha (x - mean), 同时递推指数加权方差
+ *  var = (1 - alpha)(var + alpha (x - mean)^2), 第一个样本作为初值
+ */
+
+#ifndef __WIN_STATS_H
+#define __WIN_STATS_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <math.h>
+
+#include "lfifo.h"
+#include "modules.h"
+
+#if !KCONFIG_AVAILABLE  // 由Kconfig配置
+#define WIN_STATS_CFG_RESYNC 64  // 每隔多少个窗口长度重新求和(0: 不重新求和)
+#endif  // !KCONFIG_AVAILABLE
+
+typedef enum {              // 初始化选项
+  WIN_STATS_MINMAX = 0x01,  // 维护窗口最小/最大值
+} win_stats_flag_t;
+
+typedef struct {     // 单调队列(环形)
+  uint16_t *pos;     // 样本在窗口环中的位置(len)
+  uint16_t head;     // 队头
+  uint16_t cnt;      // 元素数
+} win_stats_deque_t;
+
+typedef struct {          // 滑动窗口统计
+  float *buf;             // 窗口样本环(len)
+  uint16_t len;           // 窗口长度
+  uint16_t wr;            // 写指针, 窗口满时指向最旧的样本
+  uint16_t count;         // 窗口内的样本数
+  uint8_t flags;          // 初始化选项(win_stats_flag_t)
+  float invLen;           // 1/len
+  float mean;             // 均值
+  float m2;               // 与均值之差的平方和
+  uint32_t resync;        // 窗口满后距上次重新求和的样本数
+  win_stats_deque_t max;  // 最大值队列
+  win_stats_deque_t min;  // 最小值队列
+  uint16_t *hist;         // 百分位直方图(bins), NULL为未开启
+  uint16_t bins;          // 桶数
+  float lo;               // 直方图下限
+  float binScale;         // bins/(hi-lo)
+} win_stats_t;
+
+typedef struct {  // 指数滑动平均
+  float alpha;    // 平滑系数(0, 1]
+  float mean;     // 均值
+  float var;      // 指数加权方差
+  uint8_t init;   // 已输入第一个样本
+} ema_t;
+
+/**
+ * @brief 初始化滑动窗口统计
+ * @param  len              窗口长度(样本), 大于0
+ * @param  flags            win_stats_flag_t的组合
+ * @retval 0: 成功, -1: 参数错误/内存不足
+ */
+extern int WinStats_Init(win_stats_t *ws, uint16_t len, uint8_t flags);
+
+/**
+ * @brief 开启百分位统计
+ * @param  lo               直方图下限
+ * @param  hi               直方图上限, 大于lo
+ * @param  bins             桶数, 大于0
+ * @retval 0: 成功, -1: 参数错误/内存不足
+ * @note 已有的窗口样本会计入直方图
+ */
+extern int WinStats_EnablePercentile(win_stats_t *ws, float lo, float hi,
+                                     uint16_t bins);
+
+/**
+ * @brief 释放窗口及直方图的内存
+ */
+extern void WinStats_Deinit(win_stats_t *ws);
+
+/**
+ * @brief 清空窗口
+ */
+extern void WinStats_Reset(win_stats_t *ws);
+
+/**
+ * @brief 加入一个样本
+ */
+extern void WinStats_Push(win_stats_t *ws, float x);
+
+/**
+ * @brief 依次加入n个样本
+ */
+extern void WinStats_PushBlock(win_stats_t *ws, const float *x, uint32_t n);
+
+/**
+ * @brief 从FIFO中取出所有完整的float样本并加入
+ * @retval 加入的样本数
+ */
+extern uint32_t WinStats_PushFifo(win_stats_t *ws, lfifo_t *fifo);
+
+/**
+ * @brief 窗口内样本的百分位数
+ * @param  p                百分位(0~1, 0.5为中位数)
+ * @retval 未开启百分位统计或窗口为空时返回0
+ */
+extern float WinStats_Percentile(win_stats_t *ws, float p);
+
+static inline uint16_t WinStats_Count(const win_stats_t *ws) {
+  return ws->count;
+}
+
+static inline float WinStats_Mean(const win_stats_t *ws) { return ws->mean; }
+
+/**
+ * @brief 样本方差(除以n-1), 样本数小于2时为0
+ */
+static inline float WinStats_Var(const win_stats_t *ws) {
+  if (ws->count < 2 || ws->m2 <= 0) return 0;
+  return ws->m2 / (ws->count - 1);
+}
+
+static inline float WinStats_Std(const win_stats_t *ws) {
+  return sqrtf(WinStats_Var(ws));
+}
+
+static inline float WinStats_Rms(const win_stats_t *ws) {
+  if (ws->count == 0) return 0;
+  float m2 = ws->m2 > 0 ? ws->m2 : 0;
+  return sqrtf(ws->mean * ws->mean + m2 / ws->count);
+}
+
+/**
+ * @brief 窗口最大/最小值, 需以WIN_STATS_MINMAX初始化, 窗口为空时为0
+ */
+static inline float WinStats_Max(const win_stats_t *ws) {
+  return ws->max.cnt ? ws->buf[ws->max.pos[ws->max.head]] : 0;
+}
+
+static inline float WinStats_Min(const win_stats_t *ws) {
+  return ws->min.cnt ? ws->buf[ws->min.pos[ws->min.head]] : 0;
+}
+
+/**
+ * @brief 初始化指数滑动平均
+ * @param  alpha            平滑系数(0, 1], 越小越平滑
+ */
+extern void EMA_Init(ema_t *ema, float alpha);
+
+/**
+ * @brief 以时间常数初始化指数滑动平均, alpha = dt / (tau + dt)
+ * @param  tau              时间常数(s)
+ * @param  dt               采样周期(s)
+ */
+extern void EMA_InitTau(ema_t *ema, float tau, float dt);
+
+/**
+ * @brief 更新指数滑动平均
+ * @retval 均值
+ */
+extern float EMA_Update(ema_t *ema, float x);
+
+/**
+ * @brief 依次输入n个样本
+ * @retval 均值
+ */
+extern float EMA_UpdateBlock(ema_t *ema, const float *x, uint32_t n);
+
+static inline float EMA_Std(const ema_t *ema) { return sqrtf(ema->var); }
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // __WIN_STATS_H
@@ -202,7 +202,7 @@ static size_t bin2char_s(uint8_t* buff, size_t len, size_t maxLen) {
     for (int i = 0; i < 2; i++) {
       uint8_t bin = (buff[len] >> 4 * i) & 0x0F;
       char chr = 0;
-      if ((bin >= 0) && (bin <= 9)) {
+      if (bin <= 9) {
         chr = (char)(bin + '0');
       } else if ((bin >= 0x0A) && (bin <= 0x0F)) {
         chr = (char)(bin - 0x0A + 'A');
@@ -436,8 +436,8 @@ static uint8_t ModBus_detectFrame(ModBus_parameter* ModBus_para,
         return 0;
       }
       if (!(isTimeout  // 接收超时
-            || frameSize > 0 && ModBus_para->m_receiveFrameBufferLen >=
-                                    frameSize  // 数据包足够
+            || (frameSize > 0 && ModBus_para->m_receiveFrameBufferLen >=
+                                     frameSize)  // 数据包足够
             || ModBus_para->m_receiveFrameBufferLen >=
                    MODBUS_BUFFER_SIZE))  // 缓冲区满
       {
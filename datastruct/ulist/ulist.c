@@ -80,7 +80,7 @@ static ulist_offset_t convert_pylike_offset(ULIST list, ulist_offset_t index) {
       return -1;
     }
   }
-  if (index >= list->num) {
+  if (index >= (ulist_offset_t)list->num) {
     if (list->cfg & ULIST_CFG_IGNORE_SLICE_ERROR) {
       return list->num - 1;
     }
@@ -479,13 +479,13 @@ ulist_offset_t ulist_index(ULIST list, const void* ptr) {
   ulist_offset_t i = (uint8_t*)ptr - (uint8_t*)list->data;
   if (i < 0 || i % list->isize != 0) ULIST_UNLOCK_RET(false);
   i /= list->isize;
-  if (i >= list->num) ULIST_UNLOCK_RET(false);
+  if (i >= (ulist_offset_t)list->num) ULIST_UNLOCK_RET(false);
   ULIST_UNLOCK_RET(i);
 }
 
 ulist_offset_t ulist_find(ULIST list, const void* ptr) {
   ULIST_LOCK();
-  for (ulist_offset_t i = 0; i < list->num; i++) {
+  for (ulist_offset_t i = 0; i < (ulist_offset_t)list->num; i++) {
     if (_ulist_memcmp(ULIST_PTR(i), ptr, list->isize) == 0) {
       ULIST_UNLOCK_RET(i);
     }
@@ -496,7 +496,7 @@ ulist_offset_t ulist_find(ULIST list, const void* ptr) {
 void* ulist_search_matched(ULIST list, const void* key,
                            bool (*match)(const void* item, const void* key)) {
   ULIST_LOCK();
-  for (ulist_offset_t i = 0; i < list->num; i++) {
+  for (ulist_offset_t i = 0; i < (ulist_offset_t)list->num; i++) {
     if (match(ULIST_PTR(i), key)) {
       ULIST_UNLOCK_RET((void*)(ULIST_PTR(i)));
     }
@@ -544,7 +544,7 @@ bool ulist_iter(ULIST list, void** ptrptr, ulist_offset_t start,
     list->iter += step;
   }
   if ((step > 0 && list->iter >= end_n) || (step < 0 && list->iter <= end_n) ||
-      list->iter >= list->num || list->iter < 0) {
+      list->iter >= (ulist_offset_t)list->num || list->iter < 0) {
     list->iter = -1;
     ULIST_UNLOCK_RET(false);
   }
@@ -586,7 +586,7 @@ void* ulist_iterator_next(ULIST_ITER iter) {
   }
   if ((iter->step > 0 && iter->now >= iter->end) ||
       (iter->step < 0 && iter->now <= iter->end) ||
-      iter->now >= iter->target->num || iter->now < 0) {
+      iter->now >= (ulist_offset_t)iter->target->num || iter->now < 0) {
     return NULL;
   }
   return (void*)((uint8_t*)iter->target->data +
@@ -601,7 +601,7 @@ void* ulist_iterator_prev(ULIST_ITER iter) {
   }
   if ((iter->step > 0 && iter->now >= iter->end) ||
       (iter->step < 0 && iter->now <= iter->end) ||
-      iter->now >= iter->target->num || iter->now < 0) {
+      iter->now >= (ulist_offset_t)iter->target->num || iter->now < 0) {
     return NULL;
   }
   return (void*)((uint8_t*)iter->target->data +
@@ -0,0 +1,203 @@
+/**
+ * @file bench.c
+ * @brief 模块微基准测试运行器
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "bench.h"
+
+#include "log.h"
+#include "term_table.h"
+
+// Private Defines --------------------------
+
+#define BENCH_CALIB_DIV 8             // 标定阶段的目标时间为min_time的1/8
+#define BENCH_MAX_ITERS (1UL << 30)  // 迭代次数上限
+
+// Private Variables ------------------------
+
+static double extra_value;
+static const char *extra_unit;
+
+// Private Functions ------------------------
+
+static m_time_t bench_measure(const bench_case_t *bc, uint32_t iters) {
+  m_time_t start = m_tick();
+  bc->func(iters, bc->arg);
+  return m_tick() - start;
+}
+
+static double tick_to_ns(m_time_t tick) {
+  return (double)tick * 1e9 / (double)m_tick_clk;
+}
+
+// Public Functions -------------------------
+
+void Bench_RunCase(const bench_case_t *bc, uint32_t min_time_ms,
+                   uint8_t repeat, bench_result_t *result) {
+  m_time_t min_tick = m_tick_per_ms(m_time_t) * min_time_ms;
+  m_time_t calib_tick = min_tick / BENCH_CALIB_DIV;
+  m_time_t tick, best = INT64_MAX, sum = 0;
+  uint32_t iters = 1;
+  if (!repeat) repeat = 1;
+  extra_unit = NULL;
+  if (bc->setup) bc->setup(bc->arg);
+
+  // 标定: 倍增迭代次数直到耗时足够长, 再按比例放大到min_time
+  while (1) {
+    tick = bench_measure(bc, iters);
+    if (tick >= calib_tick || iters >= BENCH_MAX_ITERS) break;
+    iters *= 2;
+  }
+  if (tick <= 0) tick = 1;
+  double scale = (double)min_tick / (double)tick;
+  if (scale > 1.0) {
+    double n = (double)iters * scale;
+    iters = n > BENCH_MAX_ITERS ? BENCH_MAX_ITERS : (uint32_t)n;
+  }
+
+  for (uint8_t i = 0; i < repeat; i++) {
+    tick = bench_measure(bc, iters);
+    if (tick < best) best = tick;
+    sum += tick;
+  }
+  if (bc->teardown) bc->teardown(bc->arg);
+
+  result->name = bc->name;
+  result->unit = bc->unit ? bc->unit : "op";
+  result->iters = iters;
+  result->ns_per_iter = tick_to_ns(best) / iters;
+  result->ns_per_iter_avg = tick_to_ns(sum) / repeat / iters;
+  result->throughput =
+      result->ns_per_iter > 0
+          ? (double)(bc->work ? bc->work : 1) * 1e9 / result->ns_per_iter
+          : 0;
+  result->extra = extra_value;
+  result->extra_unit = extra_unit;
+}
+
+void Bench_SetExtra(double value, const char *unit) {
+  extra_value = value;
+  extra_unit = unit;
+}
+
+uint16_t Bench_CountCases(const char *filter) {
+  uint16_t num = 0;
+  for (const bench_group_t *const *gp = bench_groups; *gp != NULL; gp++) {
+    for (uint16_t i = 0; i < (*gp)->num; i++) {
+      const char *name = (*gp)->cases[i].name;
+      if (filter == NULL || strstr(name, filter) != NULL) num++;
+    }
+  }
+  return num;
+}
+
+uint16_t Bench_RunAll(const char *filter, uint32_t min_time_ms,
+                      bench_result_t *results) {
+  uint16_t num = 0;
+  for (const bench_group_t *const *gp = bench_groups; *gp != NULL; gp++) {
+    const bench_group_t *g = *gp;
+    for (uint16_t i = 0; i < g->num; i++) {
+      const bench_case_t *bc = &g->cases[i];
+      if (filter != NULL && strstr(bc->name, filter) == NULL) continue;
+      bench_result_t *r = &results[num++];
+      LOG_RAW("\rrunning: %-40s", bc->name);
+      Bench_RunCase(bc, min_time_ms, BENCH_CFG_REPEAT, r);
+    }
+  }
+  LOG_RAW("\r%-49s\r", "");
+  return num;
+}
+
+static TT_STR fmt_si(TT_ALIGN al, TT_FMT1 f1, TT_FMT2 f2, double val,
+                     const char *unit) {
+  static const char prefix[] = {' ', 'K', 'M', 'G', 'T'};
+  uint8_t i = 0;
+  while (val >= 1000.0 && i < sizeof(prefix) - 1) {
+    val /= 1000.0;
+    i++;
+  }
+  if (i == 0) return TT_FmtStr(al, f1, f2, "%.2f %s/s", val, unit);
+  return TT_FmtStr(al, f1, f2, "%.2f %c%s/s", val, prefix[i], unit);
+}
+
+void Bench_PrintTable(const bench_result_t *results, uint16_t num) {
+  static const char *head[] = {"Case",  "ns/iter", "avg", "Throughput",
+                               "Iters", "Extra"};
+  TT tt = TT_NewTable(-1);
+  TT_FMT1 f1 = TT_FMT1_BLUE;
+  TT_FMT2 f2 = TT_FMT2_BOLD;
+  TT_ALIGN al = TT_ALIGN_LEFT;
+  TT_AddTitle(tt,
+              TT_FmtStr(al, f1, f2, "[ Module Bench / %d cases ]", num), '-');
+  TT_ITEM_GRID grid = TT_AddGrid(tt, 0);
+  TT_ITEM_GRID_LINE line =
+      TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
+  for (uint8_t i = 0; i < sizeof(head) / sizeof(head[0]); i++) {
+    TT_GridLine_AddItem(line, TT_Str(al, f1, f2, head[i]));
+  }
+  f2 = TT_FMT2_NONE;
+  for (uint16_t i = 0; i < num; i++) {
+    const bench_result_t *r = &results[i];
+    f1 = TT_FMT1_GREEN;
+    line = TT_Grid_AddLine(grid, TT_Str(al, f1, f2, " "));
+    TT_GridLine_AddItem(line, TT_Str(al, f1, f2, r->name));
+    TT_GridLine_AddItem(line, TT_FmtStr(al, TT_FMT1_YELLOW, TT_FMT2_BOLD,
+                                        "%.2f", r->ns_per_iter));
+    TT_GridLine_AddItem(line,
+                        TT_FmtStr(al, f1, f2, "%.2f", r->ns_per_iter_avg));
+    TT_GridLine_AddItem(line, fmt_si(al, f1, f2, r->throughput, r->unit));
+    TT_GridLine_AddItem(line,
+                        TT_FmtStr(al, f1, f2, "%lu", (unsigned long)r->iters));
+    if (r->extra_unit != NULL) {
+      TT_GridLine_AddItem(line, TT_FmtStr(al, TT_FMT1_CYAN, f2, "%.1f %s",
+                                          r->extra, r->extra_unit));
+    } else {
+      TT_GridLine_AddItem(line, TT_Str(al, f1, f2, "-"));
+    }
+  }
+  TT_AddString(tt,
+               TT_FmtStr(TT_ALIGN_CENTER, TT_FMT1_GREEN, TT_FMT2_NONE,
+                         "Clock: %luHz / Rounds: %d (fastest reported)",
+                         (unsigned long)m_tick_clk, BENCH_CFG_REPEAT),
+               -1);
+  TT_AddSeparator(tt, TT_FMT1_BLUE, TT_FMT2_BOLD, '-');
+  TT_Print(tt);
+  TT_FreeTable(tt);
+}
+
+void Bench_PrintJson(const bench_result_t *results, uint16_t num,
+                     bench_printf_t print) {
+  print("{\"freq\":%llu,\"results\":[", (unsigned long long)m_tick_clk);
+  for (uint16_t i = 0; i < num; i++) {
+    const bench_result_t *r = &results[i];
+    print(
+        "%s\n{\"name\":\"%s\",\"unit\":\"%s\",\"iters\":%lu,"
+        "\"ns_per_iter\":%.3f,\"ns_per_iter_avg\":%.3f,\"throughput\":%.6e",
+        i ? "," : "", r->name, r->unit, (unsigned long)r->iters,
+        r->ns_per_iter, r->ns_per_iter_avg, r->throughput);
+    if (r->extra_unit != NULL) {
+      print(",\"extra\":%.3f,\"extra_unit\":\"%s\"", r->extra,
+            r->extra_unit);
+    }
+    print("}");
+  }
+  print("\n]}\n");
+}
+
+void module_bench_main(void) {
+  bench_result_t *results =
+      m_alloc(Bench_CountCases(NULL) * sizeof(bench_result_t));
+  if (results == NULL) {
+    LOG_ERROR("bench: no memory for results");
+    return;
+  }
+  uint16_t num = Bench_RunAll(NULL, BENCH_CFG_MIN_TIME_MS, results);
+  Bench_PrintTable(results, num);
+  Bench_PrintJson(results, num, (bench_printf_t)LOG_CFG_PRINTF);
+  m_free(results);
+}
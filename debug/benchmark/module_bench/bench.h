@@ -0,0 +1,160 @@
+/**
+ * @file bench.h
+ * @brief 模块微基准测试运行器(自动标定迭代次数, JSON结果输出)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "modules.h"
+
+#if !KCONFIG_AVAILABLE  // 由Kconfig配置
+#define BENCH_CFG_MIN_TIME_MS 100  // 每轮测量的最短时间(ms)
+#define BENCH_CFG_REPEAT 5         // 测量轮数(取最快一轮)
+#define BENCH_CFG_GROUP_DATASTRUCT 1  // 数据结构用例(ulist/udict/fifo/json)
+#define BENCH_CFG_GROUP_SYSTEM 1      // 系统用例(scheduler/lwmem)
+#define BENCH_CFG_GROUP_ALGORITHM 1   // 算法用例(crc/pid/imu)
+#define BENCH_CFG_GROUP_STORAGE 1     // 存储用例(littlefs)
+#define BENCH_CFG_GROUP_GRAPHICS 0    // 图形用例(virtual_lcd, 需约350KB RAM)
+#define BENCH_CFG_GROUP_LVGL 0        // LVGL渲染用例(需LVGL和约600KB RAM)
+#define BENCH_CFG_GROUP_NN 1          // 神经网络用例(genann)
+#endif  // KCONFIG_AVAILABLE
+
+// Public Typedefs --------------------------
+
+/**
+ * @brief 用例函数
+ * @param  iters            迭代次数
+ * @param  arg              用例参数
+ * @note 只测量本函数的耗时, 准备工作应放在setup中
+ */
+typedef void (*bench_func_t)(uint32_t iters, void *arg);
+
+typedef struct {                // 基准测试用例
+  const char *name;             // 用例名("模块/操作")
+  bench_func_t func;            // 用例函数
+  void (*setup)(void *arg);     // 准备函数(不计时, 可为NULL)
+  void (*teardown)(void *arg);  // 清理函数(不计时, 可为NULL)
+  void *arg;                    // 用例参数
+  uint32_t work;                // 每次迭代处理的工作量(用于计算吞吐量)
+  const char *unit;             // 工作量单位("B", "op", "px"...)
+} bench_case_t;
+
+typedef struct {        // 基准测试用例组
+  const char *name;     // 组名
+  const bench_case_t *cases;
+  uint16_t num;
+} bench_group_t;
+
+typedef struct {           // 基准测试结果
+  const char *name;        // 用例名
+  const char *unit;        // 工作量单位
+  uint32_t iters;          // 每轮迭代次数
+  double ns_per_iter;      // 每次迭代耗时(ns, 最快一轮)
+  double ns_per_iter_avg;  // 每次迭代耗时(ns, 各轮平均)
+  double throughput;       // 吞吐量(unit/s)
+  double extra;            // 用例上报的附加指标(见Bench_SetExtra)
+  const char *extra_unit;  // 附加指标单位(NULL: 无)
+} bench_result_t;
+
+typedef int (*bench_printf_t)(const char *fmt, ...);
+
+// Public Macros ----------------------------
+
+#define BENCH_CASE(_name, _func, _work, _unit) \
+  {.name = (_name), .func = (_func), .work = (_work), .unit = (_unit)}
+
+#define BENCH_CASE_EX(_name, _func, _setup, _teardown, _arg, _work, _unit) \
+  {.name = (_name),                                                       \
+   .func = (_func),                                                       \
+   .setup = (_setup),                                                     \
+   .teardown = (_teardown),                                               \
+   .arg = (_arg),                                                         \
+   .work = (_work),                                                       \
+   .unit = (_unit)}
+
+#define BENCH_GROUP(_name, _cases) \
+  {.name = (_name),                \
+   .cases = (_cases),              \
+   .num = sizeof(_cases) / sizeof(_cases[0])}
+
+/**
+ * @brief 防止编译器优化掉无副作用的计算结果
+ */
+#define BENCH_KEEP(x) __asm__ volatile("" : : "r"(x) : "memory")
+
+// Exported Variables -----------------------
+
+extern const bench_group_t *const bench_groups[];  // 所有用例组(以NULL结尾)
+
+// Exported Functions -----------------------
+
+/**
+ * @brief 运行单个用例
+ * @param  bc               用例
+ * @param  min_time_ms      每轮最短时间(ms)
+ * @param  repeat           测量轮数
+ * @param  result           输出: 结果
+ */
+extern void Bench_RunCase(const bench_case_t *bc, uint32_t min_time_ms,
+                          uint8_t repeat, bench_result_t *result);
+
+/**
+ * @brief 在用例函数中上报附加指标(如压缩后字节数), 以最后一轮为准
+ * @param  value            指标值
+ * @param  unit             指标单位(需为静态字符串)
+ */
+extern void Bench_SetExtra(double value, const char *unit);
+
+/**
+ * @brief 统计所有用例组中名称包含filter的用例数
+ * @param  filter           名称过滤(NULL为全部)
+ * @retval uint16_t         用例数, 即Bench_RunAll()需要的结果数组长度
+ */
+extern uint16_t Bench_CountCases(const char *filter);
+
+/**
+ * @brief 运行所有用例组中名称包含filter的用例
+ * @param  filter           名称过滤(NULL为全部)
+ * @param  min_time_ms      每轮最短时间(ms)
+ * @param  results          输出: 结果数组(长度为Bench_CountCases(filter))
+ * @retval uint16_t         结果数量
+ */
+extern uint16_t Bench_RunAll(const char *filter, uint32_t min_time_ms,
+                             bench_result_t *results);
+
+/**
+ * @brief 通过term_table打印结果表格
+ * @param  results          结果数组
+ * @param  num              结果数量
+ */
+extern void Bench_PrintTable(const bench_result_t *results, uint16_t num);
+
+/**
+ * @brief 以JSON格式输出结果(用于回归比较)
+ * @param  results          结果数组
+ * @param  num              结果数量
+ * @param  print            输出函数
+ */
+extern void Bench_PrintJson(const bench_result_t *results, uint16_t num,
+                            bench_printf_t print);
+
+/**
+ * @brief 目标板入口: 运行全部用例, 打印结果表格并输出JSON
+ */
+extern void module_bench_main(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BENCH_H__ */
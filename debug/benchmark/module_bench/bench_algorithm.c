@@ -0,0 +1,1420 @@
+/**
+ * @file bench_algorithm.c
+ * @brief 算法模块基准测试(crc/pid/imu/regex/dsp/kalman/fastmath/winstats/cmsis)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "bench.h"
+
+#if BENCH_CFG_GROUP_ALGORITHM
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crcLib.h"
+#include "dsp_pipe.h"
+#include "fast_math.h"
+#include "imu_fusion.h"
+#include "kalman.h"
+#include "pid.h"
+#include "pid_bank.h"
+#include "sensor_processing_lib.h"
+#include "tiny_regex.h"
+#include "win_stats.h"
+
+// Private Defines --------------------------
+
+#define BENCH_CRC_LEN 1024
+
+#define BENCH_PID_FRAMES 64    // 循环使用的测量值帧数
+#define BENCH_PID_VERIFY 4096  // 与PID_Calculate比较的步数
+#define BENCH_PID_IN_FS 4000   // 定点版本的输入满量程
+#define BENCH_PID_OUT_FS 1000  // 定点版本的输出满量程
+// 定点输入的1LSB, 阈值类参数取其整数倍, 使两种实现的比较结果一致
+#define BENCH_PID_LSB (BENCH_PID_IN_FS / 32768.0f)
+
+enum {  // PID更新方式
+  PID_SCALAR,     // 逐个PID_Calculate
+  PID_BANK,       // 控制器组, 标量内核
+  PID_BANK_SIMD,  // 控制器组, SSE2/NEON内核
+  PID_BANK_Q15,   // 定点控制器组
+};
+
+#define PID_ARG(_mode, _num) (void *)(uintptr_t)(((_mode) << 8) | (_num))
+#define PID_CASE(_name, _mode, _num)                                       \
+  BENCH_CASE_EX(_name, bench_pid, pid_setup, NULL, PID_ARG(_mode, _num), \
+                _num, "loop")
+
+#define BENCH_IMU_SAMPLES 512  // 循环使用的IMU采样数
+#define BENCH_IMU_BATCH 64     // 每次迭代处理的采样数
+#define BENCH_IMU_VERIFY 16    // 与double参考实现比较的轮数
+#define BENCH_IMU_DT 1e-3      // 1kHz采样
+#define BENCH_IMU_ACC_LSB 16384.0                   // ±2g
+#define BENCH_IMU_GYRO_LSB (16.4 * 57.29577951308)  // ±2000dps, LSB/(rad/s)
+#define BENCH_IMU_KP 2.0f
+#define BENCH_IMU_KI 0.1f
+
+enum {  // IMU姿态解算方式
+  IMU_LEGACY,       // 原有的update_fused_vector(), 只估计重力方向
+  IMU_MAHONY_F32,   // 单精度Mahony
+  IMU_MAHONY_Q31,   // 定点Mahony
+};
+
+#define BENCH_RE_LINES 8         // 循环使用的输入行数
+#define BENCH_RE_PROG_SIZE 1024  // 每个编译后程序的缓冲区大小
+
+enum {  // 正则匹配方式
+  RE_STR,   // tregex_match_str(), 每次解析模式串并回溯
+  RE_PROG,  // tregex_match_prog(), 预编译程序
+};
+
+#define RE_ARG(_mode, _len) (void *)(uintptr_t)(((_mode) << 16) | (_len))
+#define RE_CASE(_name, _mode, _len)                                    \
+  BENCH_CASE_EX(_name, bench_re, re_setup, NULL, RE_ARG(_mode, _len), 1, \
+                "line")
+
+// 每行都要依次尝试的命令模式
+static const char *const re_patterns[] = {
+    "\\+CSQ: \\d+,\\d+",
+    "\\d{4}-\\d{1,2}-\\d{1,2}",
+    "\\+QIRD: \\d+",
+    "ERROR",
+};
+#define BENCH_RE_PATTERNS (sizeof(re_patterns) / sizeof(re_patterns[0]))
+
+#define BENCH_DSP_SAMPLES 1024  // 循环使用的输入样本数
+#define BENCH_DSP_FFT 64        // 抽取后的FFT长度
+#define BENCH_DSP_DECIM 4       // 抽取倍数
+#define BENCH_DSP_WORK (BENCH_DSP_FFT * BENCH_DSP_DECIM)  // 每次迭代的样本数
+#define BENCH_DSP_FIR_TAPS 31
+#define BENCH_DSP_DEC_TAPS 32
+#define BENCH_DSP_SECTIONS 2
+
+// 双二阶低通 -> FIR低通 -> 4倍抽取 -> 64点幅度谱, 0表示逐样本调用CMSIS-DSP,
+// 否则为流水线的块长度
+#define DSP_CASE(_name, _block)                                          \
+  BENCH_CASE_EX(_name, bench_dsp, dsp_setup, dsp_teardown,              \
+                (void *)(uintptr_t)(_block), BENCH_DSP_WORK, "sample")
+
+#define BENCH_KF_SAMPLES 1024  // 循环使用的观测样本数
+#define BENCH_KF_BATCH 64      // 每次迭代处理的样本数
+#define BENCH_KF_VERIFY 4      // 与double参考实现比较的轮数
+#define BENCH_KF_DT 1e-3       // 1kHz采样
+#define BENCH_KF_R 0.01        // 观测噪声方差
+#define BENCH_KF_FS 4.0        // 定点观测的满量程
+#define BENCH_KF_C 0.01        // 定点状态的缩放, scale[i] = (c/dt)^i
+#define BENCH_KF_TAU 0.5       // 互补滤波器时间常数(s)
+#define BENCH_KF_RATE_FS 16.0  // 定点变化率的满量程(单位/s)
+
+enum {       // 估计滤波器
+  KF_F32,    // 浮点卡尔曼滤波器
+  KF_Q31,    // 定点稳态卡尔曼滤波器
+  COMP_F32,  // 浮点互补滤波器
+  COMP_Q31,  // 定点互补滤波器
+};
+
+// 各状态维数的过程噪声(最高阶导数的增量方差), 下标为N
+static const double kf_q[KALMAN_MAX_N + 1] = {0, 1e-4, 1e-3, 1e-1, 10};
+
+// 运动学模型, 观测为2Hz正弦加噪声, _n为状态维数(互补滤波器为0)
+#define KF_ARG(_mode, _n) (void *)(uintptr_t)(((_mode) << 8) | (_n))
+#define KF_CASE(_name, _mode, _n)                                         \
+  BENCH_CASE_EX(_name, bench_kf, kf_setup, NULL, KF_ARG(_mode, _n),      \
+                BENCH_KF_BATCH, "sample")
+
+#define BENCH_FM_LEN 1024      // 每次迭代计算的个数
+#define BENCH_FM_VERIFY 65536  // 求误差时扫描的点数
+
+enum {         // 快速数学函数
+  FM_SIN,      // 正弦, [-2pi, 2pi]
+  FM_ATAN2,    // 四象限反正切
+  FM_LOG2,     // 以2为底的对数, [2^-10, 2^10]
+  FM_EXP2,     // 2的x次幂, [-10, 10], 相对误差
+  FM_INVSQRT,  // 1/sqrt(x), [2^-10, 2^10], 相对误差
+  FM_HSV,      // HSV转RGB, 误差为LSB
+};
+
+// _fast为0时调用libm(HSV为ws2812_spi的浮点公式), 为1时调用fast_math
+#define FM_ARG(_func, _fast) (void *)(uintptr_t)(((_func) << 1) | (_fast))
+#define FM_CASE(_name, _ref, _func)                                        \
+  BENCH_CASE_EX(_name "_" _ref, bench_fm, fm_setup, NULL, FM_ARG(_func, 0), \
+                BENCH_FM_LEN, "op"),                                       \
+      BENCH_CASE_EX(_name "_fast", bench_fm, fm_setup, NULL,               \
+                    FM_ARG(_func, 1), BENCH_FM_LEN, "op")
+
+// 与ws2812_spi中开启FAST_MATH_CFG_WS2812时的调用相同
+#define FM_HSV_DEG(_deg, _s, _v) \
+  FM_HSVToRGB((uint16_t)((_deg) * (FM_HUE_MAX / 360.0f)), _s, _v)
+
+#define BENCH_WS_FS 100e3        // 100kHz采样
+#define BENCH_WS_LEN 1000        // 窗口长度(10ms)
+#define BENCH_WS_SAMPLES 4096    // 循环使用的输入样本数
+#define BENCH_WS_BATCH 256       // 每次迭代处理的样本数
+#define BENCH_WS_FIFO 300        // FIFO容量(样本), 不是块长度的倍数
+#define BENCH_WS_VERIFY 200000   // 求误差时输入的样本数(含重新求和)
+#define BENCH_WS_CHECK 997       // 每隔多少个样本与double结果比较一次
+#define BENCH_WS_LO 0.0f         // 百分位直方图范围
+#define BENCH_WS_HI 3.0f         //
+#define BENCH_WS_BINS 300        // 百分位直方图桶数
+
+enum {            // 滑动窗口统计, 输入为1kHz正弦加噪声
+  WS_RESUM,       // 每个样本后对窗口数组调用arm_mean/std/max/min_f32
+  WS_MEANVAR,     // 每个样本后读取均值/标准差
+  WS_MINMAX,      // 每个样本后读取均值/标准差/最值
+  WS_FIFO,        // 同上, 块写入lfifo后由WinStats_PushFifo取出, 每块读取
+  WS_PERCENTILE,  // 同WS_MINMAX并维护直方图, 每块查询中位数和90%分位
+  WS_EMA,         // 指数滑动平均(时间常数为窗口长度), 每个样本后读取
+};
+
+#define WS_CASE(_name, _mode)                                          \
+  BENCH_CASE_EX(_name, bench_ws, ws_setup, ws_teardown, (void *)_mode, \
+                BENCH_WS_BATCH, "sample")
+
+#if MOD_HOST_CMSIS_REF
+#define BENCH_CMSIS_LEN 1024    // 向量长度/复数个数/FIR和IIR的块长度
+#define BENCH_CMSIS_TAPS 32     // FIR阶数
+#define BENCH_CMSIS_SECTIONS 4  // 双二阶节数
+#define BENCH_CMSIS_MAT 32      // 方阵边长
+#define BENCH_CMSIS_FFT_MIN 256  // CFFT长度
+#define BENCH_CMSIS_FFT_MAX 1024
+
+enum {  // CMSIS-DSP内核
+  CMSIS_DOT,
+  CMSIS_FIR,
+  CMSIS_BIQUAD,
+  CMSIS_CMPLX_MULT,
+  CMSIS_CFFT_256,   // radix8by4 + radix8
+  CMSIS_CFFT_1024,  // radix8by2 + radix8
+  CMSIS_MAT_MULT,
+};
+
+// _simd为0时调用通用C版本(cmsis_dsp_ref), 为1时调用x86 SIMD版本
+#define CMSIS_ARG(_kernel, _simd) \
+  (void *)(uintptr_t)(((_kernel) << 1) | (_simd))
+#define CMSIS_CASE(_name, _kernel, _work, _unit)                          \
+  BENCH_CASE_EX(_name "_ref", bench_cmsis, cmsis_setup, cmsis_teardown,   \
+                CMSIS_ARG(_kernel, 0), _work, _unit),                     \
+      BENCH_CASE_EX(_name "_simd", bench_cmsis, cmsis_setup,              \
+                    cmsis_teardown, CMSIS_ARG(_kernel, 1), _work, _unit)
+
+typedef struct {  // 一组实现
+  void (*dot)(const float32_t *, const float32_t *, uint32_t, float32_t *);
+  void (*fir)(const arm_fir_instance_f32 *, const float32_t *, float32_t *,
+              uint32_t);
+  void (*biquad)(const arm_biquad_casd_df1_inst_f32 *, const float32_t *,
+                 float32_t *, uint32_t);
+  void (*cmplx_mult)(const float32_t *, const float32_t *, float32_t *,
+                     uint32_t);
+  void (*cfft)(const arm_cfft_instance_f32 *, float32_t *, uint8_t, uint8_t);
+  arm_status (*mat_mult)(const arm_matrix_instance_f32 *,
+                         const arm_matrix_instance_f32 *,
+                         arm_matrix_instance_f32 *);
+} cmsis_impl_t;
+
+// cmsis_dsp_ref库中不带ARM_MATH_X86_SIMD编译的版本(见cmsis_ref.h)
+extern void ref_arm_dot_prod_f32(const float32_t *pSrcA,
+                                 const float32_t *pSrcB, uint32_t blockSize,
+                                 float32_t *result);
+extern void ref_arm_fir_f32(const arm_fir_instance_f32 *S,
+                            const float32_t *pSrc, float32_t *pDst,
+                            uint32_t blockSize);
+extern void ref_arm_biquad_cascade_df1_f32(
+    const arm_biquad_casd_df1_inst_f32 *S, const float32_t *pSrc,
+    float32_t *pDst, uint32_t blockSize);
+extern void ref_arm_cmplx_mult_cmplx_f32(const float32_t *pSrcA,
+                                         const float32_t *pSrcB,
+                                         float32_t *pDst,
+                                         uint32_t numSamples);
+extern void ref_arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1,
+                             uint8_t ifftFlag, uint8_t bitReverseFlag);
+extern arm_status ref_arm_mat_mult_f32(const arm_matrix_instance_f32 *pSrcA,
+                                       const arm_matrix_instance_f32 *pSrcB,
+                                       arm_matrix_instance_f32 *pDst);
+
+static const cmsis_impl_t cmsis_impl[2] = {
+    {ref_arm_dot_prod_f32, ref_arm_fir_f32, ref_arm_biquad_cascade_df1_f32,
+     ref_arm_cmplx_mult_cmplx_f32, ref_arm_cfft_f32, ref_arm_mat_mult_f32},
+    {arm_dot_prod_f32, arm_fir_f32, arm_biquad_cascade_df1_f32,
+     arm_cmplx_mult_cmplx_f32, arm_cfft_f32, arm_mat_mult_f32},
+};
+#endif  // MOD_HOST_CMSIS_REF
+
+// Private Variables ------------------------
+
+static uint8_t crc_buf[BENCH_CRC_LEN];
+static pid_ctrl_t pid_scalar[PID_BANK_CFG_MAX_NUM];
+static pid_bank_t pid_bank;
+static pid_bank_q_t pid_bank_q;
+static float pid_input[BENCH_PID_FRAMES][PID_BANK_CFG_MAX_NUM];
+static int16_t pid_input_q[BENCH_PID_FRAMES][PID_BANK_CFG_MAX_NUM];
+static imu_raw_sample imu_raw[BENCH_IMU_SAMPLES];
+static imu_sample imu_float[BENCH_IMU_SAMPLES];
+static mahony_filter imu_f32;
+static mahony_q31 imu_q31;
+static vector_ijk imu_gravity;
+static uint16_t imu_pos;
+static char re_lines[BENCH_RE_LINES][257];
+static uint32_t re_prog[BENCH_RE_PATTERNS][BENCH_RE_PROG_SIZE / 4];
+static uint16_t re_len;
+static float dsp_input[BENCH_DSP_SAMPLES];
+static float dsp_biquad_coeffs[5 * BENCH_DSP_SECTIONS];
+static float dsp_fir_coeffs[BENCH_DSP_FIR_TAPS];
+static float dsp_dec_coeffs[BENCH_DSP_DEC_TAPS];
+static float dsp_spectrum[BENCH_DSP_FFT / 2];
+static uint16_t dsp_pos;
+static dsp_pipe_t dsp_pipe;
+static struct {  // 逐样本调用的各级实例
+  arm_biquad_casd_df1_inst_f32 biquad;
+  arm_fir_instance_f32 fir;
+  arm_fir_decimate_instance_f32 dec;
+  float biquad_state[4 * BENCH_DSP_SECTIONS];
+  float fir_state[BENCH_DSP_FIR_TAPS];
+  float dec_state[BENCH_DSP_DEC_TAPS + BENCH_DSP_DECIM - 1];
+  float dec_in[BENCH_DSP_DECIM];
+  float fft_in[BENCH_DSP_FFT];
+  float fft_out[BENCH_DSP_FFT];
+  uint16_t dec_fill;
+  uint16_t fft_fill;
+} dsp_sample;
+static float kf_z[BENCH_KF_SAMPLES];     // 观测
+static float kf_rate[BENCH_KF_SAMPLES];  // 变化率(互补滤波器)
+static int32_t kf_zq[BENCH_KF_SAMPLES];
+static int32_t kf_rate_q[BENCH_KF_SAMPLES];
+static float kf_out[BENCH_KF_BATCH];
+static int32_t kf_out_q[BENCH_KF_BATCH];
+static kalman1_t kf1;
+static kalman2_t kf2;
+static kalman4_t kf4;
+static kalman1_q31_t kf1_q;
+static kalman2_q31_t kf2_q;
+static kalman4_q31_t kf4_q;
+static comp_filter_t kf_comp;
+static comp_filter_q31_t kf_comp_q;
+static uint16_t kf_pos;
+static float fm_x[BENCH_FM_LEN];
+static float fm_y[BENCH_FM_LEN];
+static float fm_out[BENCH_FM_LEN];
+static uint8_t fm_s[BENCH_FM_LEN];
+static uint8_t fm_v[BENCH_FM_LEN];
+static uint32_t fm_rgb[BENCH_FM_LEN];
+static float ws_x[BENCH_WS_SAMPLES];
+static float ws_ring[BENCH_WS_LEN];   // 重新求和方式的窗口数组
+static float ws_fifo_buf[BENCH_WS_FIFO];
+static double ws_sorted[BENCH_WS_LEN];
+static win_stats_t ws_stats;
+static ema_t ws_ema;
+static lfifo_t ws_fifo;
+static uint16_t ws_ring_wr;
+static uint16_t ws_pos;
+#if MOD_HOST_CMSIS_REF
+static float cmsis_a[2 * BENCH_CMSIS_LEN];
+static float cmsis_b[2 * BENCH_CMSIS_LEN];
+static float cmsis_out[2][2 * BENCH_CMSIS_LEN];  // 通用C/SIMD版本的输出
+static float cmsis_fir_coeffs[BENCH_CMSIS_TAPS];
+static float cmsis_fir_state[2][BENCH_CMSIS_TAPS + BENCH_CMSIS_LEN - 1];
+static float cmsis_biquad_coeffs[5 * BENCH_CMSIS_SECTIONS];
+static float cmsis_biquad_state[2][4 * BENCH_CMSIS_SECTIONS];
+static arm_fir_instance_f32 cmsis_fir[2];
+static arm_biquad_casd_df1_inst_f32 cmsis_biquad[2];
+static dsp_pipe_t cmsis_fft_pipe;  // 借用实数FFT级生成的CFFT表
+#endif
+
+// Private Functions ------------------------
+
+static void crc_setup(void *arg) {
+  (void)arg;
+  for (uint16_t i = 0; i < BENCH_CRC_LEN; i++) crc_buf[i] = i * 7 + 3;
+}
+
+static void bench_crc16_modbus(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    BENCH_KEEP(crc16_modbus(crc_buf, BENCH_CRC_LEN));
+  }
+}
+
+static void bench_crc32(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    BENCH_KEEP(crc32(crc_buf, BENCH_CRC_LEN));
+  }
+}
+
+/**
+ * @brief 电机速度环: 混合各种积分/比例模式, 死区和限幅
+ */
+static void pid_config(uint8_t num) {
+  for (uint8_t i = 0; i < num; i++) {
+    pid_scalar[i] = (pid_ctrl_t){
+        .setPoint = 1000 + 512 * BENCH_PID_LSB * i,
+        .proportion = 0.8f,
+        .integral = 20,
+        .derivative = 0.002f,
+        .Ts = 1e-4f,
+        .deadBand = i % 5 == 0 ? 5 * BENCH_PID_LSB : 0,
+        .maxOutput = 900,
+        .minOutput = -900,
+        .sumILimit = i % 2 ? 500 : 0,
+        .integMode = i % 3,
+        .iModeK1 = 640 * BENCH_PID_LSB,
+        .iModeK2 = 320 * BENCH_PID_LSB,
+        .propMode = i % 4 == 3 ? 1 : 0,
+    };
+  }
+  PIDBank_Init(&pid_bank, num);
+  PIDBankQ_Init(&pid_bank_q, num);
+  for (uint8_t i = 0; i < num; i++) {
+    PIDBank_SetChannel(&pid_bank, i, &pid_scalar[i]);
+    PIDBankQ_SetChannel(&pid_bank_q, i, &pid_scalar[i], BENCH_PID_IN_FS,
+                        BENCH_PID_OUT_FS);
+  }
+}
+
+static void pid_setup(void *arg) {
+  uint8_t mode = (uintptr_t)arg >> 8;
+  uint8_t num = (uintptr_t)arg & 0xFF;
+  uint32_t seed = 0x2468ACE1;
+  for (uint8_t k = 0; k < BENCH_PID_FRAMES; k++) {
+    for (uint8_t i = 0; i < num; i++) {
+      seed = seed * 1664525 + 1013904223;
+      float noise = (int16_t)(seed >> 16) / 32768.0f;
+      // 大幅正弦扰动使部分通道进入限幅/积分分离, 叠加测量噪声
+      float x = 1000 + 62.5f * i + 300 * sinf(k * 0.1f + i) + 20 * noise;
+      // 浮点版本使用量化后的输入, 误差只来自系数和运算精度
+      pid_input_q[k][i] = lrintf(x / BENCH_PID_LSB);
+      pid_input[k][i] = pid_input_q[k][i] * BENCH_PID_LSB;
+    }
+  }
+  if (mode == PID_SCALAR) {
+    pid_config(num);
+    return;
+  }
+  // 以相同输入与PID_Calculate比较, 报告输出的最大偏差
+  pid_config(num);
+  pid_bank.simd = mode == PID_BANK_SIMD;
+  float err = 0;
+  for (uint16_t k = 0; k < BENCH_PID_VERIFY; k++) {
+    const float *in = pid_input[k % BENCH_PID_FRAMES];
+    if (mode == PID_BANK_Q15) {
+      PIDBankQ_Calculate(&pid_bank_q, pid_input_q[k % BENCH_PID_FRAMES]);
+    } else {
+      PIDBank_Calculate(&pid_bank, in);
+    }
+    for (uint8_t i = 0; i < num; i++) {
+      float ref = PID_Calculate(&pid_scalar[i], in[i]);
+      float out = mode == PID_BANK_Q15
+                      ? pid_bank_q.output[i] * (BENCH_PID_OUT_FS / 32768.0f)
+                      : pid_bank.output[i];
+      if (fabsf(out - ref) > err) err = fabsf(out - ref);
+    }
+  }
+  Bench_SetExtra(err, "max err");
+  pid_config(num);
+  pid_bank.simd = mode == PID_BANK_SIMD;
+}
+
+static void bench_pid(uint32_t iters, void *arg) {
+  uint8_t mode = (uintptr_t)arg >> 8;
+  uint8_t num = (uintptr_t)arg & 0xFF;
+  for (uint32_t k = 0; k < iters; k++) {
+    uint8_t f = k % BENCH_PID_FRAMES;
+    switch (mode) {
+      case PID_SCALAR:
+        for (uint8_t i = 0; i < num; i++) {
+          BENCH_KEEP(PID_Calculate(&pid_scalar[i], pid_input[f][i]));
+        }
+        break;
+      case PID_BANK_Q15:
+        PIDBankQ_Calculate(&pid_bank_q, pid_input_q[f]);
+        break;
+      default:
+        PIDBank_Calculate(&pid_bank, pid_input[f]);
+        break;
+    }
+  }
+  BENCH_KEEP(pid_bank.output[0] + pid_bank_q.output[0]);
+}
+
+/**
+ * @brief double精度的Mahony参考实现, 与mahony_update()公式相同
+ */
+static void imu_reference(double q[4], double integ[3], const imu_sample *s) {
+  double g[3] = {s->gx, s->gy, s->gz};
+  double a2 = (double)s->ax * s->ax + (double)s->ay * s->ay +
+              (double)s->az * s->az;
+  if (a2 > 0) {
+    double r = 1 / sqrt(a2);
+    double a[3] = {s->ax * r, s->ay * r, s->az * r};
+    double v[3] = {2 * (q[1] * q[3] - q[0] * q[2]),
+                   2 * (q[0] * q[1] + q[2] * q[3]),
+                   q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3]};
+    double e[3] = {a[1] * v[2] - a[2] * v[1], a[2] * v[0] - a[0] * v[2],
+                   a[0] * v[1] - a[1] * v[0]};
+    for (uint8_t i = 0; i < 3; i++) {
+      integ[i] += BENCH_IMU_KI * BENCH_IMU_DT * e[i];
+      g[i] += integ[i] + BENCH_IMU_KP * e[i];
+    }
+  }
+  for (uint8_t i = 0; i < 3; i++) g[i] *= 0.5 * BENCH_IMU_DT;
+  double a = q[0], b = q[1], c = q[2], d = q[3];
+  q[0] += -b * g[0] - c * g[1] - d * g[2];
+  q[1] += a * g[0] + c * g[2] - d * g[1];
+  q[2] += a * g[1] - b * g[2] + d * g[0];
+  q[3] += a * g[2] + b * g[1] - c * g[0];
+  double r = 1 / sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+  for (uint8_t i = 0; i < 4; i++) q[i] *= r;
+}
+
+/**
+ * @brief 两个单位四元数之间的旋转角度(度)
+ */
+static double imu_angle(const double ref[4], Quaternion q) {
+  double dot = ref[0] * q.a + ref[1] * q.b + ref[2] * q.c + ref[3] * q.d;
+  double n = sqrt((double)q.a * q.a + (double)q.b * q.b +
+                  (double)q.c * q.c + (double)q.d * q.d);
+  dot = fabs(dot / n);
+  return dot >= 1 ? 0 : 2 * acos(dot) * 57.29577951308;
+}
+
+static void imu_init(void) {
+  mahony_init(&imu_f32, BENCH_IMU_KP, BENCH_IMU_KI, BENCH_IMU_DT);
+  mahony_q31_init(&imu_q31, BENCH_IMU_KP, BENCH_IMU_KI, BENCH_IMU_DT,
+                  1 / BENCH_IMU_GYRO_LSB);
+  imu_gravity = vector_3d_initialize(0, 0, 1);
+  imu_pos = 0;
+}
+
+static void imu_setup(void *arg) {
+  // 三轴正弦角速度下的真实姿态, 加上陀螺零偏和噪声后量化为原始数据
+  double q[4] = {1, 0, 0, 0};
+  uint32_t seed = 0x13579BDF;
+  for (uint16_t k = 0; k < BENCH_IMU_SAMPLES; k++) {
+    double t = k * BENCH_IMU_DT;
+    double w[3] = {6 * sin(12 * t), 4 * sin(9 * t + 1), 3 * sin(7 * t + 2)};
+    double v[3] = {2 * (q[1] * q[3] - q[0] * q[2]),
+                   2 * (q[0] * q[1] + q[2] * q[3]),
+                   q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3]};
+    int16_t raw[6];
+    for (uint8_t i = 0; i < 6; i++) {
+      seed = seed * 1664525 + 1013904223;
+      double noise = (int16_t)(seed >> 16) / 32768.0;
+      double x = i < 3 ? v[i] * BENCH_IMU_ACC_LSB + 80 * noise
+                       : (w[i - 3] + 0.02) * BENCH_IMU_GYRO_LSB + 8 * noise;
+      raw[i] = lrint(x);
+    }
+    imu_raw[k] = (imu_raw_sample){raw[0], raw[1], raw[2],
+                                  raw[3], raw[4], raw[5]};
+    imu_float[k] = (imu_sample){
+        raw[0] / BENCH_IMU_ACC_LSB,  raw[1] / BENCH_IMU_ACC_LSB,
+        raw[2] / BENCH_IMU_ACC_LSB,  raw[3] / BENCH_IMU_GYRO_LSB,
+        raw[4] / BENCH_IMU_GYRO_LSB, raw[5] / BENCH_IMU_GYRO_LSB};
+    double h[3] = {w[0] * 0.5 * BENCH_IMU_DT, w[1] * 0.5 * BENCH_IMU_DT,
+                   w[2] * 0.5 * BENCH_IMU_DT};
+    double a = q[0], b = q[1], c = q[2];
+    q[0] += -b * h[0] - c * h[1] - q[3] * h[2];
+    q[1] += a * h[0] + c * h[2] - q[3] * h[1];
+    q[2] += a * h[1] - b * h[2] + q[3] * h[0];
+    q[3] += a * h[2] + b * h[1] - c * h[0];
+    double r = 1 / sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    for (uint8_t i = 0; i < 4; i++) q[i] *= r;
+  }
+  uint8_t mode = (uintptr_t)arg;
+  imu_init();
+  if (mode == IMU_LEGACY) return;
+  // 以相同输入与double参考实现比较, 报告姿态的最大偏差
+  double ref[4] = {1, 0, 0, 0}, integ[3] = {0};
+  double err = 0;
+  for (uint16_t n = 0; n < BENCH_IMU_VERIFY; n++) {
+    for (uint16_t k = 0; k < BENCH_IMU_SAMPLES; k++) {
+      imu_reference(ref, integ, &imu_float[k]);
+      Quaternion out;
+      if (mode == IMU_MAHONY_F32) {
+        mahony_update(&imu_f32, &imu_float[k], 1);
+        out = imu_f32.q;
+      } else {
+        mahony_q31_update(&imu_q31, &imu_raw[k], 1);
+        out = mahony_q31_get_quaternion(&imu_q31);
+      }
+      double e = imu_angle(ref, out);
+      if (e > err) err = e;
+    }
+  }
+  Bench_SetExtra(err * 1000, "max mdeg");
+  imu_init();
+}
+
+static void bench_imu(uint32_t iters, void *arg) {
+  uint8_t mode = (uintptr_t)arg;
+  while (iters--) {
+    switch (mode) {
+      case IMU_LEGACY:
+        for (uint16_t k = imu_pos; k < imu_pos + BENCH_IMU_BATCH; k++) {
+          const imu_raw_sample *s = &imu_raw[k];
+          const imu_sample *f = &imu_float[k];
+          imu_gravity = update_fused_vector(imu_gravity, s->ax, s->ay, s->az,
+                                            f->gx, f->gy, f->gz, BENCH_IMU_DT);
+        }
+        break;
+      case IMU_MAHONY_F32:
+        mahony_update(&imu_f32, &imu_float[imu_pos], BENCH_IMU_BATCH);
+        break;
+      default:
+        mahony_q31_update(&imu_q31, &imu_raw[imu_pos], BENCH_IMU_BATCH);
+        break;
+    }
+    imu_pos = (imu_pos + BENCH_IMU_BATCH) % BENCH_IMU_SAMPLES;
+  }
+  BENCH_KEEP(imu_gravity.a + imu_f32.q.a + imu_q31.q[0]);
+}
+
+/**
+ * @brief 模拟AT模组的输出行: 普通日志文本, 部分行末尾带有命令响应
+ */
+static void re_setup(void *arg) {
+  static const char *const tails[] = {"+CSQ: 23,99", "2024-03-16 12:00",
+                                      "+QIRD: 512", "OK"};
+  static const char text[] = "sensor log, 0123 data ok AT+QIRD ";
+  re_len = (uintptr_t)arg & 0xFFFF;
+  for (uint8_t l = 0; l < BENCH_RE_LINES; l++) {
+    const char *tail = tails[l % 4];
+    uint16_t body = re_len - strlen(tail);
+    for (uint16_t i = 0; i < body; i++) {
+      re_lines[l][i] = text[(i + l * 5) % (sizeof(text) - 1)];
+    }
+    strcpy(&re_lines[l][body], tail);
+  }
+  for (uint8_t p = 0; p < BENCH_RE_PATTERNS; p++) {
+    tregex_compile(re_patterns[p], 0, re_prog[p], BENCH_RE_PROG_SIZE);
+  }
+  // 比较两种实现的匹配结果, 报告不一致的次数
+  uint16_t diff = 0;
+  for (uint8_t l = 0; l < BENCH_RE_LINES; l++) {
+    for (uint8_t p = 0; p < BENCH_RE_PATTERNS; p++) {
+      tr_res_t a = tregex_match_str(re_lines[l], re_len, re_patterns[p], 0);
+      tr_res_t b = tregex_match_prog((const tr_prog_t *)re_prog[p],
+                                     re_lines[l], re_len);
+      if (a.Data != b.Data || a.Size != b.Size) diff++;
+    }
+  }
+  Bench_SetExtra(diff, "diff");
+}
+
+static void bench_re(uint32_t iters, void *arg) {
+  uint8_t mode = (uintptr_t)arg >> 16;
+  for (uint32_t i = 0; i < iters; i++) {
+    const char *line = re_lines[i % BENCH_RE_LINES];
+    for (uint8_t p = 0; p < BENCH_RE_PATTERNS; p++) {
+      tr_res_t res;
+      if (mode == RE_STR) {
+        res = tregex_match_str(line, re_len, re_patterns[p], 0);
+      } else {
+        res = tregex_match_prog((const tr_prog_t *)re_prog[p], line, re_len);
+      }
+      BENCH_KEEP(res.Data);
+    }
+  }
+}
+
+/**
+ * @brief 窗函数法设计的FIR低通(系数对称, 无需倒序)
+ * @param  fc               截止频率(相对采样率)
+ */
+static void dsp_lowpass(float *h, uint16_t taps, double fc) {
+  double sum = 0;
+  for (uint16_t i = 0; i < taps; i++) {
+    double m = i - (taps - 1) / 2.0;
+    double sinc = m == 0 ? 2 * fc : sin(2 * M_PI * fc * m) / (M_PI * m);
+    double w = 0.54 - 0.46 * cos(2 * M_PI * i / (taps - 1));
+    h[i] = sinc * w;
+    sum += h[i];
+  }
+  for (uint16_t i = 0; i < taps; i++) h[i] /= sum;
+}
+
+/**
+ * @brief RBJ双二阶低通(Q=0.707, a取负号), 各节相同
+ * @param  fc               截止频率(相对采样率)
+ */
+static void dsp_biquad_lowpass(float *coeffs, uint8_t sections, double fc) {
+  double w0 = 2 * M_PI * fc, alpha = sin(w0) / (2 * 0.707);
+  double a0 = 1 + alpha, c = cos(w0);
+  for (uint8_t k = 0; k < sections; k++) {
+    float *b = &coeffs[5 * k];
+    b[0] = (1 - c) / 2 / a0;
+    b[1] = (1 - c) / a0;
+    b[2] = (1 - c) / 2 / a0;
+    b[3] = 2 * c / a0;
+    b[4] = -(1 - alpha) / a0;
+  }
+}
+
+static void dsp_spectrum_cb(dsp_pipe_t *pipe, const float *out, uint16_t len) {
+  (void)pipe;
+  memcpy(dsp_spectrum, out, len * sizeof(float));
+}
+
+static void dsp_init(uint16_t block) {
+  dsp_pos = 0;
+  if (block) {
+    DSP_Pipe_Init(&dsp_pipe, block, DSP_IN_F32, dsp_spectrum_cb);
+    DSP_Pipe_AddBiquad(&dsp_pipe, dsp_biquad_coeffs, BENCH_DSP_SECTIONS);
+    DSP_Pipe_AddFir(&dsp_pipe, dsp_fir_coeffs, BENCH_DSP_FIR_TAPS);
+    DSP_Pipe_AddDecimate(&dsp_pipe, dsp_dec_coeffs, BENCH_DSP_DEC_TAPS,
+                         BENCH_DSP_DECIM);
+    DSP_Pipe_AddRfftMag(&dsp_pipe, BENCH_DSP_FFT);
+    return;
+  }
+  // 与流水线的FFT级共用生成的表
+  memset(&dsp_sample, 0, sizeof(dsp_sample));
+  arm_biquad_cascade_df1_init_f32(&dsp_sample.biquad, BENCH_DSP_SECTIONS,
+                                  dsp_biquad_coeffs, dsp_sample.biquad_state);
+  arm_fir_init_f32(&dsp_sample.fir, BENCH_DSP_FIR_TAPS, dsp_fir_coeffs,
+                   dsp_sample.fir_state, 1);
+  arm_fir_decimate_init_f32(&dsp_sample.dec, BENCH_DSP_DEC_TAPS,
+                            BENCH_DSP_DECIM, dsp_dec_coeffs,
+                            dsp_sample.dec_state, BENCH_DSP_DECIM);
+}
+
+/**
+ * @brief 逐样本处理: 每个样本依次调用各级, 攒够一次抽取/FFT的样本再调用
+ */
+static void dsp_sample_run(const arm_rfft_fast_instance_f32 *rfft,
+                           const float *x, uint16_t len) {
+  for (uint16_t i = 0; i < len; i++) {
+    float y, z;
+    arm_biquad_cascade_df1_f32(&dsp_sample.biquad, &x[i], &y, 1);
+    arm_fir_f32(&dsp_sample.fir, &y, &z, 1);
+    dsp_sample.dec_in[dsp_sample.dec_fill++] = z;
+    if (dsp_sample.dec_fill < BENCH_DSP_DECIM) continue;
+    dsp_sample.dec_fill = 0;
+    arm_fir_decimate_f32(&dsp_sample.dec, dsp_sample.dec_in,
+                         &dsp_sample.fft_in[dsp_sample.fft_fill++],
+                         BENCH_DSP_DECIM);
+    if (dsp_sample.fft_fill < BENCH_DSP_FFT) continue;
+    dsp_sample.fft_fill = 0;
+    arm_rfft_fast_f32(rfft, dsp_sample.fft_in, dsp_sample.fft_out, 0);
+    arm_cmplx_mag_f32(dsp_sample.fft_out, dsp_spectrum, BENCH_DSP_FFT / 2);
+    dsp_spectrum[0] = fabsf(dsp_sample.fft_out[0]);
+  }
+}
+
+static void dsp_setup(void *arg) {
+  uint32_t seed = 0x2468ACE1;
+  for (uint16_t i = 0; i < BENCH_DSP_SAMPLES; i++) {
+    seed = seed * 1664525 + 1013904223;
+    dsp_input[i] = 0.6f * sinf(2 * M_PI * i * 5 / 256) +
+                   0.3f * sinf(2 * M_PI * i * 90 / 256) +
+                   0.1f * (int16_t)(seed >> 16) / 32768.0f;
+  }
+  dsp_biquad_lowpass(dsp_biquad_coeffs, BENCH_DSP_SECTIONS, 0.05);
+  dsp_lowpass(dsp_fir_coeffs, BENCH_DSP_FIR_TAPS, 0.1);
+  dsp_lowpass(dsp_dec_coeffs, BENCH_DSP_DEC_TAPS, 0.5 / BENCH_DSP_DECIM);
+  // 以相同输入比较逐样本与流水线的幅度谱, 报告最大偏差
+  float ref[BENCH_DSP_FFT / 2];
+  uint16_t block = (uintptr_t)arg;
+  dsp_init(block ? block : BENCH_DSP_WORK);
+  dsp_init(0);
+  for (uint16_t i = 0; i < BENCH_DSP_SAMPLES; i += BENCH_DSP_WORK) {
+    dsp_sample_run(&dsp_pipe.stage[3].inst.rfft, &dsp_input[i],
+                   BENCH_DSP_WORK);
+  }
+  memcpy(ref, dsp_spectrum, sizeof(ref));
+  for (uint16_t i = 0; i < BENCH_DSP_SAMPLES; i += dsp_pipe.block) {
+    DSP_Pipe_Process(&dsp_pipe, &dsp_input[i]);
+  }
+  float err = 0;
+  for (uint16_t k = 0; k < BENCH_DSP_FFT / 2; k++) {
+    if (fabsf(ref[k] - dsp_spectrum[k]) > err)
+      err = fabsf(ref[k] - dsp_spectrum[k]);
+  }
+  Bench_SetExtra(err * 1e6, "e-6 diff");
+  DSP_Pipe_Deinit(&dsp_pipe);
+  dsp_init(block ? block : BENCH_DSP_WORK);
+  dsp_init(0);
+}
+
+static void dsp_teardown(void *arg) {
+  (void)arg;
+  DSP_Pipe_Deinit(&dsp_pipe);
+}
+
+static void bench_dsp(uint32_t iters, void *arg) {
+  uint16_t block = (uintptr_t)arg;
+  while (iters--) {
+    const float *x = &dsp_input[dsp_pos];
+    if (block) {
+      for (uint16_t i = 0; i < BENCH_DSP_WORK; i += block) {
+        DSP_Pipe_Process(&dsp_pipe, &x[i]);
+      }
+    } else {
+      dsp_sample_run(&dsp_pipe.stage[3].inst.rfft, x, BENCH_DSP_WORK);
+    }
+    dsp_pos = (dsp_pos + BENCH_DSP_WORK) % BENCH_DSP_SAMPLES;
+  }
+  BENCH_KEEP(dsp_spectrum[1]);
+}
+
+/**
+ * @brief double精度的运动学卡尔曼滤波器, 与KalmanN_Step()公式相同
+ * @param  fixed            为1时先迭代出稳态增益再滤波(对应定点版本)
+ */
+static void kf_reference(uint8_t n, uint8_t fixed, double *out,
+                         uint32_t len) {
+  double x[KALMAN_MAX_N] = {0}, K[KALMAN_MAX_N], g[KALMAN_MAX_N];
+  double P[KALMAN_MAX_N][KALMAN_MAX_N] = {{0}};
+  double F[KALMAN_MAX_N][KALMAN_MAX_N] = {{0}};
+  double Q[KALMAN_MAX_N][KALMAN_MAX_N];
+  double t = 1;
+  for (uint8_t k = 0; k < n; k++) {
+    for (uint8_t i = 0; i + k < n; i++) F[i][i + k] = t;
+    g[n - 1 - k] = t;
+    t = t * BENCH_KF_DT / (k + 1);
+  }
+  for (uint8_t i = 0; i < n; i++) {
+    for (uint8_t j = 0; j < n; j++) Q[i][j] = kf_q[n] * g[i] * g[j];
+    P[i][i] = 1;
+  }
+  uint32_t warm = fixed ? 200000 : 0;
+  for (uint32_t s = 0; s < warm + len; s++) {
+    if (!fixed || s <= warm) {
+      double fp[KALMAN_MAX_N][KALMAN_MAX_N], hp[KALMAN_MAX_N];
+      for (uint8_t i = 0; i < n; i++) {
+        for (uint8_t j = 0; j < n; j++) {
+          fp[i][j] = 0;
+          for (uint8_t k = 0; k < n; k++) fp[i][j] += F[i][k] * P[k][j];
+        }
+      }
+      for (uint8_t i = 0; i < n; i++) {
+        for (uint8_t j = 0; j < n; j++) {
+          P[i][j] = Q[i][j];
+          for (uint8_t k = 0; k < n; k++) P[i][j] += fp[i][k] * F[j][k];
+        }
+      }
+      for (uint8_t i = 0; i < n; i++) {
+        hp[i] = P[0][i];
+        K[i] = P[i][0] / (P[0][0] + BENCH_KF_R);
+      }
+      for (uint8_t i = 0; i < n; i++) {
+        for (uint8_t j = 0; j < n; j++) P[i][j] -= K[i] * hp[j];
+      }
+    }
+    if (s < warm) continue;
+    double fx[KALMAN_MAX_N];
+    for (uint8_t i = 0; i < n; i++) {
+      fx[i] = 0;
+      for (uint8_t k = 0; k < n; k++) fx[i] += F[i][k] * x[k];
+    }
+    double y = kf_z[(s - warm) % BENCH_KF_SAMPLES] - fx[0];
+    for (uint8_t i = 0; i < n; i++) x[i] = fx[i] + K[i] * y;
+    out[s - warm] = x[0];
+  }
+}
+
+static void kf_init(void) {
+  float sc[KALMAN_MAX_N];
+  for (uint8_t i = 0; i < KALMAN_MAX_N; i++) {
+    sc[i] = pow(BENCH_KF_C / BENCH_KF_DT, i);
+  }
+  Kalman1_Init(&kf1);
+  Kalman1_SetKinematic(&kf1, BENCH_KF_DT, kf_q[1], BENCH_KF_R);
+  Kalman1Q_Init(&kf1_q, &kf1, sc);
+  Kalman2_Init(&kf2);
+  Kalman2_SetKinematic(&kf2, BENCH_KF_DT, kf_q[2], BENCH_KF_R);
+  Kalman2Q_Init(&kf2_q, &kf2, sc);
+  Kalman4_Init(&kf4);
+  Kalman4_SetKinematic(&kf4, BENCH_KF_DT, kf_q[4], BENCH_KF_R);
+  Kalman4Q_Init(&kf4_q, &kf4, sc);
+  CompFilter_Init(&kf_comp, BENCH_KF_TAU, BENCH_KF_DT, 0);
+  CompFilterQ_Init(&kf_comp_q, BENCH_KF_TAU, BENCH_KF_DT, BENCH_KF_RATE_FS,
+                   BENCH_KF_FS, 0);
+  kf_pos = 0;
+}
+
+/**
+ * @brief 处理BENCH_KF_BATCH个样本, 输出到kf_out/kf_out_q
+ */
+static void kf_run(uint8_t mode, uint8_t n) {
+  const float *z = &kf_z[kf_pos];
+  const int32_t *zq = &kf_zq[kf_pos];
+  switch (mode) {
+    case KF_F32:
+      if (n == 1) Kalman1_Batch(&kf1, z, kf_out, BENCH_KF_BATCH);
+      if (n == 2) Kalman2_Batch(&kf2, z, kf_out, BENCH_KF_BATCH);
+      if (n == 4) Kalman4_Batch(&kf4, z, kf_out, BENCH_KF_BATCH);
+      break;
+    case KF_Q31:
+      if (n == 1) Kalman1Q_Batch(&kf1_q, zq, kf_out_q, BENCH_KF_BATCH);
+      if (n == 2) Kalman2Q_Batch(&kf2_q, zq, kf_out_q, BENCH_KF_BATCH);
+      if (n == 4) Kalman4Q_Batch(&kf4_q, zq, kf_out_q, BENCH_KF_BATCH);
+      break;
+    case COMP_F32:
+      CompFilter_Batch(&kf_comp, &kf_rate[kf_pos], z, kf_out, BENCH_KF_BATCH);
+      break;
+    default:
+      CompFilterQ_Batch(&kf_comp_q, &kf_rate_q[kf_pos], zq, kf_out_q,
+                        BENCH_KF_BATCH);
+      break;
+  }
+  kf_pos = (kf_pos + BENCH_KF_BATCH) % BENCH_KF_SAMPLES;
+}
+
+static void kf_setup(void *arg) {
+  // 2Hz正弦观测加均匀噪声, 变化率带0.05的零偏, 定点版本按满量程量化
+  const double w = 2 * M_PI * 2;
+  uint32_t seed = 0x35791BDF;
+  for (uint16_t i = 0; i < BENCH_KF_SAMPLES; i++) {
+    double t = i * BENCH_KF_DT;
+    seed = seed * 1664525 + 1013904223;
+    kf_z[i] = sin(w * t) + 0.2 * (int16_t)(seed >> 16) / 32768.0;
+    kf_rate[i] = w * cos(w * t) + 0.05;
+    kf_zq[i] = lrint(kf_z[i] / BENCH_KF_FS * 2147483648.0);
+    kf_rate_q[i] = lrint(kf_rate[i] / BENCH_KF_RATE_FS * 2147483648.0);
+  }
+  uint8_t mode = (uintptr_t)arg >> 8, n = (uintptr_t)arg & 0xFF;
+  kf_init();
+  // 以相同输入与double参考实现比较, 报告相对定点满量程的最大偏差
+  static double ref[BENCH_KF_VERIFY * BENCH_KF_SAMPLES];
+  const uint32_t len = BENCH_KF_VERIFY * BENCH_KF_SAMPLES;
+  if (mode == COMP_F32 || mode == COMP_Q31) {
+    double a = BENCH_KF_TAU / (BENCH_KF_TAU + BENCH_KF_DT), y = 0;
+    for (uint32_t s = 0; s < len; s++) {
+      uint16_t k = s % BENCH_KF_SAMPLES;
+      y = a * (y + kf_rate[k] * BENCH_KF_DT) + (1 - a) * kf_z[k];
+      ref[s] = y;
+    }
+  } else {
+    kf_reference(n, mode == KF_Q31, ref, len);
+  }
+  double err = 0;
+  for (uint32_t s = 0; s < len; s += BENCH_KF_BATCH) {
+    kf_run(mode, n);
+    for (uint16_t i = 0; i < BENCH_KF_BATCH; i++) {
+      double v = mode == KF_F32 || mode == COMP_F32
+                     ? kf_out[i]
+                     : kf_out_q[i] / 2147483648.0 * BENCH_KF_FS;
+      if (fabs(v - ref[s + i]) > err) err = fabs(v - ref[s + i]);
+    }
+  }
+  Bench_SetExtra(err / BENCH_KF_FS * 1e7, "e-7 fs");
+  kf_init();
+}
+
+static void bench_kf(uint32_t iters, void *arg) {
+  uint8_t mode = (uintptr_t)arg >> 8, n = (uintptr_t)arg & 0xFF;
+  while (iters--) kf_run(mode, n);
+  BENCH_KEEP(kf_out[0] + kf_out_q[0]);
+}
+
+/**
+ * @brief ws2812_spi中HSV_To_RGB的浮点公式(S,V为0-255)
+ */
+static uint32_t fm_hsv_float(float h, uint8_t s, uint8_t v) {
+  uint8_t r, g, b;
+  float max = v;
+  float min = max * (255 - s) / 255.0f;
+  float adj = (max - min) * (h - ((int)h / 60) * 60.0f) / 60.0f;
+  switch ((int)h / 60) {
+    case 0:
+      r = max, g = min + adj, b = min;
+      break;
+    case 1:
+      r = max - adj, g = max, b = min;
+      break;
+    case 2:
+      r = min, g = max, b = min + adj;
+      break;
+    case 3:
+      r = min, g = max - adj, b = max;
+      break;
+    case 4:
+      r = min + adj, g = min, b = max;
+      break;
+    default:
+      r = max, g = min, b = max - adj;
+      break;
+  }
+  return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+/**
+ * @brief 第k个扫描点上单精度结果与double结果的误差
+ */
+static double fm_error(uint8_t func, uint8_t fast, uint32_t k) {
+  double u = (double)k / BENCH_FM_VERIFY;
+  if (func == FM_SIN) {
+    float x = (u * 2 - 1) * 2 * M_PI;
+    return fabs((fast ? FM_Sin(x) : sinf(x)) - sin(x));
+  }
+  if (func == FM_ATAN2) {
+    float y = (k % 7 + 1) * sin(u * 2 * M_PI);
+    float x = (k % 7 + 1) * cos(u * 2 * M_PI);
+    return fabs((fast ? FM_Atan2(y, x) : atan2f(y, x)) - atan2(y, x));
+  }
+  if (func == FM_LOG2) {
+    float x = exp2(u * 20 - 10);
+    return fabs((fast ? FM_Log2(x) : log2f(x)) - log2(x));
+  }
+  if (func == FM_EXP2) {
+    float x = u * 20 - 10;
+    return fabs((fast ? FM_Exp2(x) : exp2f(x)) / exp2(x) - 1);
+  }
+  float x = exp2(u * 20 - 10);
+  return fabs((fast ? FM_InvSqrt(x) : 1 / sqrtf(x)) * sqrt(x) - 1);
+}
+
+static void fm_setup(void *arg) {
+  uint8_t func = (uintptr_t)arg >> 1, fast = (uintptr_t)arg & 1;
+  uint32_t seed = 0x0F1E2D3C;
+  for (uint16_t i = 0; i < BENCH_FM_LEN; i++) {
+    float r[2];
+    for (uint8_t k = 0; k < 2; k++) {
+      seed = seed * 1664525 + 1013904223;
+      r[k] = (seed >> 8) / 16777216.0f;  // [0, 1)
+    }
+    switch (func) {
+      case FM_SIN:
+        fm_x[i] = (r[0] * 2 - 1) * 2 * M_PI;
+        break;
+      case FM_ATAN2:
+        fm_x[i] = r[0] * 2 - 1;
+        fm_y[i] = r[1] * 2 - 1;
+        break;
+      case FM_EXP2:
+        fm_x[i] = r[0] * 20 - 10;
+        break;
+      case FM_HSV:
+        fm_x[i] = (seed % FM_HUE_MAX) * (360.0f / FM_HUE_MAX);
+        break;
+      default:
+        fm_x[i] = exp2f(r[0] * 20 - 10);
+        break;
+    }
+    fm_s[i] = seed >> 8;
+    fm_v[i] = seed >> 16;
+  }
+  double err = 0;
+  if (func == FM_HSV) {
+    // 扫描全部色相, 比较各通道与浮点公式的差值
+    for (uint16_t h = 0; h < FM_HUE_MAX; h++) {
+      float deg = h * (360.0f / FM_HUE_MAX);
+      for (uint16_t s = 0; s < 256; s += 5) {
+        for (uint16_t v = 0; v < 256; v += 5) {
+          uint32_t a = fm_hsv_float(deg, s, v);
+          uint32_t b = fast ? FM_HSV_DEG(deg, s, v) : a;
+          for (uint8_t c = 0; c < 24; c += 8) {
+            int d = abs((int)((a >> c) & 0xFF) - (int)((b >> c) & 0xFF));
+            if (d > err) err = d;
+          }
+        }
+      }
+    }
+    Bench_SetExtra(err, "LSB");
+    return;
+  }
+  for (uint32_t k = 0; k <= BENCH_FM_VERIFY; k++) {
+    double e = fm_error(func, fast, k);
+    if (e > err) err = e;
+  }
+  Bench_SetExtra(err * 1e7, "e-7 err");
+}
+
+#define FM_LOOP(_expr)                                                 \
+  for (uint16_t i = 0; i < BENCH_FM_LEN; i++) fm_out[i] = (_expr)
+
+static void bench_fm(uint32_t iters, void *arg) {
+  while (iters--) {
+    switch ((uintptr_t)arg) {
+      case FM_SIN << 1:
+        FM_LOOP(sinf(fm_x[i]));
+        break;
+      case FM_SIN << 1 | 1:
+        FM_LOOP(FM_Sin(fm_x[i]));
+        break;
+      case FM_ATAN2 << 1:
+        FM_LOOP(atan2f(fm_y[i], fm_x[i]));
+        break;
+      case FM_ATAN2 << 1 | 1:
+        FM_LOOP(FM_Atan2(fm_y[i], fm_x[i]));
+        break;
+      case FM_LOG2 << 1:
+        FM_LOOP(log2f(fm_x[i]));
+        break;
+      case FM_LOG2 << 1 | 1:
+        FM_LOOP(FM_Log2(fm_x[i]));
+        break;
+      case FM_EXP2 << 1:
+        FM_LOOP(exp2f(fm_x[i]));
+        break;
+      case FM_EXP2 << 1 | 1:
+        FM_LOOP(FM_Exp2(fm_x[i]));
+        break;
+      case FM_INVSQRT << 1:
+        FM_LOOP(1 / sqrtf(fm_x[i]));
+        break;
+      case FM_INVSQRT << 1 | 1:
+        FM_LOOP(FM_InvSqrt(fm_x[i]));
+        break;
+      case FM_HSV << 1:
+        for (uint16_t i = 0; i < BENCH_FM_LEN; i++) {
+          fm_rgb[i] = fm_hsv_float(fm_x[i], fm_s[i], fm_v[i]);
+        }
+        break;
+      default:
+        for (uint16_t i = 0; i < BENCH_FM_LEN; i++) {
+          fm_rgb[i] = FM_HSV_DEG(fm_x[i], fm_s[i], fm_v[i]);
+        }
+        break;
+    }
+  }
+  BENCH_KEEP(fm_out[0] + fm_rgb[0]);
+}
+
+static void ws_init(uint8_t mode) {
+  memset(ws_ring, 0, sizeof(ws_ring));
+  ws_ring_wr = 0;
+  if (mode == WS_EMA) {
+    EMA_InitTau(&ws_ema, BENCH_WS_LEN / BENCH_WS_FS, 1 / BENCH_WS_FS);
+  } else if (mode != WS_RESUM) {
+    WinStats_Init(&ws_stats, BENCH_WS_LEN,
+                  mode == WS_MEANVAR ? 0 : WIN_STATS_MINMAX);
+    if (mode == WS_PERCENTILE) {
+      WinStats_EnablePercentile(&ws_stats, BENCH_WS_LO, BENCH_WS_HI,
+                                BENCH_WS_BINS);
+    }
+  }
+  LFifo_AssignBuf(&ws_fifo, (uint8_t *)ws_fifo_buf, sizeof(ws_fifo_buf));
+}
+
+static void ws_push(uint8_t mode, float x) {
+  switch (mode) {
+    case WS_RESUM:
+      ws_ring[ws_ring_wr] = x;
+      if (++ws_ring_wr == BENCH_WS_LEN) ws_ring_wr = 0;
+      break;
+    case WS_EMA:
+      EMA_Update(&ws_ema, x);
+      break;
+    case WS_FIFO:
+      LFifo_Write(&ws_fifo, (uint8_t *)&x, sizeof(float));
+      if (LFifo_GetFree(&ws_fifo) < sizeof(float)) {
+        WinStats_PushFifo(&ws_stats, &ws_fifo);
+      }
+      break;
+    default:
+      WinStats_Push(&ws_stats, x);
+      break;
+  }
+}
+
+// 均值/标准差/最大值/最小值
+static void ws_resum(float s[4]) {
+  uint32_t idx;
+  arm_mean_f32(ws_ring, BENCH_WS_LEN, &s[0]);
+  arm_std_f32(ws_ring, BENCH_WS_LEN, &s[1]);
+  arm_max_f32(ws_ring, BENCH_WS_LEN, &s[2], &idx);
+  arm_min_f32(ws_ring, BENCH_WS_LEN, &s[3], &idx);
+}
+
+static int ws_cmp(const void *a, const void *b) {
+  double d = *(const double *)a - *(const double *)b;
+  return (d > 0) - (d < 0);
+}
+
+static void ws_setup(void *arg) {
+  uint8_t mode = (uintptr_t)arg;
+  uint32_t seed = 0x5A17C0DE;
+  for (uint16_t i = 0; i < BENCH_WS_SAMPLES; i++) {
+    seed = seed * 1664525 + 1013904223;
+    double noise = (seed >> 8) / 8388608.0 - 1;  // [-1, 1)
+    ws_x[i] = 1.5 + 0.8 * sin(2 * M_PI * 1e3 * i / BENCH_WS_FS) + 0.2 * noise;
+  }
+  // 每隔BENCH_WS_CHECK个样本与double精确结果比较, 百分位误差以桶宽为单位
+  ws_init(mode);
+  double err = 0, em = 0, ev = 0;
+  for (uint32_t t = 0; t < BENCH_WS_VERIFY; t++) {
+    float x = ws_x[t % BENCH_WS_SAMPLES];
+    ws_push(mode, x);
+    if (mode == WS_EMA) {
+      double a = ws_ema.alpha, d = x - em;
+      em = t ? em + a * d : x;
+      ev = t ? (1 - a) * (ev + a * d * d) : 0;
+    }
+    if ((t + 1) % BENCH_WS_CHECK || t + 1 < BENCH_WS_LEN) continue;
+    double ref[4], got[4] = {0};
+    if (mode == WS_EMA) {
+      ref[0] = em;
+      ref[1] = sqrt(ev);
+      got[0] = ws_ema.mean;
+      got[1] = EMA_Std(&ws_ema);
+      ref[2] = ref[3] = 0;
+    } else {
+      double sum = 0, m2 = 0;
+      for (uint16_t k = 0; k < BENCH_WS_LEN; k++) {
+        ws_sorted[k] = ws_x[(t - k) % BENCH_WS_SAMPLES];
+        sum += ws_sorted[k];
+      }
+      ref[0] = sum / BENCH_WS_LEN;
+      for (uint16_t k = 0; k < BENCH_WS_LEN; k++) {
+        m2 += (ws_sorted[k] - ref[0]) * (ws_sorted[k] - ref[0]);
+      }
+      ref[1] = sqrt(m2 / (BENCH_WS_LEN - 1));
+      qsort(ws_sorted, BENCH_WS_LEN, sizeof(double), ws_cmp);
+      ref[2] = ws_sorted[BENCH_WS_LEN - 1];
+      ref[3] = ws_sorted[0];
+      if (mode == WS_RESUM) {
+        float s[4];
+        ws_resum(s);
+        for (uint8_t k = 0; k < 4; k++) got[k] = s[k];
+      } else {
+        if (mode == WS_FIFO) WinStats_PushFifo(&ws_stats, &ws_fifo);
+        got[0] = WinStats_Mean(&ws_stats);
+        got[1] = WinStats_Std(&ws_stats);
+        got[2] = WinStats_Max(&ws_stats);
+        got[3] = WinStats_Min(&ws_stats);
+      }
+      if (mode == WS_MEANVAR) ref[2] = ref[3] = 0;
+    }
+    if (mode == WS_PERCENTILE) {
+      const double width = (BENCH_WS_HI - BENCH_WS_LO) / BENCH_WS_BINS;
+      const float p[2] = {0.5f, 0.9f};
+      for (uint8_t k = 0; k < 2; k++) {
+        double e = WinStats_Percentile(&ws_stats, p[k]) -
+                   ws_sorted[(uint16_t)(p[k] * (BENCH_WS_LEN - 1))];
+        if (fabs(e) / width > err) err = fabs(e) / width;
+      }
+      continue;
+    }
+    for (uint8_t k = 0; k < 4; k++) {
+      if (fabs(got[k] - ref[k]) > err) err = fabs(got[k] - ref[k]);
+    }
+  }
+  if (mode == WS_PERCENTILE) {
+    Bench_SetExtra(err, "bin");
+  } else {
+    Bench_SetExtra(err * 1e6, "e-6 err");
+  }
+  // 从填满的窗口开始计时
+  WinStats_Deinit(&ws_stats);
+  ws_init(mode);
+  for (uint16_t i = 0; i < BENCH_WS_LEN; i++) ws_push(mode, ws_x[i]);
+  if (mode == WS_FIFO) WinStats_PushFifo(&ws_stats, &ws_fifo);
+  ws_pos = 0;
+}
+
+static void ws_teardown(void *arg) {
+  (void)arg;
+  WinStats_Deinit(&ws_stats);
+}
+
+static void bench_ws(uint32_t iters, void *arg) {
+  uint8_t mode = (uintptr_t)arg;
+  float acc = 0;
+  while (iters--) {
+    const float *x = &ws_x[ws_pos];
+    switch (mode) {
+      case WS_RESUM:
+        for (uint16_t i = 0; i < BENCH_WS_BATCH; i++) {
+          float s[4];
+          ws_push(mode, x[i]);
+          ws_resum(s);
+          acc += s[0] + s[1] + s[2] - s[3];
+        }
+        break;
+      case WS_MEANVAR:
+        for (uint16_t i = 0; i < BENCH_WS_BATCH; i++) {
+          WinStats_Push(&ws_stats, x[i]);
+          acc += WinStats_Mean(&ws_stats) + WinStats_Std(&ws_stats);
+        }
+        break;
+      case WS_FIFO:
+        LFifo_Write(&ws_fifo, (uint8_t *)x, BENCH_WS_BATCH * sizeof(float));
+        WinStats_PushFifo(&ws_stats, &ws_fifo);
+        acc += WinStats_Mean(&ws_stats) + WinStats_Std(&ws_stats) +
+               WinStats_Max(&ws_stats) - WinStats_Min(&ws_stats);
+        break;
+      case WS_EMA:
+        for (uint16_t i = 0; i < BENCH_WS_BATCH; i++) {
+          acc += EMA_Update(&ws_ema, x[i]) + EMA_Std(&ws_ema);
+        }
+        break;
+      default:
+        for (uint16_t i = 0; i < BENCH_WS_BATCH; i++) {
+          WinStats_Push(&ws_stats, x[i]);
+          acc += WinStats_Mean(&ws_stats) + WinStats_Std(&ws_stats) +
+                 WinStats_Max(&ws_stats) - WinStats_Min(&ws_stats);
+        }
+        if (mode == WS_PERCENTILE) {
+          acc += WinStats_Percentile(&ws_stats, 0.5f) +
+                 WinStats_Percentile(&ws_stats, 0.9f);
+        }
+        break;
+    }
+    ws_pos += BENCH_WS_BATCH;
+    if (ws_pos >= BENCH_WS_SAMPLES) ws_pos = 0;
+  }
+  BENCH_KEEP(acc);
+}
+
+#if MOD_HOST_CMSIS_REF
+static const arm_cfft_instance_f32 *cmsis_cfft(uint8_t kernel) {
+  // RFFT_MAG级的内部CFFT长度为fft_len/2
+  dsp_stage_t *st = &cmsis_fft_pipe.stage[kernel == CMSIS_CFFT_256 ? 0 : 1];
+  return &st->inst.rfft.Sint;
+}
+
+/**
+ * @brief 以第impl组实现运行一次内核, 结果写入cmsis_out[impl]
+ */
+static void cmsis_run(uint8_t kernel, uint8_t impl) {
+  const cmsis_impl_t *f = &cmsis_impl[impl];
+  float *out = cmsis_out[impl];
+  switch (kernel) {
+    case CMSIS_DOT:
+      f->dot(cmsis_a, cmsis_b, BENCH_CMSIS_LEN, out);
+      break;
+    case CMSIS_FIR:
+      f->fir(&cmsis_fir[impl], cmsis_a, out, BENCH_CMSIS_LEN);
+      break;
+    case CMSIS_BIQUAD:
+      f->biquad(&cmsis_biquad[impl], cmsis_a, out, BENCH_CMSIS_LEN);
+      break;
+    case CMSIS_CMPLX_MULT:
+      f->cmplx_mult(cmsis_a, cmsis_b, out, BENCH_CMSIS_LEN);
+      break;
+    case CMSIS_CFFT_256:
+    case CMSIS_CFFT_1024:
+      f->cfft(cmsis_cfft(kernel), out, 0, 1);
+      break;
+    case CMSIS_MAT_MULT: {
+      arm_matrix_instance_f32 ma, mb, mo;
+      arm_mat_init_f32(&ma, BENCH_CMSIS_MAT, BENCH_CMSIS_MAT, cmsis_a);
+      arm_mat_init_f32(&mb, BENCH_CMSIS_MAT, BENCH_CMSIS_MAT, cmsis_b);
+      arm_mat_init_f32(&mo, BENCH_CMSIS_MAT, BENCH_CMSIS_MAT, out);
+      f->mat_mult(&ma, &mb, &mo);
+    } break;
+  }
+}
+
+static void cmsis_setup(void *arg) {
+  uint8_t kernel = (uintptr_t)arg >> 1;
+  uint32_t seed = 0x13579BDF;
+  for (uint16_t i = 0; i < 2 * BENCH_CMSIS_LEN; i++) {
+    seed = seed * 1664525 + 1013904223;
+    cmsis_a[i] = (int16_t)(seed >> 16) / 32768.0f;
+    seed = seed * 1664525 + 1013904223;
+    cmsis_b[i] = (int16_t)(seed >> 16) / 32768.0f;
+  }
+  dsp_lowpass(cmsis_fir_coeffs, BENCH_CMSIS_TAPS, 0.1);
+  dsp_biquad_lowpass(cmsis_biquad_coeffs, BENCH_CMSIS_SECTIONS, 0.05);
+  memset(cmsis_fir_state, 0, sizeof(cmsis_fir_state));
+  memset(cmsis_biquad_state, 0, sizeof(cmsis_biquad_state));
+  for (uint8_t k = 0; k < 2; k++) {
+    arm_fir_init_f32(&cmsis_fir[k], BENCH_CMSIS_TAPS, cmsis_fir_coeffs,
+                     cmsis_fir_state[k], BENCH_CMSIS_LEN);
+    arm_biquad_cascade_df1_init_f32(&cmsis_biquad[k], BENCH_CMSIS_SECTIONS,
+                                    cmsis_biquad_coeffs,
+                                    cmsis_biquad_state[k]);
+  }
+  DSP_Pipe_Init(&cmsis_fft_pipe, 2 * BENCH_CMSIS_FFT_MIN, DSP_IN_F32, NULL);
+  DSP_Pipe_AddRfftMag(&cmsis_fft_pipe, 2 * BENCH_CMSIS_FFT_MIN);
+  DSP_Pipe_AddRfftMag(&cmsis_fft_pipe, 2 * BENCH_CMSIS_FFT_MAX);
+  // 相同输入下SIMD与通用C版本的最大偏差, 相对于输出的最大幅值
+  memcpy(cmsis_out[0], cmsis_a, sizeof(cmsis_a));
+  memcpy(cmsis_out[1], cmsis_a, sizeof(cmsis_a));
+  cmsis_run(kernel, 0);
+  cmsis_run(kernel, 1);
+  float err = 0, peak = 0;
+  for (uint16_t i = 0; i < 2 * BENCH_CMSIS_LEN; i++) {
+    float d = fabsf(cmsis_out[1][i] - cmsis_out[0][i]);
+    if (d > err) err = d;
+    if (fabsf(cmsis_out[0][i]) > peak) peak = fabsf(cmsis_out[0][i]);
+  }
+  if ((uintptr_t)arg & 1) Bench_SetExtra(err / peak * 1e7, "e-7 diff");
+}
+
+static void cmsis_teardown(void *arg) {
+  (void)arg;
+  DSP_Pipe_Deinit(&cmsis_fft_pipe);
+}
+
+static void bench_cmsis(uint32_t iters, void *arg) {
+  uint8_t kernel = (uintptr_t)arg >> 1, impl = (uintptr_t)arg & 1;
+  while (iters--) {
+    cmsis_run(kernel, impl);
+    if (kernel == CMSIS_CFFT_256 || kernel == CMSIS_CFFT_1024) {
+      // 逆变换缩放1/N, 原地反复变换时数据不会溢出
+      cmsis_impl[impl].cfft(cmsis_cfft(kernel), cmsis_out[impl], 1, 1);
+    }
+  }
+  BENCH_KEEP(cmsis_out[impl][1]);
+}
+#endif  // MOD_HOST_CMSIS_REF
+
+// Exported Variables -----------------------
+
+static const bench_case_t algorithm_cases[] = {
+    BENCH_CASE_EX("crc/crc16_modbus", bench_crc16_modbus, crc_setup, NULL,
+                  NULL, BENCH_CRC_LEN, "B"),
+    BENCH_CASE_EX("crc/crc32", bench_crc32, crc_setup, NULL, NULL,
+                  BENCH_CRC_LEN, "B"),
+    PID_CASE("pid/scalar_12", PID_SCALAR, 12),
+    PID_CASE("pid/bank_12", PID_BANK, 12),
+    PID_CASE("pid/bank_12_simd", PID_BANK_SIMD, 12),
+    PID_CASE("pid/bank_12_q15", PID_BANK_Q15, 12),
+    PID_CASE("pid/scalar_24", PID_SCALAR, 24),
+    PID_CASE("pid/bank_24", PID_BANK, 24),
+    PID_CASE("pid/bank_24_simd", PID_BANK_SIMD, 24),
+    PID_CASE("pid/bank_24_q15", PID_BANK_Q15, 24),
+    BENCH_CASE_EX("imu/legacy_fused", bench_imu, imu_setup, NULL,
+                  (void *)IMU_LEGACY, BENCH_IMU_BATCH, "sample"),
+    BENCH_CASE_EX("imu/mahony_f32", bench_imu, imu_setup, NULL,
+                  (void *)IMU_MAHONY_F32, BENCH_IMU_BATCH, "sample"),
+    BENCH_CASE_EX("imu/mahony_q31", bench_imu, imu_setup, NULL,
+                  (void *)IMU_MAHONY_Q31, BENCH_IMU_BATCH, "sample"),
+    RE_CASE("regex/str_64B", RE_STR, 64),
+    RE_CASE("regex/prog_64B", RE_PROG, 64),
+    RE_CASE("regex/str_256B", RE_STR, 256),
+    RE_CASE("regex/prog_256B", RE_PROG, 256),
+    DSP_CASE("dsp/chain_sample", 0),
+    DSP_CASE("dsp/chain_block16", 16),
+    DSP_CASE("dsp/chain_block64", 64),
+    KF_CASE("kalman/n1_f32", KF_F32, 1),
+    KF_CASE("kalman/n1_q31", KF_Q31, 1),
+    KF_CASE("kalman/n2_f32", KF_F32, 2),
+    KF_CASE("kalman/n2_q31", KF_Q31, 2),
+    KF_CASE("kalman/n4_f32", KF_F32, 4),
+    KF_CASE("kalman/n4_q31", KF_Q31, 4),
+    KF_CASE("comp/f32", COMP_F32, 0),
+    KF_CASE("comp/q31", COMP_Q31, 0),
+    FM_CASE("fastmath/sin", "libm", FM_SIN),
+    FM_CASE("fastmath/atan2", "libm", FM_ATAN2),
+    FM_CASE("fastmath/log2", "libm", FM_LOG2),
+    FM_CASE("fastmath/exp2", "libm", FM_EXP2),
+    FM_CASE("fastmath/invsqrt", "libm", FM_INVSQRT),
+    FM_CASE("fastmath/hsv", "float", FM_HSV),
+    WS_CASE("winstats/resum_1000", WS_RESUM),
+    WS_CASE("winstats/meanvar_1000", WS_MEANVAR),
+    WS_CASE("winstats/minmax_1000", WS_MINMAX),
+    WS_CASE("winstats/fifo_1000", WS_FIFO),
+    WS_CASE("winstats/percentile_1000", WS_PERCENTILE),
+    WS_CASE("winstats/ema", WS_EMA),
+#if MOD_HOST_CMSIS_REF
+    CMSIS_CASE("cmsis/dot_1024", CMSIS_DOT, BENCH_CMSIS_LEN, "sample"),
+    CMSIS_CASE("cmsis/fir32_1024", CMSIS_FIR, BENCH_CMSIS_LEN, "sample"),
+    CMSIS_CASE("cmsis/biquad4_1024", CMSIS_BIQUAD, BENCH_CMSIS_LEN, "sample"),
+    CMSIS_CASE("cmsis/cmplx_mult_1024", CMSIS_CMPLX_MULT, BENCH_CMSIS_LEN,
+               "sample"),
+    CMSIS_CASE("cmsis/cfft_256", CMSIS_CFFT_256, 2, "fft"),
+    CMSIS_CASE("cmsis/cfft_1024", CMSIS_CFFT_1024, 2, "fft"),
+    CMSIS_CASE("cmsis/mat_mult_32", CMSIS_MAT_MULT, 1, "mat"),
+#endif
+};
+
+const bench_group_t bench_group_algorithm =
+    BENCH_GROUP("algorithm", algorithm_cases);
+
+#endif  // BENCH_CFG_GROUP_ALGORITHM
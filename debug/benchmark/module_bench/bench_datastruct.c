@@ -0,0 +1,274 @@
+/**
+ * @file bench_datastruct.c
+ * @brief 数据结构模块基准测试用例(ulist/udict/lfifo/lwrb/lfbb/json)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "bench.h"
+
+#if BENCH_CFG_GROUP_DATASTRUCT
+#include "json.h"
+#include "lfbb.h"
+#include "lfifo.h"
+#include "lwrb.h"
+#include "udict.h"
+#include "ulist.h"
+
+// Private Defines --------------------------
+
+#define BENCH_BUF_SIZE 4096
+#define BENCH_LIST_LEN 1024  // 列表用例的元素数
+#define BENCH_DICT_KEYS 64   // 字典用例的键数
+
+// Private Variables ------------------------
+
+static uint8_t bench_buf[BENCH_BUF_SIZE];
+static uint8_t bench_rbuf[BENCH_BUF_SIZE];
+
+/* ulist ------------------------------------------------------------------- */
+
+static ulist_t bench_list;
+static uint32_t sort_src[BENCH_LIST_LEN];
+
+static int u32_cmp(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return (x > y) - (x < y);
+}
+
+static void ulist_setup(void *arg) {
+  (void)arg;
+  ulist_init(&bench_list, sizeof(uint32_t), BENCH_LIST_LEN, ULIST_CFG_NO_MUTEX,
+             NULL);  // 预分配容量
+  bench_list.num = 0;
+  uint32_t seed = 0x12345678;
+  for (uint16_t i = 0; i < BENCH_LIST_LEN; i++) {
+    seed = seed * 1664525 + 1013904223;  // LCG
+    sort_src[i] = seed;
+  }
+}
+
+static void ulist_teardown(void *arg) {
+  (void)arg;
+  ulist_clear(&bench_list);
+}
+
+static void bench_ulist_append(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    if (bench_list.num >= BENCH_LIST_LEN) bench_list.num = 0;
+    ulist_append_copy(&bench_list, &iters);
+  }
+}
+
+static void bench_ulist_insert(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    if (bench_list.num >= BENCH_LIST_LEN / 4) bench_list.num = 0;
+    ulist_insert_copy(&bench_list, 0, &iters);  // 头部插入, 需要搬移全部元素
+  }
+}
+
+static void bench_ulist_sort(uint32_t iters, void *arg) {
+  (void)arg;
+  bench_list.num = 0;
+  ulist_append_multi(&bench_list, BENCH_LIST_LEN);
+  while (iters--) {
+    memcpy(bench_list.data, sort_src, sizeof(sort_src));
+    ulist_sort(&bench_list, u32_cmp, SLICE_START, SLICE_END);
+  }
+}
+
+/* udict ------------------------------------------------------------------- */
+
+static udict_t bench_dict;
+static char dict_keys[BENCH_DICT_KEYS][8];
+
+static void udict_setup(void *arg) {
+  (void)arg;
+  udict_init(&bench_dict);
+  for (uint16_t i = 0; i < BENCH_DICT_KEYS; i++) {
+    snprintf(dict_keys[i], sizeof(dict_keys[i]), "key%02u", i);
+    udict_set(&bench_dict, dict_keys[i], (void *)(uintptr_t)i);
+  }
+}
+
+static void udict_teardown(void *arg) {
+  (void)arg;
+  udict_clear(&bench_dict);
+}
+
+static void bench_udict_get(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    BENCH_KEEP(udict_get(&bench_dict, dict_keys[iters % BENCH_DICT_KEYS]));
+  }
+}
+
+static void bench_udict_set(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    udict_set(&bench_dict, dict_keys[iters % BENCH_DICT_KEYS],
+              (void *)(uintptr_t)iters);
+  }
+}
+
+/* lfifo ------------------------------------------------------------------- */
+
+static lfifo_t bench_fifo;
+
+static void lfifo_setup(void *arg) {
+  (void)arg;
+  LFifo_Init(&bench_fifo, BENCH_BUF_SIZE);
+}
+
+static void lfifo_teardown(void *arg) {
+  (void)arg;
+  LFifo_Destory(&bench_fifo);
+}
+
+static void bench_lfifo_rw(uint32_t iters, void *arg) {
+  fifo_size_t len = (fifo_size_t)(uintptr_t)arg;
+  while (iters--) {
+    LFifo_Write(&bench_fifo, bench_buf, len);
+    LFifo_Read(&bench_fifo, bench_rbuf, len);
+  }
+}
+
+/* lwrb -------------------------------------------------------------------- */
+
+static lwrb_t bench_lwrb;
+static uint8_t lwrb_data[BENCH_BUF_SIZE];
+
+static void lwrb_setup(void *arg) {
+  (void)arg;
+  lwrb_init(&bench_lwrb, lwrb_data, sizeof(lwrb_data));
+}
+
+static void bench_lwrb_rw(uint32_t iters, void *arg) {
+  size_t len = (size_t)(uintptr_t)arg;
+  while (iters--) {
+    lwrb_write(&bench_lwrb, bench_buf, len);
+    lwrb_read(&bench_lwrb, bench_rbuf, len);
+  }
+}
+
+/* lfbb -------------------------------------------------------------------- */
+
+static LFBB_Inst_Type bench_lfbb;
+static uint8_t lfbb_data[BENCH_BUF_SIZE];
+
+static void lfbb_setup(void *arg) {
+  (void)arg;
+  LFBB_Init(&bench_lfbb, lfbb_data, sizeof(lfbb_data));
+}
+
+static void bench_lfbb_rw(uint32_t iters, void *arg) {
+  size_t len = (size_t)(uintptr_t)arg, avail;
+  while (iters--) {
+    uint8_t *w = LFBB_WriteAcquire(&bench_lfbb, len);
+    if (w != NULL) {
+      memcpy(w, bench_buf, len);
+      LFBB_WriteRelease(&bench_lfbb, len);
+    }
+    uint8_t *r = LFBB_ReadAcquire(&bench_lfbb, &avail);
+    if (r != NULL) {
+      memcpy(bench_rbuf, r, avail);
+      LFBB_ReadRelease(&bench_lfbb, avail);
+    }
+  }
+}
+
+/* json -------------------------------------------------------------------- */
+
+// 类似设备配置/上报报文的JSON文档
+static const char json_doc[] =
+    "{\"device\":\"sensor-node\",\"fw\":\"1.4.2\",\"uptime\":123456,"
+    "\"net\":{\"ssid\":\"lab\\n2.4G\",\"rssi\":-61,\"dhcp\":true,"
+    "\"ip\":\"192.168.1.42\"},\"items\":["
+    "{\"id\":0,\"name\":\"ch0\",\"value\":0.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":1,\"name\":\"ch1\",\"value\":37.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":2,\"name\":\"ch2\",\"value\":74.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":3,\"name\":\"ch3\",\"value\":111.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":4,\"name\":\"ch4\",\"value\":148.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":5,\"name\":\"ch5\",\"value\":185.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":6,\"name\":\"ch6\",\"value\":222.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":7,\"name\":\"ch7\",\"value\":259.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":8,\"name\":\"ch8\",\"value\":296.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":9,\"name\":\"ch9\",\"value\":333.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":10,\"name\":\"ch10\",\"value\":370.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":11,\"name\":\"ch11\",\"value\":407.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":12,\"name\":\"ch12\",\"value\":444.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":13,\"name\":\"ch13\",\"value\":481.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":14,\"name\":\"ch14\",\"value\":518.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    ",{\"id\":15,\"name\":\"ch15\",\"value\":555.25,\"unit\":\"mV\","
+    "\"tags\":[\"adc\",\"raw\"],\"ok\":true,\"err\":null}"
+    "]}";
+
+static void bench_json_validate(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    BENCH_KEEP(json_validn(json_doc, sizeof(json_doc) - 1));
+  }
+}
+
+static void bench_json_get(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {  // 取最后一个对象的字段, 需要扫描整个文档
+    struct json j = json_getn(json_doc, sizeof(json_doc) - 1,
+                              "items.15.value");
+    BENCH_KEEP(json_double(j));
+  }
+}
+
+// Exported Variables -----------------------
+
+#define _RW_CASE(_name, _func, _setup, _teardown, _len)              \
+  BENCH_CASE_EX(_name, _func, _setup, _teardown, (void *)(_len), _len, \
+                "B")
+
+static const bench_case_t datastruct_cases[] = {
+    BENCH_CASE_EX("ulist/append", bench_ulist_append, ulist_setup,
+                  ulist_teardown, NULL, 1, "op"),
+    BENCH_CASE_EX("ulist/insert_head_256", bench_ulist_insert, ulist_setup,
+                  ulist_teardown, NULL, 1, "op"),
+    BENCH_CASE_EX("ulist/sort_1024", bench_ulist_sort, ulist_setup,
+                  ulist_teardown, NULL, BENCH_LIST_LEN, "item"),
+    BENCH_CASE_EX("udict/get_64", bench_udict_get, udict_setup,
+                  udict_teardown, NULL, 1, "op"),
+    BENCH_CASE_EX("udict/set_64", bench_udict_set, udict_setup,
+                  udict_teardown, NULL, 1, "op"),
+    _RW_CASE("lfifo/rw_64", bench_lfifo_rw, lfifo_setup, lfifo_teardown, 64),
+    _RW_CASE("lfifo/rw_1024", bench_lfifo_rw, lfifo_setup, lfifo_teardown,
+             1024),
+    _RW_CASE("lwrb/rw_64", bench_lwrb_rw, lwrb_setup, NULL, 64),
+    _RW_CASE("lwrb/rw_1024", bench_lwrb_rw, lwrb_setup, NULL, 1024),
+    _RW_CASE("lfbb/rw_64", bench_lfbb_rw, lfbb_setup, NULL, 64),
+    _RW_CASE("lfbb/rw_1024", bench_lfbb_rw, lfbb_setup, NULL, 1024),
+    BENCH_CASE("json/validate", bench_json_validate, sizeof(json_doc) - 1,
+               "B"),
+    BENCH_CASE("json/get_path", bench_json_get, 1, "op"),
+};
+
+const bench_group_t bench_group_datastruct =
+    BENCH_GROUP("datastruct", datastruct_cases);
+
+#endif  // BENCH_CFG_GROUP_DATASTRUCT
@@ -0,0 +1,789 @@
+/**
+ * @file bench_graphics.c
+ * @brief 图形模块基准测试用例(virtual_lcd/hagl/帧缓冲/模糊/easy_ui)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-25
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "bench.h"
+
+#if BENCH_CFG_GROUP_GRAPHICS
+#include "bench_jpeg.h"
+#include "easy_ui.h"
+#include "font6x9.h"
+#include "font6x9_atlas.h"
+#include "fastGaussian.h"
+#include "fontx.h"
+#include "hagl.h"
+#include "hagl/image.h"
+#include "hagl_tjpgd.h"
+#include "virtual_lcd.h"
+
+// Private Defines --------------------------
+
+#define BENCH_LCD_W 240
+#define BENCH_LCD_H 240
+#define BENCH_LCD_BYTES (BENCH_LCD_W * BENCH_LCD_H * 2)  // RGB565
+
+#define C_BG 0x18E3
+#define C_BG_ALT 0x2124
+#define C_HEADER 0x2945
+#define C_CARD 0x3186
+#define C_SELECT 0x03EF
+#define C_TEXT 0xFFFF
+#define C_TRACK 0x4208
+#define C_FILL 0x07E0
+
+enum {  // 典型UI更新场景, 每次迭代在A/B两帧之间切换
+  UI_RAW_FULL,     // 基准: draw_data发送整帧
+  UI_STATIC,       // 画面不变
+  UI_LABEL,        // 标题栏数字变化
+  UI_PROGRESS,     // 进度条增长
+  UI_LIST_SELECT,  // 列表选中项移动
+  UI_THEME,        // 背景色切换
+};
+
+#define BENCH_TEXT_COLS 40  // 6x9字体在240x240上的一页文本
+#define BENCH_TEXT_ROWS 26
+
+enum {  // 文本渲染方式
+  TEXT_LEGACY,  // 逐字展开为颜色位图后按掩码色逐像素blit(原实现)
+  TEXT_SPAN,    // hagl_put_text: 置位比特游程直接画hline
+  TEXT_CACHED,  // 从字形缓存取颜色位图, 不透明blit
+};
+
+#define BENCH_GLYPH_ALL 1293  // font6x9的字形数(不含填充块)
+
+enum {  // 字形查找的码点集合, 低位为是否使用预烘焙图集
+  GLYPH_ASCII = 0 << 1,  // 整页文本中的ASCII字符
+  GLYPH_ALL = 1 << 1,    // 字体中的所有码点(块表靠后的码点更慢)
+};
+
+enum {  // JPEG解码输出方式
+  JPEG_LEGACY,  // 每个MCU转为RGB565后包装为位图hagl_blit(原hagl_load_image)
+  JPEG_STREAM,  // hagl_load_image_mem: MCU直接转换到帧缓冲
+};
+
+#define JPEG_ARG(_image, _mode, _scale) \
+  (void *)(uintptr_t)(((_image) << 8) | ((_mode) << 4) | (_scale))
+
+enum {  // 模糊算法
+  BLUR_NAIVE,  // 基准: 逐像素(2r+1)^2窗口求均值
+  BLUR_BOX3,   // FastGaussianBlur_RGB565
+  BLUR_WHITE,  // 同上, 白色输入, Extra为RGB565/RGB888输出中不是白色的像素数
+};
+
+#define BENCH_UI_ITEMS 24    // easy_ui菜单项数(超过一屏)
+#define BENCH_UI_TIMER 10    // EasyUI调用间隔(ms)
+#define BENCH_UI_ACT_EVERY 8  // 滚动用例每8帧下移一项
+
+enum {  // easy_ui场景, 低位为是否增量刷新
+  EUI_IDLE = 0 << 1,
+  EUI_SCROLL = 1 << 1,
+};
+
+#define BENCH_MONO_W 128  // easy_ui背景虚化用的单色屏(SSD1306类)
+#define BENCH_MONO_H 64
+
+// 背景虚化用例参数: 帧缓冲格式(EasyUIFbFormat_e), 低位为是否提供getFramebuffer
+#define MONO_ARG(_format, _fb) (void *)(uintptr_t)(((_format) << 1) | (_fb))
+
+#define BLUR_ARG(_method, _size, _radius) \
+  (void *)(uintptr_t)(((_size) << 20) | ((_method) << 16) | (_radius))
+
+// Private Variables ------------------------
+
+static uint16_t ui_frames[2][BENCH_LCD_W * BENCH_LCD_H];
+static hagl_backend_t *display;
+static char text_page[BENCH_TEXT_ROWS][BENCH_TEXT_COLS + 1];
+static wchar_t glyph_codes[BENCH_GLYPH_ALL];
+static uint16_t glyph_num;
+static const struct {
+  const uint8_t *data;
+  uint32_t size;
+} jpeg_images[] = {
+    {bench_jpeg_420, sizeof(bench_jpeg_420)},
+    {bench_jpeg_444, sizeof(bench_jpeg_444)},
+};
+static struct {
+  const uint8_t *data;
+  uint32_t size;
+  uint32_t offset;
+} jpeg_input;
+
+// Private Functions ------------------------
+
+#if MOD_HOST_PORT  // 主机上只统计字节数, 目标板使用用户的发送函数
+void vlcd_send_data_handler(uint8_t *data, uint32_t length) {
+  (void)data;
+  (void)length;
+}
+#endif
+
+static void fill_rect(uint16_t *fb, uint16_t x, uint16_t y, uint16_t w,
+                      uint16_t h, uint16_t color) {
+  for (uint16_t i = y; i < y + h; i++) {
+    for (uint16_t j = x; j < x + w; j++) fb[i * BENCH_LCD_W + j] = color;
+  }
+}
+
+static void draw_text(uint16_t *fb, uint16_t x, uint16_t y, const char *str,
+                      uint16_t color) {
+  for (; *str; str++, x += 8) {  // 8x12字符格, 以哈希生成类似字形的点阵
+    for (uint16_t i = 0; i < 12; i++) {
+      for (uint16_t j = 0; j < 6; j++) {
+        uint32_t h = (uint32_t)*str * 2654435761u ^ (i * 97 + j * 13);
+        if (((h * 2246822519u) >> 29) < 3) {
+          fb[(y + i) * BENCH_LCD_W + x + j] = color;
+        }
+      }
+    }
+  }
+}
+
+static void ui_render(uint16_t *fb, uint8_t scene, uint8_t state) {
+  char buf[16];
+  uint8_t b = state && scene == UI_THEME;
+  fill_rect(fb, 0, 0, BENCH_LCD_W, BENCH_LCD_H, b ? C_BG_ALT : C_BG);
+  fill_rect(fb, 0, 0, BENCH_LCD_W, 32, C_HEADER);
+  draw_text(fb, 8, 10, "Settings", C_TEXT);
+  snprintf(buf, sizeof(buf), "%02d:%02d", 12,
+           state && scene == UI_LABEL ? 35 : 34);
+  draw_text(fb, 188, 10, buf, C_TEXT);
+  uint8_t sel = state && scene == UI_LIST_SELECT ? 1 : 0;
+  static const char *items[] = {"Display", "Network", "Sound", "About"};
+  for (uint8_t i = 0; i < 4; i++) {
+    fill_rect(fb, 8, 40 + i * 44, 224, 38, i == sel ? C_SELECT : C_CARD);
+    draw_text(fb, 16, 53 + i * 44, items[i], C_TEXT);
+  }
+  uint16_t fill = state && scene == UI_PROGRESS ? 108 : 100;
+  fill_rect(fb, 16, 220, 208, 8, C_TRACK);
+  fill_rect(fb, 16, 220, fill, 8, C_FILL);
+}
+
+static void ui_setup(void *arg) {
+  uint8_t scene = (uint8_t)(uintptr_t)arg;
+  ui_render(ui_frames[0], scene, 0);
+  ui_render(ui_frames[1], scene, 1);
+  vlcd_init_screen(BENCH_LCD_W, BENCH_LCD_H, VLCD_COLORFORMAT_RGB565,
+                   VLCD_ROTATE_0, 0);
+#if VLCD_CFG_ENABLE_DELTA
+  vlcd_delta_draw(0, 0, BENCH_LCD_W, BENCH_LCD_H, (uint8_t *)ui_frames[1]);
+#endif
+}
+
+static void bench_vlcd(uint32_t iters, void *arg) {
+  uint8_t scene = (uint8_t)(uintptr_t)arg;
+  uint64_t bytes = 0;
+  for (uint32_t i = 0; i < iters; i++) {
+    uint8_t *frame = (uint8_t *)ui_frames[i & 1];
+#if VLCD_CFG_ENABLE_DELTA
+    if (scene != UI_RAW_FULL) {
+      bytes += vlcd_delta_draw(0, 0, BENCH_LCD_W, BENCH_LCD_H, frame);
+      continue;
+    }
+#endif
+    (void)scene;
+    vlcd_draw_data(0, 0, BENCH_LCD_W, BENCH_LCD_H, frame, BENCH_LCD_BYTES);
+    bytes += 15 + BENCH_LCD_BYTES;  // 包头+区域+数据
+  }
+  Bench_SetExtra((double)bytes / iters, "B/frame");
+}
+
+/* hagl ------------------------------------------------------------------- */
+
+static void text_setup(void *arg) {
+  (void)arg;
+  static const char words[] =
+      "the quick brown fox jumps over lazy dog 0123456789";
+  display = hagl_init();
+  for (uint8_t i = 0; i < BENCH_TEXT_ROWS; i++) {
+    for (uint8_t j = 0; j < BENCH_TEXT_COLS; j++) {
+      text_page[i][j] = words[(i * 7 + j) % (sizeof(words) - 1)];
+    }
+    text_page[i][BENCH_TEXT_COLS] = '\0';
+  }
+  hagl_glyph_cache_clear();
+}
+
+static void legacy_put_char(char code, int16_t x0, int16_t y0,
+                            hagl_color_t color) {
+  static hagl_color_t buffer[6 * 9];
+  hagl_bitmap_t bitmap;
+  fontx_glyph_t glyph;
+  if (fontx_glyph(&glyph, code, font6x9) != 0) return;
+  hagl_bitmap_init(&bitmap, glyph.width, glyph.height, display->depth,
+                   (uint8_t *)buffer);
+  hagl_color_t *ptr = buffer;
+  for (uint8_t y = 0; y < glyph.height; y++) {
+    for (uint8_t x = 0; x < glyph.width; x++) {
+      uint8_t set = glyph.buffer[x / 8] & (0x80 >> (x % 8));
+      *(ptr++) = set ? color : ~color;
+    }
+    glyph.buffer += glyph.pitch;
+  }
+  hagl_blit_mask(display, x0, y0, &bitmap, ~color);
+}
+
+static void bench_text(uint32_t iters, void *arg) {
+  uint8_t mode = (uint8_t)(uintptr_t)arg;
+  const hagl_color_t color = 0xFFFF;
+  while (iters--) {
+    for (uint8_t i = 0; i < BENCH_TEXT_ROWS; i++) {
+      int16_t y = i * 9;
+      if (mode == TEXT_SPAN) {
+        hagl_put_text(display, text_page[i], 0, y, color, font6x9);
+        continue;
+      }
+      for (uint8_t j = 0; j < BENCH_TEXT_COLS; j++) {
+        if (mode == TEXT_LEGACY) {
+          legacy_put_char(text_page[i][j], j * 6, y, color);
+        } else {
+          const hagl_bitmap_t *bmp =
+              hagl_get_glyph_cached(display, text_page[i][j], color, font6x9);
+          if (bmp) hagl_blit(display, j * 6, y, (hagl_bitmap_t *)bmp);
+        }
+      }
+    }
+  }
+  if (mode == TEXT_CACHED) {
+    uint32_t hits, misses;
+    hagl_glyph_cache_stats(&hits, &misses);
+    Bench_SetExtra(hits * 100.0 / (hits + misses), "% hit");
+  }
+}
+
+static void glyph_setup(void *arg) {
+  uint8_t set = (uintptr_t)arg & ~1;
+  glyph_num = 0;
+  if (set == GLYPH_ASCII) {
+    text_setup(NULL);
+    for (uint8_t i = 0; i < BENCH_TEXT_ROWS; i++) {
+      for (uint8_t j = 0; j < BENCH_TEXT_COLS; j++) {
+        glyph_codes[glyph_num++] = text_page[i][j];
+      }
+    }
+  } else {  // 遍历块表, 码点按块表顺序排列
+    const uint8_t *block = &font6x9[FONTX_BLOCK_TABLE_START];
+    for (uint8_t i = 0; i < font6x9[FONTX_BLOCK_TABLE_SIZE]; i++, block += 4) {
+      uint16_t sb = block[0] | block[1] << 8;
+      uint16_t eb = block[2] | block[3] << 8;
+      if (sb == 0xFFFF) continue;  // 填充块
+      for (uint32_t c = sb; c <= eb && glyph_num < BENCH_GLYPH_ALL; c++) {
+        glyph_codes[glyph_num++] = c;
+      }
+    }
+  }
+  if ((uintptr_t)arg & 1) {  // 与FONTX2逐字节比较
+    uint16_t diff = 0;
+    fontx_glyph_t a, b;
+    for (uint16_t i = 0; i < glyph_num; i++) {
+      uint8_t ra = fontx_glyph(&a, glyph_codes[i], font6x9);
+      uint8_t rb = fontx_glyph(&b, glyph_codes[i], FONTX_ATLAS(font6x9_atlas));
+      if (ra != rb || (!ra && memcmp(a.buffer, b.buffer, a.size))) diff++;
+    }
+    Bench_SetExtra(diff, "diff");
+  }
+}
+
+static void bench_glyph(uint32_t iters, void *arg) {
+  const uint8_t *font =
+      (uintptr_t)arg & 1 ? FONTX_ATLAS(font6x9_atlas) : font6x9;
+  fontx_glyph_t glyph;
+  uint32_t sum = 0;
+  while (iters--) {
+    for (uint16_t i = 0; i < glyph_num; i++) {
+      if (!fontx_glyph(&glyph, glyph_codes[i], font)) sum += *glyph.buffer;
+    }
+  }
+  BENCH_KEEP(sum);
+}
+
+static void fb_draw_ui(uint8_t frame, uint8_t full) {
+  char buf[16];
+  if (full) {
+    hagl_fill_rectangle(display, 0, 0, 239, 239, C_BG);
+    hagl_fill_rectangle(display, 0, 0, 239, 31, C_HEADER);
+    hagl_put_text(display, "Settings", 8, 10, C_TEXT, font6x9);
+    for (uint8_t i = 0; i < 4; i++) {
+      hagl_fill_rounded_rectangle(display, 8, 40 + i * 44, 231, 77 + i * 44,
+                                  6, C_CARD);
+      hagl_put_text(display, text_page[i], 16, 53 + i * 44, C_TEXT,
+                    font6x9);
+    }
+  }
+  // 时钟标签和进度条每帧变化
+  snprintf(buf, sizeof(buf), "12:%02u", frame % 60);
+  hagl_fill_rectangle(display, 188, 10, 231, 19, C_HEADER);
+  hagl_put_text(display, buf, 188, 10, C_TEXT, font6x9);
+  hagl_fill_rectangle(display, 16, 220, 223, 227, C_TRACK);
+  hagl_fill_rectangle(display, 16, 220, 16 + frame % 208, 227, C_FILL);
+}
+
+static void fb_setup(void *arg) {
+  text_setup(arg);
+  fb_draw_ui(0, 1);
+  hagl_flush(display);
+}
+
+static void fb_teardown(void *arg) {
+  (void)arg;
+#if MOD_HOST_PORT  // 设置MODULE_BENCH_PPM=path时导出最后一帧
+  const char *path = getenv("MODULE_BENCH_PPM");
+  if (path != NULL) hagl_hal_dump_ppm(path);
+#endif
+}
+
+static void bench_fb_frame(uint32_t iters, void *arg) {
+  uint8_t full = (uint8_t)(uintptr_t)arg;
+  uint64_t bytes = 0;
+  for (uint32_t i = 0; i < iters; i++) {
+    fb_draw_ui(i, full);
+    bytes += hagl_flush(display);
+  }
+  Bench_SetExtra((double)bytes / iters, "B/frame");
+}
+
+static uint16_t jpeg_read(JDEC *jd, uint8_t *buf, uint16_t size) {
+  (void)jd;
+  if (size > jpeg_input.size - jpeg_input.offset) {
+    size = jpeg_input.size - jpeg_input.offset;
+  }
+  if (buf != NULL) memcpy(buf, jpeg_input.data + jpeg_input.offset, size);
+  jpeg_input.offset += size;
+  return size;
+}
+
+static uint16_t legacy_jpeg_write(JDEC *jd, void *bitmap, JRECT *rect) {
+  (void)jd;
+  uint16_t w = rect->right - rect->left + 1;
+  uint16_t h = rect->bottom - rect->top + 1;
+  hagl_bitmap_t block = {.width = w,
+                         .height = h,
+                         .depth = display->depth,
+                         .pitch = w * (display->depth / 8),
+                         .size = w * (display->depth / 8) * h,
+                         .buffer = (uint8_t *)bitmap};
+  hagl_blit(display, rect->left, rect->top, &block);
+  return 1;
+}
+
+static void jpeg_decode(uint8_t image, uint8_t mode, uint8_t scale) {
+  if (mode == JPEG_STREAM) {
+    hagl_load_image_mem(display, 0, 0, scale, jpeg_images[image].data,
+                        jpeg_images[image].size);
+    return;
+  }
+  static uint8_t work[3100];
+  JDEC jd;
+  jpeg_input.data = jpeg_images[image].data;
+  jpeg_input.size = jpeg_images[image].size;
+  jpeg_input.offset = 0;
+  if (jd_prepare(&jd, jpeg_read, work, sizeof(work), NULL) == JDR_OK) {
+    jd_decomp(&jd, legacy_jpeg_write, scale);
+  }
+}
+
+static void jpeg_setup(void *arg) {
+  uint8_t image = (uintptr_t)arg >> 8;
+  uint8_t mode = ((uintptr_t)arg >> 4) & 0xF;
+  uint8_t scale = (uintptr_t)arg & 0xF;
+  display = hagl_init();
+  if (mode == JPEG_LEGACY) return;
+  // 与原实现的输出逐像素比较
+  hagl_clear(display);
+  jpeg_decode(image, JPEG_LEGACY, scale);
+  memcpy(ui_frames[0], display->buffer, BENCH_LCD_BYTES);
+  hagl_clear(display);
+  jpeg_decode(image, JPEG_STREAM, scale);
+  const uint16_t *out = (const uint16_t *)display->buffer;
+  uint32_t diff = 0;
+  for (uint32_t i = 0; i < BENCH_LCD_W * BENCH_LCD_H; i++) {
+    diff += out[i] != ui_frames[0][i];
+  }
+  Bench_SetExtra(diff, "diff px");
+}
+
+static void bench_jpeg(uint32_t iters, void *arg) {
+  uint8_t image = (uintptr_t)arg >> 8;
+  uint8_t mode = ((uintptr_t)arg >> 4) & 0xF;
+  uint8_t scale = (uintptr_t)arg & 0xF;
+  while (iters--) {
+    jpeg_decode(image, mode, scale);
+  }
+  hagl_flush(display);
+}
+
+static void blur_setup(void *arg) {
+  uint32_t a = (uint32_t)(uintptr_t)arg;
+  int size = a >> 20, method = (a >> 16) & 0xF, radius = a & 0xFFFF;
+  uint32_t seed = 0x12345678;
+  if (method != BLUR_WHITE) {
+    for (uint32_t i = 0; i < BENCH_LCD_W * BENCH_LCD_H; i++) {
+      seed = seed * 1664525 + 1013904223;
+      ui_frames[0][i] = seed >> 16;
+    }
+    return;
+  }
+  // 大半径时饱和通道的定点均值不能超出通道最大值(RGB888会由白变黑)
+  uint32_t diff = 0;
+  uint8_t *rgb = (uint8_t *)ui_frames[1];
+  const int rgb_size = 160;  // 160x160x3字节, 放得进ui_frames[1]
+  for (uint32_t i = 0; i < BENCH_LCD_W * BENCH_LCD_H; i++) {
+    ui_frames[0][i] = 0xFFFF;
+  }
+  memset(rgb, 0xFF, rgb_size * rgb_size * 3);
+  FastGaussianBlur_RGB565(ui_frames[0], size, size, size * 2, radius);
+  FastGaussianBlur_RGB888(rgb, rgb_size, rgb_size, rgb_size * 3, radius);
+  for (int i = 0; i < size * size; i++) diff += ui_frames[0][i] != 0xFFFF;
+  for (int i = 0; i < rgb_size * rgb_size; i++) {
+    diff += rgb[i * 3] != 0xFF || rgb[i * 3 + 1] != 0xFF ||
+            rgb[i * 3 + 2] != 0xFF;
+  }
+  Bench_SetExtra(diff, "diff px");
+}
+
+static void blur_naive(const uint16_t *src, uint16_t *dst, int size, int r) {
+  for (int y = 0; y < size; y++) {
+    for (int x = 0; x < size; x++) {
+      uint32_t sr = 0, sg = 0, sb = 0, cnt = 0;
+      for (int j = y - r; j <= y + r; j++) {
+        if (j < 0 || j >= size) continue;
+        for (int i = x - r; i <= x + r; i++) {
+          if (i < 0 || i >= size) continue;
+          uint16_t c = src[j * size + i];
+          sr += c >> 11;
+          sg += (c >> 5) & 0x3F;
+          sb += c & 0x1F;
+          cnt++;
+        }
+      }
+      dst[y * size + x] = (sr / cnt) << 11 | (sg / cnt) << 5 | (sb / cnt);
+    }
+  }
+}
+
+static void bench_blur(uint32_t iters, void *arg) {
+  uint32_t a = (uint32_t)(uintptr_t)arg;
+  int size = a >> 20, method = (a >> 16) & 0xF, radius = a & 0xFFFF;
+  while (iters--) {
+    if (method == BLUR_NAIVE) {
+      blur_naive(ui_frames[0], ui_frames[1], size, radius);
+    } else {
+      FastGaussianBlur_RGB565(ui_frames[0], size, size, size * 2, radius);
+    }
+    BENCH_KEEP(ui_frames);
+  }
+}
+
+/* easy_ui ---------------------------------------------------------------- */
+
+static uint64_t eui_pixels;  // 发送到屏幕的像素数
+static EasyUIPage_t eui_page;
+static EasyUIItem_t eui_items[BENCH_UI_ITEMS];
+static bool eui_flags[BENCH_UI_ITEMS];
+static uiParamType eui_params[BENCH_UI_ITEMS];
+static char eui_titles[BENCH_UI_ITEMS][16];
+
+static void eui_nop(void) {}
+
+static void eui_show_str(uint16_t x, uint16_t y, char *str, uint16_t color) {
+  hagl_put_text(display, str, x, y, color, font6x9);
+}
+
+static void eui_show_float(uint16_t x, uint16_t y, uiParamType dat,
+                           uint8_t num, uint8_t point, uint16_t color) {
+  char str[20];
+  snprintf(str, sizeof(str), "%*.*f", num, point, dat);
+  hagl_put_text(display, str, x, y, color, font6x9);
+}
+
+static void eui_draw_point(uint16_t x, uint16_t y, uint16_t color) {
+  hagl_put_pixel(display, x, y, color);
+}
+
+static void eui_draw_frame(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                           uint16_t color) {
+  hagl_draw_rectangle_xywh(display, x, y, w, h, color);
+}
+
+static void eui_draw_rframe(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                            uint16_t color, uint16_t r) {
+  hagl_draw_rounded_rectangle_xywh(display, x, y, w, h, r, color);
+}
+
+static void eui_draw_box(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                         uint16_t color) {
+  hagl_fill_rectangle_xywh(display, x, y, w, h, color);
+}
+
+static void eui_draw_rbox(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                          uint16_t color, uint16_t r) {
+  hagl_fill_rounded_rectangle_xywh(display, x, y, w, h, r, color);
+}
+
+static void eui_draw_circle(uint16_t x, uint16_t y, uint16_t r,
+                            uint16_t color) {
+  hagl_fill_circle(display, x, y, r, color);
+}
+
+static void eui_xor_region(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  (void)x;  // hagl无异或绘制, 不影响刷新区域的统计
+  (void)y;
+  (void)w;
+  (void)h;
+}
+
+static void eui_clear(void) { hagl_clear(display); }
+
+static void eui_flush(void) { eui_pixels += BENCH_LCD_W * BENCH_LCD_H; }
+
+static void eui_flush_region(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  (void)x;
+  (void)y;
+  eui_pixels += (uint32_t)w * h;
+}
+
+static void eui_setup(void *arg) {
+  static uint8_t created = 0;
+  text_setup(NULL);
+  EasyUIDriver_t driver = {
+      .width = BENCH_LCD_W,
+      .height = BENCH_LCD_H,
+      .font_width = 6,
+      .font_height = 9,
+      .color = C_TEXT,
+      .bgcolor = 0,
+      .init = eui_nop,
+      .showStr = eui_show_str,
+      .showFloat = eui_show_float,
+      .drawPoint = eui_draw_point,
+      .drawFrame = eui_draw_frame,
+      .drawRFrame = eui_draw_rframe,
+      .drawBox = eui_draw_box,
+      .drawRBox = eui_draw_rbox,
+      .drawCircle = eui_draw_circle,
+      .enableXorRegion = eui_xor_region,
+      .disableXorRegion = eui_nop,
+      .clear = eui_clear,
+      .flush = eui_flush,
+      .flushRegion = eui_flush_region,
+  };
+  if (!created) {  // 页面链表为全局状态, 只创建一次
+    EasyUIAddPage(&eui_page, PAGE_LIST, NULL);
+    EasyUIAddItem(&eui_items[0], &eui_page, ITEM_PAGE_DESCRIPTION, "Bench");
+    for (uint8_t i = 1; i < BENCH_UI_ITEMS; i++) {
+      snprintf(eui_titles[i], sizeof(eui_titles[i]), "Option %u", i);
+      if (i % 2) {
+        EasyUIAddItem(&eui_items[i], &eui_page, ITEM_SWITCH, eui_titles[i],
+                      &eui_flags[i], NULL);
+      } else {
+        EasyUIAddItem(&eui_items[i], &eui_page, ITEM_VALUE_EDITOR,
+                      eui_titles[i], &eui_params[i], 100.0, 0.0, 2, NULL);
+      }
+    }
+    created = 1;
+  }
+  EasyUIInit(driver);
+  uiIncrementalRedraw = (uintptr_t)arg & 1;
+  for (uint8_t i = 0; i < 20; i++) EasyUI(BENCH_UI_TIMER);  // 进入稳定状态
+}
+
+/* easy_ui 1bpp ----------------------------------------------------------- */
+
+static uint8_t mono_buf[BENCH_MONO_W * BENCH_MONO_H / 8];
+static uint8_t mono_src[sizeof(mono_buf)];  // 比较用的随机初始画面
+static uint8_t mono_ref[sizeof(mono_buf)];  // drawPoint路径的结果
+static EasyUIFbFormat_e mono_format;
+static bool mono_fb;  // 是否提供帧缓冲, 否则EasyUI逐点drawPoint
+
+static void mono_draw_point(uint16_t x, uint16_t y, uint16_t color) {
+  uint8_t *p, bit;
+  if (x >= BENCH_MONO_W || y >= BENCH_MONO_H) return;
+  switch (mono_format) {
+    case UI_FB_MONO_VLSB:
+      p = &mono_buf[y / 8 * BENCH_MONO_W + x];
+      bit = 1 << (y & 7);
+      break;
+    case UI_FB_MONO_HLSB:
+      p = &mono_buf[y * (BENCH_MONO_W / 8) + x / 8];
+      bit = 0x80 >> (x & 7);
+      break;
+    default:
+      p = &mono_buf[y * (BENCH_MONO_W / 8) + x / 8];
+      bit = 1 << (x & 7);
+      break;
+  }
+  *p = color ? *p | bit : *p & ~bit;
+}
+
+static bool mono_get_framebuffer(EasyUIFramebuffer_t *fb) {
+  if (!mono_fb) return false;
+  fb->buf = mono_buf;
+  fb->stride =
+      mono_format == UI_FB_MONO_VLSB ? BENCH_MONO_W : BENCH_MONO_W / 8;
+  fb->format = mono_format;
+  return true;
+}
+
+static void mono_clear(void) { memset(mono_buf, 0, sizeof(mono_buf)); }
+
+static void mono_init(uint16_t bgcolor) {
+  EasyUIDriver_t driver = {
+      .width = BENCH_MONO_W,
+      .height = BENCH_MONO_H,
+      .font_width = 6,
+      .font_height = 9,
+      .color = !bgcolor,
+      .bgcolor = bgcolor,
+      .init = eui_nop,
+      .drawPoint = mono_draw_point,
+      .disableXorRegion = eui_nop,
+      .clear = mono_clear,
+      .flush = eui_nop,
+      .getFramebuffer = mono_get_framebuffer,
+  };
+  EasyUIInit(driver);
+}
+
+/**
+ * @brief 同一随机画面分别经drawPoint和帧缓冲虚化, 返回结果不同的字节数
+ */
+static uint32_t mono_compare(uint16_t bgcolor) {
+  uint32_t diff = 0;
+  mono_init(bgcolor);
+  srand(1);
+  for (size_t i = 0; i < sizeof(mono_src); i++) mono_src[i] = rand();
+  memcpy(mono_buf, mono_src, sizeof(mono_buf));
+  mono_fb = false;
+  EasyUIBackgroundBlur();
+  memcpy(mono_ref, mono_buf, sizeof(mono_buf));
+  memcpy(mono_buf, mono_src, sizeof(mono_buf));
+  mono_fb = true;
+  EasyUIBackgroundBlur();
+  for (size_t i = 0; i < sizeof(mono_buf); i++) {
+    diff += mono_buf[i] != mono_ref[i];
+  }
+  return diff;
+}
+
+static void mono_setup(void *arg) {
+  mono_format = (EasyUIFbFormat_e)((uintptr_t)arg >> 1);
+  // 背景色为0和1时两条路径的结果都应逐字节相同
+  uint32_t diff = mono_compare(0) + mono_compare(1);
+  mono_fb = (uintptr_t)arg & 1;
+  mono_init(0);
+  Bench_SetExtra(diff, "diff B");
+}
+
+static void bench_mono_blur(uint32_t iters, void *arg) {
+  (void)arg;
+  for (uint32_t i = 0; i < iters; i++) {
+    EasyUIBackgroundBlur();
+  }
+  BENCH_KEEP(mono_buf);
+}
+
+static void bench_easyui(uint32_t iters, void *arg) {
+  uint8_t scene = (uintptr_t)arg & ~1;
+  eui_pixels = 0;
+  for (uint32_t i = 0; i < iters; i++) {
+    if (scene == EUI_SCROLL && i % BENCH_UI_ACT_EVERY == 0) {
+      EasyUIInformAction(ACT_FORWARD);
+    }
+    EasyUI(BENCH_UI_TIMER);
+  }
+  Bench_SetExtra((double)eui_pixels / iters, "px/frame");
+}
+
+// Exported Variables -----------------------
+
+#define UI_CASE(_name, _scene)                                       \
+  BENCH_CASE_EX(_name, bench_vlcd, ui_setup, NULL, (void *)(_scene), \
+                BENCH_LCD_BYTES, "B")
+
+#define BLUR_CASE(_name, _method, _size, _radius)                   \
+  BENCH_CASE_EX(_name, bench_blur, blur_setup, NULL,                \
+                BLUR_ARG(_method, _size, _radius), (_size) * (_size), \
+                "px")
+
+#define GLYPH_CASE(_name, _set, _atlas, _work)                     \
+  BENCH_CASE_EX(_name, bench_glyph, glyph_setup, NULL,              \
+                (void *)(uintptr_t)((_set) | (_atlas)), _work, "glyph")
+
+#define JPEG_CASE(_name, _image, _mode, _scale)                   \
+  BENCH_CASE_EX(_name, bench_jpeg, jpeg_setup, NULL,              \
+                JPEG_ARG(_image, _mode, _scale), 1, "image")
+
+#define MONO_CASE(_name, _format, _fb)                               \
+  BENCH_CASE_EX(_name, bench_mono_blur, mono_setup, NULL,            \
+                MONO_ARG(_format, _fb), BENCH_MONO_W * BENCH_MONO_H, \
+                "px")
+
+#define EUI_CASE(_name, _scene, _incremental)                     \
+  BENCH_CASE_EX(_name, bench_easyui, eui_setup, NULL,             \
+                (void *)(uintptr_t)((_scene) | (_incremental)), 1, \
+                "frame")
+
+static const bench_case_t graphics_cases[] = {
+    UI_CASE("vlcd/raw_full", UI_RAW_FULL),
+#if VLCD_CFG_ENABLE_DELTA
+    UI_CASE("vlcd/delta_static", UI_STATIC),
+    UI_CASE("vlcd/delta_label", UI_LABEL),
+    UI_CASE("vlcd/delta_progress", UI_PROGRESS),
+    UI_CASE("vlcd/delta_list_select", UI_LIST_SELECT),
+    UI_CASE("vlcd/delta_theme", UI_THEME),
+#endif
+    BENCH_CASE_EX("hagl/text_page_legacy", bench_text, text_setup, NULL,
+                  (void *)TEXT_LEGACY, BENCH_TEXT_ROWS * BENCH_TEXT_COLS,
+                  "char"),
+    BENCH_CASE_EX("hagl/text_page", bench_text, text_setup, NULL,
+                  (void *)TEXT_SPAN, BENCH_TEXT_ROWS * BENCH_TEXT_COLS, "char"),
+    BENCH_CASE_EX("hagl/text_page_cached", bench_text, text_setup, NULL,
+                  (void *)TEXT_CACHED, BENCH_TEXT_ROWS * BENCH_TEXT_COLS,
+                  "char"),
+    GLYPH_CASE("hagl/glyph_ascii", GLYPH_ASCII, 0,
+               BENCH_TEXT_ROWS * BENCH_TEXT_COLS),
+    GLYPH_CASE("hagl/glyph_ascii_atlas", GLYPH_ASCII, 1,
+               BENCH_TEXT_ROWS * BENCH_TEXT_COLS),
+    GLYPH_CASE("hagl/glyph_all", GLYPH_ALL, 0, BENCH_GLYPH_ALL),
+    GLYPH_CASE("hagl/glyph_all_atlas", GLYPH_ALL, 1, BENCH_GLYPH_ALL),
+    BENCH_CASE_EX("hagl_fb/frame_full", bench_fb_frame, fb_setup, fb_teardown,
+                  (void *)1, 1, "frame"),
+    BENCH_CASE_EX("hagl_fb/frame_partial", bench_fb_frame, fb_setup,
+                  fb_teardown, (void *)0, 1, "frame"),
+    JPEG_CASE("jpeg/420_legacy", 0, JPEG_LEGACY, 0),
+    JPEG_CASE("jpeg/420_stream", 0, JPEG_STREAM, 0),
+    JPEG_CASE("jpeg/420_stream_1_2", 0, JPEG_STREAM, 1),
+    JPEG_CASE("jpeg/420_stream_1_4", 0, JPEG_STREAM, 2),
+    JPEG_CASE("jpeg/420_stream_1_8", 0, JPEG_STREAM, 3),
+    JPEG_CASE("jpeg/444_legacy", 1, JPEG_LEGACY, 0),
+    JPEG_CASE("jpeg/444_stream", 1, JPEG_STREAM, 0),
+    JPEG_CASE("jpeg/444_stream_1_8", 1, JPEG_STREAM, 3),
+    BLUR_CASE("blur/naive_r2_64", BLUR_NAIVE, 64, 2),
+    BLUR_CASE("blur/naive_r8_64", BLUR_NAIVE, 64, 8),
+    BLUR_CASE("blur/naive_r8_240", BLUR_NAIVE, 240, 8),
+    BLUR_CASE("blur/box3_r2_64", BLUR_BOX3, 64, 2),
+    BLUR_CASE("blur/box3_r8_64", BLUR_BOX3, 64, 8),
+    BLUR_CASE("blur/box3_r32_64", BLUR_BOX3, 64, 32),
+    BLUR_CASE("blur/box3_r2_240", BLUR_BOX3, 240, 2),
+    BLUR_CASE("blur/box3_r8_240", BLUR_BOX3, 240, 8),
+    BLUR_CASE("blur/box3_r32_240", BLUR_BOX3, 240, 32),
+    BLUR_CASE("blur/box3_r400_white_240", BLUR_WHITE, 240, 400),
+    EUI_CASE("easyui/idle_full", EUI_IDLE, 0),
+    EUI_CASE("easyui/idle", EUI_IDLE, 1),
+    EUI_CASE("easyui/scroll_full", EUI_SCROLL, 0),
+    EUI_CASE("easyui/scroll", EUI_SCROLL, 1),
+    MONO_CASE("easyui/blur_points", UI_FB_MONO_VLSB, 0),
+    MONO_CASE("easyui/blur_fb_vlsb", UI_FB_MONO_VLSB, 1),
+    MONO_CASE("easyui/blur_fb_hlsb", UI_FB_MONO_HLSB, 1),
+    MONO_CASE("easyui/blur_fb_hmsb", UI_FB_MONO_HMSB, 1),
+};
+
+const bench_group_t bench_group_graphics =
+    BENCH_GROUP("graphics", graphics_cases);
+
+#endif  // BENCH_CFG_GROUP_GRAPHICS
@@ -0,0 +1,2284 @@
+// Generated by gen_jpeg.py, do not edit
+// 240x240 baseline JPEG, quality 80
+
+#pragma once
+
+#include <stdint.h>
+
+static const uint8_t bench_jpeg_420[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05,
+    0x04, 0x06, 0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a,
+    0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e, 0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18,
+    0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a, 0x1b, 0x23,
+    0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29,
+    0x19, 0x1f, 0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xff,
+    0xdb, 0x00, 0x43, 0x01, 0x07, 0x07, 0x07, 0x0a, 0x08, 0x0a, 0x13, 0x0a,
+    0x0a, 0x13, 0x28, 0x1a, 0x16, 0x1a, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xff, 0xc0, 0x00, 0x11,
+    0x08, 0x00, 0xf0, 0x00, 0xf0, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01,
+    0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x1b, 0x00, 0x00, 0x02, 0x03, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x00, 0x03, 0x05, 0x04, 0x06, 0x07, 0xff, 0xc4, 0x00, 0x38,
+    0x10, 0x00, 0x02, 0x01, 0x02, 0x04, 0x03, 0x06, 0x05, 0x05, 0x00, 0x01,
+    0x04, 0x03, 0x01, 0x00, 0x00, 0x01, 0x02, 0x11, 0x00, 0x21, 0x03, 0x12,
+    0x31, 0x41, 0x04, 0x51, 0xf0, 0x05, 0x22, 0x61, 0x71, 0x81, 0xa1, 0x32,
+    0x91, 0xb1, 0xc1, 0xe1, 0x06, 0x13, 0x42, 0xd1, 0xf1, 0x52, 0x14, 0x23,
+    0x33, 0x62, 0x07, 0x43, 0x72, 0x15, 0xff, 0xc4, 0x00, 0x1c, 0x01, 0x00,
+    0x01, 0x05, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x01, 0x08,
+    0xff, 0xc4, 0x00, 0x32, 0x11, 0x00, 0x01, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x08, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
+    0x03, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x06, 0x41, 0x51, 0x13, 0x61,
+    0x71, 0x81, 0xc1, 0x14, 0x22, 0x32, 0x91, 0xa1, 0xb1, 0xd1, 0xf0, 0x15,
+    0x23, 0x42, 0xe1, 0x92, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02,
+    0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf9, 0x66, 0x1a, 0x80, 0x00, 0x64,
+    0x85, 0x2d, 0xb1, 0xb3, 0x1e, 0x75, 0x6b, 0x29, 0x52, 0x49, 0x0c, 0x60,
+    0xf7, 0x60, 0x98, 0xa0, 0x98, 0x63, 0x21, 0xb1, 0x2a, 0xc0, 0x49, 0x1b,
+    0x7f, 0x5b, 0xd5, 0xe1, 0x40, 0x99, 0x96, 0x1a, 0x77, 0xad, 0x32, 0x35,
+    0xad, 0xfc, 0x30, 0xaa, 0xb0, 0xe4, 0xb8, 0x20, 0x19, 0x02, 0x6d, 0xe3,
+    0x7f, 0x3a, 0xb0, 0x13, 0x9a, 0x0c, 0x31, 0x37, 0x11, 0xe6, 0x7e, 0x5e,
+    0x74, 0xd9, 0x0c, 0xd8, 0xc9, 0x22, 0xdf, 0xdf, 0x8e, 0xf4, 0xe1, 0x49,
+    0x46, 0x00, 0x15, 0x92, 0x6e, 0x77, 0xde, 0xfe, 0x95, 0x63, 0x1c, 0x76,
+    0x4b, 0x0e, 0x49, 0x86, 0x1c, 0xc0, 0x09, 0x30, 0x3e, 0x7d, 0x4d, 0x5c,
+    0xb2, 0x01, 0xcb, 0x04, 0x81, 0x04, 0xc4, 0x5e, 0x8a, 0x29, 0x25, 0x64,
+    0x80, 0x26, 0x44, 0xec, 0x39, 0xd3, 0xe4, 0x2c, 0x86, 0x34, 0x92, 0x24,
+    0xac, 0x7c, 0xea, 0x50, 0x16, 0x4e, 0x02, 0x8e, 0x55, 0x60, 0x65, 0x58,
+    0xe5, 0x9f, 0x88, 0x7b, 0xdf, 0x5d, 0x28, 0xaa, 0xa3, 0xcc, 0x88, 0x8d,
+    0x49, 0x31, 0x73, 0xbd, 0x08, 0x51, 0x01, 0x40, 0x19, 0x47, 0x81, 0xbf,
+    0x9f, 0x5b, 0x53, 0x8f, 0x8b, 0x29, 0xb0, 0x26, 0x49, 0x22, 0x4f, 0xa7,
+    0x5b, 0xd0, 0x5d, 0x64, 0xf3, 0x4a, 0x42, 0xa0, 0x9b, 0x88, 0x0a, 0x24,
+    0x80, 0x62, 0x89, 0x16, 0x52, 0x08, 0x17, 0x99, 0x07, 0x7a, 0x70, 0x65,
+    0x71, 0x00, 0x90, 0x4b, 0x6d, 0xcb, 0xc3, 0xde, 0x8f, 0xed, 0x90, 0x21,
+    0x8e, 0x86, 0xf7, 0x13, 0xce, 0xa2, 0xc9, 0x2d, 0x93, 0xed, 0x49, 0x93,
+    0x2a, 0xc0, 0x99, 0x8e, 0x51, 0x14, 0x5c, 0xab, 0x00, 0x09, 0x0a, 0x56,
+    0xda, 0xed, 0x34, 0x44, 0xc4, 0x41, 0x55, 0xd2, 0x63, 0x5f, 0xc5, 0x56,
+    0xa6, 0x1b, 0x33, 0x31, 0x56, 0x27, 0xd0, 0xf8, 0xd5, 0x64, 0xd3, 0xa9,
+    0x2c, 0x51, 0x1b, 0xbc, 0x20, 0x18, 0x89, 0x26, 0xdc, 0xb7, 0xa7, 0x52,
+    0xa5, 0x5f, 0x30, 0x9c, 0xbd, 0xd9, 0x23, 0x41, 0x4b, 0x2b, 0x90, 0x18,
+    0xca, 0x0c, 0xc4, 0x19, 0x8e, 0xbf, 0xaa, 0x55, 0xcc, 0x48, 0xcd, 0xde,
+    0x1b, 0x4e, 0xd5, 0x4d, 0x3d, 0x42, 0x94, 0xc4, 0x59, 0x82, 0xb3, 0x43,
+    0x4f, 0xad, 0x56, 0x15, 0xe3, 0x34, 0x00, 0x04, 0x98, 0xf9, 0x69, 0x4c,
+    0xc0, 0x12, 0x20, 0x98, 0xd5, 0x66, 0x2f, 0xeb, 0xe9, 0x44, 0xb3, 0x2b,
+    0x12, 0xc2, 0x48, 0x00, 0x48, 0xbe, 0xd3, 0x54, 0xb3, 0xd4, 0x29, 0x4c,
+    0x4b, 0x2b, 0xfb, 0x63, 0x31, 0xb0, 0x31, 0x60, 0x0c, 0x9e, 0x7e, 0x75,
+    0x19, 0x80, 0x52, 0xce, 0xe0, 0x03, 0x12, 0x49, 0xd0, 0x78, 0xc7, 0x9d,
+    0x2e, 0x3e, 0x32, 0x60, 0x29, 0x6c, 0x71, 0x7d, 0x22, 0xf2, 0x4c, 0x7f,
+    0x5d, 0x5e, 0xb1, 0x78, 0x8e, 0x21, 0xb1, 0xdd, 0xf3, 0xd9, 0x18, 0xce,
+    0x40, 0x74, 0xe5, 0x54, 0xd3, 0xd4, 0x72, 0x56, 0x94, 0x94, 0x8f, 0x9b,
+    0x5d, 0x82, 0xeb, 0xe2, 0x7b, 0x43, 0x38, 0x23, 0x09, 0x64, 0x48, 0x82,
+    0x77, 0x1d, 0x6f, 0x5c, 0x58, 0xd8, 0xaf, 0x8a, 0x63, 0x13, 0x11, 0x98,
+    0xcc, 0xe5, 0xbc, 0x1f, 0x4d, 0x28, 0x3c, 0x00, 0xc0, 0x80, 0x16, 0x01,
+    0xb7, 0x9f, 0x5f, 0x2a, 0x44, 0xb8, 0x23, 0xbb, 0x3e, 0x5f, 0x5b, 0x54,
+    0x12, 0xe2, 0x77, 0x57, 0xb1, 0x41, 0x1c, 0x5f, 0x08, 0x4e, 0xe2, 0xc0,
+    0xb1, 0x0c, 0xa4, 0xda, 0x6f, 0xed, 0x43, 0x31, 0x6c, 0x20, 0x40, 0x80,
+    0x00, 0x93, 0x1a, 0x0b, 0x69, 0x48, 0x5c, 0x12, 0x01, 0x59, 0x32, 0x26,
+    0xf6, 0xd3, 0xf3, 0x4e, 0x49, 0x25, 0x46, 0x52, 0xdb, 0x91, 0x1b, 0xf4,
+    0x69, 0x29, 0xe4, 0xb2, 0xaa, 0x57, 0x29, 0x30, 0xd7, 0x24, 0x0e, 0x7d,
+    0x7d, 0x68, 0xab, 0x90, 0x55, 0xc1, 0x64, 0xc4, 0x1a, 0x11, 0x68, 0xb5,
+    0x06, 0xba, 0x19, 0x06, 0x41, 0xb5, 0xe6, 0xa3, 0x00, 0x4c, 0x88, 0x80,
+    0x01, 0x97, 0x8e, 0x5b, 0x8a, 0x10, 0xbb, 0xb8, 0x3e, 0xd3, 0xc6, 0xc0,
+    0x28, 0x71, 0x94, 0x62, 0xe1, 0xa8, 0x81, 0x3f, 0xdf, 0xcb, 0x9d, 0x6e,
+    0xf6, 0x77, 0x15, 0x81, 0xc6, 0xb0, 0x18, 0x2c, 0x73, 0x01, 0x3f, 0xb6,
+    0xfb, 0x72, 0xd2, 0xc7, 0x4a, 0xf2, 0xf6, 0xef, 0x07, 0x8b, 0x03, 0x26,
+    0x39, 0xd2, 0x2b, 0xe2, 0x61, 0xe2, 0x17, 0x57, 0x87, 0x4b, 0xc0, 0xb4,
+    0x1d, 0x6d, 0x4b, 0x6b, 0xb2, 0x94, 0xd3, 0xe1, 0x6b, 0xb6, 0xd1, 0x7b,
+    0x8c, 0x0c, 0xb3, 0x24, 0x08, 0x89, 0xf8, 0x7a, 0x1b, 0xd5, 0x8a, 0x85,
+    0xb2, 0xa0, 0x91, 0x04, 0xdb, 0x61, 0xe3, 0x58, 0xfd, 0x91, 0xda, 0xc3,
+    0x1e, 0x30, 0xb1, 0xc0, 0x18, 0xa4, 0xc2, 0x38, 0x31, 0x98, 0xf9, 0x73,
+    0xdf, 0xc6, 0x6b, 0x70, 0xe1, 0x82, 0xc0, 0xe5, 0x82, 0x34, 0x13, 0xaf,
+    0x56, 0xab, 0x8a, 0x56, 0xb6, 0x41, 0x76, 0xa8, 0x6e, 0x05, 0x86, 0xc5,
+    0x32, 0x43, 0x08, 0x62, 0x66, 0x60, 0xca, 0xe8, 0x7a, 0x15, 0x7e, 0x1a,
+    0x95, 0x4e, 0x5f, 0xc6, 0xdf, 0xd7, 0x5a, 0xd1, 0xc3, 0x51, 0x95, 0x50,
+    0x08, 0xf0, 0x23, 0xe6, 0x3a, 0xe5, 0x57, 0x61, 0x4e, 0x61, 0x25, 0x4a,
+    0xa0, 0xfe, 0x3f, 0x9a, 0xb9, 0x86, 0x14, 0x07, 0x2f, 0x0e, 0x06, 0xc5,
+    0x43, 0x31, 0x49, 0x81, 0xbf, 0x5f, 0xdd, 0x59, 0x84, 0x8a, 0xa7, 0x32,
+    0x8c, 0xa2, 0x77, 0xd3, 0xaf, 0x1a, 0x5c, 0x39, 0x26, 0x60, 0x03, 0x23,
+    0xc4, 0xf8, 0xd5, 0xa0, 0x68, 0x42, 0x8c, 0xc0, 0x45, 0xb6, 0x31, 0xe1,
+    0xd7, 0xbd, 0x6e, 0xa3, 0x8e, 0xcb, 0x90, 0x87, 0x26, 0x20, 0x98, 0x30,
+    0x42, 0xee, 0x39, 0xf8, 0x53, 0x7e, 0xde, 0xe0, 0x8f, 0x0e, 0x71, 0x6d,
+    0xe2, 0x8f, 0xc4, 0x43, 0x00, 0x46, 0x9b, 0x9b, 0xcd, 0x4c, 0xc5, 0x17,
+    0x36, 0x61, 0xbb, 0x02, 0x6f, 0x7e, 0x5e, 0xc6, 0xa5, 0x01, 0x64, 0xf4,
+    0x61, 0xcf, 0x70, 0x6b, 0x45, 0xc9, 0x51, 0x94, 0x26, 0x1c, 0xe6, 0xb1,
+    0xdc, 0x90, 0x3d, 0x67, 0x7d, 0x29, 0x5f, 0x89, 0xc3, 0x30, 0x57, 0xbc,
+    0x41, 0x26, 0xdd, 0x7d, 0x2b, 0x9f, 0x88, 0xc6, 0xcc, 0xf7, 0x90, 0x80,
+    0xce, 0x40, 0x7c, 0xef, 0x55, 0xc8, 0xcc, 0x49, 0x0d, 0x6f, 0xf9, 0xdf,
+    0xcb, 0xeb, 0x5e, 0xdd, 0x6b, 0x68, 0xb0, 0x16, 0x80, 0x1d, 0x50, 0x6e,
+    0x7a, 0x0f, 0xca, 0xbf, 0xfe, 0xa0, 0xdc, 0xe1, 0xa8, 0x49, 0x39, 0x79,
+    0xd3, 0x1e, 0x28, 0x99, 0x24, 0x26, 0x51, 0x22, 0x74, 0xd8, 0xf9, 0xd5,
+    0x19, 0x4e, 0x73, 0x9a, 0x24, 0x8d, 0x2c, 0x2d, 0xe3, 0x50, 0xb1, 0x29,
+    0x10, 0x60, 0x1d, 0x22, 0xff, 0x00, 0xed, 0x24, 0x80, 0x55, 0xb7, 0xf1,
+    0xb4, 0xa0, 0x5b, 0x20, 0x5d, 0x67, 0x88, 0xc3, 0x66, 0x0a, 0xd0, 0xa4,
+    0x9b, 0x99, 0xb1, 0xd3, 0xfc, 0xab, 0x92, 0x06, 0x1d, 0xe0, 0x03, 0x70,
+    0xc0, 0xcf, 0xb5, 0x66, 0x2f, 0x78, 0xe6, 0x4e, 0xec, 0x81, 0x12, 0x26,
+    0xda, 0x55, 0x98, 0x78, 0x8c, 0x80, 0x13, 0xf0, 0xe8, 0x76, 0xe4, 0x3e,
+    0xe6, 0xa2, 0x54, 0x53, 0x97, 0x0b, 0xb3, 0x75, 0x06, 0xa3, 0x07, 0x6d,
+    0xb3, 0x41, 0xbf, 0x45, 0xdc, 0x40, 0xfe, 0x4e, 0x0b, 0x44, 0x9c, 0xd6,
+    0x9a, 0x46, 0xca, 0x42, 0xbb, 0x96, 0x98, 0x88, 0x9d, 0x7c, 0xfe, 0x75,
+    0x01, 0x52, 0xa0, 0xa8, 0x06, 0x74, 0xef, 0x5f, 0x95, 0xba, 0xda, 0xac,
+    0x60, 0xb9, 0x89, 0xd0, 0xeb, 0x31, 0xa5, 0xab, 0x2d, 0x53, 0x39, 0x04,
+    0x82, 0xaa, 0x5a, 0x08, 0x36, 0x29, 0x43, 0x40, 0x03, 0x10, 0x98, 0x6d,
+    0x26, 0xe4, 0xd2, 0x99, 0x70, 0x73, 0x08, 0x91, 0x70, 0x24, 0xdb, 0x69,
+    0xf9, 0x54, 0x00, 0x87, 0x23, 0x4e, 0x67, 0xf3, 0xb7, 0xe2, 0xa3, 0xa8,
+    0xef, 0x16, 0x99, 0x89, 0x0d, 0x37, 0xb5, 0xea, 0x92, 0x7a, 0x85, 0x25,
+    0x88, 0x1e, 0xfc, 0xf7, 0x8a, 0xe9, 0xf0, 0xd2, 0x62, 0xba, 0x60, 0x2b,
+    0x67, 0x76, 0x55, 0x02, 0x67, 0x4e, 0xb5, 0xe7, 0x56, 0xe2, 0x48, 0x3a,
+    0x90, 0x00, 0xf8, 0x58, 0x0d, 0x05, 0x64, 0xf6, 0xb6, 0x3c, 0x3f, 0xec,
+    0x28, 0x61, 0x94, 0xe6, 0x27, 0x50, 0x49, 0x1f, 0x9f, 0x7f, 0x0a, 0xa7,
+    0x9e, 0x75, 0x65, 0x45, 0x01, 0x9e, 0x40, 0xce, 0x5c, 0xfc, 0x17, 0x37,
+    0x15, 0xc4, 0x62, 0x63, 0xe2, 0x9c, 0x41, 0x39, 0x41, 0x05, 0x54, 0x9e,
+    0xb9, 0x0a, 0xa3, 0x33, 0x65, 0x90, 0x1b, 0x34, 0x48, 0x3e, 0x34, 0x49,
+    0x09, 0x01, 0xb3, 0x48, 0x58, 0xbc, 0x54, 0x6c, 0xc5, 0xc4, 0x13, 0x98,
+    0x03, 0x61, 0x3e, 0x7b, 0x7a, 0x54, 0x02, 0x6e, 0xb5, 0xac, 0x60, 0x60,
+    0x0d, 0x68, 0xb0, 0x08, 0x2e, 0x68, 0x63, 0xde, 0x13, 0xa4, 0x99, 0x3f,
+    0xe5, 0x1c, 0xf3, 0x05, 0x59, 0x83, 0x00, 0x60, 0x4f, 0xbf, 0x3a, 0x54,
+    0xff, 0x00, 0xc9, 0x9c, 0x88, 0x00, 0xee, 0x7c, 0x63, 0xed, 0xa7, 0x85,
+    0x31, 0x58, 0x53, 0x26, 0x0c, 0x5e, 0xc3, 0xcb, 0xaf, 0x4a, 0xf1, 0x29,
+    0x05, 0x52, 0x0a, 0xb2, 0x90, 0x49, 0x33, 0x1e, 0xbe, 0x03, 0x9d, 0x15,
+    0xcd, 0x9a, 0x04, 0x98, 0x02, 0x39, 0x0e, 0xbe, 0xd4, 0x98, 0x86, 0x20,
+    0x81, 0x16, 0x8c, 0xa7, 0xdf, 0xed, 0xf3, 0xab, 0x2c, 0x2c, 0xac, 0xa6,
+    0xdf, 0xf2, 0x83, 0xa5, 0xa8, 0x42, 0x80, 0x00, 0x04, 0x99, 0x16, 0x99,
+    0x6d, 0xae, 0x28, 0x19, 0x25, 0xa1, 0xbb, 0xc6, 0xe0, 0x72, 0xf5, 0xa8,
+    0xe3, 0x33, 0x5a, 0x60, 0x81, 0xaf, 0x7b, 0xa1, 0x42, 0x18, 0xe1, 0x9c,
+    0x80, 0x44, 0xc7, 0x8f, 0xb7, 0x9d, 0x08, 0x47, 0x28, 0x60, 0x73, 0x5e,
+    0x66, 0x2d, 0x71, 0xaf, 0x3a, 0x54, 0x50, 0x65, 0x98, 0x98, 0xca, 0x4d,
+    0xb9, 0x79, 0x53, 0x29, 0x56, 0x5f, 0x10, 0x6d, 0x6f, 0x4b, 0x49, 0xbd,
+    0x04, 0x6b, 0xaa, 0xcc, 0x31, 0x20, 0x93, 0x61, 0x6f, 0x0a, 0x10, 0x84,
+    0x10, 0x09, 0x5c, 0xb9, 0x87, 0x7b, 0x5b, 0x47, 0x9e, 0xf5, 0xec, 0x7f,
+    0x4d, 0xf6, 0x88, 0xe3, 0x70, 0xce, 0x0e, 0x29, 0x66, 0xe2, 0x30, 0xef,
+    0x9d, 0x8f, 0xfe, 0x45, 0xe7, 0x3c, 0xc4, 0xff, 0x00, 0xb7, 0xaf, 0x20,
+    0x4c, 0xb8, 0x36, 0xbc, 0x72, 0xe7, 0x06, 0xaf, 0xe0, 0xf1, 0xdb, 0x83,
+    0xe2, 0x30, 0xb1, 0x70, 0x86, 0x47, 0xc3, 0x6c, 0xc2, 0x09, 0xf9, 0x5b,
+    0x6d, 0xbd, 0x6a, 0x55, 0x25, 0x41, 0xa7, 0x90, 0x3b, 0x97, 0x34, 0xdc,
+    0xb1, 0xf6, 0x8d, 0xb2, 0xfa, 0x3a, 0xe1, 0xe5, 0x50, 0x48, 0x1f, 0xb8,
+    0x7b, 0xa3, 0x79, 0x15, 0x6a, 0x28, 0xcd, 0x24, 0x11, 0x20, 0xf7, 0x66,
+    0xc7, 0xab, 0xd2, 0x70, 0x18, 0xab, 0xc5, 0x60, 0x61, 0xe2, 0xe1, 0x13,
+    0xfb, 0x6e, 0xb3, 0xb0, 0x22, 0xd7, 0xdf, 0xc7, 0xd2, 0xba, 0x15, 0x14,
+    0xb0, 0x2c, 0x3c, 0x8c, 0x47, 0xb6, 0x9c, 0xab, 0x7b, 0x03, 0x01, 0x00,
+    0x8d, 0x95, 0x5d, 0xed, 0xa2, 0xf0, 0xab, 0x87, 0x06, 0xd2, 0x08, 0x1a,
+    0xc0, 0x32, 0x7f, 0xab, 0x55, 0xa8, 0x00, 0x50, 0x7b, 0xa5, 0x45, 0x88,
+    0x1a, 0x9f, 0x3a, 0x61, 0x86, 0x43, 0x8c, 0xad, 0xa8, 0xb5, 0xbd, 0x69,
+    0x91, 0x72, 0x85, 0x10, 0xb3, 0xa1, 0x06, 0x44, 0xdf, 0xc7, 0x9c, 0xd6,
+    0xc0, 0x0b, 0x2e, 0x44, 0x0a, 0x2a, 0xa7, 0x3a, 0xae, 0x65, 0x13, 0xc8,
+    0x7a, 0xff, 0x00, 0x55, 0xc5, 0xc5, 0xe2, 0xe7, 0xc7, 0x18, 0x6a, 0xc4,
+    0x00, 0x20, 0x45, 0x81, 0xae, 0xc7, 0x64, 0xc3, 0x4c, 0x46, 0x00, 0x15,
+    0x5d, 0x00, 0x36, 0x3d, 0x5a, 0xb3, 0x84, 0xab, 0x10, 0xa5, 0x8b, 0x0e,
+    0x64, 0xe9, 0x5e, 0xdd, 0x6b, 0x38, 0x6e, 0x94, 0x3d, 0xce, 0xa8, 0x70,
+    0xdb, 0x41, 0xe3, 0xcf, 0xf7, 0xbd, 0x42, 0x09, 0x5e, 0xf4, 0xfa, 0x1d,
+    0x0f, 0x8d, 0x4c, 0x36, 0x86, 0x02, 0x6c, 0x2d, 0xdd, 0x13, 0x16, 0xe7,
+    0x48, 0x58, 0x43, 0x3e, 0x25, 0xa7, 0x43, 0x37, 0xd3, 0xc2, 0x9c, 0xe4,
+    0xc8, 0x7e, 0x3b, 0x91, 0xbf, 0x57, 0xd2, 0x85, 0xb0, 0x40, 0x00, 0x1d,
+    0x42, 0xac, 0x8d, 0x6c, 0x6d, 0x7f, 0x2f, 0x2e, 0xb4, 0xa2, 0xc8, 0x08,
+    0x22, 0x09, 0x3c, 0xd4, 0x03, 0x1e, 0x74, 0x01, 0x16, 0x2a, 0x02, 0xc7,
+    0x7a, 0x01, 0x23, 0xaf, 0xf2, 0x9d, 0x56, 0x48, 0x82, 0x00, 0x00, 0x99,
+    0xde, 0x79, 0xd0, 0xbd, 0x4a, 0x2c, 0xc8, 0xb0, 0x49, 0xd6, 0xdc, 0xa7,
+    0xaf, 0x95, 0x44, 0x6d, 0xc1, 0x66, 0x00, 0xc0, 0xda, 0x68, 0x48, 0x39,
+    0x94, 0x32, 0xad, 0xbd, 0x08, 0xa3, 0x01, 0xd8, 0x8b, 0x00, 0xba, 0x01,
+    0xeb, 0xf8, 0xf9, 0xd0, 0xbc, 0x56, 0xf0, 0xec, 0xa9, 0x8a, 0x56, 0x32,
+    0xa9, 0xf3, 0x2d, 0x31, 0xad, 0x75, 0x80, 0x03, 0x10, 0x59, 0x8c, 0x1d,
+    0x77, 0xf9, 0x56, 0x79, 0x52, 0x54, 0x64, 0xe6, 0x75, 0x3e, 0xf5, 0xa0,
+    0x80, 0x32, 0xcb, 0x19, 0x30, 0x2e, 0x37, 0xb4, 0x68, 0x3a, 0xd6, 0xb2,
+    0x1c, 0x4b, 0x10, 0x88, 0xb6, 0x76, 0xf3, 0xd0, 0xf8, 0xfe, 0xfd, 0x95,
+    0x26, 0x27, 0x08, 0x6b, 0x84, 0x83, 0x9e, 0xe9, 0x73, 0x4e, 0x13, 0x42,
+    0x09, 0x02, 0x23, 0x41, 0xd5, 0xaa, 0x61, 0x90, 0xe2, 0xc6, 0x62, 0xe4,
+    0x01, 0x7b, 0x69, 0x44, 0x92, 0xcd, 0x79, 0x33, 0x63, 0xc8, 0x53, 0x8c,
+    0xb9, 0x66, 0x59, 0x47, 0x8e, 0xe2, 0x7c, 0x7a, 0xbd, 0x61, 0xa6, 0x9a,
+    0xea, 0x0b, 0x15, 0x4e, 0xc3, 0x0b, 0x09, 0xf1, 0x21, 0x8a, 0x84, 0x24,
+    0x91, 0xbd, 0x79, 0xec, 0xcc, 0x71, 0x1d, 0xb3, 0x4d, 0xe4, 0xf9, 0x93,
+    0x5a, 0xfd, 0xa8, 0x71, 0x07, 0x0b, 0x0b, 0xfc, 0x88, 0x02, 0x6f, 0x11,
+    0xe1, 0xe9, 0x58, 0xec, 0xd8, 0x93, 0x24, 0x41, 0x37, 0xb9, 0x1c, 0xf6,
+    0xa8, 0x25, 0xd9, 0x96, 0xa7, 0x06, 0x8a, 0xd1, 0x99, 0x3a, 0x9f, 0xb2,
+    0x40, 0x18, 0x20, 0xbe, 0x60, 0x4d, 0xca, 0x99, 0x36, 0xfa, 0xd3, 0x40,
+    0x12, 0x1e, 0x48, 0x99, 0xb9, 0xd0, 0x6b, 0xa5, 0x16, 0x00, 0x10, 0x48,
+    0x12, 0x27, 0xe5, 0xe9, 0x4a, 0xa0, 0x14, 0x1b, 0x90, 0x6d, 0xbc, 0xf3,
+    0xf3, 0xa4, 0xab, 0x94, 0x60, 0x2a, 0x92, 0xd0, 0x66, 0x09, 0xf0, 0xa0,
+    0x1a, 0x19, 0xc9, 0xcb, 0x00, 0xda, 0x05, 0xc7, 0xcf, 0xce, 0xa3, 0x31,
+    0x24, 0x94, 0x62, 0x58, 0xc7, 0x74, 0x49, 0xff, 0x00, 0x77, 0xa2, 0x07,
+    0x74, 0x4c, 0xcd, 0x89, 0x58, 0x8e, 0xb9, 0xd0, 0x84, 0xb9, 0x46, 0x58,
+    0x52, 0x03, 0x39, 0xee, 0xdc, 0xf2, 0xd7, 0xe9, 0x46, 0xd0, 0x66, 0x60,
+    0x1d, 0x0f, 0x28, 0xde, 0x89, 0x00, 0xdc, 0x65, 0xb0, 0xd0, 0x0f, 0x48,
+    0xf1, 0xa8, 0x7b, 0xe2, 0x1c, 0xcd, 0xef, 0xce, 0x3f, 0xda, 0x10, 0x81,
+    0x50, 0x66, 0xc6, 0xd1, 0x1f, 0xfa, 0xfd, 0xe8, 0x01, 0x95, 0x4e, 0x52,
+    0x72, 0x09, 0x20, 0x0b, 0xc5, 0xbf, 0xda, 0x85, 0x60, 0x41, 0x85, 0x20,
+    0xc7, 0x78, 0xcc, 0xd8, 0xd1, 0x19, 0x49, 0x04, 0x15, 0x1a, 0x4a, 0x8f,
+    0x4a, 0x10, 0xa0, 0xb2, 0xfc, 0x20, 0x91, 0xc8, 0x8b, 0x69, 0xd7, 0xa5,
+    0x10, 0xc8, 0x0a, 0x95, 0x00, 0x81, 0xb8, 0xfa, 0x73, 0xb5, 0xef, 0x53,
+    0x13, 0x3e, 0x4e, 0xf0, 0x05, 0x41, 0xf3, 0x81, 0xf2, 0xa9, 0xa0, 0xb6,
+    0x62, 0xa2, 0xda, 0x12, 0x68, 0x42, 0x07, 0x0e, 0x72, 0x98, 0x2d, 0x3a,
+    0x44, 0x5f, 0xe7, 0xd5, 0xea, 0x33, 0xcb, 0x29, 0xee, 0x08, 0xb4, 0x30,
+    0xd0, 0x6d, 0x4a, 0xa4, 0x9f, 0x00, 0x04, 0x1f, 0xbf, 0x5e, 0x74, 0xe0,
+    0x82, 0x32, 0x81, 0x22, 0x36, 0x3e, 0x3d, 0x7c, 0xe8, 0x42, 0xf6, 0x5f,
+    0xa1, 0x31, 0xce, 0x37, 0x09, 0x8b, 0xc2, 0xb1, 0xef, 0xe0, 0xbe, 0x65,
+    0x05, 0x81, 0x21, 0x5b, 0x58, 0x1c, 0x81, 0xbf, 0x9b, 0x57, 0xab, 0xc3,
+    0x8c, 0xbd, 0xeb, 0x98, 0xd2, 0x7d, 0xfe, 0x9f, 0x2a, 0xf9, 0xf7, 0xe8,
+    0xf7, 0x23, 0xb7, 0xf8, 0x70, 0xac, 0xc5, 0x5d, 0x19, 0x5f, 0x42, 0x08,
+    0xca, 0x5b, 0xea, 0x07, 0xca, 0xbe, 0x8a, 0xa0, 0x66, 0xca, 0xc0, 0x47,
+    0x88, 0xd2, 0xfb, 0x56, 0xf7, 0x00, 0x94, 0xcd, 0x48, 0x2f, 0xfe, 0x4d,
+    0xbd, 0x7d, 0x55, 0x55, 0x50, 0xcb, 0x27, 0x8a, 0xf0, 0xac, 0x90, 0xf0,
+    0x84, 0x82, 0x39, 0x6b, 0xe1, 0xf4, 0xa7, 0x87, 0x36, 0x12, 0x24, 0x40,
+    0x00, 0xcc, 0x7f, 0x54, 0xe4, 0x1f, 0xdb, 0xd8, 0x81, 0xb1, 0x5d, 0x3e,
+    0xf5, 0x18, 0x06, 0x61, 0x03, 0xbc, 0x79, 0x7c, 0xfe, 0xf5, 0xb9, 0x73,
+    0xac, 0xb8, 0xdb, 0x4a, 0xab, 0x89, 0x53, 0x87, 0x84, 0xdf, 0xc8, 0x48,
+    0x8d, 0xe2, 0xf5, 0xc0, 0x4d, 0xbe, 0x10, 0x4f, 0x81, 0x3a, 0x56, 0x8e,
+    0x30, 0x2d, 0x80, 0xea, 0x65, 0x08, 0x13, 0x01, 0x77, 0x15, 0x99, 0xdd,
+    0x79, 0x2a, 0xc0, 0x6d, 0x0d, 0xc8, 0x57, 0x8c, 0x75, 0xd6, 0xf3, 0x86,
+    0x1e, 0x0d, 0x33, 0x9b, 0xcf, 0x37, 0xa0, 0xfc, 0x25, 0x70, 0x40, 0x1a,
+    0x99, 0x88, 0x0c, 0x24, 0xf9, 0xd3, 0x66, 0x08, 0xd3, 0x60, 0xb7, 0x24,
+    0x81, 0x1b, 0xc7, 0x5f, 0x7a, 0x56, 0xb2, 0xc9, 0x06, 0x4c, 0xc7, 0x2f,
+    0x2e, 0xbf, 0xd2, 0x43, 0x18, 0xb0, 0x1e, 0x63, 0xa8, 0xb0, 0xa5, 0xad,
+    0x2a, 0x17, 0x9e, 0xf1, 0x2c, 0x2e, 0x62, 0x64, 0x6f, 0x61, 0xfe, 0x51,
+    0x58, 0x63, 0x06, 0x24, 0x98, 0x11, 0x6b, 0xc5, 0xe6, 0x3d, 0x7d, 0xe8,
+    0x07, 0x0e, 0xd9, 0x94, 0x58, 0x09, 0x83, 0x6b, 0x0e, 0x8d, 0x1c, 0xaf,
+    0xfc, 0x4c, 0xde, 0x09, 0x23, 0xaf, 0x1a, 0x17, 0x88, 0x10, 0x40, 0x42,
+    0x40, 0xb9, 0x96, 0xb5, 0xcf, 0x2a, 0x2a, 0xf2, 0x61, 0xc8, 0x11, 0x60,
+    0x4c, 0xcf, 0x8d, 0x06, 0x12, 0xbd, 0xfc, 0xc4, 0x29, 0x98, 0x13, 0xa5,
+    0x12, 0xc1, 0x50, 0x84, 0x8b, 0xee, 0x2d, 0x1e, 0x34, 0x2f, 0x54, 0x0e,
+    0xcc, 0xd2, 0x54, 0x82, 0x35, 0x91, 0x79, 0xf2, 0xdb, 0x9d, 0x75, 0xf0,
+    0x99, 0x82, 0x28, 0xbd, 0xc4, 0x75, 0xd6, 0xf5, 0xc6, 0x56, 0x64, 0x28,
+    0xcd, 0x11, 0x6d, 0x79, 0xee, 0x2b, 0x47, 0x86, 0x94, 0xc2, 0x93, 0x3d,
+    0xde, 0x66, 0x06, 0xa6, 0x6b, 0x25, 0xc6, 0x12, 0x86, 0x52, 0x31, 0xbc,
+    0xcb, 0xbe, 0xc0, 0xfe, 0x55, 0x5e, 0x28, 0xe1, 0xd9, 0xb4, 0x77, 0xa9,
+    0xdf, 0x0e, 0x16, 0x3c, 0x41, 0x26, 0xe3, 0xa8, 0xa8, 0xb9, 0x41, 0x62,
+    0x03, 0x03, 0x19, 0x6f, 0x7f, 0x9d, 0xa6, 0x99, 0x80, 0x89, 0xb2, 0x86,
+    0xf6, 0x3d, 0x1a, 0x27, 0xba, 0x5a, 0xc2, 0x24, 0x10, 0x34, 0xf2, 0xae,
+    0x64, 0xf9, 0x2e, 0xaa, 0x1a, 0x56, 0x67, 0x6c, 0xb6, 0x5c, 0x1c, 0x34,
+    0x89, 0x93, 0x3b, 0x8d, 0x2b, 0x21, 0x94, 0x85, 0x04, 0x18, 0x59, 0xb9,
+    0x3f, 0xd7, 0xb5, 0x6c, 0x76, 0xde, 0x1c, 0xe1, 0xe1, 0x63, 0x37, 0x74,
+    0xa9, 0x2b, 0x04, 0x4c, 0xce, 0xfe, 0xde, 0xf5, 0x8e, 0x2f, 0x32, 0x59,
+    0x88, 0x17, 0x12, 0x68, 0x61, 0xb8, 0x5b, 0x2c, 0x24, 0x8f, 0x65, 0x6d,
+    0xbb, 0xfe, 0xe8, 0x22, 0x86, 0xbb, 0xe6, 0xf1, 0x23, 0x41, 0xe9, 0xe9,
+    0x4c, 0x3b, 0xeb, 0x78, 0x2d, 0xcb, 0xc7, 0x4a, 0x0c, 0x57, 0xbc, 0xc0,
+    0x80, 0x36, 0x11, 0x16, 0x24, 0xe9, 0x50, 0xe6, 0x65, 0x96, 0xf8, 0x48,
+    0x13, 0x1a, 0x9d, 0x04, 0xd2, 0x95, 0x8a, 0x8c, 0x41, 0x00, 0x81, 0xdf,
+    0x9d, 0x06, 0xff, 0x00, 0x9f, 0xcd, 0x42, 0x24, 0x99, 0x56, 0x10, 0x36,
+    0x37, 0xd7, 0xaf, 0x6a, 0x8f, 0x98, 0x64, 0xd9, 0xe3, 0xf8, 0xe8, 0x7d,
+    0x69, 0xed, 0x2d, 0x3f, 0x14, 0xe8, 0x22, 0x2d, 0xad, 0x08, 0x4b, 0x30,
+    0xa6, 0xe4, 0x1b, 0x49, 0x68, 0x24, 0x7a, 0x7f, 0xb4, 0xa0, 0x85, 0xf8,
+    0x64, 0xe6, 0xef, 0x05, 0x3e, 0x7a, 0x54, 0x42, 0x72, 0xb2, 0xfc, 0x6e,
+    0x64, 0x81, 0xb7, 0xfb, 0xe1, 0x4d, 0x7b, 0x85, 0x32, 0xed, 0x73, 0x07,
+    0x41, 0xd7, 0xd6, 0x84, 0x25, 0x92, 0x5a, 0x01, 0x24, 0x88, 0x82, 0x06,
+    0xfe, 0x54, 0xec, 0x41, 0x50, 0x08, 0x00, 0x01, 0x6b, 0x7c, 0xc5, 0x23,
+    0x1e, 0xeb, 0x32, 0xd9, 0x88, 0x36, 0x8e, 0xb9, 0xd3, 0x95, 0x39, 0x92,
+    0x10, 0xc0, 0x98, 0x03, 0x63, 0xcf, 0xaf, 0x0a, 0x10, 0x95, 0xb2, 0xa1,
+    0x64, 0xdb, 0xc4, 0x03, 0xd6, 0xf4, 0x73, 0x48, 0x05, 0xc9, 0x0c, 0x44,
+    0x86, 0x8b, 0x73, 0xf5, 0xa8, 0xc8, 0xdf, 0x0a, 0x84, 0x51, 0xb7, 0x5c,
+    0xfd, 0x68, 0x61, 0xb2, 0x91, 0x18, 0x61, 0x83, 0x6a, 0x26, 0xf4, 0x21,
+    0x13, 0xf0, 0x0c, 0xaa, 0x0a, 0x88, 0x0b, 0x3b, 0x9f, 0x4d, 0x68, 0x48,
+    0x2b, 0x94, 0xdc, 0x83, 0x6b, 0x4f, 0x2f, 0xcd, 0x4c, 0x82, 0xea, 0x76,
+    0x1b, 0x81, 0xe7, 0x1e, 0x34, 0xca, 0xb2, 0x87, 0x29, 0x81, 0x10, 0x47,
+    0xac, 0xeb, 0x42, 0x17, 0x57, 0x60, 0x2b, 0x9e, 0xd7, 0xe0, 0x48, 0xd7,
+    0xfe, 0xa1, 0x04, 0x9b, 0x7f, 0x21, 0x5f, 0x5a, 0x21, 0x93, 0xe1, 0x32,
+    0xc2, 0x06, 0x53, 0xb0, 0xf2, 0xf2, 0xaf, 0x95, 0x7e, 0x9e, 0xc3, 0x66,
+    0xed, 0xce, 0x01, 0x70, 0xd5, 0x99, 0xbf, 0x79, 0x0e, 0x55, 0x13, 0xa1,
+    0x92, 0x74, 0xda, 0x09, 0xf4, 0x35, 0xf5, 0xab, 0x45, 0xd8, 0x86, 0x12,
+    0x67, 0x5a, 0xd9, 0xf0, 0xc6, 0x90, 0xc8, 0x7b, 0xfd, 0x15, 0x5d, 0x79,
+    0xf7, 0xc2, 0xf0, 0x88, 0x06, 0x21, 0x62, 0x58, 0x5f, 0x4e, 0xa3, 0xc2,
+    0x81, 0x68, 0xca, 0x60, 0x12, 0x3e, 0x28, 0xb1, 0x3c, 0xeb, 0xdd, 0xe1,
+    0xf6, 0x67, 0x03, 0x82, 0xa5, 0x53, 0x85, 0xc3, 0x3d, 0xe9, 0x2a, 0xc8,
+    0x1c, 0x81, 0xeb, 0x43, 0x1f, 0xb2, 0x38, 0x07, 0x7c, 0xf8, 0x9c, 0x2a,
+    0x03, 0xa4, 0x2c, 0xaa, 0x81, 0xe4, 0x3a, 0xb5, 0x6b, 0x5d, 0x88, 0x34,
+    0xf2, 0x5c, 0xdc, 0x70, 0xf4, 0xe0, 0x7c, 0x42, 0xfe, 0x7f, 0x85, 0xe1,
+    0x71, 0x01, 0x83, 0x02, 0x57, 0xfe, 0x53, 0x12, 0x6b, 0x2f, 0x88, 0xc3,
+    0x38, 0x7c, 0x4b, 0x21, 0x10, 0x2d, 0x94, 0x1d, 0x00, 0xb9, 0x15, 0xf4,
+    0x3e, 0x23, 0xf4, 0xef, 0x0d, 0x89, 0x86, 0xff, 0x00, 0xb4, 0xf8, 0x98,
+    0x4d, 0x68, 0x36, 0x65, 0x9f, 0x2d, 0x79, 0xef, 0xcf, 0xca, 0xb0, 0x3b,
+    0x5b, 0xf4, 0xf7, 0x18, 0xa9, 0x38, 0x61, 0x71, 0xa1, 0x88, 0xee, 0x1b,
+    0x81, 0xb5, 0xbc, 0x7c, 0x26, 0xbc, 0x86, 0xb5, 0xad, 0x7d, 0xce, 0xc5,
+    0x58, 0x61, 0x71, 0x54, 0x61, 0x93, 0x5e, 0x41, 0x76, 0x1d, 0x0d, 0xb5,
+    0xf3, 0xeb, 0xa7, 0x86, 0xc5, 0x79, 0x72, 0x4e, 0x63, 0x95, 0x41, 0x68,
+    0x8b, 0x5a, 0x07, 0x9d, 0x11, 0x79, 0x19, 0x9b, 0x31, 0x98, 0x07, 0xd7,
+    0xd3, 0x4a, 0x68, 0x38, 0x6e, 0x25, 0x58, 0x49, 0xb8, 0xdf, 0xe7, 0xfd,
+    0x55, 0x79, 0x4e, 0x59, 0xb2, 0xa7, 0x94, 0xdb, 0xcf, 0x5a, 0xb8, 0x04,
+    0x11, 0x70, 0xb6, 0x4d, 0x70, 0x70, 0xbb, 0x4d, 0xc2, 0x98, 0x63, 0x31,
+    0x0d, 0x89, 0xae, 0x8a, 0x3a, 0xf3, 0xa2, 0x15, 0x09, 0x39, 0x64, 0x81,
+    0x79, 0x8f, 0x0d, 0x3c, 0x29, 0xb3, 0x90, 0x16, 0x33, 0x30, 0xd0, 0xc4,
+    0x75, 0xfe, 0x52, 0x1b, 0x1c, 0xaa, 0xc6, 0xf6, 0xf0, 0x6d, 0xef, 0x5e,
+    0xaf, 0x51, 0x40, 0x20, 0x65, 0x02, 0x39, 0x11, 0x6d, 0x47, 0xfb, 0x50,
+    0xa8, 0x20, 0x1b, 0x49, 0xb8, 0xd6, 0x7c, 0xfa, 0xe7, 0x44, 0x0c, 0xc3,
+    0x29, 0x80, 0x34, 0x8b, 0x6b, 0xb8, 0xfa, 0xd4, 0x5c, 0x3c, 0xec, 0x15,
+    0x01, 0xb6, 0x90, 0x75, 0xb7, 0xc8, 0x52, 0x5e, 0xf6, 0xc6, 0xd2, 0xf7,
+    0x9b, 0x01, 0xcc, 0xaf, 0x1c, 0xe0, 0xd1, 0x73, 0xb2, 0xb3, 0x87, 0xc3,
+    0x67, 0xc5, 0xc9, 0x05, 0xa2, 0xec, 0x09, 0xb4, 0x7c, 0xfc, 0x6b, 0xb9,
+    0x4e, 0x41, 0x05, 0x4c, 0x9d, 0x32, 0x91, 0xf2, 0x9d, 0x69, 0x30, 0x70,
+    0x82, 0x41, 0x5b, 0xb9, 0xb1, 0x06, 0xe4, 0xf3, 0xa7, 0x54, 0x81, 0xde,
+    0x59, 0x81, 0x78, 0x1a, 0x79, 0xde, 0xb9, 0x1f, 0x11, 0x63, 0x03, 0x11,
+    0xa8, 0xfe, 0xbf, 0x81, 0xba, 0x0f, 0x53, 0xe7, 0xf6, 0x01, 0x66, 0x6b,
+    0x6a, 0xbd, 0xa2, 0x4f, 0x77, 0x61, 0xb2, 0x08, 0x86, 0x1e, 0x2e, 0x4c,
+    0x1b, 0x73, 0xbf, 0xe6, 0x9d, 0x81, 0x13, 0x0c, 0x03, 0x5f, 0x7d, 0xb7,
+    0x17, 0xa2, 0x55, 0xe6, 0x33, 0x30, 0x3a, 0x11, 0x37, 0xf0, 0xab, 0x32,
+    0x0c, 0xb0, 0x6c, 0xc6, 0x64, 0xe5, 0x37, 0xbf, 0xe2, 0xb3, 0x97, 0xba,
+    0x65, 0xa5, 0x70, 0x76, 0xce, 0x00, 0x7e, 0x01, 0x82, 0xc6, 0x64, 0x37,
+    0x83, 0x6f, 0x19, 0x1e, 0x53, 0xd0, 0xaf, 0x3c, 0x40, 0x04, 0x22, 0x18,
+    0x91, 0x22, 0x23, 0xed, 0x5e, 0xc3, 0x20, 0x6c, 0x36, 0x07, 0x2e, 0x56,
+    0x10, 0x4e, 0x6b, 0x19, 0xe8, 0xd7, 0x92, 0xc5, 0xc2, 0x3c, 0x36, 0x2b,
+    0xe1, 0x62, 0x59, 0xd4, 0x91, 0x7d, 0xbf, 0x1f, 0x59, 0xa7, 0xa3, 0xd9,
+    0x6a, 0x70, 0x39, 0xc3, 0x98, 0xe8, 0x8e, 0xe3, 0x55, 0x56, 0x1e, 0xa4,
+    0xb1, 0xee, 0x9b, 0x46, 0xf0, 0x6e, 0x45, 0x1c, 0x31, 0x39, 0x65, 0x94,
+    0x2a, 0xda, 0x41, 0x93, 0x7a, 0x21, 0xbb, 0xc0, 0x11, 0x20, 0x90, 0x35,
+    0xd3, 0x95, 0x00, 0x90, 0x44, 0xb2, 0xcf, 0x32, 0x75, 0x9f, 0xc7, 0xce,
+    0x96, 0xaf, 0x51, 0x0a, 0x72, 0x9f, 0xdc, 0x8c, 0xbb, 0x0b, 0xf5, 0xb5,
+    0x12, 0xa5, 0x57, 0x2e, 0x19, 0x56, 0x58, 0x32, 0x05, 0x28, 0x04, 0x05,
+    0x20, 0x10, 0xa6, 0x34, 0xf4, 0xa6, 0x02, 0x3e, 0x1c, 0xcc, 0xc3, 0xfe,
+    0x3e, 0x5f, 0x8a, 0x10, 0xa3, 0x2e, 0x55, 0x8b, 0x10, 0x23, 0x7b, 0x45,
+    0x28, 0xef, 0x04, 0x27, 0x28, 0x1c, 0xe0, 0xea, 0x3a, 0xd6, 0xaf, 0xe1,
+    0x78, 0x3e, 0x23, 0x8b, 0xc6, 0x6c, 0x3e, 0x1b, 0x03, 0x1b, 0x1d, 0xf2,
+    0xc8, 0x4c, 0x24, 0x2c, 0x40, 0xd0, 0x92, 0x06, 0x82, 0xf5, 0xa7, 0xc3,
+    0x7e, 0x98, 0xed, 0xce, 0x33, 0x14, 0xae, 0x0f, 0x66, 0x63, 0xab, 0x65,
+    0xcd, 0x38, 0x98, 0x7f, 0xb4, 0x3e, 0x6f, 0x03, 0xde, 0x94, 0x18, 0xe7,
+    0x6c, 0x10, 0x48, 0x0b, 0x11, 0x99, 0x72, 0xa8, 0x81, 0x24, 0x40, 0x1a,
+    0x72, 0xa6, 0x6c, 0xf9, 0x7b, 0xd2, 0x45, 0x81, 0x93, 0x79, 0xdf, 0xc2,
+    0xb4, 0xf1, 0x7b, 0x0b, 0xb6, 0x2c, 0xbf, 0xff, 0x00, 0x2f, 0x8f, 0x30,
+    0x74, 0x1c, 0x33, 0xc7, 0xd3, 0xa8, 0xac, 0xfc, 0x74, 0xc4, 0x47, 0x7c,
+    0x3c, 0x54, 0xca, 0xd8, 0x76, 0x64, 0x6b, 0x14, 0x23, 0x62, 0x35, 0xa0,
+    0xb4, 0x8d, 0xc2, 0x2e, 0x95, 0x33, 0x9c, 0x40, 0x43, 0x4c, 0x44, 0x98,
+    0xd0, 0xf9, 0x75, 0xad, 0x4b, 0x59, 0x86, 0xc2, 0xd2, 0x75, 0xf3, 0xf9,
+    0xd2, 0x83, 0x72, 0x58, 0x92, 0x34, 0x93, 0xa5, 0xfa, 0xd2, 0x9b, 0x13,
+    0xbe, 0x00, 0x43, 0x36, 0xdf, 0xe9, 0xef, 0x49, 0x42, 0x19, 0xac, 0x43,
+    0x5b, 0xc3, 0x73, 0xe7, 0x7a, 0x8e, 0x4a, 0xc1, 0x5b, 0x95, 0x81, 0x3b,
+    0x0f, 0x95, 0x47, 0x58, 0x12, 0xb2, 0x4c, 0x01, 0x27, 0xc3, 0xef, 0x53,
+    0x27, 0x78, 0xcb, 0x10, 0x2d, 0x33, 0xf0, 0x9f, 0x7f, 0xc5, 0x08, 0x5b,
+    0xff, 0x00, 0xa1, 0xb0, 0x9b, 0x1f, 0xb7, 0xf0, 0xb1, 0x55, 0x41, 0x5c,
+    0x2c, 0x37, 0xc4, 0x6c, 0xe6, 0x2c, 0x46, 0x5b, 0x73, 0xbb, 0x0a, 0xfa,
+    0x60, 0x0b, 0x87, 0x23, 0xbc, 0xcd, 0x24, 0xc1, 0xdf, 0xfb, 0xaf, 0x2f,
+    0xff, 0x00, 0xc7, 0xdc, 0x11, 0x4e, 0xcb, 0xc5, 0xe2, 0xd8, 0x95, 0xfd,
+    0xfc, 0x40, 0x00, 0x90, 0x54, 0xaa, 0x98, 0x04, 0x72, 0x32, 0x5a, 0xfe,
+    0x55, 0xeb, 0x96, 0x46, 0x0c, 0xc8, 0x26, 0x26, 0x79, 0xf8, 0x56, 0xf3,
+    0x05, 0x8b, 0xb0, 0xa3, 0x17, 0xdd, 0xda, 0xfe, 0x3e, 0x81, 0x51, 0xd6,
+    0x49, 0x9e, 0x63, 0x6e, 0x5a, 0x2b, 0xb3, 0xc6, 0x1d, 0xf7, 0x9f, 0x2e,
+    0xb4, 0xa8, 0x05, 0x9a, 0x04, 0x88, 0xdc, 0x0d, 0x22, 0x2a, 0x2c, 0x1e,
+    0xe8, 0xf8, 0xc6, 0x8b, 0x13, 0x14, 0x13, 0xbb, 0xfb, 0x84, 0x41, 0x20,
+    0x88, 0x31, 0x31, 0xe7, 0xe9, 0x53, 0xd5, 0x72, 0x01, 0x61, 0xa4, 0xab,
+    0x6b, 0x7d, 0xaf, 0xce, 0x2a, 0x48, 0x02, 0x4a, 0x08, 0x03, 0x4e, 0xbd,
+    0x69, 0x97, 0x52, 0x49, 0xd2, 0x00, 0x81, 0x22, 0x2d, 0xb8, 0xbd, 0x42,
+    0x41, 0x50, 0x24, 0xc8, 0xd4, 0x6f, 0xe6, 0x3c, 0xe8, 0x42, 0xcb, 0xed,
+    0x6e, 0xc9, 0xe0, 0xfb, 0x53, 0x08, 0x0c, 0x5c, 0x35, 0xc3, 0xc5, 0xb6,
+    0x5c, 0x55, 0x00, 0x34, 0xd8, 0x03, 0x6d, 0x62, 0x22, 0xfb, 0x57, 0x85,
+    0xed, 0x5e, 0xc7, 0xe3, 0x3b, 0x3f, 0x17, 0x26, 0x2e, 0x56, 0x91, 0x2a,
+    0xc1, 0x89, 0x07, 0x9c, 0x1d, 0x2d, 0x6a, 0xfa, 0x68, 0x50, 0x58, 0x9c,
+    0xbc, 0xaf, 0x20, 0x75, 0x7a, 0xe7, 0xe3, 0x78, 0x3c, 0x2e, 0x3b, 0x87,
+    0x7c, 0x2c, 0x74, 0x25, 0x1a, 0xe5, 0xb2, 0xc1, 0x1c, 0x88, 0xf2, 0xea,
+    0xd4, 0xe3, 0x6a, 0x27, 0x84, 0x7f, 0x49, 0xf2, 0x3b, 0x7e, 0xf8, 0x24,
+    0x38, 0xca, 0xc1, 0x78, 0x4d, 0x8f, 0x4e, 0x47, 0xf7, 0xa8, 0x5f, 0x2a,
+    0x38, 0x38, 0xc0, 0xdf, 0x0d, 0xc1, 0x03, 0x5d, 0xa7, 0x7f, 0x38, 0xa1,
+    0xfb, 0x4d, 0x75, 0x86, 0x56, 0x13, 0x72, 0x6f, 0x3e, 0xb5, 0xe8, 0x3b,
+    0x4f, 0x80, 0xc5, 0xec, 0xde, 0x24, 0xe1, 0x62, 0x0c, 0xc8, 0xd3, 0x97,
+    0x10, 0x0b, 0x30, 0xdf, 0xd7, 0x4b, 0x7f, 0x62, 0xb8, 0x48, 0x00, 0xf7,
+    0x98, 0x32, 0x1d, 0x24, 0x9e, 0x7e, 0xdb, 0x55, 0x54, 0xdc, 0x5d, 0x53,
+    0x0d, 0xd8, 0xe8, 0xc0, 0x70, 0xf1, 0xfd, 0xfa, 0xaa, 0xf3, 0x8e, 0x4e,
+    0xd3, 0x95, 0xcc, 0x00, 0x8f, 0x15, 0xc7, 0x85, 0xc1, 0xb3, 0x41, 0xc4,
+    0x71, 0x17, 0x04, 0x4d, 0xfa, 0xb4, 0xd7, 0x56, 0x12, 0xae, 0x15, 0xd4,
+    0x47, 0xac, 0x93, 0xe7, 0xe7, 0x4f, 0x86, 0xa4, 0x36, 0xa6, 0x16, 0xe2,
+    0x46, 0xa7, 0xaf, 0xa5, 0x39, 0x2c, 0x67, 0xf6, 0x94, 0x93, 0xa9, 0x3c,
+    0xe7, 0xaf, 0x6a, 0xcb, 0x62, 0x58, 0xed, 0x5e, 0x21, 0xee, 0xca, 0xef,
+    0x77, 0xa0, 0xd0, 0x7f, 0xdf, 0x3b, 0xa8, 0x73, 0x57, 0xcd, 0x51, 0xa3,
+    0xce, 0x9d, 0x06, 0xc9, 0x72, 0x99, 0x60, 0x01, 0x62, 0x24, 0x9b, 0x9b,
+    0xf5, 0x6a, 0x2b, 0x2d, 0x01, 0x4b, 0x13, 0x1d, 0xd6, 0xe5, 0x78, 0xa8,
+    0x21, 0x90, 0x34, 0x20, 0x63, 0xcf, 0x73, 0x35, 0x66, 0x1a, 0xac, 0x00,
+    0x21, 0xb5, 0x19, 0xbf, 0xae, 0xb9, 0x55, 0x25, 0xee, 0x9b, 0x69, 0x41,
+    0x40, 0x80, 0xd9, 0xec, 0x2e, 0x35, 0xb9, 0xa7, 0x80, 0x31, 0x0e, 0x62,
+    0x62, 0xc0, 0xff, 0x00, 0xbe, 0x95, 0x62, 0x66, 0x66, 0x97, 0x88, 0x22,
+    0x20, 0x4e, 0x93, 0x4e, 0x92, 0xc5, 0x01, 0x93, 0xe5, 0xf7, 0x14, 0xb6,
+    0xb6, 0xe9, 0xd0, 0xe4, 0xa2, 0x20, 0xc3, 0x4e, 0xf2, 0x60, 0x93, 0x6f,
+    0xc5, 0x62, 0xfe, 0xa2, 0xe0, 0xb2, 0x61, 0xa7, 0x13, 0x87, 0x60, 0x08,
+    0x57, 0xcb, 0xf5, 0x3c, 0xf9, 0x7a, 0x8a, 0xdf, 0xc3, 0x4c, 0xd0, 0xc2,
+    0x72, 0xea, 0x66, 0xd5, 0x63, 0x28, 0x6c, 0x3c, 0x85, 0x51, 0xb0, 0xd8,
+    0x41, 0x0c, 0x24, 0x44, 0x5c, 0x54, 0xc8, 0xe2, 0xba, 0x9b, 0x47, 0x56,
+    0x69, 0xa5, 0x12, 0x05, 0xf3, 0xd5, 0x93, 0x9a, 0xd9, 0x57, 0x45, 0xb4,
+    0xf5, 0xfe, 0x52, 0xc0, 0x00, 0x87, 0x13, 0x69, 0xb1, 0x9a, 0xd5, 0xed,
+    0x8e, 0xcc, 0x7e, 0xcd, 0x71, 0x88, 0x15, 0xdb, 0x00, 0xdb, 0x0d, 0xc5,
+    0xee, 0x7f, 0x89, 0xf1, 0xf1, 0xdf, 0xd8, 0x6e, 0x7e, 0x87, 0xfd, 0x22,
+    0x7b, 0x63, 0x10, 0x71, 0x9c, 0x78, 0x29, 0xd9, 0xf8, 0x6d, 0xb6, 0xb8,
+    0xe4, 0x6a, 0x07, 0x25, 0x11, 0x72, 0x3c, 0x40, 0xbc, 0x90, 0x36, 0x17,
+    0xb9, 0xf9, 0x00, 0xd5, 0x6e, 0x63, 0x9d, 0x92, 0xb0, 0x48, 0xc3, 0x70,
+    0x56, 0x6f, 0xe9, 0xef, 0xd2, 0xfd, 0xa1, 0xdb, 0x58, 0xea, 0x78, 0x7c,
+    0x3f, 0xda, 0xe0, 0x8b, 0x00, 0xfc, 0x46, 0x27, 0xc3, 0x17, 0x92, 0x27,
+    0xe2, 0x32, 0x08, 0xb6, 0xf1, 0x31, 0x33, 0x5f, 0x4b, 0xec, 0xaf, 0xd0,
+    0xfd, 0x91, 0xc0, 0xaa, 0x3e, 0x27, 0x0e, 0x78, 0xdc, 0x71, 0x6c, 0xf8,
+    0xf7, 0x59, 0x22, 0x08, 0x0b, 0xa4, 0x6e, 0x24, 0x13, 0xe3, 0x35, 0xe9,
+    0x30, 0xb0, 0xd3, 0x05, 0x06, 0x12, 0x61, 0xae, 0x1a, 0x22, 0xe4, 0x45,
+    0xc3, 0x58, 0x51, 0xa5, 0x84, 0x69, 0xe1, 0x4d, 0x96, 0x01, 0x91, 0x98,
+    0x4c, 0x18, 0xb5, 0xb4, 0xab, 0x78, 0x69, 0x19, 0x1e, 0xfa, 0x94, 0xd3,
+    0xa4, 0x2e, 0x41, 0x13, 0x0f, 0x0f, 0x0f, 0x0d, 0x30, 0x80, 0xc1, 0x44,
+    0x10, 0xa8, 0xa2, 0x02, 0x81, 0xa0, 0x8d, 0xa8, 0xb1, 0x91, 0x02, 0x60,
+    0xdc, 0xee, 0x34, 0xff, 0x00, 0x69, 0x56, 0xcc, 0x0d, 0xa2, 0xd7, 0x3b,
+    0xce, 0xf4, 0xc1, 0x95, 0x5c, 0xe9, 0x17, 0xd4, 0x40, 0xa9, 0x49, 0xb4,
+    0x5b, 0xba, 0xcb, 0x20, 0x00, 0x2f, 0x1d, 0x72, 0xaa, 0x38, 0xce, 0x13,
+    0x85, 0xe3, 0xb0, 0x91, 0x38, 0xbc, 0x0c, 0x1e, 0x21, 0x33, 0x48, 0x18,
+    0xb8, 0x61, 0xc0, 0xd7, 0x63, 0xbe, 0xb7, 0xf1, 0xab, 0xcb, 0x04, 0x3f,
+    0xf7, 0x0c, 0x22, 0x8b, 0x93, 0xcb, 0xc7, 0xad, 0xab, 0x37, 0x89, 0xed,
+    0x8e, 0x1b, 0x04, 0x11, 0x86, 0x4e, 0x21, 0x04, 0xfc, 0x36, 0xbc, 0x73,
+    0x36, 0xbf, 0x31, 0x34, 0xdc, 0x92, 0xb2, 0x31, 0xef, 0x9b, 0x26, 0x27,
+    0xab, 0x86, 0x98, 0x66, 0x95, 0xc1, 0xab, 0xc9, 0xf6, 0xef, 0xff, 0x00,
+    0x1c, 0xf0, 0x98, 0xce, 0x31, 0x7b, 0x17, 0x17, 0xf6, 0x1e, 0x04, 0x60,
+    0xe2, 0x92, 0xc9, 0xca, 0xcd, 0x72, 0x22, 0xe6, 0xf3, 0xe8, 0x2b, 0xe7,
+    0x3c, 0x77, 0x01, 0xc5, 0xf6, 0x7e, 0x2b, 0x60, 0xf1, 0xb8, 0x18, 0xb8,
+    0x18, 0xda, 0x90, 0xfa, 0x9b, 0xc5, 0xb6, 0x20, 0xc1, 0xd0, 0xc1, 0xaf,
+    0xb3, 0x62, 0x76, 0xeb, 0x32, 0xff, 0x00, 0xda, 0xc1, 0x45, 0xc4, 0x20,
+    0x80, 0xc5, 0xcb, 0x0f, 0x0d, 0x23, 0x73, 0x59, 0xbd, 0xaa, 0xf8, 0x5d,
+    0xad, 0xc3, 0x9e, 0x1f, 0xb4, 0xb0, 0x30, 0xb1, 0xd0, 0xca, 0xab, 0x81,
+    0x18, 0x89, 0x30, 0x65, 0x58, 0xcc, 0x19, 0x0b, 0xe7, 0xbc, 0x8a, 0xa8,
+    0x9d, 0xf4, 0xce, 0xd5, 0x86, 0xc7, 0xc3, 0x45, 0x04, 0x71, 0x35, 0x13,
+    0x5d, 0x94, 0xb8, 0x91, 0xd6, 0xc5, 0x7c, 0x87, 0x0a, 0xc1, 0x72, 0xef,
+    0x30, 0x01, 0xae, 0xbe, 0xca, 0xec, 0xfc, 0x7e, 0xd4, 0xe3, 0xb0, 0xb8,
+    0x6e, 0x1d, 0x4a, 0xe6, 0x23, 0x36, 0xe1, 0x16, 0x44, 0x93, 0xa5, 0xbe,
+    0xbe, 0x66, 0xb6, 0x71, 0xff, 0x00, 0x49, 0x71, 0x28, 0xa0, 0xe0, 0x71,
+    0x18, 0x58, 0xd0, 0xa7, 0x30, 0x71, 0x95, 0xbc, 0x00, 0x37, 0xfb, 0x6d,
+    0xe3, 0x5e, 0xaf, 0xf4, 0x8f, 0x63, 0x60, 0x76, 0x5f, 0x0a, 0x18, 0x1c,
+    0xfc, 0x56, 0x22, 0xce, 0x29, 0x68, 0x94, 0xb7, 0xc2, 0x23, 0x41, 0xe3,
+    0xbc, 0x79, 0x0a, 0x5e, 0x1b, 0x4c, 0xda, 0xb9, 0x83, 0x09, 0xd3, 0x73,
+    0xff, 0x00, 0x14, 0xcf, 0xe6, 0x69, 0x65, 0x65, 0xe0, 0x78, 0x27, 0xa7,
+    0x3f, 0x91, 0xd5, 0x6e, 0x60, 0xe1, 0xaf, 0x0f, 0x83, 0x85, 0x84, 0xa8,
+    0x55, 0x30, 0x80, 0x45, 0x5e, 0x40, 0x0d, 0x3e, 0x50, 0x29, 0xf9, 0x9c,
+    0x8c, 0x67, 0x72, 0x66, 0x3d, 0x6a, 0x77, 0x88, 0x71, 0x12, 0x26, 0x4d,
+    0xa6, 0xf1, 0xe1, 0x4c, 0xa4, 0x28, 0x17, 0x36, 0x88, 0x9e, 0xa6, 0xb6,
+    0xb2, 0xca, 0x1a, 0x2c, 0x15, 0x6b, 0x4d, 0xd5, 0xd7, 0x79, 0x13, 0x27,
+    0x2d, 0xe7, 0x7f, 0x4f, 0x96, 0xb4, 0x58, 0xe5, 0x32, 0x4e, 0x51, 0x7b,
+    0xad, 0xf7, 0xfc, 0x9a, 0x38, 0x52, 0xca, 0x99, 0xe6, 0x2f, 0x32, 0x4f,
+    0x5e, 0xd4, 0x08, 0x12, 0xb7, 0x12, 0x35, 0x8b, 0xda, 0x7e, 0xd5, 0x21,
+    0x36, 0x8b, 0x12, 0x00, 0x98, 0x61, 0xf0, 0xf7, 0xbc, 0xf4, 0xfa, 0xde,
+    0x80, 0x2c, 0x40, 0x20, 0x1f, 0xdc, 0xb4, 0x49, 0x9f, 0x0f, 0xbc, 0xd0,
+    0x00, 0x64, 0x20, 0x40, 0x17, 0x26, 0x6d, 0x3e, 0x23, 0x95, 0x12, 0x25,
+    0x50, 0x89, 0xca, 0x6e, 0x41, 0x13, 0xeb, 0x42, 0x10, 0x49, 0x90, 0x19,
+    0x6c, 0x44, 0x83, 0x3d, 0x69, 0x40, 0x0b, 0x31, 0x88, 0x26, 0x4c, 0xf3,
+    0xbf, 0x8f, 0x8d, 0x31, 0x19, 0xa5, 0x4a, 0x81, 0x79, 0xb4, 0xda, 0x3f,
+    0x1f, 0x6a, 0x60, 0x46, 0x61, 0x78, 0x89, 0x04, 0x9e, 0x64, 0xf3, 0xeb,
+    0x5a, 0x10, 0xb8, 0x3b, 0x53, 0x80, 0x1c, 0x7f, 0x08, 0xc8, 0xeb, 0x38,
+    0x93, 0x99, 0x08, 0x24, 0x43, 0x47, 0xaf, 0xaf, 0xf7, 0x5e, 0x0d, 0x93,
+    0x29, 0x38, 0x6d, 0x94, 0x15, 0x26, 0x54, 0x82, 0x08, 0x37, 0x90, 0x6b,
+    0xe9, 0x2a, 0x2d, 0x04, 0x91, 0x17, 0x39, 0xae, 0x34, 0xd7, 0xaf, 0x1a,
+    0xf2, 0x5f, 0xa9, 0xb8, 0x25, 0xc1, 0xe3, 0x57, 0x17, 0x07, 0x20, 0xc3,
+    0xc5, 0x59, 0x81, 0x6b, 0x8d, 0x4f, 0xd3, 0xd6, 0x6b, 0x37, 0xc4, 0x34,
+    0xb7, 0x8c, 0x54, 0x37, 0x96, 0x87, 0xc3, 0x92, 0xa9, 0xc4, 0xe0, 0xbb,
+    0x44, 0xa3, 0x96, 0xeb, 0x12, 0x4b, 0xab, 0x16, 0x5e, 0xeb, 0x73, 0x23,
+    0xc3, 0x4a, 0x30, 0xb9, 0x02, 0xb4, 0x28, 0x91, 0x70, 0x24, 0x1d, 0x3f,
+    0x15, 0x04, 0x40, 0x72, 0xb9, 0xcc, 0x81, 0x3c, 0xbf, 0xba, 0x74, 0x8c,
+    0x86, 0x48, 0x59, 0xff, 0x00, 0x96, 0x80, 0x79, 0x6f, 0xbd, 0x63, 0x6f,
+    0x75, 0x50, 0xd2, 0xa2, 0x26, 0x60, 0x20, 0x00, 0x0c, 0x49, 0x1a, 0xf5,
+    0xf8, 0xa7, 0xc3, 0x0c, 0xc1, 0x61, 0x40, 0x1b, 0x00, 0x77, 0xa2, 0x8b,
+    0x66, 0x5d, 0x3f, 0x8e, 0x59, 0xd7, 0x7a, 0x70, 0x02, 0x00, 0xc3, 0xbc,
+    0x1b, 0x40, 0x6d, 0x4b, 0x6b, 0x6e, 0x9d, 0x0e, 0x48, 0x98, 0x61, 0x48,
+    0x92, 0x0d, 0x5e, 0x8a, 0x26, 0x20, 0x48, 0xba, 0x80, 0x63, 0xad, 0xba,
+    0x9a, 0x20, 0x36, 0x60, 0x54, 0x77, 0x88, 0x91, 0xe5, 0x15, 0x68, 0xc3,
+    0x8f, 0x87, 0x36, 0x51, 0x78, 0x1b, 0x75, 0x7a, 0x9b, 0x14, 0x49, 0xc0,
+    0xe4, 0x30, 0xb0, 0x84, 0x7c, 0x30, 0xc7, 0x61, 0xf3, 0xf3, 0xa7, 0xc3,
+    0x0d, 0x97, 0xf9, 0xc0, 0x99, 0x5e, 0x57, 0xa7, 0x44, 0x85, 0x20, 0xe5,
+    0x0c, 0xd1, 0x79, 0x16, 0xe7, 0x57, 0x61, 0x88, 0xca, 0xa4, 0x7b, 0x69,
+    0xd4, 0xfa, 0xcd, 0x5a, 0x43, 0x0a, 0x50, 0x72, 0xbf, 0xb2, 0x7b, 0x2d,
+    0x3b, 0x49, 0xdb, 0x87, 0xc5, 0xc3, 0x07, 0x87, 0xff, 0x00, 0xee, 0x04,
+    0x9d, 0x27, 0xe1, 0xf0, 0x27, 0x9e, 0xb6, 0x91, 0xa5, 0x7b, 0x7c, 0x24,
+    0x44, 0xc3, 0x4c, 0x3c, 0x10, 0x81, 0x10, 0x65, 0x50, 0xab, 0x01, 0x40,
+    0xd8, 0x46, 0xd1, 0xcb, 0x95, 0x67, 0xf6, 0x0f, 0x0a, 0x9c, 0x2f, 0x67,
+    0xa1, 0x50, 0x46, 0x26, 0x20, 0x0e, 0xc4, 0x09, 0xf2, 0xfa, 0x7d, 0x6b,
+    0x41, 0x60, 0x8f, 0x84, 0x0d, 0xed, 0x71, 0x53, 0x03, 0x40, 0x5b, 0x2c,
+    0x36, 0x9c, 0xc3, 0x00, 0xbe, 0xe7, 0x54, 0xc3, 0xf8, 0x83, 0xdd, 0x24,
+    0xcc, 0x13, 0xbd, 0x08, 0x62, 0xb3, 0x9a, 0x2d, 0x94, 0x08, 0x99, 0xb5,
+    0x14, 0x60, 0x41, 0x9b, 0x82, 0x64, 0x45, 0xc7, 0x56, 0x35, 0x08, 0x02,
+    0x01, 0x00, 0xc8, 0x00, 0x8d, 0xba, 0xeb, 0x6a, 0xf5, 0x4f, 0x40, 0x02,
+    0x5a, 0x6d, 0x31, 0x20, 0x45, 0xbc, 0xbd, 0xc5, 0x72, 0x76, 0x87, 0x1d,
+    0x85, 0xc1, 0xe1, 0x16, 0x6c, 0x59, 0x7d, 0x57, 0x08, 0x6a, 0x7e, 0x5b,
+    0x78, 0xd5, 0xbd, 0xa1, 0xc4, 0x2f, 0x0b, 0xc3, 0x62, 0xe2, 0x31, 0xd8,
+    0x5a, 0x62, 0x4f, 0x2f, 0x0f, 0x7a, 0xf2, 0x7c, 0x67, 0x12, 0xfc, 0x4e,
+    0x2b, 0x62, 0xe3, 0x4b, 0x39, 0x1b, 0x48, 0x03, 0x68, 0xf0, 0xeb, 0xc6,
+    0xa0, 0xd6, 0xd5, 0xf6, 0x03, 0x2b, 0x7e, 0x22, 0xa8, 0xf1, 0x9c, 0x5c,
+    0x51, 0x37, 0xb3, 0x8f, 0xe3, 0x3f, 0x41, 0xd7, 0xf0, 0x9b, 0x8d, 0xe2,
+    0xf1, 0xf8, 0xc9, 0x7c, 0x6b, 0x00, 0x2c, 0x82, 0x72, 0xc8, 0xde, 0x3e,
+    0x75, 0xcf, 0x8a, 0x0b, 0x29, 0xb3, 0x4e, 0xa4, 0x6a, 0x3f, 0xdb, 0x54,
+    0x0f, 0x99, 0x49, 0x20, 0xe5, 0x36, 0x04, 0x89, 0x8e, 0xae, 0x69, 0xb1,
+    0x09, 0x4b, 0xa8, 0xb1, 0x1a, 0x1d, 0xbc, 0x2b, 0x3e, 0xe7, 0xb9, 0xe7,
+    0x33, 0x8d, 0xca, 0xc0, 0xcb, 0x2b, 0xe5, 0x71, 0x7c, 0x86, 0xe4, 0xa6,
+    0x49, 0xb0, 0x20, 0x8e, 0xfe, 0x61, 0x3c, 0xba, 0xda, 0x95, 0x40, 0x0c,
+    0x25, 0x94, 0x45, 0x89, 0x2d, 0x24, 0xde, 0xd4, 0x01, 0x33, 0x0e, 0x19,
+    0xa6, 0xf0, 0x05, 0xfd, 0x68, 0x00, 0x32, 0xe6, 0x00, 0x99, 0x10, 0x44,
+    0x58, 0x52, 0x53, 0x68, 0xec, 0xa5, 0x03, 0x18, 0x13, 0xeb, 0xb5, 0x49,
+    0x2a, 0xd2, 0xbd, 0xcd, 0xe5, 0x41, 0x13, 0x7b, 0xd3, 0x48, 0x0d, 0x0c,
+    0x4c, 0x46, 0xf6, 0x34, 0xa2, 0x7f, 0x6c, 0xc8, 0x98, 0xbc, 0x15, 0xdf,
+    0xc7, 0xe9, 0x5e, 0x82, 0x41, 0xb8, 0x5e, 0x83, 0x6d, 0x42, 0xee, 0xc0,
+    0xe2, 0xd5, 0xa1, 0x71, 0x58, 0x2c, 0x58, 0x30, 0x3e, 0x1b, 0xfd, 0xab,
+    0xa4, 0x90, 0x34, 0x00, 0x1f, 0xe4, 0x41, 0xb0, 0xdf, 0xca, 0xb2, 0x1f,
+    0xe1, 0x50, 0x6c, 0x66, 0x02, 0x9e, 0x5e, 0x55, 0xd9, 0xc1, 0xe3, 0x4b,
+    0x1c, 0x16, 0x02, 0x46, 0x92, 0x7d, 0x76, 0xfa, 0xd5, 0xed, 0x26, 0x28,
+    0xf7, 0x8e, 0xce, 0x53, 0x73, 0xc8, 0xad, 0x26, 0x17, 0x89, 0x97, 0xb8,
+    0x43, 0x31, 0xd7, 0x91, 0xf4, 0x2b, 0x4f, 0x12, 0xe1, 0x64, 0x03, 0x13,
+    0x65, 0xb4, 0x0e, 0xb9, 0xd0, 0x23, 0x21, 0x27, 0x2b, 0xc7, 0x8e, 0x91,
+    0xbf, 0xb4, 0x53, 0x38, 0x2c, 0xc6, 0xec, 0x56, 0x48, 0xcb, 0xef, 0xcf,
+    0x4a, 0x92, 0x32, 0x81, 0x69, 0x07, 0x4e, 0x7b, 0x69, 0x5b, 0x75, 0x74,
+    0x86, 0x20, 0x8e, 0xe9, 0x20, 0x93, 0xb0, 0xd8, 0xed, 0x4d, 0x12, 0x0a,
+    0x85, 0x5b, 0x5e, 0x63, 0x5a, 0x8d, 0x61, 0x13, 0x95, 0x1b, 0x42, 0x37,
+    0x3c, 0xe8, 0x65, 0x36, 0x60, 0x54, 0x20, 0x22, 0x01, 0x11, 0x31, 0xa5,
+    0x08, 0x4b, 0x06, 0x20, 0x30, 0x97, 0x3f, 0xf2, 0xf6, 0x35, 0x0d, 0xc0,
+    0x4b, 0x92, 0xda, 0xdf, 0xc2, 0x98, 0xbf, 0x79, 0x41, 0x82, 0x34, 0x99,
+    0xb7, 0x97, 0x5c, 0xaa, 0x2c, 0xe6, 0x62, 0x60, 0xc8, 0x9f, 0xfd, 0x47,
+    0x2f, 0x6a, 0x10, 0xa3, 0x65, 0x12, 0x1c, 0x77, 0x59, 0xb6, 0xe7, 0xbc,
+    0x7b, 0xd6, 0x67, 0xea, 0x5c, 0x04, 0xc6, 0xec, 0x92, 0x42, 0xb1, 0x64,
+    0x03, 0x11, 0x72, 0x9b, 0x5b, 0x5d, 0xb9, 0x13, 0x5a, 0x44, 0x9c, 0xb2,
+    0x60, 0x12, 0x7e, 0x2e, 0x57, 0xd2, 0xa9, 0xed, 0x1c, 0x3c, 0xfc, 0x3e,
+    0x26, 0x1e, 0x1f, 0xc6, 0xe8, 0xc8, 0x8b, 0xa5, 0xe0, 0x81, 0xaf, 0xa5,
+    0x47, 0xab, 0x8b, 0xb5, 0x81, 0xf1, 0xf5, 0x05, 0x35, 0x3b, 0x33, 0xc6,
+    0xe6, 0xf5, 0x0b, 0xc2, 0x1c, 0xd1, 0x18, 0x66, 0xc4, 0x81, 0x23, 0xaf,
+    0xbd, 0x1c, 0xb2, 0xb7, 0x26, 0xc6, 0x64, 0x90, 0x66, 0x46, 0x94, 0xec,
+    0x00, 0x05, 0x60, 0xa9, 0x02, 0x0c, 0xde, 0x05, 0x58, 0xb8, 0x7d, 0xfb,
+    0xc8, 0xfe, 0x31, 0xcb, 0x7e, 0x75, 0xcc, 0xda, 0xdb, 0xac, 0x90, 0x72,
+    0x18, 0x78, 0x44, 0xb9, 0xd7, 0xe2, 0xd6, 0x74, 0x3c, 0xaa, 0xd5, 0x48,
+    0x56, 0x0a, 0x08, 0x16, 0xd4, 0xce, 0xb4, 0xc5, 0x26, 0x04, 0x6b, 0x6e,
+    0xf0, 0xd4, 0x79, 0xd3, 0xa2, 0x97, 0x94, 0x04, 0xe8, 0x44, 0x7c, 0xea,
+    0x6c, 0x51, 0xa7, 0x03, 0x92, 0xaa, 0x41, 0x25, 0xc1, 0x30, 0x2c, 0x56,
+    0xfc, 0xff, 0x00, 0xaa, 0xbd, 0x43, 0x31, 0x55, 0x3c, 0xb3, 0x4f, 0x3b,
+    0x73, 0xa2, 0x10, 0x8c, 0x30, 0x20, 0x0c, 0xa7, 0x53, 0xd7, 0x3a, 0xb1,
+    0x04, 0x95, 0x1a, 0x02, 0x5a, 0x24, 0x6f, 0xcc, 0xd5, 0xa4, 0x30, 0xa5,
+    0x07, 0x26, 0x44, 0x4b, 0x92, 0xc3, 0x5d, 0x34, 0xde, 0xdf, 0x4a, 0xbf,
+    0x84, 0xc1, 0x5c, 0x6e, 0x2b, 0x0b, 0x0f, 0x10, 0x98, 0x76, 0x0b, 0xac,
+    0x48, 0x2d, 0x16, 0xaa, 0xd7, 0x30, 0x0b, 0x12, 0x1c, 0x88, 0x03, 0x41,
+    0x16, 0xfa, 0xd6, 0x8f, 0x62, 0x2a, 0x1e, 0x37, 0x00, 0x94, 0xb4, 0x9b,
+    0x0f, 0xff, 0x00, 0x33, 0x56, 0x91, 0xc5, 0x61, 0x75, 0x22, 0x9c, 0x76,
+    0x92, 0xb5, 0x9d, 0x48, 0x1f, 0x55, 0xea, 0x10, 0x18, 0xee, 0xb1, 0x3a,
+    0x44, 0x6f, 0xe7, 0xca, 0xa1, 0xb2, 0x35, 0xae, 0x35, 0x83, 0x6e, 0xad,
+    0x50, 0xca, 0x86, 0x0c, 0x73, 0x1b, 0x02, 0x23, 0x4b, 0x51, 0x38, 0x73,
+    0x96, 0x56, 0x42, 0xda, 0x0f, 0x96, 0xd4, 0xca, 0xe8, 0x69, 0x67, 0x34,
+    0x29, 0xd4, 0x8b, 0xc6, 0xa7, 0xf1, 0x4e, 0x09, 0x22, 0x51, 0x73, 0x02,
+    0x23, 0x58, 0x33, 0xd0, 0xaa, 0xec, 0xd7, 0x3d, 0xc2, 0x04, 0x69, 0xb5,
+    0x0c, 0x6c, 0x61, 0x84, 0xac, 0xf8, 0xa0, 0xaa, 0xa8, 0x24, 0xb6, 0xb1,
+    0xce, 0x8b, 0xd9, 0x78, 0x48, 0x02, 0xe5, 0x79, 0xfe, 0xdf, 0xe3, 0x3f,
+    0x73, 0x88, 0x6c, 0x0b, 0x8c, 0x34, 0x10, 0x40, 0x33, 0x2d, 0x1b, 0xc6,
+    0xfb, 0x75, 0x15, 0x94, 0x55, 0xa7, 0x2c, 0x90, 0xc6, 0xd2, 0x77, 0xbf,
+    0xf9, 0x4f, 0x89, 0x88, 0x71, 0x99, 0xdf, 0x11, 0xbb, 0xcd, 0x2c, 0xc4,
+    0x11, 0xae, 0xf6, 0xf9, 0xd2, 0x93, 0x0a, 0x20, 0x95, 0xb6, 0xa3, 0xe9,
+    0xf2, 0xeb, 0x9e, 0x52, 0x69, 0x0c, 0xaf, 0x2f, 0x3c, 0xd7, 0x2b, 0xab,
+    0xa8, 0x75, 0x4c, 0xce, 0x95, 0xdc, 0xcf, 0xd3, 0x90, 0x44, 0x3e, 0x61,
+    0x99, 0x60, 0x05, 0xbc, 0x11, 0xa7, 0x8f, 0xbd, 0x23, 0x01, 0x25, 0x9a,
+    0x48, 0xbe, 0xfa, 0xef, 0x15, 0x61, 0x82, 0xa3, 0x28, 0x55, 0x88, 0x31,
+    0x31, 0x14, 0x15, 0x41, 0x24, 0xe6, 0x90, 0x6d, 0x73, 0x33, 0xd0, 0xa6,
+    0x94, 0x64, 0xaf, 0x62, 0x6e, 0x24, 0x90, 0x64, 0x98, 0xfb, 0xd3, 0x33,
+    0x08, 0x83, 0xde, 0x22, 0x6d, 0x30, 0x49, 0xeb, 0xed, 0x41, 0x0e, 0x64,
+    0x10, 0xb1, 0xb8, 0x24, 0xeb, 0xb5, 0x1c, 0xc0, 0x95, 0x1c, 0xbc, 0x4c,
+    0xf8, 0x8a, 0x10, 0x81, 0x56, 0xfd, 0xce, 0xea, 0xb1, 0x83, 0x13, 0xcf,
+    0xc7, 0x97, 0x3a, 0x8c, 0x08, 0x4c, 0xa8, 0xa0, 0x2c, 0x48, 0x8f, 0x2b,
+    0xeb, 0xf4, 0xa5, 0x56, 0x25, 0x65, 0x73, 0x96, 0x24, 0xcf, 0x33, 0xd7,
+    0xde, 0x9c, 0x28, 0x05, 0x54, 0xb3, 0x2d, 0xcd, 0xb4, 0x89, 0x9e, 0xbd,
+    0x68, 0x42, 0x59, 0x32, 0xa5, 0x46, 0x93, 0x1d, 0x73, 0xa6, 0x48, 0x57,
+    0x19, 0x6d, 0x96, 0xc0, 0x91, 0x71, 0x26, 0xd5, 0x21, 0x49, 0xb3, 0x16,
+    0x6d, 0xf2, 0xd8, 0x78, 0x78, 0x9d, 0xa8, 0x17, 0x0d, 0x05, 0x58, 0x00,
+    0x3e, 0x19, 0xeb, 0xc7, 0xda, 0xbd, 0x5e, 0x82, 0x41, 0xb8, 0x5b, 0xca,
+    0x4a, 0xf7, 0x44, 0xeb, 0x6f, 0xf3, 0xfb, 0xa3, 0x94, 0xb4, 0x85, 0x33,
+    0x02, 0x01, 0xe7, 0xea, 0x3a, 0xbd, 0x30, 0x04, 0x19, 0x85, 0x19, 0x87,
+    0xf1, 0xb4, 0x4e, 0xf4, 0x87, 0x31, 0x86, 0x26, 0x66, 0xe3, 0x9f, 0x8d,
+    0x75, 0x45, 0xbe, 0x4c, 0x44, 0x7c, 0x63, 0x95, 0xe6, 0x3d, 0x7d, 0xe8,
+    0x49, 0xca, 0x45, 0xcc, 0xd8, 0x03, 0xbd, 0x36, 0x46, 0x1f, 0xfd, 0x6d,
+    0xa9, 0x11, 0x94, 0xc8, 0xb5, 0x26, 0x22, 0x84, 0x53, 0x9d, 0x63, 0x61,
+    0x3a, 0xf9, 0xd7, 0x81, 0xc0, 0xec, 0x53, 0x4d, 0x9a, 0x37, 0x9b, 0x35,
+    0xc0, 0x9f, 0x14, 0x18, 0xac, 0xb0, 0xb8, 0x6d, 0x20, 0xfe, 0x29, 0x8b,
+    0xc3, 0x01, 0x9b, 0x2b, 0x9d, 0x49, 0x50, 0x23, 0xd3, 0xaf, 0xb5, 0x06,
+    0xcc, 0x06, 0x50, 0x20, 0x98, 0xb6, 0xa7, 0xe5, 0x4e, 0x48, 0x2a, 0x58,
+    0xc3, 0x28, 0x36, 0x15, 0xea, 0x75, 0x29, 0x63, 0x06, 0xd0, 0xcc, 0x4c,
+    0xc9, 0x83, 0xfe, 0xde, 0x97, 0x3a, 0x61, 0x82, 0xec, 0xf7, 0x50, 0x64,
+    0x9d, 0x20, 0x6f, 0xad, 0x16, 0x92, 0xa0, 0x30, 0x25, 0x81, 0x22, 0xe2,
+    0x35, 0xeb, 0xde, 0xa8, 0xed, 0x2c, 0x41, 0x85, 0xc0, 0xf1, 0x20, 0xb4,
+    0x8c, 0xa5, 0x41, 0xcb, 0x3e, 0x1f, 0x2b, 0xd2, 0x25, 0x7f, 0x66, 0xc2,
+    0xfe, 0x82, 0xe9, 0x12, 0x3b, 0x23, 0x4b, 0xba, 0x2f, 0x1a, 0x15, 0x4b,
+    0x36, 0xbc, 0xc0, 0x8b, 0xf9, 0x57, 0x42, 0x61, 0xc1, 0x10, 0x33, 0x10,
+    0xbe, 0x4c, 0x3d, 0x3d, 0x69, 0x30, 0xd3, 0x51, 0x2b, 0x36, 0xb1, 0x16,
+    0xeb, 0x5a, 0xbd, 0xd0, 0x11, 0x24, 0x5e, 0x48, 0xbd, 0xfc, 0xfe, 0xf5,
+    0xce, 0xa2, 0x8d, 0x62, 0x83, 0x92, 0xe1, 0xa8, 0x74, 0x50, 0x41, 0x27,
+    0x63, 0x13, 0xe5, 0x56, 0xaa, 0xaa, 0xac, 0x4c, 0x8d, 0x2f, 0xd7, 0x53,
+    0x43, 0x28, 0x73, 0x9a, 0x3b, 0xda, 0x1e, 0x43, 0xe7, 0x5d, 0x2a, 0xa3,
+    0xf7, 0x26, 0x0c, 0xc4, 0x03, 0xd7, 0x5e, 0xd5, 0x69, 0x0c, 0x29, 0x41,
+    0xca, 0xb0, 0x82, 0xc8, 0xca, 0xad, 0xe5, 0x26, 0x7c, 0x04, 0x55, 0xe1,
+    0x3b, 0xd9, 0x58, 0x85, 0xb6, 0xb3, 0xe9, 0x4c, 0x01, 0xee, 0xaa, 0xda,
+    0x0c, 0x40, 0x33, 0x7d, 0x05, 0xaa, 0xfc, 0x20, 0xa7, 0x28, 0xcd, 0x6c,
+    0xb2, 0x4c, 0x5f, 0xdb, 0x4d, 0x2a, 0xda, 0x18, 0x52, 0xc3, 0x92, 0x83,
+    0x28, 0x48, 0x59, 0x06, 0x44, 0x15, 0xbe, 0x96, 0xae, 0xee, 0xca, 0xcb,
+    0x87, 0xc7, 0x61, 0x97, 0x81, 0x06, 0x20, 0x8d, 0xc8, 0x23, 0x51, 0x5c,
+    0xf8, 0x60, 0xbf, 0x8e, 0xf0, 0x3e, 0x9d, 0x72, 0xab, 0xb0, 0x8f, 0xed,
+    0x63, 0x61, 0x3a, 0x12, 0x18, 0x19, 0x88, 0x99, 0x8e, 0x8d, 0x59, 0x36,
+    0x1b, 0xb4, 0x84, 0xfd, 0x3c, 0xdd, 0x94, 0xad, 0x7f, 0x42, 0x0f, 0xc9,
+    0x7a, 0x58, 0xd8, 0x83, 0x27, 0x5b, 0x99, 0x31, 0xaf, 0xd0, 0x51, 0x4e,
+    0x4a, 0xc3, 0x36, 0x84, 0x83, 0xb5, 0x56, 0xac, 0xad, 0x84, 0x1d, 0x3e,
+    0x06, 0x82, 0x22, 0x77, 0xab, 0x09, 0x12, 0x0c, 0x0b, 0x03, 0xfc, 0x74,
+    0xaa, 0x6d, 0x97, 0x4a, 0x04, 0x11, 0x70, 0xa6, 0x1c, 0xde, 0x06, 0xe6,
+    0xfc, 0x8f, 0x5f, 0x5a, 0xe7, 0xed, 0x2b, 0xf0, 0x18, 0xf0, 0x2f, 0xfb,
+    0x4c, 0x0e, 0xd1, 0x6d, 0x2a, 0xe7, 0x62, 0x18, 0x08, 0x24, 0x89, 0x8f,
+    0x3a, 0x4e, 0x2d, 0x3f, 0x73, 0x85, 0xc6, 0x54, 0x50, 0xc4, 0xa3, 0x2a,
+    0x8f, 0x18, 0xff, 0x00, 0x29, 0x32, 0x6a, 0xd2, 0x13, 0x73, 0x82, 0x62,
+    0x70, 0x1d, 0x0a, 0xf1, 0x86, 0x49, 0x63, 0x74, 0x23, 0xda, 0xa4, 0x67,
+    0x59, 0x00, 0xe7, 0x26, 0xc0, 0x9d, 0x4c, 0xd4, 0x51, 0x90, 0x92, 0x4a,
+    0x1b, 0xcc, 0x93, 0x26, 0x97, 0x05, 0xcc, 0x82, 0xc1, 0x49, 0xd0, 0x0e,
+    0x46, 0x79, 0x56, 0x45, 0x72, 0x64, 0x59, 0x03, 0x35, 0xee, 0x0a, 0xfc,
+    0xbc, 0x6a, 0x00, 0x22, 0x4e, 0xad, 0x72, 0x75, 0x04, 0xf8, 0xfc, 0xe8,
+    0xa5, 0xa4, 0x09, 0xd6, 0x06, 0x7b, 0xdf, 0x49, 0xa1, 0x95, 0x94, 0x96,
+    0x23, 0xbd, 0x31, 0x1b, 0x1f, 0x7d, 0x28, 0x42, 0x2c, 0x22, 0x02, 0xb5,
+    0xae, 0x7b, 0xd0, 0x7f, 0xda, 0x12, 0x0b, 0x4a, 0x80, 0x63, 0xfe, 0x26,
+    0x0c, 0xf5, 0x34, 0xcc, 0x85, 0x16, 0xf3, 0x79, 0xcd, 0x1d, 0x7a, 0xd0,
+    0xc2, 0x8b, 0x15, 0x5e, 0xe8, 0xe4, 0x26, 0x46, 0xe7, 0x4f, 0x2a, 0x10,
+    0x9d, 0x46, 0x56, 0xb7, 0x38, 0x81, 0x16, 0xf3, 0xf9, 0xd5, 0x6c, 0x61,
+    0x6e, 0x23, 0x0c, 0xdf, 0xba, 0x37, 0xbd, 0x85, 0x4f, 0x8e, 0x24, 0x03,
+    0x98, 0x4e, 0x93, 0x14, 0x61, 0x81, 0x0c, 0x08, 0x82, 0xd2, 0x6f, 0x60,
+    0x62, 0x84, 0x20, 0xe2, 0x1e, 0xe2, 0x32, 0x8b, 0x69, 0x1e, 0x55, 0x60,
+    0x72, 0x35, 0x9d, 0x62, 0x07, 0x56, 0xea, 0xf5, 0x5b, 0xa3, 0x14, 0x92,
+    0x20, 0x93, 0xb1, 0xbc, 0x0d, 0xa6, 0x9b, 0x36, 0x5b, 0x65, 0x16, 0x13,
+    0x23, 0x73, 0xf9, 0xfb, 0xd0, 0x85, 0xe8, 0x02, 0x92, 0x72, 0x2a, 0x19,
+    0x3a, 0x4c, 0xdf, 0xe5, 0x5a, 0x18, 0x58, 0x5f, 0xb1, 0x86, 0x00, 0x06,
+    0x4d, 0x89, 0x6b, 0x5b, 0xed, 0x6a, 0xa7, 0x80, 0x23, 0xf7, 0x6c, 0xc1,
+    0xa2, 0x08, 0xf9, 0xfd, 0x6b, 0xa0, 0xc7, 0xc0, 0x10, 0x31, 0x6b, 0x69,
+    0x5d, 0x16, 0xae, 0x53, 0x9b, 0x20, 0x4b, 0xe2, 0x7c, 0x46, 0x47, 0x4d,
+    0xec, 0x8c, 0x36, 0x68, 0xdf, 0xbc, 0x9d, 0x75, 0xee, 0x01, 0x58, 0xe2,
+    0xce, 0x20, 0xf3, 0x27, 0x72, 0x39, 0xf9, 0x52, 0x1c, 0x35, 0xc5, 0x52,
+    0xad, 0x78, 0x16, 0x6e, 0xba, 0xf6, 0xa7, 0x04, 0x9d, 0xb3, 0x16, 0x16,
+    0x31, 0x6e, 0xb5, 0xa0, 0x54, 0x20, 0x50, 0x43, 0x00, 0x3c, 0x64, 0x6b,
+    0xca, 0xa1, 0x83, 0x6d, 0x96, 0x4d, 0xae, 0x73, 0x0e, 0x66, 0x9b, 0x15,
+    0x9b, 0x8d, 0x80, 0x30, 0xf1, 0x60, 0x92, 0xca, 0x5a, 0x45, 0xb5, 0x22,
+    0x90, 0xb8, 0x21, 0x65, 0x56, 0xe6, 0xe4, 0x4f, 0xce, 0x6b, 0xbb, 0x88,
+    0x0a, 0xd8, 0x04, 0xb3, 0x09, 0x58, 0x60, 0x0f, 0xa4, 0xda, 0xb3, 0xd8,
+    0x42, 0x92, 0x47, 0x74, 0x89, 0x63, 0xbf, 0x87, 0xd2, 0xad, 0xa9, 0xe4,
+    0x32, 0x32, 0xe5, 0x74, 0xfc, 0x0a, 0xbd, 0xf5, 0xd4, 0xa1, 0xf2, 0x7c,
+    0x40, 0xd8, 0xf7, 0xf7, 0xfc, 0x8f, 0xcd, 0x41, 0x04, 0x16, 0x95, 0xd0,
+    0x12, 0x24, 0xeb, 0x6f, 0xea, 0xb3, 0xbb, 0x7b, 0x15, 0xb0, 0xf8, 0x45,
+    0x55, 0x06, 0x58, 0x99, 0x27, 0x90, 0x13, 0xbf, 0x8d, 0x68, 0x41, 0x38,
+    0x76, 0x95, 0x16, 0x33, 0x7f, 0x3f, 0xbf, 0xfb, 0xbf, 0x9b, 0xe2, 0xf1,
+    0x97, 0x89, 0xe2, 0xce, 0x2a, 0xc8, 0x55, 0xee, 0xa9, 0x26, 0x61, 0x45,
+    0xbf, 0x3e, 0xbe, 0x15, 0x07, 0x16, 0x9f, 0xb3, 0x80, 0xb0, 0x6e, 0xed,
+    0x3f, 0x3f, 0x8f, 0x34, 0xee, 0x2d, 0x50, 0x21, 0x80, 0xb7, 0x9b, 0xb4,
+    0xfc, 0xfe, 0xf7, 0xae, 0x60, 0xa7, 0x29, 0x60, 0x1c, 0x99, 0x24, 0x18,
+    0x8b, 0xf2, 0x8a, 0xbb, 0x04, 0x0c, 0xc4, 0xe5, 0x03, 0x2f, 0xa9, 0x36,
+    0xdb, 0xca, 0xa2, 0xa0, 0xee, 0x91, 0xf1, 0x4c, 0x45, 0x84, 0x9a, 0xb9,
+    0x48, 0xca, 0xa6, 0x55, 0x46, 0xf6, 0xf6, 0xac, 0xf4, 0x30, 0xac, 0xa0,
+    0x72, 0x3f, 0xb6, 0xc4, 0x66, 0x32, 0x40, 0xf4, 0xe5, 0x4d, 0x82, 0x99,
+    0x9a, 0x21, 0x64, 0x72, 0x8e, 0x7e, 0xd4, 0xca, 0x9d, 0xc8, 0x40, 0xa6,
+    0x4d, 0xe0, 0xf9, 0x57, 0x46, 0x02, 0x06, 0x5e, 0xe9, 0xd7, 0xd6, 0x39,
+    0x1b, 0xfa, 0xd5, 0xb4, 0x30, 0xa5, 0x07, 0x2a, 0x80, 0x19, 0x32, 0xd8,
+    0x9f, 0x02, 0x3e, 0x55, 0x72, 0xe1, 0xe8, 0x36, 0x26, 0x34, 0x02, 0x34,
+    0x99, 0xf4, 0xa2, 0x99, 0x54, 0x16, 0x59, 0x16, 0xb0, 0x1f, 0x31, 0x6e,
+    0xb4, 0xab, 0x12, 0xe4, 0x03, 0x04, 0x13, 0xfc, 0x8d, 0xe6, 0x2a, 0xd2,
+    0x28, 0x92, 0x83, 0x93, 0x65, 0x2a, 0xa0, 0x66, 0x1b, 0xde, 0x34, 0xab,
+    0x30, 0xd6, 0x1a, 0x58, 0x1d, 0x84, 0xf3, 0xa8, 0x02, 0x95, 0x0a, 0x14,
+    0x40, 0x24, 0x49, 0xd7, 0xad, 0xbd, 0x69, 0xf0, 0x82, 0x28, 0x96, 0x0a,
+    0x1a, 0x60, 0x8e, 0x7e, 0x23, 0x95, 0x4e, 0x63, 0x2c, 0x9c, 0x0e, 0x5a,
+    0x5d, 0x9e, 0xe4, 0xe0, 0xae, 0x13, 0x34, 0x95, 0x88, 0xbe, 0xa3, 0x6f,
+    0x4f, 0xc5, 0x75, 0xd9, 0x94, 0xa3, 0x73, 0xd0, 0x6d, 0xe3, 0x58, 0xf8,
+    0x78, 0xa7, 0x09, 0x83, 0xc8, 0x24, 0x01, 0x62, 0x4d, 0xfe, 0x5e, 0x55,
+    0xae, 0xb8, 0xa3, 0x15, 0x03, 0x03, 0x21, 0x97, 0x7e, 0x5c, 0xaa, 0x9a,
+    0xbe, 0x9c, 0xc6, 0xfc, 0xe3, 0x63, 0xf7, 0x5b, 0xbc, 0x0e, 0xbc, 0x54,
+    0x42, 0x22, 0x71, 0xf7, 0x9b, 0xf6, 0xeb, 0xe8, 0x8b, 0x30, 0x0c, 0x25,
+    0x62, 0xdf, 0xf1, 0xd4, 0x6f, 0x50, 0xa9, 0x5c, 0xde, 0x2b, 0x3e, 0xb6,
+    0xe7, 0x51, 0x98, 0x1c, 0x30, 0x31, 0x3e, 0x12, 0x23, 0x31, 0xb9, 0x1b,
+    0xd1, 0x93, 0xdd, 0xcb, 0x11, 0x13, 0xaf, 0x97, 0xd2, 0xa0, 0x2b, 0xb5,
+    0xe3, 0xf8, 0xfc, 0x2f, 0xfa, 0x5e, 0x33, 0x13, 0x0c, 0x20, 0xc8, 0x1b,
+    0x45, 0x13, 0x13, 0xf8, 0x8a, 0xa3, 0x2c, 0x0b, 0x18, 0x8d, 0x41, 0x1a,
+    0xe9, 0xeb, 0x3e, 0x35, 0xbf, 0xdb, 0xd8, 0x49, 0x8e, 0x17, 0x1f, 0x0b,
+    0x15, 0x4e, 0x36, 0x17, 0x74, 0xaa, 0x99, 0x90, 0x7f, 0xab, 0xeb, 0x58,
+    0xeb, 0xc3, 0x62, 0x05, 0x62, 0x42, 0xa8, 0xb1, 0x99, 0xd6, 0xb3, 0xb3,
+    0xd1, 0x4a, 0x24, 0x21, 0x8d, 0xb8, 0x5c, 0xee, 0xbb, 0x08, 0xa8, 0x65,
+    0x43, 0xdb, 0x13, 0x09, 0x6e, 0xe2, 0xdb, 0x58, 0xfe, 0x36, 0x55, 0x66,
+    0x26, 0xec, 0x48, 0x8b, 0x83, 0x16, 0xf3, 0xfa, 0xd5, 0x62, 0x4c, 0x41,
+    0xbc, 0xef, 0xe7, 0x63, 0x5d, 0x1f, 0xf4, 0xce, 0xa0, 0x82, 0x41, 0xb4,
+    0x93, 0xb0, 0xf4, 0xf5, 0xf7, 0xa0, 0xdc, 0x2e, 0x21, 0x81, 0x0b, 0x3b,
+    0xe5, 0xb0, 0xfb, 0x53, 0x46, 0x8e, 0x70, 0x2f, 0x90, 0xa8, 0x8e, 0xc2,
+    0xea, 0xda, 0x2e, 0x63, 0x3f, 0x25, 0x49, 0x66, 0x50, 0x19, 0x6c, 0x66,
+    0x02, 0xc4, 0xd1, 0x39, 0xb3, 0x41, 0x0c, 0xba, 0x44, 0xea, 0x3d, 0x7e,
+    0x74, 0xe1, 0x0c, 0xb0, 0x28, 0xfe, 0x64, 0x6f, 0x3f, 0x8a, 0xa8, 0xff,
+    0x00, 0xdb, 0xca, 0x57, 0xe1, 0x3a, 0x88, 0xde, 0x98, 0x2d, 0x2d, 0x36,
+    0x21, 0x42, 0x73, 0x1c, 0xc3, 0x67, 0x0b, 0x14, 0x70, 0x4b, 0x11, 0xde,
+    0xba, 0xc6, 0x62, 0x79, 0xd1, 0x63, 0xff, 0x00, 0x60, 0x88, 0x8b, 0x44,
+    0x4d, 0xfc, 0x2a, 0x15, 0x2a, 0x33, 0x00, 0xd9, 0xa3, 0x97, 0xe7, 0xd7,
+    0x5a, 0x86, 0xee, 0x4a, 0x89, 0x31, 0x1c, 0xed, 0xd6, 0xd4, 0x94, 0x94,
+    0x64, 0x7f, 0xed, 0x3e, 0xa7, 0xa3, 0x42, 0x41, 0x13, 0x98, 0xcc, 0xeb,
+    0x33, 0x22, 0xa6, 0x61, 0x21, 0x98, 0x99, 0x31, 0x3f, 0xd7, 0x85, 0x5b,
+    0xc2, 0xe0, 0x9e, 0x23, 0x18, 0x26, 0x1b, 0x10, 0xa3, 0xbc, 0x64, 0xdf,
+    0xca, 0x7c, 0x7e, 0xd5, 0xe3, 0x9c, 0x1a, 0x33, 0x14, 0xe4, 0x51, 0x3a,
+    0x57, 0x86, 0x33, 0x72, 0xbd, 0x1f, 0x02, 0x54, 0x62, 0x14, 0x3f, 0x1b,
+    0x1d, 0xed, 0x27, 0xca, 0xba, 0xc0, 0x9c, 0xd7, 0xb0, 0xd2, 0x54, 0x7a,
+    0x56, 0x68, 0x76, 0x04, 0x95, 0xbe, 0x52, 0x4a, 0x9f, 0xc5, 0x77, 0xe0,
+    0xf1, 0x0b, 0x88, 0xb9, 0x5a, 0x03, 0xef, 0x63, 0xae, 0xfe, 0x63, 0x4a,
+    0xe8, 0xd5, 0x51, 0x1b, 0xe7, 0x08, 0xe2, 0x6c, 0x32, 0x41, 0x29, 0xac,
+    0x8c, 0x5d, 0xa6, 0xd7, 0xee, 0x23, 0x4b, 0xf8, 0x59, 0x5d, 0x05, 0x54,
+    0x29, 0x52, 0x5c, 0xde, 0xca, 0x29, 0x54, 0x8c, 0xc4, 0xaa, 0x98, 0xd8,
+    0x01, 0x7f, 0xf7, 0xfb, 0xa7, 0x03, 0x34, 0x90, 0x25, 0xb9, 0x73, 0x8b,
+    0x52, 0x62, 0x30, 0xc2, 0x89, 0x20, 0x99, 0x92, 0x08, 0x37, 0xfc, 0x69,
+    0x50, 0xc0, 0x27, 0x40, 0xb2, 0x6c, 0x63, 0x9e, 0x72, 0xb4, 0x5c, 0xaa,
+    0xf8, 0xc5, 0x3f, 0xb6, 0x72, 0x89, 0x93, 0xa1, 0xd3, 0x63, 0x5c, 0xe9,
+    0x84, 0x3b, 0x99, 0x88, 0x60, 0x24, 0xc2, 0x9b, 0x6b, 0x3f, 0x6a, 0xbb,
+    0x14, 0xe6, 0x70, 0x7d, 0xf6, 0xf7, 0x34, 0x18, 0xc9, 0x24, 0x10, 0x00,
+    0x89, 0x8d, 0x34, 0xa9, 0x0c, 0x91, 0xcc, 0x6e, 0x50, 0xad, 0xe0, 0xc4,
+    0x66, 0xa5, 0xa7, 0xf6, 0x78, 0x4e, 0x5b, 0x9b, 0x93, 0xce, 0xfd, 0xc7,
+    0x90, 0xd3, 0x92, 0x24, 0x22, 0x19, 0xfe, 0x5c, 0x89, 0x06, 0xdd, 0x79,
+    0xd0, 0x00, 0x49, 0x82, 0x75, 0xdc, 0x1d, 0x29, 0xb2, 0x2e, 0x65, 0xca,
+    0x00, 0x6d, 0x44, 0x08, 0x1e, 0x5d, 0x73, 0xa0, 0xcc, 0x4b, 0xa8, 0x5c,
+    0xc2, 0x46, 0x91, 0xe9, 0x34, 0x92, 0x6f, 0xba, 0x82, 0xf7, 0xb9, 0xe7,
+    0x33, 0x8d, 0xca, 0xe6, 0xe2, 0xb8, 0x1e, 0x13, 0x15, 0x61, 0xf0, 0x97,
+    0x0c, 0x81, 0xaa, 0xc0, 0x07, 0xaf, 0x1f, 0xbd, 0x66, 0x71, 0x1d, 0x98,
+    0x70, 0x65, 0xf0, 0x9d, 0x4a, 0x2d, 0xc0, 0x73, 0x75, 0xbf, 0xbc, 0x73,
+    0xfe, 0xab, 0x65, 0x5f, 0x62, 0x66, 0x47, 0x23, 0x6b, 0xd3, 0x49, 0x6e,
+    0xea, 0x88, 0xb0, 0x07, 0x61, 0x1d, 0x7d, 0xe9, 0x1d, 0x9b, 0x7a, 0x27,
+    0x23, 0x9d, 0xec, 0xe6, 0xbc, 0xe2, 0x02, 0xcf, 0x21, 0xae, 0x2f, 0x3e,
+    0x11, 0xb1, 0xab, 0x80, 0xce, 0xa5, 0x80, 0x00, 0x16, 0x24, 0x92, 0x76,
+    0xf2, 0xf2, 0xae, 0xbe, 0x33, 0x86, 0x5c, 0x32, 0x31, 0x70, 0xae, 0xa4,
+    0xc1, 0x52, 0xba, 0x1e, 0x7e, 0x53, 0x15, 0x48, 0x50, 0x1c, 0x9c, 0x42,
+    0x22, 0x46, 0xdb, 0x74, 0x6a, 0x64, 0x31, 0x82, 0x2e, 0x15, 0x9c, 0x72,
+    0x87, 0x8b, 0x84, 0x89, 0x84, 0x58, 0x80, 0xa0, 0x46, 0xbb, 0xc0, 0xb5,
+    0x3a, 0x83, 0x94, 0x4a, 0xaa, 0xb6, 0x86, 0x45, 0x3a, 0x08, 0x24, 0x99,
+    0x32, 0x79, 0x11, 0x1b, 0x45, 0x3e, 0x18, 0x79, 0x78, 0x59, 0x20, 0xcc,
+    0x6f, 0x36, 0xf6, 0xa9, 0xec, 0x65, 0x93, 0xc1, 0xc9, 0x95, 0x55, 0x58,
+    0x00, 0x16, 0x05, 0x81, 0x23, 0xc7, 0x4a, 0x8b, 0x87, 0x95, 0xd6, 0x6e,
+    0x6d, 0x37, 0x9f, 0x4f, 0x63, 0x43, 0x4e, 0xec, 0x19, 0x22, 0x2e, 0x3c,
+    0xa9, 0xdf, 0x0e, 0xfd, 0xe4, 0x03, 0x35, 0x81, 0xe6, 0x79, 0xd3, 0xdb,
+    0x27, 0x5a, 0x50, 0x56, 0xc9, 0x2a, 0x35, 0x04, 0xcc, 0xea, 0x39, 0x9f,
+    0x2a, 0xe8, 0xc2, 0xc6, 0x6c, 0x1c, 0x5d, 0x33, 0x21, 0x90, 0x56, 0x76,
+    0xd8, 0x8e, 0xb6, 0xaa, 0x6e, 0x54, 0xe4, 0x31, 0xa5, 0xb9, 0x5b, 0x7a,
+    0xab, 0x1b, 0x1a, 0xcc, 0x2d, 0x94, 0x72, 0x37, 0x2d, 0x17, 0xa8, 0x95,
+    0x52, 0xb0, 0x32, 0xcf, 0xd5, 0x5a, 0xe1, 0x91, 0x4f, 0x2c, 0xc0, 0xc0,
+    0x6c, 0x47, 0x3e, 0x9f, 0xbd, 0x39, 0xae, 0xfc, 0x7e, 0x3d, 0x16, 0xc8,
+    0x5f, 0x11, 0xb4, 0x00, 0x88, 0x83, 0xe3, 0xf3, 0xac, 0xfc, 0x5e, 0x27,
+    0x15, 0xa5, 0x71, 0x1f, 0x36, 0x0c, 0x68, 0xa2, 0x35, 0xaa, 0x59, 0x83,
+    0x28, 0xce, 0xa3, 0x5d, 0xae, 0x04, 0x51, 0xd9, 0xb4, 0x2d, 0x1a, 0x8d,
+    0x07, 0xac, 0x69, 0x54, 0x16, 0x1c, 0x96, 0xfc, 0x17, 0x5a, 0xc4, 0xa8,
+    0xeb, 0x96, 0xca, 0x64, 0x5c, 0x1b, 0x5c, 0x8f, 0x1e, 0x74, 0x1b, 0x4c,
+    0xb6, 0x24, 0x44, 0xf2, 0x03, 0x6b, 0x51, 0x26, 0x58, 0x95, 0xcc, 0x66,
+    0x4d, 0xf6, 0xea, 0x3d, 0xe9, 0x53, 0xe2, 0x05, 0x95, 0xb4, 0x89, 0xeb,
+    0xce, 0x84, 0x26, 0x05, 0x94, 0xb0, 0x0d, 0x71, 0x72, 0xa4, 0xfd, 0x0d,
+    0x13, 0x69, 0x36, 0x80, 0x20, 0x02, 0x2f, 0x6f, 0x1a, 0x18, 0x60, 0x58,
+    0xd9, 0x6d, 0x02, 0x48, 0xb9, 0xf1, 0xa9, 0x10, 0xc0, 0x99, 0x1f, 0xfb,
+    0x46, 0x86, 0x84, 0x25, 0x60, 0x4b, 0x91, 0x19, 0xa0, 0x79, 0xed, 0xf5,
+    0xd6, 0xaa, 0x3c, 0x3a, 0x30, 0x68, 0xee, 0xef, 0x3b, 0x1e, 0x72, 0x39,
+    0x47, 0xd6, 0xae, 0xc3, 0x06, 0xd9, 0xc4, 0x0f, 0x86, 0xd6, 0x27, 0xaf,
+    0x4a, 0x00, 0xca, 0x9c, 0xb2, 0x49, 0x02, 0x41, 0x06, 0xde, 0xf4, 0xdc,
+    0x91, 0x32, 0x51, 0x95, 0xe2, 0xe9, 0x89, 0xe9, 0xa2, 0xa8, 0x6e, 0x49,
+    0x5b, 0x71, 0xfb, 0xf2, 0x59, 0xcd, 0x85, 0x88, 0x88, 0x66, 0x20, 0x1e,
+    0x7e, 0xde, 0x14, 0xa0, 0xae, 0x69, 0xd3, 0xc3, 0x2e, 0xda, 0x75, 0xe9,
+    0x5a, 0x45, 0x47, 0xec, 0x14, 0x68, 0x61, 0xbe, 0xe2, 0x36, 0xfb, 0x52,
+    0xe1, 0x70, 0xa8, 0xee, 0x5c, 0xb9, 0xcb, 0x30, 0x23, 0x5f, 0x9d, 0x50,
+    0xd7, 0x51, 0x7b, 0x3b, 0x4c, 0xad, 0xd5, 0xa3, 0xe6, 0x16, 0x4a, 0xbf,
+    0x00, 0x92, 0x27, 0x66, 0xa7, 0xd5, 0xbf, 0x51, 0xff, 0x00, 0x17, 0x1e,
+    0x0a, 0x62, 0x62, 0x93, 0x84, 0x93, 0x22, 0x24, 0x93, 0xa7, 0xad, 0x6a,
+    0xf0, 0x98, 0x1f, 0xb2, 0x8a, 0xa0, 0x4d, 0xc9, 0xfe, 0xed, 0x4d, 0x86,
+    0x15, 0x70, 0xf2, 0xa8, 0x6b, 0x5c, 0xc7, 0xae, 0xf5, 0x68, 0x20, 0x8e,
+    0xfc, 0x91, 0x6b, 0x96, 0xf2, 0xfc, 0xd6, 0x56, 0xa2, 0xa4, 0xcb, 0xa0,
+    0xd9, 0x4c, 0xc3, 0xe8, 0x1b, 0x4b, 0xef, 0x1d, 0x5c, 0x7f, 0x74, 0x48,
+    0x27, 0x2c, 0xa0, 0xf8, 0x6c, 0x2f, 0xa9, 0xe5, 0x14, 0xe4, 0xb1, 0x7b,
+    0x68, 0x75, 0x00, 0x75, 0xcf, 0xde, 0x99, 0x12, 0x64, 0x09, 0x56, 0x99,
+    0x13, 0xd7, 0x2f, 0xb5, 0x30, 0x8d, 0x04, 0x84, 0x89, 0x00, 0x5a, 0x6f,
+    0xe5, 0xe1, 0x5d, 0x7b, 0xf9, 0x3a, 0x7e, 0xbf, 0x45, 0x9f, 0x3c, 0x73,
+    0x84, 0x00, 0x0e, 0x63, 0xff, 0x00, 0x92, 0x94, 0xe2, 0xb8, 0x22, 0x5f,
+    0x11, 0x0e, 0x58, 0x04, 0x18, 0x27, 0x95, 0xa9, 0xb0, 0x09, 0x0f, 0xab,
+    0x15, 0x3a, 0x86, 0x8d, 0xfa, 0xf6, 0xa4, 0xca, 0x15, 0xc1, 0x50, 0x33,
+    0x10, 0x45, 0xf7, 0xf3, 0x8a, 0xe9, 0xc1, 0xba, 0xb4, 0x00, 0x0b, 0x9e,
+    0x57, 0xf5, 0xa6, 0x7f, 0x90, 0x64, 0xa7, 0x24, 0x6d, 0xdf, 0x9a, 0xa7,
+    0x9f, 0x8c, 0x69, 0xaa, 0xf3, 0x53, 0x51, 0x44, 0x46, 0x60, 0x6e, 0xe3,
+    0x61, 0xf4, 0x17, 0xbd, 0xfc, 0x42, 0xb0, 0xe1, 0xca, 0x95, 0xce, 0xb1,
+    0x13, 0x27, 0x6a, 0x66, 0x11, 0x94, 0x80, 0x02, 0xf3, 0x3e, 0x5b, 0x75,
+    0xf7, 0xa5, 0x4e, 0xf2, 0xf7, 0x00, 0x90, 0x32, 0xf5, 0xef, 0x43, 0x19,
+    0x49, 0x33, 0x03, 0x28, 0xe5, 0xf2, 0xfb, 0x57, 0x8a, 0x9d, 0x05, 0x86,
+    0x65, 0x86, 0xb6, 0x9b, 0x89, 0xea, 0xd4, 0x48, 0x2a, 0x64, 0x2d, 0xcd,
+    0xbf, 0xbd, 0xa8, 0x64, 0x04, 0xc0, 0x06, 0xe4, 0x40, 0xfe, 0x27, 0xa9,
+    0x34, 0xe8, 0xcc, 0x44, 0x5c, 0xcd, 0xa2, 0x48, 0xa1, 0x09, 0x6f, 0x98,
+    0x05, 0x66, 0x24, 0x01, 0x3c, 0xc0, 0xa0, 0xf3, 0x9a, 0x3b, 0xe7, 0xc0,
+    0xdf, 0xfd, 0xda, 0x87, 0x7a, 0xe0, 0x0d, 0x2e, 0x04, 0x1b, 0x75, 0x02,
+    0x8a, 0xb5, 0xc0, 0x19, 0x60, 0xdc, 0x4d, 0x08, 0x4d, 0x96, 0x50, 0x0c,
+    0xb2, 0xa4, 0xdd, 0x60, 0xc5, 0x66, 0xfe, 0xcf, 0xed, 0xbb, 0x03, 0x96,
+    0x04, 0x8d, 0x04, 0x1b, 0xd7, 0x7c, 0x90, 0x7b, 0xe1, 0xa0, 0x89, 0x8d,
+    0x67, 0xaf, 0x2a, 0xe7, 0xe2, 0xb0, 0xc9, 0xc5, 0x24, 0xcf, 0x7a, 0xfa,
+    0xcf, 0xd3, 0x5d, 0xea, 0x5d, 0x21, 0xf7, 0x88, 0x52, 0x69, 0x9d, 0x67,
+    0x10, 0xaa, 0x02, 0x14, 0x12, 0xa5, 0x88, 0x27, 0xc3, 0x9f, 0x5e, 0x14,
+    0x40, 0x80, 0xba, 0xc6, 0x6f, 0x97, 0xca, 0xa0, 0x22, 0x2d, 0x01, 0x73,
+    0x12, 0x01, 0xa7, 0x36, 0x69, 0x60, 0xb9, 0xf2, 0xe9, 0x3c, 0xff, 0x00,
+    0xaf, 0xb5, 0x59, 0xec, 0xac, 0x5a, 0x54, 0x21, 0x90, 0xae, 0x68, 0x80,
+    0x75, 0xfb, 0xd1, 0x46, 0x0c, 0x60, 0x81, 0x13, 0x13, 0x13, 0x37, 0x3d,
+    0x7c, 0xea, 0x64, 0x55, 0x0d, 0x04, 0x34, 0x41, 0x02, 0x66, 0x0c, 0x75,
+    0xed, 0x41, 0x8e, 0x40, 0x1e, 0x00, 0x56, 0x20, 0x0b, 0x7a, 0x79, 0xd3,
+    0x32, 0x48, 0x1a, 0x2e, 0x54, 0x98, 0x58, 0xe9, 0x5e, 0x18, 0xdd, 0xca,
+    0xa7, 0x8a, 0x72, 0x10, 0xaa, 0xc1, 0xdc, 0x88, 0xfc, 0xf9, 0x55, 0x01,
+    0x17, 0xf8, 0x13, 0x95, 0x84, 0x48, 0xf9, 0xc7, 0xd6, 0xa4, 0xcb, 0x9b,
+    0x66, 0x60, 0x67, 0x69, 0xbf, 0x87, 0x5a, 0xd2, 0x9c, 0x25, 0x2c, 0x35,
+    0xcd, 0xbf, 0x80, 0xaa, 0x19, 0x65, 0x32, 0xbb, 0x31, 0x5d, 0x2a, 0x8a,
+    0x91, 0x94, 0x91, 0x08, 0x9b, 0xe6, 0x7a, 0x94, 0xe0, 0x85, 0x00, 0x3f,
+    0xc5, 0x31, 0x1a, 0xd2, 0x03, 0x99, 0xb3, 0x93, 0x26, 0xd2, 0x63, 0xed,
+    0xea, 0x2a, 0x3b, 0x00, 0x40, 0x10, 0xd7, 0x04, 0xe5, 0xf3, 0xa2, 0x77,
+    0x2c, 0x3b, 0xac, 0x24, 0x92, 0x3d, 0xe7, 0xad, 0x29, 0xa5, 0x2d, 0x4c,
+    0x36, 0x04, 0x88, 0x11, 0x26, 0xd1, 0x23, 0xad, 0x68, 0xa8, 0x94, 0x80,
+    0x44, 0xb4, 0xf9, 0xc7, 0x85, 0x4c, 0xc3, 0x0c, 0x26, 0x72, 0xa6, 0x34,
+    0x20, 0x5c, 0x78, 0x51, 0x32, 0x1b, 0x30, 0x2d, 0xcc, 0xf2, 0x14, 0x21,
+    0x02, 0x0a, 0xa3, 0x02, 0x0c, 0x0b, 0xf8, 0x89, 0xeb, 0xeb, 0x46, 0xc5,
+    0x80, 0x50, 0x77, 0xee, 0xfc, 0xaf, 0xe7, 0xa1, 0xa5, 0x89, 0x20, 0x92,
+    0x40, 0xe6, 0x6d, 0xf8, 0xf1, 0xa8, 0x54, 0x23, 0x5e, 0xe1, 0x6e, 0x33,
+    0x0e, 0xb7, 0xa1, 0x08, 0x12, 0x4a, 0x83, 0x87, 0x30, 0x0d, 0xaf, 0x7f,
+    0x2a, 0x2c, 0x2e, 0x00, 0x0b, 0xac, 0x58, 0x6d, 0x3c, 0xbe, 0x74, 0xa4,
+    0x85, 0x98, 0xcc, 0x58, 0x91, 0x68, 0x22, 0x63, 0xe9, 0x4e, 0x4b, 0x07,
+    0x50, 0x48, 0x0a, 0x26, 0x24, 0x69, 0x6a, 0x10, 0x83, 0x16, 0x9e, 0x63,
+    0x9a, 0x9b, 0x03, 0xce, 0x8c, 0x41, 0x0c, 0x86, 0xe3, 0x50, 0x3f, 0x8f,
+    0x2a, 0x68, 0xcd, 0x94, 0x09, 0x16, 0xb8, 0xcb, 0x31, 0xe7, 0xe9, 0x4a,
+    0xc0, 0x00, 0xd9, 0x59, 0x84, 0x1b, 0xfa, 0x8f, 0x6f, 0xcd, 0x1b, 0xa1,
+    0x74, 0xe0, 0x32, 0x62, 0x12, 0x4c, 0x95, 0xd0, 0xaa, 0xf3, 0xea, 0x69,
+    0xf0, 0x14, 0xb9, 0x5d, 0x64, 0x6b, 0x26, 0xb9, 0x57, 0x1d, 0x13, 0x15,
+    0x8b, 0x93, 0x0c, 0x08, 0x36, 0xf4, 0xad, 0x1c, 0x24, 0xce, 0xd2, 0x6e,
+    0xa4, 0x4d, 0xed, 0x7a, 0xe7, 0xf8, 0xc6, 0x1f, 0xec, 0x73, 0xfb, 0x9f,
+    0x0b, 0xb5, 0x1e, 0xa3, 0xc9, 0x55, 0xcf, 0x1f, 0x66, 0xed, 0x36, 0x2a,
+    0x96, 0x90, 0xad, 0x72, 0x2f, 0x2d, 0x22, 0xfd, 0x7f, 0x74, 0x64, 0x00,
+    0x4e, 0x50, 0x67, 0x5d, 0x87, 0x5b, 0x54, 0x2d, 0x73, 0x0c, 0x4a, 0x6e,
+    0x63, 0x5a, 0x85, 0x72, 0x13, 0x06, 0x32, 0x8d, 0x8d, 0xcf, 0x89, 0x15,
+    0xad, 0x5f, 0x2e, 0xa8, 0xd7, 0x32, 0x20, 0x8b, 0x93, 0xb8, 0xb7, 0xd2,
+    0xaf, 0xc2, 0x0a, 0xb8, 0x59, 0x8a, 0xf7, 0xb3, 0x4c, 0xcc, 0x4d, 0x51,
+    0x24, 0x40, 0x17, 0x61, 0x69, 0x23, 0x96, 0xd4, 0xea, 0x65, 0xf3, 0x19,
+    0x8f, 0x4b, 0x5e, 0x9f, 0xa6, 0x76, 0x59, 0x05, 0xd4, 0xec, 0x36, 0x41,
+    0x1d, 0x4b, 0x49, 0xd8, 0xe8, 0xba, 0x18, 0x14, 0xca, 0x42, 0x81, 0xb1,
+    0xef, 0x5f, 0xde, 0xa6, 0x62, 0x30, 0xc1, 0x2c, 0x02, 0xe9, 0x23, 0x71,
+    0xa7, 0x8d, 0x40, 0x58, 0x80, 0x23, 0x31, 0x06, 0x2f, 0xa4, 0xeb, 0x7a,
+    0x22, 0x00, 0x52, 0x55, 0x55, 0x0d, 0xf5, 0xfb, 0xfc, 0xea, 0xdd, 0x6c,
+    0x12, 0x40, 0x20, 0x2e, 0x59, 0x89, 0x31, 0xf3, 0xfe, 0xaa, 0x22, 0x96,
+    0xca, 0x58, 0x9c, 0xda, 0x00, 0x7c, 0xb9, 0x54, 0xc3, 0x2c, 0xaa, 0x60,
+    0xaa, 0xe6, 0x03, 0x53, 0x36, 0xfb, 0x54, 0x59, 0x32, 0x6c, 0x44, 0x88,
+    0x20, 0xe5, 0x3a, 0x50, 0x84, 0xe0, 0x81, 0x94, 0x11, 0x95, 0x66, 0x49,
+    0x00, 0xc6, 0x94, 0x27, 0x31, 0xbc, 0x49, 0x00, 0xcc, 0x5c, 0x0f, 0xbd,
+    0x06, 0x04, 0x42, 0x80, 0xf3, 0x39, 0xbf, 0x3d, 0x5e, 0x8c, 0x10, 0x86,
+    0x5a, 0x63, 0x9e, 0xfa, 0xd0, 0x84, 0x58, 0x3c, 0x99, 0x40, 0x40, 0xdc,
+    0x79, 0xe9, 0xad, 0x73, 0x62, 0xb1, 0x6c, 0x4b, 0xda, 0x06, 0xe7, 0x5e,
+    0x54, 0xf8, 0xcf, 0x87, 0x85, 0x84, 0xee, 0xc4, 0x05, 0x59, 0x2c, 0xc4,
+    0x48, 0x03, 0xe5, 0xe1, 0x59, 0xbd, 0x97, 0xc7, 0xe0, 0x71, 0xe1, 0x99,
+    0x14, 0x26, 0x20, 0x19, 0x9f, 0x0c, 0x8b, 0xaf, 0xf7, 0xe7, 0xe5, 0x53,
+    0xe8, 0xa2, 0x71, 0xcd, 0x20, 0x1a, 0x05, 0x3a, 0x96, 0x96, 0x67, 0xb1,
+    0xd3, 0xb5, 0xa4, 0xb5, 0xba, 0x13, 0xd2, 0xff, 0x00, 0xbf, 0xb7, 0x0b,
+    0xac, 0x09, 0x43, 0x9e, 0x49, 0x98, 0x23, 0x99, 0xe7, 0x14, 0xf0, 0x03,
+    0x19, 0xb0, 0xd2, 0x47, 0x3f, 0x97, 0x51, 0x51, 0x50, 0xac, 0xe6, 0x9c,
+    0xb1, 0x27, 0xc6, 0xfe, 0x3d, 0x7b, 0xd1, 0x66, 0xee, 0x09, 0x98, 0x8d,
+    0x48, 0x99, 0xa9, 0x2f, 0x7d, 0x94, 0x86, 0x94, 0x01, 0x2c, 0x48, 0xf8,
+    0x63, 0x96, 0x9f, 0x8a, 0xe7, 0xe2, 0x8b, 0x0c, 0x59, 0xcc, 0xac, 0xa4,
+    0xdc, 0xcd, 0xab, 0xa4, 0x01, 0x97, 0x29, 0x79, 0x07, 0xc7, 0x4f, 0x23,
+    0x5c, 0x3c, 0x47, 0x79, 0xdc, 0x91, 0x96, 0xe6, 0xc2, 0xe3, 0xda, 0xab,
+    0x2a, 0xa5, 0xb8, 0xb2, 0xd3, 0x70, 0xdc, 0x22, 0x4a, 0x92, 0xf3, 0xfe,
+    0x47, 0xd4, 0xe9, 0xf9, 0x4b, 0x0c, 0x05, 0xc5, 0x88, 0xcb, 0x6d, 0x4f,
+    0xe2, 0x82, 0x10, 0x55, 0x48, 0x03, 0x2b, 0x5a, 0x35, 0x1a, 0xf2, 0xa1,
+    0x0d, 0x9d, 0x43, 0x64, 0x1b, 0x58, 0x69, 0xe5, 0x50, 0xe5, 0x20, 0xc0,
+    0x31, 0xb0, 0x3e, 0x1d, 0x0e, 0xb4, 0xaf, 0x5b, 0xc4, 0x54, 0x00, 0x75,
+    0x1c, 0xe1, 0xaf, 0x1c, 0xba, 0xf3, 0xa8, 0xc2, 0x3b, 0xb2, 0x4b, 0x0b,
+    0x40, 0x6a, 0x02, 0x08, 0x96, 0x81, 0xbc, 0x1b, 0xf3, 0x34, 0xb8, 0x9d,
+    0xe0, 0x58, 0xc4, 0x9b, 0x83, 0x1a, 0xf3, 0xbf, 0x2d, 0x68, 0x42, 0xb0,
+    0xe8, 0x01, 0x24, 0x03, 0x22, 0x07, 0x38, 0xaa, 0xf3, 0x10, 0x84, 0x12,
+    0x41, 0x04, 0x58, 0xda, 0x3c, 0x39, 0x53, 0xac, 0x01, 0x04, 0xce, 0x61,
+    0x90, 0xc7, 0x5d, 0x45, 0x02, 0xd0, 0xc0, 0x4e, 0x86, 0x40, 0x6d, 0x0d,
+    0x08, 0x44, 0x84, 0xc9, 0x22, 0x27, 0x60, 0xbe, 0x54, 0x2c, 0x14, 0xe6,
+    0x25, 0x58, 0xc0, 0x81, 0xb7, 0x87, 0xb7, 0xbd, 0x13, 0x65, 0x20, 0x0b,
+    0x98, 0x33, 0xa8, 0xfe, 0xe8, 0x67, 0x19, 0xcb, 0x31, 0x93, 0x16, 0x36,
+    0xa1, 0x0a, 0x32, 0xe6, 0x82, 0xc1, 0x8b, 0x44, 0x1f, 0xee, 0x2a, 0x00,
+    0x1d, 0x03, 0x28, 0xcd, 0x9b, 0x63, 0x02, 0x6f, 0xb7, 0xbd, 0x02, 0xa4,
+    0x92, 0x00, 0x96, 0xf1, 0xfa, 0x51, 0x53, 0x08, 0x58, 0xa4, 0x01, 0xa1,
+    0x3b, 0x8f, 0x3a, 0x10, 0x8b, 0x06, 0xca, 0xa0, 0xb4, 0x20, 0xd7, 0xdc,
+    0x13, 0x4b, 0x1d, 0xf1, 0x6f, 0xfd, 0xb3, 0x02, 0x44, 0xef, 0xf6, 0xa7,
+    0x59, 0xbb, 0x92, 0x4a, 0x8b, 0xcc, 0x44, 0xc5, 0x2b, 0x00, 0x01, 0x92,
+    0x2d, 0xa1, 0xd8, 0x9f, 0xb7, 0xe6, 0x84, 0x28, 0xb9, 0x55, 0xb5, 0x6f,
+    0x45, 0xe7, 0x1c, 0xab, 0x4b, 0x81, 0x39, 0xf0, 0x54, 0x5f, 0x28, 0xb5,
+    0xad, 0x36, 0xe6, 0x3a, 0xb5, 0x67, 0x42, 0xe5, 0xc8, 0x0b, 0x89, 0x81,
+    0x04, 0x48, 0x11, 0xf9, 0xae, 0xae, 0xcd, 0x69, 0x66, 0x55, 0x16, 0x2b,
+    0x3d, 0xdb, 0x41, 0x07, 0xf3, 0xad, 0x54, 0xe3, 0x54, 0xe2, 0x6a, 0x62,
+    0x79, 0xb7, 0x55, 0x1a, 0xad, 0xb7, 0x8e, 0xfd, 0x15, 0xb2, 0x48, 0x2a,
+    0x54, 0x6f, 0xd0, 0xa8, 0xd9, 0x8b, 0x8b, 0x93, 0x11, 0xb5, 0x06, 0xcb,
+    0x26, 0xf9, 0x49, 0xde, 0x98, 0x1b, 0x44, 0x66, 0x9d, 0xc1, 0x9f, 0x7f,
+    0x4a, 0x5a, 0xf9, 0x45, 0x41, 0x24, 0x12, 0x0e, 0xd3, 0xe0, 0x2d, 0x4a,
+    0x00, 0x60, 0x49, 0xca, 0x09, 0xdb, 0xad, 0xe8, 0xc0, 0x05, 0xce, 0xab,
+    0x31, 0x73, 0x51, 0x82, 0xe1, 0xac, 0x92, 0x14, 0x00, 0x64, 0xcc, 0x58,
+    0x6b, 0xfe, 0xd0, 0x05, 0xf4, 0x5e, 0x81, 0x7d, 0x02, 0xe8, 0x49, 0x75,
+    0x33, 0x7c, 0x4b, 0x9b, 0xdb, 0x73, 0xf8, 0xa6, 0x61, 0x17, 0x04, 0x80,
+    0x05, 0xf3, 0x5f, 0x31, 0xe6, 0x7d, 0x3e, 0x95, 0xe1, 0x7b, 0x63, 0xb5,
+    0x31, 0x71, 0xfb, 0x45, 0x1b, 0x01, 0xca, 0xae, 0x10, 0x3f, 0xb4, 0xc0,
+    0xe5, 0x32, 0x44, 0x13, 0xeb, 0xe9, 0x6a, 0xd2, 0xec, 0xff, 0x00, 0xd4,
+    0xf0, 0x06, 0x0f, 0x68, 0x2b, 0x34, 0x44, 0xe2, 0xa0, 0xf7, 0x23, 0xe6,
+    0x6d, 0xf2, 0xad, 0x8b, 0x70, 0x6a, 0xa6, 0xc0, 0xd9, 0x08, 0xb9, 0x23,
+    0x51, 0xcc, 0x7e, 0x7b, 0xfb, 0xd7, 0x5e, 0xa7, 0xe1, 0x2c, 0x4f, 0xf8,
+    0xf8, 0xaa, 0x48, 0xcc, 0xe2, 0x2e, 0x5b, 0xfe, 0x87, 0x4d, 0xf7, 0x36,
+    0xdf, 0x9d, 0xf4, 0xb2, 0xf5, 0x04, 0x1d, 0xc9, 0x2c, 0x04, 0xcf, 0xa7,
+    0xbd, 0x00, 0x33, 0x3e, 0x59, 0xef, 0x03, 0x37, 0x37, 0xae, 0x4c, 0x1e,
+    0xd3, 0xe0, 0xb1, 0x86, 0x11, 0x4e, 0x2b, 0x09, 0xb3, 0xd8, 0x29, 0x68,
+    0x3a, 0xf2, 0xd6, 0xaf, 0x67, 0x51, 0x82, 0xd8, 0x98, 0x85, 0x53, 0x28,
+    0x0c, 0x09, 0x68, 0xf5, 0xe4, 0x2a, 0xbd, 0xd1, 0xbd, 0x86, 0xce, 0x04,
+    0x15, 0x4b, 0x2d, 0x3c, 0xb0, 0xbb, 0x24, 0x8d, 0x20, 0xf4, 0x20, 0x82,
+    0xad, 0x2d, 0xa4, 0x12, 0x35, 0xef, 0x4c, 0x88, 0xdf, 0xe9, 0x4a, 0x8c,
+    0x14, 0x4a, 0x92, 0x35, 0xb6, 0x80, 0x9f, 0x0a, 0xe1, 0xe2, 0xbb, 0x67,
+    0x80, 0xe1, 0x4a, 0xbf, 0xfd, 0x46, 0x1e, 0x21, 0x32, 0x63, 0x05, 0xb3,
+    0x4e, 0xf0, 0x62, 0xc3, 0xd6, 0x2b, 0xcb, 0x76, 0xe7, 0x6e, 0xe3, 0x71,
+    0xa0, 0xe0, 0x60, 0x07, 0xc1, 0xe1, 0xd9, 0x48, 0x82, 0x41, 0x2c, 0x3e,
+    0xc2, 0x36, 0xf3, 0xd6, 0xa6, 0xd2, 0xe1, 0x93, 0xd4, 0x1d, 0x05, 0x87,
+    0x53, 0xfb, 0xaa, 0xb9, 0xc3, 0x38, 0x6e, 0xbb, 0x10, 0x78, 0x01, 0x85,
+    0xad, 0xe6, 0xe7, 0x0b, 0x0f, 0x2e, 0xbe, 0x5e, 0x64, 0x2e, 0x8f, 0xd5,
+    0x3d, 0xad, 0x87, 0xc4, 0x38, 0xe1, 0x38, 0x53, 0x9f, 0x09, 0x5a, 0x59,
+    0xd4, 0xd9, 0xc8, 0xd8, 0x73, 0x1f, 0x70, 0x3d, 0x70, 0xf0, 0x71, 0x4e,
+    0x0e, 0x26, 0x1e, 0x2e, 0x0b, 0x05, 0xc5, 0x07, 0xba, 0x41, 0xf5, 0xd7,
+    0xcb, 0xd2, 0x90, 0x1e, 0xe2, 0x90, 0xa0, 0xb6, 0xb6, 0xfb, 0xfc, 0xaa,
+    0x04, 0x62, 0xa4, 0x91, 0x97, 0x9e, 0xdb, 0xd6, 0xca, 0x9e, 0x9a, 0x3a,
+    0x78, 0xc4, 0x4c, 0x1a, 0x7d, 0xd7, 0x5e, 0xa0, 0xc3, 0x20, 0xa0, 0xa6,
+    0x14, 0xb1, 0x0f, 0x77, 0x9d, 0xf9, 0xdf, 0x7b, 0xf8, 0xaf, 0x7d, 0xd9,
+    0x7c, 0x5a, 0xf1, 0x9c, 0x1a, 0xe2, 0x82, 0x49, 0x02, 0x1d, 0x22, 0x21,
+    0x80, 0x13, 0xbe, 0x91, 0x7f, 0x23, 0x5d, 0xa4, 0x1c, 0xad, 0x04, 0x15,
+    0x37, 0xb0, 0x91, 0xe1, 0xf6, 0xaf, 0x13, 0xfa, 0x67, 0x8b, 0x3c, 0x3f,
+    0x69, 0xe1, 0xe1, 0x82, 0x17, 0x07, 0x17, 0xba, 0xca, 0x44, 0x89, 0xdb,
+    0xdf, 0x7f, 0x13, 0xe6, 0x3d, 0xb3, 0x80, 0x50, 0x00, 0x05, 0xc9, 0x31,
+    0x6a, 0xc9, 0xe2, 0xb1, 0x7b, 0x2c, 0xb9, 0x46, 0xc7, 0x50, 0xb9, 0x96,
+    0x3b, 0x86, 0x0c, 0x3a, 0xac, 0xb1, 0x9f, 0x0b, 0xb5, 0x1f, 0x8f, 0x2f,
+    0xb5, 0x92, 0xb0, 0xd5, 0xd4, 0xe6, 0x1a, 0xc0, 0x3e, 0xff, 0x00, 0x5a,
+    0xce, 0x86, 0x66, 0x37, 0x07, 0x3d, 0xce, 0xfb, 0x69, 0xe3, 0xb6, 0x95,
+    0xa4, 0xd3, 0xa2, 0x88, 0x39, 0x6f, 0x17, 0xf3, 0x8a, 0xce, 0x20, 0x80,
+    0x66, 0xce, 0x4c, 0x18, 0xbc, 0xf9, 0x55, 0x03, 0xa4, 0xce, 0x55, 0xc7,
+    0x0a, 0x91, 0xfd, 0xbd, 0x74, 0xf5, 0x55, 0xb4, 0x1c, 0x33, 0x6d, 0x23,
+    0x5b, 0xed, 0xcb, 0xd6, 0x98, 0x77, 0xb2, 0x93, 0xff, 0x00, 0xea, 0x08,
+    0xa5, 0x52, 0x20, 0x19, 0x39, 0x64, 0xd8, 0x0f, 0x5d, 0x3e, 0x54, 0xe9,
+    0x2a, 0x04, 0x77, 0x58, 0xe8, 0x20, 0x0b, 0x5a, 0x92, 0xb6, 0x09, 0x7f,
+    0x97, 0x78, 0x9c, 0xac, 0x75, 0x6f, 0x96, 0x9b, 0x54, 0x83, 0x9e, 0xe7,
+    0xbf, 0x17, 0x3c, 0xc4, 0x7f, 0xb4, 0x6e, 0x47, 0x7a, 0x0c, 0x9b, 0xc9,
+    0xdb, 0x94, 0x8e, 0xbe, 0x75, 0x32, 0x36, 0x63, 0x20, 0x96, 0x22, 0xc0,
+    0x44, 0x79, 0x0a, 0x10, 0x85, 0xc3, 0x58, 0x1c, 0xa3, 0xba, 0x46, 0x91,
+    0x46, 0x49, 0x60, 0xac, 0x41, 0x1f, 0xfb, 0x1d, 0x7c, 0xba, 0xd6, 0xa0,
+    0x08, 0x54, 0x29, 0x07, 0x50, 0x34, 0xd6, 0xdc, 0xe8, 0xb3, 0xce, 0x56,
+    0x12, 0x26, 0xfc, 0x89, 0xa1, 0x09, 0x54, 0x11, 0x9a, 0x4c, 0x41, 0x24,
+    0xce, 0xa7, 0xaf, 0xea, 0x9c, 0xb0, 0x23, 0x36, 0x69, 0x91, 0x04, 0x4f,
+    0xca, 0x90, 0x77, 0x67, 0x56, 0xb9, 0x26, 0xf3, 0xd7, 0xe6, 0x89, 0x30,
+    0xc2, 0x6e, 0x62, 0xf7, 0x8a, 0x10, 0x81, 0x93, 0x91, 0x5a, 0x4c, 0x44,
+    0x5b, 0x71, 0x15, 0x15, 0x75, 0x04, 0x9c, 0xc6, 0xf0, 0x34, 0xa5, 0x2a,
+    0xcc, 0xa0, 0x49, 0x55, 0x3a, 0x75, 0x3d, 0x4d, 0x1c, 0xb2, 0x20, 0x82,
+    0x58, 0x69, 0x6b, 0x4f, 0x47, 0xda, 0x84, 0x22, 0x81, 0x82, 0xb0, 0x31,
+    0x96, 0x48, 0xbd, 0xaf, 0x53, 0x12, 0x41, 0xcc, 0x01, 0xcb, 0xad, 0xbe,
+    0xf4, 0xc1, 0x73, 0xa1, 0x22, 0x54, 0x03, 0x22, 0x06, 0xa7, 0xa1, 0x4a,
+    0x09, 0x81, 0x2c, 0x40, 0x06, 0x00, 0xcb, 0x3e, 0xd4, 0x21, 0x13, 0x39,
+    0x5a, 0x09, 0xcd, 0x1c, 0xcc, 0x2f, 0xf7, 0x5d, 0x5d, 0x9a, 0x63, 0x8a,
+    0x50, 0xc4, 0x92, 0xea, 0x40, 0xcd, 0xa0, 0x20, 0xde, 0xde, 0x9e, 0x35,
+    0xca, 0x0a, 0x83, 0x09, 0x22, 0xda, 0x91, 0xfd, 0x57, 0x6f, 0x63, 0x04,
+    0x3c, 0x5e, 0x26, 0x69, 0x2e, 0x11, 0x88, 0xbc, 0xc5, 0xc4, 0xdb, 0xd4,
+    0xeb, 0x51, 0xab, 0x40, 0x30, 0x3c, 0x1e, 0x89, 0x8a, 0x92, 0x04, 0x4e,
+    0xbf, 0x44, 0xc0, 0x77, 0x63, 0x2c, 0x0d, 0xc0, 0xbf, 0xa5, 0x45, 0x20,
+    0xc3, 0x0b, 0x6a, 0x6d, 0x5e, 0x33, 0x0f, 0xb5, 0xb8, 0xdc, 0x3c, 0x30,
+    0x0e, 0x3b, 0x15, 0xe6, 0x40, 0x63, 0x1e, 0xa2, 0x7a, 0xda, 0x97, 0x17,
+    0xb4, 0xb8, 0xd7, 0xca, 0x71, 0x71, 0xdd, 0x62, 0x60, 0xa9, 0xc9, 0x1a,
+    0x72, 0x8a, 0xd0, 0x0e, 0x12, 0xaa, 0xcd, 0xab, 0xdb, 0x6f, 0x3f, 0xb5,
+    0xbd, 0x57, 0x08, 0x1c, 0x07, 0x5b, 0x9a, 0xc6, 0x46, 0x5b, 0xce, 0xff,
+    0x00, 0x2b, 0x7a, 0xaf, 0x5d, 0xc4, 0x71, 0x38, 0x1c, 0x32, 0x83, 0x8d,
+    0x8c, 0xa8, 0x36, 0x06, 0xe4, 0x9b, 0x49, 0x8a, 0xf2, 0xfd, 0xab, 0xda,
+    0xed, 0xc6, 0x61, 0x64, 0x40, 0x53, 0x00, 0x5a, 0x24, 0x4b, 0x78, 0xfd,
+    0x2d, 0xf8, 0xac, 0xe5, 0x66, 0x72, 0xe5, 0xa5, 0x98, 0x99, 0x3b, 0x9b,
+    0xef, 0xe7, 0x44, 0x8c, 0xc4, 0xb4, 0xc8, 0x55, 0x95, 0x8f, 0x5a, 0xbf,
+    0xc3, 0x78, 0x7a, 0x0a, 0x27, 0x09, 0x1e, 0x73, 0xbc, 0x73, 0xe4, 0x3c,
+    0x07, 0xa9, 0xf2, 0xb2, 0xd5, 0x60, 0xdc, 0x27, 0x4d, 0x86, 0xb8, 0x4d,
+    0x21, 0xcf, 0x20, 0xd8, 0x9d, 0x00, 0xf0, 0x1d, 0x7b, 0xcf, 0x95, 0x95,
+    0x2d, 0x60, 0x57, 0x24, 0x89, 0xf4, 0xea, 0x7e, 0x74, 0xa0, 0x90, 0x91,
+    0x00, 0x5c, 0xc8, 0x3c, 0x8d, 0x3e, 0x25, 0x9c, 0x8d, 0xa6, 0x64, 0x75,
+    0xce, 0xa1, 0x86, 0x54, 0x32, 0x4c, 0x11, 0xa8, 0x8f, 0x6f, 0x3a, 0xbf,
+    0x5d, 0x92, 0x10, 0x04, 0x6d, 0x03, 0xa0, 0x48, 0x02, 0xb2, 0x96, 0x56,
+    0x22, 0xda, 0x6f, 0x1d, 0x7d, 0x28, 0xb6, 0x1b, 0x28, 0x0a, 0x49, 0x89,
+    0xb4, 0x1d, 0x7c, 0x2e, 0x6d, 0x53, 0x29, 0x32, 0x0d, 0x96, 0x0f, 0x79,
+    0x4d, 0x88, 0xd3, 0x7a, 0x00, 0x98, 0x64, 0x30, 0x4a, 0xdd, 0x4b, 0x50,
+    0x9d, 0x52, 0x31, 0x3c, 0x03, 0xad, 0xe4, 0x1d, 0x07, 0x2a, 0x1d, 0xe7,
+    0x7c, 0xa1, 0xf5, 0x02, 0xdf, 0x10, 0xa7, 0x22, 0xe0, 0xb6, 0x8d, 0x17,
+    0x9d, 0x7a, 0x9a, 0x0b, 0x27, 0x2b, 0x33, 0x58, 0xe8, 0x79, 0x75, 0x06,
+    0x84, 0x22, 0xc0, 0x80, 0x64, 0x40, 0x88, 0x89, 0xd7, 0x99, 0xfa, 0x50,
+    0x4c, 0xc5, 0x25, 0x67, 0xc0, 0x1b, 0xdb, 0xc7, 0xde, 0xa0, 0xca, 0x59,
+    0x43, 0x11, 0x23, 0x69, 0x83, 0x6f, 0x1f, 0x97, 0xbd, 0x46, 0xca, 0x01,
+    0x51, 0x71, 0xa5, 0xf6, 0xeb, 0xad, 0xa8, 0x42, 0x38, 0x6e, 0x70, 0xf1,
+    0x95, 0xb0, 0xd8, 0x2b, 0x29, 0x10, 0xc1, 0xa0, 0x83, 0x22, 0xe3, 0x95,
+    0x7d, 0x24, 0x3a, 0x90, 0x31, 0x11, 0xa7, 0x3e, 0x99, 0x44, 0x8e, 0xbc,
+    0xab, 0xe6, 0x44, 0xb6, 0x5d, 0xc1, 0xbd, 0xce, 0xe7, 0xcf, 0xd6, 0xbe,
+    0x8f, 0xd9, 0xa1, 0xf0, 0xf8, 0x0c, 0x0c, 0x3c, 0x43, 0x95, 0x93, 0x09,
+    0x55, 0x85, 0xa0, 0x18, 0xb8, 0xf6, 0xac, 0x97, 0x15, 0xb8, 0x31, 0x91,
+    0xba, 0xfa, 0xeb, 0xe8, 0xb0, 0xfc, 0x68, 0xc6, 0xe5, 0x85, 0xd7, 0xd7,
+    0x5f, 0x4f, 0xb7, 0xaa, 0xb5, 0x0f, 0x72, 0x60, 0x13, 0x3e, 0x63, 0x5a,
+    0xe0, 0xc7, 0x5f, 0xdb, 0x77, 0x20, 0xcc, 0x10, 0x4c, 0xf5, 0xe9, 0x5a,
+    0x0c, 0xb0, 0xf9, 0x73, 0x6a, 0x45, 0x86, 0xc2, 0x2b, 0x9f, 0x8e, 0x04,
+    0xaa, 0x97, 0x11, 0xea, 0x2d, 0xf3, 0xf5, 0xac, 0x2c, 0x15, 0x00, 0xcb,
+    0x94, 0xf3, 0x54, 0xbc, 0x39, 0x3f, 0x65, 0x55, 0x90, 0xff, 0x00, 0xa1,
+    0x6f, 0x3d, 0xd7, 0x18, 0x04, 0xe2, 0x0d, 0x75, 0x8b, 0x1a, 0x2c, 0xd9,
+    0x71, 0x2c, 0x82, 0x48, 0x9e, 0xef, 0xe2, 0xf5, 0x01, 0x19, 0x33, 0x10,
+    0xa1, 0xa6, 0xd6, 0xbd, 0x0c, 0xd9, 0x88, 0x2e, 0x2e, 0x4d, 0x83, 0x5b,
+    0xeb, 0xe3, 0x56, 0x4b, 0x7a, 0x94, 0xc8, 0xce, 0x08, 0x39, 0xa2, 0x4c,
+    0xdf, 0xcc, 0x18, 0xa3, 0x20, 0x21, 0x0b, 0x22, 0x49, 0x1e, 0x7d, 0x5e,
+    0xa4, 0x66, 0x00, 0x19, 0x20, 0x73, 0xb0, 0x3a, 0xc7, 0x5f, 0x5a, 0x98,
+    0xa2, 0x40, 0x19, 0x4c, 0x93, 0x24, 0x6d, 0xb7, 0xf9, 0x42, 0x11, 0x19,
+    0x9a, 0x48, 0x17, 0xb8, 0xb5, 0xa3, 0x58, 0xa8, 0xd9, 0x81, 0x00, 0x09,
+    0x3b, 0x5a, 0x4c, 0x75, 0xf5, 0xa2, 0x52, 0xe7, 0x3b, 0x16, 0x89, 0xb7,
+    0xae, 0xb4, 0xae, 0x6e, 0x7b, 0xad, 0x0d, 0x01, 0x4f, 0x31, 0xd4, 0xd0,
+    0x84, 0xe5, 0xb3, 0x88, 0xc3, 0x72, 0x0d, 0xcc, 0x7e, 0x37, 0xa5, 0x68,
+    0x01, 0xa6, 0x24, 0x89, 0x91, 0xcf, 0x4f, 0xb5, 0x12, 0x3e, 0x16, 0x00,
+    0x10, 0x6d, 0x3b, 0x7c, 0xfe, 0x54, 0x0c, 0x89, 0x80, 0x39, 0x77, 0x68,
+    0x42, 0x04, 0x10, 0x17, 0x5b, 0x11, 0x02, 0xda, 0xed, 0xf5, 0x15, 0x17,
+    0xff, 0x00, 0x2a, 0xe6, 0x12, 0x46, 0xe0, 0x6a, 0x62, 0xa2, 0xa9, 0xcc,
+    0x19, 0x41, 0x53, 0x3a, 0x90, 0x47, 0xa5, 0x3b, 0x00, 0xbf, 0x11, 0x62,
+    0x23, 0x6d, 0x63, 0xa1, 0x42, 0x12, 0x4d, 0x89, 0x60, 0x73, 0x0b, 0x47,
+    0x5e, 0x74, 0xc5, 0x48, 0x78, 0x4b, 0x29, 0x37, 0x83, 0x71, 0x44, 0xde,
+    0x3b, 0xb7, 0xb8, 0x02, 0x63, 0xc6, 0x95, 0xc4, 0x09, 0x51, 0x27, 0x48,
+    0xd4, 0x50, 0x85, 0x08, 0x70, 0x09, 0x32, 0x6d, 0xbd, 0xb4, 0xf7, 0xad,
+    0x8f, 0xd3, 0x98, 0x45, 0x9b, 0x15, 0x9b, 0x50, 0xa1, 0x41, 0x81, 0x12,
+    0x6e, 0x63, 0xca, 0x05, 0x64, 0xb1, 0x90, 0x08, 0xf3, 0x24, 0x11, 0xaf,
+    0x2f, 0x7a, 0xf5, 0x7d, 0x91, 0xc2, 0x8e, 0x1f, 0x81, 0x44, 0x38, 0x60,
+    0x3b, 0x77, 0x9b, 0xbc, 0x6f, 0xb0, 0x31, 0xce, 0xa2, 0x56, 0x3b, 0xfa,
+    0xf2, 0xf5, 0x50, 0x31, 0x19, 0x72, 0x45, 0x6e, 0x65, 0x7f, 0xff, 0xd9,
+};
+
+static const uint8_t bench_jpeg_444[] = {
+    0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05,
+    0x04, 0x06, 0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a,
+    0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e, 0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18,
+    0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a, 0x1b, 0x23,
+    0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29,
+    0x19, 0x1f, 0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xff,
+    0xdb, 0x00, 0x43, 0x01, 0x07, 0x07, 0x07, 0x0a, 0x08, 0x0a, 0x13, 0x0a,
+    0x0a, 0x13, 0x28, 0x1a, 0x16, 0x1a, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xff, 0xc0, 0x00, 0x11,
+    0x08, 0x00, 0xf0, 0x00, 0xf0, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01,
+    0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x1b, 0x00, 0x00, 0x02, 0x03, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xc4, 0x00, 0x38,
+    0x10, 0x00, 0x02, 0x01, 0x02, 0x04, 0x03, 0x06, 0x05, 0x05, 0x00, 0x01,
+    0x04, 0x03, 0x01, 0x00, 0x00, 0x01, 0x02, 0x11, 0x00, 0x21, 0x03, 0x12,
+    0x31, 0x41, 0x04, 0x51, 0xf0, 0x05, 0x22, 0x61, 0x71, 0x81, 0xa1, 0x32,
+    0x91, 0xb1, 0xc1, 0xe1, 0x06, 0x13, 0x42, 0xd1, 0xf1, 0x52, 0x14, 0x23,
+    0x33, 0x62, 0x07, 0x43, 0x72, 0x15, 0xff, 0xc4, 0x00, 0x1c, 0x01, 0x01,
+    0x00, 0x01, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08,
+    0xff, 0xc4, 0x00, 0x40, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x03, 0x05,
+    0x07, 0x01, 0x06, 0x05, 0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x12, 0x41, 0x51, 0x61, 0x71, 0x81,
+    0x91, 0xb1, 0x06, 0x13, 0x22, 0xa1, 0xc1, 0xd1, 0xf0, 0xe1, 0x14, 0x32,
+    0x33, 0x42, 0x52, 0xf1, 0x15, 0x23, 0x34, 0x72, 0xb2, 0x53, 0x62, 0x07,
+    0x16, 0x17, 0x24, 0x82, 0x92, 0xd2, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01,
+    0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf9, 0x66, 0x1a, 0x80,
+    0x00, 0x64, 0x85, 0x2d, 0xb1, 0xb3, 0x1e, 0x75, 0xda, 0x42, 0x06, 0xb2,
+    0xe5, 0xac, 0xa5, 0x49, 0x24, 0x31, 0x83, 0xdd, 0x82, 0x62, 0xa5, 0xc2,
+    0x05, 0x6e, 0x59, 0x82, 0x01, 0x90, 0x26, 0xde, 0x37, 0xf3, 0xa9, 0x50,
+    0x89, 0x5b, 0x96, 0x02, 0x73, 0x41, 0x86, 0x26, 0xe2, 0x3c, 0xcf, 0xcb,
+    0xce, 0xa4, 0x46, 0x25, 0xd7, 0x1b, 0x0c, 0x39, 0x80, 0x12, 0x60, 0x7c,
+    0xfa, 0x9a, 0xcc, 0x91, 0x72, 0x65, 0xcb, 0x20, 0x1c, 0xb0, 0x48, 0x10,
+    0x4c, 0x45, 0xeb, 0x22, 0x45, 0xc9, 0x96, 0xe5, 0x56, 0x06, 0x55, 0x8e,
+    0x59, 0xf8, 0x87, 0xbd, 0xf5, 0xd2, 0xaa, 0x5e, 0x98, 0x55, 0x51, 0xe6,
+    0x44, 0x46, 0xa4, 0x98, 0xb9, 0xde, 0xa8, 0xd9, 0x7a, 0x60, 0x2a, 0x09,
+    0xb8, 0x80, 0xa2, 0x48, 0x06, 0x2b, 0x1b, 0x91, 0x7a, 0x09, 0x16, 0x52,
+    0x08, 0x17, 0x99, 0x07, 0x7a, 0xc1, 0x29, 0x19, 0x10, 0x72, 0x65, 0x58,
+    0x13, 0x31, 0xca, 0x22, 0xa3, 0xce, 0x66, 0x54, 0x17, 0x2a, 0xc0, 0x02,
+    0x42, 0x95, 0xb6, 0xbb, 0x4d, 0x44, 0x9c, 0xcc, 0x88, 0x44, 0x6e, 0xf0,
+    0x80, 0x62, 0x24, 0x9b, 0x72, 0xde, 0xa1, 0xd4, 0xa8, 0x65, 0x43, 0xa9,
+    0x52, 0xaf, 0x98, 0x4e, 0x5e, 0xec, 0x91, 0xa0, 0xa8, 0x55, 0x2a, 0x19,
+    0x50, 0x8c, 0xc1, 0x59, 0xa1, 0xa7, 0xd6, 0xa1, 0x54, 0xa8, 0x65, 0x45,
+    0x61, 0x5e, 0x33, 0x40, 0x00, 0x49, 0x8f, 0x96, 0x95, 0x0a, 0xa5, 0x43,
+    0x2a, 0x0c, 0xaf, 0xed, 0x8c, 0xc6, 0xc0, 0xc5, 0x80, 0x32, 0x79, 0xf9,
+    0xd4, 0x29, 0xd4, 0x32, 0xa2, 0x33, 0x00, 0xa5, 0x9d, 0xc0, 0x06, 0x24,
+    0x93, 0xa0, 0xf1, 0x8f, 0x3a, 0x89, 0x39, 0x99, 0xa1, 0x17, 0x27, 0x68,
+    0xab, 0xb3, 0x9d, 0xc4, 0xf6, 0x86, 0x70, 0x46, 0x12, 0xc8, 0x91, 0x04,
+    0xee, 0x3a, 0xde, 0xa2, 0x4a, 0xa5, 0xf6, 0x36, 0xf4, 0x72, 0xfe, 0x75,
+    0x1f, 0x87, 0xe7, 0xe7, 0x69, 0x8b, 0x1b, 0x15, 0xf1, 0x4c, 0x62, 0x62,
+    0x33, 0x19, 0x9c, 0xb7, 0x83, 0xe9, 0xa5, 0x62, 0x6e, 0xe4, 0xf8, 0x52,
+    0x85, 0x3f, 0xdd, 0x40, 0x71, 0x60, 0x58, 0x86, 0x52, 0x6d, 0x37, 0xf6,
+    0xaa, 0x19, 0x01, 0x98, 0xb6, 0x10, 0x20, 0x40, 0x00, 0x49, 0x8d, 0x05,
+    0xb4, 0xa0, 0x16, 0x55, 0x4a, 0xe5, 0x26, 0x1a, 0xe4, 0x81, 0xcf, 0xaf,
+    0xad, 0x00, 0x55, 0xc8, 0x2a, 0xe0, 0xb2, 0x62, 0x0d, 0x08, 0xb4, 0x5a,
+    0x81, 0xa4, 0xf4, 0x66, 0xde, 0x0f, 0xb4, 0xf1, 0xb0, 0x0a, 0x1c, 0x65,
+    0x18, 0xb8, 0x6a, 0x20, 0x4f, 0xf7, 0xf2, 0xe7, 0x55, 0x5a, 0x18, 0x65,
+    0x42, 0x2f, 0x6d, 0x0e, 0xef, 0x67, 0x71, 0x58, 0x1c, 0x6b, 0x01, 0x82,
+    0xc7, 0x30, 0x13, 0xfb, 0x6f, 0xb7, 0x2d, 0x2c, 0x74, 0xa9, 0x14, 0xed,
+    0x2d, 0x88, 0xb3, 0x84, 0xa1, 0xb9, 0xb7, 0x03, 0x2c, 0xc9, 0x02, 0x22,
+    0x7e, 0x1e, 0x86, 0xf5, 0x2e, 0x10, 0x2d, 0xb9, 0x62, 0xa1, 0x6c, 0xa8,
+    0x24, 0x41, 0x36, 0xd8, 0x78, 0xd4, 0xa8, 0x40, 0xad, 0xcb, 0x92, 0x18,
+    0x43, 0x13, 0x33, 0x06, 0x57, 0x43, 0xd0, 0xa9, 0x70, 0x81, 0x5b, 0x97,
+    0xe1, 0xa9, 0x54, 0xe5, 0xfc, 0x6d, 0xfd, 0x75, 0xad, 0x4c, 0x84, 0x0b,
+    0xae, 0x78, 0x54, 0xc3, 0x19, 0x0d, 0x89, 0x56, 0x02, 0x48, 0xdb, 0xfa,
+    0xde, 0xba, 0x98, 0x40, 0xf2, 0x2b, 0x97, 0x85, 0x02, 0x66, 0x58, 0x69,
+    0xde, 0xb4, 0xc8, 0xd6, 0xa4, 0xc2, 0x25, 0x6e, 0x59, 0x90, 0xcd, 0x8c,
+    0x92, 0x2d, 0xfd, 0xf8, 0xef, 0x52, 0x23, 0x12, 0xeb, 0x8e, 0x14, 0x94,
+    0x60, 0x01, 0x59, 0x26, 0xe7, 0x7d, 0xef, 0xe9, 0x59, 0x92, 0x2e, 0x4c,
+    0xb1, 0x14, 0x92, 0xb2, 0x40, 0x13, 0x22, 0x76, 0x1c, 0xeb, 0x22, 0x45,
+    0xc9, 0x8f, 0x90, 0xb2, 0x18, 0xd2, 0x48, 0x92, 0xb1, 0xf3, 0xab, 0x8b,
+    0xd3, 0x0c, 0x28, 0x80, 0xa0, 0x0c, 0xa3, 0xc0, 0xdf, 0xcf, 0xad, 0xaa,
+    0xd6, 0xcb, 0xd0, 0xe3, 0xe2, 0xca, 0x6c, 0x09, 0x92, 0x48, 0x93, 0xe9,
+    0xd6, 0xf5, 0x8e, 0x52, 0x2f, 0x41, 0x06, 0x57, 0x10, 0x09, 0x04, 0xb6,
+    0xdc, 0xbc, 0x3d, 0xeb, 0x0c, 0xa4, 0x64, 0x41, 0xfd, 0xb2, 0x04, 0x31,
+    0xd0, 0xde, 0xe2, 0x79, 0xd4, 0x69, 0xcc, 0xca, 0x80, 0x26, 0x22, 0x0a,
+    0xae, 0x93, 0x1a, 0xfe, 0x2a, 0x2c, 0xe6, 0x64, 0x45, 0x6a, 0x61, 0xb3,
+    0x33, 0x15, 0x62, 0x7d, 0x0f, 0x8d, 0x43, 0xa9, 0x50, 0xca, 0x83, 0x2b,
+    0x90, 0x18, 0xca, 0x0c, 0xc4, 0x19, 0x8e, 0xbf, 0xaa, 0x85, 0x52, 0xa1,
+    0x95, 0x0a, 0xb9, 0x89, 0x19, 0xbb, 0xc3, 0x69, 0xda, 0xa0, 0xd4, 0xa8,
+    0x65, 0x40, 0x60, 0x09, 0x10, 0x4c, 0x6a, 0xb3, 0x17, 0xf5, 0xf4, 0xa8,
+    0x55, 0x2a, 0x19, 0x50, 0x4b, 0x32, 0xb1, 0x2c, 0x24, 0x80, 0x04, 0x8b,
+    0xed, 0x35, 0x0e, 0x73, 0x32, 0xa2, 0xbc, 0x7c, 0x64, 0xc0, 0x52, 0xd8,
+    0xe2, 0xfa, 0x45, 0xe4, 0x98, 0xfe, 0xba, 0xbd, 0x43, 0xa9, 0x55, 0x2d,
+    0xc9, 0x78, 0x7c, 0x3c, 0xeb, 0xcb, 0x86, 0x07, 0x17, 0x88, 0xe2, 0x1b,
+    0x1d, 0xdf, 0x3d, 0x91, 0x8c, 0xe4, 0x07, 0x4e, 0x55, 0x0a, 0x52, 0x72,
+    0x7a, 0x9d, 0x1e, 0x1f, 0x0d, 0x0a, 0x11, 0xb2, 0xdf, 0xa8, 0x8f, 0x00,
+    0x30, 0x20, 0x05, 0x80, 0x6d, 0xe7, 0xd7, 0xca, 0xac, 0x33, 0x88, 0x97,
+    0x04, 0x77, 0x67, 0xcb, 0xeb, 0x6a, 0x00, 0x17, 0x04, 0x80, 0x56, 0x4c,
+    0x89, 0xbd, 0xb4, 0xfc, 0xd0, 0x0e, 0x49, 0x25, 0x46, 0x52, 0xdb, 0x91,
+    0x1b, 0xf4, 0x68, 0x05, 0x6b, 0xa1, 0x90, 0x64, 0x1b, 0x5e, 0x68, 0x08,
+    0xc0, 0x13, 0x22, 0x20, 0x00, 0x65, 0xe3, 0x96, 0xe2, 0x80, 0x7b, 0x77,
+    0x83, 0xc5, 0x81, 0x93, 0x1c, 0xe8, 0x04, 0x57, 0xc4, 0xc3, 0xc4, 0x2e,
+    0xaf, 0x0e, 0x97, 0x81, 0x68, 0x3a, 0xda, 0xab, 0xb0, 0xdc, 0xf4, 0x9d,
+    0x91, 0xda, 0xc3, 0x1e, 0x30, 0xb1, 0xc0, 0x18, 0xa4, 0xc2, 0x38, 0x31,
+    0x98, 0xf9, 0x73, 0xdf, 0xc6, 0x6b, 0x63, 0x86, 0xae, 0xa4, 0xf8, 0x65,
+    0xb9, 0x0e, 0xad, 0x1e, 0x1f, 0x8a, 0x3b, 0x1d, 0xc3, 0x86, 0x0b, 0x03,
+    0x96, 0x08, 0xd0, 0x4e, 0xbd, 0x5a, 0xb6, 0xf0, 0x81, 0x1a, 0xe6, 0xac,
+    0x35, 0x19, 0x55, 0x00, 0x8f, 0x02, 0x3e, 0x63, 0xae, 0x55, 0x2e, 0x10,
+    0x2e, 0xb9, 0x76, 0x14, 0xe6, 0x12, 0x54, 0xaa, 0x0f, 0xe3, 0xf9, 0xa9,
+    0x70, 0x81, 0x5b, 0x9e, 0x1c, 0x0d, 0x8a, 0x86, 0x62, 0x93, 0x03, 0x7e,
+    0xbf, 0xba, 0xea, 0x21, 0x13, 0xc8, 0xee, 0x59, 0x84, 0x8a, 0xa7, 0x32,
+    0x8c, 0xa2, 0x77, 0xd3, 0xaf, 0x1a, 0x91, 0x18, 0x95, 0xb9, 0x69, 0x04,
+    0xc1, 0x82, 0x17, 0x71, 0xcf, 0xc2, 0xb3, 0x24, 0x5c, 0x98, 0xdf, 0xb7,
+    0xb8, 0x23, 0xc3, 0x9c, 0x5b, 0x78, 0xac, 0x89, 0x17, 0x26, 0x16, 0x50,
+    0x98, 0x73, 0x9a, 0xc7, 0x72, 0x40, 0xf5, 0x9d, 0xf4, 0xaa, 0x99, 0x20,
+    0x9c, 0x9a, 0x8c, 0x75, 0x6c, 0x57, 0xe2, 0x70, 0xcc, 0x15, 0xef, 0x10,
+    0x49, 0xb7, 0x5f, 0x4a, 0xa5, 0xcd, 0xe6, 0x1b, 0x24, 0xaf, 0x55, 0x29,
+    0x54, 0xf8, 0x57, 0xcf, 0xcb, 0xee, 0xd3, 0x2a, 0xff, 0x00, 0xa8, 0x37,
+    0x38, 0x6a, 0x12, 0x4e, 0x5e, 0x75, 0x6d, 0x8d, 0xa4, 0x32, 0x1a, 0x29,
+    0x7c, 0x72, 0x6d, 0xf8, 0x2f, 0xbf, 0xa8, 0xc7, 0x8a, 0x26, 0x49, 0x09,
+    0x94, 0x48, 0x9d, 0x36, 0x3e, 0x75, 0x6b, 0x85, 0xca, 0xcb, 0x22, 0xa3,
+    0x6f, 0x82, 0x4d, 0x3f, 0x07, 0xf6, 0x2c, 0x3c, 0x46, 0x1b, 0x30, 0x56,
+    0x85, 0x24, 0xdc, 0xcd, 0x8e, 0x9f, 0xe5, 0x47, 0xa9, 0x4a, 0x4b, 0x55,
+    0xa9, 0x06, 0xb6, 0x51, 0x5a, 0x95, 0xdc, 0x3e, 0x25, 0xf3, 0xf2, 0xfd,
+    0x4b, 0x92, 0x06, 0x1d, 0xe0, 0x03, 0x70, 0xc0, 0xcf, 0xb5, 0x6b, 0xaa,
+    0x4e, 0xda, 0x33, 0x5f, 0x67, 0x17, 0x67, 0xb8, 0x08, 0x1f, 0xc9, 0xc1,
+    0x68, 0x93, 0x9a, 0xd3, 0x50, 0xaa, 0x54, 0x32, 0x21, 0x1b, 0x29, 0x0a,
+    0xee, 0x5a, 0x62, 0x22, 0x75, 0xf3, 0xf9, 0xd4, 0x2a, 0x95, 0x0c, 0xa8,
+    0x60, 0xd0, 0x00, 0xc4, 0x26, 0x1b, 0x49, 0xb9, 0x35, 0x0a, 0xa5, 0x43,
+    0x2a, 0x14, 0xcb, 0x83, 0x98, 0x44, 0x8b, 0x81, 0x26, 0xdb, 0x4f, 0xca,
+    0xa1, 0x54, 0xa8, 0x65, 0x40, 0x3d, 0xf9, 0xef, 0x15, 0xd3, 0xe1, 0xa8,
+    0x53, 0xa8, 0x65, 0x42, 0x62, 0xba, 0x60, 0x2b, 0x67, 0x76, 0x55, 0x02,
+    0x67, 0x4e, 0xb5, 0xe7, 0x51, 0x2a, 0x54, 0xb1, 0x22, 0x8d, 0x37, 0x52,
+    0x6a, 0x11, 0xdd, 0x9c, 0x5e, 0x2b, 0x88, 0xc4, 0xc7, 0xc5, 0x38, 0x82,
+    0x72, 0x82, 0x0a, 0xa9, 0x3d, 0x72, 0x15, 0x06, 0x52, 0x72, 0x77, 0x67,
+    0x55, 0x86, 0xc3, 0x47, 0x0f, 0x0e, 0x18, 0xf8, 0xb2, 0x8c, 0xcd, 0x96,
+    0x40, 0x6c, 0xd1, 0x20, 0xf8, 0xd5, 0xa4, 0x82, 0x2e, 0x68, 0x63, 0xde,
+    0x13, 0xa4, 0x99, 0x3f, 0xe5, 0x00, 0x73, 0xcc, 0x15, 0x66, 0x0c, 0x01,
+    0x81, 0x3e, 0xfc, 0xe8, 0x00, 0xaa, 0x41, 0x56, 0x52, 0x09, 0x26, 0x63,
+    0xd7, 0xc0, 0x73, 0xa0, 0x0a, 0xe6, 0xcd, 0x02, 0x4c, 0x01, 0x1c, 0x87,
+    0x5f, 0x6a, 0x00, 0x80, 0x00, 0x12, 0x64, 0x5a, 0x65, 0xb6, 0xb8, 0xa0,
+    0x01, 0x92, 0x5a, 0x1b, 0xbc, 0x6e, 0x07, 0x2f, 0x5a, 0x02, 0x65, 0x0c,
+    0x0e, 0x6b, 0xcc, 0xc5, 0xae, 0x35, 0xe7, 0x40, 0x2a, 0x28, 0x32, 0xcc,
+    0x4c, 0x65, 0x26, 0xdc, 0xbc, 0xa8, 0x09, 0x04, 0x02, 0x57, 0x2e, 0x61,
+    0xde, 0xd6, 0xd1, 0xe7, 0xbd, 0x01, 0xec, 0x7f, 0x4d, 0xf6, 0x88, 0xe3,
+    0x70, 0xce, 0x0e, 0x29, 0x66, 0xe2, 0x30, 0xef, 0x9d, 0x8f, 0xfe, 0x45,
+    0xe7, 0x3c, 0xc4, 0xff, 0x00, 0xb7, 0xae, 0x8b, 0x2d, 0xc4, 0x2a, 0xcb,
+    0xdd, 0xcb, 0xf7, 0x97, 0xcd, 0x1a, 0xfc, 0x45, 0x2e, 0x07, 0xc4, 0xb6,
+    0x3b, 0xeb, 0x87, 0x95, 0x41, 0x20, 0x7e, 0xe1, 0xee, 0x8d, 0xe4, 0x56,
+    0xf6, 0x10, 0x30, 0x5c, 0xb5, 0x14, 0x66, 0x92, 0x08, 0x90, 0x7b, 0xb3,
+    0x63, 0xd5, 0xea, 0x4c, 0x22, 0x56, 0xe7, 0x85, 0xc3, 0x92, 0x66, 0x00,
+    0x32, 0x3c, 0x4f, 0x8d, 0x74, 0xd1, 0x89, 0xe4, 0x69, 0x96, 0x81, 0xa1,
+    0x0a, 0x33, 0x01, 0x16, 0xd8, 0xc7, 0x87, 0x5e, 0xf5, 0x9d, 0x22, 0xe4,
+    0xcb, 0x7e, 0x22, 0x18, 0x02, 0x34, 0xdc, 0xde, 0x6a, 0xf4, 0x8b, 0x93,
+    0x26, 0x62, 0x8b, 0x9b, 0x30, 0xdd, 0x81, 0x37, 0xbf, 0x2f, 0x63, 0x57,
+    0x12, 0xf0, 0xb8, 0x6a, 0x98, 0xaa, 0x8a, 0x95, 0x25, 0xaf, 0xa7, 0x6b,
+    0x32, 0xf1, 0x18, 0xd9, 0x9e, 0xf2, 0x10, 0x19, 0xc8, 0x0f, 0x9d, 0xea,
+    0xd3, 0xba, 0xc0, 0x65, 0xb4, 0xb0, 0x4b, 0xe1, 0xd6, 0x4f, 0x77, 0xf6,
+    0xe8, 0xbf, 0x2e, 0x57, 0x23, 0x31, 0x24, 0x35, 0xbf, 0xe7, 0x7f, 0x2f,
+    0xad, 0x0d, 0x88, 0xd9, 0x4e, 0x73, 0x9a, 0x24, 0x8d, 0x2c, 0x2d, 0xe3,
+    0x40, 0x42, 0xc4, 0xa4, 0x41, 0x80, 0x74, 0x8b, 0xff, 0x00, 0xb4, 0x02,
+    0xaf, 0x78, 0xe6, 0x4e, 0xec, 0x81, 0x12, 0x26, 0xda, 0x50, 0x16, 0x61,
+    0xe2, 0x32, 0x00, 0x4f, 0xc3, 0xa1, 0xdb, 0x90, 0xfb, 0x9a, 0x8d, 0x88,
+    0xc3, 0x46, 0xba, 0xe8, 0xfa, 0x90, 0xb1, 0x78, 0x28, 0x62, 0x56, 0xba,
+    0x35, 0xcc, 0xd6, 0x0a, 0x95, 0x05, 0x40, 0x33, 0xa7, 0x7a, 0xfc, 0xad,
+    0xd6, 0xd5, 0xca, 0xe2, 0x38, 0xa9, 0x4d, 0xc2, 0x5b, 0xa3, 0x9a, 0x9d,
+    0x39, 0x52, 0x9b, 0x84, 0xb7, 0x45, 0x8c, 0x17, 0x31, 0x3a, 0x1d, 0x66,
+    0x34, 0xb5, 0x6b, 0xea, 0x54, 0x2a, 0x8a, 0xc0, 0x21, 0xc8, 0xd3, 0x99,
+    0xfc, 0xed, 0xf8, 0xa8, 0x35, 0x2a, 0x19, 0x51, 0x1d, 0x47, 0x78, 0xb4,
+    0xcc, 0x48, 0x69, 0xbd, 0xaf, 0x50, 0xe7, 0x33, 0x2a, 0x0e, 0x24, 0x83,
+    0xa9, 0x00, 0x0f, 0x85, 0x80, 0xd0, 0x54, 0x49, 0xcc, 0xca, 0x8e, 0x4f,
+    0x6b, 0x63, 0xc3, 0xfe, 0xc2, 0x86, 0x19, 0x4e, 0x62, 0x75, 0x04, 0x91,
+    0xf9, 0xf7, 0xf0, 0xa8, 0x75, 0x25, 0x7d, 0x0e, 0x8f, 0x29, 0xc3, 0xf0,
+    0xc3, 0xdf, 0x3e, 0x66, 0x02, 0x42, 0x40, 0x6c, 0xd2, 0x16, 0x2f, 0x15,
+    0x8c, 0xdb, 0x91, 0xb3, 0x17, 0x10, 0x4e, 0x60, 0x0d, 0x84, 0xf9, 0xed,
+    0xe9, 0x40, 0x2a, 0x7f, 0xe4, 0xce, 0x44, 0x00, 0x77, 0x3e, 0x31, 0xf6,
+    0xd3, 0xc2, 0x80, 0x62, 0xb0, 0xa6, 0x4c, 0x18, 0xbd, 0x87, 0x97, 0x5e,
+    0x94, 0x02, 0x62, 0x18, 0x82, 0x04, 0x5a, 0x32, 0x9f, 0x7f, 0xb7, 0xce,
+    0x80, 0xb2, 0xc2, 0xca, 0xca, 0x6d, 0xff, 0x00, 0x28, 0x3a, 0x5a, 0x80,
+    0x0e, 0x33, 0x35, 0xa6, 0x08, 0x1a, 0xf7, 0xba, 0x14, 0x00, 0x86, 0x38,
+    0x67, 0x20, 0x11, 0x31, 0xe3, 0xed, 0xe7, 0x40, 0x15, 0x2a, 0xcb, 0xe2,
+    0x0d, 0xad, 0xe9, 0x69, 0x37, 0xa0, 0x02, 0x35, 0xd5, 0x66, 0x18, 0x90,
+    0x49, 0xb0, 0xb7, 0x85, 0x00, 0x49, 0x97, 0x06, 0xd7, 0x8e, 0x5c, 0xe0,
+    0xd0, 0x17, 0xf0, 0x78, 0xed, 0xc1, 0xf1, 0x18, 0x58, 0xb8, 0x43, 0x23,
+    0xe1, 0xb6, 0x61, 0x04, 0xfc, 0xad, 0xb6, 0xde, 0xb5, 0x92, 0x95, 0x59,
+    0x52, 0x9a, 0xa9, 0x1d, 0xd1, 0x49, 0x45, 0x49, 0x38, 0xb3, 0xe9, 0x3c,
+    0x06, 0x2a, 0xf1, 0x58, 0x18, 0x78, 0xb8, 0x44, 0xfe, 0xdb, 0xac, 0xec,
+    0x08, 0xb5, 0xf7, 0xf1, 0xf4, 0xae, 0xff, 0x00, 0x0f, 0x38, 0xd6, 0x82,
+    0xa9, 0x0d, 0x99, 0xa7, 0x92, 0x70, 0x6e, 0x2c, 0xd0, 0xa8, 0xa5, 0x81,
+    0x61, 0xe4, 0x62, 0x3d, 0xb4, 0xe5, 0x53, 0x63, 0x11, 0x73, 0xc2, 0xae,
+    0x1c, 0x1b, 0x48, 0x20, 0x6b, 0x00, 0xc9, 0xfe, 0xad, 0x5d, 0x22, 0x47,
+    0x91, 0xa6, 0x5a, 0x80, 0x05, 0x07, 0xba, 0x54, 0x58, 0x81, 0xa9, 0xf3,
+    0xac, 0x89, 0x17, 0x26, 0x5a, 0xaa, 0x73, 0xaa, 0xe6, 0x51, 0x3c, 0x87,
+    0xaf, 0xf5, 0x55, 0x2f, 0x4c, 0xc5, 0xc5, 0xe2, 0xe7, 0xc7, 0x18, 0x6a,
+    0xc4, 0x00, 0x20, 0x45, 0x81, 0xaa, 0x1d, 0xe6, 0x45, 0x82, 0x54, 0x28,
+    0x2a, 0xb2, 0x5f, 0x14, 0xb5, 0xf0, 0xe4, 0xbe, 0xbe, 0xbb, 0x15, 0x10,
+    0x4a, 0xf7, 0xa7, 0xd0, 0xe8, 0x7c, 0x68, 0x6e, 0xc9, 0x86, 0xd0, 0xc0,
+    0x4d, 0x85, 0xbb, 0xa2, 0x62, 0xdc, 0xe8, 0x00, 0x00, 0x0e, 0xa1, 0x56,
+    0x46, 0xb6, 0x36, 0xbf, 0x97, 0x97, 0x5a, 0x50, 0x05, 0x90, 0x10, 0x44,
+    0x12, 0x79, 0xa8, 0x06, 0x3c, 0xe8, 0x08, 0x2c, 0xc8, 0xb0, 0x49, 0xd6,
+    0xdc, 0xa7, 0xaf, 0x95, 0x0a, 0x91, 0x1b, 0x70, 0x59, 0x80, 0x30, 0x36,
+    0x9a, 0x14, 0x2d, 0xe1, 0xd9, 0x53, 0x14, 0xac, 0x65, 0x53, 0xe6, 0x5a,
+    0x63, 0x5a, 0xd4, 0x67, 0x18, 0x55, 0x56, 0x83, 0xa9, 0x15, 0xf1, 0x47,
+    0x5f, 0x0e, 0x7f, 0x7f, 0xee, 0x6b, 0xb3, 0x1c, 0x3a, 0xa9, 0x4f, 0x8d,
+    0x2d, 0x57, 0xa7, 0xe6, 0xa6, 0xb0, 0x00, 0x62, 0x0b, 0x31, 0x83, 0xae,
+    0xff, 0x00, 0x2a, 0xe1, 0x6a, 0x54, 0x34, 0x08, 0x5c, 0xd3, 0x84, 0xd0,
+    0x82, 0x40, 0x88, 0xd0, 0x75, 0x6a, 0x87, 0x39, 0x99, 0x51, 0x30, 0xc8,
+    0x71, 0x63, 0x31, 0x72, 0x00, 0xbd, 0xb4, 0xa8, 0x73, 0x99, 0x95, 0x01,
+    0xd8, 0x61, 0x61, 0x3e, 0x24, 0x31, 0x50, 0x84, 0x92, 0x37, 0xa8, 0xd2,
+    0x99, 0x9e, 0x94, 0x1d, 0x49, 0x28, 0x2e, 0x7a, 0x1e, 0x7b, 0x33, 0x1c,
+    0x47, 0x6c, 0xd3, 0x79, 0x3e, 0x64, 0xd6, 0x23, 0xb7, 0x8c, 0x54, 0x22,
+    0xa3, 0x1d, 0x91, 0x58, 0x0c, 0x10, 0x5f, 0x30, 0x26, 0xe5, 0x4c, 0x9b,
+    0x7d, 0x6a, 0x85, 0x46, 0x80, 0x24, 0x3c, 0x91, 0x33, 0x73, 0xa0, 0xd7,
+    0x4a, 0x02, 0x40, 0x55, 0x25, 0xa0, 0xcc, 0x13, 0xe1, 0x40, 0x00, 0xd0,
+    0xce, 0x4e, 0x58, 0x06, 0xd0, 0x2e, 0x3e, 0x7e, 0x74, 0x00, 0xca, 0x32,
+    0xc2, 0x90, 0x19, 0xcf, 0x76, 0xe7, 0x96, 0xbf, 0x4a, 0x00, 0xda, 0x0c,
+    0xcc, 0x03, 0xa1, 0xe5, 0x1b, 0xd0, 0x10, 0xa8, 0x33, 0x63, 0x68, 0x8f,
+    0xfd, 0x7e, 0xf4, 0x00, 0x03, 0x2a, 0x9c, 0xa4, 0xe4, 0x12, 0x40, 0x17,
+    0x8b, 0x7f, 0xb4, 0x01, 0x16, 0x5f, 0x84, 0x12, 0x39, 0x11, 0x6d, 0x3a,
+    0xf4, 0xa0, 0x08, 0x64, 0x05, 0x4a, 0x80, 0x40, 0xdc, 0x7d, 0x39, 0xda,
+    0xf7, 0xa0, 0x01, 0xc3, 0x9c, 0xa6, 0x0b, 0x4e, 0x91, 0x17, 0xf9, 0xf5,
+    0x7a, 0x02, 0x33, 0xcb, 0x29, 0xee, 0x08, 0xb4, 0x30, 0xd0, 0x6d, 0x40,
+    0x7b, 0x3f, 0xd0, 0x98, 0xe7, 0x1b, 0x84, 0xc5, 0xe1, 0x58, 0xf7, 0xf0,
+    0x5f, 0x32, 0x82, 0xc0, 0x90, 0xad, 0xac, 0x0e, 0x40, 0xdf, 0xcd, 0xab,
+    0xae, 0xf6, 0x76, 0xbf, 0x14, 0x25, 0x45, 0xf2, 0xd5, 0x6b, 0xc9, 0xf6,
+    0x76, 0x3f, 0x53, 0x5d, 0x8d, 0x85, 0xa4, 0xa4, 0x7a, 0xbc, 0x38, 0xcb,
+    0xde, 0xb9, 0x8d, 0x27, 0xdf, 0xe9, 0xf2, 0xae, 0xa1, 0x22, 0x1a, 0x67,
+    0x87, 0x18, 0x64, 0x38, 0xca, 0xda, 0x8b, 0x5b, 0xd6, 0xba, 0x14, 0x8f,
+    0x24, 0x4c, 0x64, 0x5c, 0xa1, 0x44, 0x2c, 0xe8, 0x41, 0x91, 0x37, 0xf1,
+    0xe7, 0x35, 0x71, 0x7a, 0x64, 0x76, 0x4c, 0x34, 0xc4, 0x60, 0x01, 0x55,
+    0xd0, 0x03, 0x63, 0xd5, 0xaa, 0x97, 0x26, 0xe0, 0x70, 0xef, 0x13, 0x5e,
+    0x14, 0x7a, 0xbf, 0x97, 0x3f, 0x91, 0xce, 0x12, 0xac, 0x42, 0x96, 0x2c,
+    0x39, 0x93, 0xa5, 0x0f, 0x50, 0x10, 0xb0, 0x86, 0x7c, 0x4b, 0x4e, 0x86,
+    0x6f, 0xa7, 0x85, 0x0a, 0x0e, 0x72, 0x64, 0x3f, 0x1d, 0xc8, 0xdf, 0xab,
+    0xe9, 0x42, 0xa0, 0x04, 0x58, 0xa8, 0x0b, 0x1d, 0xe8, 0x04, 0x8e, 0xbf,
+    0xca, 0x01, 0xd5, 0x64, 0x88, 0x20, 0x00, 0x09, 0x9d, 0xe7, 0x9d, 0x00,
+    0x92, 0x0e, 0x65, 0x0c, 0xab, 0x6f, 0x42, 0x28, 0x50, 0x30, 0x1d, 0x88,
+    0xb0, 0x0b, 0xa0, 0x1e, 0xbf, 0x8f, 0x9d, 0x01, 0x0a, 0x92, 0xa3, 0x27,
+    0x33, 0xa9, 0xf7, 0xa0, 0x3a, 0x08, 0x03, 0x2c, 0xb1, 0x93, 0x02, 0xe3,
+    0x7b, 0x46, 0x83, 0xad, 0x6b, 0xca, 0xb1, 0xf0, 0xfd, 0x9e, 0xbc, 0xe9,
+    0x6b, 0xa3, 0x7b, 0xf4, 0xe5, 0xe6, 0x8e, 0x52, 0xad, 0x3f, 0x77, 0x52,
+    0x50, 0xe8, 0xc0, 0x49, 0x66, 0xbc, 0x99, 0xb1, 0xe4, 0x2b, 0x57, 0x39,
+    0x84, 0x38, 0xcb, 0x96, 0x65, 0x94, 0x78, 0xee, 0x27, 0xc7, 0xab, 0xd4,
+    0x69, 0x4c, 0xc8, 0x8c, 0x1d, 0xa8, 0x71, 0x07, 0x0b, 0x0b, 0xfc, 0x88,
+    0x02, 0x6f, 0x11, 0xe1, 0xe9, 0x58, 0x6f, 0x76, 0x6d, 0xf2, 0x88, 0x71,
+    0x62, 0x13, 0xe8, 0x9b, 0xfa, 0x7d, 0x4e, 0x3b, 0x36, 0x24, 0xc9, 0x10,
+    0x4d, 0xee, 0x47, 0x3d, 0xa8, 0x75, 0x24, 0x60, 0x01, 0x04, 0x81, 0x22,
+    0x7e, 0x5e, 0x94, 0x02, 0xa8, 0x05, 0x06, 0xe4, 0x1b, 0x6f, 0x3c, 0xfc,
+    0xe8, 0x08, 0xcc, 0x49, 0x25, 0x18, 0x96, 0x31, 0xdd, 0x12, 0x7f, 0xdd,
+    0xe8, 0x02, 0x07, 0x74, 0x4c, 0xcd, 0x89, 0x58, 0x8e, 0xb9, 0xd0, 0x10,
+    0x80, 0x6e, 0x32, 0xd8, 0x68, 0x07, 0xa4, 0x78, 0xd0, 0x10, 0xf7, 0xc4,
+    0x39, 0x9b, 0xdf, 0x9c, 0x7f, 0xb4, 0x02, 0x95, 0x81, 0x06, 0x14, 0x83,
+    0x1d, 0xe3, 0x33, 0x63, 0x40, 0x11, 0x94, 0x90, 0x41, 0x51, 0xa4, 0xa8,
+    0xf4, 0xa0, 0x0e, 0x26, 0x7c, 0x9d, 0xe0, 0x0a, 0x83, 0xe7, 0x03, 0xe5,
+    0x40, 0x4d, 0x05, 0xb3, 0x15, 0x16, 0xd0, 0x93, 0x40, 0x22, 0x92, 0x7c,
+    0x00, 0x10, 0x7e, 0xfd, 0x79, 0xd0, 0x0e, 0x08, 0x23, 0x28, 0x12, 0x23,
+    0x63, 0xe3, 0xd7, 0xce, 0x80, 0xee, 0x7e, 0x8f, 0x72, 0x3b, 0x7f, 0x87,
+    0x0a, 0xcc, 0x55, 0xd1, 0x95, 0xf4, 0x20, 0x8c, 0xa5, 0xbe, 0xa0, 0x7c,
+    0xab, 0x73, 0x90, 0xce, 0x51, 0xc6, 0xc5, 0x2e, 0x77, 0x4f, 0xca, 0xfe,
+    0xa9, 0x11, 0xb1, 0x69, 0x3a, 0x4d, 0xbe, 0x47, 0xd1, 0x54, 0x0c, 0xd9,
+    0x58, 0x08, 0xf1, 0x1a, 0x5f, 0x6a, 0xf4, 0x04, 0x8d, 0x4a, 0x67, 0x85,
+    0x64, 0x87, 0x84, 0x24, 0x11, 0xcb, 0x5f, 0x0f, 0xa5, 0x6f, 0xcf, 0x24,
+    0x4c, 0x78, 0x73, 0x61, 0x22, 0x44, 0x00, 0x0c, 0xc7, 0xf5, 0x54, 0x6c,
+    0xbd, 0x31, 0x78, 0x95, 0x38, 0x78, 0x4d, 0xfc, 0x84, 0x88, 0xde, 0x2f,
+    0x56, 0xa7, 0xa9, 0xba, 0xc8, 0x7f, 0xd7, 0x53, 0xf1, 0xff, 0x00, 0x8b,
+    0x30, 0x13, 0x6f, 0x84, 0x13, 0xe0, 0x4e, 0x95, 0x79, 0xe8, 0xa5, 0x6e,
+    0x08, 0x03, 0x53, 0x31, 0x01, 0x84, 0x9f, 0x3a, 0x14, 0x1b, 0x30, 0x46,
+    0x9b, 0x05, 0xb9, 0x24, 0x08, 0xde, 0x3a, 0xfb, 0xd0, 0x0b, 0x79, 0xef,
+    0x12, 0xc2, 0xe6, 0x26, 0x46, 0xf6, 0x1f, 0xe5, 0x00, 0x56, 0x18, 0xc1,
+    0x89, 0x26, 0x04, 0x5a, 0xf1, 0x79, 0x8f, 0x5f, 0x7a, 0x00, 0x10, 0x40,
+    0x42, 0x40, 0xb9, 0x96, 0xb5, 0xcf, 0x2a, 0x15, 0x0a, 0xbc, 0x98, 0x72,
+    0x04, 0x58, 0x13, 0x33, 0xe3, 0x40, 0x40, 0xec, 0xcd, 0x25, 0x48, 0x23,
+    0x59, 0x17, 0x9f, 0x2d, 0xb9, 0xd0, 0xa1, 0xaf, 0x84, 0xcc, 0x11, 0x45,
+    0xee, 0x23, 0xae, 0xb7, 0xaf, 0x2f, 0xf6, 0x8e, 0x56, 0xcc, 0x2a, 0x2e,
+    0xef, 0xf8, 0xa3, 0x9b, 0xc7, 0xff, 0x00, 0xa8, 0x97, 0x87, 0xa2, 0x2d,
+    0xef, 0x87, 0x0b, 0x1e, 0x20, 0x93, 0x71, 0xd4, 0x57, 0x39, 0x29, 0x91,
+    0xd1, 0x17, 0x28, 0x2c, 0x40, 0x60, 0x63, 0x2d, 0xef, 0xf3, 0xb4, 0xd6,
+    0x09, 0x48, 0xc8, 0x8e, 0x7f, 0x6c, 0xb6, 0x5c, 0x1c, 0x34, 0x89, 0x93,
+    0x3b, 0x8d, 0x2a, 0x90, 0xd4, 0xdf, 0xe4, 0x90, 0x4e, 0x53, 0x9f, 0x35,
+    0x65, 0xe7, 0xfd, 0x8e, 0x43, 0x29, 0x0a, 0x08, 0x30, 0xb3, 0x72, 0x7f,
+    0xaf, 0x6a, 0xbc, 0xe8, 0x80, 0x8a, 0x1a, 0xef, 0x9b, 0xc4, 0x8d, 0x07,
+    0xa7, 0xa5, 0x00, 0xc3, 0xbe, 0xb7, 0x82, 0xdc, 0xbc, 0x74, 0xa0, 0x03,
+    0x10, 0x40, 0x20, 0x77, 0xe7, 0x41, 0xbf, 0xe7, 0xf3, 0x40, 0x42, 0x24,
+    0x99, 0x56, 0x10, 0x36, 0x37, 0xd7, 0xaf, 0x6a, 0x00, 0xcc, 0x29, 0xb9,
+    0x06, 0xd2, 0x5a, 0x09, 0x1e, 0x9f, 0xed, 0x00, 0xa0, 0x85, 0xf8, 0x64,
+    0xe6, 0xef, 0x05, 0x3e, 0x7a, 0x50, 0x12, 0x49, 0x68, 0x04, 0x92, 0x22,
+    0x08, 0x1b, 0xf9, 0x50, 0x0e, 0xc4, 0x15, 0x00, 0x80, 0x00, 0x16, 0xb7,
+    0xcc, 0x50, 0x0a, 0xd9, 0x50, 0xb2, 0x6d, 0xe2, 0x01, 0xeb, 0x7a, 0x00,
+    0xe6, 0x90, 0x0b, 0x92, 0x18, 0x89, 0x0d, 0x16, 0xe7, 0xeb, 0x40, 0x43,
+    0xf0, 0x0c, 0xaa, 0x0a, 0x88, 0x0b, 0x3b, 0x9f, 0x4d, 0x68, 0x01, 0x20,
+    0xae, 0x53, 0x72, 0x0d, 0xad, 0x3c, 0xbf, 0x34, 0x06, 0xce, 0xc0, 0x57,
+    0x3d, 0xaf, 0xc0, 0x91, 0xaf, 0xfd, 0x42, 0x09, 0x36, 0xfe, 0x42, 0xa6,
+    0x65, 0xff, 0x00, 0xea, 0xa9, 0x7f, 0xba, 0x3e, 0xa8, 0xc7, 0x5b, 0xf8,
+    0x72, 0xee, 0x67, 0xd6, 0x88, 0x64, 0xf8, 0x4c, 0xb0, 0x81, 0x94, 0xec,
+    0x3c, 0xbc, 0xab, 0xd3, 0x8d, 0x0a, 0x67, 0x87, 0x20, 0xfe, 0xde, 0xc4,
+    0x0d, 0x8a, 0xe9, 0xf7, 0xad, 0xe3, 0x67, 0x92, 0xa2, 0x30, 0x0c, 0xc2,
+    0x07, 0x78, 0xf2, 0xf9, 0xfd, 0xeb, 0x1b, 0x91, 0x91, 0x09, 0x8c, 0x0b,
+    0x60, 0x3a, 0x99, 0x42, 0x04, 0xc0, 0x5d, 0xc5, 0x63, 0x53, 0xb4, 0x91,
+    0xb3, 0xca, 0xab, 0xac, 0x3e, 0x2e, 0x9d, 0x49, 0x6d, 0x7b, 0x74, 0xdf,
+    0x4b, 0xf8, 0x5e, 0xe7, 0x33, 0xba, 0xf2, 0x55, 0x80, 0xda, 0x1b, 0x90,
+    0xa9, 0x47, 0xa6, 0x0a, 0xd6, 0x59, 0x20, 0xc9, 0x98, 0xe5, 0xe5, 0xd7,
+    0xfa, 0x2a, 0x12, 0x18, 0xc5, 0x80, 0xf3, 0x1d, 0x45, 0x85, 0x00, 0x03,
+    0x87, 0x6c, 0xca, 0x2c, 0x04, 0xc1, 0xb5, 0x87, 0x46, 0x85, 0x03, 0x95,
+    0xff, 0x00, 0x89, 0x9b, 0xc1, 0x24, 0x75, 0xe3, 0x42, 0xa0, 0x61, 0x2b,
+    0xdf, 0xcc, 0x42, 0x99, 0x81, 0x3a, 0x50, 0xa0, 0x4b, 0x05, 0x42, 0x12,
+    0x2f, 0xb8, 0xb4, 0x78, 0xd0, 0xa8, 0x0a, 0xcc, 0x85, 0x19, 0xa2, 0x2d,
+    0xaf, 0x3d, 0xc5, 0x01, 0xd1, 0xe1, 0xa5, 0x30, 0xa4, 0xcf, 0x77, 0x99,
+    0x81, 0xa9, 0x9a, 0xf1, 0xdc, 0xe7, 0x15, 0xfb, 0x4e, 0x36, 0xad, 0x4b,
+    0xab, 0x5e, 0xca, 0xdb, 0x59, 0x68, 0x9f, 0x8a, 0x47, 0x2b, 0x89, 0xa9,
+    0xef, 0x2b, 0x4a, 0x5d, 0xbf, 0xa0, 0xcc, 0x04, 0x4d, 0x94, 0x37, 0xb1,
+    0xe8, 0xd6, 0x9e, 0x52, 0x31, 0xa0, 0x9e, 0xe9, 0x6b, 0x08, 0x90, 0x40,
+    0xd3, 0xca, 0xb1, 0x36, 0x64, 0x47, 0x37, 0xb6, 0xf0, 0xe7, 0x0f, 0x0b,
+    0x19, 0xbb, 0xa5, 0x49, 0x58, 0x22, 0x66, 0x77, 0xf6, 0xf7, 0xab, 0xa9,
+    0xbd, 0x4d, 0xf6, 0x47, 0x52, 0xd3, 0x9c, 0x3a, 0xab, 0xf9, 0x7f, 0x73,
+    0x8e, 0x2f, 0x32, 0x59, 0x88, 0x17, 0x12, 0x6b, 0x29, 0xd2, 0x11, 0x8a,
+    0xf7, 0x98, 0x10, 0x06, 0xc2, 0x22, 0xc4, 0x9d, 0x28, 0x08, 0x73, 0x32,
+    0xcb, 0x7c, 0x24, 0x09, 0x8d, 0x4e, 0x82, 0x68, 0x08, 0xf9, 0x86, 0x4d,
+    0x9e, 0x3f, 0x8e, 0x87, 0xd6, 0x80, 0x7b, 0x4b, 0x4f, 0xc5, 0x3a, 0x08,
+    0x8b, 0x6b, 0x40, 0x56, 0x84, 0xe5, 0x65, 0xf8, 0xdc, 0xc9, 0x03, 0x6f,
+    0xf7, 0xc2, 0x80, 0x6b, 0xdc, 0x29, 0x97, 0x6b, 0x98, 0x3a, 0x0e, 0xbe,
+    0xb4, 0x02, 0xb1, 0xee, 0xb3, 0x2d, 0x98, 0x83, 0x68, 0xeb, 0x9d, 0x00,
+    0xe5, 0x4e, 0x64, 0x84, 0x30, 0x26, 0x00, 0xd8, 0xf3, 0xeb, 0xc2, 0x80,
+    0x0c, 0x8d, 0xf0, 0xa8, 0x45, 0x1b, 0x75, 0xcf, 0xd6, 0x80, 0x18, 0x6c,
+    0xa4, 0x46, 0x18, 0x60, 0xda, 0x89, 0xbd, 0x01, 0x32, 0x0b, 0xa9, 0xd8,
+    0x6e, 0x07, 0x9c, 0x78, 0xd0, 0x0c, 0xab, 0x28, 0x72, 0x98, 0x11, 0x04,
+    0x7a, 0xce, 0xb4, 0x06, 0xff, 0x00, 0xd3, 0xd8, 0x6c, 0xdd, 0xb9, 0xc0,
+    0x2e, 0x1a, 0xb3, 0x37, 0xef, 0x21, 0xca, 0xa2, 0x74, 0x32, 0x4e, 0x9b,
+    0x41, 0x3e, 0x86, 0xa6, 0xe5, 0xd1, 0x72, 0xc5, 0xd2, 0x49, 0x5f, 0xe2,
+    0x5e, 0xa6, 0x2a, 0xed, 0x2a, 0x52, 0xbf, 0x43, 0xeb, 0x56, 0x8b, 0xb1,
+    0x0c, 0x24, 0xce, 0xb5, 0xe9, 0x8d, 0x9a, 0x14, 0x78, 0x44, 0x03, 0x10,
+    0xb1, 0x2c, 0x2f, 0xa7, 0x51, 0xe1, 0x5b, 0x99, 0x48, 0xf2, 0x54, 0x02,
+    0xd1, 0x94, 0xc0, 0x24, 0x7c, 0x51, 0x62, 0x79, 0xd6, 0x19, 0x48, 0xc8,
+    0x89, 0x88, 0x0c, 0x18, 0x12, 0xbf, 0xf2, 0x98, 0x93, 0x51, 0xa7, 0x33,
+    0x22, 0x39, 0x7c, 0x46, 0x19, 0xc3, 0xe2, 0x59, 0x08, 0x81, 0x6c, 0xa0,
+    0xe8, 0x05, 0xc8, 0xa9, 0xf4, 0x2a, 0x7b, 0xc8, 0x5c, 0xf4, 0xcc, 0xab,
+    0x19, 0xfb, 0x66, 0x1a, 0x35, 0x1f, 0xef, 0x2d, 0x1f, 0x7a, 0xfb, 0xef,
+    0xe3, 0x62, 0xb2, 0x4e, 0x63, 0x95, 0x41, 0x68, 0x8b, 0x5a, 0x07, 0x9d,
+    0x66, 0x36, 0x01, 0x17, 0x91, 0x99, 0xb3, 0x19, 0x80, 0x7d, 0x7d, 0x34,
+    0xa1, 0x51, 0x70, 0xc6, 0x62, 0x1b, 0x13, 0x5d, 0x14, 0x75, 0xe7, 0x42,
+    0x81, 0x0a, 0x84, 0x9c, 0xb2, 0x40, 0xbc, 0xc7, 0x86, 0x9e, 0x14, 0x2a,
+    0x44, 0x02, 0x06, 0x50, 0x23, 0x91, 0x16, 0xd4, 0x7f, 0xb4, 0x28, 0x42,
+    0xa0, 0x80, 0x6d, 0x26, 0xe3, 0x59, 0xf3, 0xeb, 0x9d, 0x01, 0x6f, 0x0f,
+    0x86, 0xcf, 0x8b, 0x92, 0x0b, 0x45, 0xd8, 0x13, 0x68, 0xf9, 0xf8, 0xd6,
+    0xa3, 0x3b, 0xcc, 0x7f, 0xc3, 0xf0, 0x72, 0xaa, 0xbf, 0x79, 0xe9, 0x1e,
+    0xf7, 0xe0, 0xf6, 0xd5, 0xeb, 0xbd, 0xad, 0xcc, 0x8d, 0x8c, 0xaf, 0xee,
+    0x29, 0x39, 0x2d, 0xf6, 0x5d, 0xe6, 0xe5, 0x39, 0x04, 0x15, 0x32, 0x74,
+    0xca, 0x47, 0xca, 0x75, 0xaf, 0x1b, 0x94, 0x8e, 0x59, 0x01, 0x10, 0xc3,
+    0xc5, 0xc9, 0x83, 0x6e, 0x77, 0xfc, 0xd6, 0x26, 0xcc, 0x88, 0x76, 0x04,
+    0x4c, 0x30, 0x0d, 0x7d, 0xf6, 0xdc, 0x5e, 0xad, 0x2f, 0x4c, 0xcb, 0xdb,
+    0x38, 0x01, 0xf8, 0x06, 0x0b, 0x19, 0x90, 0xde, 0x0d, 0xbc, 0x64, 0x79,
+    0x4f, 0x42, 0xaf, 0xa7, 0xa3, 0x36, 0xb9, 0x4d, 0x5f, 0x77, 0x89, 0x4b,
+    0xae, 0x9f, 0x9e, 0x27, 0x9e, 0x20, 0x02, 0x11, 0x0c, 0x48, 0x91, 0x11,
+    0xf6, 0xac, 0xe7, 0x5e, 0x2e, 0x1e, 0xa4, 0xb1, 0xee, 0x9b, 0x46, 0xf0,
+    0x6e, 0x45, 0x00, 0x70, 0xc4, 0xe5, 0x96, 0x50, 0xab, 0x69, 0x06, 0x4d,
+    0xe8, 0x02, 0x14, 0xe5, 0x3f, 0xb9, 0x19, 0x76, 0x17, 0xeb, 0x6a, 0x00,
+    0x95, 0x2a, 0xb9, 0x70, 0xca, 0xb2, 0xc1, 0x90, 0x28, 0x08, 0xcb, 0x95,
+    0x62, 0xc4, 0x08, 0xde, 0xd1, 0x40, 0x28, 0xef, 0x04, 0x27, 0x28, 0x1c,
+    0xe0, 0xea, 0x3a, 0xd6, 0x80, 0x0c, 0xcb, 0x95, 0x44, 0x09, 0x22, 0x00,
+    0xd3, 0x95, 0x00, 0xcd, 0x9f, 0x2f, 0x7a, 0x48, 0xb0, 0x32, 0x6f, 0x3b,
+    0xf8, 0x50, 0x05, 0x33, 0x9c, 0x40, 0x43, 0x4c, 0x44, 0x98, 0xd0, 0xf9,
+    0x75, 0xad, 0x01, 0x2d, 0x66, 0x1b, 0x0b, 0x49, 0xd7, 0xcf, 0xe7, 0x40,
+    0x0c, 0xd6, 0x21, 0xad, 0xe1, 0xb9, 0xf3, 0xbd, 0x01, 0x1c, 0x95, 0x82,
+    0xb7, 0x2b, 0x02, 0x76, 0x1f, 0x2a, 0x03, 0xbf, 0xfa, 0x1b, 0x09, 0xb1,
+    0xfb, 0x7f, 0x0b, 0x15, 0x54, 0x15, 0xc2, 0xc3, 0x7c, 0x46, 0xce, 0x62,
+    0xc4, 0x65, 0xb7, 0x3b, 0xb0, 0xad, 0xd6, 0x41, 0x4d, 0xcf, 0x19, 0x19,
+    0x2f, 0xe5, 0x4d, 0xfc, 0xad, 0xf5, 0x22, 0x63, 0xa4, 0xa3, 0x45, 0xae,
+    0xa7, 0xd3, 0x00, 0x5c, 0x39, 0x1d, 0xe6, 0x69, 0x26, 0x0e, 0xff, 0x00,
+    0xdd, 0x77, 0x4e, 0x46, 0x95, 0x0b, 0x87, 0xd9, 0x9c, 0x0e, 0x0a, 0x95,
+    0x4e, 0x17, 0x0c, 0xf7, 0xa4, 0xab, 0x20, 0x72, 0x07, 0xad, 0x59, 0x2c,
+    0x45, 0x59, 0x3b, 0xb9, 0x1a, 0x9a, 0x79, 0x6e, 0x12, 0x92, 0xb4, 0x69,
+    0xaf, 0x1d, 0x7d, 0x6e, 0x0c, 0x7e, 0xc8, 0xe0, 0x1d, 0xf3, 0xe2, 0x70,
+    0xa8, 0x0e, 0x90, 0xb2, 0xaa, 0x07, 0x90, 0xea, 0xd4, 0x55, 0xea, 0x2d,
+    0x2e, 0x5b, 0x53, 0x2b, 0xc2, 0x54, 0x77, 0x74, 0xd7, 0x86, 0x9e, 0x96,
+    0x32, 0x71, 0x1f, 0xa7, 0x78, 0x6c, 0x4c, 0x37, 0xfd, 0xa7, 0xc4, 0xc2,
+    0x6b, 0x41, 0xb3, 0x2c, 0xf9, 0x6b, 0xcf, 0x7e, 0x7e, 0x54, 0xf7, 0xf2,
+    0x7b, 0x91, 0x2a, 0xe4, 0x54, 0x25, 0x77, 0x4d, 0xb8, 0xfc, 0xd7, 0xdf,
+    0xe6, 0x70, 0x3b, 0x5b, 0xf4, 0xf7, 0x18, 0xa9, 0x38, 0x61, 0x71, 0xa1,
+    0x88, 0xee, 0x1b, 0x81, 0xb5, 0xbc, 0x7c, 0x26, 0xb2, 0xd0, 0xc5, 0xba,
+    0x33, 0xe2, 0xb5, 0xd7, 0x32, 0xcc, 0x1d, 0x0c, 0x4e, 0x57, 0x57, 0xde,
+    0x25, 0xc7, 0x07, 0xa3, 0x4b, 0x7b, 0x72, 0x76, 0xeb, 0xe7, 0xcf, 0x55,
+    0xb9, 0xe6, 0xa0, 0xe1, 0xb8, 0x95, 0x61, 0x26, 0xe3, 0x7f, 0x9f, 0xf5,
+    0x5b, 0xea, 0x75, 0x61, 0x56, 0x3c, 0x50, 0x77, 0x47, 0x5b, 0x46, 0xbd,
+    0x3a, 0xf1, 0xe3, 0xa5, 0x2b, 0xaf, 0xcf, 0xcb, 0x15, 0xe5, 0x39, 0x66,
+    0xca, 0x9e, 0x53, 0x6f, 0x3d, 0x6b, 0x21, 0x98, 0x7c, 0xe4, 0x05, 0x8c,
+    0xcc, 0x34, 0x31, 0x1d, 0x7f, 0x94, 0x28, 0x21, 0xb1, 0xca, 0xac, 0x6f,
+    0x6f, 0x06, 0xde, 0xf4, 0x03, 0x01, 0x98, 0x65, 0x30, 0x06, 0x91, 0x6d,
+    0x77, 0x1f, 0x5a, 0x15, 0x22, 0xe1, 0xe7, 0x60, 0xa8, 0x0d, 0xb4, 0x83,
+    0xad, 0xbe, 0x42, 0xa2, 0xe2, 0xf1, 0x94, 0x30, 0x54, 0xfd, 0xee, 0x22,
+    0x5c, 0x31, 0xfc, 0xe4, 0xb5, 0x66, 0x2a, 0xb5, 0xa1, 0x46, 0x3c, 0x55,
+    0x1d, 0x91, 0xbf, 0x07, 0x08, 0x24, 0x15, 0xbb, 0x9b, 0x10, 0x6e, 0x4f,
+    0x3a, 0xf2, 0x2c, 0xe7, 0x36, 0xa9, 0x99, 0x62, 0x1d, 0x49, 0x3f, 0x85,
+    0x7e, 0xea, 0xe8, 0xbe, 0xef, 0x9f, 0xd9, 0x23, 0x96, 0xc5, 0x62, 0xa5,
+    0x88, 0xa9, 0xc4, 0xf6, 0xe5, 0xf9, 0xea, 0x3a, 0xa4, 0x0e, 0xf2, 0xcc,
+    0x0b, 0xc0, 0xd3, 0xce, 0xf5, 0xa6, 0x6c, 0xc2, 0x87, 0x2a, 0xf3, 0x19,
+    0x98, 0x1d, 0x08, 0x9b, 0xf8, 0x55, 0xa5, 0xe9, 0x96, 0x64, 0x19, 0x60,
+    0xd9, 0x8c, 0xc9, 0xca, 0x6f, 0x7f, 0xc5, 0x11, 0x7a, 0x64, 0xc8, 0x1b,
+    0x0d, 0x81, 0xcb, 0x95, 0x84, 0x13, 0x9a, 0xc6, 0x7a, 0x35, 0x92, 0x28,
+    0xcb, 0x4e, 0x6e, 0x12, 0x52, 0x8e, 0xe8, 0xf2, 0x58, 0xb8, 0x47, 0x86,
+    0xc5, 0x7c, 0x2c, 0x4b, 0x3a, 0x92, 0x2f, 0xb7, 0xe3, 0xeb, 0x35, 0x98,
+    0xef, 0x68, 0xd5, 0x8d, 0x68, 0x2a, 0x91, 0xd9, 0x88, 0x1b, 0xbc, 0x01,
+    0x12, 0x09, 0x03, 0x5d, 0x39, 0x50, 0xc8, 0x00, 0x90, 0x44, 0xb2, 0xcf,
+    0x32, 0x75, 0x9f, 0xc7, 0xce, 0x80, 0x80, 0x10, 0x14, 0x80, 0x42, 0x98,
+    0xd3, 0xd2, 0x80, 0x60, 0x23, 0xe1, 0xcc, 0xcc, 0x3f, 0xe3, 0xe5, 0xf8,
+    0xa0, 0x2d, 0xe1, 0x78, 0x3e, 0x23, 0x8b, 0xc6, 0x6c, 0x3e, 0x1b, 0x03,
+    0x1b, 0x1d, 0xf2, 0xc8, 0x4c, 0x24, 0x2c, 0x40, 0xd0, 0x92, 0x06, 0x82,
+    0xf5, 0x74, 0x63, 0x29, 0x3b, 0x45, 0x5c, 0x36, 0x96, 0xe7, 0x4f, 0x86,
+    0xfd, 0x31, 0xdb, 0x9c, 0x66, 0x29, 0x5c, 0x1e, 0xcc, 0xc7, 0x56, 0xcb,
+    0x9a, 0x71, 0x30, 0xff, 0x00, 0x68, 0x7c, 0xde, 0x07, 0xbd, 0x65, 0x8e,
+    0x1a, 0xac, 0x9d, 0x94, 0x59, 0x6b, 0x9c, 0x57, 0x32, 0x9c, 0x5e, 0xc2,
+    0xed, 0x8b, 0x2f, 0xff, 0x00, 0xcb, 0xe3, 0xcc, 0x1d, 0x07, 0x0c, 0xf1,
+    0xf4, 0xea, 0x2a, 0xdf, 0x71, 0x53, 0xfa, 0x5f, 0x91, 0x5e, 0x38, 0xf5,
+    0x39, 0xf8, 0xe9, 0x88, 0x8e, 0xf8, 0x78, 0xa9, 0x95, 0xb0, 0xec, 0xc8,
+    0xd6, 0x28, 0x46, 0xc4, 0x6b, 0x58, 0xda, 0x69, 0xd9, 0x95, 0x2b, 0x06,
+    0xe4, 0xb1, 0x24, 0x69, 0x27, 0x4b, 0xf5, 0xa5, 0x50, 0x0d, 0x89, 0xdf,
+    0x00, 0x21, 0x9b, 0x6f, 0xf4, 0xf7, 0xa0, 0x03, 0xac, 0x09, 0x59, 0x26,
+    0x00, 0x93, 0xe1, 0xf7, 0xa0, 0x26, 0x4e, 0xf1, 0x96, 0x20, 0x5a, 0x67,
+    0xe1, 0x3e, 0xff, 0x00, 0x8a, 0x03, 0xe8, 0x7f, 0xfc, 0x7d, 0xc1, 0x14,
+    0xec, 0xbc, 0x5e, 0x2d, 0x89, 0x5f, 0xdf, 0xc4, 0x00, 0x09, 0x05, 0x4a,
+    0xa9, 0x80, 0x47, 0x23, 0x25, 0xaf, 0xe5, 0x5d, 0x9f, 0xb3, 0xd4, 0x3d,
+    0xdd, 0x09, 0x55, 0x7f, 0xcc, 0xfe, 0x4b, 0xf5, 0xb9, 0xa6, 0xcc, 0x6a,
+    0x71, 0x54, 0x50, 0x5c, 0xbe, 0xa7, 0xae, 0x59, 0x18, 0x33, 0x20, 0x98,
+    0x99, 0xe7, 0xe1, 0x5b, 0xb9, 0x48, 0x84, 0x8b, 0xb3, 0xc6, 0x1d, 0xf7,
+    0x9f, 0x2e, 0xb4, 0xab, 0x0c, 0x04, 0x02, 0xcd, 0x02, 0x44, 0x6e, 0x06,
+    0x91, 0x14, 0x02, 0x85, 0x86, 0x92, 0xad, 0xad, 0xf6, 0xbf, 0x38, 0xa0,
+    0x24, 0x80, 0x24, 0xa0, 0x80, 0x34, 0xeb, 0xd6, 0x80, 0xe6, 0xf6, 0xb7,
+    0x64, 0xf0, 0x7d, 0xa9, 0x84, 0x06, 0x2e, 0x1a, 0xe1, 0xe2, 0xdb, 0x2e,
+    0x2a, 0x80, 0x1a, 0x6c, 0x01, 0xb6, 0xb1, 0x11, 0x7d, 0xab, 0x25, 0x2a,
+    0xb3, 0xa2, 0xf8, 0xa9, 0xbb, 0x3f, 0xcd, 0xff, 0x00, 0x2f, 0xd0, 0xb1,
+    0x47, 0x82, 0x4e, 0x74, 0xf4, 0x93, 0xf9, 0xf7, 0xf5, 0xf5, 0xb5, 0xec,
+    0xd1, 0xe1, 0x7b, 0x57, 0xb1, 0xf8, 0xce, 0xcf, 0xc5, 0xc9, 0x8b, 0x95,
+    0xa4, 0x4a, 0xb0, 0x62, 0x41, 0xe7, 0x07, 0x4b, 0x5a, 0xa5, 0xc7, 0x3d,
+    0xa7, 0x4d, 0xa8, 0x62, 0x97, 0x0b, 0xea, 0xb5, 0x5f, 0x7f, 0x0b, 0x3e,
+    0xf0, 0xb3, 0x68, 0xd1, 0x6a, 0x18, 0xa8, 0xf0, 0xbe, 0xab, 0x55, 0xf7,
+    0xdf, 0x95, 0x99, 0xcf, 0x38, 0x38, 0xc0, 0xdf, 0x0d, 0xc1, 0x03, 0x5d,
+    0xa7, 0x7f, 0x38, 0xa9, 0xd0, 0xcd, 0x70, 0x53, 0x8f, 0x12, 0xab, 0x1f,
+    0x16, 0x97, 0xc9, 0xd9, 0x93, 0x21, 0x8f, 0xc3, 0x4e, 0x3c, 0x4a, 0xa2,
+    0xf3, 0xb7, 0xc9, 0x83, 0xf6, 0x9a, 0xeb, 0x0c, 0xac, 0x26, 0xe4, 0xde,
+    0x7d, 0x6a, 0xda, 0xb9, 0xc6, 0x06, 0x94, 0x5c, 0xe5, 0x5a, 0x36, 0x5d,
+    0x1a, 0x6f, 0xc9, 0x5d, 0x95, 0x96, 0x3b, 0x0d, 0x05, 0xc4, 0xea, 0x2f,
+    0x3b, 0xfa, 0x17, 0x61, 0x70, 0x6c, 0xd0, 0x71, 0x1c, 0x45, 0xc1, 0x13,
+    0x7e, 0xad, 0x35, 0xa0, 0xc7, 0x7b, 0x61, 0x87, 0xa4, 0x9c, 0x70, 0xb1,
+    0x73, 0x7d, 0x5e, 0x8b, 0x6d, 0xfa, 0xbb, 0x3e, 0x56, 0x5d, 0xe4, 0x0a,
+    0xf9, 0xd5, 0x28, 0xdd, 0x52, 0x57, 0x7e, 0x4b, 0xef, 0xe8, 0x6a, 0xc2,
+    0x55, 0xc2, 0xba, 0x88, 0xf5, 0x92, 0x7c, 0xfc, 0xeb, 0x83, 0xcc, 0x73,
+    0x4c, 0x46, 0x63, 0x3e, 0x3c, 0x44, 0xaf, 0x6d, 0x97, 0x25, 0xdd, 0xf7,
+    0xdf, 0x6b, 0xb3, 0x49, 0x5f, 0x15, 0x53, 0x11, 0x2e, 0x2a, 0x8f, 0xf4,
+    0x2c, 0xca, 0x65, 0x80, 0x05, 0x88, 0x92, 0x6e, 0x6f, 0xd5, 0xab, 0x56,
+    0xd9, 0x8d, 0x05, 0x65, 0xa0, 0x29, 0x62, 0x63, 0xba, 0xdc, 0xaf, 0x15,
+    0x69, 0x7a, 0x63, 0xa8, 0x10, 0x1b, 0x3d, 0x85, 0xc6, 0xb7, 0x35, 0x54,
+    0x5e, 0x98, 0xf0, 0x06, 0x21, 0xcc, 0x4c, 0x58, 0x1f, 0xf7, 0xd2, 0xaf,
+    0x48, 0xbd, 0x32, 0xd1, 0x10, 0x61, 0xa7, 0x79, 0x30, 0x49, 0xb7, 0xe2,
+    0xb2, 0xc6, 0x25, 0xc9, 0x9c, 0x5f, 0xd4, 0x5c, 0x16, 0x4c, 0x34, 0xe2,
+    0x70, 0xec, 0x01, 0x0a, 0xf9, 0x7e, 0xa7, 0x9f, 0x2f, 0x51, 0x59, 0x5c,
+    0x6c, 0xae, 0x74, 0x99, 0x1e, 0x2f, 0x7c, 0x3c, 0x9f, 0x6a, 0xfa, 0xaf,
+    0xaf, 0x99, 0xc0, 0x59, 0x39, 0xad, 0x95, 0x74, 0x5b, 0x4f, 0x5f, 0xe5,
+    0x58, 0x74, 0x42, 0xc0, 0x00, 0x87, 0x13, 0x69, 0xb1, 0x9a, 0x03, 0xbf,
+    0xfa, 0x7b, 0xf4, 0xbf, 0x68, 0x76, 0xd6, 0x3a, 0x9e, 0x1f, 0x0f, 0xf6,
+    0xb8, 0x22, 0xc0, 0x3f, 0x11, 0x89, 0xf0, 0xc5, 0xe4, 0x89, 0xf8, 0x8c,
+    0x82, 0x2d, 0xbc, 0x4c, 0x4c, 0xd4, 0x8a, 0x38, 0x69, 0xd5, 0x7a, 0x2d,
+    0x3a, 0x96, 0xca, 0x6a, 0x27, 0xd2, 0xfb, 0x2b, 0xf4, 0x3f, 0x64, 0x70,
+    0x2a, 0x8f, 0x89, 0xc3, 0x9e, 0x37, 0x1c, 0x5b, 0x3e, 0x3d, 0xd6, 0x48,
+    0x82, 0x02, 0xe9, 0x1b, 0x89, 0x04, 0xf8, 0xcd, 0x6c, 0xe9, 0xe0, 0xe9,
+    0xc3, 0x75, 0x76, 0x47, 0x95, 0x56, 0xcf, 0x4a, 0x89, 0x87, 0x87, 0x87,
+    0x86, 0x98, 0x40, 0x60, 0xa2, 0x08, 0x54, 0x51, 0x01, 0x40, 0xd0, 0x46,
+    0xd5, 0x29, 0x24, 0x95, 0x91, 0x8c, 0x2c, 0x64, 0x40, 0x98, 0x37, 0x3b,
+    0x8d, 0x3f, 0xda, 0xa8, 0x0b, 0x77, 0x59, 0x64, 0x00, 0x05, 0xe3, 0xae,
+    0x54, 0x05, 0x1c, 0x67, 0x09, 0xc2, 0xf1, 0xd8, 0x48, 0x9c, 0x5e, 0x06,
+    0x0f, 0x10, 0x99, 0xa4, 0x0c, 0x5c, 0x30, 0xe0, 0x6b, 0xb1, 0xdf, 0x5b,
+    0xf8, 0xd5, 0xb2, 0x8c, 0x64, 0xad, 0x25, 0x72, 0xa9, 0xb5, 0xb1, 0xe2,
+    0x3b, 0x77, 0xff, 0x00, 0x8e, 0x78, 0x4c, 0x67, 0x18, 0xbd, 0x8b, 0x8b,
+    0xfb, 0x0f, 0x02, 0x30, 0x71, 0x49, 0x64, 0xe5, 0x66, 0xb9, 0x11, 0x73,
+    0x79, 0xf4, 0x15, 0x06, 0xae, 0x02, 0x2f, 0x5a, 0x6e, 0xc6, 0x58, 0xd6,
+    0x7f, 0xcc, 0x7c, 0xe7, 0x8e, 0xe0, 0x38, 0xbe, 0xcf, 0xc5, 0x6c, 0x1e,
+    0x37, 0x03, 0x17, 0x03, 0x1b, 0x52, 0x1f, 0x53, 0x78, 0xb6, 0xc4, 0x18,
+    0x3a, 0x18, 0x35, 0xac, 0x9c, 0x25, 0x07, 0x69, 0x2b, 0x12, 0x13, 0x4f,
+    0x63, 0x2e, 0x15, 0x82, 0xe5, 0xde, 0x60, 0x03, 0x56, 0x03, 0x5f, 0x65,
+    0x76, 0x7e, 0x3f, 0x6a, 0x71, 0xd8, 0x5c, 0x37, 0x0e, 0xa5, 0x73, 0x11,
+    0x9b, 0x70, 0x8b, 0x22, 0x49, 0xd2, 0xdf, 0x5f, 0x33, 0x52, 0x70, 0x98,
+    0x69, 0xe2, 0xaa, 0xaa, 0x50, 0xe7, 0xbf, 0x62, 0xea, 0x62, 0xad, 0x56,
+    0x34, 0x60, 0xe7, 0x23, 0xec, 0x18, 0x38, 0x6b, 0xc3, 0xe0, 0xe1, 0x61,
+    0x2a, 0x15, 0x4c, 0x20, 0x11, 0x57, 0x90, 0x03, 0x4f, 0x94, 0x0a, 0xf4,
+    0x24, 0xa3, 0x4e, 0x2a, 0x11, 0xd9, 0x68, 0x73, 0x4e, 0x4e, 0x4d, 0xc9,
+    0xee, 0xc7, 0xe6, 0x72, 0x31, 0x9d, 0xc9, 0x98, 0xf5, 0xac, 0x33, 0x99,
+    0x7a, 0x34, 0xac, 0x1e, 0xe8, 0xf8, 0xc6, 0x8b, 0x13, 0x15, 0x98, 0xc2,
+    0x04, 0xee, 0xfe, 0xe1, 0x10, 0x48, 0x22, 0x0c, 0x4c, 0x79, 0xfa, 0x50,
+    0x05, 0x75, 0x24, 0x9d, 0x20, 0x08, 0x12, 0x22, 0xdb, 0x8b, 0xd0, 0x10,
+    0x90, 0x54, 0x09, 0x32, 0x35, 0x1b, 0xf9, 0x8f, 0x3a, 0x00, 0x05, 0x05,
+    0x89, 0xcb, 0xca, 0xf2, 0x07, 0x57, 0xa0, 0x33, 0xf1, 0xbc, 0x1e, 0x17,
+    0x1d, 0xc3, 0xbe, 0x16, 0x3a, 0x12, 0x8d, 0x72, 0xd9, 0x60, 0x8e, 0x44,
+    0x79, 0x75, 0x6a, 0xc5, 0x5a, 0x8c, 0x6b, 0x41, 0xc2, 0x7b, 0x18, 0xab,
+    0x51, 0x85, 0x78, 0x70, 0x4d, 0x68, 0x78, 0x9e, 0xd3, 0xe0, 0x31, 0x7b,
+    0x37, 0x89, 0x38, 0x58, 0x83, 0x32, 0x34, 0xe5, 0xc4, 0x02, 0xcc, 0x37,
+    0xf5, 0xd2, 0xdf, 0xd8, 0xae, 0x3f, 0x1d, 0x87, 0x9e, 0x16, 0x7c, 0x32,
+    0xdb, 0x93, 0xea, 0x73, 0x18, 0x8c, 0x34, 0xf0, 0xf3, 0xe1, 0x96, 0xdc,
+    0x9f, 0x53, 0x09, 0x00, 0x1e, 0xf3, 0x06, 0x43, 0xa4, 0x93, 0xcf, 0xdb,
+    0x6a, 0xd6, 0x4a, 0x46, 0x34, 0x1c, 0x35, 0x21, 0xb5, 0x30, 0xb7, 0x12,
+    0x35, 0x3d, 0x7d, 0x2b, 0x04, 0xa4, 0x64, 0x43, 0x92, 0xc6, 0x7f, 0x69,
+    0x49, 0x3a, 0x93, 0xce, 0x7a, 0xf6, 0xac, 0x4d, 0x97, 0xa0, 0x08, 0x64,
+    0x0d, 0x08, 0x18, 0xf3, 0xdc, 0xcd, 0x5a, 0x5e, 0x99, 0x66, 0x1a, 0xac,
+    0x00, 0x21, 0xb5, 0x19, 0xbf, 0xae, 0xb9, 0x50, 0xbd, 0x32, 0xe4, 0xcc,
+    0xcd, 0x2f, 0x10, 0x44, 0x40, 0x9d, 0x26, 0xaf, 0x48, 0xbd, 0x31, 0xd2,
+    0x58, 0xa0, 0x32, 0x7c, 0xbe, 0xe2, 0xb3, 0x46, 0x25, 0xc9, 0x8f, 0x86,
+    0x99, 0xa1, 0x84, 0xe5, 0xd4, 0xcd, 0xab, 0x3c, 0x62, 0x56, 0xe5, 0x8c,
+    0xa1, 0xb0, 0xf2, 0x15, 0x46, 0xc3, 0x61, 0x04, 0x30, 0x91, 0x11, 0x71,
+    0x52, 0x61, 0x02, 0xf8, 0xcd, 0xc5, 0xdd, 0x3d, 0x4f, 0x21, 0xdb, 0x1d,
+    0x98, 0xfd, 0x9a, 0xe3, 0x10, 0x2b, 0xb6, 0x01, 0xb6, 0x1b, 0x8b, 0xdc,
+    0xff, 0x00, 0x13, 0xe3, 0xe3, 0xbf, 0xb0, 0x8f, 0x56, 0x8b, 0xa7, 0xdc,
+    0x76, 0xd9, 0x7e, 0x61, 0x0c, 0x64, 0x3a, 0x49, 0x6e, 0xbe, 0xab, 0xb3,
+    0xd3, 0xd7, 0xb9, 0xfa, 0x1f, 0xf4, 0x89, 0xed, 0x8c, 0x41, 0xc6, 0x71,
+    0xe0, 0xa7, 0x67, 0xe1, 0xb6, 0xda, 0xe3, 0x91, 0xa8, 0x1c, 0x94, 0x45,
+    0xc8, 0xf1, 0x02, 0xf2, 0x46, 0x7c, 0x2e, 0x15, 0xd5, 0xf8, 0xa5, 0xb7,
+    0xa9, 0x36, 0xa5, 0x4e, 0x1d, 0x16, 0xe7, 0xd7, 0x70, 0xb0, 0xd3, 0x05,
+    0x06, 0x12, 0x61, 0xae, 0x1a, 0x22, 0xe4, 0x45, 0xc3, 0x58, 0x51, 0xa5,
+    0x84, 0x69, 0xe1, 0x5b, 0x94, 0x92, 0xd1, 0x11, 0x46, 0xcb, 0x00, 0xc8,
+    0xcc, 0x26, 0x0c, 0x5a, 0xda, 0x50, 0x0a, 0xb6, 0x60, 0x6d, 0x16, 0xb9,
+    0xde, 0x77, 0xa1, 0x51, 0x83, 0x2a, 0xb9, 0xd2, 0x2f, 0xa8, 0x81, 0x42,
+    0x81, 0x2c, 0x10, 0xff, 0x00, 0xdc, 0x30, 0x8a, 0x2e, 0x4f, 0x2f, 0x1e,
+    0xb6, 0xaa, 0x36, 0x92, 0xbb, 0x29, 0x29, 0x28, 0xc5, 0xca, 0x4e, 0xc9,
+    0x1c, 0xde, 0x27, 0xb6, 0x38, 0x6c, 0x10, 0x46, 0x19, 0x38, 0x84, 0x13,
+    0xf0, 0xda, 0xf1, 0xcc, 0xda, 0xfc, 0xc4, 0xd4, 0x1a, 0xb9, 0x8d, 0x18,
+    0x69, 0x1d, 0x5f, 0xe7, 0xe6, 0x97, 0x34, 0x78, 0x9f, 0x68, 0xb0, 0x94,
+    0x6e, 0xa0, 0xdc, 0xde, 0xbb, 0x6d, 0xe6, 0xfd, 0x55, 0xcc, 0x78, 0x9d,
+    0xba, 0xcc, 0xbf, 0xf6, 0xb0, 0x51, 0x71, 0x08, 0x20, 0x31, 0x72, 0xc3,
+    0xc3, 0x48, 0xdc, 0xd4, 0x49, 0xe6, 0xb2, 0x6b, 0xe1, 0x8d, 0xbe, 0x7f,
+    0x63, 0x53, 0x57, 0xda, 0x9a, 0x8d, 0x7f, 0x97, 0x4d, 0x27, 0xda, 0xef,
+    0xf6, 0x39, 0xbd, 0xaa, 0xf8, 0x5d, 0xad, 0xc3, 0x9e, 0x1f, 0xb4, 0xb0,
+    0x30, 0xb1, 0xd0, 0xca, 0xab, 0x81, 0x18, 0x89, 0x30, 0x65, 0x58, 0xcc,
+    0x19, 0x0b, 0xe7, 0xbc, 0x8a, 0xc3, 0x3c, 0x7c, 0xaa, 0x69, 0x52, 0x29,
+    0xaf, 0x9f, 0x9e, 0xa5, 0x94, 0xbd, 0xaa, 0xc4, 0xc2, 0x49, 0xca, 0x11,
+    0x6b, 0xb2, 0xeb, 0xea, 0xfd, 0x0f, 0x0b, 0x8f, 0xfa, 0x4b, 0x89, 0x45,
+    0x07, 0x03, 0x88, 0xc2, 0xc6, 0x85, 0x39, 0x83, 0x8c, 0xad, 0xe0, 0x01,
+    0xbf, 0xdb, 0x6f, 0x1a, 0x8a, 0xaa, 0x2e, 0x66, 0xdf, 0x0f, 0xed, 0x75,
+    0x09, 0xca, 0xd5, 0xa9, 0xb8, 0xf6, 0xa7, 0x7f, 0x3d, 0x9e, 0x9d, 0x97,
+    0x3d, 0x5f, 0xe9, 0x1e, 0xc6, 0xc0, 0xec, 0xbe, 0x14, 0x30, 0x39, 0xf8,
+    0xac, 0x45, 0x9c, 0x52, 0xd1, 0x29, 0x6f, 0x84, 0x46, 0x83, 0xc7, 0x78,
+    0xf2, 0x15, 0xda, 0xe4, 0xb4, 0xf0, 0xf0, 0xa3, 0xc7, 0x4a, 0x57, 0x93,
+    0xdf, 0xaa, 0xec, 0xb7, 0x2f, 0xae, 0xfd, 0x0c, 0x95, 0x73, 0x28, 0x63,
+    0x9d, 0xe9, 0x4a, 0xf1, 0x5f, 0x97, 0x7c, 0xce, 0xff, 0x00, 0x78, 0x87,
+    0x11, 0x22, 0x64, 0xda, 0x6f, 0x1e, 0x15, 0xb3, 0x9c, 0xcb, 0x10, 0xca,
+    0x42, 0x81, 0x73, 0x68, 0x89, 0xea, 0x6a, 0x2c, 0xe6, 0x65, 0x45, 0xd7,
+    0x79, 0x13, 0x27, 0x2d, 0xe7, 0x7f, 0x4f, 0x96, 0xb5, 0xb1, 0x30, 0x85,
+    0x8e, 0x53, 0x24, 0xe5, 0x17, 0xba, 0xdf, 0x7f, 0xc9, 0xa0, 0x0b, 0x12,
+    0x00, 0x98, 0x61, 0xf0, 0xf7, 0xbc, 0xf4, 0xfa, 0xde, 0x80, 0x00, 0xb1,
+    0x00, 0x80, 0x7f, 0x72, 0xd1, 0x26, 0x7c, 0x3e, 0xf3, 0x40, 0x04, 0x99,
+    0x01, 0x96, 0xc4, 0x48, 0x33, 0xd6, 0x94, 0x00, 0x02, 0xcc, 0x62, 0x09,
+    0x93, 0x3c, 0xef, 0xe3, 0xe3, 0x40, 0x64, 0xed, 0x4e, 0x00, 0x71, 0xfc,
+    0x23, 0x23, 0xac, 0xe2, 0x4e, 0x64, 0x20, 0x91, 0x0d, 0x1e, 0xbe, 0xbf,
+    0xdd, 0x44, 0xc7, 0x61, 0x16, 0x2e, 0x8b, 0xa6, 0xf7, 0xe5, 0xde, 0x47,
+    0xc5, 0x50, 0x55, 0xe9, 0xb8, 0x3d, 0xf9, 0x77, 0x9e, 0x0d, 0x93, 0x29,
+    0x38, 0x6d, 0x94, 0x15, 0x26, 0x54, 0x82, 0x08, 0x37, 0x90, 0x6b, 0xce,
+    0xe7, 0x78, 0xb7, 0x19, 0x68, 0xd1, 0xcb, 0x59, 0xa7, 0x66, 0x19, 0x2e,
+    0xac, 0x59, 0x7b, 0xad, 0xcc, 0x8f, 0x0d, 0x2b, 0x0b, 0x65, 0xe8, 0x30,
+    0xb9, 0x02, 0xb4, 0x28, 0x91, 0x70, 0x24, 0x1d, 0x3f, 0x15, 0x69, 0x7a,
+    0x63, 0xa2, 0x66, 0x02, 0x00, 0x00, 0xc4, 0x91, 0xaf, 0x5f, 0x8a, 0xaa,
+    0x2f, 0x4c, 0x7c, 0x30, 0xcc, 0x16, 0x14, 0x01, 0xb0, 0x07, 0x7a, 0xbd,
+    0x22, 0xf4, 0xc2, 0x98, 0x61, 0x48, 0x92, 0x0d, 0x65, 0x8c, 0x4b, 0xae,
+    0x5e, 0x8a, 0x26, 0x20, 0x48, 0xba, 0x80, 0x63, 0xad, 0xba, 0x9a, 0x91,
+    0x18, 0x95, 0xb9, 0x6e, 0x16, 0x10, 0x8f, 0x86, 0x18, 0xec, 0x3e, 0x7e,
+    0x75, 0x26, 0x10, 0x2e, 0xb8, 0xf8, 0x61, 0xb2, 0xff, 0x00, 0x38, 0x13,
+    0x2b, 0xca, 0xf5, 0x2e, 0x10, 0x2b, 0x73, 0xa1, 0xd9, 0x3d, 0x96, 0x9d,
+    0xa4, 0xed, 0xc3, 0xe2, 0xe1, 0x83, 0xc3, 0xff, 0x00, 0xf7, 0x02, 0x4e,
+    0x93, 0xf0, 0xf8, 0x13, 0xcf, 0x5b, 0x48, 0xd2, 0xa4, 0x7b, 0xb5, 0x28,
+    0xda, 0x5b, 0x1b, 0x2c, 0xae, 0x94, 0xea, 0x57, 0x52, 0x83, 0xb7, 0x0e,
+    0xbf, 0xa7, 0x8f, 0xa5, 0xcf, 0x6f, 0x84, 0x88, 0x98, 0x69, 0x87, 0x82,
+    0x10, 0x22, 0x0c, 0xaa, 0x15, 0x60, 0x28, 0x1b, 0x08, 0xda, 0x39, 0x72,
+    0xac, 0xa9, 0x24, 0xac, 0x8e, 0xb2, 0xe3, 0x0f, 0xe2, 0x0f, 0x74, 0x93,
+    0x30, 0x4e, 0xf4, 0x00, 0x86, 0x2b, 0x39, 0xa2, 0xd9, 0x40, 0x89, 0x9b,
+    0x50, 0x10, 0x02, 0x5a, 0x6d, 0x31, 0x20, 0x45, 0xbc, 0xbd, 0xc5, 0x01,
+    0x93, 0xb4, 0x38, 0xec, 0x2e, 0x0f, 0x08, 0xb3, 0x62, 0xcb, 0xea, 0xb8,
+    0x43, 0x53, 0xf2, 0xdb, 0xc6, 0xa3, 0xe2, 0x31, 0x30, 0xa1, 0x1b, 0xcb,
+    0x7e, 0x86, 0xbf, 0x30, 0xcc, 0xa8, 0xe0, 0x60, 0xdc, 0xdd, 0xe5, 0xc9,
+    0x73, 0x7f, 0xa7, 0x6f, 0xd7, 0x43, 0xcd, 0x71, 0xbc, 0x5e, 0x3f, 0x19,
+    0x2f, 0x8d, 0x60, 0x05, 0x90, 0x4e, 0x59, 0x1b, 0xc7, 0xce, 0xb9, 0xfa,
+    0xf8, 0x9a, 0x95, 0xdd, 0xe4, 0xfc, 0x39, 0x1c, 0x06, 0x3b, 0x32, 0xaf,
+    0x8e, 0x95, 0xea, 0xbd, 0x3a, 0x2d, 0xbc, 0xbe, 0xbf, 0x43, 0x3e, 0x28,
+    0x2c, 0xa6, 0xcd, 0x3a, 0x91, 0xa8, 0xff, 0x00, 0x6d, 0x51, 0xc8, 0x05,
+    0x89, 0x36, 0x04, 0x11, 0xdf, 0xcc, 0x27, 0x97, 0x5b, 0x50, 0x0a, 0xa0,
+    0x06, 0x12, 0xca, 0x22, 0xc4, 0x96, 0x92, 0x6f, 0x6a, 0x00, 0x6c, 0xa5,
+    0x03, 0x18, 0x13, 0xeb, 0xb5, 0x01, 0x24, 0xab, 0x4a, 0xf7, 0x37, 0x95,
+    0x04, 0x4d, 0xef, 0x57, 0xc2, 0x72, 0xa7, 0x2e, 0x28, 0x3b, 0x3e, 0xc2,
+    0xe8, 0xce, 0x50, 0x7c, 0x51, 0x76, 0x66, 0xec, 0x0e, 0x2d, 0x5a, 0x17,
+    0x15, 0x82, 0xc5, 0x83, 0x03, 0xe1, 0xbf, 0xda, 0xba, 0x4c, 0x16, 0x73,
+    0xef, 0x7e, 0x0c, 0x45, 0x93, 0xeb, 0xc9, 0xf7, 0xf6, 0xfc, 0x8e, 0x8f,
+    0x01, 0x9a, 0xaa, 0x8f, 0x82, 0xbb, 0x49, 0xf5, 0xe5, 0xe3, 0xdb, 0xf2,
+    0x34, 0x92, 0x06, 0x80, 0x03, 0xfc, 0x88, 0x36, 0x1b, 0xf9, 0x56, 0xc2,
+    0xa5, 0x43, 0xa0, 0x46, 0xac, 0x29, 0x65, 0x4c, 0xf3, 0x17, 0x99, 0x27,
+    0xaf, 0x6a, 0xdf, 0x18, 0x40, 0x40, 0x95, 0xb8, 0x91, 0xac, 0x5e, 0xd3,
+    0xf6, 0xa0, 0x00, 0x03, 0x21, 0x02, 0x00, 0xb9, 0x33, 0x69, 0xf1, 0x1c,
+    0xa8, 0x02, 0x44, 0xaa, 0x11, 0x39, 0x4d, 0xc8, 0x22, 0x7d, 0x68, 0x08,
+    0x46, 0x69, 0x52, 0xa0, 0x5e, 0x6d, 0x36, 0x8f, 0xc7, 0xda, 0x80, 0x60,
+    0x46, 0x61, 0x78, 0x89, 0x04, 0x9e, 0x64, 0xf3, 0xeb, 0x5a, 0x01, 0x54,
+    0x5a, 0x09, 0x22, 0x2e, 0x73, 0x5c, 0x69, 0xaf, 0x5e, 0x34, 0x07, 0x92,
+    0xfd, 0x4d, 0xc1, 0x2e, 0x0f, 0x1a, 0xb8, 0xb8, 0x39, 0x06, 0x1e, 0x2a,
+    0xcc, 0x0b, 0x5c, 0x6a, 0x7e, 0x9e, 0xb3, 0x5c, 0x47, 0xb4, 0x38, 0x55,
+    0x46, 0xba, 0xab, 0x1d, 0xa7, 0xea, 0xb7, 0xf3, 0xd3, 0xc6, 0xe7, 0x3f,
+    0x99, 0x51, 0x54, 0xea, 0x29, 0xaf, 0xe6, 0xf5, 0x38, 0xa2, 0x20, 0x39,
+    0x5c, 0xe6, 0x40, 0x9e, 0x5f, 0xdd, 0x73, 0xe6, 0xbd, 0x31, 0xd2, 0x32,
+    0x19, 0x21, 0x67, 0xfe, 0x5a, 0x01, 0xe5, 0xbe, 0xf4, 0x45, 0xe9, 0x96,
+    0x22, 0xd9, 0x97, 0x4f, 0xe3, 0x96, 0x75, 0xde, 0xaf, 0x48, 0xbd, 0x31,
+    0xc0, 0x08, 0x03, 0x0e, 0xf0, 0x6d, 0x01, 0xb5, 0x66, 0x8c, 0x4b, 0x93,
+    0x2d, 0x01, 0xb3, 0x02, 0xa3, 0xbc, 0x44, 0x8f, 0x28, 0xac, 0xf1, 0x89,
+    0x5b, 0x96, 0x8c, 0x38, 0xf8, 0x73, 0x65, 0x17, 0x81, 0xb7, 0x57, 0xa9,
+    0x50, 0x81, 0x75, 0xcb, 0x51, 0x21, 0x48, 0x39, 0x43, 0x34, 0x5e, 0x45,
+    0xb9, 0xd4, 0xa8, 0x40, 0xad, 0xcb, 0xb0, 0xc4, 0x65, 0x52, 0x3d, 0xb4,
+    0xea, 0x7d, 0x66, 0xa5, 0xc2, 0x05, 0x6e, 0x7a, 0xee, 0xc1, 0xe1, 0x53,
+    0x85, 0xec, 0xf4, 0x2a, 0x08, 0xc4, 0xc4, 0x01, 0xd8, 0x81, 0x3e, 0x5f,
+    0x4f, 0xad, 0x64, 0x67, 0x63, 0x95, 0xe1, 0xd5, 0x1a, 0x09, 0xf3, 0x96,
+    0xbf, 0x6f, 0xce, 0xb7, 0x3a, 0x0b, 0x04, 0x7c, 0x20, 0x6f, 0x6b, 0x8a,
+    0xa1, 0xb1, 0x19, 0x18, 0x10, 0x66, 0xe0, 0x99, 0x11, 0x71, 0xd5, 0x8d,
+    0x01, 0x08, 0x02, 0x01, 0x00, 0xc8, 0x00, 0x8d, 0xba, 0xeb, 0x6a, 0x02,
+    0x8e, 0xd0, 0xe2, 0x17, 0x85, 0xe1, 0xb1, 0x71, 0x18, 0xec, 0x2d, 0x31,
+    0x27, 0x97, 0x87, 0xbd, 0x61, 0xaf, 0x59, 0x50, 0x83, 0x9b, 0x21, 0xe3,
+    0xb1, 0x90, 0xc1, 0x50, 0x75, 0xa7, 0xad, 0xb6, 0x5d, 0x5f, 0xe7, 0xca,
+    0xe7, 0x93, 0xe3, 0x38, 0x97, 0xe2, 0x71, 0x5b, 0x17, 0x1a, 0x59, 0xc8,
+    0xda, 0x40, 0x1b, 0x47, 0x87, 0x5e, 0x35, 0xcd, 0x55, 0xab, 0x2a, 0xd2,
+    0xe3, 0x99, 0xe6, 0xd8, 0xbc, 0x5d, 0x5c, 0x5d, 0x57, 0x56, 0xab, 0xd7,
+    0xd3, 0xb1, 0x76, 0x7e, 0x6e, 0x52, 0x1f, 0x32, 0x92, 0x41, 0xca, 0x6c,
+    0x09, 0x13, 0x1d, 0x5c, 0xd6, 0x22, 0x30, 0xd8, 0x84, 0xa5, 0xd4, 0x58,
+    0x8d, 0x0e, 0xde, 0x14, 0x00, 0x04, 0xcc, 0x38, 0x66, 0x9b, 0xc0, 0x17,
+    0xf5, 0xa0, 0x00, 0x03, 0x2e, 0x60, 0x09, 0x91, 0x04, 0x45, 0x85, 0x00,
+    0xf2, 0x03, 0x43, 0x13, 0x11, 0xbd, 0x8d, 0x00, 0xa2, 0x7f, 0x6c, 0xc8,
+    0x98, 0xbc, 0x15, 0xdf, 0xc7, 0xe9, 0x40, 0x47, 0xf8, 0x54, 0x1b, 0x19,
+    0x80, 0xa7, 0x97, 0x95, 0x01, 0xb3, 0x83, 0xc6, 0x96, 0x38, 0x2c, 0x04,
+    0x8d, 0x24, 0xfa, 0xed, 0xf5, 0xad, 0xc6, 0x0f, 0x18, 0xe5, 0x1f, 0x75,
+    0x2e, 0x5b, 0x1d, 0x46, 0x4f, 0x8f, 0xf7, 0x89, 0x61, 0xe7, 0xba, 0x5a,
+    0x76, 0xae, 0x9d, 0xff, 0x00, 0x4f, 0x9f, 0x4f, 0x12, 0xe1, 0x64, 0x03,
+    0x13, 0x65, 0xb4, 0x0e, 0xb9, 0xd7, 0x7a, 0x6d, 0xc0, 0x46, 0x42, 0x4e,
+    0x57, 0x8f, 0x1d, 0x23, 0x7f, 0x68, 0xa0, 0x0e, 0x20, 0x8e, 0xe9, 0x20,
+    0x93, 0xb0, 0xd8, 0xed, 0x40, 0x34, 0x48, 0x2a, 0x15, 0x6d, 0x79, 0x8d,
+    0x68, 0x04, 0x83, 0x10, 0x18, 0x4b, 0x9f, 0xf9, 0x7b, 0x1a, 0x02, 0x1b,
+    0x80, 0x97, 0x25, 0xb5, 0xbf, 0x85, 0x00, 0xcd, 0x94, 0x48, 0x71, 0xdd,
+    0x66, 0xdb, 0x9e, 0xf1, 0xef, 0x40, 0x73, 0x3f, 0x52, 0xe0, 0x26, 0x37,
+    0x64, 0x92, 0x15, 0x8b, 0x20, 0x18, 0x8b, 0x94, 0xda, 0xda, 0xed, 0xc8,
+    0x9a, 0xd3, 0x67, 0xd4, 0x7d, 0xee, 0x0e, 0x4d, 0x6f, 0x1b, 0x3f, 0xa3,
+    0xf9, 0x36, 0xc8, 0x19, 0x8d, 0x3e, 0x3a, 0x0d, 0xf4, 0xd4, 0xf2, 0x07,
+    0x34, 0x46, 0x19, 0xb1, 0x20, 0x48, 0xeb, 0xef, 0x5c, 0x0a, 0x39, 0xc4,
+    0xc3, 0x96, 0x56, 0xe4, 0xd8, 0xcc, 0x92, 0x0c, 0xc8, 0xd2, 0xaf, 0x48,
+    0xbd, 0x32, 0xec, 0x3c, 0x22, 0x5c, 0xeb, 0xf1, 0x6b, 0x3a, 0x1e, 0x55,
+    0x96, 0x31, 0x2e, 0x4c, 0xb5, 0x52, 0x15, 0x82, 0x82, 0x05, 0xb5, 0x33,
+    0xad, 0x48, 0x8c, 0x4a, 0xdc, 0x75, 0x48, 0x24, 0xb8, 0x26, 0x05, 0x8a,
+    0xdf, 0x9f, 0xf5, 0x52, 0x61, 0x02, 0xeb, 0x97, 0xa8, 0x66, 0x2a, 0xa7,
+    0x96, 0x69, 0xe7, 0x6e, 0x75, 0x2e, 0x10, 0x2b, 0x72, 0xf4, 0x44, 0xb9,
+    0x2c, 0x35, 0xd3, 0x4d, 0xed, 0xf4, 0xa9, 0x70, 0x81, 0x5b, 0x97, 0xf0,
+    0x98, 0x2b, 0x8d, 0xc5, 0x61, 0x61, 0xe2, 0x13, 0x0e, 0xc1, 0x75, 0x89,
+    0x05, 0xa2, 0xd5, 0x2a, 0x31, 0xb2, 0xb9, 0x9b, 0x0f, 0x15, 0x52, 0xac,
+    0x60, 0xf6, 0x6d, 0x2f, 0x99, 0xed, 0x50, 0x18, 0xee, 0xb1, 0x3a, 0x44,
+    0x6f, 0xe7, 0xca, 0xb0, 0x1e, 0x82, 0x43, 0x64, 0x6b, 0x5c, 0x6b, 0x06,
+    0xdd, 0x5a, 0x80, 0x13, 0x9a, 0x14, 0xea, 0x45, 0xe3, 0x53, 0xf8, 0xa0,
+    0x1c, 0x12, 0x44, 0xa2, 0xe6, 0x04, 0x46, 0xb0, 0x67, 0xa1, 0x40, 0x79,
+    0xae, 0xdf, 0xe3, 0x3f, 0x73, 0x88, 0x6c, 0x0b, 0x8c, 0x34, 0x10, 0x40,
+    0x33, 0x2d, 0x1b, 0xc6, 0xfb, 0x75, 0x15, 0xa0, 0xcc, 0x6b, 0xb9, 0xd4,
+    0xe0, 0x4f, 0x45, 0xeb, 0xf9, 0xa1, 0xc0, 0xfb, 0x43, 0x8d, 0x95, 0x6c,
+    0x43, 0xa0, 0x9f, 0xc3, 0x1f, 0x5e, 0x6f, 0xc3, 0x6e, 0xcb, 0x3e, 0xac,
+    0xe5, 0x15, 0x69, 0xcb, 0x24, 0x31, 0xb4, 0x9d, 0xef, 0xfe, 0x56, 0xb8,
+    0xe7, 0xc6, 0x0f, 0x98, 0x66, 0x58, 0x01, 0x6f, 0x04, 0x69, 0xe3, 0xef,
+    0x40, 0x23, 0x01, 0x25, 0x9a, 0x48, 0xbe, 0xfa, 0xef, 0x14, 0x01, 0x7b,
+    0x13, 0x71, 0x24, 0x83, 0x24, 0xc7, 0xde, 0x80, 0x66, 0x61, 0x10, 0x7b,
+    0xc4, 0x4d, 0xa6, 0x09, 0x3d, 0x7d, 0xa8, 0x00, 0x55, 0xbf, 0x73, 0xba,
+    0xac, 0x60, 0xc4, 0xf3, 0xf1, 0xe5, 0xce, 0x80, 0x8c, 0x08, 0x4c, 0xa8,
+    0xa0, 0x2c, 0x48, 0x8f, 0x2b, 0xeb, 0xf4, 0xa0, 0x04, 0x99, 0x52, 0xa3,
+    0x49, 0x8e, 0xb9, 0xd0, 0x0c, 0x90, 0xae, 0x32, 0xdb, 0x2d, 0x81, 0x22,
+    0xe2, 0x4d, 0xaa, 0xa9, 0xb4, 0xee, 0x8b, 0xe1, 0x37, 0x09, 0x29, 0xc7,
+    0x74, 0x77, 0xdc, 0x16, 0x63, 0x76, 0x2b, 0x24, 0x65, 0xf7, 0xe7, 0xa5,
+    0x7a, 0xa1, 0xde, 0x12, 0x46, 0x50, 0x2d, 0x20, 0xe9, 0xcf, 0x6d, 0x28,
+    0x02, 0xd6, 0x11, 0x39, 0x51, 0xb4, 0x23, 0x73, 0xce, 0x80, 0x19, 0x4d,
+    0x98, 0x15, 0x08, 0x08, 0x80, 0x44, 0x4c, 0x69, 0x40, 0x42, 0xfd, 0xe5,
+    0x06, 0x08, 0xd2, 0x66, 0xde, 0x5d, 0x72, 0xa0, 0x22, 0xce, 0x66, 0x26,
+    0x0c, 0x89, 0xff, 0x00, 0xd4, 0x72, 0xf6, 0xa0, 0x01, 0x27, 0x2c, 0x98,
+    0x04, 0x9f, 0x8b, 0x95, 0xf4, 0xa0, 0x29, 0xed, 0x1c, 0x3c, 0xfc, 0x3e,
+    0x26, 0x1e, 0x1f, 0xc6, 0xe8, 0xc8, 0x8b, 0xa5, 0xe0, 0x81, 0xaf, 0xa5,
+    0x47, 0xc5, 0xd3, 0x95, 0x4a, 0x15, 0x21, 0x1d, 0xda, 0x69, 0x79, 0x18,
+    0xab, 0xc5, 0xce, 0x94, 0xa3, 0x1d, 0xda, 0x67, 0x88, 0x60, 0x00, 0x2b,
+    0x05, 0x48, 0x10, 0x66, 0xf0, 0x2b, 0xcc, 0x92, 0x39, 0x04, 0xcb, 0x17,
+    0x0f, 0xbf, 0x79, 0x1f, 0xc6, 0x39, 0x6f, 0xce, 0xb3, 0x46, 0x25, 0xc9,
+    0x97, 0x14, 0x98, 0x11, 0xad, 0xbb, 0xc3, 0x51, 0xe7, 0x59, 0xe3, 0x12,
+    0xb7, 0x1d, 0x14, 0xbc, 0xa0, 0x27, 0x42, 0x23, 0xe7, 0x52, 0xa1, 0x02,
+    0xeb, 0x97, 0x04, 0x23, 0x0c, 0x08, 0x03, 0x29, 0xd4, 0xf5, 0xce, 0xa5,
+    0x42, 0x05, 0x6e, 0x58, 0x82, 0x4a, 0x8d, 0x01, 0x2d, 0x12, 0x37, 0xe6,
+    0x6a, 0x5c, 0x20, 0x56, 0xe5, 0xab, 0x98, 0x05, 0x89, 0x0e, 0x44, 0x01,
+    0xa0, 0x8b, 0x7d, 0x6a, 0x5c, 0x20, 0x56, 0xe7, 0x47, 0xb1, 0x15, 0x0f,
+    0x1b, 0x80, 0x4a, 0x5a, 0x4d, 0x87, 0xff, 0x00, 0x99, 0xac, 0xd5, 0x23,
+    0x6a, 0x6d, 0x9b, 0x2c, 0xa5, 0x29, 0x62, 0xe0, 0x9f, 0x6f, 0xa3, 0x3d,
+    0x41, 0x95, 0x0c, 0x18, 0xe6, 0x36, 0x04, 0x46, 0x96, 0xa8, 0x47, 0x72,
+    0x13, 0x87, 0x39, 0x65, 0x64, 0x2d, 0xa0, 0xf9, 0x6d, 0x41, 0x71, 0x2c,
+    0xd7, 0x3d, 0xc2, 0x04, 0x69, 0xb5, 0x00, 0x31, 0xb1, 0x86, 0x12, 0xb3,
+    0xe2, 0x82, 0xaa, 0xa0, 0x92, 0xda, 0xc7, 0x3a, 0xa4, 0xa4, 0xa2, 0x9c,
+    0x9e, 0xc8, 0xb2, 0xa4, 0xe3, 0x4a, 0x0e, 0xa4, 0x9e, 0x89, 0x5d, 0xf7,
+    0x23, 0xc6, 0xe2, 0x62, 0x1c, 0x66, 0x77, 0xc4, 0x6e, 0xf3, 0x4b, 0x31,
+    0x04, 0x6b, 0xbd, 0xbe, 0x75, 0xc9, 0x4a, 0x4e, 0x4d, 0xc9, 0xee, 0xcf,
+    0x27, 0xa9, 0x52, 0x55, 0x26, 0xe7, 0x3d, 0xdb, 0xbb, 0xf1, 0x14, 0x98,
+    0x51, 0x04, 0xad, 0xb5, 0x1f, 0x4f, 0x97, 0x5c, 0xed, 0x2c, 0x18, 0xc1,
+    0x51, 0x94, 0x2a, 0xc4, 0x18, 0x98, 0x8a, 0x00, 0x2a, 0x82, 0x49, 0xcd,
+    0x20, 0xda, 0xe6, 0x67, 0xa1, 0x40, 0x04, 0x39, 0x90, 0x42, 0xc6, 0xe0,
+    0x93, 0xae, 0xd4, 0x01, 0xcc, 0x09, 0x51, 0xcb, 0xc4, 0xcf, 0x88, 0xa0,
+    0x11, 0x58, 0x95, 0x95, 0xce, 0x58, 0x93, 0x3c, 0xcf, 0x5f, 0x7a, 0x01,
+    0xc2, 0x80, 0x55, 0x4b, 0x32, 0xdc, 0xdb, 0x48, 0x99, 0xeb, 0xd6, 0x80,
+    0x90, 0xa4, 0xd9, 0x8b, 0x36, 0xf9, 0x6c, 0x3c, 0x3c, 0x4e, 0xd4, 0x00,
+    0x2e, 0x1a, 0x0a, 0xb0, 0x00, 0x7c, 0x33, 0xd7, 0x8f, 0xb5, 0x01, 0xde,
+    0x52, 0x57, 0xba, 0x27, 0x5b, 0x7f, 0x9f, 0xdd, 0x7a, 0xa9, 0xdf, 0x87,
+    0x29, 0x69, 0x0a, 0x66, 0x04, 0x03, 0xcf, 0xd4, 0x75, 0x7a, 0x00, 0x91,
+    0x1f, 0x18, 0xe5, 0x79, 0x8f, 0x5f, 0x7a, 0x00, 0x49, 0xca, 0x45, 0xcc,
+    0xd8, 0x03, 0xbd, 0x00, 0xac, 0x56, 0x58, 0x5c, 0x36, 0x90, 0x7f, 0x14,
+    0x03, 0x17, 0x86, 0x03, 0x36, 0x57, 0x3a, 0x92, 0xa0, 0x47, 0xa7, 0x5f,
+    0x6a, 0x02, 0x16, 0x30, 0x6d, 0x0c, 0xc4, 0xcc, 0x98, 0x3f, 0xed, 0xe8,
+    0x05, 0xce, 0x98, 0x60, 0xbb, 0x3d, 0xd4, 0x19, 0x27, 0x48, 0x1b, 0xeb,
+    0x54, 0x94, 0x94, 0x53, 0x94, 0x9d, 0x92, 0x28, 0xda, 0x8a, 0xbb, 0x3c,
+    0x38, 0x55, 0x2c, 0xda, 0xf3, 0x02, 0x2f, 0xe5, 0x5e, 0x61, 0x18, 0x9c,
+    0x4d, 0xcd, 0x09, 0x87, 0x04, 0x40, 0xcc, 0x42, 0xf9, 0x30, 0xf4, 0xf5,
+    0xa9, 0x11, 0x89, 0x5b, 0x8d, 0x86, 0xa1, 0xd1, 0x41, 0x04, 0x9d, 0x8c,
+    0x4f, 0x95, 0x49, 0x84, 0x0b, 0xae, 0x5a, 0xaa, 0xaa, 0xb1, 0x32, 0x34,
+    0xbf, 0x5d, 0x4d, 0x4b, 0x84, 0x0a, 0xdc, 0xb0, 0x20, 0xb2, 0x32, 0xab,
+    0x79, 0x49, 0x9f, 0x01, 0x15, 0x2e, 0x10, 0x2b, 0x72, 0xf0, 0x9d, 0xec,
+    0xac, 0x42, 0xdb, 0x59, 0xf4, 0xa9, 0x70, 0x81, 0x5b, 0x97, 0x83, 0x28,
+    0x48, 0x59, 0x06, 0x44, 0x15, 0xbe, 0x96, 0xa9, 0x70, 0x81, 0x5b, 0x9b,
+    0xbb, 0x2b, 0x2e, 0x1f, 0x1d, 0x86, 0x5e, 0x04, 0x18, 0x82, 0x37, 0x20,
+    0x8d, 0x45, 0x5f, 0x5a, 0x0d, 0xd2, 0x76, 0x36, 0x59, 0x4d, 0x48, 0xc3,
+    0x19, 0x07, 0x2e, 0xef, 0x34, 0xd2, 0xf9, 0x9e, 0x8e, 0x36, 0x20, 0xc9,
+    0xd6, 0xe6, 0x4c, 0x6b, 0xf4, 0x15, 0xaa, 0x3b, 0xd0, 0xa7, 0x25, 0x61,
+    0x9b, 0x42, 0x41, 0xda, 0x80, 0x98, 0x73, 0x78, 0x1b, 0x9b, 0xf2, 0x3d,
+    0x7d, 0x68, 0x19, 0x9f, 0xb4, 0xaf, 0xc0, 0x63, 0xc0, 0xbf, 0xed, 0x30,
+    0x3b, 0x45, 0xb4, 0xac, 0x38, 0x8f, 0xe1, 0x4f, 0xb9, 0xfa, 0x10, 0xf3,
+    0x0f, 0xf4, 0x95, 0x7f, 0xdb, 0x2f, 0x46, 0x78, 0xf3, 0x24, 0xb1, 0xba,
+    0x11, 0xed, 0x5c, 0xa9, 0xe5, 0xa4, 0x8c, 0xeb, 0x20, 0x1c, 0xe4, 0xd8,
+    0x13, 0xa9, 0x9a, 0x00, 0x32, 0x06, 0x6b, 0xdc, 0x15, 0xf9, 0x78, 0xd0,
+    0x10, 0x01, 0x12, 0x75, 0x6b, 0x93, 0xa8, 0x27, 0xc7, 0xe7, 0x40, 0x16,
+    0x11, 0x01, 0x5a, 0xd7, 0x3d, 0xe8, 0x3f, 0xed, 0x00, 0x24, 0x16, 0x95,
+    0x00, 0xc7, 0xfc, 0x4c, 0x19, 0xea, 0x68, 0x0b, 0x14, 0x65, 0x6b, 0x73,
+    0x88, 0x11, 0x6f, 0x3f, 0x9d, 0x01, 0x5b, 0x18, 0x5b, 0x88, 0xc3, 0x37,
+    0xee, 0x8d, 0xef, 0x61, 0x40, 0x47, 0x10, 0xf7, 0x11, 0x94, 0x5b, 0x48,
+    0xf2, 0xa0, 0x2c, 0x0e, 0x46, 0xb3, 0xac, 0x40, 0xea, 0xdd, 0x5e, 0x80,
+    0xef, 0x00, 0x41, 0x98, 0x51, 0x98, 0x7f, 0x1b, 0x44, 0xef, 0x5e, 0xaa,
+    0x77, 0xe2, 0x1c, 0xc6, 0x18, 0x99, 0x9b, 0x8e, 0x7e, 0x34, 0x03, 0xe4,
+    0x61, 0xff, 0x00, 0xd6, 0xda, 0x91, 0x19, 0x4c, 0x8b, 0x55, 0x9e, 0xf6,
+    0x1f, 0xd4, 0x88, 0x5f, 0xe2, 0x58, 0x3f, 0xfa, 0xd1, 0xff, 0x00, 0xec,
+    0xbe, 0xe2, 0x62, 0x28, 0x45, 0x39, 0xd6, 0x36, 0x13, 0xaf, 0x9d, 0x5c,
+    0xa4, 0xa5, 0xaa, 0x64, 0x8a, 0x55, 0xe9, 0x57, 0x8f, 0x15, 0x29, 0x29,
+    0x2e, 0xc7, 0x7f, 0x42, 0x36, 0x60, 0x32, 0x81, 0x04, 0xc5, 0xb5, 0x3f,
+    0x2a, 0xa9, 0x94, 0x72, 0x41, 0x52, 0xc6, 0x19, 0x41, 0xb0, 0xa0, 0x11,
+    0xa4, 0xa8, 0x0c, 0x09, 0x60, 0x48, 0xb8, 0x8d, 0x7a, 0xf7, 0xa0, 0x28,
+    0xed, 0x2c, 0x41, 0x85, 0xc0, 0xf1, 0x20, 0xb4, 0x8c, 0xa5, 0x41, 0xcb,
+    0x3e, 0x1f, 0x2b, 0xd4, 0x3c, 0xc2, 0x71, 0x86, 0x16, 0xa3, 0x97, 0x46,
+    0xbc, 0xf4, 0x44, 0x5c, 0x64, 0xd4, 0x28, 0x4d, 0xbe, 0x8f, 0xe7, 0xa1,
+    0xe4, 0xb0, 0xd3, 0x51, 0x2b, 0x36, 0xb1, 0x16, 0xeb, 0x5a, 0xe0, 0xa3,
+    0x13, 0x8e, 0xb9, 0x7b, 0xa0, 0x22, 0x48, 0xbc, 0x91, 0x7b, 0xf9, 0xfd,
+    0xea, 0x54, 0x20, 0x5d, 0x71, 0xb2, 0x87, 0x39, 0xa3, 0xbd, 0xa1, 0xe4,
+    0x3e, 0x75, 0x2a, 0x10, 0x2b, 0x73, 0x4a, 0xa8, 0xfd, 0xc9, 0x83, 0x31,
+    0x00, 0xf5, 0xd7, 0xb5, 0x4b, 0x84, 0x0a, 0xdc, 0xb4, 0x03, 0xdd, 0x55,
+    0xb4, 0x18, 0x80, 0x66, 0xfa, 0x0b, 0x54, 0xc8, 0x40, 0xad, 0xcb, 0xf0,
+    0x82, 0x9c, 0xa3, 0x35, 0xb2, 0xc9, 0x31, 0x7f, 0x6d, 0x34, 0xa9, 0x50,
+    0x81, 0x5b, 0x96, 0x61, 0x82, 0xfe, 0x3b, 0xc0, 0xfa, 0x75, 0xca, 0xa5,
+    0x42, 0x25, 0xd7, 0x2e, 0xc2, 0x3f, 0xb5, 0x8d, 0x84, 0xe8, 0x48, 0x60,
+    0x66, 0x22, 0x66, 0x3a, 0x35, 0x9f, 0xdd, 0xa9, 0x45, 0xc5, 0xf3, 0x32,
+    0xd1, 0xaa, 0xe9, 0x4e, 0x35, 0x23, 0xba, 0x69, 0xf9, 0x1e, 0x89, 0x59,
+    0x5b, 0x08, 0x3a, 0x7c, 0x0d, 0x04, 0x44, 0xef, 0x5c, 0xf4, 0xa2, 0xe2,
+    0xda, 0x7c, 0x8f, 0x4b, 0x85, 0x48, 0xd4, 0x8a, 0x9c, 0x76, 0x7a, 0x96,
+    0x12, 0x24, 0x18, 0x16, 0x07, 0xf8, 0xe9, 0x54, 0x2e, 0x15, 0xd8, 0x86,
+    0x02, 0x09, 0x22, 0x63, 0xce, 0x80, 0x4e, 0x2d, 0x3f, 0x73, 0x85, 0xc6,
+    0x54, 0x50, 0xc4, 0xa3, 0x2a, 0x8f, 0x18, 0xff, 0x00, 0x2b, 0x1d, 0x68,
+    0xb9, 0x53, 0x94, 0x56, 0xed, 0x32, 0x36, 0x32, 0x9c, 0xaa, 0xe1, 0xea,
+    0x42, 0x1b, 0xb8, 0xb4, 0xbc, 0x51, 0xe3, 0x14, 0x64, 0x24, 0x92, 0x86,
+    0xf3, 0x24, 0xc9, 0xae, 0x4c, 0xf2, 0xa1, 0x70, 0x5c, 0xc8, 0x2c, 0x14,
+    0x9d, 0x00, 0xe4, 0x67, 0x95, 0x00, 0xc9, 0x69, 0x02, 0x75, 0x81, 0x9e,
+    0xf7, 0xd2, 0x68, 0x01, 0x95, 0x94, 0x96, 0x23, 0xbd, 0x31, 0x1b, 0x1f,
+    0x7d, 0x28, 0x06, 0x64, 0x28, 0xb7, 0x9b, 0xce, 0x68, 0xeb, 0xd6, 0x80,
+    0x18, 0x51, 0x62, 0xab, 0xdd, 0x1c, 0x84, 0xc8, 0xdc, 0xe9, 0xe5, 0x40,
+    0x0f, 0x8e, 0x24, 0x03, 0x98, 0x4e, 0x93, 0x14, 0x01, 0x86, 0x04, 0x30,
+    0x22, 0x0b, 0x49, 0xbd, 0x81, 0x8a, 0x00, 0x3a, 0x31, 0x49, 0x22, 0x09,
+    0x3b, 0x1b, 0xc0, 0xda, 0x68, 0x06, 0xcd, 0x96, 0xd9, 0x45, 0x84, 0xc8,
+    0xdc, 0xfe, 0x7e, 0xf4, 0x07, 0xa0, 0x0a, 0x49, 0xc8, 0xa8, 0x64, 0xe9,
+    0x33, 0x7f, 0x95, 0x7a, 0xa4, 0xa4, 0xa2, 0xae, 0xce, 0xea, 0xb5, 0x6a,
+    0x74, 0x29, 0xba, 0xb5, 0x5d, 0xa2, 0xb7, 0x67, 0x43, 0x0b, 0x0b, 0xf6,
+    0x30, 0xc0, 0x00, 0xc9, 0xb1, 0x2d, 0x6b, 0x7d, 0xad, 0x5a, 0x9a, 0xb5,
+    0xa5, 0x51, 0xeb, 0xb1, 0xe5, 0xd9, 0x96, 0x6d, 0x5f, 0x30, 0x97, 0xf9,
+    0x8e, 0xd1, 0x4f, 0x45, 0xc9, 0x7d, 0xdf, 0x6b, 0xed, 0xb5, 0xb6, 0x2e,
+    0x71, 0x67, 0x10, 0x79, 0x93, 0xb9, 0x1c, 0xfc, 0xab, 0x11, 0xac, 0x10,
+    0xe1, 0xae, 0x2a, 0x95, 0x6b, 0xc0, 0xb3, 0x75, 0xd7, 0xb5, 0x5d, 0x19,
+    0x38, 0xbb, 0xc5, 0x99, 0xb0, 0xf8, 0x9a, 0xb8, 0x69, 0xfb, 0xca, 0x32,
+    0x71, 0x7d, 0x9f, 0x9a, 0xae, 0xc7, 0xa1, 0xcf, 0xc6, 0xc0, 0x18, 0x78,
+    0xb0, 0x49, 0x65, 0x2d, 0x22, 0xda, 0x91, 0x5b, 0x4a, 0x35, 0x95, 0x55,
+    0xda, 0x7a, 0x66, 0x4f, 0x9a, 0xc7, 0x32, 0xa4, 0xdd, 0xad, 0x38, 0xee,
+    0xb9, 0x77, 0xae, 0xc7, 0xe6, 0xbe, 0x6d, 0x0b, 0x82, 0x16, 0x55, 0x6e,
+    0x6e, 0x44, 0xfc, 0xe6, 0xb3, 0x1b, 0x71, 0x44, 0x10, 0x5a, 0x57, 0x40,
+    0x48, 0x93, 0xad, 0xbf, 0xaa, 0x03, 0x9d, 0xdb, 0xd8, 0xad, 0x87, 0xc2,
+    0x2a, 0xa8, 0x32, 0xc4, 0xc9, 0x3c, 0x80, 0x9d, 0xfc, 0x6b, 0x49, 0x9e,
+    0xd6, 0x71, 0xa2, 0xa9, 0x2f, 0xe6, 0x7f, 0x25, 0xfa, 0xd8, 0xd3, 0x67,
+    0x55, 0xb8, 0x29, 0x2a, 0x6b, 0xf9, 0x9f, 0xc9, 0x7e, 0xb6, 0x38, 0x41,
+    0x4e, 0x52, 0xc0, 0x39, 0x32, 0x48, 0x31, 0x17, 0xe5, 0x15, 0xcd, 0x42,
+    0x07, 0x35, 0x72, 0xec, 0x10, 0x33, 0x13, 0x94, 0x0c, 0xbe, 0xa4, 0xdb,
+    0x6f, 0x2a, 0x97, 0x08, 0x15, 0xb9, 0x7f, 0xed, 0xb1, 0x19, 0x8c, 0x90,
+    0x3d, 0x39, 0x54, 0xb8, 0x40, 0xad, 0xc6, 0xc1, 0x4c, 0xcd, 0x10, 0xb2,
+    0x39, 0x47, 0x3f, 0x6a, 0x97, 0x08, 0x15, 0xb9, 0x68, 0x03, 0x26, 0x5b,
+    0x13, 0xe0, 0x47, 0xca, 0xa5, 0xc2, 0x05, 0x6e, 0x5c, 0xb8, 0x7a, 0x0d,
+    0x89, 0x8d, 0x00, 0x8d, 0x26, 0x7d, 0x2a, 0x4c, 0x22, 0x5d, 0x72, 0xfc,
+    0xa5, 0x54, 0x0c, 0xc3, 0x7b, 0xc6, 0x95, 0x26, 0x31, 0x2b, 0x72, 0xcc,
+    0x35, 0x86, 0x96, 0x07, 0x61, 0x3c, 0xeb, 0x32, 0x45, 0xc9, 0x9d, 0x5e,
+    0xcf, 0x72, 0x70, 0x57, 0x09, 0x9a, 0x4a, 0xc4, 0x5f, 0x51, 0xb7, 0xa7,
+    0xe2, 0xb4, 0xd9, 0x85, 0x1e, 0x0a, 0x9c, 0x69, 0x68, 0xfd, 0x4e, 0xdf,
+    0x20, 0xc6, 0x2a, 0xb4, 0x3d, 0xd4, 0x9f, 0xc5, 0x1f, 0x3b, 0x7e, 0x69,
+    0xd8, 0xac, 0x6b, 0xb3, 0x29, 0x46, 0xe7, 0xa0, 0xdb, 0xc6, 0xb5, 0xe6,
+    0xf4, 0x8c, 0xc0, 0x30, 0x95, 0x8b, 0x7f, 0xc7, 0x51, 0xbd, 0x01, 0x0a,
+    0x95, 0xcd, 0xe2, 0xb3, 0xeb, 0x6e, 0x74, 0x07, 0x90, 0xe3, 0xf0, 0xbf,
+    0xe9, 0x78, 0xcc, 0x4c, 0x30, 0x83, 0x20, 0x6d, 0x14, 0x4c, 0x4f, 0xe2,
+    0x2b, 0x96, 0xc4, 0xd3, 0xf7, 0x55, 0x65, 0x04, 0x79, 0x7e, 0x63, 0x86,
+    0x58, 0x5c, 0x54, 0xe9, 0x2d, 0x93, 0xd3, 0xb9, 0xea, 0xbe, 0x4c, 0xa3,
+    0x2c, 0x0b, 0x18, 0x8d, 0x41, 0x1a, 0xe9, 0xeb, 0x3e, 0x35, 0x80, 0x82,
+    0x36, 0x62, 0x6e, 0xc4, 0x88, 0xb8, 0x31, 0x6f, 0x3f, 0xad, 0x01, 0x58,
+    0x93, 0x10, 0x6f, 0x3b, 0xf9, 0xd8, 0xd0, 0x04, 0xb3, 0x28, 0x0c, 0xb6,
+    0x33, 0x01, 0x62, 0x68, 0x02, 0x73, 0x66, 0x82, 0x19, 0x74, 0x89, 0xd4,
+    0x7a, 0xfc, 0xe8, 0x01, 0x82, 0x58, 0x8e, 0xf5, 0xd6, 0x33, 0x13, 0xce,
+    0x80, 0x2c, 0x7f, 0xec, 0x11, 0x11, 0x68, 0x89, 0xbf, 0x85, 0x00, 0x64,
+    0x7f, 0xed, 0x3e, 0xa7, 0xa3, 0x40, 0x09, 0x04, 0x4e, 0x63, 0x33, 0xac,
+    0xcc, 0x8a, 0x03, 0xd5, 0xf0, 0x04, 0x7e, 0xed, 0x98, 0x34, 0x41, 0x1f,
+    0x3f, 0xad, 0x7a, 0x4e, 0x32, 0x56, 0x8a, 0x8f, 0x53, 0x65, 0xed, 0x66,
+    0x22, 0x50, 0xa1, 0x0a, 0x2b, 0xf9, 0x9b, 0x6f, 0xc3, 0x97, 0x6e, 0xf7,
+    0xf0, 0x34, 0x18, 0xf8, 0x02, 0x06, 0x2d, 0x6d, 0x2b, 0x5e, 0x70, 0x65,
+    0x80, 0x93, 0xb6, 0x62, 0xc2, 0xc6, 0x2d, 0xd6, 0xb4, 0x00, 0x2a, 0x10,
+    0x28, 0x21, 0x80, 0x1e, 0x32, 0x35, 0xe5, 0x40, 0x51, 0xc4, 0x05, 0x6c,
+    0x02, 0x59, 0x84, 0xac, 0x30, 0x07, 0xd2, 0x6d, 0x52, 0x30, 0xad, 0xaa,
+    0x88, 0xde, 0xfb, 0x37, 0x52, 0x50, 0xcc, 0x21, 0x18, 0xbd, 0x24, 0x9a,
+    0x7d, 0xd6, 0xbf, 0xaa, 0x47, 0x3d, 0x84, 0x29, 0x24, 0x77, 0x48, 0x96,
+    0x3b, 0xf8, 0x7d, 0x2b, 0x68, 0x7a, 0x60, 0x20, 0x9c, 0x3b, 0x4a, 0x8b,
+    0x19, 0xbf, 0x9f, 0xdf, 0xfd, 0xdc, 0x0f, 0x37, 0xc5, 0xe3, 0x2f, 0x13,
+    0xc5, 0x9c, 0x55, 0x90, 0xab, 0xdd, 0x52, 0x4c, 0xc2, 0x8b, 0x7e, 0x7d,
+    0x7c, 0x2b, 0x8c, 0xc6, 0xd7, 0xfd, 0xaa, 0xbb, 0x9a, 0xdb, 0x65, 0xdd,
+    0xf9, 0xa9, 0xc4, 0x63, 0xf1, 0x5f, 0xb4, 0xd7, 0x73, 0x5b, 0x6c, 0xbb,
+    0xbf, 0x5d, 0xc4, 0x54, 0x1d, 0xd2, 0x3e, 0x29, 0x88, 0xb0, 0x93, 0x56,
+    0x42, 0x04, 0x4b, 0x97, 0x29, 0x19, 0x54, 0xca, 0xa8, 0xde, 0xde, 0xd5,
+    0x2e, 0x10, 0x2b, 0x72, 0xd5, 0x4e, 0xe4, 0x20, 0x53, 0x26, 0xf0, 0x7c,
+    0xaa, 0x64, 0x20, 0x56, 0xe6, 0x8c, 0x04, 0x0c, 0xbd, 0xd3, 0xaf, 0xac,
+    0x72, 0x37, 0xf5, 0xa9, 0x50, 0x81, 0x5b, 0x8c, 0x99, 0x54, 0x16, 0x59,
+    0x16, 0xb0, 0x1f, 0x31, 0x6e, 0xb4, 0xa9, 0x50, 0x89, 0x75, 0xcb, 0x12,
+    0xe4, 0x03, 0x04, 0x13, 0xfc, 0x8d, 0xe6, 0x2a, 0x44, 0x62, 0x55, 0x32,
+    0xe0, 0x14, 0xa8, 0x50, 0xa2, 0x01, 0x22, 0x4e, 0xbd, 0x6d, 0xeb, 0x59,
+    0xd2, 0x2e, 0x4c, 0x7c, 0x20, 0x8a, 0x25, 0x82, 0x86, 0x98, 0x23, 0x9f,
+    0x88, 0xe5, 0x59, 0x12, 0x2e, 0x4c, 0xb7, 0x0f, 0x14, 0xe1, 0x30, 0x79,
+    0x04, 0x80, 0x2c, 0x49, 0xbf, 0xcb, 0xca, 0xb1, 0x57, 0xa2, 0xab, 0x41,
+    0xc1, 0x93, 0x70, 0x38, 0xb9, 0x61, 0x2b, 0x2a, 0xb1, 0xf2, 0xea, 0xbf,
+    0x3e, 0x67, 0x5d, 0x71, 0x46, 0x2a, 0x06, 0x06, 0x43, 0x2e, 0xfc, 0xb9,
+    0x57, 0x37, 0x56, 0x9c, 0xa9, 0x49, 0xc2, 0x5b, 0xa3, 0xd1, 0x30, 0xd5,
+    0xe1, 0x89, 0xa4, 0xaa, 0xd3, 0xd9, 0x85, 0x98, 0x1c, 0x30, 0x31, 0x3e,
+    0x12, 0x23, 0x31, 0xb9, 0x1b, 0xd6, 0x33, 0x30, 0x64, 0xf7, 0x72, 0xc4,
+    0x44, 0xeb, 0xe5, 0xf4, 0xa0, 0x38, 0xfd, 0xbd, 0x84, 0x98, 0xe1, 0x71,
+    0xf0, 0xb1, 0x54, 0xe3, 0x61, 0x77, 0x4a, 0xa9, 0x99, 0x07, 0xfa, 0xbe,
+    0xb5, 0xae, 0xc7, 0xe0, 0xe5, 0x5e, 0xd3, 0x86, 0xe8, 0xe7, 0x33, 0xec,
+    0xae, 0x58, 0xbe, 0x1a, 0xb4, 0x7f, 0x79, 0x69, 0x6e, 0xab, 0xd3, 0x4d,
+    0x7b, 0xfa, 0xec, 0x71, 0xd7, 0x86, 0xc4, 0x0a, 0xc4, 0x85, 0x51, 0x63,
+    0x33, 0xad, 0x43, 0x59, 0x55, 0x66, 0xaf, 0x75, 0xf9, 0xe0, 0x68, 0xe3,
+    0xec, 0xe6, 0x29, 0xa4, 0xdb, 0x8a, 0xf1, 0x7f, 0x60, 0x7f, 0xd3, 0x3a,
+    0x82, 0x09, 0x06, 0xd2, 0x4e, 0xc3, 0xd3, 0xd7, 0xde, 0x9f, 0xe1, 0x55,
+    0xba, 0xaf, 0x9f, 0xd8, 0xbb, 0xff, 0x00, 0x2d, 0xe2, 0xbf, 0xaa, 0x3e,
+    0x6f, 0xec, 0x06, 0xe1, 0x71, 0x0c, 0x08, 0x59, 0xdf, 0x2d, 0x87, 0xda,
+    0xac, 0x9e, 0x59, 0x5e, 0x3b, 0x59, 0xf7, 0x3f, 0xbd, 0x8c, 0x35, 0x7d,
+    0x9f, 0xc6, 0x42, 0xdc, 0x29, 0x4b, 0xb9, 0xfd, 0xec, 0x28, 0x43, 0x2c,
+    0x0a, 0x3f, 0x99, 0x1b, 0xcf, 0xe2, 0xa2, 0x54, 0xa3, 0x52, 0x9f, 0xef,
+    0xc5, 0xa3, 0x59, 0x5b, 0x09, 0x5e, 0x87, 0xf1, 0x60, 0xd7, 0x2d, 0xb4,
+    0xf3, 0xd8, 0xa8, 0xff, 0x00, 0xdb, 0xca, 0x57, 0xe1, 0x3a, 0x88, 0xde,
+    0xb1, 0x11, 0xc6, 0x2a, 0x54, 0x66, 0x01, 0xb3, 0x47, 0x2f, 0xcf, 0xae,
+    0xb4, 0x04, 0x37, 0x72, 0x54, 0x49, 0x88, 0xe7, 0x6e, 0xb6, 0xa0, 0x26,
+    0x61, 0x21, 0x98, 0x99, 0x31, 0x3f, 0xd7, 0x85, 0x01, 0x6f, 0x0b, 0x82,
+    0x78, 0x8c, 0x60, 0x98, 0x6c, 0x42, 0x8e, 0xf1, 0x93, 0x7f, 0x29, 0xf1,
+    0xfb, 0x56, 0x1c, 0x45, 0x5f, 0x75, 0x1b, 0xf3, 0x27, 0xe5, 0xd8, 0x4f,
+    0xda, 0xaa, 0xd9, 0xfe, 0xea, 0xd5, 0xfd, 0xbc, 0x4f, 0x47, 0xc0, 0x95,
+    0x18, 0x85, 0x0f, 0xc6, 0xc7, 0x7b, 0x49, 0xf2, 0xaf, 0x4f, 0xc6, 0x46,
+    0xf1, 0x52, 0xe8, 0x5f, 0xed, 0x66, 0x1e, 0x53, 0xa1, 0x0a, 0xcb, 0xf9,
+    0x5b, 0x4f, 0xc7, 0x9f, 0x66, 0xd6, 0xf1, 0x35, 0x81, 0x39, 0xaf, 0x61,
+    0xa4, 0xa8, 0xf4, 0xad, 0x79, 0xc1, 0x8f, 0x05, 0x54, 0x29, 0x52, 0x5c,
+    0xde, 0xca, 0x28, 0x05, 0x52, 0x33, 0x12, 0xaa, 0x63, 0x60, 0x05, 0xff,
+    0x00, 0xdf, 0xee, 0x80, 0xaf, 0x8c, 0x53, 0xfb, 0x67, 0x28, 0x99, 0x3a,
+    0x1d, 0x36, 0x35, 0x9f, 0x0d, 0xa4, 0xf8, 0x9f, 0x23, 0x75, 0xec, 0xff,
+    0x00, 0x0c, 0x31, 0x8a, 0xb4, 0xda, 0x51, 0x82, 0x6d, 0xdf, 0xa5, 0xad,
+    0xe7, 0x76, 0x8c, 0xe9, 0x84, 0x3b, 0x99, 0x88, 0x60, 0x24, 0xc2, 0x9b,
+    0x6b, 0x3f, 0x6a, 0x93, 0x53, 0x12, 0xf6, 0x81, 0xba, 0xc7, 0xfb, 0x4b,
+    0x39, 0x37, 0x0c, 0x22, 0xb2, 0xfe, 0xa7, 0xbb, 0xee, 0x5c, 0xbc, 0x6f,
+    0xa7, 0x46, 0x5c, 0x42, 0x21, 0x9f, 0xe5, 0xc8, 0x90, 0x6d, 0xd7, 0x9d,
+    0x47, 0x94, 0xe5, 0x2d, 0xd9, 0xce, 0xd7, 0xc6, 0x57, 0xc4, 0x7f, 0x16,
+    0x6d, 0xeb, 0x7d, 0x5e, 0x9e, 0x5b, 0x20, 0x00, 0x24, 0xc1, 0x3a, 0xee,
+    0x0e, 0x95, 0x61, 0x18, 0xcf, 0xc5, 0x70, 0x3c, 0x26, 0x2a, 0xc3, 0xe1,
+    0x2e, 0x19, 0x03, 0x55, 0x80, 0x0f, 0x5e, 0x3f, 0x7a, 0xc6, 0xe8, 0xc1,
+    0xf2, 0x33, 0x46, 0xbd, 0x48, 0xf3, 0x39, 0x9c, 0x47, 0x66, 0x1c, 0x19,
+    0x7c, 0x27, 0x52, 0x8b, 0x70, 0x1c, 0xdd, 0x6f, 0xef, 0x1c, 0xff, 0x00,
+    0xaa, 0xb5, 0x52, 0xb6, 0xc4, 0xca, 0x58, 0xa5, 0x37, 0x67, 0xa3, 0x33,
+    0xa0, 0x2c, 0xf2, 0x1a, 0xe2, 0xf3, 0xe1, 0x1b, 0x1a, 0x91, 0x08, 0x12,
+    0xae, 0x5c, 0x06, 0x75, 0x2c, 0x00, 0x00, 0xb1, 0x24, 0x93, 0xb7, 0x97,
+    0x95, 0x4a, 0x84, 0x4b, 0xae, 0x32, 0x61, 0x16, 0x20, 0x28, 0x11, 0xae,
+    0xf0, 0x2d, 0x52, 0x23, 0x12, 0xb7, 0x1d, 0x41, 0xca, 0x25, 0x55, 0x5b,
+    0x43, 0x22, 0xb3, 0x24, 0x5c, 0x99, 0xa1, 0x55, 0x55, 0x80, 0x01, 0x60,
+    0x58, 0x12, 0x3c, 0x74, 0xac, 0x89, 0x17, 0x26, 0x45, 0xc3, 0xca, 0xeb,
+    0x37, 0x36, 0x9b, 0xcf, 0xa7, 0xb1, 0xab, 0x8b, 0xd3, 0x0a, 0xb6, 0x49,
+    0x51, 0xa8, 0x26, 0x67, 0x51, 0xcc, 0xf9, 0x55, 0xad, 0x97, 0xa6, 0x68,
+    0xc2, 0xc6, 0x6c, 0x1c, 0x5d, 0x33, 0x21, 0x90, 0x56, 0x76, 0xd8, 0x8e,
+    0xb6, 0xa8, 0x78, 0x9c, 0x3c, 0x6b, 0xad, 0x74, 0x7d, 0x4d, 0xae, 0x5d,
+    0x99, 0xd4, 0xc1, 0x49, 0xdb, 0x58, 0xbe, 0x5f, 0x5f, 0xcd, 0xfc, 0xad,
+    0x66, 0x3f, 0x1e, 0x8b, 0x64, 0x2f, 0x88, 0xda, 0x00, 0x44, 0x41, 0xf1,
+    0xf9, 0xd6, 0x8a, 0x50, 0x70, 0x93, 0x8b, 0xe4, 0x77, 0x54, 0xb1, 0x11,
+    0xad, 0x4d, 0x54, 0x8e, 0xcf, 0xa9, 0xcf, 0xc5, 0xe2, 0x71, 0x5a, 0x57,
+    0x11, 0xf3, 0x60, 0xc6, 0x8a, 0x23, 0x5a, 0x58, 0xab, 0x93, 0x65, 0x4e,
+    0xb9, 0x6c, 0xa6, 0x45, 0xc1, 0xb5, 0xc8, 0xf1, 0xe7, 0x42, 0x80, 0x6d,
+    0x32, 0xd8, 0x91, 0x13, 0xc8, 0x0d, 0xad, 0x40, 0x10, 0x59, 0x4b, 0x00,
+    0xd7, 0x17, 0x2a, 0x4f, 0xd0, 0xd0, 0x04, 0xda, 0x4d, 0xa0, 0x08, 0x00,
+    0x8b, 0xdb, 0xc6, 0x80, 0x46, 0x04, 0xb9, 0x11, 0x9a, 0x07, 0x9e, 0xdf,
+    0x5d, 0x68, 0x0a, 0x8f, 0x0e, 0x8c, 0x1a, 0x3b, 0xbb, 0xce, 0xc7, 0x9c,
+    0x8e, 0x51, 0xf5, 0xad, 0x7d, 0x7c, 0xba, 0x95, 0x5d, 0x63, 0xf0, 0xbe,
+    0xcd, 0xbc, 0x8d, 0x26, 0x33, 0x22, 0xc3, 0xe2, 0x3e, 0x2a, 0x7f, 0x03,
+    0xec, 0xdb, 0xcb, 0xed, 0x6e, 0xdb, 0x98, 0xdb, 0x0b, 0x11, 0x10, 0xcc,
+    0x40, 0x3c, 0xfd, 0xbc, 0x2b, 0x49, 0x5f, 0x0b, 0x52, 0x83, 0xb4, 0xd6,
+    0x9d, 0x79, 0x1c, 0x8e, 0x33, 0x2f, 0xaf, 0x83, 0x95, 0xaa, 0xad, 0x3a,
+    0xad, 0xbc, 0xfe, 0x82, 0x82, 0xb9, 0xa7, 0x4f, 0x0c, 0xbb, 0x69, 0xd7,
+    0xa5, 0x47, 0x20, 0x96, 0x60, 0xa6, 0x26, 0x29, 0x38, 0x49, 0x32, 0x22,
+    0x49, 0x3a, 0x7a, 0xd6, 0x3a, 0x95, 0x63, 0x49, 0x5e, 0x44, 0x8c, 0x3e,
+    0x16, 0xa6, 0x26, 0x5c, 0x34, 0xd7, 0xe8, 0x75, 0x78, 0x4c, 0x0f, 0xd9,
+    0x45, 0x50, 0x26, 0xe4, 0xff, 0x00, 0x76, 0xad, 0x35, 0x6a, 0xae, 0xa4,
+    0xb8, 0x99, 0xd9, 0x61, 0x30, 0xf1, 0xc3, 0x53, 0x54, 0xe3, 0xfd, 0xcd,
+    0x01, 0xd8, 0x12, 0x56, 0xf9, 0x49, 0x2a, 0x7f, 0x15, 0xee, 0x32, 0x8a,
+    0x92, 0xb3, 0x15, 0xa8, 0xd3, 0xaf, 0x4d, 0xd2, 0xaa, 0xaf, 0x17, 0xba,
+    0x37, 0xe0, 0xf1, 0x0b, 0x88, 0xb9, 0x5a, 0x03, 0xef, 0x63, 0xae, 0xfe,
+    0x63, 0x4a, 0xd5, 0xd6, 0xa0, 0xe9, 0xbd, 0x36, 0x3c, 0xd7, 0x36, 0xc9,
+    0x6a, 0xe0, 0x26, 0xe5, 0x14, 0xe5, 0x4f, 0x93, 0xe9, 0xd8, 0xfa, 0x3f,
+    0x93, 0xe5, 0xd1, 0x5e, 0x06, 0x69, 0x20, 0x4b, 0x72, 0xe7, 0x16, 0xac,
+    0x06, 0x94, 0x4c, 0x46, 0x18, 0x51, 0x24, 0x13, 0x32, 0x41, 0x06, 0xff,
+    0x00, 0x8d, 0x2a, 0xe8, 0xc2, 0x53, 0xd9, 0x12, 0x30, 0xf8, 0x4a, 0xd8,
+    0x96, 0xd5, 0x28, 0xde, 0xdb, 0xbe, 0x4b, 0xbd, 0xbd, 0x16, 0xdc, 0xd9,
+    0x4e, 0x29, 0xcc, 0xe0, 0xfb, 0xed, 0xee, 0x6a, 0xf5, 0xa2, 0xb1, 0x92,
+    0xee, 0x11, 0x74, 0x93, 0xba, 0xbd, 0xf4, 0xe7, 0xdb, 0xc9, 0xf7, 0x5f,
+    0x6b, 0xbd, 0xae, 0xc0, 0xc6, 0x49, 0x20, 0x80, 0x04, 0x4c, 0x69, 0xa5,
+    0x0b, 0x06, 0xc8, 0xb9, 0x97, 0x28, 0x01, 0xb5, 0x10, 0x20, 0x79, 0x75,
+    0xce, 0x80, 0x0c, 0xc4, 0xba, 0x85, 0xcc, 0x24, 0x69, 0x1e, 0x93, 0x40,
+    0x22, 0xbe, 0xc4, 0xcc, 0x8e, 0x46, 0xd7, 0xa0, 0x1a, 0x4b, 0x77, 0x54,
+    0x45, 0x80, 0x3b, 0x08, 0xeb, 0xef, 0x40, 0x73, 0x78, 0xce, 0x19, 0x70,
+    0xc8, 0xc5, 0xc2, 0xba, 0x93, 0x05, 0x4a, 0xe8, 0x79, 0xf9, 0x4c, 0x56,
+    0x7a, 0x4e, 0xee, 0xc4, 0xfc, 0x3d, 0x77, 0x2f, 0x86, 0x5b, 0x94, 0x85,
+    0x01, 0xc9, 0xc4, 0x22, 0x24, 0x6d, 0xb7, 0x46, 0xa6, 0x46, 0x24, 0xbb,
+    0x8e, 0x82, 0x09, 0x26, 0x4c, 0x9e, 0x44, 0x46, 0xd1, 0x59, 0xd2, 0x2e,
+    0x4c, 0x7c, 0x30, 0xf2, 0xf0, 0xb2, 0x41, 0x98, 0xde, 0x6d, 0xed, 0x59,
+    0x12, 0x2e, 0x4c, 0x3a, 0x77, 0x60, 0xc9, 0x11, 0x71, 0xe5, 0x55, 0x2f,
+    0x4c, 0x77, 0xc3, 0xbf, 0x79, 0x00, 0xcd, 0x60, 0x79, 0x9e, 0x75, 0x46,
+    0xcb, 0xd3, 0x0d, 0xca, 0x9c, 0x86, 0x34, 0xb7, 0x2b, 0x6f, 0x58, 0xdc,
+    0x8c, 0x88, 0xab, 0x1b, 0x1a, 0xcc, 0x2d, 0x94, 0x72, 0x37, 0x2d, 0x17,
+    0xad, 0x4e, 0x27, 0x14, 0xdb, 0xe1, 0x83, 0xf1, 0x3a, 0xdc, 0xab, 0x28,
+    0x51, 0x5e, 0xf7, 0x10, 0xb5, 0x7b, 0x27, 0xcb, 0xbf, 0xb7, 0xb3, 0x97,
+    0x7e, 0xd4, 0x33, 0x06, 0x51, 0x9d, 0x46, 0xbb, 0x5c, 0x08, 0xa8, 0x07,
+    0x46, 0x1d, 0x9b, 0x42, 0xd1, 0xa8, 0xd0, 0x7a, 0xc6, 0x94, 0x04, 0x26,
+    0x58, 0x95, 0xcc, 0x66, 0x4d, 0xf6, 0xea, 0x3d, 0xe8, 0x05, 0x4f, 0x88,
+    0x16, 0x56, 0xd2, 0x27, 0xaf, 0x3a, 0x01, 0xb0, 0xc0, 0xb1, 0xb2, 0xda,
+    0x04, 0x91, 0x73, 0xe3, 0x40, 0x48, 0x86, 0x04, 0xc8, 0xff, 0x00, 0xda,
+    0x34, 0x34, 0x00, 0xc3, 0x06, 0xd9, 0xc4, 0x0f, 0x86, 0xd6, 0x27, 0xaf,
+    0x4a, 0x00, 0x03, 0x2a, 0x72, 0xc9, 0x24, 0x09, 0x04, 0x1b, 0x7b, 0xd0,
+    0x00, 0xa8, 0xfd, 0x82, 0x8d, 0x0c, 0x37, 0xdc, 0x46, 0xdf, 0x6a, 0xb6,
+    0x70, 0x8d, 0x48, 0xb8, 0xc9, 0x5d, 0x33, 0x1d, 0x5a, 0x50, 0xad, 0x07,
+    0x4e, 0xa2, 0xba, 0x62, 0xe1, 0x70, 0xa8, 0xee, 0x5c, 0xb9, 0xcb, 0x30,
+    0x23, 0x5f, 0x9d, 0x73, 0x19, 0xae, 0x1e, 0x78, 0x45, 0xef, 0x29, 0x2b,
+    0xc7, 0xd3, 0xf4, 0xed, 0xfc, 0x7c, 0xb6, 0x23, 0xd9, 0xf8, 0xc2, 0xa3,
+    0x9c, 0x5f, 0xc1, 0xd3, 0x9a, 0xf1, 0xe9, 0xd3, 0xcb, 0xb5, 0xeb, 0xc3,
+    0x0a, 0xb8, 0x79, 0x54, 0x35, 0xae, 0x63, 0xd7, 0x7a, 0xe5, 0xaa, 0x54,
+    0x94, 0xdd, 0xe4, 0xc9, 0xd4, 0x68, 0xc2, 0x8c, 0x78, 0x29, 0xab, 0x22,
+    0xd0, 0x41, 0x1d, 0xf9, 0x22, 0xd7, 0x2d, 0xe5, 0xf9, 0xac, 0x44, 0x84,
+    0xc4, 0x13, 0x96, 0x50, 0x7c, 0x36, 0x17, 0xd4, 0xf2, 0x8a, 0xf7, 0x92,
+    0x83, 0x92, 0xc5, 0xed, 0xa1, 0xd4, 0x01, 0xd7, 0x3f, 0x7a, 0x01, 0x8e,
+    0x2b, 0x82, 0x25, 0xf1, 0x10, 0xe5, 0x80, 0x41, 0x82, 0x79, 0x5a, 0xac,
+    0x74, 0xe0, 0xf5, 0x69, 0x10, 0xe5, 0x97, 0xe1, 0x27, 0x27, 0x29, 0x52,
+    0x8b, 0x6f, 0xfe, 0xd5, 0xf6, 0x1b, 0x00, 0x90, 0xfa, 0xb1, 0x53, 0xa8,
+    0x68, 0xdf, 0xaf, 0x6a, 0xc5, 0x88, 0x97, 0x0c, 0x38, 0x51, 0xa8, 0xf6,
+    0x87, 0x12, 0xb0, 0xd8, 0x45, 0x42, 0x9e, 0x9c, 0x5a, 0x59, 0x7f, 0x4a,
+    0xde, 0xd6, 0xf0, 0x56, 0xe8, 0xcd, 0x47, 0x0e, 0x54, 0xae, 0x75, 0x88,
+    0x99, 0x3b, 0x54, 0x03, 0x82, 0x19, 0x84, 0x65, 0x20, 0x00, 0xbc, 0xcf,
+    0x96, 0xdd, 0x7d, 0xe8, 0x0a, 0xd6, 0x19, 0x96, 0x1a, 0xda, 0x6e, 0x27,
+    0xab, 0x50, 0x04, 0x82, 0xa6, 0x42, 0xdc, 0xdb, 0xfb, 0xda, 0x80, 0x97,
+    0xcc, 0x02, 0xb3, 0x12, 0x00, 0x9e, 0x60, 0x50, 0x01, 0xe7, 0x34, 0x77,
+    0xcf, 0x81, 0xbf, 0xfb, 0xb5, 0x00, 0xd9, 0x65, 0x00, 0xcb, 0x2a, 0x4d,
+    0xd6, 0x0c, 0x55, 0x53, 0xb3, 0xba, 0x2a, 0x9d, 0x9d, 0xd1, 0xcd, 0xfd,
+    0x9f, 0xdb, 0x76, 0x07, 0x2c, 0x09, 0x1a, 0x08, 0x37, 0xad, 0xb5, 0x37,
+    0xc5, 0x14, 0xcd, 0xac, 0x27, 0xc4, 0x93, 0x18, 0x08, 0x50, 0x4a, 0x96,
+    0x20, 0x9f, 0x0e, 0x7d, 0x78, 0x56, 0x64, 0x8b, 0xd3, 0x08, 0x10, 0x17,
+    0x58, 0xcd, 0xf2, 0xf9, 0x55, 0xc5, 0xe9, 0x8e, 0x43, 0x21, 0x5c, 0xd1,
+    0x00, 0xeb, 0xf7, 0xab, 0x5b, 0x2f, 0x41, 0x46, 0x0c, 0x60, 0x81, 0x13,
+    0x13, 0x13, 0x37, 0x3d, 0x7c, 0xea, 0xc7, 0x23, 0x22, 0x28, 0xe2, 0x9c,
+    0x84, 0x2a, 0xb0, 0x77, 0x22, 0x3f, 0x3e, 0x55, 0xab, 0xc6, 0x57, 0x7f,
+    0xc3, 0x8f, 0x89, 0xd5, 0x64, 0x39, 0x72, 0x92, 0xfd, 0xaa, 0xaa, 0xff,
+    0x00, 0x6f, 0xd5, 0xfd, 0xbf, 0xb3, 0x28, 0x08, 0xbf, 0xc0, 0x9c, 0xac,
+    0x22, 0x47, 0xce, 0x3e, 0xb5, 0xae, 0x3a, 0xb0, 0x82, 0x14, 0x00, 0xff,
+    0x00, 0x14, 0xc4, 0x6b, 0x40, 0x20, 0x39, 0x9b, 0x39, 0x32, 0x6d, 0x26,
+    0x3e, 0xde, 0xa2, 0x80, 0x38, 0x6c, 0x09, 0x10, 0x22, 0x4d, 0xa2, 0x47,
+    0x5a, 0xd0, 0x05, 0x44, 0xa4, 0x02, 0x25, 0xa7, 0xce, 0x3c, 0x28, 0x08,
+    0x41, 0x54, 0x60, 0x41, 0x81, 0x7f, 0x11, 0x3d, 0x7d, 0x68, 0x03, 0x62,
+    0xc0, 0x28, 0x3b, 0xf7, 0x7e, 0x57, 0xf3, 0xd0, 0xd0, 0x08, 0x49, 0x2a,
+    0x0e, 0x1c, 0xc0, 0x36, 0xbd, 0xfc, 0xa8, 0x02, 0xc2, 0xe0, 0x00, 0xba,
+    0xc5, 0x86, 0xd3, 0xcb, 0xe7, 0x40, 0x46, 0x2d, 0x3c, 0xc7, 0x35, 0x36,
+    0x07, 0x9d, 0x00, 0x62, 0x08, 0x64, 0x37, 0x1a, 0x81, 0xfc, 0x79, 0x55,
+    0x25, 0x15, 0x24, 0xe3, 0x25, 0x74, 0xca, 0x35, 0x7d, 0x19, 0xa7, 0x01,
+    0x93, 0x10, 0x92, 0x64, 0xae, 0x85, 0x57, 0x9f, 0x53, 0x5e, 0x75, 0x9a,
+    0x65, 0xef, 0x03, 0x5b, 0x82, 0xf7, 0x8b, 0xd5, 0x3f, 0xa7, 0x7a, 0xfb,
+    0x3e, 0x66, 0xaa, 0xb5, 0x2f, 0x75, 0x2b, 0x72, 0x1f, 0x01, 0x4b, 0x95,
+    0xd6, 0x46, 0xb2, 0x6b, 0x5c, 0x58, 0x98, 0x51, 0x26, 0x40, 0x95, 0x69,
+    0x91, 0x3d, 0x72, 0xfb, 0x57, 0xad, 0x43, 0x37, 0xa8, 0x9f, 0xc7, 0x14,
+    0xfe, 0x5f, 0x73, 0xc9, 0x30, 0xff, 0x00, 0xf8, 0x89, 0x8b, 0x8c, 0xaf,
+    0x88, 0xa3, 0x19, 0x2f, 0xfb, 0x6f, 0x17, 0x7e, 0xf6, 0xe5, 0xe5, 0x6f,
+    0x11, 0x84, 0x68, 0x24, 0x24, 0x48, 0x02, 0xd3, 0x7f, 0x2f, 0x0a, 0xb7,
+    0xfc, 0x5a, 0xb7, 0x45, 0xf3, 0xfb, 0x98, 0x3f, 0xf5, 0x0b, 0x32, 0xff,
+    0x00, 0xa7, 0x0f, 0x29, 0x7f, 0xfa, 0x13, 0x28, 0x57, 0x05, 0x40, 0xcc,
+    0x41, 0x17, 0xdf, 0xce, 0x2a, 0x3c, 0xf3, 0x0c, 0x44, 0xee, 0xb8, 0xad,
+    0xdd, 0xf9, 0x73, 0x53, 0x89, 0xf6, 0xbf, 0x37, 0xc4, 0xa9, 0x45, 0xd6,
+    0xe1, 0x4f, 0x94, 0x52, 0x56, 0xd6, 0xf6, 0x4d, 0x2e, 0x2f, 0x9d, 0xed,
+    0xbd, 0xcd, 0x38, 0x37, 0x56, 0x80, 0x01, 0x73, 0xca, 0xfe, 0xb5, 0x9f,
+    0x07, 0xac, 0x5c, 0x9e, 0xed, 0x97, 0x64, 0xed, 0xd4, 0x84, 0xea, 0xcd,
+    0xde, 0x52, 0x7a, 0xb7, 0xab, 0x7c, 0xfd, 0x5b, 0x2c, 0x4e, 0xf2, 0xf7,
+    0x00, 0x90, 0x32, 0xf5, 0xef, 0x52, 0xcd, 0xb8, 0x31, 0x94, 0x93, 0x30,
+    0x32, 0x8e, 0x5f, 0x2f, 0xb5, 0x00, 0x32, 0x02, 0x60, 0x03, 0x72, 0x20,
+    0x7f, 0x13, 0xd4, 0x9a, 0x01, 0xd1, 0x98, 0x88, 0xb9, 0x9b, 0x44, 0x91,
+    0x40, 0x57, 0xde, 0xb8, 0x03, 0x4b, 0x81, 0x06, 0xdd, 0x40, 0xa0, 0x0a,
+    0xb5, 0xc0, 0x19, 0x60, 0xdc, 0x4d, 0x00, 0x24, 0x83, 0xdf, 0x0d, 0x04,
+    0x4c, 0x6b, 0x3d, 0x79, 0x50, 0x19, 0xf8, 0xac, 0x32, 0x71, 0x49, 0x33,
+    0xde, 0xbe, 0xb3, 0xf4, 0xd7, 0x7a, 0xda, 0x61, 0x1d, 0xe9, 0xf7, 0x13,
+    0xf0, 0xf2, 0xf8, 0x0a, 0xc1, 0x11, 0x68, 0x0b, 0x98, 0x90, 0x0d, 0x4a,
+    0x24, 0x26, 0x39, 0xb3, 0x4b, 0x05, 0xcf, 0x97, 0x49, 0xe7, 0xfd, 0x7d,
+    0xaa, 0x8d, 0x97, 0xa0, 0xe4, 0x55, 0x0d, 0x04, 0x34, 0x41, 0x02, 0x66,
+    0x0c, 0x75, 0xed, 0x58, 0xdc, 0x8c, 0x88, 0x0c, 0x72, 0x00, 0xf0, 0x02,
+    0xb1, 0x00, 0x5b, 0xd3, 0xce, 0xa2, 0xd6, 0xab, 0xc1, 0x16, 0xc9, 0xf9,
+    0x7e, 0x15, 0xe2, 0xeb, 0xc6, 0x92, 0xdb, 0x9f, 0x77, 0x3f, 0xd3, 0xb6,
+    0xc6, 0x29, 0x97, 0x36, 0xcc, 0xc0, 0xce, 0xd3, 0x7f, 0x0e, 0xb5, 0xad,
+    0x33, 0x77, 0xd5, 0x9e, 0x93, 0x18, 0xa8, 0xa5, 0x18, 0xab, 0x24, 0x29,
+    0xc2, 0x52, 0xc3, 0x5c, 0xdb, 0xf8, 0x0a, 0xa1, 0x71, 0x1d, 0x80, 0x20,
+    0x08, 0x6b, 0x82, 0x72, 0xf9, 0xd0, 0x04, 0xee, 0x58, 0x77, 0x58, 0x49,
+    0x24, 0x7b, 0xcf, 0x5a, 0x50, 0x07, 0x30, 0xc3, 0x09, 0x9c, 0xa9, 0x8d,
+    0x08, 0x17, 0x1e, 0x14, 0x01, 0x32, 0x1b, 0x30, 0x2d, 0xcc, 0xf2, 0x14,
+    0x02, 0xc4, 0x90, 0x49, 0x20, 0x73, 0x36, 0xfc, 0x78, 0xd0, 0x10, 0xa8,
+    0x46, 0xbd, 0xc2, 0xdc, 0x66, 0x1d, 0x6f, 0x40, 0x29, 0x21, 0x66, 0x33,
+    0x16, 0x24, 0x5a, 0x08, 0x98, 0xfa, 0x50, 0x0e, 0x4b, 0x07, 0x50, 0x48,
+    0x0a, 0x26, 0x24, 0x69, 0x6a, 0x01, 0xa3, 0x36, 0x50, 0x24, 0x5a, 0xe3,
+    0x2c, 0xc7, 0x9f, 0xa5, 0x00, 0xac, 0x00, 0x0d, 0x95, 0x98, 0x41, 0xbf,
+    0xa8, 0xf6, 0xfc, 0xd0, 0x0c, 0xb8, 0xe8, 0x98, 0xac, 0x5c, 0x98, 0x60,
+    0x41, 0xb7, 0xa5, 0x40, 0xcc, 0xb0, 0x4b, 0x1b, 0x41, 0xd2, 0xd9, 0xee,
+    0xbb, 0xff, 0x00, 0x34, 0x31, 0x56, 0xa7, 0xef, 0x23, 0x63, 0xa3, 0x84,
+    0x99, 0xda, 0x4d, 0xd4, 0x89, 0xbd, 0xaf, 0x5e, 0x72, 0x91, 0xa8, 0x4c,
+    0xa5, 0xa4, 0x2b, 0x5c, 0x8b, 0xcb, 0x48, 0xbf, 0x5f, 0xdd, 0x7a, 0x11,
+    0xf3, 0x28, 0x64, 0x00, 0x4e, 0x50, 0x67, 0x5d, 0x87, 0x5b, 0x50, 0xa1,
+    0x1a, 0xe6, 0x44, 0x11, 0x72, 0x77, 0x16, 0xfa, 0x50, 0x17, 0xe1, 0x05,
+    0x5c, 0x2c, 0xc5, 0x7b, 0xd9, 0xa6, 0x66, 0x26, 0xb6, 0x58, 0x26, 0xb8,
+    0x1a, 0xed, 0x3a, 0x5c, 0x92, 0x69, 0xd2, 0x94, 0x79, 0xa7, 0xf4, 0xfd,
+    0x0b, 0x18, 0x14, 0xca, 0x42, 0x81, 0xb1, 0xef, 0x5f, 0xde, 0xa6, 0x1b,
+    0xa2, 0x66, 0x23, 0x0c, 0x12, 0xc0, 0x2e, 0x92, 0x37, 0x1a, 0x78, 0xd0,
+    0x0b, 0x00, 0x80, 0xb9, 0x66, 0x24, 0xc7, 0xcf, 0xfa, 0xa0, 0x22, 0x29,
+    0x6c, 0xa5, 0x89, 0xcd, 0xa0, 0x07, 0xcb, 0x95, 0x00, 0xe0, 0x81, 0x94,
+    0x11, 0x95, 0x66, 0x49, 0x00, 0xc6, 0x94, 0x00, 0x9c, 0xc6, 0xf1, 0x24,
+    0x03, 0x31, 0x70, 0x3e, 0xf4, 0x01, 0x60, 0xf2, 0x65, 0x01, 0x03, 0x71,
+    0xe7, 0xa6, 0xb4, 0x06, 0x6c, 0x56, 0x2d, 0x89, 0x7b, 0x40, 0xdc, 0xeb,
+    0xca, 0xb6, 0xb8, 0x55, 0x6a, 0x77, 0xea, 0x4d, 0xa0, 0xad, 0x12, 0xb0,
+    0x25, 0x0e, 0x79, 0x26, 0x60, 0x8e, 0x67, 0x9c, 0x56, 0x76, 0xc9, 0x09,
+    0x8f, 0x00, 0x31, 0x9b, 0x0d, 0x24, 0x73, 0xf9, 0x75, 0x15, 0x63, 0x91,
+    0x91, 0x10, 0x12, 0xc4, 0x8f, 0x86, 0x39, 0x69, 0xf8, 0xac, 0x12, 0x91,
+    0x91, 0x19, 0xf8, 0xa2, 0xc3, 0x16, 0x73, 0x2b, 0x29, 0x37, 0x33, 0x6a,
+    0xd6, 0xe2, 0xa7, 0x76, 0xa2, 0x76, 0x9e, 0xcd, 0x61, 0xb8, 0x69, 0xca,
+    0xbb, 0x5b, 0xe8, 0xb4, 0xe4, 0xba, 0x3e, 0xd7, 0xe8, 0x51, 0x0c, 0x05,
+    0xc5, 0x88, 0xcb, 0x6d, 0x4f, 0xe2, 0xa2, 0x1d, 0x38, 0x10, 0x82, 0xaa,
+    0x40, 0x19, 0x5a, 0xd1, 0xa8, 0xd7, 0x95, 0x01, 0x14, 0x00, 0x75, 0x1c,
+    0xe1, 0xaf, 0x1c, 0xba, 0xf3, 0xa0, 0x23, 0x08, 0xee, 0xc9, 0x2c, 0x2d,
+    0x01, 0xa8, 0x02, 0x74, 0x00, 0x92, 0x01, 0x91, 0x03, 0x9c, 0x50, 0x15,
+    0xe6, 0x21, 0x08, 0x24, 0x82, 0x08, 0xb1, 0xb4, 0x78, 0x72, 0xa0, 0x1c,
+    0x84, 0xc9, 0x22, 0x27, 0x60, 0xbe, 0x54, 0x00, 0xb0, 0x53, 0x98, 0x95,
+    0x63, 0x02, 0x06, 0xde, 0x1e, 0xde, 0xf4, 0x04, 0x65, 0xcd, 0x05, 0x83,
+    0x16, 0x88, 0x3f, 0xdc, 0x50, 0x10, 0x00, 0xe8, 0x19, 0x46, 0x6c, 0xdb,
+    0x18, 0x13, 0x7d, 0xbd, 0xe8, 0x02, 0xc1, 0xb2, 0xa8, 0x2d, 0x08, 0x35,
+    0xf7, 0x04, 0xd0, 0x0b, 0x1d, 0xf1, 0x6f, 0xfd, 0xb3, 0x02, 0x44, 0xef,
+    0xf6, 0xa0, 0x0a, 0xe5, 0x56, 0xd5, 0xbd, 0x17, 0x9c, 0x72, 0xa0, 0x3a,
+    0x5c, 0x09, 0xcf, 0x82, 0xa2, 0xf9, 0x45, 0xad, 0x69, 0xb7, 0x31, 0xd5,
+    0xab, 0x85, 0xce, 0x30, 0xca, 0x8e, 0x2e, 0x4d, 0x6d, 0x2d, 0x7c, 0xf7,
+    0xf9, 0xdc, 0xd4, 0xe2, 0x63, 0xc1, 0x51, 0xf6, 0x88, 0x5a, 0xe6, 0x18,
+    0x94, 0xdc, 0xc6, 0xb5, 0xd3, 0x9f, 0x2f, 0x10, 0xae, 0x42, 0x60, 0xc6,
+    0x51, 0xb1, 0xb9, 0xf1, 0x22, 0x85, 0x6f, 0x72, 0x49, 0x10, 0x05, 0xd8,
+    0x5a, 0x48, 0xe5, 0xb5, 0x00, 0xea, 0x65, 0xf3, 0x19, 0x8f, 0x4b, 0x5e,
+    0xa5, 0x61, 0x27, 0xc3, 0x3b, 0x3e, 0x66, 0xd7, 0x28, 0xae, 0xa9, 0xd6,
+    0xe0, 0x6f, 0x49, 0x7a, 0xf2, 0xfa, 0x9a, 0x01, 0x62, 0x00, 0x8c, 0xc4,
+    0x18, 0xbe, 0x93, 0xad, 0xeb, 0x68, 0x75, 0x21, 0x10, 0x02, 0x92, 0xaa,
+    0xa8, 0x6f, 0xaf, 0xdf, 0xe7, 0x40, 0x26, 0x19, 0x65, 0x53, 0x05, 0x57,
+    0x30, 0x1a, 0x99, 0xb7, 0xda, 0x80, 0x8b, 0x26, 0x4d, 0x88, 0x91, 0x04,
+    0x1c, 0xa7, 0x4a, 0x00, 0xb0, 0x22, 0x14, 0x07, 0x99, 0xcd, 0xf9, 0xea,
+    0xf4, 0x01, 0x82, 0x10, 0xcb, 0x4c, 0x73, 0xdf, 0x5a, 0x02, 0xac, 0x67,
+    0xc3, 0xc2, 0xc2, 0x77, 0x62, 0x02, 0xac, 0x96, 0x62, 0x24, 0x01, 0xf2,
+    0xf0, 0xab, 0xe1, 0x07, 0x52, 0x4a, 0x11, 0xdd, 0xe8, 0x64, 0xa3, 0x46,
+    0x75, 0xea, 0x46, 0x95, 0x35, 0x79, 0x49, 0xa4, 0xbb, 0xde, 0x88, 0xe6,
+    0xf6, 0x5f, 0x1f, 0x81, 0xc7, 0x86, 0x64, 0x50, 0x98, 0x80, 0x66, 0x7c,
+    0x32, 0x2e, 0xbf, 0xdf, 0x9f, 0x95, 0x74, 0x15, 0xf0, 0xb3, 0xc3, 0x59,
+    0x3d, 0xb9, 0x33, 0xa3, 0xcd, 0x32, 0x4c, 0x4e, 0x57, 0x2b, 0x54, 0x57,
+    0x85, 0xec, 0xa5, 0xc9, 0xfd, 0x9f, 0x63, 0xed, 0xb5, 0xd2, 0xb9, 0xb9,
+    0x50, 0xac, 0xe6, 0x9c, 0xb1, 0x27, 0xc6, 0xfe, 0x3d, 0x7b, 0xd4, 0x47,
+    0x23, 0x58, 0x82, 0xcd, 0xdc, 0x13, 0x31, 0x1a, 0x91, 0x33, 0x58, 0x65,
+    0x23, 0x22, 0x20, 0x03, 0x2e, 0x52, 0xf2, 0x0f, 0x8e, 0x9e, 0x46, 0xa3,
+    0x4e, 0x66, 0x44, 0x61, 0xe2, 0x3b, 0xce, 0xe4, 0x8c, 0xb7, 0x36, 0x17,
+    0x1e, 0xd5, 0xae, 0x9b, 0xbc, 0x9b, 0x3d, 0x33, 0x2b, 0xa4, 0xa9, 0x60,
+    0xe9, 0xc5, 0x74, 0x4f, 0xcf, 0x5f, 0xa9, 0x5c, 0x36, 0x75, 0x0d, 0x90,
+    0x6d, 0x61, 0xa7, 0x95, 0x58, 0x6c, 0x08, 0x72, 0x90, 0x60, 0x18, 0xd8,
+    0x1f, 0x0e, 0x87, 0x5a, 0x01, 0x04, 0x11, 0x2d, 0x03, 0x78, 0x37, 0xe6,
+    0x68, 0x05, 0xc4, 0xef, 0x02, 0xc6, 0x24, 0xdc, 0x18, 0xd7, 0x9d, 0xf9,
+    0x6b, 0x40, 0x3a, 0xc0, 0x10, 0x4c, 0xe6, 0x19, 0x0c, 0x75, 0xd4, 0x50,
+    0x00, 0xb4, 0x30, 0x13, 0xa1, 0x90, 0x1b, 0x43, 0x40, 0x13, 0x65, 0x20,
+    0x0b, 0x98, 0x33, 0xa8, 0xfe, 0xe8, 0x01, 0x9c, 0x67, 0x2c, 0xc6, 0x4c,
+    0x58, 0xda, 0x80, 0x05, 0x49, 0x24, 0x01, 0x2d, 0xe3, 0xf4, 0xa0, 0x0a,
+    0x98, 0x42, 0xc5, 0x20, 0x0d, 0x09, 0xdc, 0x79, 0xd0, 0x0c, 0xb3, 0x77,
+    0x24, 0x95, 0x17, 0x98, 0x89, 0x8a, 0x01, 0x58, 0x00, 0x0c, 0x91, 0x6d,
+    0x0e, 0xc4, 0xfd, 0xbf, 0x34, 0x01, 0x85, 0xcb, 0x90, 0x17, 0x13, 0x02,
+    0x08, 0x90, 0x23, 0xf3, 0x40, 0x6a, 0xec, 0xd6, 0x96, 0x65, 0x51, 0x62,
+    0xb3, 0xdd, 0xb4, 0x10, 0x7f, 0x3a, 0xd6, 0x83, 0x3f, 0xa5, 0xc5, 0x4e,
+    0x15, 0x3a, 0x3b, 0x79, 0xff, 0x00, 0x62, 0x06, 0x39, 0x7c, 0x2a, 0x45,
+    0xb2, 0x48, 0x2a, 0x54, 0x6f, 0xd0, 0xa9, 0x87, 0xca, 0xe4, 0x6c, 0xc5,
+    0xc5, 0xc9, 0x88, 0xda, 0x80, 0x22, 0x48, 0x24, 0x1d, 0xa7, 0xc0, 0x5a,
+    0x80, 0x50, 0x03, 0x02, 0x4e, 0x50, 0x4e, 0xdd, 0x6f, 0x40, 0x69, 0x49,
+    0x75, 0x33, 0x7c, 0x4b, 0x9b, 0xdb, 0x73, 0xf8, 0xad, 0xb6, 0x1e, 0xb7,
+    0xbc, 0x8d, 0x9e, 0xe7, 0x5d, 0x97, 0xe3, 0x56, 0x26, 0x16, 0x93, 0xf8,
+    0x96, 0xff, 0x00, 0x7f, 0xce, 0x7e, 0x03, 0x30, 0x8b, 0x82, 0x40, 0x02,
+    0xf9, 0xaf, 0x98, 0xf3, 0x3e, 0x9f, 0x4a, 0x90, 0x6c, 0x48, 0x41, 0xdc,
+    0x92, 0xc0, 0x4c, 0xfa, 0x7b, 0xd0, 0x00, 0x0c, 0xcf, 0x96, 0x7b, 0xc0,
+    0xcd, 0xcd, 0xe8, 0x02, 0x5b, 0x48, 0x24, 0x6b, 0xde, 0x99, 0x11, 0xbf,
+    0xd2, 0x80, 0x54, 0x60, 0xa2, 0x54, 0x91, 0xad, 0xb4, 0x04, 0xf8, 0x50,
+    0x1e, 0x43, 0xf5, 0x4f, 0x6b, 0x61, 0xf1, 0x0e, 0x38, 0x4e, 0x14, 0xe7,
+    0xc2, 0x56, 0x96, 0x75, 0x36, 0x72, 0x36, 0x1c, 0xc7, 0xdc, 0x0f, 0x5e,
+    0xb3, 0x28, 0xcb, 0x5d, 0x0f, 0xf3, 0xea, 0xfe, 0xf3, 0xd9, 0x74, 0xfd,
+    0x7d, 0x17, 0xcb, 0xd5, 0x3d, 0x93, 0xf6, 0x76, 0x78, 0x2f, 0xfd, 0xee,
+    0x29, 0x5a, 0x6d, 0x69, 0x1f, 0xe9, 0x4f, 0x9b, 0xe9, 0x27, 0xb5, 0xb9,
+    0x2b, 0xa7, 0xab, 0xb2, 0xe1, 0xe0, 0xe2, 0x9c, 0x1c, 0x4c, 0x3c, 0x5c,
+    0x16, 0x0b, 0x8a, 0x0f, 0x74, 0x83, 0xeb, 0xaf, 0x97, 0xa5, 0x6e, 0xe7,
+    0x08, 0xd4, 0x8b, 0x8c, 0x95, 0xd3, 0x3b, 0x3c, 0x46, 0x1e, 0x9e, 0x26,
+    0x9b, 0xa3, 0x59, 0x5e, 0x2f, 0x75, 0xf9, 0xf8, 0x8f, 0x77, 0xd9, 0x7c,
+    0x5a, 0xf1, 0x9c, 0x1a, 0xe2, 0x82, 0x49, 0x02, 0x1d, 0x22, 0x21, 0x80,
+    0x13, 0xbe, 0x91, 0x7f, 0x23, 0x5c, 0x96, 0x36, 0x8b, 0xc3, 0xd4, 0x70,
+    0x7b, 0x72, 0xee, 0x3c, 0x7b, 0x36, 0xcb, 0x67, 0x96, 0xe2, 0xa5, 0x42,
+    0x5b, 0x6f, 0x1e, 0xd8, 0xf2, 0xf1, 0xe4, 0xf4, 0xdf, 0xb0, 0xda, 0x41,
+    0xca, 0xd0, 0x41, 0x53, 0x7b, 0x09, 0x1e, 0x1f, 0x6a, 0xd7, 0x4e, 0x64,
+    0x04, 0x2b, 0x0d, 0x5d, 0x4e, 0x61, 0xac, 0x03, 0xef, 0xf5, 0xa8, 0x93,
+    0x99, 0x95, 0x1c, 0xe8, 0x66, 0x63, 0x70, 0x73, 0xdc, 0xef, 0xb6, 0x9e,
+    0x3b, 0x69, 0x51, 0x8f, 0x5a, 0x8c, 0x54, 0x52, 0x8c, 0x55, 0x92, 0x11,
+    0xa0, 0xe1, 0x9b, 0x69, 0x1a, 0xdf, 0x6e, 0x5e, 0xb4, 0x2e, 0x18, 0x77,
+    0xb2, 0x93, 0xff, 0x00, 0xea, 0x08, 0xa0, 0x07, 0xf2, 0xef, 0x13, 0x95,
+    0x8e, 0xad, 0xf2, 0xd3, 0x6a, 0x02, 0x41, 0xcf, 0x73, 0xdf, 0x8b, 0x9e,
+    0x62, 0x3f, 0xda, 0x02, 0x5c, 0x35, 0x81, 0xca, 0x3b, 0xa4, 0x69, 0x14,
+    0x01, 0x92, 0x58, 0x2b, 0x10, 0x47, 0xfe, 0xc7, 0x5f, 0x2e, 0xb5, 0xa0,
+    0x02, 0x82, 0x33, 0x49, 0x88, 0x24, 0x99, 0xd4, 0xf5, 0xfd, 0x50, 0x0e,
+    0x58, 0x11, 0x9b, 0x34, 0xc8, 0x82, 0x27, 0xe5, 0x40, 0x21, 0x93, 0x91,
+    0x5a, 0x4c, 0x44, 0x5b, 0x71, 0x14, 0x04, 0x55, 0xd4, 0x12, 0x73, 0x1b,
+    0xc0, 0xd2, 0x80, 0x88, 0x18, 0x2b, 0x03, 0x19, 0x64, 0x8b, 0xda, 0xf4,
+    0x04, 0xc4, 0x90, 0x73, 0x00, 0x72, 0xeb, 0x6f, 0xbd, 0x00, 0x4c, 0xe5,
+    0x68, 0x27, 0x34, 0x73, 0x30, 0xbf, 0xdd, 0x01, 0xab, 0xb3, 0x4c, 0x71,
+    0x4a, 0x18, 0x92, 0x5d, 0x48, 0x19, 0xb4, 0x04, 0x1b, 0xdb, 0xd3, 0xc6,
+    0xb5, 0x79, 0xbd, 0x37, 0x3c, 0x3d, 0xd7, 0x26, 0x9f, 0xd3, 0xea, 0x43,
+    0xc7, 0x45, 0xba, 0x57, 0xe8, 0x58, 0xd9, 0x64, 0xdf, 0x29, 0x3b, 0xd5,
+    0x4f, 0x95, 0x06, 0x06, 0xd1, 0x19, 0xa7, 0x70, 0x67, 0xdf, 0xd2, 0x80,
+    0x10, 0x01, 0x73, 0xaa, 0xcc, 0x5c, 0xd0, 0x11, 0x82, 0xe1, 0xac, 0x92,
+    0x14, 0x00, 0x64, 0xcc, 0x58, 0x6b, 0xfe, 0xd5, 0x63, 0x17, 0x39, 0x28,
+    0xc5, 0x5d, 0xb2, 0xe8, 0x42, 0x55, 0x24, 0xa1, 0x05, 0x76, 0xf6, 0x4b,
+    0x9b, 0x3c, 0x7f, 0x6c, 0x76, 0xa6, 0x2e, 0x3f, 0x68, 0xa3, 0x60, 0x39,
+    0x55, 0xc2, 0x07, 0xf6, 0x98, 0x1c, 0xa6, 0x48, 0x82, 0x7d, 0x7d, 0x2d,
+    0x5e, 0x97, 0x93, 0x65, 0x31, 0xc1, 0xe1, 0xb8, 0x6b, 0x2b, 0xca, 0x5f,
+    0xbd, 0xcd, 0x69, 0xb2, 0xe9, 0xa7, 0xaf, 0x3b, 0x58, 0xfa, 0x1b, 0xd8,
+    0x5f, 0x65, 0xe9, 0xe0, 0x30, 0x12, 0x96, 0x2a, 0x09, 0xce, 0xa7, 0xef,
+    0x27, 0xaa, 0xb2, 0x77, 0x4b, 0xa3, 0xb7, 0x8f, 0xc4, 0x9d, 0x9b, 0x56,
+    0x3a, 0x5d, 0x9f, 0xfa, 0x9e, 0x00, 0xc1, 0xed, 0x05, 0x66, 0x88, 0x9c,
+    0x54, 0x1e, 0xe4, 0x7c, 0xcd, 0xbe, 0x55, 0x1b, 0x17, 0x90, 0xef, 0x2c,
+    0x3b, 0xf0, 0x7f, 0x47, 0xf7, 0xf3, 0x2d, 0xcd, 0x7d, 0x86, 0xde, 0xa6,
+    0x5f, 0x2f, 0xfe, 0x32, 0xf1, 0xd9, 0xf9, 0x24, 0x9f, 0x7b, 0x91, 0xdc,
+    0xc1, 0xed, 0x3e, 0x0b, 0x18, 0x61, 0x14, 0xe2, 0xb0, 0x9b, 0x3d, 0x82,
+    0x96, 0x83, 0xaf, 0x2d, 0x6b, 0x4b, 0x57, 0x03, 0x88, 0xa5, 0x7e, 0x38,
+    0x3d, 0x3b, 0x34, 0xf3, 0x5a, 0x1c, 0x66, 0x27, 0x24, 0xcc, 0x30, 0xae,
+    0x4a, 0xad, 0x19, 0x2e, 0x1d, 0x5b, 0xb5, 0xd5, 0xad, 0x7d, 0xd5, 0xd7,
+    0x7e, 0xba, 0x17, 0xb3, 0xa8, 0xc1, 0x6c, 0x4c, 0x42, 0xa9, 0x94, 0x06,
+    0x04, 0xb4, 0x7a, 0xf2, 0x15, 0x1a, 0x31, 0x72, 0x76, 0x5a, 0xb6, 0x6b,
+    0x61, 0x09, 0x54, 0x92, 0x84, 0x15, 0xdb, 0xd1, 0x25, 0xbb, 0x66, 0x4e,
+    0x2b, 0xb6, 0x78, 0x0e, 0x14, 0xab, 0xff, 0x00, 0xd4, 0x61, 0xe2, 0x13,
+    0x26, 0x30, 0x5b, 0x34, 0xef, 0x06, 0x2c, 0x3d, 0x62, 0xa6, 0xd1, 0xcb,
+    0x31, 0x55, 0x5d, 0x94, 0x1a, 0xef, 0xd3, 0xd7, 0xe8, 0x6e, 0xf0, 0x9e,
+    0xcd, 0x66, 0x78, 0xa9, 0x70, 0xc6, 0x8b, 0x8e, 0xd7, 0x72, 0xf8, 0x56,
+    0xbc, 0xf5, 0xd5, 0xdb, 0x9d, 0x93, 0x7f, 0x23, 0xcb, 0x76, 0xe7, 0x6e,
+    0xe3, 0x71, 0xa0, 0xe0, 0x60, 0x07, 0xc1, 0xe1, 0xd9, 0x48, 0x82, 0x41,
+    0x2c, 0x3e, 0xc2, 0x36, 0xf3, 0xd6, 0xba, 0x3c, 0x0e, 0x51, 0x4f, 0x0f,
+    0x69, 0xd4, 0xf8, 0xa5, 0xf2, 0x5f, 0x7e, 0xf7, 0xe4, 0x8f, 0x42, 0xc9,
+    0x3d, 0x92, 0xc3, 0xe5, 0xed, 0x56, 0xc4, 0x7c, 0x75, 0x15, 0x9a, 0xe9,
+    0x17, 0x6e, 0x4b, 0x9e, 0xbc, 0xdf, 0x63, 0x49, 0x33, 0x90, 0x0f, 0x71,
+    0x48, 0x50, 0x5b, 0x5b, 0x7d, 0xfe, 0x55, 0xb8, 0x3a, 0xe2, 0x04, 0x62,
+    0xa4, 0x91, 0x97, 0x9e, 0xdb, 0xd0, 0x1d, 0x5f, 0xd3, 0x3c, 0x59, 0xe1,
+    0xfb, 0x4f, 0x0f, 0x0c, 0x10, 0xb8, 0x38, 0xbd, 0xd6, 0x52, 0x24, 0x4e,
+    0xde, 0xfb, 0xf8, 0x9f, 0x31, 0xac, 0xcd, 0xa8, 0x7b, 0xdc, 0x3b, 0x92,
+    0x5a, 0xc7, 0x5f, 0xbf, 0xcb, 0xd0, 0xe7, 0x7d, 0xa7, 0xc0, 0xac, 0x56,
+    0x06, 0x53, 0x4a, 0xf2, 0x87, 0xc4, 0xb6, 0xdb, 0x9f, 0x85, 0xb5, 0xb7,
+    0x36, 0x91, 0xed, 0x9c, 0x02, 0x80, 0x00, 0x2e, 0x49, 0x8b, 0x57, 0x0d,
+    0x39, 0x9e, 0x56, 0x80, 0xd3, 0xa2, 0x88, 0x39, 0x6f, 0x17, 0xf3, 0x8a,
+    0x87, 0x52, 0xa1, 0x91, 0x1c, 0xe2, 0x08, 0x06, 0x6c, 0xe4, 0xc1, 0x8b,
+    0xcf, 0x95, 0x5e, 0x9d, 0xf5, 0x3d, 0x6a, 0x9d, 0x48, 0xd4, 0x82, 0x9c,
+    0x36, 0x7a, 0xa2, 0xb5, 0x22, 0x01, 0x93, 0x96, 0x4d, 0x80, 0xf5, 0xd3,
+    0xe5, 0x42, 0xf1, 0xd2, 0x54, 0x08, 0xee, 0xb1, 0xd0, 0x40, 0x16, 0xb5,
+    0x00, 0x2e, 0x47, 0x7a, 0x0c, 0x9b, 0xc9, 0xdb, 0x94, 0x8e, 0xbe, 0x74,
+    0x04, 0xc8, 0xd9, 0x8c, 0x82, 0x58, 0x8b, 0x01, 0x11, 0xe4, 0x28, 0x08,
+    0x02, 0x15, 0x0a, 0x41, 0xd4, 0x0d, 0x35, 0xb7, 0x3a, 0x00, 0xb3, 0xce,
+    0x56, 0x12, 0x26, 0xfc, 0x89, 0xa0, 0x14, 0x77, 0x67, 0x56, 0xb9, 0x26,
+    0xf3, 0xd7, 0xe6, 0x80, 0x24, 0xc3, 0x09, 0xb9, 0x8b, 0xde, 0x28, 0x04,
+    0x2a, 0xcc, 0xa0, 0x49, 0x55, 0x3a, 0x75, 0x3d, 0x4d, 0x00, 0x72, 0xc8,
+    0x82, 0x09, 0x61, 0xa5, 0xad, 0x3d, 0x1f, 0x6a, 0x01, 0xc2, 0xe7, 0x42,
+    0x44, 0xa8, 0x06, 0x44, 0x0d, 0x4f, 0x42, 0x80, 0x50, 0x4c, 0x09, 0x62,
+    0x00, 0x30, 0x06, 0x59, 0xf6, 0xa0, 0x08, 0x2a, 0x0c, 0x24, 0x8b, 0x6a,
+    0x47, 0xf5, 0x40, 0x6d, 0xec, 0x60, 0x87, 0x8b, 0xc4, 0xcd, 0x25, 0xc2,
+    0x31, 0x17, 0x98, 0xb8, 0x9b, 0x7a, 0x9d, 0x6b, 0x5d, 0x9a, 0x37, 0xee,
+    0x6c, 0xb9, 0xb2, 0x0e, 0x61, 0x26, 0xa9, 0x69, 0xcd, 0x8c, 0x07, 0x76,
+    0x32, 0xc0, 0xdc, 0x0b, 0xfa, 0x55, 0xa7, 0xca, 0xc4, 0x52, 0x0c, 0x30,
+    0xb6, 0xa6, 0xd4, 0x0c, 0xa3, 0x88, 0xe2, 0x70, 0x38, 0x65, 0x07, 0x1b,
+    0x19, 0x50, 0x6c, 0x0d, 0xc9, 0x36, 0x93, 0x15, 0x27, 0x0b, 0x82, 0xaf,
+    0x8b, 0x97, 0x0d, 0x08, 0x39, 0x7a, 0x78, 0xbd, 0x97, 0x89, 0x3b, 0x03,
+    0x97, 0x62, 0xb3, 0x09, 0xf0, 0x61, 0xa0, 0xe4, 0xfe, 0x4b, 0xbd, 0xbd,
+    0x15, 0xed, 0xa5, 0xde, 0xa7, 0x97, 0xed, 0x5e, 0xd7, 0x6e, 0x33, 0x0b,
+    0x22, 0x02, 0x98, 0x02, 0xd1, 0x22, 0x5b, 0xc7, 0xe9, 0x6f, 0xc5, 0x7a,
+    0x06, 0x51, 0x90, 0xd3, 0xcb, 0xdf, 0xbc, 0x9b, 0xe2, 0x9f, 0x5e, 0x4b,
+    0xad, 0xbe, 0xfd, 0x39, 0x2d, 0x6f, 0xea, 0xde, 0xcf, 0xfb, 0x2f, 0x4b,
+    0x2a, 0x7e, 0xfa, 0xa3, 0xe3, 0xaa, 0xf9, 0xf2, 0x8e, 0x9a, 0xa5, 0xf7,
+    0xd1, 0xdb, 0x92, 0xd6, 0xfc, 0x96, 0xb0, 0x2b, 0x92, 0x44, 0xfa, 0x75,
+    0x3f, 0x3a, 0xdf, 0x9e, 0xbb, 0x81, 0x82, 0x86, 0x1e, 0x09, 0x74, 0xbf,
+    0x9e, 0xa2, 0x82, 0x42, 0x44, 0x01, 0x73, 0x20, 0xf2, 0x34, 0x25, 0x90,
+    0x05, 0x65, 0x2c, 0xac, 0x45, 0xb4, 0xde, 0x3a, 0xfa, 0x50, 0x05, 0xb0,
+    0xd9, 0x40, 0x52, 0x4c, 0x4d, 0xa0, 0xeb, 0xe1, 0x73, 0x6a, 0x00, 0x46,
+    0x27, 0x80, 0x75, 0xbc, 0x83, 0xa0, 0xe5, 0x40, 0x0e, 0xf3, 0xbe, 0x50,
+    0xfa, 0x81, 0x6f, 0x88, 0x50, 0x0e, 0xc0, 0x80, 0x64, 0x40, 0x88, 0x89,
+    0xd7, 0x99, 0xfa, 0x50, 0x01, 0x33, 0x14, 0x95, 0x9f, 0x00, 0x6f, 0x6f,
+    0x1f, 0x7a, 0x00, 0xe1, 0xb9, 0xc3, 0xc6, 0x56, 0xc3, 0x60, 0xac, 0xa4,
+    0x43, 0x06, 0x82, 0x0c, 0x8b, 0x8e, 0x55, 0x49, 0x45, 0x49, 0x38, 0xb5,
+    0x74, 0xcb, 0x67, 0x08, 0xce, 0x2e, 0x32, 0x57, 0x4f, 0x74, 0x7d, 0x24,
+    0x3a, 0x90, 0x31, 0x11, 0xa7, 0x3e, 0x99, 0x44, 0x8e, 0xbc, 0xab, 0xca,
+    0x6a, 0xc9, 0xc5, 0xb8, 0xcb, 0x46, 0x8f, 0x0c, 0x70, 0x94, 0x24, 0xe3,
+    0x25, 0x66, 0xb7, 0x40, 0x43, 0xdc, 0x98, 0x04, 0xcf, 0x98, 0xd6, 0xa0,
+    0xd4, 0xa8, 0x5e, 0x8c, 0x18, 0xeb, 0xfb, 0x6e, 0xe4, 0x19, 0x82, 0x09,
+    0x9e, 0xbd, 0x2a, 0x5d, 0x19, 0x71, 0x41, 0x33, 0xd3, 0x32, 0x9a, 0xbe,
+    0xf7, 0x07, 0x4e, 0x56, 0xb6, 0x96, 0xf2, 0xd3, 0xe8, 0x56, 0x01, 0x38,
+    0x83, 0x5d, 0x62, 0xc6, 0xb2, 0x9b, 0x10, 0xb3, 0x65, 0xc4, 0xb2, 0x09,
+    0x22, 0x7b, 0xbf, 0x8b, 0xd0, 0x08, 0x64, 0x67, 0x04, 0x1c, 0xd1, 0x26,
+    0x6f, 0xe6, 0x0c, 0x50, 0x06, 0x40, 0x42, 0x16, 0x44, 0x92, 0x3c, 0xfa,
+    0xbd, 0x00, 0x46, 0x66, 0x92, 0x05, 0xee, 0x2d, 0x68, 0xd6, 0x28, 0x08,
+    0xd9, 0x81, 0x00, 0x09, 0x3b, 0x5a, 0x4c, 0x75, 0xf5, 0xa0, 0x18, 0xb6,
+    0x71, 0x18, 0x6e, 0x41, 0xb9, 0x8f, 0xc6, 0xf4, 0x02, 0xb4, 0x00, 0xd3,
+    0x12, 0x44, 0xc8, 0xe7, 0xa7, 0xda, 0x80, 0x04, 0x10, 0x17, 0x5b, 0x11,
+    0x02, 0xda, 0xed, 0xf5, 0x14, 0x04, 0x5f, 0xfc, 0xab, 0x98, 0x49, 0x1b,
+    0x81, 0xa9, 0x8a, 0x02, 0x4d, 0x89, 0x60, 0x73, 0x0b, 0x47, 0x5e, 0x74,
+    0x03, 0x15, 0x21, 0xe1, 0x2c, 0xa4, 0xde, 0x0d, 0xc5, 0x00, 0x08, 0x70,
+    0x09, 0x32, 0x6d, 0xbd, 0xb4, 0xf7, 0xa0, 0x3b, 0x1f, 0xa7, 0x30, 0x8b,
+    0x36, 0x2b, 0x36, 0xa1, 0x42, 0x83, 0x02, 0x24, 0xdc, 0xc7, 0x94, 0x0a,
+    0xd6, 0x66, 0x52, 0xba, 0x8c, 0x3c, 0x4d, 0x56, 0x67, 0x52, 0xca, 0x30,
+    0xf1, 0x3c, 0x26, 0x1f, 0x6b, 0x71, 0xb8, 0x78, 0x60, 0x1c, 0x76, 0x2b,
+    0xcc, 0x80, 0xc6, 0x3d, 0x44, 0xf5, 0xb5, 0x7a, 0x95, 0x4c, 0x87, 0x2f,
+    0xab, 0x27, 0x27, 0x49, 0x78, 0x36, 0x97, 0x92, 0x69, 0x1c, 0x65, 0x5f,
+    0x65, 0xf2, 0xaa, 0xd3, 0x73, 0x95, 0x15, 0x77, 0xd1, 0xb4, 0xbc, 0x93,
+    0x49, 0x79, 0x0b, 0x8b, 0xda, 0x5c, 0x6b, 0xe5, 0x38, 0xb8, 0xee, 0xb1,
+    0x30, 0x54, 0xe4, 0x8d, 0x39, 0x45, 0x5f, 0x47, 0x25, 0xc0, 0x51, 0xbf,
+    0x05, 0x25, 0xaf, 0x5d, 0x7d, 0x6f, 0x6f, 0x03, 0x2e, 0x1f, 0xd9, 0xcc,
+    0xaf, 0x0f, 0x7e, 0x0a, 0x11, 0x77, 0xeb, 0xf1, 0x7f, 0xca, 0xf6, 0xf0,
+    0x32, 0x2b, 0x33, 0x97, 0x2d, 0x2c, 0xc4, 0xc9, 0xdc, 0xdf, 0x7f, 0x3a,
+    0xd9, 0x46, 0x2a, 0x09, 0x46, 0x2a, 0xc9, 0x1b, 0x88, 0x42, 0x34, 0xe2,
+    0xa1, 0x05, 0x64, 0xb4, 0x49, 0x6c, 0x90, 0x48, 0xcc, 0x4b, 0x4c, 0x85,
+    0x59, 0x58, 0xf5, 0xaa, 0x97, 0x15, 0x62, 0x59, 0xc8, 0xda, 0x66, 0x47,
+    0x5c, 0xe8, 0x76, 0xd8, 0x4f, 0xe0, 0x43, 0xb9, 0x7a, 0x10, 0xc3, 0x2a,
+    0x19, 0x26, 0x08, 0xd4, 0x47, 0xb7, 0x9d, 0x09, 0x02, 0xe5, 0x26, 0x41,
+    0xb2, 0xc1, 0xef, 0x29, 0xb1, 0x1a, 0x6f, 0x40, 0x00, 0x4c, 0x32, 0x18,
+    0x25, 0x6e, 0xa5, 0xa8, 0x06, 0x22, 0xe0, 0xb6, 0x8d, 0x17, 0x9d, 0x7a,
+    0x9a, 0x00, 0x2c, 0x9c, 0xac, 0xcd, 0x63, 0xa1, 0xe5, 0xd4, 0x1a, 0x02,
+    0x0c, 0xa5, 0x94, 0x31, 0x12, 0x36, 0x98, 0x36, 0xf1, 0xf9, 0x7b, 0xd0,
+    0x11, 0xb2, 0x80, 0x54, 0x5c, 0x69, 0x7d, 0xba, 0xeb, 0x6a, 0x01, 0x09,
+    0x6c, 0xbb, 0x83, 0x7b, 0x9d, 0xcf, 0x9f, 0xad, 0x01, 0xf4, 0x7e, 0xcd,
+    0x0f, 0x87, 0xc0, 0x60, 0x61, 0xe2, 0x1c, 0xac, 0x98, 0x4a, 0xac, 0x2d,
+    0x00, 0xc5, 0xc7, 0xb5, 0x79, 0x16, 0x61, 0x88, 0x8d, 0x4c, 0x45, 0x49,
+    0xc1, 0xdd, 0x39, 0x36, 0xbb, 0xae, 0x78, 0xa6, 0x3a, 0xac, 0x6b, 0x62,
+    0xaa, 0xd4, 0x83, 0xba, 0x94, 0xa4, 0xd7, 0x73, 0x6c, 0xb9, 0x96, 0x1f,
+    0x2e, 0x6d, 0x48, 0xb0, 0xd8, 0x45, 0x6a, 0x6a, 0x54, 0x30, 0x23, 0x3f,
+    0x1c, 0x09, 0x55, 0x2e, 0x23, 0xd4, 0x5b, 0xe7, 0xeb, 0x52, 0xb2, 0xea,
+    0xdc, 0x5c, 0x54, 0xfc, 0x7f, 0x3e, 0x47, 0x65, 0xec, 0xce, 0x21, 0x70,
+    0xce, 0x83, 0xef, 0x5e, 0x8f, 0xe8, 0x64, 0x04, 0x64, 0xcc, 0x42, 0x86,
+    0x9b, 0x5a, 0xf5, 0xb4, 0x3a, 0xb0, 0x66, 0xcc, 0x41, 0x71, 0x72, 0x6c,
+    0x1a, 0xdf, 0x5f, 0x1a, 0x00, 0x46, 0x60, 0x01, 0x92, 0x07, 0x3b, 0x03,
+    0xac, 0x75, 0xf5, 0xa0, 0x26, 0x28, 0x90, 0x06, 0x53, 0x24, 0xc9, 0x1b,
+    0x6d, 0xfe, 0x50, 0x0c, 0x52, 0xe7, 0x3b, 0x16, 0x89, 0xb7, 0xae, 0xb4,
+    0x02, 0xb9, 0xb9, 0xee, 0xb4, 0x34, 0x05, 0x3c, 0xc7, 0x53, 0x40, 0x31,
+    0x1f, 0x0b, 0x00, 0x08, 0x36, 0x9d, 0xbe, 0x7f, 0x2a, 0x00, 0x19, 0x13,
+    0x00, 0x72, 0xee, 0xd0, 0x01, 0x54, 0xe6, 0x0c, 0xa0, 0xa9, 0x9d, 0x48,
+    0x23, 0xd2, 0x80, 0x76, 0x01, 0x7e, 0x22, 0xc4, 0x46, 0xda, 0xc7, 0x42,
+    0x80, 0x86, 0xf1, 0xdd, 0xbd, 0xc0, 0x13, 0x1e, 0x34, 0x02, 0xb8, 0x81,
+    0x2a, 0x24, 0xe9, 0x1a, 0x8a, 0x01, 0x98, 0xc8, 0x04, 0x79, 0x92, 0x08,
+    0xd7, 0x97, 0xbd, 0x01, 0xea, 0xfb, 0x23, 0x85, 0x1c, 0x3f, 0x02, 0x88,
+    0x70, 0xc0, 0x76, 0xef, 0x37, 0x78, 0xdf, 0x60, 0x63, 0x9d, 0x69, 0xeb,
+    0xcb, 0xde, 0xd5, 0x6d, 0x6c, 0x73, 0x38, 0xda, 0xde, 0xf6, 0xb3, 0x6b,
+    0x65, 0xa1, 0xff, 0xd9,
+};
+
+#define BENCH_JPEG_SIZE 240
@@ -0,0 +1,126 @@
+/**
+ * @file bench_lvgl.c
+ * @brief LVGL渲染基准测试用例(整帧软件渲染, 多线程条带渲染对比)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-02
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "bench.h"
+
+#if BENCH_CFG_GROUP_LVGL
+#include "demos/lv_demos.h"
+#include "lvgl.h"
+#if LV_USE_PARALLEL_DRAW
+#include "src/core/lv_refr_parallel.h"
+#endif
+
+// Private Defines --------------------------
+
+#define BENCH_LV_W 480  // 中等尺寸, widgets demo使用20/14号字体
+#define BENCH_LV_H 320
+#define BENCH_LV_PX (BENCH_LV_W * BENCH_LV_H)
+
+#define LV_ARG(_tab, _thr) ((void *)(uintptr_t)((_tab) | ((_thr) << 8)))
+#define LV_ARG_TAB(_arg) ((uint8_t)((uintptr_t)(_arg) & 0xff))
+#define LV_ARG_THR(_arg) ((uint8_t)(((uintptr_t)(_arg) >> 8) & 0xff))
+
+// Private Variables ------------------------
+
+static lv_disp_drv_t lv_drv;
+static lv_disp_draw_buf_t lv_draw_buf;
+static lv_color_t lv_buf[BENCH_LV_PX];  // 整屏缓冲, 一次刷新即为一帧
+static lv_color_t lv_ref[BENCH_LV_PX];  // 单线程渲染的参考帧
+static lv_obj_t *lv_tabview;
+
+// Private Functions ------------------------
+
+static void lv_flush(lv_disp_drv_t *drv, const lv_area_t *area,
+                     lv_color_t *px) {
+  (void)area;
+  (void)px;
+  lv_disp_flush_ready(drv);
+}
+
+static void lv_render(void) {
+  lv_obj_invalidate(lv_scr_act());
+  lv_refr_now(NULL);
+}
+
+static void lv_use_threads(uint8_t thr) {
+#if LV_USE_PARALLEL_DRAW
+  lv_refr_parallel_set_threads(thr);
+#endif
+  (void)thr;
+}
+
+static void lv_setup(void *arg) {
+  static uint8_t inited = 0;
+  if (!inited) {
+    lv_init();
+    lv_disp_draw_buf_init(&lv_draw_buf, lv_buf, NULL, BENCH_LV_PX);
+    lv_disp_drv_init(&lv_drv);
+    lv_drv.hor_res = BENCH_LV_W;
+    lv_drv.ver_res = BENCH_LV_H;
+    lv_drv.flush_cb = lv_flush;
+    lv_drv.draw_buf = &lv_draw_buf;
+    lv_disp_drv_register(&lv_drv);
+    lv_demo_widgets();
+    lv_tabview = lv_obj_get_child(lv_scr_act(), 0);
+    inited = 1;
+  }
+  lv_tabview_set_act(lv_tabview, LV_ARG_TAB(arg), LV_ANIM_OFF);
+  if (LV_ARG_THR(arg) > 1) {  // 与单线程渲染逐像素比较
+    lv_use_threads(1);
+    lv_render();
+    memcpy(lv_ref, lv_buf, sizeof(lv_ref));
+    lv_use_threads(LV_ARG_THR(arg));
+    lv_render();
+    uint32_t diff = 0;
+    for (uint32_t i = 0; i < BENCH_LV_PX; i++) {
+      if (lv_buf[i].full != lv_ref[i].full) diff++;
+    }
+    Bench_SetExtra(diff, "diff px");
+  } else {
+    lv_use_threads(1);
+    lv_render();
+  }
+}
+
+static void lv_teardown(void *arg) {
+  (void)arg;
+  lv_use_threads(1);
+}
+
+static void bench_lv_frame(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    lv_render();
+  }
+}
+
+// Exported Variables -----------------------
+
+#define LV_CASE(_name, _tab, _thr)                                        \
+  BENCH_CASE_EX(_name, bench_lv_frame, lv_setup, lv_teardown,            \
+                LV_ARG(_tab, _thr), BENCH_LV_PX, "px")
+
+static const bench_case_t lvgl_cases[] = {
+    LV_CASE("lvgl/widgets_profile", 0, 1),
+    LV_CASE("lvgl/widgets_analytics", 1, 1),
+    LV_CASE("lvgl/widgets_shop", 2, 1),
+#if LV_USE_PARALLEL_DRAW  // 帧时间随线程数的变化
+    LV_CASE("lvgl/widgets_profile_mt2", 0, 2),
+    LV_CASE("lvgl/widgets_analytics_mt2", 1, 2),
+    LV_CASE("lvgl/widgets_shop_mt2", 2, 2),
+    LV_CASE("lvgl/widgets_profile_mt4", 0, 4),
+    LV_CASE("lvgl/widgets_analytics_mt4", 1, 4),
+    LV_CASE("lvgl/widgets_shop_mt4", 2, 4),
+#endif
+};
+
+const bench_group_t bench_group_lvgl = BENCH_GROUP("lvgl", lvgl_cases);
+
+#endif  // BENCH_CFG_GROUP_LVGL
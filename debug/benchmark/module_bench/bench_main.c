@@ -0,0 +1,113 @@
+/**
+ * @file bench_main.c
+ * @brief 模块基准测试用例组注册及主机入口
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "bench.h"
+
+extern const bench_group_t bench_group_datastruct;
+extern const bench_group_t bench_group_system;
+extern const bench_group_t bench_group_algorithm;
+extern const bench_group_t bench_group_storage;
+extern const bench_group_t bench_group_graphics;
+extern const bench_group_t bench_group_lvgl;
+extern const bench_group_t bench_group_nn;
+
+const bench_group_t *const bench_groups[] = {
+#if BENCH_CFG_GROUP_DATASTRUCT
+    &bench_group_datastruct,
+#endif
+#if BENCH_CFG_GROUP_SYSTEM
+    &bench_group_system,
+#endif
+#if BENCH_CFG_GROUP_ALGORITHM
+    &bench_group_algorithm,
+#endif
+#if BENCH_CFG_GROUP_STORAGE
+    &bench_group_storage,
+#endif
+#if BENCH_CFG_GROUP_GRAPHICS
+    &bench_group_graphics,
+#endif
+#if BENCH_CFG_GROUP_LVGL
+    &bench_group_lvgl,
+#endif
+#if BENCH_CFG_GROUP_NN
+    &bench_group_nn,
+#endif
+    NULL,
+};
+
+#if MOD_HOST_PORT  // 主机移植层: 命令行入口
+#include <stdarg.h>
+
+static FILE *json_fp;
+
+static int json_printf(const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  int ret = vfprintf(json_fp, fmt, ap);
+  va_end(ap);
+  return ret;
+}
+
+static void usage(const char *prog) {
+  printf(
+      "Usage: %s [-f filter] [-t min_time_ms] [-o result.json] [-l]\n"
+      "  -f  only run cases whose name contains filter\n"
+      "  -t  min time per round, default %d ms\n"
+      "  -o  write JSON result to file ('-' for stdout)\n"
+      "  -l  list all cases\n",
+      prog, BENCH_CFG_MIN_TIME_MS);
+}
+
+int main(int argc, char **argv) {
+  const char *filter = NULL;
+  const char *output = NULL;
+  uint32_t min_time_ms = BENCH_CFG_MIN_TIME_MS;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+      filter = argv[++i];
+    } else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+      min_time_ms = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      output = argv[++i];
+    } else if (!strcmp(argv[i], "-l")) {
+      for (const bench_group_t *const *g = bench_groups; *g != NULL; g++) {
+        for (uint16_t j = 0; j < (*g)->num; j++) {
+          printf("%s\n", (*g)->cases[j].name);
+        }
+      }
+      return 0;
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  init_cycle_counter(false);
+  uint16_t cnt = Bench_CountCases(filter);
+  bench_result_t *results = malloc((cnt ? cnt : 1) * sizeof(bench_result_t));
+  if (results == NULL) {
+    perror("malloc");
+    return 1;
+  }
+  uint16_t num = Bench_RunAll(filter, min_time_ms ? min_time_ms : 1, results);
+  Bench_PrintTable(results, num);
+  if (output == NULL) return 0;
+  json_fp = strcmp(output, "-") ? fopen(output, "w") : stdout;
+  if (json_fp == NULL) {
+    perror(output);
+    return 1;
+  }
+  Bench_PrintJson(results, num, json_printf);
+  if (json_fp != stdout) fclose(json_fp);
+  return 0;
+}
+#endif  // MOD_HOST_PORT
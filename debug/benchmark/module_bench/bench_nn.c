@@ -0,0 +1,214 @@
+/**
+ * @file bench_nn.c
+ * @brief 神经网络模块基准测试用例(genann)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-12
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "bench.h"
+
+#if BENCH_CFG_GROUP_NN
+#include <math.h>
+#include <stdlib.h>
+
+#include "genann.h"
+#include "genann_infer.h"
+
+// Private Defines --------------------------
+
+#define BENCH_NN_VECTORS 32  // 循环使用的输入向量数
+#define BENCH_NN_MAX_IN 32   // 输入数上限
+#define BENCH_NN_SAMPLES 512  // 训练用合成数据集样本数
+#define BENCH_NN_EPOCHS 10    // 计算误差前的训练轮数
+
+enum {  // 推理方式
+  NN_DOUBLE,  // genann_run(), double + 4096项查表sigmoid
+  NN_F32,     // float32权重块
+  NN_Q8,      // int8权重块
+};
+
+typedef struct {  // 网络结构
+  int inputs, hidden_layers, hidden, outputs;
+} nn_shape_t;
+
+static const nn_shape_t nn_shapes[] = {
+    {8, 1, 16, 2},    // 小型传感器分类网络
+    {32, 2, 32, 8},   // 较大的多层网络
+};
+
+enum {  // 训练方式
+  NN_TRAIN_SGD,  // genann_train(), 逐样本
+  NN_TRAIN_B32,  // genann_train_batch(), 32样本一批, 单线程
+  NN_TRAIN_B32_T4,  // 同上, 要求4线程, 批太小时仍单线程
+  NN_TRAIN_B256,     // 256样本一批, 单线程
+  NN_TRAIN_B256_T4,  // 同上, 4线程
+};
+
+static const nn_shape_t nn_train_shape = {16, 2, 32, 4};
+
+#define NN_ARG(_mode, _shape) (void *)(uintptr_t)(((_mode) << 8) | (_shape))
+#define NN_CASE(_name, _mode, _shape)                                      \
+  BENCH_CASE_EX(_name, bench_nn, nn_setup, nn_teardown, NN_ARG(_mode, _shape), \
+                1, "run")
+
+#define NN_TRAIN_CASE(_name, _mode)                                        \
+  BENCH_CASE_EX(_name, bench_nn_train, nn_train_setup, nn_teardown,       \
+                (void *)(uintptr_t)(_mode), BENCH_NN_SAMPLES, "sample")
+
+// Private Variables ------------------------
+
+static genann *nn_ann;
+static genann_blob *nn_blob;
+static float *nn_work;
+static double nn_input[BENCH_NN_VECTORS][BENCH_NN_MAX_IN];
+static float nn_input_f[BENCH_NN_VECTORS][BENCH_NN_MAX_IN];
+static double *nn_set_x, *nn_set_y;  // 训练数据集
+
+// Private Functions ------------------------
+
+static void nn_setup(void *arg) {
+  uint8_t mode = (uintptr_t)arg >> 8;
+  const nn_shape_t *s = &nn_shapes[(uintptr_t)arg & 0xFF];
+  srand(1);
+  nn_ann = genann_init(s->inputs, s->hidden_layers, s->hidden, s->outputs);
+  for (uint8_t v = 0; v < BENCH_NN_VECTORS; v++) {
+    for (int k = 0; k < s->inputs; k++) {
+      nn_input[v][k] = 2.0 * rand() / RAND_MAX - 1;
+      nn_input_f[v][k] = nn_input[v][k];
+    }
+  }
+  if (mode != NN_DOUBLE) {
+    uint32_t magic = mode == NN_F32 ? GENANN_BLOB_F32 : GENANN_BLOB_Q8;
+    size_t size = genann_blob_export(nn_ann, magic, NULL, 0);
+    nn_blob = m_alloc(size);
+    genann_blob_export(nn_ann, magic, nn_blob, size);
+    nn_work = m_alloc(nn_blob->work_size);
+  }
+  // 与精确sigmoid的double推理比较, 报告输出的最大偏差
+  double err = 0;
+  for (uint8_t v = 0; v < BENCH_NN_VECTORS; v++) {
+    double ref[BENCH_NN_MAX_IN];
+    nn_ann->activation_hidden = genann_act_sigmoid;
+    nn_ann->activation_output = genann_act_sigmoid;
+    memcpy(ref, genann_run(nn_ann, nn_input[v]), sizeof(double) * s->outputs);
+    nn_ann->activation_hidden = genann_act_sigmoid_cached;
+    nn_ann->activation_output = genann_act_sigmoid_cached;
+    for (int k = 0; k < s->outputs; k++) {
+      double out;
+      if (mode == NN_DOUBLE) {
+        out = genann_run(nn_ann, nn_input[v])[k];
+      } else {
+        out = genann_blob_run(nn_blob, nn_input_f[v], nn_work)[k];
+      }
+      if (fabs(out - ref[k]) > err) err = fabs(out - ref[k]);
+    }
+  }
+  Bench_SetExtra(err * 1e4, "e-4 err");
+}
+
+static void nn_teardown(void *arg) {
+  (void)arg;
+  genann_free(nn_ann);
+  if (nn_blob != NULL) {
+    m_free(nn_blob);
+    m_free(nn_work);
+    nn_blob = NULL;
+  }
+  if (nn_set_x != NULL) {
+    m_free(nn_set_x);
+    m_free(nn_set_y);
+    nn_set_x = NULL;
+  }
+}
+
+static void nn_train_epoch(genann *ann, uint8_t mode) {
+  const nn_shape_t *s = &nn_train_shape;
+  if (mode == NN_TRAIN_SGD) {
+    for (int n = 0; n < BENCH_NN_SAMPLES; n++) {
+      genann_train(ann, nn_set_x + n * s->inputs, nn_set_y + n * s->outputs,
+                   0.5);
+    }
+  } else {
+    // 批内梯度取平均, 学习率相应放大
+    const int big = mode == NN_TRAIN_B256 || mode == NN_TRAIN_B256_T4;
+    genann_train_batch(ann, nn_set_x, nn_set_y, BENCH_NN_SAMPLES,
+                       big ? 256 : 32, big ? 16.0 : 4.0,
+                       mode == NN_TRAIN_B32_T4 || mode == NN_TRAIN_B256_T4
+                           ? 4
+                           : 1);
+  }
+}
+
+static void nn_train_setup(void *arg) {
+  uint8_t mode = (uintptr_t)arg;
+  const nn_shape_t *s = &nn_train_shape;
+  // 合成数据集: 输出k为x[4k] + x[4k+1] - x[4k+2] * x[4k+3] > 0
+  srand(1);
+  nn_set_x = m_alloc(sizeof(double) * BENCH_NN_SAMPLES * s->inputs);
+  nn_set_y = m_alloc(sizeof(double) * BENCH_NN_SAMPLES * s->outputs);
+  for (int n = 0; n < BENCH_NN_SAMPLES; n++) {
+    double *x = nn_set_x + n * s->inputs;
+    for (int k = 0; k < s->inputs; k++) x[k] = 2.0 * rand() / RAND_MAX - 1;
+    for (int k = 0; k < s->outputs; k++) {
+      double const *xk = x + 4 * k;
+      nn_set_y[n * s->outputs + k] = xk[0] + xk[1] - xk[2] * xk[3] > 0;
+    }
+  }
+  nn_ann = genann_init(s->inputs, s->hidden_layers, s->hidden, s->outputs);
+  // 同一初值训练若干轮后的均方误差, 比较收敛效果
+  genann *ann = genann_copy(nn_ann);
+  for (int e = 0; e < BENCH_NN_EPOCHS; e++) nn_train_epoch(ann, mode);
+  double mse = 0;
+  for (int n = 0; n < BENCH_NN_SAMPLES; n++) {
+    double const *y = genann_run(ann, nn_set_x + n * s->inputs);
+    for (int k = 0; k < s->outputs; k++) {
+      double d = y[k] - nn_set_y[n * s->outputs + k];
+      mse += d * d;
+    }
+  }
+  genann_free(ann);
+  Bench_SetExtra(mse / (BENCH_NN_SAMPLES * s->outputs) * 1e3, "e-3 mse");
+}
+
+static void bench_nn_train(uint32_t iters, void *arg) {
+  uint8_t mode = (uintptr_t)arg;
+  for (uint32_t i = 0; i < iters; i++) {
+    nn_train_epoch(nn_ann, mode);
+  }
+  BENCH_KEEP(nn_ann->weight);
+}
+
+static void bench_nn(uint32_t iters, void *arg) {
+  uint8_t mode = (uintptr_t)arg >> 8;
+  for (uint32_t i = 0; i < iters; i++) {
+    uint8_t v = i % BENCH_NN_VECTORS;
+    if (mode == NN_DOUBLE) {
+      BENCH_KEEP(genann_run(nn_ann, nn_input[v]));
+    } else {
+      BENCH_KEEP(genann_blob_run(nn_blob, nn_input_f[v], nn_work));
+    }
+  }
+}
+
+// Exported Variables -----------------------
+
+static const bench_case_t nn_cases[] = {
+    NN_CASE("genann/double_8-16-2", NN_DOUBLE, 0),
+    NN_CASE("genann/f32_8-16-2", NN_F32, 0),
+    NN_CASE("genann/q8_8-16-2", NN_Q8, 0),
+    NN_CASE("genann/double_32-32x2-8", NN_DOUBLE, 1),
+    NN_CASE("genann/f32_32-32x2-8", NN_F32, 1),
+    NN_CASE("genann/q8_32-32x2-8", NN_Q8, 1),
+    NN_TRAIN_CASE("genann/train_sgd_16-32x2-4", NN_TRAIN_SGD),
+    NN_TRAIN_CASE("genann/train_b32_16-32x2-4", NN_TRAIN_B32),
+    NN_TRAIN_CASE("genann/train_b32_t4_16-32x2-4", NN_TRAIN_B32_T4),
+    NN_TRAIN_CASE("genann/train_b256_16-32x2-4", NN_TRAIN_B256),
+    NN_TRAIN_CASE("genann/train_b256_t4_16-32x2-4", NN_TRAIN_B256_T4),
+};
+
+const bench_group_t bench_group_nn = BENCH_GROUP("nn", nn_cases);
+
+#endif  // BENCH_CFG_GROUP_NN
@@ -0,0 +1,38 @@
+/**
+ * @file bench_sch_task.c
+ * @brief 按不同调试配置编译的scheduler_task.c副本, 供任务调度开销对比
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-20
+ *
+ * THINK DIFFERENTLY
+ */
+
+// CMake以不同的SCH_CFG_DEBUG_*编译本文件多次, 导出符号加SCH_BENCH_PREFIX前缀,
+// 与modules_host中的调度器链接到同一程序, 见bench_system.c
+
+#define SCH_BENCH_CAT2(a, b) a##b
+#define SCH_BENCH_CAT(a, b) SCH_BENCH_CAT2(a, b)
+#define SCH_BENCH_NAME(x) SCH_BENCH_CAT(SCH_BENCH_PREFIX, x)
+
+#define Task_Runner SCH_BENCH_NAME(Task_Runner)
+#define Sch_CreateTask SCH_BENCH_NAME(Sch_CreateTask)
+#define Sch_DeleteTask SCH_BENCH_NAME(Sch_DeleteTask)
+#define Sch_IsTaskExist SCH_BENCH_NAME(Sch_IsTaskExist)
+#define Sch_GetTaskEnabled SCH_BENCH_NAME(Sch_GetTaskEnabled)
+#define Sch_SetTaskPriority SCH_BENCH_NAME(Sch_SetTaskPriority)
+#define Sch_SetTaskArgs SCH_BENCH_NAME(Sch_SetTaskArgs)
+#define Sch_DelayTask SCH_BENCH_NAME(Sch_DelayTask)
+#define Sch_GetTaskNum SCH_BENCH_NAME(Sch_GetTaskNum)
+#define Sch_SetTaskEnabled SCH_BENCH_NAME(Sch_SetTaskEnabled)
+#define Sch_SetTaskFreq SCH_BENCH_NAME(Sch_SetTaskFreq)
+#define sch_task_add_debug SCH_BENCH_NAME(sch_task_add_debug)
+#define sch_task_finish_debug SCH_BENCH_NAME(sch_task_finish_debug)
+#define sch_task_add_hist_debug SCH_BENCH_NAME(sch_task_add_hist_debug)
+#define task_cmd_func SCH_BENCH_NAME(task_cmd_func)
+
+#include "scheduler_task.c"
+
+#if SCH_CFG_ENABLE_TASK
+const size_t SCH_BENCH_NAME(task_size) = sizeof(scheduler_task_t);
+#endif
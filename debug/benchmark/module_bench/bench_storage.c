@@ -0,0 +1,132 @@
+/**
+ * @file bench_storage.c
+ * @brief 存储模块基准测试用例(littlefs, RAM块设备)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "bench.h"
+
+#if BENCH_CFG_GROUP_STORAGE
+#include "lfs.h"
+
+// Private Defines --------------------------
+
+#define BENCH_LFS_BLOCK_SIZE 512
+#define BENCH_LFS_BLOCK_COUNT 64  // 32KB RAM块设备
+#define BENCH_LFS_CACHE_SIZE 64
+#define BENCH_LFS_FILE_SIZE 4096  // 每次迭代读写的文件大小
+
+// Private Variables ------------------------
+
+static uint8_t ram_disk[BENCH_LFS_BLOCK_COUNT][BENCH_LFS_BLOCK_SIZE];
+static uint8_t lfs_read_buf[BENCH_LFS_CACHE_SIZE];
+static uint8_t lfs_prog_buf[BENCH_LFS_CACHE_SIZE];
+static uint8_t lfs_lookahead_buf[16];
+static uint8_t lfs_file_buf[BENCH_LFS_CACHE_SIZE];
+static uint8_t lfs_data[BENCH_LFS_FILE_SIZE];
+static lfs_t bench_lfs;
+
+// Private Functions ------------------------
+
+static int ram_read(const struct lfs_config *c, lfs_block_t block,
+                    lfs_off_t off, void *buffer, lfs_size_t size) {
+  (void)c;
+  memcpy(buffer, &ram_disk[block][off], size);
+  return 0;
+}
+
+static int ram_prog(const struct lfs_config *c, lfs_block_t block,
+                    lfs_off_t off, const void *buffer, lfs_size_t size) {
+  (void)c;
+  memcpy(&ram_disk[block][off], buffer, size);
+  return 0;
+}
+
+static int ram_erase(const struct lfs_config *c, lfs_block_t block) {
+  (void)c;
+  memset(ram_disk[block], 0xff, BENCH_LFS_BLOCK_SIZE);
+  return 0;
+}
+
+static int ram_sync(const struct lfs_config *c) {
+  (void)c;
+  return 0;
+}
+
+static const struct lfs_config bench_lfs_cfg = {
+    .read = ram_read,
+    .prog = ram_prog,
+    .erase = ram_erase,
+    .sync = ram_sync,
+    .read_size = 16,
+    .prog_size = 16,
+    .block_size = BENCH_LFS_BLOCK_SIZE,
+    .block_count = BENCH_LFS_BLOCK_COUNT,
+    .block_cycles = 500,
+    .cache_size = BENCH_LFS_CACHE_SIZE,
+    .lookahead_size = sizeof(lfs_lookahead_buf),
+    .read_buffer = lfs_read_buf,
+    .prog_buffer = lfs_prog_buf,
+    .lookahead_buffer = lfs_lookahead_buf,
+};
+
+static const struct lfs_file_config bench_file_cfg = {
+    .buffer = lfs_file_buf,
+};
+
+static void lfs_write_file(void) {
+  lfs_file_t file;
+  lfs_file_opencfg(&bench_lfs, &file, "bench.bin",
+                   LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC, &bench_file_cfg);
+  lfs_file_write(&bench_lfs, &file, lfs_data, sizeof(lfs_data));
+  lfs_file_close(&bench_lfs, &file);
+}
+
+static void lfs_setup(void *arg) {
+  (void)arg;
+  for (uint16_t i = 0; i < BENCH_LFS_FILE_SIZE; i++) lfs_data[i] = i ^ (i >> 8);
+  memset(ram_disk, 0xff, sizeof(ram_disk));
+  lfs_format(&bench_lfs, &bench_lfs_cfg);
+  lfs_mount(&bench_lfs, &bench_lfs_cfg);
+  lfs_write_file();
+}
+
+static void lfs_teardown(void *arg) {
+  (void)arg;
+  lfs_unmount(&bench_lfs);
+}
+
+static void bench_lfs_write(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    lfs_write_file();
+  }
+}
+
+static void bench_lfs_read(uint32_t iters, void *arg) {
+  (void)arg;
+  lfs_file_t file;
+  while (iters--) {
+    lfs_file_opencfg(&bench_lfs, &file, "bench.bin", LFS_O_RDONLY,
+                     &bench_file_cfg);
+    lfs_file_read(&bench_lfs, &file, lfs_data, sizeof(lfs_data));
+    lfs_file_close(&bench_lfs, &file);
+  }
+}
+
+// Exported Variables -----------------------
+
+static const bench_case_t storage_cases[] = {
+    BENCH_CASE_EX("littlefs/write_4k", bench_lfs_write, lfs_setup,
+                  lfs_teardown, NULL, BENCH_LFS_FILE_SIZE, "B"),
+    BENCH_CASE_EX("littlefs/read_4k", bench_lfs_read, lfs_setup, lfs_teardown,
+                  NULL, BENCH_LFS_FILE_SIZE, "B"),
+};
+
+const bench_group_t bench_group_storage = BENCH_GROUP("storage", storage_cases);
+
+#endif  // BENCH_CFG_GROUP_STORAGE
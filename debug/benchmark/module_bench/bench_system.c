@@ -0,0 +1,188 @@
+/**
+ * @file bench_system.c
+ * @brief 系统模块基准测试用例(scheduler/lwmem)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "bench.h"
+
+#if BENCH_CFG_GROUP_SYSTEM
+#include "lwmem.h"
+#include "scheduler.h"
+
+// Private Defines --------------------------
+
+#define BENCH_SCH_TASKS 8      // 多任务调度用例的任务数
+#define BENCH_LWMEM_SIZE 8192  // lwmem测试堆大小
+#define BENCH_LWMEM_SLOTS 16   // 混合分配用例同时存活的块数
+
+/* scheduler --------------------------------------------------------------- */
+
+#if SCH_CFG_ENABLE_TASK
+#include "scheduler_task.h"
+
+static volatile uint32_t sch_counter;
+static char sch_names[BENCH_SCH_TASKS][12];
+
+static void sch_dummy_task(void *args) {
+  (void)args;
+  sch_counter++;
+}
+
+static void sch_task_setup(void *arg) {
+  uint8_t num = (uint8_t)(uintptr_t)arg;
+  for (uint8_t i = 0; i < num; i++) {
+    snprintf(sch_names[i], sizeof(sch_names[i]), "bench%u", i);
+    // 频率足够高, 使每次Scheduler_Run都会调度任务
+    Sch_CreateTask(sch_names[i], sch_dummy_task, 1e9f, 1, i, NULL);
+  }
+}
+
+static void sch_task_teardown(void *arg) {
+  uint8_t num = (uint8_t)(uintptr_t)arg;
+  for (uint8_t i = 0; i < num; i++) {
+    Sch_DeleteTask(sch_names[i]);
+  }
+}
+
+static void bench_sch_dispatch(uint32_t iters, void *arg) {
+  (void)arg;
+  while (iters--) {
+    Scheduler_Run(0);
+  }
+}
+
+// scheduler_task.c在不同调试配置下的副本, 见bench_sch_task.c和CMakeLists.txt
+#define SCH_BENCH_VARIANT(_p)                                              \
+  extern uint64_t _p##Task_Runner(void);                                   \
+  extern uint8_t _p##Sch_CreateTask(const char *name, task_func_t func,    \
+                                    float freqHz, uint8_t enable,          \
+                                    uint8_t priority, void *args);         \
+  extern uint8_t _p##Sch_DeleteTask(const char *name);                     \
+  extern const size_t _p##task_size;
+
+SCH_BENCH_VARIANT(sch_off_)
+SCH_BENCH_VARIANT(sch_full_)
+SCH_BENCH_VARIANT(sch_hist_)
+SCH_BENCH_VARIANT(sch_s4_)
+
+enum {  // 任务调试统计配置
+  SCH_DBG_OFF,   // 不统计
+  SCH_DBG_FULL,  // 每次调度都统计
+  SCH_DBG_HIST,  // 同上, 加延迟直方图
+  SCH_DBG_S4,    // 每16次调度统计一次
+};
+
+static const struct {
+  uint64_t (*run)(void);
+  uint8_t (*create)(const char *, task_func_t, float, uint8_t, uint8_t,
+                    void *);
+  uint8_t (*del)(const char *);
+  const size_t *size;
+} sch_variants[] = {
+#define SCH_BENCH_ENTRY(_p) \
+  {_p##Task_Runner, _p##Sch_CreateTask, _p##Sch_DeleteTask, &_p##task_size}
+    [SCH_DBG_OFF] = SCH_BENCH_ENTRY(sch_off_),
+    [SCH_DBG_FULL] = SCH_BENCH_ENTRY(sch_full_),
+    [SCH_DBG_HIST] = SCH_BENCH_ENTRY(sch_hist_),
+    [SCH_DBG_S4] = SCH_BENCH_ENTRY(sch_s4_),
+#undef SCH_BENCH_ENTRY
+};
+
+static void sch_debug_setup(void *arg) {
+  uint8_t v = (uint8_t)(uintptr_t)arg;
+  sch_variants[v].create("bench", sch_dummy_task, 1e9f, 1, 0, NULL);
+  Bench_SetExtra(*sch_variants[v].size, "B/task");
+}
+
+static void sch_debug_teardown(void *arg) {
+  sch_variants[(uintptr_t)arg].del("bench");
+}
+
+static void bench_sch_debug(uint32_t iters, void *arg) {
+  uint64_t (*run)(void) = sch_variants[(uintptr_t)arg].run;
+  while (iters--) {
+    run();
+  }
+}
+#endif  // SCH_CFG_ENABLE_TASK
+
+/* lwmem ------------------------------------------------------------------- */
+
+static lwmem_t bench_lwmem;  // 独立实例, 不影响系统堆
+static uint8_t lwmem_heap[BENCH_LWMEM_SIZE] __ALIGNED(8);
+static void *lwmem_slots[BENCH_LWMEM_SLOTS];
+
+static void lwmem_setup(void *arg) {
+  (void)arg;
+  static uint8_t assigned = 0;
+  if (assigned) return;
+  const lwmem_region_t regions[] = {{lwmem_heap, sizeof(lwmem_heap)},
+                                    {NULL, 0}};
+  lwmem_assignmem_ex(&bench_lwmem, regions);
+  assigned = 1;
+}
+
+static void lwmem_teardown(void *arg) {
+  (void)arg;
+  for (uint8_t i = 0; i < BENCH_LWMEM_SLOTS; i++) {
+    lwmem_free_s_ex(&bench_lwmem, &lwmem_slots[i]);
+  }
+}
+
+static void bench_lwmem_fixed(uint32_t iters, void *arg) {
+  size_t size = (size_t)(uintptr_t)arg;
+  while (iters--) {
+    void *p = lwmem_malloc_ex(&bench_lwmem, NULL, size);
+    BENCH_KEEP(p);
+    lwmem_free_ex(&bench_lwmem, p);
+  }
+}
+
+static void bench_lwmem_mixed(uint32_t iters, void *arg) {
+  (void)arg;
+  uint32_t seed = 0x9e3779b9;
+  while (iters--) {  // 随机槽位释放并重新申请随机大小, 模拟碎片化负载
+    seed = seed * 1664525 + 1013904223;
+    uint8_t slot = (seed >> 24) % BENCH_LWMEM_SLOTS;
+    lwmem_free_s_ex(&bench_lwmem, &lwmem_slots[slot]);
+    lwmem_slots[slot] =
+        lwmem_malloc_ex(&bench_lwmem, NULL, 8 + ((seed >> 8) & 0x1ff));
+  }
+}
+
+// Exported Variables -----------------------
+
+static const bench_case_t system_cases[] = {
+#if SCH_CFG_ENABLE_TASK
+    BENCH_CASE_EX("scheduler/task_dispatch", bench_sch_dispatch,
+                  sch_task_setup, sch_task_teardown, (void *)1, 1, "op"),
+    BENCH_CASE_EX("scheduler/task_dispatch_8", bench_sch_dispatch,
+                  sch_task_setup, sch_task_teardown,
+                  (void *)BENCH_SCH_TASKS, 1, "op"),
+    BENCH_CASE_EX("scheduler/task_runner_debug_off", bench_sch_debug,
+                  sch_debug_setup, sch_debug_teardown, (void *)SCH_DBG_OFF, 1,
+                  "op"),
+    BENCH_CASE_EX("scheduler/task_runner_debug_full", bench_sch_debug,
+                  sch_debug_setup, sch_debug_teardown, (void *)SCH_DBG_FULL,
+                  1, "op"),
+    BENCH_CASE_EX("scheduler/task_runner_debug_hist", bench_sch_debug,
+                  sch_debug_setup, sch_debug_teardown, (void *)SCH_DBG_HIST,
+                  1, "op"),
+    BENCH_CASE_EX("scheduler/task_runner_debug_s4", bench_sch_debug,
+                  sch_debug_setup, sch_debug_teardown, (void *)SCH_DBG_S4, 1,
+                  "op"),
+#endif
+    BENCH_CASE_EX("lwmem/alloc_free_64", bench_lwmem_fixed, lwmem_setup,
+                  NULL, (void *)64, 1, "op"),
+    BENCH_CASE_EX("lwmem/alloc_free_mixed", bench_lwmem_mixed, lwmem_setup,
+                  lwmem_teardown, NULL, 1, "op"),
+};
+
+const bench_group_t bench_group_system = BENCH_GROUP("system", system_cases);
+
+#endif  // BENCH_CFG_GROUP_SYSTEM
@@ -0,0 +1,26 @@
+/**
+ * @file cmsis_ref.h
+ * @brief CMSIS-DSP通用C内核的重命名(cmsis_dsp_ref库以-include引入)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-18
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __CMSIS_REF_H__
+#define __CMSIS_REF_H__
+
+// 不定义ARM_MATH_X86_SIMD编译的内核加ref_前缀, 与modules_host中的SIMD版本
+// 链接到同一程序, 基准测试以此比较两者
+#define arm_dot_prod_f32 ref_arm_dot_prod_f32
+#define arm_fir_f32 ref_arm_fir_f32
+#define arm_biquad_cascade_df1_f32 ref_arm_biquad_cascade_df1_f32
+#define arm_cmplx_mult_cmplx_f32 ref_arm_cmplx_mult_cmplx_f32
+#define arm_mat_mult_f32 ref_arm_mat_mult_f32
+#define arm_cfft_f32 ref_arm_cfft_f32
+#define arm_cfft_radix8by2_f32 ref_arm_cfft_radix8by2_f32
+#define arm_cfft_radix8by4_f32 ref_arm_cfft_radix8by4_f32
+#define arm_radix8_butterfly_f32 ref_arm_radix8_butterfly_f32
+
+#endif  // __CMSIS_REF_H__
@@ -0,0 +1,58 @@
+import argparse
+import json
+import sys
+
+C_RED = "\033[31m"
+C_GREEN = "\033[32m"
+C_BLUE = "\033[34m"
+C_RESET = "\033[0m"
+
+
+def load(path):
+    with open(path, "r", encoding="utf-8") as f:
+        data = json.load(f)
+    return {r["name"]: r for r in data["results"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare two module_bench JSON results"
+    )
+    parser.add_argument("base", help="baseline result json")
+    parser.add_argument("new", help="new result json")
+    parser.add_argument(
+        "-t",
+        "--threshold",
+        type=float,
+        default=5.0,
+        help="regression threshold in percent, default is 5",
+    )
+    args = parser.parse_args()
+
+    base = load(args.base)
+    new = load(args.new)
+    regressions = 0
+    print(f"{C_BLUE}{'case':<32} {'base ns':>12} {'new ns':>12} {'delta':>9}{C_RESET}")
+    for name, r in new.items():
+        if name not in base:
+            print(f"{name:<32} {'-':>12} {r['ns_per_iter']:>12.2f} {'new':>9}")
+            continue
+        b = base[name]["ns_per_iter"]
+        n = r["ns_per_iter"]
+        delta = (n - b) / b * 100 if b > 0 else 0.0
+        color = ""
+        if delta > args.threshold:
+            color = C_RED
+            regressions += 1
+        elif delta < -args.threshold:
+            color = C_GREEN
+        print(f"{color}{name:<32} {b:>12.2f} {n:>12.2f} {delta:>+8.1f}%{C_RESET}")
+    for name in base:
+        if name not in new:
+            print(f"{name:<32} {base[name]['ns_per_iter']:>12.2f} {'-':>12} {'removed':>9}")
+    # 有回归时返回非0, 便于在脚本中使用
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
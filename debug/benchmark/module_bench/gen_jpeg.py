@@ -0,0 +1,317 @@
+"""Generate the baseline JPEG test images of module_bench as a C header.
+
+Pure Python, no dependencies. The images are synthetic (gradients, shapes
+and noise) so they can be reproduced and redistributed. Huffman tables are
+optimized for each image (JPEG Annex K.2).
+
+python debug/benchmark/module_bench/gen_jpeg.py -o debug/benchmark/module_bench/bench_jpeg.h
+"""
+
+import argparse
+import math
+import random
+
+ZIGZAG = sorted(
+    range(64),
+    key=lambda i: (
+        i // 8 + i % 8,
+        (i % 8) if (i // 8 + i % 8) % 2 == 0 else (i // 8),
+    ),
+)
+
+QT_LUMA = [
+    16, 11, 10, 16, 24, 40, 51, 61,
+    12, 12, 14, 19, 26, 58, 60, 55,
+    14, 13, 16, 24, 40, 57, 69, 56,
+    14, 17, 22, 29, 51, 87, 80, 62,
+    18, 22, 37, 56, 68, 109, 103, 77,
+    24, 35, 55, 64, 81, 104, 113, 92,
+    49, 64, 78, 87, 103, 121, 120, 101,
+    72, 92, 95, 98, 112, 100, 103, 99,
+]  # fmt: skip
+
+QT_CHROMA = [
+    17, 18, 24, 47, 99, 99, 99, 99,
+    18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99,
+    47, 66, 99, 99, 99, 99, 99, 99,
+] + [99] * 32  # fmt: skip
+
+COS = [
+    [math.cos((2 * x + 1) * u * math.pi / 16) for x in range(8)] for u in range(8)
+]
+
+
+def scale_qt(table, quality):
+    s = 5000 // quality if quality < 50 else 200 - 2 * quality
+    return [min(255, max(1, (t * s + 50) // 100)) for t in table]
+
+
+def fdct(block):
+    # separable 2D DCT-II of an 8x8 block (row major, level shifted)
+    tmp = [0.0] * 64
+    for y in range(8):
+        row = block[y * 8 : y * 8 + 8]
+        for u in range(8):
+            tmp[y * 8 + u] = sum(row[x] * COS[u][x] for x in range(8))
+    out = [0.0] * 64
+    for u in range(8):
+        cu = math.sqrt(0.5) if u == 0 else 1.0
+        for v in range(8):
+            cv = math.sqrt(0.5) if v == 0 else 1.0
+            s = sum(tmp[y * 8 + u] * COS[v][y] for y in range(8))
+            out[v * 8 + u] = 0.25 * cu * cv * s
+    return out
+
+
+def synth_image(w, h, seed):
+    # smooth background, a few shapes and some texture, like a small photo
+    rnd = random.Random(seed)
+    shapes = [
+        (rnd.uniform(0, w), rnd.uniform(0, h), rnd.uniform(12, w / 4),
+         [rnd.randint(0, 255) for _ in range(3)])
+        for _ in range(12)
+    ]  # fmt: skip
+    pixels = []
+    for y in range(h):
+        for x in range(w):
+            r = 40 + 160 * x / w
+            g = 60 + 120 * y / h
+            b = 128 + 100 * math.sin((x + y) / 37.0)
+            for cx, cy, cr, col in shapes:
+                if (x - cx) ** 2 + (y - cy) ** 2 < cr * cr:
+                    r, g, b = col
+            n = rnd.uniform(-12, 12)
+            pixels.append(tuple(min(255, max(0, int(c + n))) for c in (r, g, b)))
+    return pixels
+
+
+def to_ycc(pixels):
+    ycc = []
+    for r, g, b in pixels:
+        y = 0.299 * r + 0.587 * g + 0.114 * b
+        cb = -0.1687 * r - 0.3313 * g + 0.5 * b + 128
+        cr = 0.5 * r - 0.4187 * g - 0.0813 * b + 128
+        ycc.append((y, cb, cr))
+    return ycc
+
+
+def huff_table(freq):
+    # code lengths limited to 16 bits, JPEG Annex K.2
+    freq = list(freq) + [1]  # reserved symbol, no code consists of all ones
+    size = [0] * 257
+    others = [-1] * 257
+    while True:
+        live = [i for i in range(257) if freq[i] > 0]
+        if len(live) < 2:
+            break
+        live.sort(key=lambda i: (freq[i], -i))
+        v1, v2 = live[0], live[1]
+        freq[v1] += freq[v2]
+        freq[v2] = 0
+        for v in (v1, v2):
+            size[v] += 1
+            while others[v] != -1:
+                v = others[v]
+                size[v] += 1
+        while others[v1] != -1:
+            v1 = others[v1]
+        others[v1] = v2
+    bits = [0] * 33
+    for s in size:
+        if s:
+            bits[s] += 1
+    for i in range(32, 16, -1):
+        while bits[i] > 0:
+            j = i - 2
+            while bits[j] == 0:
+                j -= 1
+            bits[i] -= 2
+            bits[i - 1] += 1
+            bits[j + 1] += 2
+            bits[j] -= 1
+    i = 16
+    while bits[i] == 0:
+        i -= 1
+    bits[i] -= 1
+    # the adjusted lengths are assigned in order of frequency
+    vals = sorted((i for i in range(256) if size[i]), key=lambda i: (size[i], i))
+    codes = {}
+    code = 0
+    k = 0
+    for n in range(1, 17):
+        for _ in range(bits[n]):
+            codes[vals[k]] = (code, n)
+            code += 1
+            k += 1
+        code <<= 1
+    return bits[1:17], vals, codes
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def write(self, value, n):
+        for i in range(n - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.n += 1
+            if self.n == 8:
+                self.out.append(self.acc)
+                if self.acc == 0xFF:
+                    self.out.append(0)  # byte stuffing
+                self.acc = 0
+                self.n = 0
+
+    def flush(self):
+        if self.n:
+            self.write((1 << (8 - self.n)) - 1, 8 - self.n)
+
+
+def category(v):
+    v = abs(v)
+    n = 0
+    while v:
+        n += 1
+        v >>= 1
+    return n
+
+
+def block_symbols(coef, prev_dc):
+    # [(table, symbol, extra bits, extra bit count)] of a quantized block
+    syms = []
+    diff = coef[0] - prev_dc
+    s = category(diff)
+    syms.append(("dc", s, diff if diff >= 0 else diff - 1 + (1 << s), s))
+    run = 0
+    for k in range(1, 64):
+        v = coef[k]
+        if v == 0:
+            run += 1
+            continue
+        while run > 15:
+            syms.append(("ac", 0xF0, 0, 0))
+            run -= 16
+        s = category(v)
+        syms.append(("ac", (run << 4) | s, v if v >= 0 else v - 1 + (1 << s), s))
+        run = 0
+    if run:
+        syms.append(("ac", 0x00, 0, 0))
+    return syms
+
+
+def encode(pixels, w, h, quality, subsample):
+    hs = 2 if subsample else 1  # luma blocks per MCU side
+    mcu = 8 * hs
+    qts = [scale_qt(QT_LUMA, quality), scale_qt(QT_CHROMA, quality)]
+    ycc = to_ycc(pixels)
+
+    def px(c, x, y):
+        return ycc[min(y, h - 1) * w + min(x, w - 1)][c]
+
+    def block(c, bx, by, step):
+        out = []
+        for y in range(8):
+            for x in range(8):
+                if step == 1:
+                    v = px(c, bx + x, by + y)
+                else:  # average step x step pixels for the subsampled chroma
+                    v = sum(
+                        px(c, bx + x * step + i, by + y * step + j)
+                        for i in range(step)
+                        for j in range(step)
+                    ) / (step * step)
+                out.append(v - 128)
+        return out
+
+    def quantize(b, qt):
+        f = fdct(b)
+        return [int(round(f[ZIGZAG[k]] / qt[ZIGZAG[k]])) for k in range(64)]
+
+    # (component, quantized zigzag coefficients) in MCU order
+    blocks = []
+    for my in range(0, h, mcu):
+        for mx in range(0, w, mcu):
+            for j in range(hs):
+                for i in range(hs):
+                    blocks.append((0, quantize(block(0, mx + i * 8, my + j * 8, 1), qts[0])))
+            for c in (1, 2):
+                blocks.append((c, quantize(block(c, mx, my, hs), qts[1])))
+
+    syms = []
+    prev = [0, 0, 0]
+    for c, coef in blocks:
+        for table, sym, extra, n in block_symbols(coef, prev[c]):
+            syms.append((0 if c == 0 else 1, table, sym, extra, n))
+        prev[c] = coef[0]
+
+    tables = {}
+    for tid in (0, 1):
+        for table in ("dc", "ac"):
+            freq = [0] * 256
+            for t, tb, sym, _, _ in syms:
+                if t == tid and tb == table:
+                    freq[sym] += 1
+            tables[(tid, table)] = huff_table(freq)
+
+    bw = BitWriter()
+    for tid, table, sym, extra, n in syms:
+        code, length = tables[(tid, table)][2][sym]
+        bw.write(code, length)
+        if n:
+            bw.write(extra, n)
+    bw.flush()
+
+    def segment(marker, payload):
+        return bytes([0xFF, marker, (len(payload) + 2) >> 8, (len(payload) + 2) & 0xFF]) + payload
+
+    out = bytearray(b"\xff\xd8")
+    for tid, qt in enumerate(qts):
+        out += segment(0xDB, bytes([tid] + [qt[ZIGZAG[k]] for k in range(64)]))
+    sof = bytes([8, h >> 8, h & 0xFF, w >> 8, w & 0xFF, 3])
+    sof += bytes([1, (hs << 4) | hs, 0, 2, 0x11, 1, 3, 0x11, 1])
+    out += segment(0xC0, sof)
+    for tid in (0, 1):
+        for cls, table in ((0, "dc"), (1, "ac")):
+            bits, vals, _ = tables[(tid, table)]
+            out += segment(0xC4, bytes([(cls << 4) | tid] + bits + vals))
+    out += segment(0xDA, bytes([3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0]))
+    out += bw.out
+    out += b"\xff\xd9"
+    return bytes(out)
+
+
+def write_array(f, name, data):
+    f.write(f"static const uint8_t {name}[] = {{\n")
+    for i in range(0, len(data), 12):
+        f.write("    " + ", ".join(f"0x{b:02x}" for b in data[i : i + 12]) + ",\n")
+    f.write("};\n\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate module_bench JPEG images")
+    parser.add_argument("-o", "--output", default="bench_jpeg.h", help="output header")
+    parser.add_argument("-s", "--size", type=int, default=240, help="image size")
+    parser.add_argument("-q", "--quality", type=int, default=80, help="quality 1-100")
+    args = parser.parse_args()
+
+    pixels = synth_image(args.size, args.size, 1)
+    images = [
+        ("bench_jpeg_420", encode(pixels, args.size, args.size, args.quality, True)),
+        ("bench_jpeg_444", encode(pixels, args.size, args.size, args.quality, False)),
+    ]
+    with open(args.output, "w") as f:
+        f.write("// Generated by gen_jpeg.py, do not edit\n")
+        f.write(f"// {args.size}x{args.size} baseline JPEG, quality {args.quality}\n\n")
+        f.write("#pragma once\n\n#include <stdint.h>\n\n")
+        for name, data in images:
+            write_array(f, name, data)
+        f.write(f"#define BENCH_JPEG_SIZE {args.size}\n")
+    for name, data in images:
+        print(f"{name}: {len(data)} bytes")
+
+
+if __name__ == "__main__":
+    main()
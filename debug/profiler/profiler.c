@@ -0,0 +1,426 @@
+/**
+ * @file profiler.c
+ * @brief 基于插桩的函数级性能分析器(调用图统计)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-20
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "profiler.h"
+
+#if PROF_CFG_ENABLE
+#include "log.h"
+#include "term_table.h"
+
+// Private Defines --------------------------
+
+#define PROF_INVALID 0xFFFF
+
+#if PROF_CFG_MAX_SITES <= 32
+#define PROF_SITE_HASH_BITS 6
+#elif PROF_CFG_MAX_SITES <= 64
+#define PROF_SITE_HASH_BITS 7
+#elif PROF_CFG_MAX_SITES <= 128
+#define PROF_SITE_HASH_BITS 8
+#elif PROF_CFG_MAX_SITES <= 256
+#define PROF_SITE_HASH_BITS 9
+#elif PROF_CFG_MAX_SITES <= 512
+#define PROF_SITE_HASH_BITS 10
+#else
+#define PROF_SITE_HASH_BITS 11
+#endif
+#define PROF_SITE_HASH_SIZE (1UL << PROF_SITE_HASH_BITS)
+
+#if PROF_CFG_MAX_EDGES <= 64
+#define PROF_EDGE_HASH_BITS 7
+#elif PROF_CFG_MAX_EDGES <= 256
+#define PROF_EDGE_HASH_BITS 9
+#elif PROF_CFG_MAX_EDGES <= 1024
+#define PROF_EDGE_HASH_BITS 11
+#else
+#define PROF_EDGE_HASH_BITS 13
+#endif
+#define PROF_EDGE_HASH_SIZE (1UL << PROF_EDGE_HASH_BITS)
+
+// Private Typedefs -------------------------
+
+typedef struct {       // 影子调用栈帧
+  uint16_t site;       // 调用点索引
+  uint16_t edge;       // 调用图边索引
+  prof_tick_t enter;   // 进入探针的时刻(含探针开销)
+  prof_tick_t start;   // 开始计时的时刻
+  prof_tick_t child;   // 子调用耗时总和
+} prof_frame_t;
+
+// Private Variables ------------------------
+
+static prof_site_t sites[PROF_CFG_MAX_SITES];
+static uint16_t site_hash[PROF_SITE_HASH_SIZE];
+static uint16_t site_num = 0;
+#if PROF_CFG_MAX_EDGES
+static prof_edge_t edges[PROF_CFG_MAX_EDGES];
+static uint16_t edge_hash[PROF_EDGE_HASH_SIZE];
+static uint16_t edge_num = 0;
+#endif
+static prof_frame_t stack[PROF_CFG_MAX_DEPTH];
+static uint16_t depth = 0;
+static uint32_t dropped = 0;  // 因表满或栈溢出未记录的调用
+static uint8_t enabled = 1;
+static uint8_t inited = 0;
+
+// Private Functions ------------------------
+
+static inline _PROF_NO_INSTR uint32_t hash_ptr(const void *p, uint8_t bits) {
+  uint32_t h = (uint32_t)(uintptr_t)p;
+#if UINTPTR_MAX > UINT32_MAX
+  h ^= (uint32_t)((uintptr_t)p >> 32);
+#endif
+  return (h * 2654435761U) >> (32 - bits);  // Fibonacci hashing
+}
+
+static _PROF_NO_INSTR void prof_init(void) {
+  memset(site_hash, 0xFF, sizeof(site_hash));
+#if PROF_CFG_MAX_EDGES
+  memset(edge_hash, 0xFF, sizeof(edge_hash));
+#endif
+  inited = 1;
+}
+
+static _PROF_NO_INSTR uint16_t find_site(const void *key, const char *name) {
+  uint32_t h = hash_ptr(key, PROF_SITE_HASH_BITS);
+  while (site_hash[h] != PROF_INVALID) {
+    if (sites[site_hash[h]].key == key) return site_hash[h];
+    h = (h + 1) & (PROF_SITE_HASH_SIZE - 1);
+  }
+  if (site_num >= PROF_CFG_MAX_SITES) return PROF_INVALID;
+  prof_site_t *site = &sites[site_num];
+  memset(site, 0, sizeof(prof_site_t));
+  site->key = key;
+  site->name = name;
+  site_hash[h] = site_num;
+  return site_num++;
+}
+
+#if PROF_CFG_MAX_EDGES
+static _PROF_NO_INSTR uint16_t find_edge(uint16_t caller, uint16_t callee) {
+  uint32_t key = ((uint32_t)caller << 16) | callee;
+  uint32_t h = (key * 2654435761U) >> (32 - PROF_EDGE_HASH_BITS);
+  while (edge_hash[h] != PROF_INVALID) {
+    prof_edge_t *e = &edges[edge_hash[h]];
+    if (e->caller == caller && e->callee == callee) return edge_hash[h];
+    h = (h + 1) & (PROF_EDGE_HASH_SIZE - 1);
+  }
+  if (edge_num >= PROF_CFG_MAX_EDGES) return PROF_INVALID;
+  prof_edge_t *e = &edges[edge_num];
+  e->caller = caller;
+  e->callee = callee;
+  e->calls = 0;
+  e->incl = 0;
+  edge_hash[h] = edge_num;
+  return edge_num++;
+}
+#endif
+
+// Public Functions -------------------------
+
+_PROF_NO_INSTR void Prof_Enter(const void *key, const char *name) {
+  prof_tick_t now = prof_get_tick();
+  if (depth >= PROF_CFG_MAX_DEPTH) {
+    depth++;  // 仅计数以保持Enter/Exit配对
+    dropped++;
+    return;
+  }
+  prof_frame_t *frame = &stack[depth++];
+  frame->site = PROF_INVALID;
+  if (!enabled) return;
+  if (!inited) prof_init();
+  frame->site = find_site(key, name);
+  if (frame->site == PROF_INVALID) {
+    dropped++;
+    return;
+  }
+  frame->edge = PROF_INVALID;
+#if PROF_CFG_MAX_EDGES
+  if (depth > 1 && stack[depth - 2].site != PROF_INVALID)
+    frame->edge = find_edge(stack[depth - 2].site, frame->site);
+#endif
+  sites[frame->site].active++;
+  frame->child = 0;
+  frame->enter = now;
+  frame->start = prof_get_tick();  // 排除查表开销
+}
+
+_PROF_NO_INSTR void Prof_Exit(void) {
+  prof_tick_t now = prof_get_tick();
+  if (!depth) return;
+  depth--;
+  if (depth >= PROF_CFG_MAX_DEPTH) return;
+  prof_frame_t *frame = &stack[depth];
+  if (frame->site == PROF_INVALID) return;
+  prof_tick_t dur = now - frame->start;
+  prof_site_t *site = &sites[frame->site];
+  site->calls++;
+  if (!--site->active) site->incl += dur;  // 递归调用只统计最外层
+  site->excl += dur - frame->child;
+  if (dur > site->max) site->max = dur;
+#if PROF_CFG_MAX_EDGES
+  if (frame->edge != PROF_INVALID) {
+    edges[frame->edge].calls++;
+    edges[frame->edge].incl += dur;
+  }
+#endif
+  if (depth && stack[depth - 1].site != PROF_INVALID) {
+    // 探针自身开销计入子调用, 保证父调用点的自身耗时不受插桩影响
+    stack[depth - 1].child += prof_get_tick() - frame->enter;
+  }
+}
+
+void Prof_Reset(void) {
+  prof_init();
+  site_num = 0;
+#if PROF_CFG_MAX_EDGES
+  edge_num = 0;
+#endif
+  depth = 0;
+  dropped = 0;
+}
+
+void Prof_SetEnabled(uint8_t enable) { enabled = enable; }
+
+const prof_site_t *Prof_GetSites(uint16_t *num) {
+  if (num) *num = site_num;
+  return sites;
+}
+
+const prof_edge_t *Prof_GetEdges(uint16_t *num) {
+#if PROF_CFG_MAX_EDGES
+  if (num) *num = edge_num;
+  return edges;
+#else
+  if (num) *num = 0;
+  return NULL;
+#endif
+}
+
+uint64_t Prof_GetFreq(void) {
+#if PROF_CFG_CLOCK_MONOTONIC
+  return 1000000000;
+#elif PROF_CFG_CLOCK_RDTSC
+  static uint64_t freq = 0;
+  if (!freq) {  // 以CLOCK_MONOTONIC为基准校准10ms
+    struct timespec ts0, ts1;
+    clock_gettime(CLOCK_MONOTONIC, &ts0);
+    uint64_t t0 = __rdtsc();
+    do {
+      clock_gettime(CLOCK_MONOTONIC, &ts1);
+    } while ((ts1.tv_sec - ts0.tv_sec) * 1000000000 + ts1.tv_nsec -
+                 ts0.tv_nsec <
+             10000000);
+    uint64_t t1 = __rdtsc();
+    uint64_t ns = (ts1.tv_sec - ts0.tv_sec) * 1000000000 + ts1.tv_nsec -
+                  ts0.tv_nsec;
+    freq = (t1 - t0) * 1000000000 / ns;
+  }
+  return freq;
+#else
+  return SystemCoreClock;
+#endif
+}
+
+double Prof_TickToUs(prof_tick_t tick) {
+  return (double)tick * 1000000.0 / (double)Prof_GetFreq();
+}
+
+#if PROF_CFG_INSTRUMENT_FUNCTIONS
+_PROF_NO_INSTR void __cyg_profile_func_enter(void *fn, void *call_site) {
+  (void)call_site;
+  Prof_Enter(fn, NULL);
+}
+
+_PROF_NO_INSTR void __cyg_profile_func_exit(void *fn, void *call_site) {
+  (void)fn;
+  (void)call_site;
+  Prof_Exit();
+}
+#endif  // PROF_CFG_INSTRUMENT_FUNCTIONS
+
+static prof_sort_t sort_mode;
+
+static int site_cmp(const void *a, const void *b) {
+  const prof_site_t *sa = &sites[*(const uint16_t *)a];
+  const prof_site_t *sb = &sites[*(const uint16_t *)b];
+  int64_t d;
+  switch (sort_mode) {
+    case PROF_SORT_INCL:
+      d = sb->incl - sa->incl;
+      break;
+    case PROF_SORT_CALLS:
+      d = (int64_t)sb->calls - sa->calls;
+      break;
+    default:
+      d = sb->excl - sa->excl;
+      break;
+  }
+  return d > 0 ? 1 : (d < 0 ? -1 : 0);
+}
+
+static TT_STR site_name(TT_ALIGN al, TT_FMT1 f1, TT_FMT2 f2, uint16_t idx) {
+  if (sites[idx].name) return TT_FmtStr(al, f1, f2, "%s", sites[idx].name);
+  return TT_FmtStr(al, f1, f2, "%p", sites[idx].key);
+}
+
+void Prof_Print(prof_sort_t sort, uint16_t max_line, uint8_t graph) {
+  uint16_t num = site_num;
+  if (!num) {
+    LOG_RAWLN(T_FMT(T_BOLD, T_YELLOW) "Profiler: no data" T_RST);
+    return;
+  }
+  uint16_t *order = m_alloc(num * sizeof(uint16_t));
+  if (!order) return;
+  prof_tick_t total = 0;
+  for (uint16_t i = 0; i < num; i++) {
+    order[i] = i;
+    total += sites[i].excl;
+  }
+  sort_mode = sort;
+  qsort(order, num, sizeof(uint16_t), site_cmp);
+  if (!max_line || max_line > num) max_line = num;
+
+  TT tt = TT_NewTable(-1);
+  TT_FMT1 f1 = TT_FMT1_BLUE;
+  TT_FMT2 f2 = TT_FMT2_BOLD;
+  TT_ALIGN al = TT_ALIGN_LEFT;
+  TT_AddTitle(tt,
+              TT_FmtStr(al, f1, f2, "[ Profiler Report / %d sites ]", num),
+              '-');
+  TT_ITEM_GRID grid = TT_AddGrid(tt, 0);
+  TT_ITEM_GRID_LINE line =
+      TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
+  const char *head[] = {"No",      "Calls",   "Incl(us)", "Excl(us)",
+                        "Avg(us)", "Max(us)", "Excl%",    "Name"};
+  for (size_t i = 0; i < sizeof(head) / sizeof(char *); i++)
+    TT_GridLine_AddItem(line, TT_Str(al, f1, f2, head[i]));
+  for (uint16_t i = 0; i < max_line; i++) {
+    prof_site_t *s = &sites[order[i]];
+    f1 = TT_FMT1_GREEN;
+    f2 = TT_FMT2_NONE;
+    line = TT_Grid_AddLine(grid, TT_Str(al, f1, f2, " "));
+    float pct = total ? (float)s->excl / total * 100 : 0;
+    TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%d", i));
+    TT_GridLine_AddItem(
+        line, TT_FmtStr(al, f1, f2, "%lu", (unsigned long)s->calls));
+    TT_GridLine_AddItem(line,
+                        TT_FmtStr(al, f1, f2, "%.2f", Prof_TickToUs(s->incl)));
+    if (pct > 20) {  // 热点函数
+      f1 = TT_FMT1_YELLOW;
+      f2 = TT_FMT2_BOLD;
+    }
+    TT_GridLine_AddItem(line,
+                        TT_FmtStr(al, f1, f2, "%.2f", Prof_TickToUs(s->excl)));
+    f1 = TT_FMT1_GREEN;
+    f2 = TT_FMT2_NONE;
+    TT_GridLine_AddItem(
+        line, TT_FmtStr(al, f1, f2, "%.3f",
+                        s->calls ? Prof_TickToUs(s->incl) / s->calls : 0));
+    TT_GridLine_AddItem(line,
+                        TT_FmtStr(al, f1, f2, "%.2f", Prof_TickToUs(s->max)));
+    TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%.2f", pct));
+    TT_GridLine_AddItem(line, site_name(al, f1, f2, order[i]));
+  }
+  if (max_line < num) {
+    TT_AddString(tt, TT_Str(TT_ALIGN_CENTER, TT_FMT1_NONE, TT_FMT2_NONE, "..."),
+                 0);
+  }
+  m_free(order);
+
+#if PROF_CFG_MAX_EDGES
+  if (graph && edge_num) {
+    f1 = TT_FMT1_BLUE;
+    f2 = TT_FMT2_BOLD;
+    TT_AddTitle(
+        tt, TT_FmtStr(al, f1, f2, "[ Call Graph / %d edges ]", edge_num),
+        '-');
+    grid = TT_AddGrid(tt, 0);
+    line = TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
+    const char *head2[] = {"Caller", "Callee", "Calls", "Incl(us)"};
+    for (size_t i = 0; i < sizeof(head2) / sizeof(char *); i++)
+      TT_GridLine_AddItem(line, TT_Str(al, f1, f2, head2[i]));
+    f1 = TT_FMT1_GREEN;
+    f2 = TT_FMT2_NONE;
+    for (uint16_t i = 0; i < edge_num; i++) {
+      prof_edge_t *e = &edges[i];
+      line = TT_Grid_AddLine(grid, TT_Str(al, f1, f2, " "));
+      TT_GridLine_AddItem(line, site_name(al, f1, f2, e->caller));
+      TT_GridLine_AddItem(line, site_name(al, f1, f2, e->callee));
+      TT_GridLine_AddItem(
+          line, TT_FmtStr(al, f1, f2, "%lu", (unsigned long)e->calls));
+      TT_GridLine_AddItem(
+          line, TT_FmtStr(al, f1, f2, "%.2f", Prof_TickToUs(e->incl)));
+    }
+  }
+#endif
+  TT_AddString(tt,
+               TT_FmtStr(TT_ALIGN_CENTER, TT_FMT1_GREEN, TT_FMT2_NONE,
+                         "Total: %.3fus / Clock: %luHz / Dropped: %lu",
+                         Prof_TickToUs(total), (unsigned long)Prof_GetFreq(),
+                         (unsigned long)dropped),
+               -1);
+  TT_AddSeparator(tt, TT_FMT1_BLUE, TT_FMT2_BOLD, '-');
+  TT_Print(tt);
+  TT_FreeTable(tt);
+}
+
+#if PROF_CFG_ENABLE_TERMINAL
+static void prof_cmd_func(EmbeddedCli *cli, char *args, void *context) {
+  (void)context;
+  size_t argc = embeddedCliGetTokenCount(args);
+  if (!argc) {
+    embeddedCliPrintCurrentHelp(cli);
+    return;
+  }
+  if (embeddedCliCheckToken(args, "-p", 1) ||
+      embeddedCliCheckToken(args, "-g", 1)) {
+    prof_sort_t sort = PROF_SORT_EXCL;
+    uint16_t max_line = 0;
+    if (argc >= 2) {
+      if (embeddedCliCheckToken(args, "incl", 2))
+        sort = PROF_SORT_INCL;
+      else if (embeddedCliCheckToken(args, "calls", 2))
+        sort = PROF_SORT_CALLS;
+    }
+    if (argc >= 3) max_line = atoi(embeddedCliGetToken(args, 3));
+    Prof_Print(sort, max_line, embeddedCliCheckToken(args, "-g", 1));
+  } else if (embeddedCliCheckToken(args, "-r", 1)) {
+    Prof_Reset();
+    LOG_RAWLN(T_FMT(T_BOLD, T_GREEN) "Profiler data cleared" T_RST);
+  } else if (embeddedCliCheckToken(args, "-e", 1)) {
+    Prof_SetEnabled(1);
+    LOG_RAWLN(T_FMT(T_BOLD, T_GREEN) "Profiler enabled" T_RST);
+  } else if (embeddedCliCheckToken(args, "-d", 1)) {
+    Prof_SetEnabled(0);
+    LOG_RAWLN(T_FMT(T_BOLD, T_GREEN) "Profiler disabled" T_RST);
+  } else {
+    LOG_RAWLN(T_FMT(T_BOLD, T_RED) "Unknown command" T_RST);
+  }
+}
+
+void Prof_AddCmdToCli(EmbeddedCli *cli) {
+  static CliCommandBinding prof_cmd = {
+      .name = "prof",
+      .usage =
+          "prof [-p print | -g print with graph | -r reset | -e enable | -d "
+          "disable] [excl|incl|calls] [maxline]",
+      .help = "Function profiler command",
+      .context = NULL,
+      .autoTokenizeArgs = 1,
+      .func = prof_cmd_func,
+  };
+  embeddedCliAddBinding(cli, prof_cmd);
+}
+#endif  // PROF_CFG_ENABLE_TERMINAL
+
+#endif  // PROF_CFG_ENABLE
+
+// Source Code End --------------------------
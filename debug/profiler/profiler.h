@@ -0,0 +1,187 @@
+/**
+ * @file profiler.h
+ * @brief 基于插桩的函数级性能分析器(调用图统计)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-20
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "macro.h"
+#include "modules.h"
+
+#if !KCONFIG_AVAILABLE  // 由Kconfig配置
+#define PROF_CFG_ENABLE 1                // 启用分析器探针
+#define PROF_CFG_MAX_SITES 64            // 调用点表大小
+#define PROF_CFG_MAX_EDGES 128           // 调用图边表大小(0:不记录调用图)
+#define PROF_CFG_MAX_DEPTH 16            // 影子调用栈深度
+#define PROF_CFG_INSTRUMENT_FUNCTIONS 0  // 提供-finstrument-functions钩子
+#define PROF_CFG_CLOCK_PERF_COUNTER 1    // 时钟源: perf_counter
+#define PROF_CFG_CLOCK_MONOTONIC 0       // 时钟源: clock_gettime
+#define PROF_CFG_CLOCK_RDTSC 0           // 时钟源: x86 rdtsc
+#define PROF_CFG_ENABLE_TERMINAL 1  // 是否启用终端命令(依赖embedded-cli)
+#endif  // KCONFIG_AVAILABLE
+
+#if PROF_CFG_ENABLE
+
+#define _PROF_NO_INSTR __attribute__((no_instrument_function))
+
+typedef int64_t prof_tick_t;
+
+#if PROF_CFG_CLOCK_MONOTONIC
+#include <time.h>
+static inline _PROF_NO_INSTR prof_tick_t prof_get_tick(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (prof_tick_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#elif PROF_CFG_CLOCK_RDTSC
+#include <x86intrin.h>
+static inline _PROF_NO_INSTR prof_tick_t prof_get_tick(void) {
+  return (prof_tick_t)__rdtsc();
+}
+#else
+#include "perf_counter.h"
+#define prof_get_tick() ((prof_tick_t)get_system_ticks())
+#endif
+
+typedef struct {            // 调用点统计
+  const void *key;          // 调用点标识(函数地址或名称指针)
+  const char *name;         // 名称(NULL时报告中打印地址)
+  uint32_t calls;           // 调用次数
+  uint16_t active;          // 当前递归深度
+  prof_tick_t incl;         // 包含子调用的总耗时(Tick)
+  prof_tick_t excl;         // 不含子调用的总耗时(Tick)
+  prof_tick_t max;          // 单次最大包含耗时(Tick)
+} prof_site_t;
+
+typedef struct {     // 调用图边统计
+  uint16_t caller;   // 调用者在调用点表中的索引
+  uint16_t callee;   // 被调用者在调用点表中的索引
+  uint32_t calls;    // 调用次数
+  prof_tick_t incl;  // 被调用者在此调用关系下的包含耗时(Tick)
+} prof_edge_t;
+
+typedef enum {
+  PROF_SORT_EXCL,   // 按自身耗时排序
+  PROF_SORT_INCL,   // 按包含耗时排序
+  PROF_SORT_CALLS,  // 按调用次数排序
+} prof_sort_t;
+
+/**
+ * @brief 进入一个调用点
+ * @param  key              调用点标识(相同标识的调用合并统计)
+ * @param  name             调用点名称, 可为NULL
+ * @note 非线程安全, 不应在中断中使用
+ */
+extern _PROF_NO_INSTR void Prof_Enter(const void *key, const char *name);
+
+/**
+ * @brief 退出最近进入的调用点
+ */
+extern _PROF_NO_INSTR void Prof_Exit(void);
+
+/**
+ * @brief 清空所有统计数据
+ */
+extern void Prof_Reset(void);
+
+/**
+ * @brief 暂停/恢复统计(暂停期间的探针直接返回)
+ * @param  enable           是否使能
+ */
+extern void Prof_SetEnabled(uint8_t enable);
+
+/**
+ * @brief 获取调用点表
+ * @param  num              输出: 调用点数量
+ * @retval const prof_site_t*  调用点表
+ */
+extern const prof_site_t *Prof_GetSites(uint16_t *num);
+
+/**
+ * @brief 获取调用图边表
+ * @param  num              输出: 边数量
+ * @retval const prof_edge_t*  边表
+ */
+extern const prof_edge_t *Prof_GetEdges(uint16_t *num);
+
+/**
+ * @brief 获取时钟频率
+ * @retval uint64_t         Hz
+ */
+extern uint64_t Prof_GetFreq(void);
+
+/**
+ * @brief 转换时钟为us
+ * @param  tick             时钟
+ * @retval double           us
+ */
+extern double Prof_TickToUs(prof_tick_t tick);
+
+/**
+ * @brief 通过term_table打印统计报告
+ * @param  sort             排序方式
+ * @param  max_line         最大行数(0:不限制)
+ * @param  graph            是否打印调用图
+ */
+extern void Prof_Print(prof_sort_t sort, uint16_t max_line, uint8_t graph);
+
+/**
+ * @brief 作用域结束时自动退出的辅助函数(供PROF_SCOPE使用)
+ */
+static inline _PROF_NO_INSTR void __prof_scope_exit(uint8_t *guard) {
+  (void)guard;
+  Prof_Exit();
+}
+
+/**
+ * @brief 统计当前作用域(离开作用域时自动结束)
+ * @param  name             字符串常量名称
+ */
+#define PROF_SCOPE(name)                                      \
+  Prof_Enter((name), (name));                                 \
+  uint8_t __attribute__((cleanup(__prof_scope_exit), unused)) \
+  SAFE_NAME(prof_guard) = 0
+
+/**
+ * @brief 统计当前函数
+ */
+#define PROF_FUNC() PROF_SCOPE(__func__)
+
+/**
+ * @brief 手动标记统计区间开始/结束(需成对使用)
+ */
+#define PROF_BEGIN(name) Prof_Enter((name), (name))
+#define PROF_END() Prof_Exit()
+
+#if PROF_CFG_ENABLE_TERMINAL
+#include "embedded_cli.h"
+/**
+ * @brief 添加分析器相关的终端命令(prof)
+ */
+extern void Prof_AddCmdToCli(EmbeddedCli *cli);
+#endif  // PROF_CFG_ENABLE_TERMINAL
+
+#else  // PROF_CFG_ENABLE
+
+#define PROF_SCOPE(name) ((void)0)
+#define PROF_FUNC() ((void)0)
+#define PROF_BEGIN(name) ((void)0)
+#define PROF_END() ((void)0)
+
+#endif  // PROF_CFG_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PROFILER_H__ */
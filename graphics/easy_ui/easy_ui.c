@@ -34,6 +34,13 @@ EasyUIActionFlag_t uiActionFlag = {0};
 static EasyUIActionFlag_t cacheActionFlag = {0};
 static bool autoReturn = false;
 bool functionIsRunning = false, uiListLoop = true;
+bool uiIncrementalRedraw = true;  // Skip unchanged frames, flush dirty rows
+
+// Retained redraw state of list pages
+static bool redrawAll = true;              // Buffer no longer matches the page
+static EasyUIPage_t *drawnPage = NULL;     // Page in the buffer
+static int16_t dirtyY0 = 0, dirtyY1 = 0;   // Dirty rows [y0, y1) of the frame
+static int16_t drawnIndY = 0, drawnIndLength = 0;  // Indicator in the buffer
 
 /*!
  * @brief   Add item to page
@@ -68,9 +75,9 @@ EasyUIItem_t *EasyUIAddItem(EasyUIItem_t *item, EasyUIPage_t *page,
   if (item) {
     va_list variableArg;
     va_start(variableArg, _title);
-    *item->flag = false;
+    item->flag = NULL;
     item->flagDefault = false;
-    *item->param = 0;
+    item->param = NULL;
     item->paramDefault = 0;
     item->paramBackup = 0;
     item->pageId = 0;
@@ -149,6 +156,8 @@ EasyUIItem_t *EasyUIAddItem(EasyUIItem_t *item, EasyUIPage_t *page,
     item->posForCal = 0;
     item->step = 0;
     item->position = 0;
+    item->drawnPosition = 0;
+    item->drawnState = 0;
     va_end(variableArg);
   }
   return item;
@@ -232,38 +241,84 @@ void EasyUIDelPage(EasyUIPage_t *page, bool dynamic) {
 }
 
 /*!
- * @brief   Blur transition animation
+ * @brief   Set or clear bytes with a mask alternating between even/odd bytes
  *
- * @param   void
+ * @param   p       First byte
+ * @param   n       Number of bytes
+ * @param   mask    Mask of even [0] and odd [1] bytes (relative to p)
+ * @param   set     true: OR the mask, false: clear the masked bits
  * @return  void
  *
- * @note    Use before clearing the buffer
- *          Also use after all the initialization is done for better experience
+ * @note    Aligned part is processed as 32-bit words
  */
-void EasyUITransitionAnim() {
-  for (int j = 1; j < driver.height + 1; j += 2) {
-    for (int i = 0; i < driver.width + 1; i += 2) {
-      driver.drawPoint(i, j, driver.bgcolor);
-    }
+static void MaskBytes(uint8_t *p, size_t n, const uint8_t mask[2], bool set) {
+  size_t i = 0;
+  for (; i < n && ((uintptr_t)(p + i) & 3); i++) {
+    p[i] = set ? p[i] | mask[i & 1] : p[i] & ~mask[i & 1];
   }
-  driver.flush();
-  for (int j = 1; j < driver.height + 1; j += 2) {
-    for (int i = 1; i < driver.width + 1; i += 2) {
-      driver.drawPoint(i, j, driver.bgcolor);
+  if (i + 4 <= n) {
+    const uint8_t pat[4] = {mask[i & 1], mask[(i + 1) & 1], mask[i & 1],
+                            mask[(i + 1) & 1]};
+    uint32_t wm;
+    memcpy(&wm, pat, 4);  // byte order independent
+    for (; i + 4 <= n; i += 4) {
+      uint32_t *w = (uint32_t *)(p + i);
+      *w = set ? *w | wm : *w & ~wm;
     }
   }
-  driver.flush();
-  for (int j = 0; j < driver.height + 1; j += 2) {
-    for (int i = 1; i < driver.width + 1; i += 2) {
-      driver.drawPoint(i, j, driver.bgcolor);
+  for (; i < n; i++) {
+    p[i] = set ? p[i] | mask[i & 1] : p[i] & ~mask[i & 1];
+  }
+}
+
+/*!
+ * @brief   Fill one phase of the 2x2 checkerboard with background color
+ *
+ * @param   px      Fill pixels whose (x & 1) == px
+ * @param   py      Fill pixels whose (y & 1) == py
+ * @return  void
+ */
+static void EasyUIMaskPoints(uint8_t px, uint8_t py) {
+  EasyUIFramebuffer_t fb;
+  redrawAll = true;
+  if (driver.getFramebuffer == NULL || !driver.getFramebuffer(&fb)) {
+    for (int j = py; j < driver.height; j += 2) {
+      for (int i = px; i < driver.width; i += 2) {
+        driver.drawPoint(i, j, driver.bgcolor);
+      }
     }
+    return;
   }
-  driver.flush();
-  for (int j = 1; j < driver.height + 1; j += 2) {
-    for (int i = 1; i < driver.width + 1; i += 2) {
-      driver.drawPoint(i - 1, j - 1, driver.bgcolor);
+  bool set = driver.bgcolor != 0;
+  if (fb.format == UI_FB_MONO_VLSB) {
+    // one page holds 8 rows, so the row phase is a bit mask inside each byte
+    uint8_t m = py ? 0xAA : 0x55;
+    const uint8_t mask[2] = {px ? 0 : m, px ? m : 0};
+    for (int page = 0; page < (driver.height + 7) / 8; page++) {
+      MaskBytes(fb.buf + page * fb.stride, driver.width, mask, set);
+    }
+  } else {
+    bool lsb_left = fb.format == UI_FB_MONO_HMSB;
+    uint8_t m = (px ^ lsb_left) ? 0x55 : 0xAA;
+    const uint8_t mask[2] = {m, m};
+    for (int j = py; j < driver.height; j += 2) {
+      MaskBytes(fb.buf + j * fb.stride, (driver.width + 7) / 8, mask, set);
     }
   }
+}
+
+/*!
+ * @brief   Blur transition animation
+ *
+ * @param   void
+ * @return  void
+ *
+ * @note    Use before clearing the buffer
+ *          Also use after all the initialization is done for better experience
+ */
+void EasyUITransitionAnim() {
+  EasyUIBackgroundBlur();
+  EasyUIMaskPoints(0, 0);
   driver.flush();
 }
 
@@ -272,25 +327,16 @@ void EasyUITransitionAnim() {
  *
  * @param   void
  * @return  void
+ *
+ * @note    Works on the framebuffer with word operations if the driver
+ *          provides `getFramebuffer`, otherwise calls `drawPoint` per pixel
  */
 void EasyUIBackgroundBlur() {
-  for (int j = 1; j < driver.height + 1; j += 2) {
-    for (int i = 0; i < driver.width + 1; i += 2) {
-      driver.drawPoint(i, j, driver.bgcolor);
-    }
-  }
+  EasyUIMaskPoints(0, 1);
   driver.flush();
-  for (int j = 1; j < driver.height + 1; j += 2) {
-    for (int i = 1; i < driver.width + 1; i += 2) {
-      driver.drawPoint(i, j, driver.bgcolor);
-    }
-  }
+  EasyUIMaskPoints(1, 1);
   driver.flush();
-  for (int j = 0; j < driver.height + 1; j += 2) {
-    for (int i = 1; i < driver.width + 1; i += 2) {
-      driver.drawPoint(i, j, driver.bgcolor);
-    }
-  }
+  EasyUIMaskPoints(1, 0);
   driver.flush();
 }
 
@@ -448,36 +494,34 @@ void EasyUIComboBoxAddOne(EasyUIItem_t *item) {
 void EasyUIGetItemPos(EasyUIPage_t *page, EasyUIItem_t *item, uint8_t index,
                       uint8_t timer) {
   static uint16_t time = 0;
-  static int16_t move = 0, target = 0;
-  static uint8_t lastIndex = 0, moveFlag = 0;
+  static int16_t target = 0;
+  static uint8_t lastIndex = 0;
   uint8_t speed = ANIM_TIME / timer;
 
   uint8_t itemHeightOffset = (ITEM_HEIGHT - driver.font_height) / 2;
 
-  // Item need to move or not
-  if (moveFlag == 0) {
+  // Scroll the page once per pass (on the first item) if the selected item
+  // is out of screen, the lineId of the following items is already updated
+  if (item == page->itemHead) {
+    int16_t move = 0;
     for (EasyUIItem_t *itemTmp = page->itemHead; itemTmp != NULL;
          itemTmp = itemTmp->next) {
       if (index != itemTmp->id) continue;
-      if (itemTmp->lineId < 0) {
+      if (itemTmp->lineId < 0)
         move = itemTmp->lineId;
-        moveFlag = 1;
-        break;
-      } else if (itemTmp->lineId > ITEM_LINES - 1) {
+      else if (itemTmp->lineId > ITEM_LINES - 1)
         move = itemTmp->lineId - ITEM_LINES + 1;
-        moveFlag = 1;
-        break;
+      break;
+    }
+    if (move != 0) {
+      for (EasyUIItem_t *itemTmp = page->itemHead; itemTmp != NULL;
+           itemTmp = itemTmp->next) {
+        itemTmp->lineId -= move;
       }
     }
   }
 
-  // Change the item lineId and get target position
-  for (EasyUIItem_t *itemTmp = page->itemHead; itemTmp != NULL;
-       itemTmp = itemTmp->next) {
-    itemTmp->lineId -= move;
-  }
-  move = 0;
-  moveFlag = 0;
+  // Get target position
   target = itemHeightOffset + item->lineId * ITEM_HEIGHT;
 
   // Calculate current position
@@ -600,6 +644,8 @@ void EasyUIDisplayItem(EasyUIItem_t *item) {
   }
 }
 
+static float indLength = 0, indY = 10000000;  // Current indicator box
+
 /*!
  * @brief   Get position of indicator and scroll bar with linear animation
  *
@@ -611,22 +657,23 @@ void EasyUIDisplayItem(EasyUIItem_t *item) {
  *
  * @note    Internal call
  */
-void EasyUIDrawIndicator(EasyUIPage_t *page, uint8_t index, uint8_t timer,
-                         uint8_t status) {
+static void EasyUIUpdateIndicator(EasyUIPage_t *page, uint8_t index,
+                                  uint8_t timer, uint8_t status) {
   static uint16_t time = 0;
   static uint8_t lastIndex = 0;
   static uint16_t lengthTarget = 0, yTarget = 0;
-  static float stepLength = 0, stepY = 0, length = 0, y = 10000000;
+  static float stepLength = 0, stepY = 0;
   float speed = ANIM_TIME / timer;
-  if (y > 1000000) y = driver.height;
-  if (status) y = driver.height;
+  if (indY > 1000000) indY = driver.height;
+  if (status) indY = driver.height;
 
   // Get Initial length
-  if ((int)length == 0) {
+  if ((int)indLength == 0) {
     if (page->itemHead->funcType == ITEM_PAGE_DESCRIPTION)
-      length = (float)(strlen(page->itemHead->title)) * driver.font_width + 5;
+      indLength =
+          (float)(strlen(page->itemHead->title)) * driver.font_width + 5;
     else
-      length =
+      indLength =
           (float)(strlen(page->itemHead->title) + 1) * driver.font_width + 8;
   }
 
@@ -642,9 +689,9 @@ void EasyUIDrawIndicator(EasyUIPage_t *page, uint8_t index, uint8_t timer,
       if (index != lastIndex &&
           UABSMINUS(index, lastIndex) < page->itemTail->id) {
         if (itemTmp->position < 0)
-          y = (float)3 * ITEM_HEIGHT / 4;
+          indY = (float)3 * ITEM_HEIGHT / 4;
         else if (itemTmp->position >= (ITEM_LINES)*ITEM_HEIGHT)
-          y = (ITEM_LINES - 2) * ITEM_HEIGHT + (float)ITEM_HEIGHT / 4;
+          indY = (ITEM_LINES - 2) * ITEM_HEIGHT + (float)ITEM_HEIGHT / 4;
       }
       break;
     }
@@ -652,32 +699,139 @@ void EasyUIDrawIndicator(EasyUIPage_t *page, uint8_t index, uint8_t timer,
 
   // Calculate current position
   if (time == 0 || index != lastIndex) {
-    stepLength = ((float)lengthTarget - (float)length) / speed;
-    stepY = ((float)yTarget - (float)y) / speed;
+    stepLength = ((float)lengthTarget - (float)indLength) / speed;
+    stepY = ((float)yTarget - (float)indY) / speed;
   }
   if (time >= ANIM_TIME) {
-    length = lengthTarget;
-    y = yTarget;
+    indLength = lengthTarget;
+    indY = yTarget;
   } else {
-    length += stepLength;
-    y += stepY;
+    indLength += stepLength;
+    indY += stepY;
   }
-
-  // Draw rounded box and scroll bar
-  driver.enableXorRegion(0, y, driver.width, ITEM_HEIGHT);
-  driver.drawRBox(0, (int16_t)y, (int16_t)length, ITEM_HEIGHT, driver.color, 1);
-  driver.disableXorRegion();
-  driver.drawRBox(driver.width - SCROLL_BAR_WIDTH, (int16_t)y, SCROLL_BAR_WIDTH,
-                  ITEM_HEIGHT, driver.color, 1);
   lastIndex = index;
 
   // Time counter
-  if ((int)length == lengthTarget && (int)y == yTarget)
+  if ((int)indLength == lengthTarget && (int)indY == yTarget)
     time = 0;
   else
     time += timer;
 }
 
+/*!
+ * @brief   Draw indicator and scroll bar at the current position
+ *
+ * @return  void
+ *
+ * @note    Internal call
+ */
+static void EasyUIPaintIndicator(void) {
+  driver.enableXorRegion(0, indY, driver.width, ITEM_HEIGHT);
+  driver.drawRBox(0, (int16_t)indY, (int16_t)indLength, ITEM_HEIGHT,
+                  driver.color, 1);
+  driver.disableXorRegion();
+  driver.drawRBox(driver.width - SCROLL_BAR_WIDTH, (int16_t)indY,
+                  SCROLL_BAR_WIDTH, ITEM_HEIGHT, driver.color, 1);
+  drawnIndY = (int16_t)indY;
+  drawnIndLength = (int16_t)indLength;
+}
+
+/*!
+ * @brief   Update and draw indicator and scroll bar
+ *
+ * @note    Internal call, see EasyUIUpdateIndicator
+ */
+void EasyUIDrawIndicator(EasyUIPage_t *page, uint8_t index, uint8_t timer,
+                         uint8_t status) {
+  EasyUIUpdateIndicator(page, index, timer, status);
+  EasyUIPaintIndicator();
+}
+
+/*!
+ * @brief   Add rows to the dirty region of this frame
+ *
+ * @param   y       First row
+ * @param   height  Number of rows
+ * @return  void
+ */
+static void EasyUIMarkDirty(int16_t y, int16_t height) {
+  int16_t y1 = y + height;
+  if (y < 0) y = 0;
+  if (y1 > (int16_t)driver.height) y1 = driver.height;
+  if (y >= y1) return;
+  if (dirtyY0 >= dirtyY1) {
+    dirtyY0 = y;
+    dirtyY1 = y1;
+    return;
+  }
+  if (y < dirtyY0) dirtyY0 = y;
+  if (y1 > dirtyY1) dirtyY1 = y1;
+}
+
+/*!
+ * @brief   Grow the dirty region to the whole rows of something it touches
+ *
+ * @param   y       First row
+ * @param   height  Number of rows
+ * @return  bool    The region grew
+ *
+ * @note    Internal call. What is redrawn has to lie inside the cleared
+ *          rows, the indicator is XORed and must not be painted twice.
+ */
+static bool EasyUIGrowDirty(int16_t y, int16_t height) {
+  int16_t y1 = y + height;
+  if (y < 0) y = 0;
+  if (y1 > (int16_t)driver.height) y1 = driver.height;
+  if (y >= dirtyY1 || y1 <= dirtyY0) return false;
+  if (y >= dirtyY0 && y1 <= dirtyY1) return false;
+  EasyUIMarkDirty(y, y1 - y);
+  return true;
+}
+
+static uint32_t Fnv1a(uint32_t hash, const void *data, size_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  while (len--) hash = (hash ^ *p++) * 16777619u;
+  return hash;
+}
+
+/*!
+ * @brief   Hash everything EasyUIDisplayItem shows for the item
+ *
+ * @param   item    Struct of item
+ * @return  uint32_t
+ */
+static uint32_t EasyUIItemState(EasyUIItem_t *item) {
+  uint32_t hash = Fnv1a(2166136261u, &item->enable, sizeof(item->enable));
+  hash = Fnv1a(hash, item->title, strlen(item->title));
+  if (!item->enable) return hash;
+  switch (item->funcType) {
+    case ITEM_CHECKBOX:
+    case ITEM_RADIO_BUTTON:
+    case ITEM_SWITCH:
+      hash = Fnv1a(hash, item->flag, sizeof(*item->flag));
+      break;
+    case ITEM_VALUE_EDITOR:
+      hash = Fnv1a(hash, item->param, sizeof(*item->param));
+      break;
+    case ITEM_COMBO_BOX:
+      hash = Fnv1a(hash, item->paramIndex, sizeof(*item->paramIndex));
+      break;
+    default:
+      break;
+  }
+  return hash;
+}
+
+/*!
+ * @brief   Force the next frame to redraw and flush the whole page
+ *
+ * @return  void
+ *
+ * @note    Only needed when the displayed content is changed in a way
+ *          EasyUI can not see, e.g. editing the combo box list in place
+ */
+void EasyUIInvalidate(void) { redrawAll = true; }
+
 void EasyUIJumpPage(uint8_t pageId) {
   itemIndex[layer] = itemIdx;
   layer++;
@@ -1003,6 +1157,7 @@ void EasyUIEventExit(void) {
  */
 void EasyUIInit(EasyUIDriver_t driver_settings) {
   driver = driver_settings;
+  redrawAll = true;
   driver.init();
   driver.clear();
 }
@@ -1020,6 +1175,27 @@ void EasyUIInformAction(EasyUIAction_t action) {
   cacheActionFlag.exit = action == ACT_EXIT;
 }
 
+/*!
+ * @brief   Flush the frame of a list page
+ *
+ * @param   full    The whole page was redrawn
+ * @return  void
+ *
+ * @note    Internal call, only the dirty rows are sent if the driver
+ *          supports `flushRegion`
+ */
+static void EasyUIFlushFrame(bool full) {
+  if (full || redrawAll) {  // Also after a transition in this frame
+    driver.flush();
+    return;
+  }
+  if (dirtyY0 >= dirtyY1) return;
+  if (driver.flushRegion != NULL)
+    driver.flushRegion(0, dirtyY0, driver.width, dirtyY1 - dirtyY0);
+  else
+    driver.flush();
+}
+
 /*!
  * @brief   Main function of EasyUI
  *
@@ -1040,6 +1216,7 @@ void EasyUI(uint16_t timer) {
   // Quit UI to run function
   // If running function and hold the confirm button, quit the function
   if (functionIsRunning) {
+    redrawAll = true;  // The function draws over the page
     for (EasyUIItem_t *item = page->itemHead; item != NULL; item = item->next) {
       if (item->id != itemIdx) {
         continue;
@@ -1076,9 +1253,9 @@ void EasyUI(uint16_t timer) {
     return;
   }
 
-  driver.clear();
-
   if (page->funcType == PAGE_CUSTOM) {
+    driver.clear();
+    redrawAll = true;
     page->Event(page, &driver);
 
     if (layer == 0) {
@@ -1099,13 +1276,72 @@ void EasyUI(uint16_t timer) {
     return;
   }
 
-  // Display every item in current page
+  // Update animation of items, indicator and scroll bar
   for (EasyUIItem_t *item = page->itemHead; item != NULL; item = item->next) {
     EasyUIGetItemPos(page, item, itemIdx, timer);
-    EasyUIDisplayItem(item);
   }
-  // Draw indicator and scroll bar
-  EasyUIDrawIndicator(page, itemIdx, timer, 0);
+  EasyUIUpdateIndicator(page, itemIdx, timer, 0);
+
+  // Find the rows changed since the last drawn frame
+  bool full = redrawAll || page != drawnPage || !uiIncrementalRedraw;
+  dirtyY0 = dirtyY1 = 0;
+  if (!full) {
+    uint8_t itemHeightOffset = (ITEM_HEIGHT - driver.font_height) / 2;
+    for (EasyUIItem_t *item = page->itemHead; item != NULL;
+         item = item->next) {
+      if (item->position != item->drawnPosition ||
+          EasyUIItemState(item) != item->drawnState) {
+        EasyUIMarkDirty(item->drawnPosition - itemHeightOffset, ITEM_HEIGHT);
+        EasyUIMarkDirty(item->position - itemHeightOffset, ITEM_HEIGHT);
+      }
+    }
+    if ((int16_t)indY != drawnIndY || (int16_t)indLength != drawnIndLength) {
+      EasyUIMarkDirty(drawnIndY, ITEM_HEIGHT);
+      EasyUIMarkDirty((int16_t)indY, ITEM_HEIGHT);
+    }
+  }
+
+  // Display every item in current page (idle pages are not drawn at all)
+  if (full) {
+    driver.clear();
+    for (EasyUIItem_t *item = page->itemHead; item != NULL;
+         item = item->next) {
+      EasyUIDisplayItem(item);
+      item->drawnPosition = item->position;
+      item->drawnState = EasyUIItemState(item);
+    }
+    EasyUIPaintIndicator();
+    drawnPage = page;
+    redrawAll = false;
+  } else if (dirtyY0 < dirtyY1) {
+    // Clear the dirty rows only and redraw what lies in them
+    uint8_t itemHeightOffset = (ITEM_HEIGHT - driver.font_height) / 2;
+    int16_t changedY0 = dirtyY0, changedY1 = dirtyY1;
+    bool grown = true;
+    while (grown) {
+      grown = EasyUIGrowDirty((int16_t)indY, ITEM_HEIGHT);
+      for (EasyUIItem_t *item = page->itemHead; item != NULL;
+           item = item->next) {
+        if (EasyUIGrowDirty(item->position - itemHeightOffset, ITEM_HEIGHT))
+          grown = true;
+      }
+    }
+    driver.drawBox(0, dirtyY0, driver.width, dirtyY1 - dirtyY0,
+                   driver.bgcolor);
+    for (EasyUIItem_t *item = page->itemHead; item != NULL;
+         item = item->next) {
+      int16_t y = item->position - itemHeightOffset;
+      if (y >= dirtyY1 || y + ITEM_HEIGHT <= dirtyY0) continue;
+      EasyUIDisplayItem(item);
+      item->drawnPosition = item->position;
+      item->drawnState = EasyUIItemState(item);
+    }
+    if ((int16_t)indY < dirtyY1 && (int16_t)indY + ITEM_HEIGHT > dirtyY0)
+      EasyUIPaintIndicator();
+    // The rows added by growing were redrawn unchanged, no need to send them
+    dirtyY0 = changedY0;
+    dirtyY1 = changedY1;
+  }
 
   // Operation move reaction
   uint8_t itemSum = page->itemTail->id;
@@ -1140,7 +1376,7 @@ void EasyUI(uint16_t timer) {
     cacheActionFlag = uiActionFlag;
   }
   if (layer == 0) {
-    driver.flush();
+    EasyUIFlushFrame(full);
     return;
   }
   if (uiActionFlag.exit) {
@@ -1155,5 +1391,5 @@ void EasyUI(uint16_t timer) {
     }
     EasyUITransitionAnim();
   }
-  driver.flush();
+  EasyUIFlushFrame(full);
 }
@@ -21,6 +21,18 @@ extern "C" {
 typedef double uiParamType;
 typedef uint16_t uiColorType;
 
+typedef enum {
+  UI_FB_MONO_VLSB,  // 1bpp, a byte is 8 vertical pixels, bit0 on top (pages)
+  UI_FB_MONO_HLSB,  // 1bpp, row-major, bit7 is the leftmost pixel
+  UI_FB_MONO_HMSB,  // 1bpp, row-major, bit0 is the leftmost pixel
+} EasyUIFbFormat_e;
+
+typedef struct {
+  uint8_t *buf;     // first byte of the buffer drawn by the driver
+  uint16_t stride;  // bytes per row (HLSB/HMSB) or per page (VLSB)
+  EasyUIFbFormat_e format;
+} EasyUIFramebuffer_t;
+
 typedef struct {
   // driver parameters
   uint16_t width;
@@ -50,6 +62,11 @@ typedef struct {
   void (*disableXorRegion)(void);
   void (*clear)(void);
   void (*flush)(void);
+  // optional, lets effects work on the buffer directly instead of drawPoint
+  // (leave NULL or return false to use drawPoint)
+  bool (*getFramebuffer)(EasyUIFramebuffer_t *fb);
+  // optional, send only part of the buffer (leave NULL to use flush)
+  void (*flushRegion)(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
 } EasyUIDriver_t;
 
 typedef enum {
@@ -110,6 +127,9 @@ typedef struct EasyUI_item {
   bool eventWhenEditVal;     // ITEM_VALUE_EDITOR
   uint8_t *paramIndex;       // ITEM_RADIO_BUTTON and ITEM_COMBO_BOX
   char *comboList;           // ITEM_COMBO_BOX
+  // retained redraw state
+  int16_t drawnPosition;  // Position when last drawn
+  uint32_t drawnState;    // Hash of the displayed content when last drawn
 } EasyUIItem_t;
 
 typedef struct EasyUI_page {
@@ -122,6 +142,7 @@ typedef struct EasyUI_page {
 } EasyUIPage_t;
 
 extern bool uiListLoop;
+extern bool uiIncrementalRedraw;
 extern EasyUIPage_t *uiPageHead, *uiPageTail;
 extern EasyUIActionFlag_t uiActionFlag;
 
@@ -142,6 +163,7 @@ void EasyUIInformAction(EasyUIAction_t action);
 void EasyUIJumpPage(uint8_t pageId);
 void EasyUIJumpItem(uint8_t pageId, uint8_t itemId, bool enter);
 void EasyUIEventExit(void);
+void EasyUIInvalidate(void);
 
 void EasyUITransitionAnim();
 void EasyUIBackgroundBlur();
@@ -0,0 +1,1251 @@
+/*
+
+Pre-baked atlas of MISC 6x9, 1293 glyphs.
+Generated by fontx2.py --to_atlas, see fontx_atlas_t.
+
+*/
+#include "fontx.h"
+
+static const uint16_t font6x9_atlas_disp[] = {
+    0x0001, 0x0000, 0x0001, 0x0002, 0x0003, 0x0000, 0x0001, 0x0002,
+    0x0001, 0x0003, 0x0006, 0x0000, 0x0001, 0x0002, 0x0006, 0x0001,
+    0x0001, 0x0000, 0x0002, 0x0002, 0x0008, 0x0005, 0x0011, 0x0002,
+    0x0000, 0x0001, 0x0000, 0x0001, 0x0004, 0x0001, 0x0009, 0x0000,
+    0x0009, 0x0001, 0x0001, 0x0003, 0x0005, 0x0001, 0x000a, 0x0005,
+    0x0001, 0x0003, 0x0001, 0x0000, 0x0002, 0x0002, 0x0001, 0x0004,
+    0x0001, 0x0001, 0x0000, 0x0002, 0x0000, 0x0001, 0x0001, 0x0004,
+    0x0004, 0x000c, 0x0000, 0x0000, 0x0002, 0x0007, 0x0004, 0x0003,
+    0x0000, 0x0001, 0x0002, 0x0002, 0x000b, 0x0006, 0x0001, 0x0002,
+    0x0003, 0x0005, 0x0001, 0x0001, 0x0005, 0x0007, 0x0003, 0x0001,
+    0x0003, 0x0001, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0006,
+    0x0000, 0x0001, 0x0006, 0x0001, 0x0000, 0x0001, 0x0002, 0x0003,
+    0x000f, 0x0003, 0x0002, 0x0008, 0x0005, 0x0011, 0x0007, 0x0001,
+    0x000c, 0x0001, 0x0000, 0x0004, 0x0001, 0x0000, 0x0009, 0x0004,
+    0x0002, 0x0002, 0x0007, 0x0005, 0x0005, 0x0000, 0x0001, 0x0001,
+    0x0002, 0x0002, 0x0001, 0x0000, 0x0001, 0x0006, 0x0006, 0x0000,
+    0x0005, 0x0005, 0x0003, 0x0001, 0x0000, 0x0001, 0x0002, 0x0000,
+    0x0002, 0x0000, 0x0005, 0x0005, 0x0003, 0x0004, 0x0001, 0x0004,
+    0x0001, 0x0004, 0x0003, 0x0010, 0x0006, 0x0002, 0x0002, 0x0005,
+    0x0005, 0x0002, 0x0002, 0x0000, 0x000e, 0x0001, 0x0002, 0x000b,
+    0x0001, 0x0000, 0x0001, 0x0002, 0x0001, 0x0009, 0x0003, 0x0001,
+    0x0000, 0x0001, 0x002b, 0x0006, 0x0001, 0x0003, 0x0004, 0x0002,
+    0x0001, 0x0002, 0x0001, 0x0001, 0x0009, 0x0001, 0x0006, 0x000d,
+    0x000a, 0x0001, 0x0002, 0x0000, 0x0006, 0x0002, 0x0002, 0x0013,
+    0x000e, 0x0003, 0x0000, 0x0001, 0x0000, 0x0002, 0x0002, 0x0006,
+    0x0002, 0x000c, 0x0005, 0x0005, 0x0001, 0x000a, 0x0003, 0x000a,
+    0x000c, 0x0002, 0x0005, 0x000c, 0x0005, 0x0000, 0x0002, 0x0001,
+    0x0001, 0x0000, 0x0002, 0x0003, 0x0004, 0x0001, 0x0000, 0x0003,
+    0x0004, 0x0012, 0x0005, 0x0000, 0x0001, 0x0003, 0x0001, 0x0000,
+    0x0001, 0x0002, 0x0007, 0x0000, 0x0001, 0x0003, 0x0001, 0x0008,
+    0x0001, 0x0005, 0x0000, 0x001b, 0x0001, 0x0001, 0x0004, 0x0001,
+    0x0000, 0x0001, 0x0008, 0x0006, 0x001f, 0x0007, 0x0002, 0x0006,
+    0x0004, 0x0015, 0x0000, 0x0000, 0x0003, 0x0002, 0x0000, 0x0002,
+    0x0006, 0x002c, 0x0003, 0x001b, 0x0009, 0x003a, 0x0023, 0x0001,
+    0x0005, 0x0002, 0x0003, 0x0002, 0x0008, 0x0000, 0x0004, 0x001c,
+    0x0001, 0x0004, 0x0011, 0x0001, 0x0004, 0x0000, 0x0000, 0x0001,
+    0x0001, 0x0006, 0x0004, 0x002f, 0x0001, 0x0017, 0x0007, 0x0004,
+    0x0001, 0x0006, 0x0000, 0x0000, 0x0001, 0x0009, 0x0002, 0x0002,
+    0x0001, 0x0016, 0x0002, 0x0000, 0x0004, 0x0000, 0x0001, 0x000b,
+    0x0000, 0x0003, 0x0000, 0x0005, 0x0005, 0x0001, 0x0001, 0x0004,
+    0x0001, 0x0005, 0x0004, 0x0004, 0x0001, 0x001f, 0x0000, 0x0007,
+    0x0003, 0x0001, 0x0000, 0x0039, 0x0004, 0x0000, 0x0005, 0x000d,
+    0x002f, 0x0005, 0x0001, 0x0004, 0x0014, 0x0001, 0x000e, 0x0004,
+    0x0026, 0x0000, 0x0002, 0x0004, 0x0003, 0x0004, 0x0002, 0x0001,
+    0x0007, 0x0003, 0x0008, 0x0003, 0x0006, 0x0008, 0x0002, 0x0025,
+    0x0001, 0x0009, 0x002d, 0x0002, 0x0001, 0x0004, 0x0002, 0x0006,
+    0x0022, 0x0000, 0x000a, 0x0019, 0x0004, 0x0001, 0x0002, 0x000b,
+    0x0003, 0x0006, 0x000e, 0x0003, 0x0003, 0x004b, 0x0014, 0x0008,
+    0x0002, 0x001c, 0x0044, 0x001d, 0x001f, 0x0000, 0x0005, 0x0028,
+    0x0000, 0x0001, 0x0002, 0x0017, 0x0025, 0x0010, 0x0024, 0x0026,
+    0x0008, 0x0012, 0x0001, 0x0001, 0x0026, 0x0007, 0x0001, 0x0005,
+    0x0001, 0x0000, 0x0002, 0x0002, 0x0004, 0x001c, 0x0003, 0x0001,
+    0x0012, 0x0002, 0x0000, 0x0001, 0x0006, 0x0000, 0x0019, 0x0000,
+    0x001f, 0x001b, 0x0001, 0x0001, 0x000f, 0x0000, 0x0002, 0x0010,
+    0x0010, 0x000d, 0x0001, 0x0002, 0x0000, 0x0013, 0x0000, 0x0011,
+    0x0001, 0x001c, 0x0028, 0x0001, 0x0053, 0x0006, 0x0001, 0x001e,
+    0x0003, 0x0006, 0x003b, 0x0001, 0x002d, 0x0028, 0x0005, 0x002a,
+    0x0000, 0x0001, 0x0004, 0x0076, 0x0004, 0x0065, 0x001c, 0x0015,
+    0x001d, 0x000b, 0x0002, 0x0004, 0x002f, 0x0007, 0x001b, 0x0001,
+    0x0003, 0x0008, 0x0001, 0x004d, 0x002e, 0x0001, 0x0032, 0x0002,
+    0x000b, 0x0000, 0x004f, 0x0005, 0x004f, 0x0009, 0x0001, 0x0000,
+    0x0006, 0x0003, 0x0009, 0x0003, 0x0009, 0x0022, 0x0015, 0x0001,
+    0x004c, 0x001e, 0x000a, 0x0005, 0x0009, 0x0004, 0x0001, 0x0053,
+    0x005b, 0x001b, 0x0012, 0x0002, 0x0059, 0x0005, 0x0000, 0x0008,
+    0x0001, 0x0000, 0x0001, 0x0043, 0x000e, 0x0001, 0x0002, 0x0023,
+    0x002f, 0x0021, 0x0001, 0x0006, 0x0005, 0x0070, 0x0001, 0x0015,
+    0x0003, 0x00c9, 0x0002, 0x0000, 0x0024, 0x004c, 0x002b, 0x0003,
+    0x00b0, 0x0035, 0x006a, 0x000d, 0x0056, 0x009b, 0x0001, 0x006e,
+    0x003c, 0x003e, 0x0002, 0x0001, 0x0000, 0x0002, 0x0000, 0x0045,
+    0x0010, 0x0000, 0x0001, 0x003b, 0x0048, 0x0002, 0x0009, 0x0004,
+    0x0068, 0x0001, 0x0038, 0x0001, 0x0025, 0x001a, 0x0036, 0x0002,
+    0x0003, 0x00b0, 0x0016, 0x0060, 0x0000, 0x000f, 0x0022, 0x0009,
+    0x0069, 0x001a, 0x004b, 0x0027, 0x001e, 0x0029, 0x0003, 0x0092,
+    0x0086, 0x0022, 0x0001, 0x009e, 0x0002, 0x00fa, 0x000c, 0x0005,
+    0x0009, 0x0000, 0x0001, 0x005e, 0x007d, 0x0049, 0x0122, 0x0003,
+};
+
+static const uint16_t font6x9_atlas_codes[] = {
+    0x0312, 0x0109, 0x2873, 0x015a, 0x2571, 0x02c6, 0x2588, 0x0418,
+    0x0394, 0x2888, 0x28f5, 0x221e, 0x03d7, 0x00a6, 0x240a, 0x03b5,
+    0x28d7, 0x2872, 0x28e4, 0x21a7, 0x00bb, 0x0192, 0x03b8, 0x289f,
+    0x0435, 0x2195, 0x2897, 0x2591, 0x0474, 0x00c0, 0x21a6, 0x03e2,
+    0x2191, 0x0151, 0x2018, 0x00fd, 0x25b7, 0x28c4, 0x28eb, 0x2881,
+    0x01d1, 0x2587, 0x00ef, 0x28de, 0x0398, 0x25c4, 0x0439, 0x0425,
+    0x030c, 0x2019, 0x03ab, 0x0144, 0x22ee, 0x00e7, 0x25aa, 0x28fe,
+    0x0157, 0x044e, 0x05e4, 0x00c2, 0x28b5, 0x03e5, 0x28b6, 0x03db,
+    0x2297, 0x03cc, 0x2586, 0x2640, 0x013b, 0x030d, 0x2801, 0x05df,
+    0x2215, 0x040b, 0x2840, 0x263b, 0x208d, 0x0444, 0x2424, 0x2021,
+    0x2193, 0x228a, 0x2261, 0x255c, 0x0410, 0x1e84, 0x043c, 0x0323,
+    0x00e1, 0x2208, 0x2867, 0x021a, 0x28bf, 0x00ac, 0x2320, 0x037e,
+    0x289c, 0x20af, 0x28c3, 0x1e6a, 0x28cd, 0x03c2, 0x04d9, 0x28a0,
+    0x030e, 0x2237, 0x2639, 0x285a, 0x040f, 0x05e6, 0x28f8, 0x20d1,
+    0x01b0, 0x22a7, 0x2082, 0x252c, 0x03d1, 0x28b8, 0x03d5, 0x2295,
+    0x0458, 0x00f8, 0x2012, 0x0139, 0x00f4, 0x030b, 0x0178, 0x2088,
+    0x230a, 0x014a, 0x1e02, 0x256f, 0x289b, 0x28a6, 0x259f, 0x2113,
+    0x03a5, 0x2263, 0x25d8, 0x039b, 0x012c, 0x0102, 0x28ae, 0x03b2,
+    0x2569, 0x2865, 0x00b5, 0x2075, 0x28e7, 0x28bc, 0x0473, 0x2562,
+    0x00eb, 0x283f, 0x0324, 0x25ae, 0x25bf, 0x2878, 0x2036, 0x2561,
+    0x0126, 0x0140, 0x2858, 0x05f3, 0x2838, 0x011f, 0x28fa, 0x0392,
+    0x2879, 0x0160, 0x207b, 0x2102, 0x2524, 0x2883, 0x00ae, 0x0414,
+    0x28fb, 0x03d0, 0x0137, 0x2081, 0x286f, 0x0142, 0x04bb, 0x2033,
+    0x0496, 0x285c, 0x00c1, 0x05e8, 0x0440, 0x0374, 0x042b, 0x03aa,
+    0x2286, 0x03bf, 0x2077, 0x03ac, 0x0426, 0x03dc, 0x014d, 0x28a1,
+    0x2204, 0x2811, 0x2026, 0x25b1, 0x2245, 0x05dd, 0x256c, 0x22c0,
+    0x28b7, 0x28d8, 0x220c, 0x25a0, 0x2567, 0x2238, 0x03d3, 0x208b,
+    0x011d, 0x0475, 0x0310, 0x1e61, 0x28dd, 0x203a, 0x2079, 0x288e,
+    0x281e, 0x00dc, 0x280c, 0x2580, 0x2884, 0x045b, 0x2213, 0x289e,
+    0x0453, 0x00cb, 0x25b2, 0x0457, 0x281f, 0x05d9, 0x030a, 0x00d6,
+    0x285e, 0x1e1e, 0x2830, 0x0177, 0x259b, 0x2030, 0x21d0, 0x2284,
+    0x0415, 0x2556, 0x00e3, 0x2227, 0x23bc, 0x016f, 0x2810, 0x00f7,
+    0x2861, 0x2833, 0x0219, 0x03ba, 0x038f, 0x00f2, 0x256e, 0x0421,
+    0x2660, 0x03ec, 0x254d, 0x2510, 0x223a, 0x042d, 0x0314, 0x01fb,
+    0x015c, 0x2854, 0x1ef2, 0x25a2, 0x05e0, 0x2236, 0x288c, 0x0446,
+    0x00da, 0x01b5, 0x2020, 0x2582, 0x2851, 0x038e, 0x05e5, 0x00f6,
+    0x03d4, 0x0133, 0x284b, 0x0101, 0x2599, 0x05d7, 0x2558, 0x0167,
+    0x2554, 0x2032, 0x2025, 0x28dc, 0x282a, 0x2886, 0x27e9, 0x2080,
+    0x0175, 0x2839, 0x03e7, 0x22c3, 0x05d5, 0x2812, 0x00f9, 0x287f,
+    0x00b3, 0x1ef3, 0x0100, 0x03a1, 0x00ec, 0x0451, 0x015f, 0x00e5,
+    0x2876, 0x00c7, 0x28d5, 0x00d5, 0x288a, 0x03ef, 0x2663, 0x03bd,
+    0x2852, 0x22c5, 0x1e83, 0x215d, 0x256b, 0x011e, 0x05da, 0x0166,
+    0x21a8, 0x017a, 0x015b, 0x2899, 0x00a0, 0x2849, 0x2808, 0x2552,
+    0x288b, 0x2248, 0x0391, 0x0170, 0x2597, 0x222b, 0x2302, 0x043b,
+    0x2201, 0x00cf, 0x04ba, 0x28be, 0x0303, 0x041a, 0x010d, 0x28ff,
+    0x0490, 0x00a4, 0x22c1, 0x286b, 0x0432, 0x258a, 0x201c, 0x0120,
+    0x21d3, 0x25cb, 0x037a, 0x28f3, 0x00ee, 0x2896, 0x017d, 0x2664,
+    0x28d2, 0x2070, 0x28ed, 0x011b, 0x2885, 0x03ed, 0x2661, 0x28b1,
+    0x2850, 0x02bb, 0x0405, 0x28f2, 0x04b3, 0x2863, 0x201a, 0x00aa,
+    0x280a, 0x28c9, 0x253c, 0x0122, 0x2895, 0x28d0, 0x03c0, 0x0442,
+    0x2234, 0x021b, 0x2877, 0x2595, 0x228b, 0x043f, 0x2300, 0x2550,
+    0x00cd, 0x281d, 0x287e, 0x0301, 0x044a, 0x2856, 0x00de, 0x2087,
+    0x28cf, 0x039d, 0x05dc, 0x03f4, 0x04ef, 0x0163, 0x0412, 0x2869,
+    0x287a, 0x013e, 0x05e3, 0x250c, 0x0123, 0x20a3, 0x2501, 0x28ac,
+    0x0115, 0x2202, 0x00a7, 0x02bd, 0x03eb, 0x28e3, 0x04e8, 0x2824,
+    0x012a, 0x207e, 0x0116, 0x03b0, 0x039c, 0x287d, 0x2816, 0x00d4,
+    0x2243, 0x25b8, 0x2857, 0x254e, 0x010c, 0x0305, 0x2014, 0x222e,
+    0x01fc, 0x0395, 0x20d7, 0x05d1, 0x28c7, 0x0387, 0x1e0b, 0x286e,
+    0x00b9, 0x28ba, 0x1e57, 0x0307, 0x21a5, 0x2564, 0x0409, 0x28f0,
+    0x2027, 0x225f, 0x03f2, 0x0309, 0x2298, 0x28da, 0x0258, 0x042a,
+    0x2299, 0x00be, 0x280e, 0x2566, 0x289a, 0x00ff, 0x28a4, 0x28f4,
+    0x28a2, 0x263c, 0x201b, 0x2309, 0x258d, 0x2116, 0x2800, 0x286c,
+    0x0401, 0x25ba, 0x28bd, 0x0420, 0x045e, 0x049b, 0x00d2, 0x2806,
+    0x2211, 0x03df, 0x212e, 0x010a, 0x00bc, 0x2828, 0x28ee, 0x014b,
+    0x0119, 0x2229, 0x041f, 0x2225, 0x283b, 0x0389, 0x2870, 0x00c9,
+    0x01a0, 0x2822, 0x014c, 0x041c, 0x00b1, 0x02d8, 0x2583, 0x02bc,
+    0x03d2, 0x2836, 0x25c2, 0x2584, 0x017f, 0x2218, 0x00ab, 0x25c5,
+    0x02dd, 0x254f, 0x2557, 0x2502, 0x02da, 0x03b1, 0x2581, 0x259c,
+    0x263a, 0x0422, 0x2024, 0x2282, 0x0154, 0x28af, 0x286a, 0x0121,
+    0x0136, 0x012d, 0x05d2, 0x2814, 0x0112, 0x00d0, 0x258b, 0x0174,
+    0x0423, 0x20d3, 0x2841, 0x25c0, 0x28d6, 0x03ae, 0x0149, 0x0302,
+    0x05f4, 0x2831, 0x0118, 0x045d, 0x20d4, 0x226a, 0x2089, 0x215b,
+    0x28e5, 0x0470, 0x01e7, 0x038a, 0x28f7, 0x03c3, 0x256a, 0x013c,
+    0x2834, 0x208e, 0x2044, 0x017e, 0x2875, 0x00a5, 0x28b9, 0x25c3,
+    0x00ba, 0x2642, 0x01fd, 0x0375, 0x2847, 0x2553, 0x25a3, 0x2078,
+    0x04ae, 0x2665, 0x03b9, 0x0156, 0x2190, 0x28a9, 0x00b8, 0x041d,
+    0x20d5, 0x22a8, 0x23ba, 0x21d2, 0x2568, 0x042e, 0x00a2, 0x2555,
+    0x2534, 0x263f, 0x22a3, 0x05f1, 0x0441, 0x2594, 0x0147, 0x280d,
+    0x282d, 0x21a4, 0x2283, 0x0437, 0x00cc, 0x259d, 0x00c5, 0x014f,
+    0x2288, 0x0135, 0x25ca, 0x2296, 0x2819, 0x2226, 0x0131, 0x013a,
+    0x010e, 0x22a5, 0x05de, 0x03e8, 0x040a, 0x0424, 0x25c1, 0x03de,
+    0x04af, 0x28ab, 0x2039, 0x03ad, 0x03a0, 0x28e8, 0x207a, 0x2874,
+    0x03e3, 0x28b3, 0x010b, 0x2809, 0x00f0, 0x220b, 0x00fe, 0x04e9,
+    0x255a, 0x20a7, 0x03a4, 0x01d2, 0x0117, 0x03e4, 0x28df, 0x28ad,
+    0x2124, 0x0104, 0x25e6, 0x03d6, 0x266a, 0x2212, 0x2010, 0x280f,
+    0x25ab, 0x05e9, 0x0431, 0x0472, 0x044f, 0x00c3, 0x25b3, 0x049a,
+    0x038c, 0x2600, 0x28aa, 0x0124, 0x03cd, 0x2641, 0x2891, 0x2264,
+    0x0108, 0x259e, 0x0179, 0x0404, 0x00a1, 0x2843, 0x25b5, 0x25ad,
+    0x00e2, 0x013d, 0x0436, 0x03af, 0x02c9, 0x207c, 0x2074, 0x0462,
+    0x012f, 0x03e1, 0x04d8, 0x010f, 0x2864, 0x039e, 0x0419, 0x05f0,
+    0x00ad, 0x2321, 0x0456, 0x20ac, 0x00ea, 0x2209, 0x0169, 0x28c5,
+    0x223d, 0x041e, 0x2804, 0x2820, 0x2105, 0x016b, 0x05f2, 0x2221,
+    0x282c, 0x28f9, 0x0433, 0x220f, 0x2083, 0x2022, 0x28b0, 0x2826,
+    0x017c, 0x2210, 0x2559, 0x00fa, 0x1e85, 0x0455, 0x04ee, 0x2084,
+    0x0491, 0x20d0, 0x04b1, 0x230b, 0x03f0, 0x208a, 0x25af, 0x28c6,
+    0x28a7, 0x0428, 0x0113, 0x28bb, 0x25d9, 0x2076, 0x00ce, 0x2866,
+    0x2825, 0x0306, 0x2035, 0x2207, 0x2862, 0x016e, 0x25b0, 0x28e0,
+    0x2503, 0x03a8, 0x288f, 0x03bc, 0x015e, 0x28db, 0x28ca, 0x00db,
+    0x211d, 0x2818, 0x201d, 0x2666, 0x0141, 0x2859, 0x018f, 0x015d,
+    0x223b, 0x03cb, 0x2262, 0x0105, 0x284e, 0x28b2, 0x28ce, 0x017b,
+    0x2016, 0x1e41, 0x05e2, 0x03c9, 0x05e7, 0x0134, 0x284c, 0x285b,
+    0x044c, 0x05d8, 0x0400, 0x00dd, 0x043e, 0x00b2, 0x03ce, 0x045a,
+    0x259a, 0x03e0, 0x1e40, 0x2287, 0x0172, 0x0497, 0x012b, 0x2823,
+    0x2205, 0x014e, 0x0168, 0x2860, 0x05d6, 0x284a, 0x00a9, 0x255e,
+    0x00f1, 0x256d, 0x288d, 0x03be, 0x28d9, 0x0406, 0x254c, 0x287b,
+    0x042c, 0x0313, 0x01fa, 0x28b4, 0x2835, 0x0311, 0x0162, 0x215e,
+    0x2593, 0x2310, 0x240b, 0x03c7, 0x25b6, 0x00af, 0x0386, 0x25bc,
+    0x240d, 0x2572, 0x0417, 0x2560, 0x0449, 0x0132, 0x0106, 0x03b7,
+    0x00e9, 0x0173, 0x00df, 0x255b, 0x2845, 0x00b0, 0x251c, 0x03c1,
+    0x28a8, 0x27e8, 0x255d, 0x0402, 0x28e9, 0x041b, 0x0129, 0x23bd,
+    0x0103, 0x2289, 0x28a3, 0x2846, 0x2832, 0x0308, 0x00d8, 0x0492,
+    0x0450, 0x012e, 0x00e4, 0x00b4, 0x282e, 0x28a5, 0xffff, 0x011c,
+    0x040c, 0x03ee, 0x2662, 0x2308, 0x0430, 0x2827, 0x05e1, 0x0396,
+    0x03c6, 0x05db, 0x0447, 0x266b, 0x0145, 0x0158, 0x25be, 0x0454,
+    0x289d, 0x00e8, 0x04b0, 0x2871, 0x2889, 0x2848, 0x2071, 0x2596,
+    0x222a, 0x0143, 0x01ff, 0x043a, 0x040e, 0x1e03, 0x2239, 0x2514,
+    0x284d, 0x01e6, 0x2868, 0x0176, 0x00c4, 0x03dd, 0x23bb, 0x0152,
+    0x0107, 0x2126, 0x287c, 0x0161, 0x281c, 0x04e3, 0x03a6, 0x00ed,
+    0x22f0, 0x20a4, 0x2192, 0x016c, 0x2206, 0x211a, 0x2518, 0x0416,
+    0x2285, 0x28e6, 0x0110, 0x2853, 0x2821, 0x25a1, 0x28f1, 0x2235,
+    0x0399, 0x2880, 0x22c2, 0x28e1, 0x28c8, 0x2837, 0x2085, 0x1e6b,
+    0x0471, 0x2893, 0x0130, 0x2249, 0x045c, 0x0300, 0x281a, 0x016d,
+    0x2228, 0x0111, 0x00e6, 0x01af, 0x2086, 0x201e, 0x28f6, 0x0171,
+    0x2855, 0x28fc, 0x05d3, 0x0463, 0x00c6, 0x2011, 0x283d, 0x25cf,
+    0x03c5, 0x201f, 0x0411, 0x042f, 0x1e80, 0x00a3, 0x2892, 0x2194,
+    0x2037, 0x00e0, 0x0493, 0x28d3, 0x044b, 0x03f5, 0x00f3, 0x03ea,
+    0x2259, 0x282f, 0x0159, 0x2894, 0x285d, 0x1e60, 0x0438, 0x016a,
+    0x0443, 0x2573, 0x00d7, 0x280b, 0x28cc, 0x281b, 0x03c8, 0x0403,
+    0x0434, 0x0304, 0x284f, 0x03bb, 0x2844, 0x20d6, 0x05d0, 0x0385,
+    0x255f, 0x1e56, 0x208c, 0x00ca, 0x215c, 0x2592, 0x2669, 0x03a3,
+    0x2813, 0x01b6, 0x2551, 0x0384, 0x2898, 0x240c, 0x2260, 0x2122,
+    0x221d, 0x0413, 0x22ef, 0x21d5, 0x00fc, 0x28ec, 0x2890, 0x2565,
+    0x283c, 0x05d4, 0x28d1, 0x0165, 0x2203, 0x00a8, 0x258f, 0x28e2,
+    0x25c6, 0x030f, 0x283a, 0x0125, 0x285f, 0x00c8, 0x0427, 0x0164,
+    0x2015, 0x2817, 0x25bd, 0x21d1, 0x25b4, 0x0452, 0x03ca, 0x22a6,
+    0x2034, 0x2829, 0x04e2, 0x2842, 0x2802, 0x2590, 0x28c1, 0x2224,
+    0x28d4, 0x1e81, 0x2598, 0x2265, 0x03b4, 0x258c, 0x0388, 0x0390,
+    0x02db, 0x0407, 0x221a, 0x00bf, 0x0218, 0x2815, 0x20ab, 0x1e1f,
+    0x0259, 0x2563, 0x1e0a, 0x28fd, 0x03b3, 0x00fb, 0x2887, 0x044d,
+    0x05ea, 0x28ef, 0x03a9, 0x207d, 0x02c7, 0x0114, 0x03e6, 0x203c,
+    0x0155, 0x286d, 0x0127, 0x221f, 0x25bb, 0x2589, 0x0397, 0x045f,
+    0x2017, 0x00d3, 0x2807, 0x0393, 0x040d, 0x03c4, 0x22a4, 0x2803,
+    0x2013, 0x2882, 0x0148, 0x2570, 0x20d2, 0x00f5, 0x28c2, 0x00d1,
+    0x226b, 0x2500, 0x03da, 0x01a1, 0x258e, 0x04b2, 0x00b6, 0x01fe,
+    0x02d9, 0x0459, 0x22f1, 0x013f, 0x03f1, 0x2805, 0x2585, 0x2219,
+    0x03e9, 0x0429, 0x223c, 0x00bd, 0x0448, 0x0138, 0x043d, 0x2409,
+    0x0408, 0x03a7, 0x207f, 0x03f3, 0x21d4, 0x00b7, 0x1e82, 0x2115,
+    0x0153, 0x283e, 0x03b6, 0x25b9, 0x28ea, 0x02dc, 0x0150, 0x282b,
+    0x039f, 0x28cb, 0x28c0, 0x039a, 0x203e, 0x2200, 0x22a2, 0x0445,
+    0x0128, 0x0146, 0x011a, 0x2023, 0x25ac, 0x00d9,
+};
+
+static const uint8_t font6x9_atlas_bitmap[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0xf8, 0x50, 0xf8, 0x50, 0x50, 0x00,
+    0x20, 0x70, 0xa8, 0xa0, 0x70, 0x28, 0xa8, 0x70, 0x20, 0x40, 0xa8, 0x48,
+    0x10, 0x20, 0x48, 0x54, 0x08, 0x00, 0x00, 0x60, 0x90, 0x90, 0x60, 0x98,
+    0x90, 0x68, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x00, 0x00, 0x20, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x88, 0x50, 0xf8, 0x50,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x30, 0x00, 0x00, 0x00, 0x08, 0x08, 0x10, 0x20, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x30, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x20, 0x60,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x30, 0x48, 0x08, 0x10, 0x20,
+    0x78, 0x00, 0x00, 0x00, 0x78, 0x10, 0x30, 0x08, 0x08, 0x70, 0x00, 0x00,
+    0x00, 0x10, 0x30, 0x50, 0x90, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x78, 0x40,
+    0x70, 0x08, 0x08, 0x70, 0x00, 0x00, 0x00, 0x30, 0x40, 0x70, 0x48, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x78, 0x08, 0x08, 0x10, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x30, 0x48, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x30, 0x48,
+    0x48, 0x38, 0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x30,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x10, 0x10, 0x20,
+    0x00, 0x00, 0x18, 0x60, 0x80, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x08, 0x30,
+    0xc0, 0x00, 0x00, 0x30, 0x48, 0x08, 0x30, 0x20, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x70, 0x90, 0xa8, 0xb0, 0x80, 0x70, 0x00, 0x00, 0x00, 0x20, 0x50,
+    0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x00, 0xf0, 0x88, 0xf0, 0x88, 0x88,
+    0xf0, 0x00, 0x00, 0x00, 0x30, 0x48, 0x40, 0x40, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x70, 0x48, 0x48, 0x48, 0x48, 0x70, 0x00, 0x00, 0x00, 0x78, 0x40,
+    0x70, 0x40, 0x40, 0x78, 0x00, 0x00, 0x00, 0x78, 0x40, 0x70, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x30, 0x48, 0x40, 0x58, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x48, 0x48, 0x78, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x70, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x38, 0x10, 0x10, 0x10, 0x90,
+    0x60, 0x00, 0x00, 0x00, 0x48, 0x50, 0x60, 0x50, 0x48, 0x48, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x78, 0x00, 0x00, 0x00, 0x88, 0xd8,
+    0xa8, 0xa8, 0x88, 0x88, 0x00, 0x00, 0x00, 0x48, 0x68, 0x58, 0x48, 0x48,
+    0x48, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x70, 0x48, 0x48, 0x70, 0x40, 0x40, 0x00, 0x00, 0x00, 0x30, 0x48,
+    0x48, 0x68, 0x58, 0x30, 0x08, 0x00, 0x00, 0x70, 0x48, 0x48, 0x70, 0x48,
+    0x48, 0x00, 0x00, 0x00, 0x30, 0x48, 0x20, 0x10, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0xf8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x48, 0x48,
+    0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x78, 0x30,
+    0x30, 0x00, 0x00, 0x00, 0x88, 0x88, 0xa8, 0xa8, 0xd8, 0x88, 0x00, 0x00,
+    0x00, 0x88, 0x50, 0x20, 0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x88, 0x88,
+    0x50, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x78, 0x08, 0x10, 0x20, 0x40,
+    0x78, 0x00, 0x00, 0x00, 0x70, 0x40, 0x40, 0x40, 0x40, 0x70, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x20, 0x10, 0x08, 0x08, 0x00, 0x00, 0x00, 0x70, 0x10,
+    0x10, 0x10, 0x10, 0x70, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+    0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x40, 0x40, 0x70, 0x48, 0x48,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x40, 0x38, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x58, 0x60, 0x38, 0x00, 0x00, 0x00, 0x10, 0x28, 0x20, 0x70, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x48, 0x38, 0x08, 0x30,
+    0x00, 0x40, 0x40, 0x70, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x60, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x10, 0x10,
+    0x10, 0x50, 0x20, 0x00, 0x40, 0x40, 0x50, 0x60, 0x50, 0x48, 0x00, 0x00,
+    0x00, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd0, 0xa8, 0xa8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x48, 0x48,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x48, 0x48, 0x70, 0x40, 0x40, 0x00, 0x00, 0x00,
+    0x38, 0x48, 0x48, 0x38, 0x08, 0x08, 0x00, 0x00, 0x00, 0x50, 0x68, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x60, 0x18, 0x70, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x70, 0x20, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x30,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xa8, 0xa8, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x30, 0x30, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x48, 0x48, 0x38, 0x48, 0x30, 0x00, 0x00, 0x00, 0x78, 0x10, 0x20,
+    0x78, 0x00, 0x00, 0x10, 0x20, 0x20, 0x40, 0x20, 0x20, 0x10, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x40, 0x20, 0x20,
+    0x10, 0x20, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x20, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x00,
+    0x38, 0x40, 0x40, 0x38, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x10, 0x20, 0x38, 0x40, 0x30, 0x08, 0x70, 0x00, 0x00,
+    0x04, 0x04, 0x08, 0x10, 0x10, 0x20, 0x40, 0x40, 0x80, 0x20, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0x00, 0x48, 0x58, 0x68, 0x48, 0x48, 0x48, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x50, 0x50, 0x88, 0xf8, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x00,
+    0x10, 0x20, 0x00, 0x88, 0x48, 0x70, 0x88, 0x08, 0x30, 0x00, 0x20, 0x20,
+    0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x80, 0x80, 0x80, 0xc0, 0x38,
+    0x20, 0x30, 0x20, 0x00, 0x00, 0x00, 0x30, 0x58, 0x60, 0x38, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x00, 0x70, 0x20, 0x20, 0xa8, 0x70, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0x50, 0x28, 0x50, 0xa0, 0x00, 0x00, 0x00, 0x10, 0x28,
+    0x20, 0x70, 0x20, 0x20, 0x20, 0x40, 0x00, 0x30, 0x48, 0x78, 0x48, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x90, 0xe0, 0x70, 0x00, 0x00, 0x00, 0x20, 0x70,
+    0xa8, 0x20, 0xa8, 0x70, 0x20, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0xa8, 0x00, 0x54, 0x00, 0xa8, 0x00, 0x54, 0x00, 0xa8,
+    0x00, 0x40, 0x48, 0x58, 0x70, 0x20, 0x20, 0x00, 0x00, 0x40, 0x20, 0x20,
+    0x50, 0x70, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x20, 0x90, 0xf8, 0x90,
+    0x20, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0xa8, 0x78, 0x08, 0xf0, 0x00,
+    0x00, 0x20, 0x70, 0xa8, 0x20, 0x20, 0x20, 0x00, 0x00, 0x48, 0x90, 0x00,
+    0x60, 0x90, 0x90, 0x60, 0x00, 0x00, 0x00, 0x10, 0x20, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x48, 0x48, 0x48, 0x38, 0x48, 0x30,
+    0x00, 0x00, 0xc0, 0xb0, 0x88, 0xb0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x28, 0x10, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x50, 0x00, 0x60, 0x20, 0x20,
+    0x70, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00,
+    0x00, 0x70, 0x88, 0xf8, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x88, 0x70, 0x00, 0x88, 0x98, 0xa8,
+    0xc8, 0x00, 0x00, 0x00, 0x88, 0x50, 0x20, 0x20, 0x50, 0x88, 0x00, 0x00,
+    0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x88, 0x50, 0x20, 0x20,
+    0x20, 0x00, 0x00, 0x10, 0x20, 0x00, 0x70, 0x48, 0x48, 0x48, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x40, 0x40, 0x38, 0x10, 0x20, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x68, 0x40, 0x40, 0x20, 0x40, 0x00, 0x00, 0x00,
+    0x90, 0xe8, 0xe8, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x48, 0x08,
+    0xf0, 0x00, 0x00, 0x20, 0x50, 0x20, 0x50, 0x70, 0x88, 0x88, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x48, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x70, 0x80, 0x80, 0x70, 0x08, 0x30,
+    0x00, 0x00, 0x70, 0xd8, 0xa8, 0xd8, 0x70, 0x00, 0x00, 0x10, 0x20, 0x00,
+    0x70, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0x00, 0x70, 0x88, 0x88, 0x70, 0x20, 0xf8, 0x20, 0x00,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x78, 0x10, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x00, 0x08, 0x08, 0x10, 0x20, 0x40, 0x40, 0x00, 0x00, 0x00, 0xf8, 0x20,
+    0x30, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x78, 0xfc, 0xb4, 0xfc, 0xb4, 0xcc, 0xfc, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x40, 0x40, 0x20, 0x00, 0x20, 0x20,
+    0x70, 0xa8, 0xa8, 0x70, 0x20, 0x20, 0x00, 0x90, 0xd0, 0xb0, 0x90, 0x20,
+    0x20, 0x20, 0x38, 0x00, 0x20, 0x20, 0xf8, 0x20, 0xf8, 0x20, 0x20, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0xa8, 0x70, 0x20, 0x00, 0x00, 0x00, 0x38, 0x40,
+    0x40, 0x38, 0x10, 0x78, 0x20, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xf8, 0x00,
+    0xf8, 0x00, 0x00, 0x28, 0x28, 0x28, 0x28, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x50, 0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x50, 0x00, 0x88,
+    0x88, 0xa8, 0xd8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xd8, 0xa8,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x10, 0x20, 0x00, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0x40, 0x78, 0x40, 0x38, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x20,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x14, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x10, 0x10, 0x20,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40, 0xe0, 0x50,
+    0x48, 0x48, 0xe8, 0xd0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x20, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x88, 0x80, 0x70, 0x08, 0x30, 0x00, 0x00, 0x00, 0x70, 0x18, 0x68,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x78, 0x84, 0xcc, 0x84, 0xb4, 0xcc,
+    0x84, 0x78, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0xf8, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x90, 0x48, 0x30, 0xf8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x10, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x54, 0x58, 0x50, 0x30, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x70, 0x40, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50,
+    0x10, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x10, 0x10, 0x10, 0x10,
+    0x00, 0x20, 0x50, 0x38, 0xd0, 0x50, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x20, 0x20, 0x70, 0xa8, 0xa8,
+    0x70, 0x20, 0x20, 0x00, 0x00, 0x70, 0xa8, 0xf8, 0xa8, 0x70, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x18, 0x08, 0x08, 0x08, 0x48, 0x30, 0x00, 0x00, 0x00,
+    0x38, 0x58, 0x68, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x10, 0x40, 0x40, 0x40, 0x40, 0x78, 0x00, 0x00,
+    0x10, 0x28, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00, 0x48, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x88, 0x50, 0x20, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x20, 0x50, 0x20,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x70, 0x00, 0x00, 0x00, 0x48, 0x68,
+    0x58, 0x48, 0x48, 0x48, 0x08, 0x10, 0x20, 0x00, 0xf0, 0x88, 0xf0, 0x88,
+    0xf0, 0x00, 0x00, 0x10, 0x10, 0x10, 0x20, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0x00, 0x10, 0x28, 0x28, 0x30, 0x20, 0x58, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0xf8, 0x00,
+    0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xfc, 0xfc, 0xcc, 0x84, 0x84, 0xcc,
+    0xfc, 0xfc, 0xfc, 0x00, 0x20, 0x20, 0x50, 0x50, 0x88, 0x88, 0x00, 0x00,
+    0x48, 0x30, 0x00, 0x38, 0x10, 0x10, 0x38, 0x00, 0x00, 0x90, 0x60, 0x20,
+    0x50, 0x70, 0x88, 0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x30, 0x48, 0x70, 0x48, 0x48, 0x70, 0x40, 0x40,
+    0x28, 0x28, 0x28, 0xec, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x58,
+    0x68, 0x40, 0x00, 0x00, 0x70, 0x40, 0x60, 0x10, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x70, 0xa8, 0xd8,
+    0x70, 0x00, 0x00, 0x28, 0x28, 0x28, 0x28, 0xe8, 0x28, 0x28, 0x28, 0x28,
+    0x00, 0x28, 0x00, 0x30, 0x58, 0x60, 0x38, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x50, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x90, 0x90, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x10, 0x10,
+    0x00, 0x50, 0xf8, 0x50, 0x70, 0x50, 0x50, 0x00, 0x00, 0x00, 0x60, 0x20,
+    0x28, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x30, 0x00,
+    0x30, 0x48, 0x48, 0x38, 0x08, 0x30, 0x00, 0x10, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x00, 0xf0, 0x88, 0xf0, 0x88, 0x88, 0xf0, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x28, 0x10, 0x38,
+    0x40, 0x30, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xa8, 0xa0, 0xa0, 0xa8, 0x70, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x10, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x78, 0x84, 0xb4, 0xa4, 0xa4, 0x84,
+    0x78, 0x00, 0x00, 0x00, 0x30, 0x50, 0x50, 0x50, 0x50, 0xf8, 0x88, 0x00,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x60, 0x90,
+    0x90, 0xf0, 0x88, 0x70, 0x00, 0x00, 0x00, 0x40, 0x40, 0x50, 0x60, 0x50,
+    0x48, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x20, 0x20, 0x70,
+    0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x60, 0x20,
+    0x30, 0x60, 0x20, 0x70, 0x00, 0x00, 0x00, 0x40, 0x40, 0x70, 0x48, 0x48,
+    0x48, 0x00, 0x00, 0x00, 0x48, 0x48, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa8, 0xa8, 0x70, 0xa8, 0xa8, 0xac, 0x04, 0x04, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10, 0x20, 0x20, 0x50, 0x70, 0x88,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf0, 0x88, 0x88, 0xf0, 0x80, 0x80, 0x10, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xe8, 0x98, 0x98,
+    0xe8, 0x00, 0x00, 0x50, 0x00, 0x70, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    0x00, 0x38, 0x40, 0x40, 0x38, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x70, 0x10, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00,
+    0x00, 0x90, 0x90, 0x90, 0x90, 0x90, 0xf8, 0x08, 0x10, 0x00, 0xf8, 0x80,
+    0x80, 0xe0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x30, 0x48, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0x20, 0x78, 0x28, 0x38, 0x28, 0x28, 0x78, 0x20, 0x00, 0x00, 0x40, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x88, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x50, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x48, 0x48, 0x78, 0x00, 0x00, 0x28, 0x28, 0x28, 0xec, 0x00, 0xec,
+    0x28, 0x28, 0x28, 0x20, 0x20, 0x50, 0x50, 0x50, 0x88, 0x88, 0x88, 0x00,
+    0x00, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x20, 0x70, 0x28, 0x78, 0x28,
+    0x70, 0x20, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x28, 0x60, 0xa0, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+    0x10, 0x28, 0x00, 0x30, 0x48, 0x48, 0x38, 0x08, 0x30, 0x00, 0x00, 0x00,
+    0x40, 0x58, 0x30, 0x20, 0x00, 0x00, 0xa8, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x60, 0x18, 0x70, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x20, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00, 0x20, 0x50, 0x30, 0x10, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x28, 0x00, 0x48,
+    0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x40, 0xe0,
+    0x40, 0x70, 0x48, 0x48, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x20, 0x20, 0xf8,
+    0x20, 0x20, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x10, 0x00,
+    0x10, 0x20, 0x00, 0x78, 0x40, 0x40, 0x40, 0x00, 0x00, 0x28, 0x00, 0x78,
+    0x40, 0x70, 0x40, 0x78, 0x00, 0x00, 0x00, 0x20, 0x20, 0x70, 0x70, 0xf8,
+    0xf8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x00, 0x78,
+    0x40, 0x70, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x28, 0x00, 0x48, 0x48, 0x48, 0x38, 0x48, 0x30,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x40, 0xa8, 0x48,
+    0x10, 0x20, 0x68, 0xd4, 0x28, 0x00, 0x00, 0x00, 0x20, 0x78, 0x80, 0x78,
+    0x20, 0x00, 0x00, 0x00, 0x10, 0x38, 0x50, 0x50, 0x38, 0x10, 0x00, 0x00,
+    0x00, 0x78, 0x40, 0x70, 0x40, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x28, 0x28, 0x28, 0x28, 0x28, 0x50, 0x00, 0x38, 0x48, 0x48,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x50, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x30, 0x48, 0x30,
+    0x48, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xf8, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
+    0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x60, 0x18,
+    0x70, 0x10, 0x20, 0x00, 0x00, 0x00, 0x48, 0x50, 0x60, 0x58, 0x00, 0x00,
+    0x80, 0xb0, 0x48, 0x48, 0x48, 0x30, 0x78, 0x00, 0x00, 0x20, 0x10, 0x00,
+    0x30, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x20,
+    0x10, 0x10, 0x10, 0x00, 0x30, 0x48, 0x40, 0x40, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x20, 0x70, 0xf8, 0xf8, 0x20, 0x70, 0x00, 0x00, 0x00, 0x08, 0x70,
+    0x80, 0xf0, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x10, 0x10, 0x10, 0x10,
+    0x00, 0x00, 0x88, 0x00, 0xf8, 0x00, 0x88, 0x00, 0x00, 0x00, 0x70, 0x88,
+    0x38, 0x08, 0x88, 0x70, 0x00, 0x00, 0x30, 0x20, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x10, 0x28, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00,
+    0x10, 0x28, 0x38, 0x40, 0x30, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x20, 0x88, 0x50, 0x20, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x08, 0x08, 0x78, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x90, 0xf8, 0x08, 0x10,
+    0x10, 0x20, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x78, 0x08,
+    0x78, 0x20, 0x40, 0x78, 0x00, 0x00, 0x00, 0x20, 0x20, 0xf8, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0xa8, 0x28,
+    0x28, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x48, 0x50,
+    0x60, 0x40, 0x40, 0x00, 0x28, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0xa0, 0x00, 0x90, 0xa8, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x88, 0x00,
+    0x98, 0x88, 0x88, 0x88, 0x28, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x38, 0x00, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00,
+    0xe0, 0xe0, 0xe0, 0xe0, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00,
+    0xf8, 0x48, 0x48, 0x48, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1c, 0x10, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x70, 0x70, 0x28, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3c, 0x20, 0x2c, 0x28, 0x28, 0x28, 0x00, 0x10, 0x10,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x20, 0x20, 0x10, 0x10, 0x10,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x50, 0x50, 0x20,
+    0x20, 0x50, 0x00, 0x88, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0xa8, 0x48, 0x08,
+    0xf0, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x48, 0x48, 0x48,
+    0x38, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00,
+    0x00, 0x60, 0x10, 0x20, 0x10, 0x60, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00,
+    0x48, 0x48, 0x48, 0x38, 0x48, 0x30, 0x70, 0x00, 0x20, 0x50, 0x70, 0x88,
+    0x88, 0x00, 0x00, 0x00, 0x70, 0x48, 0x48, 0x70, 0x40, 0x40, 0x00, 0x00,
+    0x40, 0x20, 0x00, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x30, 0x48, 0x70, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x60, 0x18,
+    0x70, 0x10, 0x20, 0x10, 0x28, 0x10, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x30, 0x48,
+    0x40, 0x40, 0x48, 0x30, 0x10, 0x20, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x28, 0x50, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x30,
+    0x20, 0xf8, 0xa0, 0x20, 0x60, 0x20, 0x20, 0x70, 0xa8, 0xf8, 0xa8, 0x20,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x88, 0xa8, 0xa8,
+    0x50, 0x00, 0x00, 0xe0, 0x80, 0xc0, 0x30, 0xe8, 0x10, 0x28, 0x10, 0x00,
+    0x28, 0x28, 0x28, 0x28, 0xfc, 0x28, 0x28, 0x28, 0x28, 0x48, 0x30, 0x38,
+    0x40, 0x58, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x00, 0xf8, 0x20, 0x20, 0x70, 0x20, 0x20, 0x00, 0x00,
+    0x20, 0x70, 0xa8, 0x20, 0xa8, 0x70, 0x20, 0xf8, 0x00, 0x10, 0x20, 0x00,
+    0x78, 0x10, 0x20, 0x78, 0x00, 0x00, 0x10, 0x20, 0x00, 0x38, 0x60, 0x18,
+    0x70, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x10, 0x1c, 0x10, 0x10, 0x10,
+    0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0xa8, 0x50, 0xa8, 0x10, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0xf8, 0x88,
+    0x88, 0x00, 0x00, 0x48, 0x90, 0x00, 0x90, 0x90, 0x90, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x10, 0x28, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0xa0, 0x40, 0x00, 0x20, 0x50, 0x88, 0x88, 0x88,
+    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x48, 0x48, 0x88, 0x00, 0x00,
+    0x00, 0x20, 0x50, 0x40, 0x40, 0x40, 0x50, 0x20, 0x00, 0x50, 0x00, 0x70,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x80, 0x80, 0xf0, 0x88, 0x88,
+    0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00,
+    0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x50,
+    0x60, 0x50, 0x48, 0x48, 0x00, 0x00, 0x28, 0x10, 0x00, 0x38, 0x40, 0x40,
+    0x38, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00,
+    0x08, 0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0xa8,
+    0x50, 0x88, 0x50, 0xa8, 0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x50, 0x50,
+    0x20, 0x20, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x50, 0x68, 0x70, 0x00, 0x00, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x48, 0x90, 0xd8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x40, 0x58, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x50, 0x50, 0x50, 0xd8, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x30, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50, 0x00,
+    0x20, 0x50, 0x00, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x40, 0x00, 0x10, 0x00, 0x28, 0x10, 0x78, 0x10, 0x20, 0x40,
+    0x78, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0xf8, 0x20, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x20, 0x50,
+    0x50, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x28, 0x10, 0x00, 0x30, 0x58, 0x60, 0x38, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08,
+    0x70, 0x80, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x50, 0xa8, 0x88, 0x88, 0x50,
+    0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x20,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x20, 0x10, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x30, 0x30, 0x48, 0x04, 0x04, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x10, 0x20, 0x00, 0x30, 0x50, 0x30, 0x00, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x10, 0x10, 0x10, 0xfc, 0x10,
+    0x10, 0x10, 0x10, 0x00, 0x30, 0x48, 0x40, 0x58, 0x48, 0x30, 0x10, 0x20,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x50, 0x50,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x70, 0x20, 0x28, 0x10, 0x10, 0x20, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x70, 0x08, 0x08, 0x70, 0x10, 0x78, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x78, 0x98, 0xa8, 0xc8,
+    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00,
+    0x10, 0x20, 0x70, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0x70, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x40, 0x70, 0x48, 0x48, 0x70,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x20, 0x20, 0x20,
+    0x00, 0x50, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x48, 0x68,
+    0x58, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x80, 0x80, 0xf8, 0x08, 0x10,
+    0x60, 0x00, 0x00, 0x00, 0x70, 0x88, 0xf8, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x48, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x70, 0x20, 0x28, 0x10, 0x10, 0x20, 0x00, 0xf0, 0x88, 0xf0, 0x88, 0x88,
+    0xf0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x20, 0x60,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x48, 0x48,
+    0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x10, 0x10, 0x10, 0x10,
+    0x00, 0x10, 0x20, 0x30, 0x48, 0x48, 0x38, 0x08, 0x30, 0x00, 0xf8, 0x80,
+    0xe8, 0xb0, 0xa0, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00,
+    0x48, 0x30, 0x00, 0x30, 0x58, 0x60, 0x38, 0x00, 0x00, 0x00, 0x30, 0x08,
+    0x38, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x38, 0x40, 0x30, 0x48, 0x30,
+    0x08, 0x70, 0x00, 0x00, 0x30, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xa8, 0x20, 0x50, 0x70, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x70, 0x88, 0xf8, 0x88, 0x88,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x70, 0x00, 0x70, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x20, 0x10,
+    0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x78, 0x40, 0x70, 0x40,
+    0x78, 0x00, 0x00, 0x20, 0xa8, 0x00, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x88, 0xd8, 0xa8, 0xa8, 0x88, 0x88, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x10, 0x28, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x78, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x00,
+    0x28, 0x10, 0x30, 0x48, 0x40, 0x48, 0x30, 0x00, 0x00, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x28, 0x20, 0x70, 0xa8, 0x70, 0x20, 0xa0, 0x40,
+    0x10, 0x20, 0x78, 0xa0, 0xf0, 0xa0, 0xb8, 0x00, 0x00, 0x00, 0x78, 0x40,
+    0x70, 0x40, 0x40, 0x78, 0x00, 0x00, 0x10, 0xf8, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x10, 0x10, 0xf8, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x08, 0x38, 0x48, 0x48,
+    0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00,
+    0x00, 0x20, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x50, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x70, 0x48, 0x48,
+    0x70, 0x40, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x70, 0xa8, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0xfc, 0x10, 0x10, 0x10, 0x00, 0x60, 0xa0, 0xb0, 0xa8, 0xa8,
+    0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x60, 0x10, 0x20,
+    0x00, 0x20, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80,
+    0x78, 0x00, 0x00, 0x60, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x98, 0xa8, 0xc8, 0x70, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30, 0x68, 0x18,
+    0x70, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x70, 0x48, 0x48, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x88, 0xa8, 0x88, 0x70, 0x00, 0x00, 0xc0, 0x20, 0x40,
+    0x30, 0xf0, 0x30, 0x78, 0x10, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xec, 0x28, 0x28, 0x28,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x28, 0x00,
+    0x48, 0x48, 0x48, 0x38, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x20, 0xa8,
+    0x70, 0xd8, 0x70, 0xa8, 0x20, 0x00, 0x00, 0x30, 0x20, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x90, 0xd0,
+    0xd0, 0xb8, 0xb4, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00,
+    0x28, 0x00, 0x78, 0x40, 0x70, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x70, 0x48, 0x48, 0x70, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x48, 0x30, 0x00, 0x88, 0x88, 0x78, 0x08, 0x70, 0x00, 0x00, 0x00,
+    0x48, 0x50, 0x70, 0x48, 0x04, 0x04, 0x20, 0x10, 0x30, 0x48, 0x48, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x40, 0x20, 0x20, 0x40, 0xf8, 0x00, 0x00, 0x00, 0x20, 0x40,
+    0x80, 0xf8, 0x08, 0x10, 0x20, 0x20, 0x00, 0x00, 0x70, 0xd8, 0xf8, 0xc0,
+    0x70, 0x00, 0x00, 0x10, 0x00, 0x30, 0x48, 0x40, 0x48, 0x30, 0x00, 0x00,
+    0x40, 0xc0, 0x40, 0x50, 0x70, 0x30, 0x78, 0x10, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x48, 0x48, 0x48, 0x08, 0x10,
+    0x00, 0x00, 0x00, 0x30, 0x58, 0x60, 0x38, 0x20, 0x10, 0x00, 0x00, 0x00,
+    0x70, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0xf8, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0xa8, 0x28,
+    0x38, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x10, 0x20, 0x78, 0x40, 0x70, 0x40, 0x78, 0x00, 0x00,
+    0x00, 0x64, 0x94, 0x98, 0x90, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x70, 0x88, 0x88, 0x88,
+    0x70, 0x00, 0x00, 0x00, 0x88, 0xd8, 0xa8, 0xa8, 0x88, 0x88, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0xf8, 0x00, 0x48, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+    0xfc, 0xfc, 0xfc, 0x00, 0x30, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xa8, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x78, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+    0x00, 0x10, 0x28, 0x60, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0xa0, 0x50,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc8, 0x38, 0x00, 0x00, 0x00,
+    0x48, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30,
+    0x30, 0x00, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x08, 0xe8,
+    0x28, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x20, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x78, 0x84, 0xcc, 0x84, 0xcc, 0xb4, 0x84, 0x78, 0x00, 0x00, 0xf8, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x40, 0x38, 0x00, 0x00, 0x00,
+    0x10, 0x20, 0x70, 0x48, 0x70, 0x50, 0x48, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x30, 0x48, 0x48, 0x38, 0x08, 0x30,
+    0x00, 0x48, 0x50, 0x60, 0x50, 0x48, 0x48, 0x20, 0x40, 0x48, 0x30, 0x00,
+    0x30, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x30,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x78, 0x40, 0x70, 0x40, 0x78, 0x00, 0x00, 0x00, 0x70, 0x48,
+    0xe8, 0x48, 0x48, 0x70, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0x20, 0x50, 0x00, 0x88, 0xa8, 0xd8, 0x88, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x88, 0x78, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x18, 0x78, 0xf8, 0x78, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10, 0x20, 0x00,
+    0xb0, 0xc8, 0x88, 0x88, 0x08, 0x08, 0x00, 0xc0, 0x40, 0xb0, 0x28, 0x28,
+    0x28, 0x00, 0x00, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0x70, 0x40, 0x40,
+    0x78, 0x20, 0x10, 0x40, 0x20, 0x00, 0x88, 0x98, 0xa8, 0xc8, 0x00, 0x00,
+    0xb0, 0xc8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0x50, 0xa0, 0x50, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50,
+    0x30, 0x10, 0x20, 0x40, 0xc0, 0x40, 0x50, 0x68, 0x10, 0x28, 0x10, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0xa8, 0xa8,
+    0xa8, 0x70, 0x20, 0x20, 0x00, 0x00, 0x28, 0x10, 0x00, 0x30, 0x48, 0x48,
+    0x38, 0x08, 0x30, 0x80, 0xb8, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x90, 0x88, 0x70, 0x00, 0x00, 0x10, 0x10, 0x10, 0xfc, 0x10, 0xfc,
+    0x10, 0x10, 0x10, 0x00, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x40,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x10, 0x10, 0x10, 0x20, 0x00, 0x08, 0x08, 0x10, 0x20, 0x40,
+    0x40, 0x00, 0x00, 0x28, 0x10, 0x00, 0x78, 0x10, 0x20, 0x78, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x88, 0x50,
+    0xf8, 0x20, 0xf8, 0x20, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x18, 0x68, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x50, 0x20, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0c,
+    0x14, 0x70, 0x88, 0x88, 0x70, 0x00, 0x10, 0x20, 0x00, 0x70, 0xa8, 0xb0,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3c, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0xf8, 0x88, 0xa8, 0x88,
+    0xf8, 0x00, 0x00, 0x00, 0x20, 0x50, 0x20, 0x50, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x50, 0xf8,
+    0xf8, 0xf8, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x50,
+    0x20, 0x00, 0x00, 0x00, 0x70, 0x48, 0x48, 0x70, 0x48, 0x48, 0x20, 0x40,
+    0x00, 0x00, 0x20, 0x40, 0xf8, 0x40, 0x20, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x20, 0x00, 0x48, 0x48, 0x78, 0x48, 0x48, 0x48, 0x00, 0x00,
+    0x68, 0x98, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xf8, 0x80, 0xf8, 0x80, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf0, 0x08, 0xf0, 0x20, 0x00, 0x00,
+    0x28, 0x28, 0x28, 0x28, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xa8,
+    0xe8, 0xe8, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x50, 0x50,
+    0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x10, 0xf0, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x88, 0x70, 0x88,
+    0x88, 0x70, 0x20, 0xf8, 0x20, 0x00, 0x00, 0x00, 0x08, 0x08, 0xf8, 0x08,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x48, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x78, 0x00, 0x00, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x10, 0x48, 0x68, 0x58, 0x48,
+    0x48, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x48, 0xf8, 0x48, 0x20, 0x00, 0x00, 0x00, 0x00, 0x70, 0x08, 0x08, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x28, 0x18, 0x70, 0x00, 0x00,
+    0x40, 0x20, 0x70, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x20, 0x50, 0x70, 0x88,
+    0x88, 0x00, 0x00, 0x48, 0x30, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x10, 0x38, 0x50, 0x50, 0x38, 0x10, 0x78, 0x10, 0x00, 0x10, 0x28, 0x00,
+    0x30, 0x10, 0x10, 0x10, 0x50, 0x20, 0x00, 0x20, 0x50, 0x50, 0x88, 0x50,
+    0x50, 0x20, 0x00, 0x00, 0x00, 0x70, 0x88, 0xf8, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x58,
+    0x70, 0xd0, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x20,
+    0x70, 0x00, 0x00, 0x20, 0x40, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    0x28, 0x10, 0x70, 0x48, 0x48, 0x48, 0x70, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xa8, 0x48,
+    0x98, 0x00, 0x00, 0x00, 0x70, 0x88, 0x08, 0x70, 0x80, 0x78, 0x00, 0x00,
+    0x00, 0xa0, 0xa0, 0xf0, 0xa8, 0xa8, 0xb0, 0x00, 0x00, 0x00, 0x20, 0x70,
+    0xa8, 0xa8, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x18, 0x68, 0x88, 0x68,
+    0x18, 0x00, 0x00, 0x00, 0x80, 0x88, 0x98, 0xa8, 0xc8, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x00, 0x50, 0x00,
+    0x40, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x20,
+    0x10, 0x00, 0x00, 0x08, 0x10, 0x00, 0x30, 0x58, 0x60, 0x38, 0x00, 0x00,
+    0x00, 0x78, 0x48, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0xa8, 0x78, 0x08, 0xf0, 0x00, 0x00, 0x40, 0x00,
+    0x50, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x38, 0x40, 0x40,
+    0x38, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x30, 0x08, 0x38, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x08, 0x78, 0x08, 0x70, 0x00, 0x00, 0x00, 0x40, 0x40, 0x70, 0x48, 0x48,
+    0x70, 0x40, 0x40, 0x00, 0x00, 0x00, 0x30, 0x78, 0x48, 0x30, 0x00, 0x00,
+    0x28, 0x28, 0x28, 0x2c, 0x20, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x60, 0x50,
+    0xf8, 0x50, 0x60, 0x40, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x00, 0x28, 0x10, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x30, 0x58, 0x60, 0x38, 0x00, 0x00, 0x00, 0x48, 0xa8,
+    0x88, 0x78, 0x08, 0x08, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00,
+    0x00, 0xf8, 0x28, 0x50, 0x50, 0xa0, 0xf8, 0x00, 0x00, 0x00, 0x20, 0x50,
+    0x88, 0xf8, 0x88, 0x88, 0x10, 0x08, 0x00, 0x00, 0x30, 0x48, 0x48, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x88, 0xa8, 0x50, 0x00, 0x00,
+    0x00, 0x30, 0x28, 0x20, 0x20, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x50, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0xe8, 0x88, 0xf0, 0x00, 0x00, 0x08, 0x30, 0x40, 0x70, 0x48, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x70, 0x88, 0xf8, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x90, 0x70, 0x90, 0x00, 0x00, 0x28, 0x50, 0x20,
+    0x50, 0x70, 0x88, 0x88, 0x00, 0x00, 0x00, 0x20, 0x20, 0x50, 0x50, 0x88,
+    0xf8, 0x00, 0x00, 0x00, 0x48, 0x50, 0x60, 0x50, 0x48, 0x48, 0x04, 0x04,
+    0x80, 0xb0, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x20, 0xa8,
+    0x70, 0xf8, 0x70, 0xa8, 0x20, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x28, 0x00, 0x48, 0x78, 0x48, 0x48, 0x00, 0x00,
+    0x10, 0x20, 0x00, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x20, 0xf8,
+    0x20, 0x70, 0x88, 0x88, 0x70, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x18, 0x60, 0x80, 0x60, 0x98, 0x60, 0x18, 0x00,
+    0x10, 0x28, 0x30, 0x48, 0x40, 0x48, 0x30, 0x00, 0x00, 0x1c, 0x1c, 0x1c,
+    0x1c, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x10, 0x20, 0x78, 0x10, 0x20, 0x40,
+    0x78, 0x00, 0x00, 0x00, 0x70, 0x88, 0xe0, 0x80, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x20, 0x50, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x88, 0xf8, 0x00, 0x00, 0x00,
+    0x10, 0x28, 0x00, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00, 0x28, 0x10, 0x40,
+    0x40, 0x40, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x70, 0x70,
+    0xa8, 0x00, 0x00, 0x20, 0x40, 0x00, 0x40, 0x40, 0x50, 0x20, 0x00, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x70, 0x10, 0x10,
+    0x00, 0x00, 0x00, 0x40, 0xe0, 0x40, 0x70, 0x48, 0x48, 0x70, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x60, 0x20, 0x20, 0x70, 0x20, 0x10, 0x00, 0xe0, 0x10,
+    0x30, 0x48, 0x18, 0x28, 0x08, 0x08, 0x00, 0x30, 0x48, 0x08, 0x78, 0x48,
+    0x30, 0x00, 0x00, 0x50, 0x28, 0x08, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x78, 0x00,
+    0x30, 0x00, 0x00, 0x78, 0x00, 0x00, 0x48, 0x30, 0x48, 0x58, 0x68, 0x48,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x48, 0x48, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x50, 0x20, 0x00, 0x00, 0x20, 0x00, 0x60, 0x20, 0x20,
+    0x70, 0x00, 0x00, 0x00, 0x38, 0x40, 0xf0, 0xf0, 0x40, 0x38, 0x00, 0x00,
+    0x10, 0x28, 0x00, 0x30, 0x58, 0x60, 0x38, 0x00, 0x00, 0x00, 0x10, 0x38,
+    0x50, 0x78, 0x50, 0x38, 0x10, 0x00, 0x28, 0x50, 0x00, 0x48, 0x48, 0x48,
+    0x38, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x28, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x80, 0x40, 0x10, 0x28, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00,
+    0x48, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x48, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x20, 0x50, 0x90, 0xf8, 0x10, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x10, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0x40,
+    0x40, 0x00, 0x00, 0xf8, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x10, 0x20, 0x10, 0x60, 0x00, 0x00, 0x30,
+    0x78, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x78, 0x10, 0x20, 0x78, 0x00, 0x00, 0x50, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0xf8, 0x00, 0x28, 0x28, 0x28, 0x28, 0x3c, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x48, 0x48, 0x48, 0x38, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x88, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x60, 0x18, 0x70, 0x00, 0x00, 0x78, 0x00, 0x48, 0x48, 0x48, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x70, 0x10, 0x10,
+    0x00, 0x00, 0x08, 0x78, 0x40, 0x40, 0x40, 0x00, 0x00, 0x40, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50,
+    0xf8, 0x20, 0x20, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x48, 0x70, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x70, 0x20, 0x00, 0x78, 0x48, 0x48, 0x48, 0x48,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0xa8, 0xa8,
+    0xa8, 0xa8, 0xa8, 0xf8, 0x00, 0x00, 0x00, 0x78, 0x00, 0x30, 0x58, 0x60,
+    0x38, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00, 0x10, 0x00,
+    0xfc, 0xfc, 0xcc, 0xb4, 0xb4, 0xcc, 0xfc, 0xfc, 0xfc, 0x00, 0x20, 0x40,
+    0x60, 0x50, 0x20, 0x00, 0x00, 0x00, 0x20, 0x50, 0x70, 0x20, 0x20, 0x20,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x88, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x88, 0x50, 0x50, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40, 0x00, 0x30, 0x48, 0x30,
+    0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xf8, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0xa8, 0xa8,
+    0xa8, 0x70, 0x20, 0x20, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x98, 0xe8, 0x80, 0x80,
+    0x00, 0x30, 0x48, 0x20, 0x10, 0x48, 0x30, 0x10, 0x20, 0x00, 0x50, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x10, 0x28, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0xf0, 0xa8, 0xa8, 0xb0, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x48, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0xf8, 0x70, 0x20, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x60, 0xc0, 0x40, 0x78, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x30, 0x48, 0x08, 0x78, 0x48,
+    0x30, 0x00, 0x00, 0x10, 0x28, 0x00, 0x38, 0x60, 0x18, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x28, 0x50, 0x00, 0x20, 0x00, 0x00, 0x50, 0x00,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x10, 0xf8, 0x20, 0xf8, 0x20,
+    0xf8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x48, 0x48, 0x38, 0x10, 0x08,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x78, 0x10, 0x20, 0x40, 0x78, 0x00, 0x00,
+    0x00, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0xd0, 0xa8, 0xa8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x48, 0x50,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x88, 0xa8, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0x08, 0x88, 0xb0, 0x80, 0x80, 0x10, 0x28, 0x38,
+    0x10, 0x10, 0x90, 0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x70, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x98, 0xa8, 0x88, 0xf8, 0x00, 0x00, 0x20, 0x10, 0x78, 0x40, 0x70, 0x40,
+    0x78, 0x00, 0x00, 0x10, 0x20, 0x88, 0x50, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x20, 0x50,
+    0x10, 0x20, 0x70, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x50, 0x88, 0xa8,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xf0, 0xa8, 0xb0, 0x00, 0x00,
+    0xe0, 0xe0, 0xe0, 0xe0, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x20, 0x50,
+    0x50, 0x98, 0xa8, 0xa8, 0x00, 0x00, 0x20, 0x88, 0xd8, 0xa8, 0xa8, 0x88,
+    0x88, 0x00, 0x00, 0x00, 0x70, 0x08, 0x08, 0x70, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x20, 0x10, 0x00, 0x00, 0x00,
+    0xa8, 0x70, 0x70, 0xa8, 0x04, 0x04, 0x00, 0x70, 0x00, 0x60, 0x20, 0x20,
+    0x70, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x98, 0xa8, 0xa8, 0xc8, 0xf0, 0x00, 0x00, 0x88, 0x70, 0x70,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x28, 0x50, 0x00, 0x48, 0x48, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x78, 0x84, 0x94, 0xa4, 0x94, 0x84,
+    0x78, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1c, 0x10, 0x1c, 0x10, 0x10, 0x10,
+    0x28, 0x50, 0x00, 0x70, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x08, 0x10, 0x10, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x00, 0xf8, 0x20, 0x40, 0x70, 0x80, 0x70, 0x08, 0x10,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x70, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00, 0x40, 0x00,
+    0x00, 0x40, 0x40, 0x70, 0x48, 0x48, 0x70, 0x00, 0x00, 0x30, 0x10, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x50, 0x20, 0x50, 0x70,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x10, 0x00,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x70, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x10, 0x20, 0xe0, 0x20, 0x40, 0x50, 0x68, 0x10, 0x28, 0x10, 0x00,
+    0xfc, 0xa8, 0xfc, 0x54, 0xfc, 0xa8, 0xfc, 0x54, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x40, 0x40, 0x00, 0x00, 0x00, 0xa0, 0xa0, 0x40, 0x40, 0x38,
+    0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88,
+    0x00, 0x00, 0xc0, 0xf0, 0xf8, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xb0, 0x48, 0x48, 0x78, 0x48,
+    0x48, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0x70, 0x70, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x60, 0x80, 0x60, 0x00, 0x30, 0x28, 0x30, 0x28, 0x80, 0x80, 0x40,
+    0x20, 0x20, 0x10, 0x08, 0x08, 0x04, 0x00, 0x70, 0x88, 0x30, 0x08, 0x88,
+    0x70, 0x00, 0x00, 0x28, 0x28, 0x28, 0x2c, 0x20, 0x2c, 0x28, 0x28, 0x28,
+    0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0xf8, 0x08, 0x10, 0x00, 0xb8, 0x88,
+    0x88, 0x88, 0xa8, 0x90, 0x00, 0x00, 0x10, 0x20, 0x30, 0x48, 0x40, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xc8, 0x88, 0x88, 0x08, 0x08,
+    0x10, 0x20, 0x00, 0x30, 0x58, 0x60, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x48, 0x48, 0x38, 0x20, 0x10, 0x00, 0x30, 0x48, 0x50, 0x50, 0x48,
+    0x50, 0x00, 0x00, 0x10, 0x10, 0x10, 0xf0, 0x10, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x30,
+    0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x10,
+    0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0xf0, 0x80, 0x80,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10,
+    0x20, 0x20, 0x20, 0x10, 0x10, 0x00, 0x28, 0x28, 0x28, 0xe8, 0x08, 0xf8,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x30, 0x28, 0x28, 0x28, 0x08, 0x10,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x38, 0x48,
+    0x48, 0x48, 0x48, 0x88, 0x00, 0x00, 0x28, 0x50, 0x00, 0x30, 0x10, 0x10,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+    0x48, 0x30, 0x00, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00, 0x20, 0x70, 0x28,
+    0x28, 0x70, 0x20, 0x78, 0x20, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x38, 0x58, 0x58, 0x68, 0x68,
+    0x70, 0x40, 0x00, 0x00, 0x78, 0x40, 0xf0, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x20, 0x10, 0x00, 0x30, 0x48, 0x70, 0x38, 0x00, 0x00, 0x00, 0x70, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x20, 0x10, 0x00, 0x28, 0x00, 0x38, 0x48, 0x48,
+    0x38, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x10, 0x28, 0x20, 0x78, 0x28,
+    0x28, 0x00, 0x00, 0x10, 0x28, 0x38, 0x40, 0x58, 0x48, 0x30, 0x00, 0x00,
+    0x08, 0x10, 0x48, 0x50, 0x60, 0x50, 0x48, 0x00, 0x00, 0x00, 0x70, 0x20,
+    0xf8, 0xa8, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x50,
+    0x20, 0x00, 0x00, 0x00, 0x70, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x90, 0x90, 0x78, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x28, 0x28,
+    0x30, 0x00, 0x00, 0x00, 0x78, 0x08, 0x10, 0x20, 0x40, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xa8, 0xa8, 0x70, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0xf8, 0x08, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x78,
+    0x08, 0x00, 0x00, 0x00, 0x60, 0x58, 0x48, 0xc8, 0xd8, 0x18, 0x00, 0x00,
+    0x00, 0x48, 0x68, 0x58, 0x48, 0x48, 0x48, 0x20, 0x40, 0x50, 0x20, 0x70,
+    0x48, 0x70, 0x50, 0x48, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x50, 0x60, 0x38, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x20, 0x10, 0x00,
+    0x30, 0x58, 0x60, 0x38, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0xf8, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x60, 0x20, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20, 0x48,
+    0x68, 0x58, 0x48, 0x48, 0x00, 0x00, 0x10, 0x20, 0x00, 0x38, 0x58, 0x68,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x50, 0x70, 0x48, 0x00, 0x00,
+    0x48, 0x30, 0x88, 0x88, 0x78, 0x08, 0x70, 0x00, 0x00, 0x10, 0x40, 0x40,
+    0x70, 0x48, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xe0, 0x00,
+    0x08, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x28, 0x10, 0x38,
+    0x40, 0x58, 0x48, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x20, 0x50, 0x00, 0x88, 0x50, 0x20, 0x20, 0x00, 0x00,
+    0x50, 0x00, 0x20, 0x50, 0x70, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x40, 0x40, 0x70, 0x40, 0x40, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0xa0, 0xb0, 0xa0, 0xa0, 0x78, 0x00, 0x00,
+    0x10, 0x20, 0x00, 0x38, 0x40, 0x40, 0x38, 0x00, 0x00, 0x00, 0x70, 0x88,
+    0x88, 0x88, 0x50, 0xd8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x28, 0x10, 0x00, 0x38, 0x60, 0x18, 0x70, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+    0x60, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x20, 0x70, 0xa8, 0xa8, 0x70,
+    0x20, 0x00, 0x00, 0x10, 0x20, 0x00, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x30, 0x48,
+    0xe0, 0x40, 0xe0, 0x40, 0xf8, 0x00, 0x00, 0x00, 0x20, 0x10, 0xf8, 0x10,
+    0x20, 0x00, 0x00, 0x48, 0x30, 0x00, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x50, 0x50, 0x88, 0xf8, 0x00, 0x00, 0x00, 0x70, 0xa8,
+    0xa8, 0xa8, 0xa8, 0x70, 0x18, 0x00, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0x70, 0xa8, 0xa8, 0xa8, 0x00, 0x00,
+    0x00, 0x20, 0x70, 0x28, 0x28, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x70, 0x48, 0xe8, 0x48, 0x48,
+    0x70, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+    0x88, 0x88, 0x88, 0xf8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40, 0x00,
+    0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x40,
+    0x60, 0x10, 0x60, 0x20, 0x00, 0x20, 0x70, 0x20, 0x28, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0xa8, 0x70, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x70, 0x20, 0x20, 0x20,
+    0x70, 0x00, 0x00, 0x00, 0x10, 0x50, 0xa8, 0x70, 0xa8, 0x50, 0x40, 0x00,
+    0x10, 0x20, 0x00, 0x48, 0x50, 0x70, 0x48, 0x00, 0x00, 0x40, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x30, 0x00, 0x48, 0x48, 0x48, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x50, 0x50, 0x20, 0x00, 0x00, 0x00, 0x10, 0x38,
+    0x70, 0x90, 0x90, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xa8, 0xb0,
+    0x78, 0x00, 0x00, 0x00, 0x54, 0x54, 0x58, 0x50, 0x50, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x60, 0x50, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd8, 0x48, 0x90, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x48, 0x90, 0x00, 0x90, 0x90, 0x90, 0x70, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00,
+    0x10, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x10, 0x10,
+    0x10, 0x00, 0x00, 0x00, 0x40, 0x40, 0xe0, 0x70, 0x48, 0x70, 0x00, 0x00,
+    0x00, 0x78, 0xa0, 0xf0, 0xa0, 0xa0, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xf8, 0xf8, 0xf8, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0xd8, 0x90,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x80, 0xf0, 0x88, 0x88,
+    0xf0, 0x00, 0x00, 0x00, 0x38, 0x48, 0x48, 0x38, 0x48, 0x48, 0x00, 0x00,
+    0x40, 0x20, 0x88, 0x88, 0xa8, 0xd8, 0x88, 0x00, 0x00, 0x00, 0x30, 0x48,
+    0x40, 0xf0, 0x40, 0x40, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x48, 0xfc, 0x48, 0x00, 0x00, 0x00,
+    0x00, 0xa8, 0xa8, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00,
+    0x38, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0xe0,
+    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0xe8, 0x98, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x70, 0x40, 0x38, 0x00, 0x00, 0x10, 0x20, 0x00, 0x30, 0x48, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x50, 0xa8, 0x20, 0x50, 0x88, 0xf8, 0x00, 0x00,
+    0x20, 0x50, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x20, 0x00, 0x50, 0x68, 0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10, 0x00, 0x38,
+    0x40, 0x30, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x98, 0xa8,
+    0xc8, 0x00, 0x00, 0x78, 0x00, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x78, 0x08, 0x70, 0x84, 0x84, 0x48,
+    0x30, 0x30, 0x30, 0x48, 0x48, 0x84, 0x00, 0x00, 0x88, 0x50, 0x20, 0x50,
+    0x88, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8,
+    0x70, 0x20, 0x20, 0x10, 0x20, 0x78, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x50, 0x50, 0xf8, 0x88, 0x00, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x00, 0x70, 0x88, 0x08, 0x68, 0x98, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0xf8, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x48, 0xb0,
+    0x88, 0x00, 0x00, 0x20, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x28, 0x28, 0x28, 0x2c, 0x28, 0x28, 0x28, 0x28, 0x20, 0x00, 0x70,
+    0x48, 0x70, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x00, 0x70, 0x10, 0x28, 0x78, 0x40, 0x70, 0x40, 0x78, 0x00, 0x00,
+    0xc0, 0x20, 0x40, 0x30, 0xe8, 0x10, 0x28, 0x10, 0x00, 0x54, 0xa8, 0x54,
+    0xa8, 0x54, 0xa8, 0x54, 0xa8, 0x54, 0x00, 0x10, 0x10, 0x10, 0x10, 0x70,
+    0x60, 0x00, 0x00, 0x00, 0x78, 0x40, 0x20, 0x20, 0x40, 0x78, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x78, 0x20, 0x78, 0x00, 0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xe0, 0x80,
+    0xc0, 0x80, 0x38, 0x20, 0x30, 0x20, 0x00, 0x00, 0x10, 0xf8, 0x20, 0xf8,
+    0x40, 0x00, 0x00, 0x00, 0xfc, 0x5c, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x50, 0x50, 0x28, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0xd8, 0x50, 0xd8, 0x70, 0x20, 0x00,
+    0x00, 0x28, 0x00, 0x48, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x28, 0x28, 0x28, 0x28,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x08, 0x88, 0x88, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x28, 0x10, 0x20, 0x70, 0x20, 0x28, 0x10, 0x00, 0x00,
+    0x00, 0x78, 0x08, 0x38, 0x08, 0x08, 0x78, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x30, 0x78, 0xfc, 0x78, 0x30, 0x00, 0x00, 0x90, 0x48, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0xa8, 0x80, 0xe0, 0x90, 0x90, 0x90, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40, 0x00, 0x20, 0x10, 0x78,
+    0x40, 0x70, 0x40, 0x78, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x78, 0x08,
+    0x08, 0x00, 0x00, 0x50, 0x20, 0xf8, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x88, 0x50, 0x50, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x20, 0x50, 0xd8, 0x50, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe0,
+    0x40, 0x70, 0x48, 0x48, 0x08, 0x10, 0x00, 0x50, 0x00, 0x20, 0x20, 0x28,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x70, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x54, 0x54, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20, 0x20, 0x20,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x20, 0x20, 0x30, 0x60, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x20, 0x00,
+    0x88, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x08, 0x30, 0xc8, 0x30, 0xc0, 0x00,
+    0x00, 0x70, 0x80, 0x70, 0x88, 0x88, 0x70, 0x00, 0x00, 0xe0, 0xe0, 0xe0,
+    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x80, 0xb8, 0x20, 0x30, 0x20, 0x20,
+    0x38, 0x00, 0x00, 0x20, 0xa8, 0x00, 0x20, 0x20, 0x20, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x50, 0x00, 0x70,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x10, 0xd0,
+    0x30, 0x30, 0x10, 0x10, 0x00, 0x10, 0x30, 0x40, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x30, 0x48, 0x20, 0x10, 0x48, 0x30, 0x10, 0x20, 0x00, 0x40, 0x00,
+    0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x38, 0x48, 0x48,
+    0x38, 0x00, 0x78, 0x20, 0x00, 0x10, 0x28, 0x70, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x18, 0x68, 0x30, 0x00, 0x00, 0x28, 0x28, 0x28,
+    0xe8, 0x08, 0xe8, 0x28, 0x28, 0x28, 0x20, 0x00, 0x70, 0x48, 0x48, 0x48,
+    0x70, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x50, 0x20, 0x20, 0x10, 0x28, 0x00,
+    0x48, 0x48, 0x48, 0x38, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x50, 0x30, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0x48, 0x48, 0xc8, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x50,
+    0xd8, 0x00, 0x00, 0x00, 0x20, 0x40, 0x40, 0x40, 0x20, 0x00, 0x00, 0x00,
+    0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x30, 0x78,
+    0x40, 0x70, 0x40, 0x78, 0x00, 0x00, 0x00, 0x80, 0x80, 0xb0, 0xc8, 0x88,
+    0x08, 0xf0, 0x00, 0x00, 0x50, 0x50, 0x50, 0x50, 0x00, 0x50, 0x00, 0x00,
+    0x10, 0x20, 0x00, 0x50, 0x68, 0x40, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x40, 0xe0, 0x70, 0x48, 0x48,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0x98, 0xe0, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x48, 0x48, 0x78, 0x48, 0x48,
+    0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0xf8, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0x20, 0x30,
+    0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x40, 0x20, 0x88, 0x98, 0xa8, 0xc8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x20, 0x28, 0x10, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x20, 0x00, 0x70, 0x48, 0x48,
+    0x48, 0x00, 0x00, 0x10, 0x10, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x50, 0x00,
+    0x30, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x28, 0x50, 0x48, 0x68, 0x58, 0x48, 0x48, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0x50, 0x28, 0x50, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x80, 0x80, 0x80,
+    0x70, 0x08, 0x10, 0x00, 0x00, 0x00, 0x34, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x88, 0x50,
+    0x20, 0x20, 0x50, 0x88, 0x04, 0x04, 0x00, 0x78, 0xe8, 0xe8, 0x68, 0x28,
+    0x28, 0x00, 0x00, 0x08, 0x10, 0x38, 0x58, 0x68, 0x68, 0x70, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xb0, 0xa8, 0xb0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x40, 0x40, 0x50, 0x40, 0x40, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0xf0, 0x80, 0x78, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x20, 0x70, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x88, 0x70, 0x80, 0x78, 0x00, 0x00, 0x00, 0xa8, 0xa8,
+    0xa8, 0xa8, 0xa8, 0xf8, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x28, 0x50,
+    0x00, 0x00, 0x00, 0x40, 0xc0, 0x40, 0x50, 0x68, 0x08, 0x10, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x58, 0x60, 0x50, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf8, 0x88,
+    0x88, 0x00, 0x00, 0x00, 0xa0, 0xe0, 0xa0, 0x00, 0x38, 0x10, 0x10, 0x00,
+    0x00, 0x38, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00, 0x00, 0x00, 0x88, 0x50,
+    0x20, 0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x60, 0x50, 0x50, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x08, 0x08, 0x48, 0x48, 0x30,
+    0x00, 0x00, 0x30, 0x78, 0x84, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x88, 0x88, 0xa8, 0xd8,
+    0x88, 0x00, 0x00, 0x00, 0xc8, 0xe8, 0xe8, 0xd8, 0xd8, 0xc8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xa8, 0xb0, 0x58, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x40, 0x40, 0x30,
+    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x60, 0x58, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x28, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x90, 0x70, 0x88, 0x88, 0x88,
+    0x70, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x48, 0x50, 0x60, 0x50, 0x48, 0x48, 0x00, 0x00,
+    0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+    0xf8, 0x88, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xf8, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x30, 0x30, 0x48, 0x00, 0x00,
+    0x28, 0x50, 0x38, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x48, 0x48, 0x48, 0x20, 0x40, 0x28, 0x10, 0x78, 0x40, 0x70, 0x40,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x70, 0x60, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x20, 0x10, 0x48,
+    0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+};
+
+const fontx_atlas_t font6x9_atlas = {
+    .magic = {'F', 'O', 'N', 'T', 'X', 'A'},
+    .name = "MISC    ",
+    .width = 6,
+    .height = 9,
+    .pitch = 1,
+    .size = 9,
+    .ascii_mask = {0x00000000, 0xffffffff, 0xffffffff, 0x7fffffff},
+    .count = 1198,
+    .buckets = 600,
+    .disp = font6x9_atlas_disp,
+    .codes = font6x9_atlas_codes,
+    .bitmap = font6x9_atlas_bitmap,
+};
@@ -1,10 +1,11 @@
 import argparse
 import copy
+import io
 import json
 import math
-import os
+import re
 
-from PIL import Image
+ATLAS_ASCII = 128  # direct indexed codes
 
 
 class FontX2:
@@ -30,48 +31,61 @@ class FontX2:
     def from_binary(self, filename):
         self.filename = filename  # filename
         with open(filename, "rb") as f:
-            self.type = f.read(6).decode("ascii")  # magic code
-            self.name = f.read(8).decode("ascii")  # font name
-            self.width = int.from_bytes(f.read(1), "little")  # width
-            self.height = int.from_bytes(f.read(1), "little")  # height
-
-            fs = (self.width + 7) // 8 * self.height  # font size
-            offset = 0
-            filesize = os.path.getsize(filename)
-            self.flag = int.from_bytes(f.read(1), "little")
-            if self.flag == 0:  # flag = 0 -> single byte
-                offset = 17
-            else:  # flag = 1 -> double byte
-                self.cb = []
-                cb = int.from_bytes(f.read(1), "little")  # number of code blocks
-
-                for i in range(cb):
-                    cbs = int.from_bytes(f.read(2), "little")  # start code
-                    cbe = int.from_bytes(f.read(2), "little")  # end code
-                    self.cb.append({"start": cbs, "end": cbe})
-
-                offset = 18 + 4 * cb
-
-            self.chars = []
-            self.chars_number = round((filesize - offset) / fs)
-
-            for c in range(self.chars_number):  # read a single char
-                fontpat = f.read(fs)
-                x = 0
-                y = 0
-                font = [[0 for i in range(self.width)] for j in range(self.height)]
+            self.from_bytes(f.read())
+
+    def from_c_array(self, filename):
+        # const unsigned char font6x9[] = { 0x46, 0x4f, ... };
+        self.filename = filename  # filename
+        with open(filename, "r") as f:
+            source = f.read()
+        body = source[source.index("{") + 1 : source.index("}")]
+        data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{1,2})", body))
+        self.from_bytes(data)
+
+    def from_bytes(self, data):
+        f = io.BytesIO(data)
+        self.type = f.read(6).decode("ascii")  # magic code
+        self.name = f.read(8).decode("ascii")  # font name
+        self.width = int.from_bytes(f.read(1), "little")  # width
+        self.height = int.from_bytes(f.read(1), "little")  # height
+
+        fs = (self.width + 7) // 8 * self.height  # font size
+        offset = 0
+        filesize = len(data)
+        self.flag = int.from_bytes(f.read(1), "little")
+        if self.flag == 0:  # flag = 0 -> single byte
+            offset = 17
+        else:  # flag = 1 -> double byte
+            self.cb = []
+            cb = int.from_bytes(f.read(1), "little")  # number of code blocks
+
+            for i in range(cb):
+                cbs = int.from_bytes(f.read(2), "little")  # start code
+                cbe = int.from_bytes(f.read(2), "little")  # end code
+                self.cb.append({"start": cbs, "end": cbe})
+
+            offset = 18 + 4 * cb
+
+        self.chars = []
+        self.chars_number = round((filesize - offset) / fs)
 
-                for s in range(fs):
-                    for b in range(8):
-                        if fontpat[s] & 0b10000000 >> b > 0:
-                            font[y][x] = 1
+        for c in range(self.chars_number):  # read a single char
+            fontpat = f.read(fs)
+            x = 0
+            y = 0
+            font = [[0 for i in range(self.width)] for j in range(self.height)]
 
-                        x += 1
-                        if x == self.width:
-                            x = 0
-                            y += 1
-                            break
-                self.chars.append({"char": c, "bitmap": font})
+            for s in range(fs):
+                for b in range(8):
+                    if fontpat[s] & 0b10000000 >> b > 0:
+                        font[y][x] = 1
+
+                    x += 1
+                    if x == self.width:
+                        x = 0
+                        y += 1
+                        break
+            self.chars.append({"char": c, "bitmap": font})
 
     def invert(self):
         for c in self.chars:  # read a single char
@@ -210,6 +224,8 @@ class FontX2:
         return serialized
 
     def to_picture(self, filename):
+        from PIL import Image  # only needed for the preview
+
         cols = 52
         rows = math.ceil(self.chars_number / cols)
 
@@ -230,12 +246,137 @@ class FontX2:
                     pass
         img.save(filename)
 
+    def codes(self):
+        # code point of each char, the first block wins if blocks overlap
+        if self.flag == 0:
+            return list(range(len(self.chars)))
+        codes = []
+        for block in self.cb:
+            codes.extend(range(block["start"], block["end"] + 1))
+        return codes[: len(self.chars)]
+
+    def to_atlas(self, filename, name):
+        # pre-baked atlas for fontx_atlas_t: 128 direct indexed ASCII glyphs,
+        # the rest in the slots of a minimal perfect hash (hash and displace)
+        pitch = (self.width + 7) // 8
+        size = pitch * self.height
+        glyphs = {}
+        for code, char in zip(self.codes(), self.chars):
+            if code not in glyphs:
+                glyphs[code] = char["bitmap"]
+
+        ascii_mask = [0, 0, 0, 0]
+        for code in glyphs:
+            if code < ATLAS_ASCII:
+                ascii_mask[code // 32] |= 1 << (code % 32)
+        keys = sorted(c for c in glyphs if ATLAS_ASCII <= c <= 0xFFFF)
+        disp, slots = atlas_perfect_hash(keys)
+
+        bitmap = bytearray()
+        for code in list(range(ATLAS_ASCII)) + slots:
+            if code in glyphs:
+                bitmap += pack_bitmap(glyphs[code], pitch)
+            else:
+                bitmap += bytes(size)
+
+        with open(filename, "w") as f:
+            f.write("/*\n\n")
+            f.write(f"Pre-baked atlas of {self.name.strip()} {self.width}x{self.height}")
+            f.write(f", {len(glyphs)} glyphs.\n")
+            f.write("Generated by fontx2.py --to_atlas, see fontx_atlas_t.\n\n*/\n")
+            f.write('#include "fontx.h"\n\n')
+            write_c_array(f, f"static const uint16_t {name}_disp[]", disp, 4)
+            write_c_array(f, f"static const uint16_t {name}_codes[]", slots, 4)
+            write_c_array(f, f"static const uint8_t {name}_bitmap[]", bitmap, 2)
+            f.write(f"const fontx_atlas_t {name} = {{\n")
+            f.write("    .magic = {'F', 'O', 'N', 'T', 'X', 'A'},\n")
+            f.write(f'    .name = "{self.name[:8]}",\n')
+            f.write(f"    .width = {self.width},\n")
+            f.write(f"    .height = {self.height},\n")
+            f.write(f"    .pitch = {pitch},\n")
+            f.write(f"    .size = {size},\n")
+            f.write("    .ascii_mask = {")
+            f.write(", ".join(f"0x{m:08x}" for m in ascii_mask) + "},\n")
+            f.write(f"    .count = {len(slots)},\n")
+            f.write(f"    .buckets = {len(disp)},\n")
+            f.write(f"    .disp = {name}_disp,\n")
+            f.write(f"    .codes = {name}_codes,\n")
+            f.write(f"    .bitmap = {name}_bitmap,\n")
+            f.write("};\n")
+
+
+def pack_bitmap(bitmap, pitch):
+    packed = bytearray()
+    for row in bitmap:
+        line = bytearray(pitch)
+        for x, bit in enumerate(row):
+            if bit:
+                line[x // 8] |= 0x80 >> (x % 8)
+        packed += line
+    return packed
+
+
+def atlas_hash(code, seed):
+    # must match fontx_atlas_hash() in fontx.c
+    h = (code ^ (seed * 0x9E3779B9)) & 0xFFFFFFFF
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    return h
+
+
+def atlas_range(h, n):
+    return (h * n) >> 32
+
+
+def atlas_perfect_hash(keys):
+    # bucket = range(hash(code, 0), buckets)
+    # slot = range(hash(code, disp[bucket]), len(keys))
+    n = len(keys)
+    if n == 0:
+        return [], []
+    nb = (n + 3) // 4
+    while True:
+        buckets = [[] for i in range(nb)]
+        for k in keys:
+            buckets[atlas_range(atlas_hash(k, 0), nb)].append(k)
+        order = sorted(range(nb), key=lambda b: -len(buckets[b]))
+        slots = [None] * n
+        disp = [0] * nb
+        for b in order:
+            if not buckets[b]:
+                break
+            for seed in range(0x10000):
+                pos = [atlas_range(atlas_hash(k, seed), n) for k in buckets[b]]
+                if len(set(pos)) == len(pos) and all(slots[p] is None for p in pos):
+                    for k, p in zip(buckets[b], pos):
+                        slots[p] = k
+                    disp[b] = seed
+                    break
+            else:
+                break
+        if None not in slots:
+            return disp, slots
+        nb *= 2  # no seed found for a bucket, retry with smaller buckets
+
+
+def write_c_array(f, decl, values, digits):
+    f.write(f"{decl} = {{\n")
+    per_line = 12 if digits == 2 else 8
+    if len(values) == 0:
+        values = [0]  # empty arrays are not allowed in C
+    for i in range(0, len(values), per_line):
+        line = ", ".join(f"0x{v:0{digits}x}" for v in values[i : i + per_line])
+        f.write(f"    {line},\n")
+    f.write("};\n\n")
+
 
 def cli():
     parser = argparse.ArgumentParser(description="Convert FontX2")
 
     parser.add_argument("--from_binary", help="FontX2 filename (binary version).")
     parser.add_argument("--from_json", help="FontX2 filename (json version).")
+    parser.add_argument("--from_c", help="FontX2 filename (C array version).")
 
     parser.add_argument("--new", help="FontX2 new json filename.")
     parser.add_argument(
@@ -271,6 +412,12 @@ def cli():
     parser.add_argument("--to_binary", help="FontX2 filename (binary version).")
     parser.add_argument("--to_json", help="FontX2 filename (json version).")
     parser.add_argument("--to_jpg", help="Dump font in jpeg format.")
+    parser.add_argument("--to_atlas", help="Pre-baked atlas filename (C header).")
+    parser.add_argument(
+        "--atlas_name",
+        help="Name of the fontx_atlas_t variable. (default: font_atlas)",
+        default="font_atlas",
+    )
 
     args = parser.parse_args()
 
@@ -283,11 +430,13 @@ def cli():
         json_file = open(args.from_json, "r+")
         font_in.from_json(json_file.read())
         json_file.close()
+    elif args.from_c is not None:
+        font_in.from_c_array(args.from_c)
     elif args.new is not None:
         # todo check args
         font_in.new(args.start_char, args.stop_char, args.width, args.height)
     else:
-        print("Missing import (from_binary/from_json) or new argument.")
+        print("Missing import (from_binary/from_json/from_c) or new argument.")
         exit(1)
     print(
         f"Imported {font_in.chars_number} chars with size {font_in.width}x{font_in.height}."
@@ -303,6 +452,8 @@ def cli():
         json_file.close()
     if args.to_jpg is not None:
         font_out.to_picture(args.to_jpg)
+    if args.to_atlas is not None:
+        font_out.to_atlas(args.to_atlas, args.atlas_name)
 
 
 if __name__ == "__main__":
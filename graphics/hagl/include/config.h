@@ -45,3 +45,36 @@ SPDX-License-Identifier: MIT
 #define TJPGD_NEEDS_BYTESWAP
 
 #endif /* HAGL_INCLUDE_SDKCONFIG_H */
+
+/*
+ * Glyph cache used by hagl_get_glyph() and hagl_get_glyph_cached(). Entries
+ * are keyed by font, code, color and depth and evicted in LRU order. Glyphs
+ * larger than HAGL_GLYPH_CACHE_MAX_PIXELS bypass the cache. Memory usage is
+ * HAGL_GLYPH_CACHE_SIZE * HAGL_GLYPH_CACHE_MAX_PIXELS * sizeof(hagl_color_t),
+ * about 8 KB with 32 entries of RGB565. The cache is disabled (0) by default,
+ * define HAGL_GLYPH_CACHE_SIZE (for example 32) to enable it.
+ */
+#ifndef HAGL_GLYPH_CACHE_SIZE
+#define HAGL_GLYPH_CACHE_SIZE 0
+#endif /* HAGL_GLYPH_CACHE_SIZE */
+
+#ifndef HAGL_GLYPH_CACHE_MAX_PIXELS
+#define HAGL_GLYPH_CACHE_MAX_PIXELS (8 * 16)
+#endif /* HAGL_GLYPH_CACHE_MAX_PIXELS */
+
+/*
+ * Tile based framebuffer backend (hagl_fb). Dirty tracking granularity and
+ * the largest supported number of tiles, each tile costs 2 bits of RAM.
+ */
+#ifndef HAGL_FB_TILE_SIZE
+#define HAGL_FB_TILE_SIZE 16
+#endif /* HAGL_FB_TILE_SIZE */
+
+#ifndef HAGL_FB_MAX_TILES
+#define HAGL_FB_MAX_TILES 1200
+#endif /* HAGL_FB_MAX_TILES */
+
+/* Called while hagl_fb waits for the previous transfer, e.g. a task yield. */
+#ifndef HAGL_FB_WAIT
+#define HAGL_FB_WAIT() ((void)0)
+#endif /* HAGL_FB_WAIT */
@@ -56,6 +56,13 @@ extern "C" {
 #define FONTX_GLYPH_DATA_START (17)
 #define FONTX_BLOCK_TABLE_SIZE (17)
 #define FONTX_BLOCK_TABLE_START (18)
+#define FONTX_TYPE_ATLAS (2)
+#define FONTX_ATLAS_ASCII (128)
+
+/* FONTX2 fonts start with "FONTX2", pre-baked atlases with "FONTXA". */
+#define FONTX_IS_ATLAS(font) ('A' == (font)[5])
+/* Pass an atlas to the functions taking a FONTX2 font. */
+#define FONTX_ATLAS(atlas) ((const uint8_t *)&(atlas))
 
 /* Pitch is bytes per row. Size is size in bytes. */
 typedef struct {
@@ -73,6 +80,28 @@ typedef struct {
   uint8_t type;
 } fontx_meta_t;
 
+/*
+ * Pre-baked font atlas generated by fontx2.py --to_atlas. Glyph lookup does
+ * not parse the font. Codes below 0x80 index the bitmap directly. Other
+ * codes are found with a minimal perfect hash: a bucket is selected by
+ * hash(code, 0), the slot by hash(code, disp[bucket]). The slot holds the
+ * code for verification and its glyph follows the 128 ASCII glyphs.
+ */
+typedef struct {
+  char magic[6];
+  char name[9];
+  uint8_t width;
+  uint8_t height;
+  uint8_t pitch;
+  uint8_t size;
+  uint32_t ascii_mask[FONTX_ATLAS_ASCII / 32];
+  uint16_t count;
+  uint16_t buckets;
+  const uint16_t *disp;
+  const uint16_t *codes;
+  const uint8_t *bitmap;
+} fontx_atlas_t;
+
 uint8_t fontx_meta(fontx_meta_t *meta, const uint8_t *font);
 uint8_t fontx_glyph(fontx_glyph_t *glyph, wchar_t code, const uint8_t *font);
 
@@ -70,6 +70,10 @@ typedef struct {
   void (*clear)(void *self);
   uint8_t *buffer;
   uint8_t *buffer2;
+  /* Optional. Address of a rectangle (fully inside the surface) in the */
+  /* draw buffer for writing it directly, the area is marked as changed. */
+  uint8_t *(*map)(void *self, int16_t x0, int16_t y0, uint16_t w, uint16_t h,
+                  uint32_t *pitch);
 } hagl_backend_t;
 
 #ifdef __cplusplus
@@ -179,6 +179,28 @@ static void inline hagl_blit_mask_xyxy(void const *surface, uint16_t x0,
                       source, mask_color);
 };
 
+/**
+ * Blit a 1-bpp bitmap to a surface
+ *
+ * Set bits are drawn with color, clear bits are left untouched. Runs of
+ * set bits in a row are drawn with a single hline, so this is much faster
+ * than expanding the bitmap and blitting it with a mask color.
+ *
+ * Output will be clipped to the current clip window.
+ *
+ * @param surface
+ * @param x0
+ * @param y0
+ * @param bits pointer to bitmap data, MSB is the leftmost pixel
+ * @param width width in pixels
+ * @param height height in pixels
+ * @param pitch bytes per row
+ * @param color
+ */
+void hagl_blit_1bpp(void const *surface, int16_t x0, int16_t y0,
+                    const uint8_t *bits, uint16_t width, uint16_t height,
+                    uint16_t pitch, hagl_color_t color);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
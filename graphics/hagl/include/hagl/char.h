@@ -38,6 +38,7 @@ SPDX-License-Identifier: MIT
 
 #include <stdint.h>
 
+#include "hagl/bitmap.h"
 #include "hagl/color.h"
 
 #ifdef __cplusplus
@@ -101,6 +102,40 @@ uint16_t hagl_put_text_wide(void const *surface, const wchar_t *str, int16_t x0,
 uint8_t hagl_get_glyph(void const *surface, wchar_t code, hagl_color_t color,
                        hagl_bitmap_t *bitmap, const uint8_t *font);
 
+/**
+ * Get a glyph from the glyph cache
+ *
+ * Glyph is expanded into a bitmap of the given color, clear bits are 0x00.
+ * Entries are keyed by font, code, color and surface depth and evicted in
+ * LRU order. The returned bitmap stays valid until the next cache miss
+ * evicts it, blit it right away with hagl_blit().
+ *
+ * @param surface
+ * @param code Unicode code point
+ * @param color
+ * @param font Pointer to a FONTX font
+ * @return Pointer to the cached bitmap, NULL if the glyph is not found, is
+ *         larger than HAGL_GLYPH_CACHE_MAX_PIXELS or the cache is disabled
+ */
+const hagl_bitmap_t *hagl_get_glyph_cached(void const *surface, wchar_t code,
+                                           hagl_color_t color,
+                                           const uint8_t *font);
+
+/**
+ * Get glyph cache hit and miss counters
+ *
+ * @param hits
+ * @param misses
+ */
+void hagl_glyph_cache_stats(uint32_t *hits, uint32_t *misses);
+
+/**
+ * Drop all cached glyphs and reset the counters
+ *
+ * Call this if a font in RAM is modified or freed.
+ */
+void hagl_glyph_cache_clear(void);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
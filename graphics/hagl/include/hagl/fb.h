@@ -0,0 +1,94 @@
+/**
+ * @file fb.h
+ * @brief hagl双缓冲分块帧缓冲后端(脏块跟踪 + 异步刷新)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-27
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef _HAGL_FB_H
+#define _HAGL_FB_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "hagl/backend.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define HAGL_FB_MASK_WORDS ((HAGL_FB_MAX_TILES + 31) / 32)
+
+/**
+ * @brief 异步传输回调(如启动DMA), 传输完成后需调用hagl_fb_tx_done
+ * @param  x0               区域左上角x
+ * @param  y0               区域左上角y
+ * @param  w                区域宽度
+ * @param  h                区域高度
+ * @param  data             区域首像素在前台缓冲中的地址
+ * @param  pitch            缓冲区每行字节数
+ * @note 同一时刻只有一个传输, 前台缓冲在传输期间不会被修改
+ */
+typedef void (*hagl_fb_tx_t)(int16_t x0, int16_t y0, uint16_t w, uint16_t h,
+                             const uint8_t *data, uint32_t pitch);
+
+typedef struct {
+  uint16_t width;
+  uint16_t height;
+  uint16_t pitch;               // 每行字节数
+  uint16_t tiles_x;             // 每行块数
+  uint16_t tiles_y;             // 每列块数
+  uint8_t *buffer[2];           // 后台(绘制)/前台(传输)缓冲, [1]为NULL时单缓冲
+  hagl_fb_tx_t tx;              // 异步传输回调
+  uint32_t dirty[HAGL_FB_MASK_WORDS];     // 后台缓冲的脏块
+  uint32_t tx_dirty[HAGL_FB_MASK_WORDS];  // 正在传输的脏块
+  uint8_t *tx_buffer;           // 正在传输的缓冲区
+  uint16_t tx_next;             // 下一个待传输的块
+  volatile uint8_t busy;        // 传输进行中
+  volatile uint8_t pumping;     // 正在发起传输(防止回调内完成导致递归)
+  volatile uint8_t done;        // 发起期间收到完成通知
+  uint32_t frames;              // 已刷新帧数
+  uint32_t tx_tiles;            // 已传输块数
+  uint32_t tx_bytes;            // 已传输字节数
+} hagl_fb_t;
+
+/**
+ * @brief 将backend初始化为分块帧缓冲后端
+ * @param  backend          后端(设置像素操作/flush/clear, color由HAL设置)
+ * @param  fb               帧缓冲实例(需保持有效, 同时只支持一个实例)
+ * @param  width            宽度
+ * @param  height           高度
+ * @param  buf1             缓冲区1(width*height*sizeof(hagl_color_t))
+ * @param  buf2             缓冲区2, NULL时单缓冲: flush等待传输完成后返回
+ * @param  tx               异步传输回调
+ * @retval uint8_t          0: 成功 1: 参数错误或块数超过HAGL_FB_MAX_TILES
+ * @note 双缓冲时flush交换缓冲区, 将本帧的脏块复制到新的后台缓冲后立即返回,
+ * 传输与下一帧的绘制并行
+ */
+uint8_t hagl_fb_init(hagl_backend_t *backend, hagl_fb_t *fb, uint16_t width,
+                     uint16_t height, uint8_t *buf1, uint8_t *buf2,
+                     hagl_fb_tx_t tx);
+
+/**
+ * @brief 传输完成通知, 由DMA完成中断或传输回调调用
+ */
+void hagl_fb_tx_done(void);
+
+/**
+ * @brief 是否有传输正在进行
+ */
+uint8_t hagl_fb_busy(void);
+
+/**
+ * @brief 标记全屏为脏, 下次flush时整屏传输(hagl_fb_init之前调用无效)
+ */
+void hagl_fb_invalidate(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _HAGL_FB_H */
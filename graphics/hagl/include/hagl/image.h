@@ -36,6 +36,7 @@ SPDX-License-Identifier: MIT
 #ifndef _HAGL_IMAGE_H
 #define _HAGL_IMAGE_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -44,6 +45,20 @@ extern "C" {
 
 #define HAGL_ERR_TJPGD (100)
 
+/**
+ * Image input function
+ *
+ * Called by the decoder when it needs more data. Can read from any
+ * source such as a littlefs file, flash or a network socket.
+ *
+ * @param ctx context passed to hagl_load_image_stream()
+ * @param buffer where to read the data to, NULL to skip the bytes
+ * @param size number of bytes to read or skip
+ * @return number of bytes read or skipped, less than size on error
+ */
+typedef uint16_t (*hagl_image_read_t)(void *ctx, uint8_t *buffer,
+                                      uint16_t size);
+
 /**
  * Load an image
  *
@@ -54,13 +69,46 @@ extern "C" {
  * @param surface
  * @param x0
  * @param y0
- * @param x1
- * @param y1
- * @param color
+ * @param filename
+ * @return HAGL_OK, HAGL_ERR_FILE_IO or HAGL_ERR_TJPGD + decoder error
  */
 uint32_t hagl_load_image(void const *surface, int16_t x0, int16_t y0,
                          const char *filename);
 
+/**
+ * Load an image from a stream
+ *
+ * Decodes the image MCU by MCU while reading it, the whole file is
+ * never in memory. If the backend supports map() and the MCU is inside
+ * the clip window the pixels are converted straight into the draw
+ * buffer, otherwise the MCU is blitted and clipped.
+ *
+ * @param surface
+ * @param x0
+ * @param y0
+ * @param scale output size is 1 / (1 << scale), 0 to 3
+ * @param read input function
+ * @param ctx context passed to the input function
+ * @return HAGL_OK or HAGL_ERR_TJPGD + decoder error
+ */
+uint32_t hagl_load_image_stream(void const *surface, int16_t x0, int16_t y0,
+                                uint8_t scale, hagl_image_read_t read,
+                                void *ctx);
+
+/**
+ * Load an image from memory
+ *
+ * @param surface
+ * @param x0
+ * @param y0
+ * @param scale output size is 1 / (1 << scale), 0 to 3
+ * @param data jpg file content
+ * @param size size of the jpg file
+ * @return HAGL_OK or HAGL_ERR_TJPGD + decoder error
+ */
+uint32_t hagl_load_image_mem(void const *surface, int16_t x0, int16_t y0,
+                             uint8_t scale, const uint8_t *data, size_t size);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -72,6 +72,10 @@ struct JDEC {
   uint16_t (*infunc)(JDEC*, uint8_t*,
                      uint16_t); /* Pointer to jpeg stream input function */
   void* device; /* Pointer to I/O device identifiler for the session */
+  uint8_t* (*outdst)(JDEC*, JRECT*,
+                     uint16_t*); /* Optional: maps the output rectangle to a
+                                    RGB565 buffer (and its pitch in bytes) to
+                                    convert the MCU into, NULL: use outfunc */
 };
 
 /* TJpgDec API functions */
@@ -42,7 +42,57 @@ SPDX-License-Identifier: MIT
 #include <stdint.h>
 #include <string.h>
 
+static inline uint32_t fontx_atlas_hash(uint32_t code, uint32_t seed) {
+  uint32_t h = code ^ (seed * 0x9E3779B9u);
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  return h;
+}
+
+/* Map a hash to [0, n) without division. */
+static inline uint32_t fontx_atlas_range(uint32_t h, uint32_t n) {
+  return (uint32_t)(((uint64_t)h * n) >> 32);
+}
+
+static uint8_t fontx_atlas_glyph(fontx_glyph_t *glyph, wchar_t code,
+                                 const fontx_atlas_t *atlas) {
+  uint32_t bucket, slot;
+
+  glyph->width = atlas->width;
+  glyph->height = atlas->height;
+  glyph->pitch = atlas->pitch;
+  glyph->size = atlas->size;
+
+  if ((uint32_t)code < FONTX_ATLAS_ASCII) {
+    if (atlas->ascii_mask[code / 32] & (1u << (code % 32))) {
+      glyph->buffer = &atlas->bitmap[code * atlas->size];
+      return FONTX_OK;
+    }
+  } else if ((uint32_t)code <= 0xFFFF && atlas->count) {
+    bucket = fontx_atlas_range(fontx_atlas_hash(code, 0), atlas->buckets);
+    slot = fontx_atlas_range(fontx_atlas_hash(code, atlas->disp[bucket]),
+                             atlas->count);
+    if (atlas->codes[slot] == (uint32_t)code) {
+      glyph->buffer =
+          &atlas->bitmap[(FONTX_ATLAS_ASCII + slot) * atlas->size];
+      return FONTX_OK;
+    }
+  }
+
+  return FONTX_ERR_GLYPH_NOT_FOUND;
+}
+
 uint8_t fontx_meta(fontx_meta_t *meta, const uint8_t *font) {
+  if (FONTX_IS_ATLAS(font)) {
+    const fontx_atlas_t *atlas = (const fontx_atlas_t *)font;
+    memcpy(meta->name, atlas->name, 8);
+    meta->width = atlas->width;
+    meta->height = atlas->height;
+    meta->type = FONTX_TYPE_ATLAS;
+    return 0;
+  }
+
   memcpy(meta->name, &font[FONTX_NAME], 8);
   meta->width = font[FONTX_WIDTH];
   meta->height = font[FONTX_HEIGHT];
@@ -57,6 +107,10 @@ uint8_t fontx_glyph(fontx_glyph_t *glyph, wchar_t code, const uint8_t *font) {
   const uint8_t *block_table;
   fontx_meta_t meta;
 
+  if (FONTX_IS_ATLAS(font)) {
+    return fontx_atlas_glyph(glyph, code, (const fontx_atlas_t *)font);
+  }
+
   status = fontx_meta(&meta, font);
   if (0 != status) {
     return status;
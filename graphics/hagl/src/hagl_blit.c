@@ -32,10 +32,12 @@ SPDX-License-Identifier: MIT
 
 */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "hagl/bitmap.h"
 #include "hagl/color.h"
+#include "hagl/hline.h"
 #include "hagl/pixel.h"
 #include "hagl/surface.h"
 
@@ -134,3 +136,50 @@ void hagl_blit_mask_xywh(void const *_surface, uint16_t x0, uint16_t y0,
     }
   }
 };
+
+void hagl_blit_1bpp(void const *_surface, int16_t x0, int16_t y0,
+                    const uint8_t *bits, uint16_t width, uint16_t height,
+                    uint16_t pitch, hagl_color_t color) {
+  const hagl_surface_t *surface = _surface;
+
+  /* Fully inside clip window, runs can go straight to the HAL. */
+  bool inside = surface->hline && (x0 >= surface->clip.x0) &&
+                (y0 >= surface->clip.y0) &&
+                (x0 + width - 1 <= surface->clip.x1) &&
+                (y0 + height - 1 <= surface->clip.y1);
+
+  for (uint16_t y = 0; y < height; y++, bits += pitch) {
+    /* Rows outside of clip window, nothing to do. */
+    if ((y0 + y < surface->clip.y0) || (y0 + y > surface->clip.y1)) {
+      continue;
+    }
+
+    uint16_t x = 0;
+    while (x < width) {
+      uint8_t byte = bits[x >> 3];
+
+      /* Skip whole bytes of clear bits at once. */
+      if (0 == (x & 7) && 0x00 == byte) {
+        x += 8;
+        continue;
+      }
+      if (!(byte & (0x80 >> (x & 7)))) {
+        x++;
+        continue;
+      }
+
+      /* Collect a run of set bits and draw it as one hline. */
+      uint16_t start = x;
+      while (x < width && (bits[x >> 3] & (0x80 >> (x & 7)))) {
+        x++;
+      }
+      if (!inside) {
+        hagl_draw_hline_xyw(surface, x0 + start, y0 + y, x - start, color);
+      } else if (x - start == 1) {
+        surface->put_pixel(&surface, x0 + start, y0 + y, color);
+      } else {
+        surface->hline(&surface, x0 + start, y0 + y, x - start, color);
+      }
+    }
+  }
+};
@@ -32,16 +32,118 @@ SPDX-License-Identifier: MIT
 
 */
 
+#include <string.h>
+
+#include "config.h"
 #include "fontx.h"
 #include "hagl.h"
 #include "hagl/bitmap.h"
 #include "hagl/blit.h"
 #include "hagl/color.h"
 
+#if HAGL_GLYPH_CACHE_SIZE > 0
+typedef struct {
+  const uint8_t *font;
+  wchar_t code;
+  hagl_color_t color;
+  uint8_t depth;
+  uint32_t used; /* LRU stamp, 0 means the entry is empty. */
+  hagl_bitmap_t bitmap;
+  hagl_color_t buffer[HAGL_GLYPH_CACHE_MAX_PIXELS];
+} glyph_cache_entry_t;
+
+static glyph_cache_entry_t glyph_cache[HAGL_GLYPH_CACHE_SIZE];
+static uint32_t glyph_cache_clock = 0;
+static uint32_t glyph_cache_hits = 0;
+static uint32_t glyph_cache_misses = 0;
+#endif /* HAGL_GLYPH_CACHE_SIZE */
+
+/* Expand 1-bpp glyph into colors, clear bits become 0x00. */
+static void expand_glyph(hagl_color_t *ptr, fontx_glyph_t *glyph,
+                         hagl_color_t color) {
+  const uint8_t *row = glyph->buffer;
+
+  for (uint8_t y = 0; y < glyph->height; y++) {
+    for (uint8_t x = 0; x < glyph->width; x++) {
+      if (row[x / 8] & (0x80 >> (x % 8))) {
+        *(ptr++) = color;
+      } else {
+        *(ptr++) = 0x00;
+      }
+    }
+    row += glyph->pitch;
+  }
+}
+
+const hagl_bitmap_t *hagl_get_glyph_cached(void const *_surface, wchar_t code,
+                                           hagl_color_t color,
+                                           const uint8_t *font) {
+#if HAGL_GLYPH_CACHE_SIZE > 0
+  const hagl_surface_t *surface = _surface;
+  glyph_cache_entry_t *entry, *victim = &glyph_cache[0];
+  fontx_glyph_t glyph;
+
+  for (uint16_t i = 0; i < HAGL_GLYPH_CACHE_SIZE; i++) {
+    entry = &glyph_cache[i];
+    if (entry->used && entry->font == font && entry->code == code &&
+        entry->color == color && entry->depth == surface->depth) {
+      entry->used = ++glyph_cache_clock;
+      glyph_cache_hits++;
+      return &entry->bitmap;
+    }
+    if (entry->used < victim->used) {
+      victim = entry;
+    }
+  }
+
+  glyph_cache_misses++;
+  if (0 != fontx_glyph(&glyph, code, font)) {
+    return NULL;
+  }
+  if (glyph.width * glyph.height > HAGL_GLYPH_CACHE_MAX_PIXELS ||
+      surface->depth != sizeof(hagl_color_t) * 8) {
+    return NULL;
+  }
+
+  /* Replace the least recently used entry. */
+  expand_glyph(victim->buffer, &glyph, color);
+  hagl_bitmap_init(&victim->bitmap, glyph.width, glyph.height, surface->depth,
+                   victim->buffer);
+  victim->font = font;
+  victim->code = code;
+  victim->color = color;
+  victim->depth = surface->depth;
+  victim->used = ++glyph_cache_clock;
+  return &victim->bitmap;
+#else
+  return NULL;
+#endif /* HAGL_GLYPH_CACHE_SIZE */
+}
+
+void hagl_glyph_cache_stats(uint32_t *hits, uint32_t *misses) {
+#if HAGL_GLYPH_CACHE_SIZE > 0
+  *hits = glyph_cache_hits;
+  *misses = glyph_cache_misses;
+#else
+  *hits = 0;
+  *misses = 0;
+#endif /* HAGL_GLYPH_CACHE_SIZE */
+}
+
+void hagl_glyph_cache_clear(void) {
+#if HAGL_GLYPH_CACHE_SIZE > 0
+  memset(glyph_cache, 0, sizeof(glyph_cache));
+  glyph_cache_clock = 0;
+  glyph_cache_hits = 0;
+  glyph_cache_misses = 0;
+#endif /* HAGL_GLYPH_CACHE_SIZE */
+}
+
 uint8_t hagl_get_glyph(void const *_surface, wchar_t code, hagl_color_t color,
                        hagl_bitmap_t *bitmap, const uint8_t *font) {
   const hagl_surface_t *surface = _surface;
-  uint8_t status, set;
+  const hagl_bitmap_t *cached;
+  uint8_t status;
   fontx_glyph_t glyph;
 
   status = fontx_glyph(&glyph, code, font);
@@ -57,78 +159,30 @@ uint8_t hagl_get_glyph(void const *_surface, wchar_t code, hagl_color_t color,
   bitmap->pitch = bitmap->width * (bitmap->depth / 8);
   bitmap->size = bitmap->pitch * bitmap->height;
 
-  hagl_color_t *ptr = (hagl_color_t *)bitmap->buffer;
-
-  for (uint8_t y = 0; y < glyph.height; y++) {
-    for (uint8_t x = 0; x < glyph.width; x++) {
-      set = *(glyph.buffer) & (0x80 >> (x % 8));
-      if (set) {
-        *(ptr++) = color;
-      } else {
-        *(ptr++) = 0x00;
-      }
-    }
-    glyph.buffer += glyph.pitch;
+  cached = hagl_get_glyph_cached(surface, code, color, font);
+  if (cached) {
+    memcpy(bitmap->buffer, cached->buffer, bitmap->size);
+  } else {
+    expand_glyph((hagl_color_t *)bitmap->buffer, &glyph, color);
   }
 
   return 0;
 }
 
-uint8_t hagl_put_char_bitmap(void const *_surface, wchar_t code, int16_t x0,
+uint8_t hagl_put_char_bitmap(void const *surface, wchar_t code, int16_t x0,
                              int16_t y0, hagl_color_t color,
                              const uint8_t *font) {
-  static uint8_t *buffer = NULL;
-  static size_t buffer_size = 0;
-  const hagl_surface_t *surface = _surface;
-  uint8_t set, status;
-  hagl_bitmap_t bitmap;
-  fontx_glyph_t glyph;
-
-  status = fontx_glyph(&glyph, code, font);
-
-  if (0 != status) {
-    return 0;
-  }
-
-  /* Initialize character buffer when first called. */
-  if (NULL == buffer) {
-    buffer_size = glyph.width * glyph.height * 2;
-    buffer = malloc(buffer_size);
-  } else if (buffer_size < glyph.width * glyph.height * 2) {
-    buffer_size = glyph.width * glyph.height * 2;
-    buffer = realloc(buffer, buffer_size);
-  }
-
-  if (NULL == buffer) {
-    return 0;
-  }
-
-  hagl_bitmap_init(&bitmap, glyph.width, glyph.height, surface->depth,
-                   (uint8_t *)buffer);
-
-  hagl_color_t *ptr = (hagl_color_t *)bitmap.buffer;
-
-  for (uint8_t y = 0; y < glyph.height; y++) {
-    for (uint8_t x = 0; x < glyph.width; x++) {
-      set = *(glyph.buffer + x / 8) & (0x80 >> (x % 8));
-      if (set) {
-        *(ptr++) = color;
-      } else {
-        *(ptr++) = ~color;
-      }
-    }
-    glyph.buffer += glyph.pitch;
-  }
-
-  hagl_blit_mask(surface, x0, y0, &bitmap, ~color);
-
-  return bitmap.width;
+  /*
+   * Used to expand the glyph into a temporary bitmap and blit it with a
+   * mask color. Drawing runs of set bits directly gives the same output
+   * without the temporary buffer.
+   */
+  return hagl_put_char(surface, code, x0, y0, color, font);
 }
 
-uint8_t hagl_put_char(void const *_surface, wchar_t code, int16_t x0,
+uint8_t hagl_put_char(void const *surface, wchar_t code, int16_t x0,
                       int16_t y0, hagl_color_t color, const uint8_t *font) {
-  const hagl_surface_t *surface = _surface;
-  uint8_t set, status;
+  uint8_t status;
   fontx_glyph_t glyph;
 
   status = fontx_glyph(&glyph, code, font);
@@ -137,15 +191,8 @@ uint8_t hagl_put_char(void const *_surface, wchar_t code, int16_t x0,
     return 0;
   }
 
-  for (uint8_t y = 0; y < glyph.height; y++) {
-    for (uint8_t x = 0; x < glyph.width; x++) {
-      set = *(glyph.buffer + x / 8) & (0x80 >> (x % 8));
-      if (set) {
-        surface->put_pixel(&surface, x0 + x, y0 + y, color);
-      }
-    }
-    glyph.buffer += glyph.pitch;
-  }
+  hagl_blit_1bpp(surface, x0, y0, glyph.buffer, glyph.width, glyph.height,
+                 glyph.pitch, color);
 
   return glyph.width;
 }
@@ -0,0 +1,263 @@
+/**
+ * @file hagl_fb.c
+ * @brief hagl双缓冲分块帧缓冲后端(脏块跟踪 + 异步刷新)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-27
+ *
+ * THINK DIFFERENTLY
+ * @note hagl内部以&surface(局部指针的地址)作为self调用后端函数,
+ * 因此后端函数不使用self, 而是操作唯一的活动实例
+ */
+
+#include "hagl/fb.h"
+
+#include <string.h>
+
+// Private Defines --------------------------
+
+#define T HAGL_FB_TILE_SIZE
+#define BPP (sizeof(hagl_color_t))
+#define PIXEL(buf, x, y) \
+  ((hagl_color_t *)((buf) + (uint32_t)(y)*fb->pitch) + (x))
+#define MASK_TEST(mask, i) ((mask)[(i) >> 5] & (1UL << ((i)&31)))
+#define MASK_SET(mask, i) ((mask)[(i) >> 5] |= (1UL << ((i)&31)))
+
+// Private Variables ------------------------
+
+static hagl_fb_t *fb = NULL;
+static hagl_backend_t *fb_backend = NULL;
+
+// Private Functions ------------------------
+
+static void mark_rect(int16_t x0, int16_t y0, uint16_t w, uint16_t h) {
+  if (w == 0 || h == 0) return;  // 否则x0+w-1会小于起点
+  uint16_t tx0 = x0 / T, tx1 = (x0 + w - 1) / T;
+  uint16_t ty0 = y0 / T, ty1 = (y0 + h - 1) / T;
+  for (uint16_t ty = ty0; ty <= ty1; ty++) {
+    uint16_t idx = ty * fb->tiles_x + tx0;
+    for (uint16_t tx = tx0; tx <= tx1; tx++, idx++) MASK_SET(fb->dirty, idx);
+  }
+}
+
+/**
+ * @brief 从idx开始查找同一块行中连续的脏块
+ * @retval uint8_t          0: 没有更多脏块
+ */
+static uint8_t next_run(const uint32_t *mask, uint16_t *idx, int16_t *x,
+                        int16_t *y, uint16_t *w, uint16_t *h) {
+  uint16_t total = fb->tiles_x * fb->tiles_y;
+  uint16_t i = *idx;
+  while (i < total && !MASK_TEST(mask, i)) {
+    i = ((i & 31) == 0 && mask[i >> 5] == 0) ? i + 32 : i + 1;
+  }
+  if (i >= total) return 0;
+  uint16_t start = i;
+  uint16_t row_end = (start / fb->tiles_x + 1) * fb->tiles_x;
+  while (i < row_end && MASK_TEST(mask, i)) i++;
+  *idx = i;
+  *x = (start % fb->tiles_x) * T;
+  *y = (start / fb->tiles_x) * T;
+  *w = (i - start) * T;
+  if (*x + *w > fb->width) *w = fb->width - *x;
+  *h = *y + T > fb->height ? fb->height - *y : T;
+  return 1;
+}
+
+static void tx_pump(void) {
+  int16_t x, y;
+  uint16_t w, h;
+  if (fb->pumping) {  // 在传输回调中同步完成, 由外层循环继续
+    fb->done = 1;
+    return;
+  }
+  fb->pumping = 1;
+  while (1) {
+    fb->done = 0;
+    if (!next_run(fb->tx_dirty, &fb->tx_next, &x, &y, &w, &h)) {
+      fb->busy = 0;
+      break;
+    }
+    fb->tx_tiles += ((w + T - 1) / T);
+    fb->tx_bytes += (uint32_t)w * h * BPP;
+    fb->tx(x, y, w, h, (uint8_t *)PIXEL(fb->tx_buffer, x, y), fb->pitch);
+    if (fb->done) continue;
+    fb->pumping = 0;
+    if (!fb->done) return;  // 异步传输, 等待hagl_fb_tx_done
+    fb->pumping = 1;
+  }
+  fb->pumping = 0;
+}
+
+static void put_pixel(void *self, int16_t x0, int16_t y0, hagl_color_t color) {
+  (void)self;
+  *PIXEL(fb->buffer[0], x0, y0) = color;
+  uint16_t idx = (y0 / T) * fb->tiles_x + x0 / T;
+  MASK_SET(fb->dirty, idx);
+}
+
+static hagl_color_t get_pixel(void *self, int16_t x0, int16_t y0) {
+  (void)self;
+  return *PIXEL(fb->buffer[0], x0, y0);
+}
+
+static void hline(void *self, int16_t x0, int16_t y0, uint16_t width,
+                  hagl_color_t color) {
+  (void)self;
+  hagl_color_t *ptr = PIXEL(fb->buffer[0], x0, y0);
+  for (uint16_t x = 0; x < width; x++) *ptr++ = color;
+  mark_rect(x0, y0, width, 1);
+}
+
+static void vline(void *self, int16_t x0, int16_t y0, uint16_t height,
+                  hagl_color_t color) {
+  (void)self;
+  hagl_color_t *ptr = PIXEL(fb->buffer[0], x0, y0);
+  for (uint16_t y = 0; y < height; y++, ptr += fb->width) *ptr = color;
+  mark_rect(x0, y0, 1, height);
+}
+
+static void fill(void *self, int16_t x0, int16_t y0, uint16_t width,
+                 uint16_t height, hagl_color_t color) {
+  (void)self;
+  hagl_color_t *row = PIXEL(fb->buffer[0], x0, y0);
+  for (uint16_t y = 0; y < height; y++, row += fb->width) {
+    for (uint16_t x = 0; x < width; x++) row[x] = color;
+  }
+  mark_rect(x0, y0, width, height);
+}
+
+static void blit(void *self, int16_t x0, int16_t y0, hagl_bitmap_t *src) {
+  (void)self;
+  uint8_t *dst = (uint8_t *)PIXEL(fb->buffer[0], x0, y0);
+  const uint8_t *ptr = src->buffer;
+  for (uint16_t y = 0; y < src->height; y++) {
+    memcpy(dst, ptr, src->width * BPP);
+    dst += fb->pitch;
+    ptr += src->pitch;
+  }
+  mark_rect(x0, y0, src->width, src->height);
+}
+
+static uint8_t *map(void *self, int16_t x0, int16_t y0, uint16_t w,
+                    uint16_t h, uint32_t *pitch) {
+  (void)self;
+  mark_rect(x0, y0, w, h);
+  *pitch = fb->pitch;
+  return (uint8_t *)PIXEL(fb->buffer[0], x0, y0);
+}
+
+static void clear(void *self) {
+  (void)self;
+  memset(fb->buffer[0], 0, (size_t)fb->pitch * fb->height);
+  hagl_fb_invalidate();
+}
+
+static size_t flush(void *self) {
+  (void)self;
+  int16_t x, y;
+  uint16_t w, h, idx = 0;
+  size_t bytes = 0;
+  uint8_t any = 0;
+
+  while (fb->busy) {
+    HAGL_FB_WAIT();
+  }
+  for (uint16_t i = 0; i < HAGL_FB_MASK_WORDS; i++) any |= fb->dirty[i] != 0;
+  if (!any) return 0;
+
+  memcpy(fb->tx_dirty, fb->dirty, sizeof(fb->dirty));
+  memset(fb->dirty, 0, sizeof(fb->dirty));
+  fb->tx_buffer = fb->buffer[0];
+  if (fb->buffer[1] != NULL) {
+    // 交换缓冲区, 并将本帧的脏块同步到新的后台缓冲
+    fb->buffer[0] = fb->buffer[1];
+    fb->buffer[1] = fb->tx_buffer;
+    fb_backend->buffer = fb->buffer[0];
+    fb_backend->buffer2 = fb->buffer[1];
+  }
+  while (next_run(fb->tx_dirty, &idx, &x, &y, &w, &h)) {
+    bytes += (size_t)w * h * BPP;
+    if (fb->buffer[1] == NULL) continue;
+    const uint8_t *src = (uint8_t *)PIXEL(fb->tx_buffer, x, y);
+    uint8_t *dst = (uint8_t *)PIXEL(fb->buffer[0], x, y);
+    for (uint16_t i = 0; i < h; i++) {
+      memcpy(dst, src, (size_t)w * BPP);
+      src += fb->pitch;
+      dst += fb->pitch;
+    }
+  }
+
+  fb->frames++;
+  fb->tx_next = 0;
+  fb->busy = 1;
+  tx_pump();
+  if (fb->buffer[1] == NULL) {  // 单缓冲: 传输完成前不能继续绘制
+    while (fb->busy) {
+      HAGL_FB_WAIT();
+    }
+  }
+  return bytes;
+}
+
+static void fb_close(void *self) {
+  (void)self;
+  while (fb->busy) {
+    HAGL_FB_WAIT();
+  }
+}
+
+// Public Functions -------------------------
+
+uint8_t hagl_fb_init(hagl_backend_t *backend, hagl_fb_t *_fb, uint16_t width,
+                     uint16_t height, uint8_t *buf1, uint8_t *buf2,
+                     hagl_fb_tx_t tx) {
+  uint32_t tiles = (uint32_t)((width + T - 1) / T) * ((height + T - 1) / T);
+  if (tiles > HAGL_FB_MAX_TILES || buf1 == NULL || tx == NULL) return 1;
+  memset(_fb, 0, sizeof(hagl_fb_t));
+  _fb->width = width;
+  _fb->height = height;
+  _fb->pitch = width * BPP;
+  _fb->tiles_x = (width + T - 1) / T;
+  _fb->tiles_y = (height + T - 1) / T;
+  _fb->buffer[0] = buf1;
+  _fb->buffer[1] = buf2;
+  _fb->tx = tx;
+  fb = _fb;
+  fb_backend = backend;
+
+  backend->width = width;
+  backend->height = height;
+  backend->depth = BPP * 8;
+  backend->put_pixel = put_pixel;
+  backend->get_pixel = get_pixel;
+  backend->hline = hline;
+  backend->vline = vline;
+  backend->fill = fill;
+  backend->blit = blit;
+  backend->map = map;
+  backend->clear = clear;
+  backend->flush = flush;
+  backend->close = fb_close;
+  backend->buffer = buf1;
+  backend->buffer2 = buf2;
+
+  if (buf2 != NULL) memcpy(buf2, buf1, (size_t)_fb->pitch * height);
+  hagl_fb_invalidate();
+  return 0;
+}
+
+void hagl_fb_tx_done(void) {
+  if (fb != NULL && fb->busy) tx_pump();
+}
+
+uint8_t hagl_fb_busy(void) { return fb != NULL && fb->busy; }
+
+void hagl_fb_invalidate(void) {
+  if (fb == NULL) return;
+  uint16_t total = fb->tiles_x * fb->tiles_y;
+  memset(fb->dirty, 0, sizeof(fb->dirty));
+  for (uint16_t i = 0; i < total; i++) MASK_SET(fb->dirty, i);
+}
+
+// Source Code End --------------------------
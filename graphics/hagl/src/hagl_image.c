@@ -34,78 +34,189 @@ SPDX-License-Identifier: MIT
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "hagl.h"
+#include "hagl/backend.h"
 #include "hagl/image.h"
 #include "hagl/surface.h"
 #include "hagl_tjpgd.h"
 
 typedef struct {
-  FILE *fp;
+  hagl_image_read_t read;
+  void *ctx;
   int16_t x0;
   int16_t y0;
   const hagl_surface_t *surface;
 } tjpgd_iodev_t;
 
+typedef struct {
+  const uint8_t *data;
+  size_t size;
+  size_t offset;
+} tjpgd_memory_t;
+
 static uint16_t tjpgd_data_reader(JDEC *decoder, uint8_t *buffer,
                                   uint16_t size) {
   tjpgd_iodev_t *device = (tjpgd_iodev_t *)decoder->device;
 
-  if (buffer) {
-    /* Read bytes from input stream. */
-    return (uint16_t)fread(buffer, 1, size, device->fp);
-  } else {
-    /* Skip bytes from input stream. */
-    return fseek(device->fp, size, SEEK_CUR) ? 0 : size;
-  }
+  return device->read(device->ctx, buffer, size);
 }
 
 static uint16_t tjpgd_data_writer(JDEC *decoder, void *bitmap,
                                   JRECT *rectangle) {
   tjpgd_iodev_t *device = (tjpgd_iodev_t *)decoder->device;
-  uint8_t width = (rectangle->right - rectangle->left) + 1;
-  uint8_t height = (rectangle->bottom - rectangle->top) + 1;
+  const hagl_surface_t *surface = device->surface;
+  uint8_t bytes = surface->depth / 8;
+  uint16_t width = (rectangle->right - rectangle->left) + 1;
+  uint16_t height = (rectangle->bottom - rectangle->top) + 1;
+  int16_t x0 = rectangle->left + device->x0;
+  int16_t y0 = rectangle->top + device->y0;
+  int16_t x1 = x0 + width - 1;
+  int16_t y1 = y0 + height - 1;
 
   hagl_bitmap_t block = {.width = width,
                          .height = height,
-                         .depth = device->surface->depth,
-                         .pitch = width * (device->surface->depth / 8),
-                         .size = width * (device->surface->depth / 8) * height,
+                         .depth = surface->depth,
+                         .pitch = width * bytes,
+                         .size = width * bytes * height,
                          .buffer = (uint8_t *)bitmap};
 
-  hagl_blit(device->surface, rectangle->left + device->x0,
-            rectangle->top + device->y0, &block);
+  /* Clip the block to the clip window, it keeps the pitch of the MCU. */
+  if ((x0 > surface->clip.x1) || (y0 > surface->clip.y1) ||
+      (x1 < surface->clip.x0) || (y1 < surface->clip.y0)) {
+    return 1;
+  }
+  if (x0 < surface->clip.x0) {
+    block.buffer += (surface->clip.x0 - x0) * bytes;
+    x0 = surface->clip.x0;
+  }
+  if (y0 < surface->clip.y0) {
+    block.buffer += (surface->clip.y0 - y0) * block.pitch;
+    y0 = surface->clip.y0;
+  }
+  if (x1 > surface->clip.x1) {
+    x1 = surface->clip.x1;
+  }
+  if (y1 > surface->clip.y1) {
+    y1 = surface->clip.y1;
+  }
+  block.width = x1 - x0 + 1;
+  block.height = y1 - y0 + 1;
+
+  if (surface->blit) {
+    surface->blit(&surface, x0, y0, &block);
+  } else {
+    for (uint16_t y = 0; y < block.height; y++) {
+      hagl_color_t *ptr = (hagl_color_t *)(block.buffer + y * block.pitch);
+      for (uint16_t x = 0; x < block.width; x++) {
+        surface->put_pixel(&surface, x0 + x, y0 + y, ptr[x]);
+      }
+    }
+  }
 
   return 1;
 }
 
-uint32_t hagl_load_image(void const *surface, int16_t x0, int16_t y0,
-                         const char *filename) {
+static uint8_t *tjpgd_data_map(JDEC *decoder, JRECT *rectangle,
+                               uint16_t *pitch) {
+  tjpgd_iodev_t *device = (tjpgd_iodev_t *)decoder->device;
+  const hagl_backend_t *backend = (const hagl_backend_t *)device->surface;
+  int16_t x0 = rectangle->left + device->x0;
+  int16_t y0 = rectangle->top + device->y0;
+  int16_t x1 = rectangle->right + device->x0;
+  int16_t y1 = rectangle->bottom + device->y0;
+  uint32_t bytes;
+  uint8_t *buffer;
+
+  /* Only MCUs fully inside of clip window, writer clips the others. */
+  if ((x0 < backend->clip.x0) || (y0 < backend->clip.y0) ||
+      (x1 > backend->clip.x1) || (y1 > backend->clip.y1)) {
+    return NULL;
+  }
+
+  buffer = backend->map(&backend, x0, y0, x1 - x0 + 1, y1 - y0 + 1, &bytes);
+  *pitch = (uint16_t)bytes;
+  return buffer;
+}
+
+static uint16_t file_reader(void *ctx, uint8_t *buffer, uint16_t size) {
+  FILE *fp = (FILE *)ctx;
+
+  if (buffer) {
+    /* Read bytes from input stream. */
+    return (uint16_t)fread(buffer, 1, size, fp);
+  } else {
+    /* Skip bytes from input stream. */
+    return fseek(fp, size, SEEK_CUR) ? 0 : size;
+  }
+}
+
+static uint16_t memory_reader(void *ctx, uint8_t *buffer, uint16_t size) {
+  tjpgd_memory_t *memory = (tjpgd_memory_t *)ctx;
+
+  if (size > memory->size - memory->offset) {
+    size = memory->size - memory->offset;
+  }
+  if (buffer) {
+    memcpy(buffer, memory->data + memory->offset, size);
+  }
+  memory->offset += size;
+  return size;
+}
+
+uint32_t hagl_load_image_stream(void const *surface, int16_t x0, int16_t y0,
+                                uint8_t scale, hagl_image_read_t read,
+                                void *ctx) {
   uint8_t work[3100];
   JDEC decoder;
   JRESULT result;
   tjpgd_iodev_t device;
+  const hagl_backend_t *backend = surface;
 
+  device.read = read;
+  device.ctx = ctx;
   device.x0 = x0;
   device.y0 = y0;
-  device.fp = fopen(filename, "rb");
   device.surface = surface;
 
-  if (!device.fp) {
-    return HAGL_ERR_FILE_IO;
+  result = jd_prepare(&decoder, tjpgd_data_reader, work, sizeof(work),
+                      (void *)&device);
+  if (JDR_OK != result) {
+    return HAGL_ERR_TJPGD + result;
   }
-  result = jd_prepare(&decoder, tjpgd_data_reader, work, 3100, (void *)&device);
-  if (result == JDR_OK) {
-    result = jd_decomp(&decoder, tjpgd_data_writer, 0);
-    if (JDR_OK != result) {
-      fclose(device.fp);
-      return HAGL_ERR_TJPGD + result;
-    }
-  } else {
-    fclose(device.fp);
+
+  /* Decoder output is RGB565, it can go straight to the draw buffer. */
+  if (backend->map && 16 == backend->depth) {
+    decoder.outdst = tjpgd_data_map;
+  }
+
+  result = jd_decomp(&decoder, tjpgd_data_writer, scale);
+  if (JDR_OK != result) {
     return HAGL_ERR_TJPGD + result;
   }
 
-  fclose(device.fp);
   return HAGL_OK;
 }
+
+uint32_t hagl_load_image_mem(void const *surface, int16_t x0, int16_t y0,
+                             uint8_t scale, const uint8_t *data, size_t size) {
+  tjpgd_memory_t memory = {.data = data, .size = size, .offset = 0};
+
+  return hagl_load_image_stream(surface, x0, y0, scale, memory_reader,
+                                &memory);
+}
+
+uint32_t hagl_load_image(void const *surface, int16_t x0, int16_t y0,
+                         const char *filename) {
+  uint32_t result;
+  FILE *fp = fopen(filename, "rb");
+
+  if (!fp) {
+    return HAGL_ERR_FILE_IO;
+  }
+  result = hagl_load_image_stream(surface, x0, y0, 0, file_reader, fp);
+
+  fclose(fp);
+  return result;
+}
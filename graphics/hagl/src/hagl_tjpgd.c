@@ -599,6 +599,90 @@ static JRESULT mcu_load(JDEC* jd /* Pointer to the decompressor object */
   return JDR_OK; /* All blocks have been loaded successfully */
 }
 
+/*-----------------------------------------------------------------------*/
+/* Pack an RGB pixel to RGB565 in the byte order of the display          */
+/*-----------------------------------------------------------------------*/
+
+static uint16_t rgb565_pack(uint8_t r, uint8_t g, uint8_t b) {
+  uint16_t w;
+
+  w = (r & 0xF8) << 8;  /* RRRRR----------- */
+  w |= (g & 0xFC) << 3; /* -----GGGGGG----- */
+  w |= b >> 3;          /* -----------BBBBB */
+#ifdef TJPGD_NEEDS_BYTESWAP
+  return (w >> 8) | (w << 8);
+#else
+  return w;
+#endif
+}
+
+#if JD_FORMAT == 1
+/*-----------------------------------------------------------------------*/
+/* Output an MCU straight into the RGB565 buffer mapped by outdst        */
+/*-----------------------------------------------------------------------*/
+
+static void mcu_output_direct(
+    JDEC* jd,       /* Pointer to the decompressor object */
+    uint8_t* dst,   /* Left-top pixel of the rectangle in the output buffer */
+    uint16_t pitch, /* Bytes per line of the output buffer */
+    uint16_t rx,    /* Output rectangular size (scaled and clipped) */
+    uint16_t ry) {
+  const int16_t CVACC = (sizeof(int16_t) > 2) ? 1024 : 128;
+  uint16_t ix, iy, mx, my;
+  int16_t yy, cb, cr;
+  uint8_t *py, *pc, *rgb24;
+  uint16_t* d;
+
+  mx = jd->msx * 8;
+  my = jd->msy * 8; /* MCU size (pixel) */
+
+  if (JD_USE_SCALE && jd->scale) {
+    /* Descaled MCU has been built in the working buffer as RGB888 */
+    mx >>= jd->scale;
+    for (iy = 0; iy < ry; iy++) {
+      rgb24 = (uint8_t*)jd->workbuf + iy * mx * 3;
+      d = (uint16_t*)(dst + (uint32_t)iy * pitch);
+      for (ix = 0; ix < rx; ix++, rgb24 += 3) {
+        *d++ = rgb565_pack(rgb24[0], rgb24[1], rgb24[2]);
+      }
+    }
+    return;
+  }
+
+  /* Convert YCbCr to RGB565 without the RGB888 pass and skip the pixels
+     truncated at right/bottom end */
+  for (iy = 0; iy < ry; iy++) {
+    pc = jd->mcubuf;
+    py = pc + iy * 8;
+    if (my == 16) { /* Double block height? */
+      pc += 64 * 4 + (iy >> 1) * 8;
+      if (iy >= 8) py += 64;
+    } else { /* Single block height */
+      pc += mx * 8 + iy * 8;
+    }
+    d = (uint16_t*)(dst + (uint32_t)iy * pitch);
+    for (ix = 0; ix < rx; ix++) {
+      cb = pc[0] - 128; /* Get Cb/Cr component and restore right level */
+      cr = pc[64] - 128;
+      if (mx == 16) { /* Double block width? */
+        if (ix == 8) py += 64 - 8; /* Jump to next block */
+        pc += ix & 1; /* Increase chroma pointer every two pixels */
+      } else {        /* Single block width */
+        pc++;         /* Increase chroma pointer every pixel */
+      }
+      yy = *py++; /* Get Y component */
+
+      *d++ = rgb565_pack(
+          /* R */ BYTECLIP(yy + ((int16_t)(1.402 * CVACC) * cr) / CVACC),
+          /* G */ BYTECLIP(yy - ((int16_t)(0.344 * CVACC) * cb +
+                                 (int16_t)(0.714 * CVACC) * cr) /
+                                    CVACC),
+          /* B */ BYTECLIP(yy + ((int16_t)(1.772 * CVACC) * cb) / CVACC));
+    }
+  }
+}
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Output an MCU: Convert YCrCb to RGB and output it in RGB form         */
 /*-----------------------------------------------------------------------*/
@@ -614,6 +698,10 @@ static JRESULT mcu_output(
   int16_t yy, cb, cr;
   uint8_t *py, *pc, *rgb24;
   JRECT rect;
+#if JD_FORMAT == 1
+  uint8_t* dst;
+  uint16_t pitch;
+#endif
 
   mx = jd->msx * 8;
   my = jd->msy * 8; /* MCU size (pixel) */
@@ -635,6 +723,15 @@ static JRESULT mcu_output(
   rect.top = y;
   rect.bottom = y + ry - 1;
 
+#if JD_FORMAT == 1
+  /* Map the rectangle in the output buffer if the application can */
+  dst = jd->outdst ? jd->outdst(jd, &rect, &pitch) : 0;
+  if (dst && (!JD_USE_SCALE || !jd->scale)) {
+    mcu_output_direct(jd, dst, pitch, rx, ry);
+    return JDR_OK;
+  }
+#endif
+
   if (!JD_USE_SCALE || jd->scale != 3) { /* Not for 1/8 scaling */
 
     /* Build an RGB MCU from discrete comopnents */
@@ -727,6 +824,13 @@ static JRESULT mcu_output(
     }
   }
 
+#if JD_FORMAT == 1
+  if (dst) { /* Descaled MCU goes to the output buffer */
+    mcu_output_direct(jd, dst, pitch, rx, ry);
+    return JDR_OK;
+  }
+#endif
+
   /* Squeeze up pixel table if a part of MCU is to be truncated */
   mx >>= jd->scale;
   if (rx < mx) {
@@ -747,18 +851,12 @@ static JRESULT mcu_output(
   /* Convert RGB888 to RGB565 if needed */
   if (JD_FORMAT == 1) {
     uint8_t* s = (uint8_t*)jd->workbuf;
-    uint16_t w, *d = (uint16_t*)s;
+    uint16_t* d = (uint16_t*)s;
     uint16_t n = rx * ry;
 
     do {
-      w = (*s++ & 0xF8) << 8;  /* RRRRR----------- */
-      w |= (*s++ & 0xFC) << 3; /* -----GGGGGG----- */
-      w |= *s++ >> 3;          /* -----------BBBBB */
-#ifdef TJPGD_NEEDS_BYTESWAP
-      *d++ = (w >> 8) | (w << 8);
-#else
-      *d++ = w;
-#endif
+      *d++ = rgb565_pack(s[0], s[1], s[2]);
+      s += 3;
     } while (--n);
   }
 
@@ -836,6 +934,7 @@ JRESULT jd_prepare(
   jd->sz_pool = sz_pool; /* Size of given work memory */
   jd->infunc = infunc;   /* Stream input function */
   jd->device = dev;      /* I/O device identifier */
+  jd->outdst = 0;        /* Output through outfunc by default */
   jd->nrst = 0;          /* No restart interval (default) */
 
   for (i = 0; i < 2; i++) { /* Nulls pointers */
@@ -172,6 +172,19 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Render the refreshed areas in horizontal bands on more threads (POSIX threads).
+ *Only for the software renderer. Requires LV_MEM_CUSTOM with a thread safe `malloc`.
+ *The draw events of the widgets (and custom draw callbacks) are called from the worker threads too*/
+#define LV_USE_PARALLEL_DRAW 0
+#if LV_USE_PARALLEL_DRAW
+    /*Max. number of threads (including the one calling `lv_timer_handler`).
+     *By default not more than the online CPUs, see `lv_refr_parallel_set_threads()`*/
+    #define LV_PARALLEL_DRAW_THREADS 4
+
+    /*Min. height of a band. Smaller areas are rendered on fewer threads*/
+    #define LV_PARALLEL_DRAW_MIN_ROWS 16
+#endif
+
 /*-------------
  * GPU
  *-----------*/
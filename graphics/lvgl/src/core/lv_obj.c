@@ -564,7 +564,16 @@ static void lv_obj_draw(lv_event_t * e)
 #if LV_DRAW_COMPLEX
         if(clip_corner) {
             lv_draw_mask_radius_param_t * mp = lv_mem_buf_get(sizeof(lv_draw_mask_radius_param_t));
+#if LV_USE_PARALLEL_DRAW
+            /*Widgets can't change `obj->coords` while drawing, but can move the drawn area
+             *in `LV_EVENT_DRAW_PART_BEGIN` (e.g. a transformed image). Clip to that area.*/
+            lv_area_t mask_area;
+            lv_area_copy(&mask_area, &coords);
+            lv_area_increase(&mask_area, -w, -h);
+            lv_draw_mask_radius_init(mp, &mask_area, draw_dsc.radius, false);
+#else
             lv_draw_mask_radius_init(mp, &obj->coords, draw_dsc.radius, false);
+#endif
             /*Add the mask and use `obj+8` as custom id. Don't use `obj` directly because it might be used by the user*/
             lv_draw_mask_add(mp, obj + 8);
 
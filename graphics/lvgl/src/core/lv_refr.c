@@ -8,6 +8,7 @@
  *********************/
 #include <stddef.h>
 #include "lv_refr.h"
+#include "lv_refr_parallel.h"
 #include "lv_disp.h"
 #include "../hal/lv_hal_tick.h"
 #include "../hal/lv_hal_disp.h"
@@ -56,6 +57,7 @@ static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
+static void refr_area_part_draw(lv_draw_ctx_t * draw_ctx);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
@@ -725,13 +727,32 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 #endif
     }
 
+#if LV_USE_PARALLEL_DRAW
+    if(!_lv_refr_parallel_draw(draw_ctx, refr_area_part_draw)) {
+        refr_area_part_draw(draw_ctx);
+    }
+#else
+    refr_area_part_draw(draw_ctx);
+#endif
+
+    draw_buf_flush(disp_refr);
+}
+
+/**
+ * Draw the screens and the layers on the clip area of a draw context
+ * @param draw_ctx pointer to a draw context. With LV_USE_PARALLEL_DRAW it can be called from more threads
+ *                 with different draw contexts having the same buffer but different clip areas.
+ */
+static void refr_area_part_draw(lv_draw_ctx_t * draw_ctx)
+{
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
-    /*Get the most top object which is not covered by others*/
-    top_act_scr = lv_refr_get_top_obj(draw_ctx->buf_area, lv_disp_get_scr_act(disp_refr));
+    /*Get the most top object which is not covered by others.
+     *Search on the clip area because with LV_USE_PARALLEL_DRAW it's only a band of the buffer.*/
+    top_act_scr = lv_refr_get_top_obj(draw_ctx->clip_area, lv_disp_get_scr_act(disp_refr));
     if(disp_refr->prev_scr) {
-        top_prev_scr = lv_refr_get_top_obj(draw_ctx->buf_area, disp_refr->prev_scr);
+        top_prev_scr = lv_refr_get_top_obj(draw_ctx->clip_area, disp_refr->prev_scr);
     }
 
     /*Draw a display background if there is no top object*/
@@ -794,8 +815,6 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     /*Also refresh top and sys layer unconditionally*/
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp_refr));
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
-
-    draw_buf_flush(disp_refr);
 }
 
 /**
@@ -0,0 +1,247 @@
+/**
+ * @file lv_refr_parallel.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_refr_parallel.h"
+
+#if LV_USE_PARALLEL_DRAW
+
+#include <pthread.h>
+#include <unistd.h>
+#include "lv_refr.h"
+#include "../hal/lv_hal_disp.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_math.h"
+#include "../misc/lv_log.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_gc.h"
+#include "../draw/sw/lv_draw_sw_gradient.h"
+#include "../font/lv_font_fmt_txt.h"
+
+#if LV_MEM_CUSTOM == 0
+    #error "LV_USE_PARALLEL_DRAW requires LV_MEM_CUSTOM with a thread safe malloc"
+#endif
+
+#if LV_PARALLEL_DRAW_THREADS < 2
+    #error "LV_PARALLEL_DRAW_THREADS should be at least 2"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define WORKER_MAX (LV_PARALLEL_DRAW_THREADS - 1)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    pthread_t thread;
+    lv_draw_ctx_t * draw_ctx;   /*Copy of the display's draw context, only `clip_area` differs*/
+    uint32_t draw_ctx_size;
+    lv_area_t clip_area;        /*The band to draw*/
+    uint32_t job_gen;           /*The last job seen by the worker*/
+    bool active;                /*Has a band in the current job*/
+} worker_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * worker_main(void * arg);
+static uint32_t workers_create(uint32_t num);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static worker_t workers[WORKER_MAX];
+static uint32_t worker_cnt;
+static uint32_t thread_num;                 /*0: as many as the online CPUs*/
+static uint32_t cpu_num;
+
+static pthread_mutex_t job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t job_cond = PTHREAD_COND_INITIALIZER;     /*Signaled when a new job is posted*/
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;    /*Signaled when the last band is ready*/
+static void (*job_cb)(lv_draw_ctx_t * draw_ctx);
+static uint32_t job_gen;
+static uint32_t job_pending;
+static bool job_quit;
+
+static pthread_mutex_t shared_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_refr_parallel_set_threads(uint32_t num)
+{
+    if(num > LV_PARALLEL_DRAW_THREADS) num = LV_PARALLEL_DRAW_THREADS;
+    thread_num = num;
+}
+
+uint32_t lv_refr_parallel_get_threads(void)
+{
+    if(thread_num) return thread_num;
+
+    /*More threads than CPUs only add the redrawing of the objects crossing the bands*/
+    if(cpu_num == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        cpu_num = n > 1 ? (uint32_t)n : 1;
+    }
+    return LV_MIN(cpu_num, LV_PARALLEL_DRAW_THREADS);
+}
+
+void lv_refr_parallel_deinit(void)
+{
+    pthread_mutex_lock(&job_mutex);
+    job_quit = true;
+    pthread_cond_broadcast(&job_cond);
+    pthread_mutex_unlock(&job_mutex);
+
+    uint32_t i;
+    for(i = 0; i < worker_cnt; i++) {
+        pthread_join(workers[i].thread, NULL);
+        lv_mem_free(workers[i].draw_ctx);
+        lv_memset_00(&workers[i], sizeof(worker_t));
+    }
+
+    worker_cnt = 0;
+    job_quit = false;
+}
+
+bool _lv_refr_parallel_draw(lv_draw_ctx_t * draw_ctx, void (*draw_cb)(lv_draw_ctx_t * draw_ctx))
+{
+    uint32_t num = lv_refr_parallel_get_threads();
+    if(num < 2) return false;
+
+    lv_coord_t h = lv_area_get_height(draw_ctx->clip_area);
+    uint32_t band_cnt = LV_MIN(num, (uint32_t)h / LV_PARALLEL_DRAW_MIN_ROWS);
+    if(band_cnt < 2) return false;
+
+    band_cnt = workers_create(band_cnt - 1) + 1;
+    if(band_cnt < 2) return false;
+
+    /*The first band is drawn on this thread, the others by the workers*/
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    uint32_t ctx_size = disp->driver->draw_ctx_size;
+    const lv_area_t * clip_ori = draw_ctx->clip_area;
+    lv_area_t clip_main = *clip_ori;
+    clip_main.y2 = clip_ori->y1 + h / band_cnt - 1;
+
+    pthread_mutex_lock(&job_mutex);
+    uint32_t i;
+    for(i = 0; i < worker_cnt; i++) {
+        worker_t * w = &workers[i];
+        w->active = i < band_cnt - 1;
+        if(!w->active) continue;
+
+        if(w->draw_ctx_size < ctx_size) {
+            lv_mem_free(w->draw_ctx);
+            w->draw_ctx = lv_mem_alloc(ctx_size);
+            LV_ASSERT_MALLOC(w->draw_ctx);
+            w->draw_ctx_size = ctx_size;
+        }
+        lv_memcpy(w->draw_ctx, draw_ctx, ctx_size);
+
+        w->clip_area = *clip_ori;
+        w->clip_area.y1 = clip_ori->y1 + (h * (i + 1)) / band_cnt;
+        w->clip_area.y2 = clip_ori->y1 + (h * (i + 2)) / band_cnt - 1;
+        w->draw_ctx->clip_area = &w->clip_area;
+    }
+
+    job_cb = draw_cb;
+    job_pending = band_cnt - 1;
+    job_gen++;
+    pthread_cond_broadcast(&job_cond);
+    pthread_mutex_unlock(&job_mutex);
+
+    draw_ctx->clip_area = &clip_main;
+    draw_cb(draw_ctx);
+    draw_ctx->clip_area = clip_ori;
+
+    pthread_mutex_lock(&job_mutex);
+    while(job_pending) {
+        pthread_cond_wait(&done_cond, &job_mutex);
+    }
+    pthread_mutex_unlock(&job_mutex);
+
+    return true;
+}
+
+void _lv_refr_parallel_lock(void)
+{
+    pthread_mutex_lock(&shared_mutex);
+}
+
+void _lv_refr_parallel_unlock(void)
+{
+    pthread_mutex_unlock(&shared_mutex);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Create the worker threads if there are less than `num`
+ * @param num   the required number of workers
+ * @return      the number of workers which can be used (can be less than `num` if a thread can't be created)
+ */
+static uint32_t workers_create(uint32_t num)
+{
+    while(worker_cnt < num) {
+        worker_t * w = &workers[worker_cnt];
+        /*Set before starting the thread to not miss a job posted right after this*/
+        w->job_gen = job_gen;
+        if(pthread_create(&w->thread, NULL, worker_main, w) != 0) {
+            LV_LOG_WARN("couldn't create a draw thread");
+            break;
+        }
+        worker_cnt++;
+    }
+
+    return LV_MIN(worker_cnt, num);
+}
+
+static void * worker_main(void * arg)
+{
+    worker_t * w = arg;
+
+    pthread_mutex_lock(&job_mutex);
+    while(1) {
+        while(!job_quit && w->job_gen == job_gen) {
+            pthread_cond_wait(&job_cond, &job_mutex);
+        }
+        if(job_quit) break;
+
+        w->job_gen = job_gen;
+        if(!w->active) continue;
+
+        pthread_mutex_unlock(&job_mutex);
+        job_cb(w->draw_ctx);
+        if(w->draw_ctx->wait_for_finish) w->draw_ctx->wait_for_finish(w->draw_ctx);
+        pthread_mutex_lock(&job_mutex);
+
+        job_pending--;
+        if(job_pending == 0) pthread_cond_signal(&done_cond);
+    }
+    pthread_mutex_unlock(&job_mutex);
+
+    /*Free the thread local buffers and caches*/
+    lv_mem_buf_free_all();
+    _lv_font_clean_up_fmt_txt();
+    lv_gradient_free_cache();
+#if LV_DRAW_COMPLEX
+    _lv_draw_mask_cleanup();
+#endif
+
+    return NULL;
+}
+
+#endif /*LV_USE_PARALLEL_DRAW*/
@@ -0,0 +1,91 @@
+/**
+ * @file lv_refr_parallel.h
+ *
+ */
+
+#ifndef LV_REFR_PARALLEL_H
+#define LV_REFR_PARALLEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../draw/lv_draw.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_USE_PARALLEL_DRAW
+
+/**
+ * Set how many threads can draw an area. The worker threads are created when they are first needed.
+ * @param num       number of threads including the one calling `lv_timer_handler`,
+ *                  limited to `LV_PARALLEL_DRAW_THREADS`. 1: draw everything on the calling thread,
+ *                  0: as many as the online CPUs (default)
+ */
+void lv_refr_parallel_set_threads(uint32_t num);
+
+/**
+ * Get how many threads can draw an area
+ * @return          number of threads including the one calling `lv_timer_handler`
+ */
+uint32_t lv_refr_parallel_get_threads(void);
+
+/**
+ * Stop and join the worker threads and free their draw contexts and caches.
+ * They are created again on the next refresh.
+ */
+void lv_refr_parallel_deinit(void);
+
+/**
+ * Split the clip area of a draw context to horizontal bands and call `draw_cb` for each band in parallel.
+ * Every band gets its own copy of the draw context so the draw functions can freely modify it.
+ * Returns only when all the bands are ready.
+ * It shouldn't be used directly by the user.
+ * @param draw_ctx  the draw context of the display being refreshed
+ * @param draw_cb   function to draw the clip area of the passed draw context
+ * @return          true: the area was drawn; false: the area is too small or there are no threads,
+ *                  `draw_cb` should be called directly
+ */
+bool _lv_refr_parallel_draw(lv_draw_ctx_t * draw_ctx, void (*draw_cb)(lv_draw_ctx_t * draw_ctx));
+
+/**
+ * Lock the shared resources (e.g. image cache) which can't be used from more draw threads at the same time
+ */
+void _lv_refr_parallel_lock(void);
+
+/**
+ * Unlock the shared resources locked by `_lv_refr_parallel_lock()`
+ */
+void _lv_refr_parallel_unlock(void);
+
+#else
+
+#define _lv_refr_parallel_lock()
+#define _lv_refr_parallel_unlock()
+
+#endif /*LV_USE_PARALLEL_DRAW*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_REFR_PARALLEL_H*/
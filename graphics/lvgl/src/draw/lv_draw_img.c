@@ -11,6 +11,7 @@
 #include "../hal/lv_hal_disp.h"
 #include "../misc/lv_log.h"
 #include "../core/lv_refr.h"
+#include "../core/lv_refr_parallel.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
 
@@ -77,7 +78,10 @@ void lv_draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const
     }
 
     if(res != LV_RES_OK) {
+        /*The image cache and the decoders are shared by the draw threads*/
+        _lv_refr_parallel_lock();
         res = decode_and_draw(draw_ctx, dsc, coords, src);
+        _lv_refr_parallel_unlock();
     }
 
     if(res != LV_RES_OK) {
@@ -88,6 +88,11 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         return;
     }
 
+#if LV_USE_PARALLEL_DRAW
+    /*The hint is written while drawing so it can't be shared by the draw threads*/
+    hint = NULL;
+#endif
+
     lv_draw_label_dsc_t dsc_mod = *dsc;
 
     const lv_font_t * font = dsc->font;
@@ -11,6 +11,7 @@
 #include "../../misc/lv_txt_ap.h"
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_assert.h"
+#include "../../misc/lv_gc.h"
 #include "lv_draw_sw_dither.h"
 
 /*********************
@@ -53,9 +54,9 @@ static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer
  *  STATIC VARIABLES
  **********************/
 #if defined(LV_SHADOW_CACHE_SIZE) && LV_SHADOW_CACHE_SIZE > 0
-    static uint8_t sh_cache[LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE];
-    static int32_t sh_cache_size = -1;
-    static int32_t sh_cache_r = -1;
+    static LV_THREAD_LOCAL uint8_t sh_cache[LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE];
+    static LV_THREAD_LOCAL int32_t sh_cache_size = -1;
+    static LV_THREAD_LOCAL int32_t sh_cache_r = -1;
 #endif
 
 /**********************
@@ -412,6 +412,36 @@
     #endif
 #endif
 
+/*Render the refreshed areas in horizontal bands on more threads (POSIX threads).
+ *Only for the software renderer. Requires LV_MEM_CUSTOM with a thread safe `malloc`.
+ *The draw events of the widgets (and custom draw callbacks) are called from the worker threads too*/
+#ifndef LV_USE_PARALLEL_DRAW
+    #ifdef CONFIG_LV_USE_PARALLEL_DRAW
+        #define LV_USE_PARALLEL_DRAW CONFIG_LV_USE_PARALLEL_DRAW
+    #else
+        #define LV_USE_PARALLEL_DRAW 0
+    #endif
+#endif
+#if LV_USE_PARALLEL_DRAW
+    /*Max. number of threads (including the one calling `lv_timer_handler`)*/
+    #ifndef LV_PARALLEL_DRAW_THREADS
+        #ifdef CONFIG_LV_PARALLEL_DRAW_THREADS
+            #define LV_PARALLEL_DRAW_THREADS CONFIG_LV_PARALLEL_DRAW_THREADS
+        #else
+            #define LV_PARALLEL_DRAW_THREADS 4
+        #endif
+    #endif
+
+    /*Min. height of a band. Smaller areas are rendered on fewer threads*/
+    #ifndef LV_PARALLEL_DRAW_MIN_ROWS
+        #ifdef CONFIG_LV_PARALLEL_DRAW_MIN_ROWS
+            #define LV_PARALLEL_DRAW_MIN_ROWS CONFIG_LV_PARALLEL_DRAW_MIN_ROWS
+        #else
+            #define LV_PARALLEL_DRAW_MIN_ROWS 16
+        #endif
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
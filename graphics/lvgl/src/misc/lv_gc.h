@@ -32,6 +32,13 @@ extern "C" {
 #    define LV_IMG_CACHE_DEF            0
 #endif
 
+/*Storage class of the state used while drawing. Thread local if the areas are drawn on more threads*/
+#if LV_USE_PARALLEL_DRAW
+#    define LV_THREAD_LOCAL             __thread
+#else
+#    define LV_THREAD_LOCAL
+#endif
+
 #define LV_DISPATCH(f, t, n)            f(t, n)
 #define LV_DISPATCH_COND(f, t, n, m, v) LV_CONCAT3(LV_DISPATCH, m, v)(f, t, n)
 
@@ -53,13 +60,13 @@ extern "C" {
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t*, _lv_img_cache_array, LV_IMG_CACHE_DEF, 1)              \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0)              \
     LV_DISPATCH(f, lv_timer_t*, _lv_timer_act)                                                         \
-    LV_DISPATCH(f, lv_mem_buf_arr_t , lv_mem_buf)                                                      \
-    LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
-    LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)            \
+    LV_DISPATCH(f, LV_THREAD_LOCAL lv_mem_buf_arr_t , lv_mem_buf)                                      \
+    LV_DISPATCH_COND(f, LV_THREAD_LOCAL _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1) \
+    LV_DISPATCH_COND(f, LV_THREAD_LOCAL _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1) \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                                  \
     LV_DISPATCH(f, void * , _lv_theme_basic_styles)                                                  \
-    LV_DISPATCH_COND(f, uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)                    \
-    LV_DISPATCH(f, uint8_t * , _lv_grad_cache_mem)                                                     \
+    LV_DISPATCH_COND(f, LV_THREAD_LOCAL uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)    \
+    LV_DISPATCH(f, LV_THREAD_LOCAL uint8_t * , _lv_grad_cache_mem)                                     \
     LV_DISPATCH(f, uint8_t * , _lv_style_custom_prop_flag_lookup_table)
 
 #define LV_DEFINE_ROOT(root_type, root_name) root_type root_name;
@@ -69,6 +76,9 @@ extern "C" {
 #if LV_MEM_CUSTOM != 1
 #error "GC requires CUSTOM_MEM"
 #endif /*LV_MEM_CUSTOM*/
+#if LV_USE_PARALLEL_DRAW
+#error "GC can't be used with LV_USE_PARALLEL_DRAW"
+#endif /*LV_USE_PARALLEL_DRAW*/
 #include LV_GC_INCLUDE
 #else  /*LV_ENABLE_GC*/
 #define LV_GC_ROOT(x) x
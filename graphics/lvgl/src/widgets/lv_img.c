@@ -33,6 +33,7 @@ static void lv_img_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_img_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_img_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_img(lv_event_t * e);
+static void get_bg_coords(lv_obj_t * obj, lv_area_t * bg_coords);
 
 /**********************
  *  STATIC VARIABLES
@@ -514,6 +515,23 @@ static void lv_img_event(const lv_obj_class_t * class_p, lv_event_t * e)
     else if(code == LV_EVENT_DRAW_MAIN || code == LV_EVENT_DRAW_POST || code == LV_EVENT_COVER_CHECK) {
         draw_img(e);
     }
+#if LV_USE_PARALLEL_DRAW
+    else if(code == LV_EVENT_DRAW_PART_BEGIN) {
+        /*`obj->coords` can't be swapped while the other draw threads read it,
+         *so move the background and border of the base object to the transformed area here*/
+        lv_obj_draw_part_dsc_t * dsc = lv_event_get_draw_part_dsc(e);
+        if(dsc->class_p == &lv_obj_class && dsc->part == LV_PART_MAIN &&
+           (dsc->type == LV_OBJ_DRAW_PART_RECTANGLE || dsc->type == LV_OBJ_DRAW_PART_BORDER_POST)) {
+            lv_coord_t w = lv_obj_get_style_transform_width(obj, LV_PART_MAIN);
+            lv_coord_t h = lv_obj_get_style_transform_height(obj, LV_PART_MAIN);
+            get_bg_coords(obj, dsc->draw_area);
+            dsc->draw_area->x1 -= w;
+            dsc->draw_area->x2 += w;
+            dsc->draw_area->y1 -= h;
+            dsc->draw_area->y2 += h;
+        }
+    }
+#endif
 }
 
 static void draw_img(lv_event_t * e)
@@ -569,35 +587,20 @@ static void draw_img(lv_event_t * e)
     }
     else if(code == LV_EVENT_DRAW_MAIN || code == LV_EVENT_DRAW_POST) {
 
-        lv_coord_t obj_w = lv_obj_get_width(obj);
-        lv_coord_t obj_h = lv_obj_get_height(obj);
-
         lv_coord_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
         lv_coord_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
         lv_coord_t pright = lv_obj_get_style_pad_right(obj, LV_PART_MAIN) + border_width;
         lv_coord_t ptop = lv_obj_get_style_pad_top(obj, LV_PART_MAIN) + border_width;
         lv_coord_t pbottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN) + border_width;
 
-        lv_point_t bg_pivot;
-        bg_pivot.x = img->pivot.x + pleft;
-        bg_pivot.y = img->pivot.y + ptop;
         lv_area_t bg_coords;
+        get_bg_coords(obj, &bg_coords);
 
-        if(img->obj_size_mode == LV_IMG_SIZE_MODE_REAL) {
-            /*Object size equals to transformed image size*/
-            lv_obj_get_coords(obj, &bg_coords);
-        }
-        else {
-            _lv_img_buf_get_transformed_area(&bg_coords, obj_w, obj_h,
-                                             img->angle, img->zoom, &bg_pivot);
-
-            /*Modify the coordinates to draw the background for the rotated and scaled coordinates*/
-            bg_coords.x1 += obj->coords.x1;
-            bg_coords.y1 += obj->coords.y1;
-            bg_coords.x2 += obj->coords.x1;
-            bg_coords.y2 += obj->coords.y1;
-        }
-
+#if LV_USE_PARALLEL_DRAW
+        /*The background is moved to `bg_coords` in LV_EVENT_DRAW_PART_BEGIN*/
+        lv_res_t res = lv_obj_event_base(MY_CLASS, e);
+        if(res != LV_RES_OK) return;
+#else
         lv_area_t ori_coords;
         lv_area_copy(&ori_coords, &obj->coords);
         lv_area_copy(&obj->coords, &bg_coords);
@@ -606,6 +609,7 @@ static void draw_img(lv_event_t * e)
         if(res != LV_RES_OK) return;
 
         lv_area_copy(&obj->coords, &ori_coords);
+#endif
 
         if(code == LV_EVENT_DRAW_MAIN) {
             if(img->h == 0 || img->w == 0) return;
@@ -689,4 +693,34 @@ static void draw_img(lv_event_t * e)
     }
 }
 
+/**
+ * Get the area of the background: the transformed area of the object
+ * @param obj       pointer to an image object
+ * @param bg_coords store the absolute coordinates here
+ */
+static void get_bg_coords(lv_obj_t * obj, lv_area_t * bg_coords)
+{
+    lv_img_t * img = (lv_img_t *)obj;
+
+    if(img->obj_size_mode == LV_IMG_SIZE_MODE_REAL) {
+        /*Object size equals to transformed image size*/
+        lv_obj_get_coords(obj, bg_coords);
+        return;
+    }
+
+    lv_coord_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    lv_point_t bg_pivot;
+    bg_pivot.x = img->pivot.x + lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
+    bg_pivot.y = img->pivot.y + lv_obj_get_style_pad_top(obj, LV_PART_MAIN) + border_width;
+
+    _lv_img_buf_get_transformed_area(bg_coords, lv_obj_get_width(obj), lv_obj_get_height(obj),
+                                     img->angle, img->zoom, &bg_pivot);
+
+    /*Modify the coordinates to draw the background for the rotated and scaled coordinates*/
+    bg_coords->x1 += obj->coords.x1;
+    bg_coords->y1 += obj->coords.y1;
+    bg_coords->x2 += obj->coords.x1;
+    bg_coords->y2 += obj->coords.y1;
+}
+
 #endif
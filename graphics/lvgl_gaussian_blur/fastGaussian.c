@@ -0,0 +1,136 @@
+/**
+ * @file fastGaussian.c
+ * @brief 可分离的三次盒式模糊近似高斯模糊(每像素O(1), 原地处理)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-28
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "fastGaussian.h"
+
+#include <math.h>
+
+// Private Defines --------------------------
+
+#define BOX_PASSES 3
+#define FIELD_MASK 0x1FFFFFULL  // 每通道21位, 累加器按B/G/R打包为 0/21/42 位
+// 1/win为Q32, 32x32->64位乘法. Q16倒数在窗口较大时误差超过0.5LSB,
+// 饱和通道会得到最大值+1(RGB888中白色变黑)或-1
+#define INV_HALF 0x80000000ULL
+#define MUL32(a, b) ((uint64_t)(uint32_t)(a) * (uint32_t)(b))  // 单条UMULL
+
+enum { FMT_RGB565, FMT_RGB888 };
+
+// Private Functions ------------------------
+
+/**
+ * @brief 计算n次盒式模糊逼近给定sigma的高斯模糊时每次的盒半径
+ */
+static void boxes_for_gauss(float sigma, int *radii) {
+  const int n = BOX_PASSES;
+  float w_ideal = sqrtf(12.0f * sigma * sigma / n + 1.0f);
+  int wl = (int)w_ideal;
+  if (wl % 2 == 0) wl--;
+  int wu = wl + 2;
+  float m_ideal = (12.0f * sigma * sigma - n * wl * wl - 4.0f * n * wl -
+                   3.0f * n) /
+                  (-4.0f * wl - 4.0f);
+  int m = (int)lroundf(m_ideal);
+  for (int i = 0; i < n; i++) radii[i] = ((i < m ? wl : wu) - 1) / 2;
+}
+
+static inline __attribute__((always_inline)) uint64_t expand(
+    const uint8_t *p, const int fmt) {
+  if (fmt == FMT_RGB565) {
+    uint16_t c = *(const uint16_t *)p;
+    return (c & 0x1F) | ((uint64_t)(c & 0x7E0) << 16) |
+           ((uint64_t)(c & 0xF800) << 31);
+  }
+  return p[0] | ((uint64_t)p[1] << 21) | ((uint64_t)p[2] << 42);
+}
+
+static inline __attribute__((always_inline)) void pack(uint8_t *p,
+                                                       uint64_t sum,
+                                                       uint32_t inv,
+                                                       const int fmt) {
+  uint32_t c0 = (MUL32(sum & FIELD_MASK, inv) + INV_HALF) >> 32;
+  uint32_t c1 = (MUL32((sum >> 21) & FIELD_MASK, inv) + INV_HALF) >> 32;
+  uint32_t c2 = (MUL32(sum >> 42, inv) + INV_HALF) >> 32;
+  if (fmt == FMT_RGB565) {
+    *(uint16_t *)p = (uint16_t)((c2 << 11) | (c1 << 5) | c0);
+  } else {
+    p[0] = c0;
+    p[1] = c1;
+    p[2] = c2;
+  }
+}
+
+/**
+ * @brief 一行/一列上的n次盒式模糊, line为行缓冲
+ * @param  p                首像素
+ * @param  n                像素数
+ * @param  step             相邻像素间隔(字节)
+ */
+static inline __attribute__((always_inline)) void blur_line(
+    uint8_t *p, int n, int step, const int *radii, uint64_t *line,
+    const int fmt) {
+  for (int pass = 0; pass < BOX_PASSES; pass++) {
+    int rb = radii[pass];
+    if (rb <= 0) continue;
+    uint32_t win = 2 * rb + 1;
+    uint32_t inv = (uint32_t)(((1ULL << 32) + win / 2) / win);
+    uint8_t *q = p;
+    for (int i = 0; i < n; i++, q += step) line[i] = expand(q, fmt);
+
+    // 窗口超出边缘的部分用边缘像素填充
+    uint64_t sum = line[0] * (uint64_t)(rb + 1);
+    for (int i = 1; i <= rb; i++) sum += line[i < n ? i : n - 1];
+    q = p;
+    for (int i = 0; i < n; i++, q += step) {
+      pack(q, sum, inv, fmt);
+      int in = i + rb + 1, out = i - rb;
+      sum += line[in < n ? in : n - 1];  // 先加后减, 各通道不会借位
+      sum -= line[out > 0 ? out : 0];
+    }
+  }
+}
+
+static inline __attribute__((always_inline)) int blur(void *buf, int width,
+                                                      int height, int stride,
+                                                      int radius,
+                                                      const int fmt) {
+  const int bpp = fmt == FMT_RGB565 ? 2 : 3;
+  int radii[BOX_PASSES];
+  if (radius <= 0 || width <= 0 || height <= 0) return 0;
+  if (radius > FAST_GAUSSIAN_MAX_RADIUS) radius = FAST_GAUSSIAN_MAX_RADIUS;
+  boxes_for_gauss(radius / 2.0f, radii);
+
+  uint64_t *line = (uint64_t *)m_alloc(
+      (size_t)(width > height ? width : height) * sizeof(uint64_t));
+  if (line == NULL) return -1;
+  uint8_t *base = (uint8_t *)buf;
+  for (int y = 0; y < height; y++) {  // 水平方向
+    blur_line(base + y * stride, width, bpp, radii, line, fmt);
+  }
+  for (int x = 0; x < width; x++) {  // 垂直方向
+    blur_line(base + x * bpp, height, stride, radii, line, fmt);
+  }
+  m_free(line);
+  return 0;
+}
+
+// Public Functions -------------------------
+
+int FastGaussianBlur_RGB565(void *buf, int width, int height, int stride,
+                            int radius) {
+  return blur(buf, width, height, stride, radius, FMT_RGB565);
+}
+
+int FastGaussianBlur_RGB888(void *buf, int width, int height, int stride,
+                            int radius) {
+  return blur(buf, width, height, stride, radius, FMT_RGB888);
+}
+
+// Source Code End --------------------------
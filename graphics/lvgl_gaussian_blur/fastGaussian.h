@@ -0,0 +1,48 @@
+/**
+ * @file fastGaussian.h
+ * @brief 可分离的三次盒式模糊近似高斯模糊(每像素O(1), 原地处理)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-28
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __FASTGAUSSIAN_H__
+#define __FASTGAUSSIAN_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "modules.h"
+
+#define FAST_GAUSSIAN_MAX_RADIUS 1000  // 半径上限(每通道21位的窗口和不溢出)
+
+/**
+ * @brief 对RGB565图像原地做近似高斯模糊
+ * @param  buf              图像首像素(本机字节序的uint16_t)
+ * @param  width            宽度
+ * @param  height           高度
+ * @param  stride           每行字节数
+ * @param  radius           模糊半径(sigma = radius / 2, 与GAUSSSIANM一致)
+ * @retval int              0: 成功 -1: 行缓冲分配失败
+ * @note 横向/纵向各做三次滑动窗口盒式模糊, 耗时与半径无关;
+ * 三个通道打包在一个64位累加器中并行累加, 除法用定点倒数乘法代替
+ * @note 只申请一个max(width, height)*8字节的行缓冲, 边缘按复制边缘像素处理
+ */
+extern int FastGaussianBlur_RGB565(void *buf, int width, int height,
+                                   int stride, int radius);
+
+/**
+ * @brief 对24位紧凑排列图像(每像素3字节, 如BGR)原地做近似高斯模糊
+ * @note 参数同FastGaussianBlur_RGB565
+ */
+extern int FastGaussianBlur_RGB888(void *buf, int width, int height,
+                                   int stride, int radius);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !__FASTGAUSSIAN_H__
@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "fastGaussian.h"
 #include "log.h"
 
 typedef struct {
@@ -83,8 +84,73 @@ static inline int isSquare(float x, float y, float circle_x, float circle_y,
   return true;
 }
 
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+/**
+ * @brief 16位色深下直接在canvas缓冲区上原地模糊, 不做整块拷贝
+ * @note 仅支持LV_IMG_CF_TRUE_COLOR; 圆角外的像素在模糊前保存, 之后还原
+ */
+static void FastBlurCanvas16(lv_draw_gaussian_blur_dsc_t *dsc) {
+  lv_img_dsc_t *img = lv_canvas_get_img(dsc->canvas);
+  if (img->header.cf != LV_IMG_CF_TRUE_COLOR) return;
+  int x = dsc->x, y = dsc->y, w = dsc->width, h = dsc->height;
+  if (x < 0 || y < 0 || x + w > img->header.w || y + h > img->header.h ||
+      w <= 0 || h <= 0) {
+    return;
+  }
+  int cw = img->header.w;
+  lv_color_t *buf = (lv_color_t *)img->data;
+  int bw = dsc->border_width, br = dsc->border_radius;
+  // 只有距边缘m以内的像素需要处理圆角和边框, 中间部分直接跳过
+  int m = (br > bw ? br : bw) + 1;
+#define FOR_EACH_EDGE_PX(...)                                 \
+  for (int j = 0; j < h; j++) {                               \
+    for (int i = 0; i < w; i++) {                             \
+      if (j >= m && j < h - m && i == m && w - m > m) i = w - m;\
+      int px = x + i, py = y + j;                             \
+      lv_color_t *p = &buf[py * cw + px];                     \
+      (void)p;                                                \
+      __VA_ARGS__;                                            \
+    }                                                         \
+  }
+
+  int outside = 0;
+  FOR_EACH_EDGE_PX(if (!isCircle(px, py, x, y, w, h, br)) outside++);
+  lv_color_t *saved = NULL;
+  if (outside) {
+    saved = (lv_color_t *)m_alloc(outside * sizeof(lv_color_t));
+    if (saved == NULL) return;
+    int k = 0;
+    FOR_EACH_EDGE_PX(if (!isCircle(px, py, x, y, w, h, br)) saved[k++] = *p);
+  }
+
+  if (FastGaussianBlur_RGB565(&buf[y * cw + x], w, h,
+                              cw * sizeof(lv_color_t), dsc->r) != 0) {
+    LOG_W("FastGaussian: no memory");
+  }
+
+  int k = 0;
+  FOR_EACH_EDGE_PX(
+      if (!isCircle(px, py, x, y, w, h, br)) {
+        *p = saved[k++];
+      } else if (!isCircle(px, py, x + bw, y + bw, w - bw * 2, h - bw * 2,
+                           br) ||
+                 !isSquare(px, py, x, y, w, h, bw)) {
+        *p = dsc->border_color;
+      });
+#undef FOR_EACH_EDGE_PX
+  if (saved) m_free(saved);
+  lv_obj_invalidate(dsc->canvas);
+}
+#endif
+
 void lv_draw_gaussian_blur(lv_draw_gaussian_blur_dsc_t lv_gaussian_blur) {
-  if (LV_COLOR_DEPTH != 32) return;  // 仅支持32位颜色深度
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+  if (lv_gaussian_blur.blur_type == FASTGAUSSIAN) {
+    FastBlurCanvas16(&lv_gaussian_blur);
+    return;
+  }
+#endif
+  if (LV_COLOR_DEPTH != 32) return;  // 其余算法仅支持32位颜色深度
   lvglGaussian_t *this = m_alloc(sizeof(lvglGaussian_t));
   if (!this) return;
 
@@ -127,6 +193,9 @@ void lv_draw_gaussian_blur(lv_draw_gaussian_blur_dsc_t lv_gaussian_blur) {
     AverageBlur1(this, this->r);
   } else if (lv_gaussian_blur.blur_type == AVERAGEBLUR2) {
     AverageBlur2(this, this->r);
+  } else if (lv_gaussian_blur.blur_type == FASTGAUSSIAN) {
+    FastGaussianBlur_RGB888(this->content, this->image_width,
+                            this->image_height, this->image_stride, this->r);
   } else {
     GaussianBlur(this, createGaussianKernel(this->r), this->r);
   }
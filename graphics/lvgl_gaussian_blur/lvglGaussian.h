@@ -9,6 +9,7 @@ typedef enum {
   AVERAGEBLUR1 = 1,  // 均值模糊，无优化
   AVERAGEBLUR2 = 2,  // 均值模糊，行模糊+列模糊
   GAUSSSIANM = 3,    // 高斯模糊
+  FASTGAUSSIAN = 4,  // 三次盒式模糊近似高斯，每像素O(1)，16位色深时原地处理
 } lv_blur_type_e;
 
 typedef struct {
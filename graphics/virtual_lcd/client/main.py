@@ -308,6 +308,62 @@ class ScreenManager(QWidget):
                 * self.bitwidth
             ] = color.to_bytes(4, "little")[: self.bitwidth]
             self.flush()
+        elif type == 6:  # delta draw
+            """
+            uint16_t x;
+            uint16_t y;
+            uint16_t width;
+            uint16_t height;
+            uint8_t codec;
+            """
+            self.write_delta(*struct.unpack("<HHHHB", data[:9]), data[9:])
+
+    def write_delta(self, x: int, y: int, w: int, h: int, codec: int, data: bytes):
+        bpp = self.bitwidth
+        if not self.scr.enable or bpp < 1:  # 单色格式不支持增量传输
+            return
+        fb = self.framebuffer.reshape(self.scr.height, self.scr.width * bpp)
+        region = fb[y : y + h, x * bpp : (x + w) * bpp]
+        if codec == 0:  # 原始像素
+            region[:] = np.frombuffer(data, dtype=np.uint8).reshape(h, w * bpp)
+        elif codec == 1:  # 异或 + 游程编码
+            region ^= self.decode_rle(data, w * h, bpp).reshape(h, w * bpp)
+        else:
+            logger.warning(f"Unknown delta codec: {codec}")
+            return
+        self.flush()
+
+    @staticmethod
+    def decode_rle(data: bytes, pixels: int, bpp: int) -> np.ndarray:
+        """
+        token: op(2bit) len(6bit), n = len + 1
+        len == 63: 后续字节累加, 直到某字节不为255 (LZ4风格)
+        op 0: 字面量, 后跟n个像素; op 1: 跳过n个像素; op 2: 后跟1个像素, 重复n次
+        末尾未编码的像素视为未变化
+        """
+        out = np.zeros(pixels * bpp, dtype=np.uint8)
+        src = np.frombuffer(data, dtype=np.uint8)
+        i = pos = 0
+        while i < len(data):
+            token = data[i]
+            i += 1
+            op, n = token >> 6, token & 0x3F
+            if n == 0x3F:
+                while True:
+                    ext = data[i]
+                    i += 1
+                    n += ext
+                    if ext != 255:
+                        break
+            n += 1
+            if op == 0:
+                out[pos * bpp : (pos + n) * bpp] = src[i : i + n * bpp]
+                i += n * bpp
+            elif op == 2:
+                out[pos * bpp : (pos + n) * bpp] = np.tile(src[i : i + bpp], n)
+                i += bpp
+            pos += n
+        return out
 
     def flush(self):
         self.frame_update_signal.emit()
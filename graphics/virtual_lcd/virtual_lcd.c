@@ -21,6 +21,19 @@
 #define VLCD_OUTPKT_TYPE_STREAMDATA 0x03
 #define VLCD_OUTPKT_TYPE_DRAWDATA 0x04
 #define VLCD_OUTPKT_TYPE_DRAWPIXEL 0x05
+#define VLCD_OUTPKT_TYPE_DELTADATA 0x06
+
+// 增量包编码: 0-原始像素(直接覆盖) 1-异或+游程编码
+#define VLCD_DELTA_CODEC_RAW 0x00
+#define VLCD_DELTA_CODEC_XOR_RLE 0x01
+
+// 游程编码指令: 高2位为操作, 低6位为(像素数-1), 为63时后续字节累加(LZ4风格)
+#define VLCD_RLE_OP_LITERAL 0x00  // 后跟n个像素的异或值
+#define VLCD_RLE_OP_SKIP 0x01     // n个像素未变化
+#define VLCD_RLE_OP_REPEAT 0x02   // 后跟1个像素的异或值, 重复n次
+#define VLCD_RLE_OP_NONE 0xFF
+#define VLCD_RLE_LEN_MASK 0x3F
+#define VLCD_RLE_MAX_LITERAL 63  // 字面量不使用扩展长度, 便于回填指令字节
 
 #define VLCD_INPKT_TYPE_AQUIREINITINFO 0xFF
 
@@ -84,6 +97,16 @@ typedef struct {
   uint32_t color;
 } vlcd_outpkt_drawpixel_t;
 
+typedef struct {
+  PKT_HEADER;
+  uint16_t x;
+  uint16_t y;
+  uint16_t width;
+  uint16_t height;
+  uint8_t codec;
+  uint8_t data[];
+} vlcd_outpkt_deltadata_t;
+
 typedef struct {
   PKT_HEADER;
   uint8_t action;
@@ -121,6 +144,16 @@ typedef struct {
 
 #pragma pack()
 
+typedef struct {  // 游程编码器状态
+  uint8_t* out;   // 输出指针
+  uint8_t* end;   // 输出上限
+  uint8_t* lit;   // 当前字面量的指令字节位置
+  uint32_t n;     // 当前指令的像素数
+  uint32_t val;   // 重复值/上一个字面量
+  uint8_t op;     // 当前指令(VLCD_RLE_OP_NONE: 无)
+  uint8_t bpp;    // 每像素字节数
+} vlcd_rle_t;
+
 // Public Variables -------------------------
 
 // Private Variables ------------------------
@@ -129,18 +162,203 @@ static vlcd_outpkt_initinfo_t init_pkt;
 static uint8_t acq_initinfo = 0;
 static uint8_t initpkt_ok = 0;
 
+#if VLCD_CFG_ENABLE_DELTA
+static uint8_t* mirror = NULL;  // 上位机帧缓冲的镜像
+static uint8_t mirror_bpp = 0;  // 每像素字节数
+static uint8_t delta_buf[VLCD_CFG_DELTA_BUF_SIZE];
+#endif
+
 // Private Functions ------------------------
 
+#if VLCD_CFG_ENABLE_DELTA
+static void mirror_clear(void) {
+  if (mirror == NULL) return;
+  memset(mirror, 0, (size_t)init_pkt.width * init_pkt.height * mirror_bpp);
+}
+
+static void mirror_update(uint16_t x, uint16_t y, uint16_t width,
+                          uint16_t height, const uint8_t* data,
+                          uint32_t length) {
+  if (mirror == NULL || x + width > init_pkt.width ||
+      y + height > init_pkt.height ||
+      length < (uint32_t)width * height * mirror_bpp)
+    return;
+  size_t stride = (size_t)init_pkt.width * mirror_bpp;
+  size_t line = (size_t)width * mirror_bpp;
+  uint8_t* dst = mirror + y * stride + x * mirror_bpp;
+  for (uint16_t i = 0; i < height; i++) {
+    memcpy(dst, data, line);
+    dst += stride;
+    data += line;
+  }
+}
+
+static inline uint32_t px_read(const uint8_t* p, uint8_t bpp) {
+  uint32_t v = p[0];
+  if (bpp > 1) v |= (uint32_t)p[1] << 8;
+  if (bpp > 2) v |= (uint32_t)p[2] << 16;
+  return v;
+}
+
+static uint8_t rle_put_token(vlcd_rle_t* e, uint8_t op, uint32_t n) {
+  uint32_t len = n - 1;
+  if (e->out >= e->end) return 0;
+  if (len < VLCD_RLE_LEN_MASK) {
+    *e->out++ = (op << 6) | len;
+    return 1;
+  }
+  *e->out++ = (op << 6) | VLCD_RLE_LEN_MASK;
+  len -= VLCD_RLE_LEN_MASK;
+  while (1) {
+    if (e->out >= e->end) return 0;
+    if (len < 255) break;
+    *e->out++ = 255;
+    len -= 255;
+  }
+  *e->out++ = len;
+  return 1;
+}
+
+static uint8_t rle_put_pixel(vlcd_rle_t* e, uint32_t v) {
+  if (e->out + e->bpp > e->end) return 0;
+  for (uint8_t i = 0; i < e->bpp; i++) *e->out++ = v >> (8 * i);
+  return 1;
+}
+
+static uint8_t rle_close(vlcd_rle_t* e) {
+  uint8_t ok = 1;
+  if (e->op == VLCD_RLE_OP_SKIP) {
+    ok = rle_put_token(e, VLCD_RLE_OP_SKIP, e->n);
+  } else if (e->op == VLCD_RLE_OP_REPEAT) {
+    ok = rle_put_token(e, VLCD_RLE_OP_REPEAT, e->n) && rle_put_pixel(e, e->val);
+  } else if (e->op == VLCD_RLE_OP_LITERAL) {
+    *e->lit = (VLCD_RLE_OP_LITERAL << 6) | (e->n - 1);
+  }
+  e->op = VLCD_RLE_OP_NONE;
+  return ok;
+}
+
+static uint8_t rle_push(vlcd_rle_t* e, uint32_t v) {
+  if (v == 0) {
+    if (e->op == VLCD_RLE_OP_SKIP) {
+      e->n++;
+      return 1;
+    }
+    if (!rle_close(e)) return 0;
+    e->op = VLCD_RLE_OP_SKIP;
+    e->n = 1;
+    return 1;
+  }
+  if (e->op == VLCD_RLE_OP_REPEAT && v == e->val) {
+    e->n++;
+    return 1;
+  }
+  if (e->op == VLCD_RLE_OP_LITERAL) {
+    if (v == e->val) {  // 与上一个字面量相同, 将其移出并转为重复
+      e->out -= e->bpp;
+      if (--e->n == 0) {
+        e->out = e->lit;
+      } else {
+        *e->lit = (VLCD_RLE_OP_LITERAL << 6) | (e->n - 1);
+      }
+      e->op = VLCD_RLE_OP_REPEAT;
+      e->n = 2;
+      return 1;
+    }
+    if (e->n < VLCD_RLE_MAX_LITERAL) {
+      if (!rle_put_pixel(e, v)) return 0;
+      e->n++;
+      e->val = v;
+      return 1;
+    }
+  }
+  if (!rle_close(e) || e->out >= e->end) return 0;
+  e->lit = e->out++;
+  e->op = VLCD_RLE_OP_LITERAL;
+  e->n = 1;
+  e->val = v;
+  return rle_put_pixel(e, v);
+}
+
+/**
+ * @brief 将区域与镜像异或后游程编码到delta_buf
+ * @retval uint32_t 编码长度, 0: 超出limit(压缩无收益)
+ */
+static uint32_t delta_encode(const uint8_t* src, uint32_t sstride,
+                             const uint8_t* ref, uint32_t rstride,
+                             uint16_t width, uint16_t height,
+                             uint32_t limit) {
+  vlcd_rle_t e = {.out = delta_buf, .op = VLCD_RLE_OP_NONE, .bpp = mirror_bpp};
+  e.end = delta_buf + (limit < sizeof(delta_buf) ? limit : sizeof(delta_buf));
+  for (uint16_t i = 0; i < height; i++) {
+    const uint8_t* s = src;
+    const uint8_t* r = ref;
+    for (uint16_t j = 0; j < width; j++) {
+      if (!rle_push(&e, px_read(s, e.bpp) ^ px_read(r, e.bpp))) return 0;
+      s += e.bpp;
+      r += e.bpp;
+    }
+    src += sstride;
+    ref += rstride;
+  }
+  if (e.op == VLCD_RLE_OP_SKIP) return e.out - delta_buf;  // 末尾无需标记
+  if (!rle_close(&e)) return 0;
+  return e.out - delta_buf;
+}
+
+static uint8_t tile_dirty(const uint8_t* src, uint32_t sstride,
+                          const uint8_t* ref, uint32_t rstride,
+                          uint16_t width, uint16_t height) {
+  for (uint16_t i = 0; i < height; i++) {
+    if (memcmp(src, ref, (size_t)width * mirror_bpp) != 0) return 1;
+    src += sstride;
+    ref += rstride;
+  }
+  return 0;
+}
+
+static uint32_t delta_send(uint16_t x, uint16_t y, uint16_t width,
+                           uint16_t height, const uint8_t* src,
+                           uint32_t sstride) {
+  uint32_t rstride = (uint32_t)init_pkt.width * mirror_bpp;
+  uint32_t line = (uint32_t)width * mirror_bpp;
+  uint32_t raw = line * height;
+  uint8_t* ref = mirror + y * rstride + x * mirror_bpp;
+  uint32_t len = delta_encode(src, sstride, ref, rstride, width, height, raw);
+  vlcd_outpkt_deltadata_t pkt;
+  INIT_PKT(pkt, VLCD_OUTPKT_TYPE_DELTADATA, sizeof(pkt) + (len ? len : raw));
+  pkt.x = x;
+  pkt.y = y;
+  pkt.width = width;
+  pkt.height = height;
+  pkt.codec = len ? VLCD_DELTA_CODEC_XOR_RLE : VLCD_DELTA_CODEC_RAW;
+  vlcd_send_data_handler((uint8_t*)&pkt, sizeof(pkt));
+  if (len) vlcd_send_data_handler(delta_buf, len);
+  for (uint16_t i = 0; i < height; i++) {
+    if (!len) vlcd_send_data_handler((uint8_t*)src, line);
+    memcpy(ref, src, line);
+    src += sstride;
+    ref += rstride;
+  }
+  return sizeof(pkt) + (len ? len : raw);
+}
+#endif  // VLCD_CFG_ENABLE_DELTA
+
 static void check_init(void) {
   if (acq_initinfo && initpkt_ok) {
     vlcd_send_data_handler((uint8_t*)&init_pkt, sizeof(init_pkt));
     acq_initinfo = 0;
+#if VLCD_CFG_ENABLE_DELTA
+    mirror_clear();  // 上位机重新初始化后帧缓冲为全0
+#endif
   }
 }
 
 // Public Functions -------------------------
 
 __weak void vlcd_send_data_handler(uint8_t* data, uint32_t length) {
+  (void)data;
+  (void)length;
   LOG_E("[vlcd] send data handler not implemented");
 }
 
@@ -177,6 +395,30 @@ void vlcd_init_screen(uint16_t width, uint16_t height, uint8_t format,
   vlcd_send_data_handler((uint8_t*)&init_pkt, sizeof(init_pkt));
   acq_initinfo = 0;
   initpkt_ok = 1;
+#if VLCD_CFG_ENABLE_DELTA
+  if (mirror != NULL) m_free(mirror);
+  mirror = NULL;
+  switch (format) {
+    case VLCD_COLORFORMAT_RGB565:
+      mirror_bpp = 2;
+      break;
+    case VLCD_COLORFORMAT_RGB888:
+      mirror_bpp = 3;
+      break;
+    case VLCD_COLORFORMAT_GRAY_8BIT:
+      mirror_bpp = 1;
+      break;
+    default:  // 单色格式按位存储, 不支持增量传输
+      mirror_bpp = 0;
+      return;
+  }
+  mirror = (uint8_t*)m_alloc((size_t)width * height * mirror_bpp);
+  if (mirror == NULL) {
+    LOG_W("[vlcd] mirror alloc failed, delta disabled");
+    return;
+  }
+  mirror_clear();
+#endif
 }
 
 void vlcd_set_window(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
@@ -209,6 +451,9 @@ void vlcd_draw_data(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
   pkt.height = height;
   vlcd_send_data_handler((uint8_t*)&pkt, sizeof(pkt));
   vlcd_send_data_handler(data, length);
+#if VLCD_CFG_ENABLE_DELTA
+  mirror_update(x, y, width, height, data, length);
+#endif
 }
 
 void vlcd_draw_pixel(uint16_t x, uint16_t y, uint32_t color) {
@@ -219,7 +464,62 @@ void vlcd_draw_pixel(uint16_t x, uint16_t y, uint32_t color) {
   pkt.y = y;
   pkt.color = color;
   vlcd_send_data_handler((uint8_t*)&pkt, sizeof(pkt));
+#if VLCD_CFG_ENABLE_DELTA
+  mirror_update(x, y, 1, 1, (uint8_t*)&color, sizeof(color));  // 小端
+#endif
+}
+
+#if VLCD_CFG_ENABLE_DELTA
+uint32_t vlcd_delta_draw(uint16_t x, uint16_t y, uint16_t width,
+                         uint16_t height, uint8_t* data) {
+  if (mirror == NULL || x + width > init_pkt.width ||
+      y + height > init_pkt.height) {
+    uint32_t length = mirror_bpp ? (uint32_t)width * height * mirror_bpp
+                                 : ((uint32_t)width * height + 7) / 8;
+    vlcd_draw_data(x, y, width, height, data, length);
+    return sizeof(vlcd_outpkt_drawdata_t) + length;
+  }
+  check_init();
+  const uint16_t tile = VLCD_CFG_DELTA_TILE_SIZE;
+  uint32_t sstride = (uint32_t)width * mirror_bpp;
+  uint32_t rstride = (uint32_t)init_pkt.width * mirror_bpp;
+  uint32_t sent = 0;
+  for (uint16_t ty = 0; ty < height; ty += tile) {
+    uint16_t th = height - ty < tile ? height - ty : tile;
+    const uint8_t* src = data + ty * sstride;
+    const uint8_t* ref = mirror + (y + ty) * rstride + x * mirror_bpp;
+    uint8_t in_run = 0;
+    uint16_t run_x = 0;
+    // 按行扫描块, 相邻的脏块合并为一个包
+    for (uint16_t tx = 0;; tx += tile) {
+      uint8_t dirty = 0;
+      if (tx < width) {
+        uint16_t tw = width - tx < tile ? width - tx : tile;
+        dirty = tile_dirty(src + tx * mirror_bpp, sstride,
+                           ref + tx * mirror_bpp, rstride, tw, th);
+      }
+      if (dirty && !in_run) {
+        run_x = tx;
+        in_run = 1;
+      } else if (!dirty && in_run) {
+        uint16_t run_w = (tx < width ? tx : width) - run_x;
+        sent += delta_send(x + run_x, y + ty, run_w, th,
+                           src + run_x * mirror_bpp, sstride);
+        in_run = 0;
+      }
+      if (tx >= width) break;
+    }
+  }
+  return sent;
+}
+
+void vlcd_delta_reset(void) {
+  if (!initpkt_ok) return;
+  vlcd_send_data_handler((uint8_t*)&init_pkt, sizeof(init_pkt));
+  acq_initinfo = 0;
+  mirror_clear();
 }
+#endif  // VLCD_CFG_ENABLE_DELTA
 
 void vlcd_recv_data_handler(uint8_t* data, uint32_t length) {
   static uint8_t buf[32];
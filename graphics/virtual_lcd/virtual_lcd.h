@@ -16,6 +16,12 @@ extern "C" {
 
 #include "modules.h"
 
+#if !KCONFIG_AVAILABLE  // 由Kconfig配置
+#define VLCD_CFG_ENABLE_DELTA 0        // 增量压缩传输(镜像占用整帧RAM)
+#define VLCD_CFG_DELTA_TILE_SIZE 16    // 脏块检测的块大小(像素)
+#define VLCD_CFG_DELTA_BUF_SIZE 2048  // 压缩输出缓冲区大小(字节)
+#endif  // KCONFIG_AVAILABLE
+
 // Public Defines ---------------------------
 
 // 颜色格式
@@ -125,6 +131,31 @@ void vlcd_draw_data(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
  */
 void vlcd_draw_pixel(uint16_t x, uint16_t y, uint32_t color);
 
+#if VLCD_CFG_ENABLE_DELTA
+/**
+ * @brief 以增量压缩方式绘制数据到虚拟屏幕(参数同draw_data, 长度由区域决定)
+ * @param  x         左上角x坐标
+ * @param  y         左上角y坐标
+ * @param  width     宽度
+ * @param  height    高度
+ * @param  data      数据指针(width*height个像素)
+ * @retval uint32_t  实际发送的字节数
+ * @note 与镜像比较, 只发送内容变化的块: 块内数据与上一帧异或后做游程编码,
+ * 压缩无收益时直接发送原始数据
+ * @note 镜像在init_screen时分配(width*height*像素字节数), 单色格式或分配失败时
+ * 退化为draw_data
+ * @note draw_data/draw_pixel会同步更新镜像, stream_data不会,
+ * 二者混用前需调用vlcd_delta_reset
+ */
+uint32_t vlcd_delta_draw(uint16_t x, uint16_t y, uint16_t width,
+                         uint16_t height, uint8_t* data);
+
+/**
+ * @brief 清空镜像并通知上位机清屏(重新发送初始化信息)
+ */
+void vlcd_delta_reset(void);
+#endif  // VLCD_CFG_ENABLE_DELTA
+
 /**
  * @brief 键盘事件回调函数
  * @param  action    动作（见VLCD_INPKT_KEY_ACTION_XXX）
@@ -34,6 +34,7 @@ extern "C" {
 #define MOD_CFG_HEAP_MATHOD_FREERTOS 0
 #define MOD_CFG_HEAP_MATHOD_HEAP4 0
 #define MOD_CFG_HEAP_MATHOD_RTT 0
+#define MOD_CFG_HEAP_TRACE 0  // 通过heap_trace统计m_alloc/m_free
 
 // 时间获取方法(m_tick/m_time_*)
 #define MOD_CFG_TIME_MATHOD_HAL 0
@@ -51,6 +52,7 @@ extern "C" {
 #define MOD_CFG_USE_OS_KLITE 0
 #define MOD_CFG_USE_OS_FREERTOS 0
 #define MOD_CFG_USE_OS_RTT 0
+#define MOD_CFG_USE_OS_POSIX 0
 
 #endif  // KCONFIG_AVAILABLE
 
@@ -124,39 +126,54 @@ typedef int64_t m_time_t;
 
 #if MOD_CFG_HEAP_MATHOD_STDLIB  // stdlib
 #include "stdlib.h"
-#define m_alloc(size) malloc(size)
-#define m_free(ptr) free(ptr)
-#define m_realloc(ptr, size) realloc(ptr, size)
+#define m_alloc_raw(size) malloc(size)
+#define m_free_raw(ptr) free(ptr)
+#define m_realloc_raw(ptr, size) realloc(ptr, size)
 #elif MOD_CFG_HEAP_MATHOD_LWMEM  // lwmem
 #define _MOD_USE_DALLOC 1
 #include "lwmem.h"
-#define m_alloc(size) lwmem_malloc(size)
-#define m_free(ptr) lwmem_free(ptr)
-#define m_realloc(ptr, size) lwmem_realloc(ptr, size)
+#define m_alloc_raw(size) lwmem_malloc(size)
+#define m_free_raw(ptr) lwmem_free(ptr)
+#define m_realloc_raw(ptr, size) lwmem_realloc(ptr, size)
 #elif MOD_CFG_HEAP_MATHOD_KLITE  // klite
 #include "kernel.h"
-#define m_alloc(size) heap_alloc(size)
-#define m_free(ptr) heap_free((ptr))
-#define m_realloc(ptr, size) heap_realloc((ptr), size)
+#define m_alloc_raw(size) heap_alloc(size)
+#define m_free_raw(ptr) heap_free((ptr))
+#define m_realloc_raw(ptr, size) heap_realloc((ptr), size)
 #elif MOD_CFG_HEAP_MATHOD_FREERTOS  // freertos
 #include "FreeRTOS.h"
-#define m_alloc(size) vPortMalloc(size)
-#define m_free(ptr) vPortFree(ptr)
-#define m_realloc(ptr, size) pvPortRealloc((ptr), size)
+#define m_alloc_raw(size) vPortMalloc(size)
+#define m_free_raw(ptr) vPortFree(ptr)
+#define m_realloc_raw(ptr, size) pvPortRealloc((ptr), size)
 #elif MOD_CFG_HEAP_MATHOD_HEAP4  // heap_4
 #include "heap_4.h"
-#define m_alloc(size) pvPortMalloc(size)
-#define m_free(ptr) vPortFree(ptr)
-#define m_realloc(ptr, size) pvPortRealloc((ptr), size)
+#define m_alloc_raw(size) pvPortMalloc(size)
+#define m_free_raw(ptr) vPortFree(ptr)
+#define m_realloc_raw(ptr, size) pvPortRealloc((ptr), size)
 #elif MOD_CFG_HEAP_MATHOD_RTT  // rtthread
 #include "rtthread.h"
-#define m_alloc(size) rt_malloc(size)
-#define m_free(ptr) rt_free(ptr)
-#define m_realloc(ptr, size) rt_realloc(ptr, size)
+#define m_alloc_raw(size) rt_malloc(size)
+#define m_free_raw(ptr) rt_free(ptr)
+#define m_realloc_raw(ptr, size) rt_realloc(ptr, size)
 #else
 #error "MOD_HEAP_MATHOD invalid"
 #endif
 
+#if !MOD_CFG_HEAP_TRACE
+#define m_alloc(size) m_alloc_raw(size)
+#define m_free(ptr) m_free_raw(ptr)
+#define m_realloc(ptr, size) m_realloc_raw(ptr, size)
+#else  // 堆内存统计(system/heap_trace), 记录调用位置
+extern void *heap_trace_alloc(size_t size, const char *file, uint16_t line);
+extern void heap_trace_free(void *ptr);
+extern void *heap_trace_realloc(void *ptr, size_t size, const char *file,
+                                uint16_t line);
+#define m_alloc(size) heap_trace_alloc((size), __FILE__, __LINE__)
+#define m_free(ptr) heap_trace_free(ptr)
+#define m_realloc(ptr, size) \
+  heap_trace_realloc((ptr), (size), __FILE__, __LINE__)
+#endif  // MOD_CFG_HEAP_TRACE
+
 #if MOD_CFG_USE_OS_NONE  // none
 #define MOD_MUTEX_HANDLE void*
 #define MOD_MUTEX_CREATE() (NULL)
@@ -184,6 +201,15 @@ typedef int64_t m_time_t;
 #define MOD_MUTEX_ACQUIRE(mutex) rt_mutex_take(mutex, RT_WAITING_FOREVER)
 #define MOD_MUTEX_RELEASE(mutex) rt_mutex_release(mutex)
 #define MOD_MUTEX_FREE(mutex) rt_mutex_delete(mutex)
+#elif MOD_CFG_USE_OS_POSIX  // posix (host port)
+#include <pthread.h>
+extern pthread_mutex_t *mod_posix_mutex_create(void);
+extern void mod_posix_mutex_free(pthread_mutex_t *mutex);
+#define MOD_MUTEX_HANDLE pthread_mutex_t *
+#define MOD_MUTEX_CREATE() mod_posix_mutex_create()
+#define MOD_MUTEX_ACQUIRE(mutex) pthread_mutex_lock(mutex)
+#define MOD_MUTEX_RELEASE(mutex) pthread_mutex_unlock(mutex)
+#define MOD_MUTEX_FREE(mutex) mod_posix_mutex_free(mutex)
 #else
 #error "MOD_USE_OS invalid"
 #endif
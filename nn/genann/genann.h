@@ -91,9 +91,24 @@ double const *genann_run(genann const *ann, double const *inputs);
 /* Does a single backprop update. */
 void genann_train(genann const *ann, double const *inputs, double const *desired_outputs, double learning_rate);
 
+/* Trains one pass over count samples (inputs and desired_outputs are count
+ * rows each) in mini-batches: the gradients of batch_size samples are
+ * averaged and applied at once, so the learning rate is per batch. Each
+ * batch is split across up to threads threads, fewer if a thread would get
+ * less than GENANN_BATCH_MIN_WORK (rows * total_weights, see genann_batch.c)
+ * so small batches run on the calling thread. With batch_size 1 this is
+ * genann_train on every sample. Returns 0, or -1 if out of memory. */
+int genann_train_batch(genann const *ann, double const *inputs, double const *desired_outputs, int count, int batch_size, double learning_rate, int threads);
+
 /* Saves the ann. */
 void genann_write(genann const *ann, FILE *out);
 
+void genann_init_sigmoid_lookup(const genann *ann);
+double genann_act_sigmoid(const genann *ann, double a);
+double genann_act_sigmoid_cached(const genann *ann, double a);
+double genann_act_threshold(const genann *ann, double a);
+double genann_act_linear(const genann *ann, double a);
+
 #ifdef __cplusplus
 }
 #endif
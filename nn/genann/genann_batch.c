@@ -0,0 +1,345 @@
+/*
+ * GENANN mini-batch training, see genann_train_batch in genann.h
+ *
+ * Each layer is handled for all samples of a batch at once:
+ *   forward:  O = act(X * W^T + b)              (W transposed once per batch)
+ *   backward: D_prev = (D * W) .* O_prev .* (1 - O_prev)
+ *   gradient: G += D^T * [-1, X]
+ * The samples of a batch are split across threads, each thread has its own
+ * activations, deltas and gradient. After the batch every thread sums one
+ * slice of the gradients of all threads and updates that slice of weights.
+ */
+
+#include <string.h>
+
+#include "genann.h"
+#include "modules.h"
+
+#ifndef GENANN_THREADS
+/* Use pthreads, set to 0 to build without them (threads is ignored). */
+#define GENANN_THREADS 1
+#endif
+
+#if GENANN_THREADS
+#include <pthread.h>
+#endif
+
+#define MAX_THREADS 16
+
+#ifndef GENANN_BATCH_MIN_WORK
+/* Least rows * total_weights per thread and batch (about 50us of work).
+ * Each batch costs three barrier waits, with less work than this a thread
+ * loses more there than it saves, so fewer threads are used down to the
+ * calling thread alone. The threads are created per call, which the first
+ * batch has to pay for as well. */
+#define GENANN_BATCH_MIN_WORK 65536
+#endif
+
+typedef struct batch_ctx batch_ctx;
+
+typedef struct {
+  batch_ctx *ctx;
+  int id;
+  double *grad;  /* total_weights */
+  double *out;   /* rows * (total_neurons - inputs) */
+  double *delta; /* rows * (total_neurons - inputs) */
+} batch_worker;
+
+struct batch_ctx {
+  genann const *ann;
+  double const *inputs;
+  double const *desired;
+  double learning_rate;
+  int threads;
+  double *wt; /* Weights of every layer transposed, without bias. */
+
+  /* Current batch. */
+  int start, size;
+  int quit;
+
+  batch_worker worker[MAX_THREADS];
+#if GENANN_THREADS
+  pthread_t thread[MAX_THREADS];
+  pthread_mutex_t lock; /* Held while the threads are set up. */
+  pthread_barrier_t barrier;
+#endif
+};
+
+static int layer_in(genann const *ann, int l) {
+  return l == 0 ? ann->inputs : ann->hidden;
+}
+
+static int layer_out(genann const *ann, int l) {
+  return l == ann->hidden_layers ? ann->outputs : ann->hidden;
+}
+
+/* Offset of layer l in the weights. */
+static int layer_weight(genann const *ann, int l) {
+  int i, off = 0;
+  for (i = 0; i < l; ++i) off += (layer_in(ann, i) + 1) * layer_out(ann, i);
+  return off;
+}
+
+/* Offset of layer l in the transposed weights. */
+static int layer_wt(genann const *ann, int l) {
+  int i, off = 0;
+  for (i = 0; i < l; ++i) off += layer_in(ann, i) * layer_out(ann, i);
+  return off;
+}
+
+static void transpose_weights(batch_ctx *ctx) {
+  genann const *ann = ctx->ann;
+  int l, j, k;
+  for (l = 0; l <= ann->hidden_layers; ++l) {
+    const int in = layer_in(ann, l), out = layer_out(ann, l);
+    double const *w = ann->weight + layer_weight(ann, l);
+    double *wt = ctx->wt + layer_wt(ann, l);
+    for (j = 0; j < out; ++j) {
+      for (k = 0; k < in; ++k) wt[k * out + j] = w[j * (in + 1) + 1 + k];
+    }
+  }
+}
+
+/* Forward and backward pass of rows samples, accumulates into w->grad. */
+static void batch_slice(batch_worker *w, int first, int rows) {
+  batch_ctx *ctx = w->ctx;
+  genann const *ann = ctx->ann;
+  const int layers = ann->hidden_layers + 1;
+  double const *x0 = ctx->inputs + (size_t)first * ann->inputs;
+  double const *t0 = ctx->desired + (size_t)first * ann->outputs;
+  int l, i, j, k;
+
+  /* Activations and deltas of a layer are rows x neurons, layer after
+   * layer in the same order as genann's output and delta arrays. */
+  for (l = 0; l < layers; ++l) {
+    const int in = layer_in(ann, l), out = layer_out(ann, l);
+    const int last = l == layers - 1;
+    double const *x = l ? w->out + (size_t)(l - 1) * ann->hidden * rows : x0;
+    double *o = w->out + (size_t)l * ann->hidden * rows;
+    double const *wb = ann->weight + layer_weight(ann, l);
+    double const *wt = ctx->wt + layer_wt(ann, l);
+    genann_actfun act = last ? ann->activation_output : ann->activation_hidden;
+
+    for (i = 0; i < rows; ++i, x += in, o += out) {
+      for (j = 0; j < out; ++j) o[j] = -wb[j * (in + 1)];
+      for (k = 0; k < in; ++k) {
+        const double a = x[k];
+        double const *wk = wt + k * out;
+        for (j = 0; j < out; ++j) o[j] += a * wk[j];
+      }
+      for (j = 0; j < out; ++j) o[j] = act(ann, o[j]);
+    }
+  }
+
+  /* Output deltas. */
+  {
+    double const *o = w->out + (size_t)ann->hidden_layers * ann->hidden * rows;
+    double *d = w->delta + (size_t)ann->hidden_layers * ann->hidden * rows;
+    double const *t = t0;
+    const int linear = ann->activation_output == genann_act_linear;
+    for (i = 0; i < rows * ann->outputs; ++i) {
+      d[i] = linear ? t[i] - o[i] : (t[i] - o[i]) * o[i] * (1.0 - o[i]);
+    }
+  }
+
+  /* Hidden deltas, from the last layer backwards. */
+  for (l = layers - 1; l > 0; --l) {
+    const int in = layer_in(ann, l), out = layer_out(ann, l);
+    double const *d = w->delta + (size_t)l * ann->hidden * rows;
+    double const *o = w->out + (size_t)(l - 1) * ann->hidden * rows;
+    double *dp = w->delta + (size_t)(l - 1) * ann->hidden * rows;
+    double const *wb = ann->weight + layer_weight(ann, l) + 1;
+
+    for (i = 0; i < rows; ++i, d += out, o += in, dp += in) {
+      for (k = 0; k < in; ++k) dp[k] = 0;
+      for (j = 0; j < out; ++j) {
+        const double dj = d[j];
+        double const *wj = wb + j * (in + 1);
+        for (k = 0; k < in; ++k) dp[k] += dj * wj[k];
+      }
+      for (k = 0; k < in; ++k) dp[k] *= o[k] * (1.0 - o[k]);
+    }
+  }
+
+  /* Gradients. */
+  for (l = 0; l < layers; ++l) {
+    const int in = layer_in(ann, l), out = layer_out(ann, l);
+    double const *x = l ? w->out + (size_t)(l - 1) * ann->hidden * rows : x0;
+    double const *d = w->delta + (size_t)l * ann->hidden * rows;
+    double *g = w->grad + layer_weight(ann, l);
+
+    for (i = 0; i < rows; ++i, x += in, d += out) {
+      for (j = 0; j < out; ++j) {
+        const double dj = d[j];
+        double *gj = g + j * (in + 1);
+        gj[0] -= dj;
+        for (k = 0; k < in; ++k) gj[1 + k] += dj * x[k];
+      }
+    }
+  }
+}
+
+/* Sums slice id of every thread's gradient into the weights. */
+static void batch_reduce(batch_worker *w) {
+  batch_ctx *ctx = w->ctx;
+  genann const *ann = ctx->ann;
+  const int total = ann->total_weights;
+  const int begin = (int)((long long)total * w->id / ctx->threads);
+  const int end = (int)((long long)total * (w->id + 1) / ctx->threads);
+  const double rate = ctx->learning_rate / ctx->size;
+  int t, i;
+
+  double *sum = ctx->worker[0].grad;
+
+  /* Every thread owns the slice [begin, end) of all gradients here, so it
+   * also clears them for the next batch. */
+  for (t = 1; t < ctx->threads; ++t) {
+    double *g = ctx->worker[t].grad;
+    for (i = begin; i < end; ++i) {
+      sum[i] += g[i];
+      g[i] = 0;
+    }
+  }
+  for (i = begin; i < end; ++i) {
+    ann->weight[i] += rate * sum[i];
+    sum[i] = 0;
+  }
+}
+
+static void batch_work(batch_worker *w) {
+  batch_ctx *ctx = w->ctx;
+  const int first = ctx->size * w->id / ctx->threads;
+  const int last = ctx->size * (w->id + 1) / ctx->threads;
+  if (last > first) batch_slice(w, ctx->start + first, last - first);
+}
+
+#if GENANN_THREADS
+static void *batch_thread(void *arg) {
+  batch_worker *w = arg;
+  batch_ctx *ctx = w->ctx;
+  pthread_mutex_lock(&ctx->lock);
+  pthread_mutex_unlock(&ctx->lock);
+  if (ctx->quit) return NULL; /* Setup failed, the barrier is not there. */
+  while (1) {
+    pthread_barrier_wait(&ctx->barrier); /* Batch posted. */
+    if (ctx->quit) break;
+    batch_work(w);
+    pthread_barrier_wait(&ctx->barrier); /* Gradients ready. */
+    batch_reduce(w);
+    pthread_barrier_wait(&ctx->barrier); /* Weights updated. */
+  }
+  return NULL;
+}
+#endif
+
+int genann_train_batch(genann const *ann, double const *inputs,
+                       double const *desired_outputs, int count,
+                       int batch_size, double learning_rate, int threads) {
+  if (count < 1 || batch_size < 1) return -1;
+  if (batch_size > count) batch_size = count;
+  if (threads > MAX_THREADS) threads = MAX_THREADS;
+  if (threads > batch_size) threads = batch_size;
+  const double fit =
+      (double)batch_size * ann->total_weights / GENANN_BATCH_MIN_WORK;
+  if (threads > fit) threads = (int)fit;
+  if (threads < 1 || !GENANN_THREADS) threads = 1;
+
+  batch_ctx *ctx = m_alloc(sizeof(batch_ctx));
+  if (!ctx) return -1;
+  memset(ctx, 0, sizeof(batch_ctx));
+  ctx->ann = ann;
+  ctx->inputs = inputs;
+  ctx->desired = desired_outputs;
+  ctx->learning_rate = learning_rate;
+  ctx->threads = 1;
+  int t;
+  for (t = 0; t < threads; ++t) {
+    ctx->worker[t].ctx = ctx;
+    ctx->worker[t].id = t;
+  }
+
+#if GENANN_THREADS
+  /* The threads wait for the lock until the buffers and the barrier are
+   * ready. If one can not be created, train with the ones that were. The
+   * lock is tracked on its own: it exists even if no thread was created. */
+  int locked = 0;
+  if (threads > 1) {
+    pthread_mutex_init(&ctx->lock, NULL);
+    locked = 1;
+    pthread_mutex_lock(&ctx->lock);
+    while (ctx->threads < threads &&
+           pthread_create(&ctx->thread[ctx->threads], NULL, batch_thread,
+                          &ctx->worker[ctx->threads]) == 0) {
+      ++ctx->threads;
+    }
+  }
+#endif
+  threads = ctx->threads;
+
+  /* One allocation per thread: gradient, activations and deltas. */
+  const int rows = (batch_size + threads - 1) / threads;
+  const int neurons = ann->total_neurons - ann->inputs;
+  const size_t per_thread =
+      sizeof(double) * (ann->total_weights + 2 * (size_t)neurons * rows);
+  ctx->wt = m_alloc(sizeof(double) * ann->total_weights);
+  int ok = ctx->wt != NULL;
+  for (t = 0; t < threads && ok; ++t) {
+    batch_worker *w = &ctx->worker[t];
+    w->grad = m_alloc(per_thread);
+    if (!w->grad) {
+      ok = 0;
+      break;
+    }
+    memset(w->grad, 0, per_thread);
+    w->out = w->grad + ann->total_weights;
+    w->delta = w->out + (size_t)neurons * rows;
+  }
+
+#if GENANN_THREADS
+  if (threads > 1) {
+    if (ok) {
+      pthread_barrier_init(&ctx->barrier, NULL, threads);
+    } else {
+      ctx->quit = 1;
+    }
+  }
+  if (locked) pthread_mutex_unlock(&ctx->lock);
+#endif
+
+  for (ctx->start = 0; ok && ctx->start < count; ctx->start += batch_size) {
+    ctx->size =
+        count - ctx->start < batch_size ? count - ctx->start : batch_size;
+    transpose_weights(ctx);
+#if GENANN_THREADS
+    if (threads > 1) {
+      pthread_barrier_wait(&ctx->barrier); /* Batch posted. */
+      batch_work(&ctx->worker[0]);
+      pthread_barrier_wait(&ctx->barrier); /* Gradients ready. */
+      batch_reduce(&ctx->worker[0]);
+      pthread_barrier_wait(&ctx->barrier); /* Weights updated. */
+      continue;
+    }
+#endif
+    batch_work(&ctx->worker[0]);
+    batch_reduce(&ctx->worker[0]);
+  }
+
+#if GENANN_THREADS
+  if (threads > 1) {
+    if (ok) {
+      ctx->quit = 1;
+      pthread_barrier_wait(&ctx->barrier);
+    }
+    for (t = 1; t < threads; ++t) pthread_join(ctx->thread[t], NULL);
+    if (ok) pthread_barrier_destroy(&ctx->barrier);
+  }
+  if (locked) pthread_mutex_destroy(&ctx->lock);
+#endif
+
+  for (t = 0; t < threads; ++t) {
+    if (ctx->worker[t].grad) m_free(ctx->worker[t].grad);
+  }
+  if (ctx->wt) m_free(ctx->wt);
+  m_free(ctx);
+  return ok ? 0 : -1;
+}
@@ -0,0 +1,270 @@
+/*
+ * GENANN inference blobs, see genann_infer.h
+ */
+
+#include "genann_infer.h"
+
+#include <math.h>
+#include <string.h>
+
+#define SIGMOID_STEPS 8 /* Table entries per unit. */
+#define SIGMOID_TABLE_SIZE 65
+
+/* 1 / (1 + exp(-x)) for x = 0, 1/8, ... 8. */
+static const float sigmoid_table[SIGMOID_TABLE_SIZE] = {
+    0.50000000f, 0.53120937f, 0.56217650f, 0.59266660f, 0.62245933f,
+    0.65135486f, 0.67917870f, 0.70578503f, 0.73105858f, 0.75491499f,
+    0.77729986f, 0.79818678f, 0.81757448f, 0.83548354f, 0.85195280f,
+    0.86703576f, 0.88079708f, 0.89330941f, 0.90465054f, 0.91490095f,
+    0.92414182f, 0.93245331f, 0.93991335f, 0.94659667f, 0.95257413f,
+    0.95791227f, 0.96267311f, 0.96691402f, 0.97068777f, 0.97404264f,
+    0.97702263f, 0.97966765f, 0.98201379f, 0.98409361f, 0.98593637f,
+    0.98756835f, 0.98901306f, 0.99029152f, 0.99142251f, 0.99242276f,
+    0.99330715f, 0.99408893f, 0.99477987f, 0.99539043f, 0.99592986f,
+    0.99640640f, 0.99682732f, 0.99719907f, 0.99752738f, 0.99781728f,
+    0.99807327f, 0.99829928f, 0.99849882f, 0.99867498f, 0.99883049f,
+    0.99896777f, 0.99908895f, 0.99919591f, 0.99929033f, 0.99937367f,
+    0.99944722f, 0.99951214f, 0.99956944f, 0.99962002f, 0.99966465f,
+};
+
+static float sigmoid_f32(float a) {
+  /* sigmoid(-a) = 1 - sigmoid(a), only the positive half is stored. */
+  float x = fabsf(a) * SIGMOID_STEPS;
+  float y;
+  if (x >= SIGMOID_TABLE_SIZE - 1) {
+    y = sigmoid_table[SIGMOID_TABLE_SIZE - 1];
+  } else {
+    int i = (int)x;
+    y = sigmoid_table[i] + (sigmoid_table[i + 1] - sigmoid_table[i]) * (x - i);
+  }
+  return a < 0 ? 1.0f - y : y;
+}
+
+static void activate(float *y, int n, uint8_t act) {
+  int i;
+  switch (act) {
+    case GENANN_ACT_LINEAR:
+      break;
+    case GENANN_ACT_THRESHOLD:
+      for (i = 0; i < n; ++i) y[i] = y[i] > 0;
+      break;
+    default:
+      for (i = 0; i < n; ++i) y[i] = sigmoid_f32(y[i]);
+      break;
+  }
+}
+
+static int pad4(int n) { return (n + 3) & ~3; }
+
+static size_t layer_size(uint32_t magic, int rows, int cols) {
+  rows = pad4(rows);
+  if (magic == GENANN_BLOB_F32) return sizeof(float) * rows * (cols + 1);
+  return sizeof(float) * rows * 2 + (size_t)rows * cols;
+}
+
+static int act_id(genann_actfun f) {
+  if (f == genann_act_sigmoid || f == genann_act_sigmoid_cached)
+    return GENANN_ACT_SIGMOID;
+  if (f == genann_act_linear) return GENANN_ACT_LINEAR;
+  if (f == genann_act_threshold) return GENANN_ACT_THRESHOLD;
+  return -1;
+}
+
+/* y = W * x + b over panels of 4 neurons, see genann_blob. Every input is
+ * loaded once per panel and the 4 sums are independent, so the inner loop
+ * maps to one 4 lane multiply-add where SIMD is available. Even and odd
+ * inputs go to separate sums to halve the add latency chain. */
+static void layer_f32(float const *p, float const *x, float *y, int rows,
+                      int cols) {
+  float const *b = p;
+  float const *w = p + pad4(rows);
+  int j, k;
+
+  for (j = 0; j < rows; j += 4, w += 4 * cols) {
+    float s0 = b[j], s1 = b[j + 1], s2 = b[j + 2], s3 = b[j + 3];
+    float t0 = 0, t1 = 0, t2 = 0, t3 = 0;
+    for (k = 0; k + 2 <= cols; k += 2) {
+      const float x0 = x[k], x1 = x[k + 1];
+      float const *w0 = w + 4 * k;
+      s0 += w0[0] * x0;
+      s1 += w0[1] * x0;
+      s2 += w0[2] * x0;
+      s3 += w0[3] * x0;
+      t0 += w0[4] * x1;
+      t1 += w0[5] * x1;
+      t2 += w0[6] * x1;
+      t3 += w0[7] * x1;
+    }
+    if (k < cols) {
+      s0 += w[4 * k] * x[k];
+      s1 += w[4 * k + 1] * x[k];
+      s2 += w[4 * k + 2] * x[k];
+      s3 += w[4 * k + 3] * x[k];
+    }
+    y[j] = s0 + t0;
+    y[j + 1] = s1 + t1;
+    y[j + 2] = s2 + t2;
+    y[j + 3] = s3 + t3;
+  }
+}
+
+/* Same as layer_f32 with int8 weights, x is quantized into xq first. */
+static void layer_q8(uint8_t const *p, float const *x, int8_t *xq, float *y,
+                     int rows, int cols) {
+  float const *b = (float const *)p;
+  float const *scale = b + pad4(rows);
+  int8_t const *w = (int8_t const *)(scale + pad4(rows));
+  int j, k;
+
+  float max = 0;
+  for (k = 0; k < cols; ++k) max = fabsf(x[k]) > max ? fabsf(x[k]) : max;
+  const float inv = max > 0 ? 127.0f / max : 0;
+  const float sx = max / 127.0f;
+  for (k = 0; k < cols; ++k) {
+    const float v = x[k] * inv;
+    xq[k] = (int8_t)(v >= 0 ? v + 0.5f : v - 0.5f);
+  }
+
+  /* Pairs of 8 bit products are summed before the 32 bit add, that is a
+   * dual 16 bit multiply-add (SMLAD, pmaddwd) */
+  for (j = 0; j < rows; j += 4, w += 4 * cols) {
+    int32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (k = 0; k + 2 <= cols; k += 2) {
+      const int16_t x0 = xq[k], x1 = xq[k + 1];
+      int8_t const *w0 = w + 4 * k;
+      s0 += (int16_t)w0[0] * x0 + (int16_t)w0[4] * x1;
+      s1 += (int16_t)w0[1] * x0 + (int16_t)w0[5] * x1;
+      s2 += (int16_t)w0[2] * x0 + (int16_t)w0[6] * x1;
+      s3 += (int16_t)w0[3] * x0 + (int16_t)w0[7] * x1;
+    }
+    if (k < cols) {
+      s0 += w[4 * k] * xq[k];
+      s1 += w[4 * k + 1] * xq[k];
+      s2 += w[4 * k + 2] * xq[k];
+      s3 += w[4 * k + 3] * xq[k];
+    }
+    y[j] = s0 * (scale[j] * sx) + b[j];
+    y[j + 1] = s1 * (scale[j + 1] * sx) + b[j + 1];
+    y[j + 2] = s2 * (scale[j + 2] * sx) + b[j + 2];
+    y[j + 3] = s3 * (scale[j + 3] * sx) + b[j + 3];
+  }
+}
+
+size_t genann_blob_export(genann const *ann, uint32_t magic, void *buf,
+                          size_t size) {
+  const int act_hidden = act_id(ann->activation_hidden);
+  const int act_output = act_id(ann->activation_output);
+  if (act_hidden < 0 || act_output < 0) return 0;
+  if (magic != GENANN_BLOB_F32 && magic != GENANN_BLOB_Q8) return 0;
+
+  const int layers = ann->hidden_layers + 1;
+  int l, j, k;
+
+  size_t total = sizeof(genann_blob);
+  int width = ann->outputs, in_width = ann->inputs;
+  for (l = 0; l < layers; ++l) {
+    const int rows = l == layers - 1 ? ann->outputs : ann->hidden;
+    const int cols = l == 0 ? ann->inputs : ann->hidden;
+    total += layer_size(magic, rows, cols);
+    if (rows > width) width = rows;
+    if (cols > in_width) in_width = cols;
+  }
+  if (!buf || size < total) return total;
+
+  genann_blob *blob = buf;
+  memset(blob, 0, total);
+  blob->magic = magic;
+  blob->size = total;
+  blob->width = pad4(width);
+  /* Two float buffers for the layer outputs, plus the int8 inputs. */
+  blob->work_size = sizeof(float) * blob->width * 2;
+  if (magic == GENANN_BLOB_Q8) blob->work_size += in_width;
+  blob->inputs = ann->inputs;
+  blob->hidden_layers = ann->hidden_layers;
+  blob->hidden = ann->hidden;
+  blob->outputs = ann->outputs;
+  blob->act_hidden = act_hidden;
+  blob->act_output = act_output;
+
+  /* genann stores each neuron as [bias, weights...], the bias input is -1.
+   * The padding neurons of the last panel stay 0. */
+  double const *w = ann->weight;
+  uint8_t *p = (uint8_t *)(blob + 1);
+  for (l = 0; l < layers; ++l) {
+    const int rows = l == layers - 1 ? ann->outputs : ann->hidden;
+    const int cols = l == 0 ? ann->inputs : ann->hidden;
+    float *b = (float *)p;
+
+    if (magic == GENANN_BLOB_F32) {
+      float *m = b + pad4(rows);
+      for (j = 0; j < rows; ++j) {
+        float *panel = m + (j & ~3) * cols + (j & 3);
+        b[j] = (float)-*w++;
+        for (k = 0; k < cols; ++k) panel[4 * k] = (float)*w++;
+      }
+    } else {
+      float *scale = b + pad4(rows);
+      int8_t *m = (int8_t *)(scale + pad4(rows));
+      for (j = 0; j < rows; ++j) {
+        int8_t *panel = m + (j & ~3) * cols + (j & 3);
+        double max = 0;
+        for (k = 0; k < cols; ++k) {
+          if (fabs(w[1 + k]) > max) max = fabs(w[1 + k]);
+        }
+        const double inv = max > 0 ? 127.0 / max : 0;
+        b[j] = (float)-*w++;
+        scale[j] = (float)(max / 127.0);
+        for (k = 0; k < cols; ++k) panel[4 * k] = (int8_t)lrint(*w++ * inv);
+      }
+    }
+    p += layer_size(magic, rows, cols);
+  }
+
+  return total;
+}
+
+float const *genann_blob_run(genann_blob const *blob, float const *inputs,
+                             void *work) {
+  const int layers = blob->hidden_layers + 1;
+  const int width = blob->width;
+  float *buf[2] = {(float *)work, (float *)work + width};
+  int8_t *xq = (int8_t *)(buf[1] + width);
+  uint8_t const *p = (uint8_t const *)(blob + 1);
+  float const *x = inputs;
+  int cols = blob->inputs;
+  int l;
+
+  for (l = 0; l < layers; ++l) {
+    const int last = l == layers - 1;
+    const int rows = last ? blob->outputs : blob->hidden;
+    float *y = buf[l & 1];
+    if (blob->magic == GENANN_BLOB_F32) {
+      layer_f32((float const *)p, x, y, rows, cols);
+    } else {
+      layer_q8(p, x, xq, y, rows, cols);
+    }
+    activate(y, rows, last ? blob->act_output : blob->act_hidden);
+    p += layer_size(blob->magic, rows, cols);
+    x = y;
+    cols = rows;
+  }
+
+  return x;
+}
+
+void genann_blob_write_c(genann_blob const *blob, char const *name,
+                         FILE *out) {
+  uint32_t const *words = (uint32_t const *)blob;
+  const uint32_t n = (blob->size + 3) / 4;
+  uint32_t i;
+
+  fprintf(out, "/* genann %d-%dx%d-%d %s blob, %u bytes */\n", blob->inputs,
+          blob->hidden_layers, blob->hidden, blob->outputs,
+          blob->magic == GENANN_BLOB_F32 ? "float32" : "int8",
+          (unsigned)blob->size);
+  fprintf(out, "const uint32_t %s[%u] = {", name, (unsigned)n);
+  for (i = 0; i < n; ++i) {
+    fprintf(out, "%s0x%08x,", i % 6 ? " " : "\n    ", (unsigned)words[i]);
+  }
+  fprintf(out, "\n};\n");
+}
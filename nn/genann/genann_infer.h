@@ -0,0 +1,97 @@
+/*
+ * GENANN inference blobs
+ *
+ * A trained genann is exported into a compact, position independent weight
+ * blob that can live in flash (see genann_blob_write_c). The blob is run in
+ * single precision or with int8 weights, both without doubles and without
+ * the 32KB double sigmoid lookup of genann.c:
+ *
+ *   GENANN_BLOB_F32: float weights, each layer is a blocked matrix-vector
+ *                    product (4 neurons share one pass over the inputs).
+ *   GENANN_BLOB_Q8:  int8 weights with one scale per neuron, the inputs of
+ *                    each layer are quantized to int8 on the fly and the
+ *                    dot products are accumulated in int32.
+ *
+ * The weights of each layer are stored in panels of 4 neurons, interleaved
+ * per input (w[k][0..3]), which is what the 4 neuron blocks read in order.
+ * arm_mat_vec_mult_f32 of CMSIS-DSP blocks the same way on a row-major
+ * matrix, it is not used so one blob layout serves every target.
+ *
+ * Sigmoid uses a 65 entry float table over [0, 8] with linear
+ * interpolation (max error 2e-4).
+ *
+ * Typical use, on the host:
+ *   size_t n = genann_blob_export(ann, GENANN_BLOB_Q8, NULL, 0);
+ *   genann_blob *b = malloc(n);
+ *   genann_blob_export(ann, GENANN_BLOB_Q8, b, n);
+ *   genann_blob_write_c(b, "model", out);
+ * on the target:
+ *   static float work[...]; // b->work_size bytes
+ *   float const *y = genann_blob_run((genann_blob const *)model, x, work);
+ */
+
+#ifndef GENANN_INFER_H
+#define GENANN_INFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "genann.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GENANN_BLOB_F32 0x32334647 /* "GF32" */
+#define GENANN_BLOB_Q8 0x38514647  /* "GFQ8" */
+
+enum {
+  GENANN_ACT_SIGMOID,
+  GENANN_ACT_LINEAR,
+  GENANN_ACT_THRESHOLD,
+};
+
+typedef struct genann_blob {
+  /* GENANN_BLOB_F32 or GENANN_BLOB_Q8. */
+  uint32_t magic;
+
+  /* Size of the whole blob in bytes. */
+  uint32_t size;
+
+  /* Scratch buffer size needed by genann_blob_run, in bytes. */
+  uint32_t work_size;
+
+  uint16_t inputs, hidden_layers, hidden, outputs;
+
+  /* GENANN_ACT_* of the hidden and output neurons. */
+  uint8_t act_hidden, act_output;
+
+  /* Neurons in the widest layer, rounded up to 4. */
+  uint16_t width;
+
+  /* Layers follow, neurons are rounded up to 4 (n4), each one as
+   *   F32: float bias[n4], float weight[n4 / 4][inputs][4]
+   *   Q8:  float bias[n4], float scale[n4], int8_t weight[n4 / 4][inputs][4]
+   */
+} genann_blob;
+
+/* Exports a trained ann into buf, returns the blob size in bytes.
+ * Only returns the size if buf is NULL or smaller than needed.
+ * Returns 0 if an activation function has no blob equivalent. */
+size_t genann_blob_export(genann const *ann, uint32_t magic, void *buf,
+                          size_t size);
+
+/* Runs the blob, work must be 4 byte aligned and blob->work_size long.
+ * Returns the outputs, stored in work. */
+float const *genann_blob_run(genann_blob const *blob, float const *inputs,
+                             void *work);
+
+/* Writes the blob as a C array of uint32_t called name. */
+void genann_blob_write_c(genann_blob const *blob, char const *name,
+                         FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*GENANN_INFER_H*/
@@ -50,8 +50,8 @@ typedef struct {  // 电机闭环控制结构体
   float speed;                    // 速度 (rpm)
   int32_t pos;                    // 位置 (pulse)
   int32_t lastPos;                // 上一次位置
-  pid_t spdPID;                   // 速度环PID
-  pid_t posPID;                   // 位置环PID
+  pid_ctrl_t spdPID;              // 速度环PID
+  pid_ctrl_t posPID;              // 位置环PID
   float posTargetSpd;             // 位置环目标速度
   float pwmDuty;                  // PWM占空比
   TIM_HandleTypeDef *timEncoder;  // 编码器定时器
@@ -17,6 +17,10 @@
 #include "stdlib.h"
 #include "string.h"
 
+#if __has_include("fast_math.h")  // 可选, 开启FAST_MATH_CFG_WS2812时需要
+#include "fast_math.h"
+#endif
+
 // SPI模拟一个bit要发送的数据定义:
 // T0H: 350ns T0L: 800ns
 // T1H: 700ns T1L: 600ns
@@ -140,6 +144,9 @@ HAL_StatusTypeDef Strip_SendPart(LEDStrip_t *strip, uint16_t num) {
 
 // R,G,B range 0-255, H range 0-360, S,V range 0-100
 uint32_t HSV_To_RGB(float h, uint8_t s, uint8_t v) {
+#if FAST_MATH_CFG_WS2812
+  return FM_HSVToRGB((uint16_t)(h * (FM_HUE_MAX / 360.0f)), s, v);
+#else
   uint8_t r, g, b;
 
 #if 0  // S,V range 0-100
@@ -190,6 +197,7 @@ uint32_t HSV_To_RGB(float h, uint8_t s, uint8_t v) {
   }
 
   return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+#endif  // FAST_MATH_CFG_WS2812
 }
 
 #endif  // __has_include("spi.h")
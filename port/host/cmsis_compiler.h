@@ -0,0 +1,82 @@
+/**
+ * @file cmsis_compiler.h
+ * @brief 主机(Linux/POSIX)移植层: 提供perf_counter等模块使用的CMSIS编译器宏
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __CMSIS_COMPILER_H__
+#define __CMSIS_COMPILER_H__
+
+#include <stdint.h>
+
+#ifndef __ASM
+#define __ASM __asm
+#endif
+#ifndef __INLINE
+#define __INLINE inline
+#endif
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE __attribute__((always_inline)) static inline
+#endif
+#ifndef __NO_RETURN
+#define __NO_RETURN __attribute__((__noreturn__))
+#endif
+#ifndef __USED
+#define __USED __attribute__((used))
+#endif
+#ifndef __WEAK
+#define __WEAK __attribute__((weak))
+#endif
+#ifndef __weak
+#define __weak __attribute__((weak))
+#endif
+#ifndef __PACKED
+#define __PACKED __attribute__((packed, aligned(1)))
+#endif
+#ifndef __ALIGNED
+#define __ALIGNED(x) __attribute__((aligned(x)))
+#endif
+#ifndef __RESTRICT
+#define __RESTRICT __restrict
+#endif
+
+// CMSIS-DSP的dsp/none.h只为MSVC/Apple提供以下内核函数的C实现
+#if defined(__GNUC__) && !defined(__APPLE_CC__) && !defined(__GNUC_PYTHON__)
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t data) {
+  return data == 0U ? 32U : (uint8_t)__builtin_clz(data);
+}
+
+__STATIC_FORCEINLINE int32_t __SSAT(int32_t val, uint32_t sat) {
+  if (sat >= 1U && sat <= 32U) {
+    const int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+    const int32_t min = -1 - max;
+    if (val > max) return max;
+    if (val < min) return min;
+  }
+  return val;
+}
+
+__STATIC_FORCEINLINE uint32_t __USAT(int32_t val, uint32_t sat) {
+  if (sat <= 31U) {
+    const uint32_t max = (1U << sat) - 1U;
+    if (val > (int32_t)max) return max;
+    if (val < 0) return 0U;
+  }
+  return (uint32_t)val;
+}
+
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2) {
+  op2 %= 32U;
+  if (op2 == 0U) return op1;
+  return (op1 >> op2) | (op1 << (32U - op2));
+}
+#endif
+
+#endif /* __CMSIS_COMPILER_H__ */
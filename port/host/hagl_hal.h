@@ -0,0 +1,47 @@
+/**
+ * @file hagl_hal.h
+ * @brief 主机(Linux/POSIX)移植层: hagl双缓冲帧缓冲HAL, 供基准测试使用
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.1
+ * @date 2024-03-26
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __HAGL_HAL_H__
+#define __HAGL_HAL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hagl/backend.h"
+#include "hagl/fb.h"
+
+#define HAGL_HAL_DISPLAY_WIDTH 240
+#define HAGL_HAL_DISPLAY_HEIGHT 240
+#define HAGL_HAL_DISPLAY_DEPTH 16
+
+/**
+ * @brief 初始化HAL, 由hagl_init调用
+ * @param  backend          后端
+ */
+void hagl_hal_init(hagl_backend_t *backend);
+
+/**
+ * @brief 获取帧缓冲实例(统计信息)
+ */
+const hagl_fb_t *hagl_hal_fb(void);
+
+/**
+ * @brief 将模拟屏幕的内容导出为PPM(P6)图像
+ * @param  path             文件路径
+ * @retval int              0: 成功 -1: 无法打开文件
+ */
+int hagl_hal_dump_ppm(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HAGL_HAL_H__ */
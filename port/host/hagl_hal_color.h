@@ -0,0 +1,18 @@
+/**
+ * @file hagl_hal_color.h
+ * @brief 主机(Linux/POSIX)移植层: hagl颜色类型(RGB565)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-26
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __HAGL_HAL_COLOR_H__
+#define __HAGL_HAL_COLOR_H__
+
+#include <stdint.h>
+
+typedef uint16_t hagl_color_t;
+
+#endif /* __HAGL_HAL_COLOR_H__ */
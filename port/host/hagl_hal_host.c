@@ -0,0 +1,72 @@
+/**
+ * @file hagl_hal_host.c
+ * @brief 主机(Linux/POSIX)移植层: 基于hagl_fb的双缓冲HAL, 模拟屏幕并可导出PPM
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.1
+ * @date 2024-03-27
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hagl/fb.h"
+#include "hagl_hal.h"
+#include "rgb565.h"
+
+// Private Defines --------------------------
+
+#define W HAGL_HAL_DISPLAY_WIDTH
+#define H HAGL_HAL_DISPLAY_HEIGHT
+
+// Private Variables ------------------------
+
+static hagl_color_t buf1[W * H];
+static hagl_color_t buf2[W * H];
+static hagl_color_t panel[W * H];  // 模拟屏幕显存
+static hagl_fb_t fb;
+
+// Private Functions ------------------------
+
+static hagl_color_t color(void *self, uint8_t r, uint8_t g, uint8_t b) {
+  (void)self;
+  return rgb565(r, g, b);
+}
+
+/**
+ * @brief 模拟DMA传输: 复制到panel后立即完成
+ */
+static void panel_tx(int16_t x0, int16_t y0, uint16_t w, uint16_t h,
+                     const uint8_t *data, uint32_t pitch) {
+  hagl_color_t *dst = &panel[y0 * W + x0];
+  for (uint16_t i = 0; i < h; i++, dst += W, data += pitch) {
+    memcpy(dst, data, w * sizeof(hagl_color_t));
+  }
+  hagl_fb_tx_done();
+}
+
+// Public Functions -------------------------
+
+void hagl_hal_init(hagl_backend_t *backend) {
+  hagl_fb_init(backend, &fb, W, H, (uint8_t *)buf1, (uint8_t *)buf2,
+               panel_tx);
+  backend->color = color;
+}
+
+const hagl_fb_t *hagl_hal_fb(void) { return &fb; }
+
+int hagl_hal_dump_ppm(const char *path) {
+  FILE *fp = fopen(path, "wb");
+  if (fp == NULL) return -1;
+  fprintf(fp, "P6\n%d %d\n255\n", W, H);
+  for (uint32_t i = 0; i < W * H; i++) {
+    uint16_t c = (panel[i] >> 8) | (panel[i] << 8);  // rgb565()为大端
+    uint8_t rgb[3] = {(c >> 8) & 0xF8, (c >> 3) & 0xFC, (c << 3) & 0xF8};
+    fwrite(rgb, 1, sizeof(rgb), fp);
+  }
+  fclose(fp);
+  return 0;
+}
+
+// Source Code End --------------------------
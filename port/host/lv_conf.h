@@ -0,0 +1,36 @@
+/**
+ * @file lv_conf.h
+ * @brief 主机(Linux/POSIX)移植层的LVGL配置(未定义的项使用lv_conf_internal.h中的默认值)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-04-02
+ *
+ * THINK DIFFERENTLY
+ * @note 需要定义LV_CONF_INCLUDE_SIMPLE
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#include <stdint.h>
+
+#define LV_COLOR_DEPTH 16
+#define LV_COLOR_16_SWAP 0
+
+#define LV_MEM_CUSTOM 1  // 使用malloc/free
+#define LV_TICK_CUSTOM 0  // 不调用lv_tick_inc, 动画停在初始帧, 渲染结果可复现
+
+#define LV_USE_LOG 0
+#define LV_USE_ASSERT_NULL 0
+#define LV_USE_ASSERT_MALLOC 0
+
+#define LV_USE_PARALLEL_DRAW 1  // 刷新区域按水平条带分给多个线程渲染
+#define LV_PARALLEL_DRAW_THREADS 4
+#define LV_PARALLEL_DRAW_MIN_ROWS 16
+
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_MONTSERRAT_20 1
+
+#define LV_USE_DEMO_WIDGETS 1
+
+#endif /* LV_CONF_H */
@@ -0,0 +1,54 @@
+/**
+ * @file main.h
+ * @brief 主机(Linux/POSIX)移植层: 代替STM32工程的main.h
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __MAIN_H__
+#define __MAIN_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmsis_compiler.h"
+
+#define MOD_HOST_PORT 1  // 标识当前为主机移植层
+
+#ifndef ENABLE
+#define ENABLE 1
+#endif
+#ifndef DISABLE
+#define DISABLE 0
+#endif
+
+#ifndef __IO
+#define __IO volatile
+#endif
+
+/**
+ * @brief 主机端时基频率, perf_counter以ns为Tick
+ */
+extern uint32_t SystemCoreClock;
+
+/**
+ * @brief 主机端复位: 直接退出进程
+ */
+extern void NVIC_SystemReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MAIN_H__ */
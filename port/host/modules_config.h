@@ -0,0 +1,131 @@
+/**
+ * @file modules_config.h
+ * @brief 主机(Linux/POSIX)移植层的模块配置(与Kconfig生成的格式一致)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ * @note 可由 python tool.py -g -d <dir> 重新生成后替换
+ */
+
+#ifndef _MODULES_CONFIG_H_
+#define _MODULES_CONFIG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* System Configuration */
+#define MOD_CFG_USE_OS_POSIX 1
+#define MOD_CFG_TIME_MATHOD_PERF_COUNTER 1
+#define MOD_CFG_HEAP_MATHOD_STDLIB 1
+#define MOD_CFG_DELAY_MATHOD_PERF_COUNTER 1
+
+/* Heap Trace Configuration (cmake -DMOD_HOST_HEAP_TRACE=ON) */
+#define HTRACE_CFG_MAX_SITES 32
+#define HTRACE_CFG_HIST_BINS 10
+#define HTRACE_CFG_ALIGN 16
+#define HTRACE_CFG_ENABLE_TERMINAL 1
+
+/* Log Configuration */
+#define LOG_CFG_ENABLE 1
+#define LOG_CFG_ENABLE_TIMESTAMP 1
+#define LOG_CFG_ENABLE_COLOR 1
+#define LOG_CFG_ENABLE_ASSERT 1
+#define LOG_CFG_ENABLE_DEBUG 1
+#define LOG_CFG_ENABLE_PASS 1
+#define LOG_CFG_ENABLE_INFO 1
+#define LOG_CFG_ENABLE_WARN 1
+#define LOG_CFG_ENABLE_ERROR 1
+#define LOG_CFG_ENABLE_FATAL 1
+#define LOG_CFG_A_COLOR T_RED
+#define LOG_CFG_D_COLOR T_CYAN
+#define LOG_CFG_P_COLOR T_LGREEN
+#define LOG_CFG_I_COLOR T_GREEN
+#define LOG_CFG_W_COLOR T_YELLOW
+#define LOG_CFG_E_COLOR T_RED
+#define LOG_CFG_F_COLOR T_MAGENTA
+#define LOG_CFG_L_COLOR T_BLUE
+#define LOG_CFG_R_COLOR T_BLUE
+#define LOG_CFG_T_COLOR T_YELLOW
+#define LOG_CFG_D_STR "DEBUG"
+#define LOG_CFG_P_STR "PASS"
+#define LOG_CFG_I_STR "INFO"
+#define LOG_CFG_W_STR "WARN"
+#define LOG_CFG_E_STR "ERROR"
+#define LOG_CFG_F_STR "FATAL"
+#define LOG_CFG_L_STR "LIMIT"
+#define LOG_CFG_R_STR "REFRESH"
+#define LOG_CFG_A_STR "ASSERT"
+#define LOG_CFG_T_STR "TIMEIT"
+#define LOG_CFG_PRINTF printf
+#define LOG_CFG_TIMESTAMP ((float)((uint64_t)m_time_ms()) / 1000)
+#define LOG_CFG_TIMESTAMP_FMT "%.3fs"
+#define LOG_CFG_PREFIX ""
+#define LOG_CFG_SUFFIX "\r\n"
+
+/* Profiler Configuration */
+#define PROF_CFG_ENABLE 1
+#define PROF_CFG_MAX_SITES 64
+#define PROF_CFG_MAX_EDGES 128
+#define PROF_CFG_MAX_DEPTH 16
+#define PROF_CFG_CLOCK_MONOTONIC 1
+#define PROF_CFG_ENABLE_TERMINAL 1
+
+/* Module Benchmark Configuration */
+#define BENCH_CFG_MIN_TIME_MS 100
+#define BENCH_CFG_REPEAT 5
+#define BENCH_CFG_GROUP_DATASTRUCT 1
+#define BENCH_CFG_GROUP_SYSTEM 1
+#define BENCH_CFG_GROUP_ALGORITHM 1
+#define BENCH_CFG_GROUP_STORAGE 1
+#define BENCH_CFG_GROUP_GRAPHICS 1
+#define BENCH_CFG_GROUP_LVGL MOD_HOST_LVGL  // 由CMake选项MOD_HOST_LVGL控制
+#define BENCH_CFG_GROUP_NN 1
+
+/* DataStruct Configuration */
+#define LFIFO_CFG_MEMCPY_FUNC memcpy
+
+/* DSP Pipeline Configuration */
+#define DSP_PIPE_CFG_MAX_STAGES 8
+#define DSP_PIPE_CFG_COST_COUNT 1
+#define DSP_PIPE_CFG_ARM_TABLES 0
+
+/* Fast Math Configuration */
+#define FAST_MATH_CFG_TRIG_ORDER 2
+#define FAST_MATH_CFG_POLY_ORDER 5
+#define FAST_MATH_CFG_RSQRT_ITER 2
+#define FAST_MATH_CFG_PID 0
+#define FAST_MATH_CFG_WS2812 0
+#define FAST_MATH_CFG_QUATERNION 0
+
+/* Kalman Filter Configuration */
+#define KALMAN_CFG_GAIN_ITER 10000
+
+/* PID Bank Configuration */
+#define PID_BANK_CFG_MAX_NUM 24
+#define PID_BANK_CFG_USE_SIMD 1
+
+/* Window Statistics Configuration */
+#define WIN_STATS_CFG_RESYNC 64
+
+/* Virtual LCD Configuration */
+#define VLCD_CFG_ENABLE_DELTA 1
+#define VLCD_CFG_DELTA_TILE_SIZE 16
+#define VLCD_CFG_DELTA_BUF_SIZE 2048
+
+/* Scheduler Configuration */
+#define SCH_CFG_ENABLE_TASK 1
+#define SCH_CFG_ENABLE_EVENT 1
+#define SCH_CFG_ENABLE_COROUTINE 1
+#define SCH_CFG_ENABLE_CALLLATER 1
+#define SCH_CFG_ENABLE_SOFTINT 1
+#define SCH_CFG_COMP_RANGE_US 1000
+#define SCH_CFG_ENABLE_TERMINAL 1
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _MODULES_CONFIG_H_ */
@@ -0,0 +1,113 @@
+/**
+ * @file perf_counter_host.c
+ * @brief 主机(Linux/POSIX)移植层: 基于CLOCK_MONOTONIC的perf_counter后端
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ * @note 代替utility/perf_counter/perf_counter.c, 以ns为Tick(SystemCoreClock=1GHz)
+ */
+
+#include <time.h>
+
+#include "main.h"
+#include "perf_counter.h"
+
+// Private Defines --------------------------
+
+#define NS_PER_SEC 1000000000LL
+
+// Private Variables ------------------------
+
+static int64_t s_lStartNs = 0;
+
+// Public Variables -------------------------
+
+uint32_t SystemCoreClock = NS_PER_SEC;
+volatile int64_t g_lLastTimeStamp = 0;
+volatile int32_t g_nOffset = 0;
+
+// Private Functions ------------------------
+
+static inline int64_t monotonic_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+}
+
+__attribute__((constructor)) static void perf_counter_host_init(void) {
+  if (!s_lStartNs) s_lStartNs = monotonic_ns();
+}
+
+// Public Functions -------------------------
+
+void init_cycle_counter(bool bIsSysTickOccupied) {
+  (void)bIsSysTickOccupied;
+  perf_counter_host_init();
+  start_cycle_counter();
+  g_nOffset = (int32_t)(get_system_ticks() - g_lLastTimeStamp);  // 读时钟开销
+}
+
+void update_perf_counter(void) {}
+
+void user_code_insert_to_systick_handler(void) {}
+
+void before_cycle_counter_reconfiguration(void) {}
+
+__attribute__((noinline)) int64_t get_system_ticks(void) {
+  return monotonic_ns() - s_lStartNs;
+}
+
+int32_t get_system_ms(void) {
+  return (int32_t)(get_system_ticks() / 1000000);
+}
+
+int32_t get_system_us(void) { return (int32_t)(get_system_ticks() / 1000); }
+
+void delay_us(int32_t nUs) {
+  if (nUs <= 0) return;
+  struct timespec ts = {.tv_sec = nUs / 1000000,
+                        .tv_nsec = (long)(nUs % 1000000) * 1000};
+  while (nanosleep(&ts, &ts) != 0) {
+  }
+}
+
+void delay_ms(int32_t nMs) {
+  while (nMs > 1000) {  // 避免us溢出
+    delay_us(1000000);
+    nMs -= 1000;
+  }
+  delay_us(nMs * 1000);
+}
+
+int64_t perfc_convert_ticks_to_ms(int64_t lTick) { return lTick / 1000000; }
+
+int64_t perfc_convert_ms_to_ticks(uint32_t wMS) {
+  int64_t lResult = (int64_t)wMS * 1000000;
+  return lResult ? lResult : 1;
+}
+
+int64_t perfc_convert_ticks_to_us(int64_t lTick) { return lTick / 1000; }
+
+int64_t perfc_convert_us_to_ticks(uint32_t wUS) {
+  int64_t lResult = (int64_t)wUS * 1000;
+  return lResult ? lResult : 1;
+}
+
+bool __perfc_is_time_out(int64_t lPeriod, int64_t *plTimestamp,
+                         bool bAutoReload) {
+  if (NULL == plTimestamp) return false;
+  int64_t lTimestamp = get_system_ticks();
+  if (0 == *plTimestamp) {
+    *plTimestamp = lPeriod + lTimestamp;
+    return false;
+  }
+  if (lTimestamp >= *plTimestamp) {
+    if (bAutoReload) *plTimestamp = lPeriod + lTimestamp;
+    return true;
+  }
+  return false;
+}
+
+// Source Code End --------------------------
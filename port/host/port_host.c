@@ -0,0 +1,37 @@
+/**
+ * @file port_host.c
+ * @brief 主机(Linux/POSIX)移植层: 互斥锁和系统函数
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "modules.h"
+
+// Public Functions -------------------------
+
+#if MOD_CFG_USE_OS_POSIX
+pthread_mutex_t *mod_posix_mutex_create(void) {
+  pthread_mutex_t *mutex = malloc(sizeof(pthread_mutex_t));
+  if (!mutex) return NULL;
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  // 与RT-Thread/KLite一致使用可重入锁(ulist内部存在嵌套加锁)
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(mutex, &attr);
+  pthread_mutexattr_destroy(&attr);
+  return mutex;
+}
+
+void mod_posix_mutex_free(pthread_mutex_t *mutex) {
+  if (!mutex) return;
+  pthread_mutex_destroy(mutex);
+  free(mutex);
+}
+#endif  // MOD_CFG_USE_OS_POSIX
+
+void NVIC_SystemReset(void) { exit(0); }
+
+// Source Code End --------------------------
@@ -0,0 +1,26 @@
+/**
+ * @file uart_pack.h
+ * @brief 主机(Linux/POSIX)移植层: 代替peripheral/uart_pack, 日志直接由printf输出
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-22
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __UART_PACK_H__
+#define __UART_PACK_H__
+
+#include "modules.h"
+
+/**
+ * @brief 与uart_pack的UART_CFG_PRINTF_REDIRECT_PUTX行为一致: puts不追加换行
+ * @note term_table等模块依赖此行为
+ */
+static inline int __host_puts(const char *s) {
+  return fputs(s, stdout) < 0 ? EOF : 0;
+}
+#undef puts
+#define puts __host_puts
+
+#endif /* __UART_PACK_H__ */
@@ -0,0 +1,468 @@
+/**
+ * @file heap_trace.c
+ * @brief 统一的堆内存统计层(m_alloc/m_free/m_realloc插桩)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-24
+ *
+ * THINK DIFFERENTLY
+ */
+
+#include "heap_trace.h"
+
+#if MOD_CFG_HEAP_TRACE
+#include "log.h"
+#include "term_table.h"
+
+// Private Defines --------------------------
+
+#define HTRACE_MAGIC 0xA11C       // 块头: 已分配
+#define HTRACE_MAGIC_FREED 0xF4EE  // 块头: 已释放
+#define HTRACE_HASH_SIZE (HTRACE_CFG_MAX_SITES * 2)
+#define HTRACE_HIST_MIN 16  // 直方图第0桶上限(字节)
+
+// Private Typedefs -------------------------
+
+typedef struct {   // 块头, 位于用户指针之前
+  uint32_t size;   // 用户请求的大小
+  uint16_t site;   // 调用点索引
+  uint16_t magic;  // 校验
+} htrace_hdr_t;
+
+#define HTRACE_HDR_SIZE                                            \
+  ((sizeof(htrace_hdr_t) + HTRACE_CFG_ALIGN - 1) / HTRACE_CFG_ALIGN * \
+   HTRACE_CFG_ALIGN)
+
+#define ptr_to_hdr(ptr) \
+  ((htrace_hdr_t *)((uint8_t *)(ptr) - sizeof(htrace_hdr_t)))
+#define ptr_to_base(ptr) ((void *)((uint8_t *)(ptr) - HTRACE_HDR_SIZE))
+#define base_to_ptr(base) ((void *)((uint8_t *)(base) + HTRACE_HDR_SIZE))
+
+// Private Variables ------------------------
+
+static heap_trace_stats_t stats;
+static heap_trace_site_t sites[HTRACE_CFG_MAX_SITES + 1];  // 最后一项: 其他
+static uint16_t site_hash[HTRACE_HASH_SIZE];  // 调用点索引+1, 0为空
+static uint16_t site_num = 0;
+static m_time_t rate_time = 0;
+static uint32_t rate_cnt = 0;
+
+#if !MOD_CFG_USE_OS_NONE
+static MOD_MUTEX_HANDLE htrace_mutex = NULL;
+static inline void htrace_lock(void) {
+  if (htrace_mutex == NULL) htrace_mutex = MOD_MUTEX_CREATE();
+  MOD_MUTEX_ACQUIRE(htrace_mutex);
+}
+#define htrace_unlock() MOD_MUTEX_RELEASE(htrace_mutex)
+#else
+#define htrace_lock() ((void)0)
+#define htrace_unlock() ((void)0)
+#endif
+
+// Private Functions ------------------------
+
+static uint16_t get_site(const char *file, uint16_t line) {
+  uint32_t h = ((uint32_t)(uintptr_t)file ^ (line * 2654435761u)) %
+               HTRACE_HASH_SIZE;
+  for (uint16_t i = 0; i < HTRACE_HASH_SIZE; i++) {
+    uint16_t idx = site_hash[h];
+    if (!idx) {  // 新调用点
+      if (site_num >= HTRACE_CFG_MAX_SITES) break;
+      sites[site_num].file = file;
+      sites[site_num].line = line;
+      site_hash[h] = ++site_num;
+      return site_num - 1;
+    }
+    if (sites[idx - 1].file == file && sites[idx - 1].line == line) {
+      return idx - 1;
+    }
+    h = (h + 1) % HTRACE_HASH_SIZE;
+  }
+  // 调用点表已满, 计入"其他"
+  if (site_num == HTRACE_CFG_MAX_SITES) site_num++;
+  return HTRACE_CFG_MAX_SITES;
+}
+
+static uint8_t hist_bin(size_t size) {
+  uint8_t bin = 0;
+  size_t lim = HTRACE_HIST_MIN;
+  while (size > lim && bin < HTRACE_CFG_HIST_BINS - 1) {
+    lim <<= 1;
+    bin++;
+  }
+  return bin;
+}
+
+static void record_alloc(htrace_hdr_t *hdr, size_t size, uint16_t site) {
+  heap_trace_site_t *s = &sites[site];
+  hdr->size = size;
+  hdr->site = site;
+  hdr->magic = HTRACE_MAGIC;
+  stats.alloc_cnt++;
+  stats.total_bytes += size;
+  stats.live_bytes += size;
+  stats.live_blocks++;
+  if (stats.live_bytes > stats.peak_bytes) stats.peak_bytes = stats.live_bytes;
+  if (stats.live_blocks > stats.peak_blocks)
+    stats.peak_blocks = stats.live_blocks;
+  stats.hist[hist_bin(size)]++;
+  s->allocs++;
+  s->total_bytes += size;
+  s->live_bytes += size;
+  if (s->live_bytes > s->peak_bytes) s->peak_bytes = s->live_bytes;
+}
+
+static void record_free(htrace_hdr_t *hdr) {
+  heap_trace_site_t *s = &sites[hdr->site];
+  stats.free_cnt++;
+  stats.live_bytes -= hdr->size;
+  stats.live_blocks--;
+  s->frees++;
+  s->live_bytes -= hdr->size;
+  hdr->magic = HTRACE_MAGIC_FREED;
+}
+
+// Public Functions -------------------------
+
+void *heap_trace_alloc(size_t size, const char *file, uint16_t line) {
+  void *base = m_alloc_raw(size + HTRACE_HDR_SIZE);
+  htrace_lock();
+  if (base == NULL) {
+    stats.fail_cnt++;
+    htrace_unlock();
+    return NULL;
+  }
+  void *ptr = base_to_ptr(base);
+  record_alloc(ptr_to_hdr(ptr), size, get_site(file, line));
+  htrace_unlock();
+  return ptr;
+}
+
+void heap_trace_free(void *ptr) {
+  if (ptr == NULL) return;
+  htrace_hdr_t *hdr = ptr_to_hdr(ptr);
+  htrace_lock();
+  if (hdr->magic != HTRACE_MAGIC) {  // 非本层分配或重复释放
+    stats.bad_free_cnt++;
+    htrace_unlock();
+    LOG_ERROR("heap_trace: bad free %p", ptr);
+    return;
+  }
+  record_free(hdr);
+  htrace_unlock();
+  m_free_raw(ptr_to_base(ptr));
+}
+
+void *heap_trace_realloc(void *ptr, size_t size, const char *file,
+                         uint16_t line) {
+  if (ptr == NULL) return heap_trace_alloc(size, file, line);
+  if (size == 0) {
+    heap_trace_free(ptr);
+    return NULL;
+  }
+  htrace_hdr_t *hdr = ptr_to_hdr(ptr);
+  if (hdr->magic != HTRACE_MAGIC) {
+    htrace_lock();
+    stats.bad_free_cnt++;
+    htrace_unlock();
+    LOG_ERROR("heap_trace: bad realloc %p", ptr);
+    return NULL;
+  }
+  htrace_hdr_t old = *hdr;
+  void *base = m_realloc_raw(ptr_to_base(ptr), size + HTRACE_HDR_SIZE);
+  htrace_lock();
+  stats.realloc_cnt++;
+  if (base == NULL) {  // 原内存块保持不变
+    stats.fail_cnt++;
+    htrace_unlock();
+    return NULL;
+  }
+  ptr = base_to_ptr(base);
+  hdr = ptr_to_hdr(ptr);
+  *hdr = old;
+  record_free(hdr);
+  stats.free_cnt--;  // realloc不计入分配/释放次数
+  sites[old.site].frees--;
+  record_alloc(hdr, size, get_site(file, line));
+  stats.alloc_cnt--;
+  htrace_unlock();
+  return ptr;
+}
+
+void HeapTrace_GetStats(heap_trace_stats_t *out) {
+  htrace_lock();
+  *out = stats;
+  htrace_unlock();
+}
+
+const heap_trace_site_t *HeapTrace_GetSites(uint16_t *num) {
+  if (num != NULL) *num = site_num;
+  return sites;
+}
+
+void HeapTrace_GetFrag(heap_trace_frag_t *frag) {
+  memset(frag, 0, sizeof(heap_trace_frag_t));
+#if MOD_CFG_HEAP_MATHOD_LWMEM
+  frag->free_bytes = lwmem_get_free_info(&frag->largest, &frag->blocks);
+  frag->valid = 1;
+#elif MOD_CFG_HEAP_MATHOD_HEAP4 || MOD_CFG_HEAP_MATHOD_FREERTOS
+  HeapStats_t hs;
+  vPortGetHeapStats(&hs);
+  frag->free_bytes = hs.xAvailableHeapSpaceInBytes;
+  frag->largest = hs.xSizeOfLargestFreeBlockInBytes;
+  frag->blocks = hs.xNumberOfFreeBlocks;
+  frag->valid = 1;
+#elif MOD_CFG_HEAP_MATHOD_KLITE
+  uint32_t used, free;
+  heap_usage(&used, &free);
+  frag->free_bytes = free;  // 无法获取最大空闲块
+#endif
+  if (frag->valid && frag->free_bytes) {
+    frag->frag_index = 1.0f - (float)frag->largest / frag->free_bytes;
+  }
+}
+
+float HeapTrace_GetAllocRate(void) {
+  m_time_t now = m_time_ms();
+  htrace_lock();
+  uint32_t cnt = stats.alloc_cnt - rate_cnt;
+  m_time_t dt = now - rate_time;
+  rate_cnt = stats.alloc_cnt;
+  rate_time = now;
+  htrace_unlock();
+  return dt > 0 ? (float)cnt * 1000 / dt : 0;
+}
+
+void HeapTrace_Reset(void) {
+  htrace_lock();
+  stats.peak_bytes = stats.live_bytes;
+  stats.peak_blocks = stats.live_blocks;
+  stats.alloc_cnt = 0;
+  stats.free_cnt = 0;
+  stats.realloc_cnt = 0;
+  stats.fail_cnt = 0;
+  stats.bad_free_cnt = 0;
+  stats.total_bytes = 0;
+  memset(stats.hist, 0, sizeof(stats.hist));
+  for (uint16_t i = 0; i < site_num; i++) {
+    sites[i].allocs = 0;
+    sites[i].frees = 0;
+    sites[i].total_bytes = 0;
+    sites[i].peak_bytes = sites[i].live_bytes;
+  }
+  rate_cnt = 0;
+  rate_time = m_time_ms();
+  htrace_unlock();
+}
+
+static heap_trace_sort_t sort_mode;
+static const heap_trace_site_t *sort_sites;
+
+static int site_cmp(const void *a, const void *b) {
+  const heap_trace_site_t *x = &sort_sites[*(const uint16_t *)a];
+  const heap_trace_site_t *y = &sort_sites[*(const uint16_t *)b];
+  size_t vx, vy;
+  switch (sort_mode) {
+    case HTRACE_SORT_PEAK:
+      vx = x->peak_bytes, vy = y->peak_bytes;
+      break;
+    case HTRACE_SORT_ALLOCS:
+      vx = x->allocs, vy = y->allocs;
+      break;
+    default:
+      vx = x->live_bytes, vy = y->live_bytes;
+      break;
+  }
+  return (vx < vy) - (vx > vy);
+}
+
+static const char *short_name(const char *file) {
+  const char *p = file;
+  for (const char *c = file; *c; c++) {
+    if (*c == '/' || *c == '\\') p = c + 1;
+  }
+  return p;
+}
+
+static TT_STR kv_sep(void) {  // 表格释放时逐项释放, 分隔符不能共用
+  return TT_Str(TT_ALIGN_LEFT, TT_FMT1_BLUE, TT_FMT2_BOLD, ": ");
+}
+
+void HeapTrace_Print(heap_trace_sort_t sort, uint16_t max_line) {
+  heap_trace_stats_t st;
+  heap_trace_frag_t frag;
+  float rate = HeapTrace_GetAllocRate();
+  HeapTrace_GetFrag(&frag);
+  // 快照使用后端直接分配, 不计入统计
+  htrace_lock();
+  uint16_t num = site_num;
+  st = stats;
+  heap_trace_site_t *snap = m_alloc_raw(sizeof(heap_trace_site_t) * (num + 1));
+  uint16_t *order = m_alloc_raw(sizeof(uint16_t) * (num + 1));
+  if (snap == NULL || order == NULL) {
+    htrace_unlock();
+    if (snap) m_free_raw(snap);
+    if (order) m_free_raw(order);
+    LOG_ERROR("heap_trace: no memory for report");
+    return;
+  }
+  memcpy(snap, sites, sizeof(heap_trace_site_t) * num);
+  htrace_unlock();
+  for (uint16_t i = 0; i < num; i++) order[i] = i;
+  sort_mode = sort;
+  sort_sites = snap;
+  qsort(order, num, sizeof(uint16_t), site_cmp);
+  if (!max_line || max_line > num) max_line = num;
+
+  TT tt = TT_NewTable(-1);
+  TT_FMT1 f1 = TT_FMT1_BLUE;
+  TT_FMT2 f2 = TT_FMT2_BOLD;
+  TT_ALIGN al = TT_ALIGN_LEFT;
+  TT_AddTitle(tt, TT_Str(al, f1, f2, "[ Heap Trace ]"), '-');
+  TT_ITEM_KVPAIR kv = TT_AddKVPair(tt, 0);
+  f1 = TT_FMT1_GREEN;
+  f2 = TT_FMT2_NONE;
+  TT_KVPair_AddItem(kv, 2, TT_Str(al, f1, f2, "Live"),
+                    TT_FmtStr(al, f1, f2, "%lu B / %lu blocks",
+                              (unsigned long)st.live_bytes,
+                              (unsigned long)st.live_blocks),
+                    kv_sep());
+  TT_KVPair_AddItem(kv, 2, TT_Str(al, f1, f2, "Peak"),
+                    TT_FmtStr(al, f1, f2, "%lu B / %lu blocks",
+                              (unsigned long)st.peak_bytes,
+                              (unsigned long)st.peak_blocks),
+                    kv_sep());
+  TT_KVPair_AddItem(
+      kv, 2, TT_Str(al, f1, f2, "Ops"),
+      TT_FmtStr(al, f1, f2, "alloc %lu / free %lu / realloc %lu / fail %lu",
+                (unsigned long)st.alloc_cnt, (unsigned long)st.free_cnt,
+                (unsigned long)st.realloc_cnt, (unsigned long)st.fail_cnt),
+      kv_sep());
+  TT_KVPair_AddItem(kv, 2, TT_Str(al, f1, f2, "Rate"),
+                    TT_FmtStr(al, f1, f2, "%.1f alloc/s / %llu B total", rate,
+                              (unsigned long long)st.total_bytes),
+                    kv_sep());
+  if (frag.valid) {
+    TT_KVPair_AddItem(
+        kv, 2, TT_Str(al, f1, f2, "Frag"),
+        TT_FmtStr(al, f1, f2, "%.3f (free %lu B / largest %lu B / %lu blocks)",
+                  frag.frag_index, (unsigned long)frag.free_bytes,
+                  (unsigned long)frag.largest, (unsigned long)frag.blocks),
+        kv_sep());
+  } else {
+    TT_KVPair_AddItem(kv, 2, TT_Str(al, f1, f2, "Frag"),
+                      TT_Str(al, f1, f2, "n/a (backend has no free list info)"),
+                      kv_sep());
+  }
+  if (st.bad_free_cnt) {
+    TT_KVPair_AddItem(kv, 2, TT_Str(al, TT_FMT1_RED, TT_FMT2_BOLD, "BadFree"),
+                      TT_FmtStr(al, TT_FMT1_RED, TT_FMT2_BOLD, "%lu",
+                                (unsigned long)st.bad_free_cnt),
+                      kv_sep());
+  }
+
+  f1 = TT_FMT1_BLUE;
+  f2 = TT_FMT2_BOLD;
+  TT_AddTitle(tt, TT_Str(al, f1, f2, "[ Size Histogram ]"), '-');
+  TT_ITEM_GRID grid = TT_AddGrid(tt, 0);
+  TT_ITEM_GRID_LINE line =
+      TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
+  TT_ITEM_GRID_LINE vline =
+      TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
+  size_t lim = HTRACE_HIST_MIN;
+  for (uint8_t i = 0; i < HTRACE_CFG_HIST_BINS; i++) {
+    if (i < HTRACE_CFG_HIST_BINS - 1) {
+      TT_GridLine_AddItem(line,
+                          TT_FmtStr(al, f1, f2, "<=%lu", (unsigned long)lim));
+    } else {
+      TT_GridLine_AddItem(
+          line, TT_FmtStr(al, f1, f2, ">%lu", (unsigned long)(lim >> 1)));
+    }
+    TT_GridLine_AddItem(vline, TT_FmtStr(al, TT_FMT1_GREEN, TT_FMT2_NONE,
+                                         "%lu", (unsigned long)st.hist[i]));
+    lim <<= 1;
+  }
+
+  static const char *head[] = {"Live(B)", "Peak(B)", "Allocs",
+                               "Frees",   "Total(B)", "Site"};
+  TT_AddTitle(tt, TT_FmtStr(al, f1, f2, "[ Call Sites / %d ]", num), '-');
+  grid = TT_AddGrid(tt, 0);
+  line = TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
+  for (uint8_t i = 0; i < sizeof(head) / sizeof(head[0]); i++) {
+    TT_GridLine_AddItem(line, TT_Str(al, f1, f2, head[i]));
+  }
+  f1 = TT_FMT1_GREEN;
+  f2 = TT_FMT2_NONE;
+  for (uint16_t i = 0; i < max_line; i++) {
+    const heap_trace_site_t *s = &snap[order[i]];
+    line = TT_Grid_AddLine(grid, TT_Str(al, f1, f2, " "));
+    TT_GridLine_AddItem(line, TT_FmtStr(al, TT_FMT1_YELLOW, TT_FMT2_BOLD,
+                                        "%lu", (unsigned long)s->live_bytes));
+    TT_GridLine_AddItem(
+        line, TT_FmtStr(al, f1, f2, "%lu", (unsigned long)s->peak_bytes));
+    TT_GridLine_AddItem(line,
+                        TT_FmtStr(al, f1, f2, "%lu", (unsigned long)s->allocs));
+    TT_GridLine_AddItem(line,
+                        TT_FmtStr(al, f1, f2, "%lu", (unsigned long)s->frees));
+    TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%llu",
+                                        (unsigned long long)s->total_bytes));
+    if (s->file != NULL) {
+      TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%s:%d",
+                                          short_name(s->file), s->line));
+    } else {
+      TT_GridLine_AddItem(line, TT_Str(al, f1, f2, "(other)"));
+    }
+  }
+  if (max_line < num) {
+    TT_AddString(tt, TT_Str(TT_ALIGN_CENTER, TT_FMT1_NONE, TT_FMT2_NONE, "..."),
+                 -1);
+  }
+  TT_AddSeparator(tt, TT_FMT1_BLUE, TT_FMT2_BOLD, '-');
+  TT_Print(tt);
+  TT_FreeTable(tt);
+  m_free_raw(snap);
+  m_free_raw(order);
+}
+
+#if HTRACE_CFG_ENABLE_TERMINAL
+static void heap_cmd_func(EmbeddedCli *cli, char *args, void *context) {
+  size_t argc = embeddedCliGetTokenCount(args);
+  if (!argc) {
+    embeddedCliPrintCurrentHelp(cli);
+    return;
+  }
+  if (embeddedCliCheckToken(args, "-p", 1)) {
+    heap_trace_sort_t sort = HTRACE_SORT_LIVE;
+    uint16_t max_line = 10;
+    if (argc >= 2) {
+      if (embeddedCliCheckToken(args, "peak", 2))
+        sort = HTRACE_SORT_PEAK;
+      else if (embeddedCliCheckToken(args, "allocs", 2))
+        sort = HTRACE_SORT_ALLOCS;
+    }
+    if (argc >= 3) max_line = atoi(embeddedCliGetToken(args, 3));
+    HeapTrace_Print(sort, max_line);
+  } else if (embeddedCliCheckToken(args, "-r", 1)) {
+    HeapTrace_Reset();
+    LOG_RAWLN(T_FMT(T_BOLD, T_GREEN) "Heap trace counters cleared" T_RST);
+  } else {
+    LOG_RAWLN(T_FMT(T_BOLD, T_RED) "Unknown command" T_RST);
+  }
+}
+
+void HeapTrace_AddCmdToCli(EmbeddedCli *cli) {
+  static CliCommandBinding heap_cmd = {
+      .name = "heap",
+      .usage = "heap [-p print | -r reset] [live|peak|allocs] [maxline]",
+      .help = "Heap trace command",
+      .context = NULL,
+      .autoTokenizeArgs = 1,
+      .func = heap_cmd_func,
+  };
+  embeddedCliAddBinding(cli, heap_cmd);
+}
+#endif  // HTRACE_CFG_ENABLE_TERMINAL
+
+#endif  // MOD_CFG_HEAP_TRACE
+
+// Source Code End --------------------------
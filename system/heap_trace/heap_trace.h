@@ -0,0 +1,123 @@
+/**
+ * @file heap_trace.h
+ * @brief 统一的堆内存统计层(m_alloc/m_free/m_realloc插桩)
+ * @author Ellu (ellu.grif@gmail.com)
+ * @version 1.0
+ * @date 2024-03-24
+ *
+ * THINK DIFFERENTLY
+ */
+
+#ifndef __HEAP_TRACE_H__
+#define __HEAP_TRACE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "modules.h"
+
+#if !KCONFIG_AVAILABLE  // 由Kconfig配置
+#define HTRACE_CFG_MAX_SITES 32        // 调用点表大小
+#define HTRACE_CFG_HIST_BINS 10        // 分配大小直方图桶数(log2)
+#define HTRACE_CFG_ALIGN 8             // 块头大小/对齐
+#define HTRACE_CFG_ENABLE_TERMINAL 1  // 是否启用终端命令(依赖embedded-cli)
+#endif  // KCONFIG_AVAILABLE
+
+#if MOD_CFG_HEAP_TRACE
+
+// Public Typedefs --------------------------
+
+typedef struct {                        // 全局统计
+  size_t live_bytes;                    // 当前占用(用户请求的字节数)
+  size_t peak_bytes;                    // 占用峰值
+  uint32_t live_blocks;                 // 当前块数
+  uint32_t peak_blocks;                 // 块数峰值
+  uint32_t alloc_cnt;                   // 分配次数(含realloc新分配)
+  uint32_t free_cnt;                    // 释放次数
+  uint32_t realloc_cnt;                 // realloc次数
+  uint32_t fail_cnt;                    // 分配失败次数
+  uint32_t bad_free_cnt;                // 释放了非本层分配的指针的次数
+  uint64_t total_bytes;                 // 累计分配字节数
+  uint32_t hist[HTRACE_CFG_HIST_BINS];  // 分配大小直方图
+} heap_trace_stats_t;
+
+typedef struct {         // 调用点统计
+  const char *file;      // 文件名(NULL: 溢出的调用点)
+  uint16_t line;         // 行号
+  uint32_t allocs;       // 分配次数
+  uint32_t frees;        // 释放次数
+  size_t live_bytes;     // 当前占用
+  size_t peak_bytes;     // 占用峰值
+  uint64_t total_bytes;  // 累计分配字节数
+} heap_trace_site_t;
+
+typedef struct {      // 碎片信息(由后端提供)
+  uint8_t valid;      // 后端是否支持
+  size_t free_bytes;  // 空闲总量
+  size_t largest;     // 最大空闲块
+  size_t blocks;      // 空闲块数(0: 未知)
+  float frag_index;   // 碎片指数: 1 - largest / free_bytes (0: 无碎片)
+} heap_trace_frag_t;
+
+typedef enum {
+  HTRACE_SORT_LIVE,    // 按当前占用排序
+  HTRACE_SORT_PEAK,    // 按占用峰值排序
+  HTRACE_SORT_ALLOCS,  // 按分配次数排序
+} heap_trace_sort_t;
+
+// Exported Functions -----------------------
+
+/**
+ * @brief 获取全局统计
+ * @param  stats            输出: 统计数据
+ */
+extern void HeapTrace_GetStats(heap_trace_stats_t *stats);
+
+/**
+ * @brief 获取调用点表
+ * @param  num              输出: 调用点数量
+ * @retval const heap_trace_site_t*  调用点表
+ */
+extern const heap_trace_site_t *HeapTrace_GetSites(uint16_t *num);
+
+/**
+ * @brief 获取后端的碎片信息
+ * @param  frag             输出: 碎片信息
+ * @note stdlib/RT-Thread后端无法获取最大空闲块, valid=0
+ */
+extern void HeapTrace_GetFrag(heap_trace_frag_t *frag);
+
+/**
+ * @brief 计算自上次调用以来的分配速率
+ * @retval float            次/s
+ */
+extern float HeapTrace_GetAllocRate(void);
+
+/**
+ * @brief 清空计数(峰值重置为当前值, 当前占用保留)
+ */
+extern void HeapTrace_Reset(void);
+
+/**
+ * @brief 通过term_table打印统计报告
+ * @param  sort             调用点排序方式
+ * @param  max_line         调用点最大行数(0:不限制)
+ */
+extern void HeapTrace_Print(heap_trace_sort_t sort, uint16_t max_line);
+
+#if HTRACE_CFG_ENABLE_TERMINAL
+#include "embedded_cli.h"
+/**
+ * @brief 添加堆统计相关的终端命令(heap)
+ */
+extern void HeapTrace_AddCmdToCli(EmbeddedCli *cli);
+#endif  // HTRACE_CFG_ENABLE_TERMINAL
+
+#endif  // MOD_CFG_HEAP_TRACE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HEAP_TRACE_H__ */
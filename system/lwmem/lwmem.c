@@ -1160,6 +1160,43 @@ size_t lwmem_get_size_ex(lwmem_t* lwobj, void* ptr) {
   return len;
 }
 
+/**
+ * \brief           Get free list information of a LwMEM instance
+ * \param[in]       lwobj: LwMEM instance. Set to `NULL` to use default
+ * instance
+ * \param[out]      largest: Size of the largest free block for user in units
+ * of bytes. Can be set to `NULL`
+ * \param[out]      blocks: Number of free blocks. Can be set to `NULL`
+ * \return          Total free memory for user in units of bytes
+ */
+size_t lwmem_get_free_info_ex(lwmem_t* lwobj, size_t* largest,
+                              size_t* blocks) {
+  lwmem_block_t* curr;
+  size_t total = 0, max = 0, num = 0, size;
+
+  lwobj = LWMEM_GET_LWOBJ(lwobj);
+  LWMEM_PROTECT(lwobj);
+  if (lwobj->end_block != NULL) {
+    for (curr = lwobj->start_block.next;
+         curr != NULL && curr != lwobj->end_block; curr = curr->next) {
+      size = curr->size - LWMEM_BLOCK_META_SIZE;
+      total += size;
+      if (size > max) {
+        max = size;
+      }
+      ++num;
+    }
+  }
+  LWMEM_UNPROTECT(lwobj);
+  if (largest != NULL) {
+    *largest = max;
+  }
+  if (blocks != NULL) {
+    *blocks = num;
+  }
+  return total;
+}
+
 #if LWMEM_CFG_ENABLE_STATS || __DOXYGEN__
 
 /**
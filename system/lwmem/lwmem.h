@@ -213,6 +213,8 @@ uint8_t lwmem_realloc_s_ex(lwmem_t *lwobj, const lwmem_region_t *region,
 void lwmem_free_ex(lwmem_t *lwobj, void *const ptr);
 void lwmem_free_s_ex(lwmem_t *lwobj, void **const ptr);
 size_t lwmem_get_size_ex(lwmem_t *lwobj, void *ptr);
+size_t lwmem_get_free_info_ex(lwmem_t *lwobj, size_t *largest,
+                              size_t *blocks);
 #if LWMEM_CFG_ENABLE_STATS || __DOXYGEN__
 void lwmem_get_stats_ex(lwmem_t *lwobj, lwmem_stats_t *stats);
 #endif /* LWMEM_CFG_ENABLE_STATS || __DOXYGEN__ */
@@ -323,6 +325,16 @@ manager on success
  */
 #define lwmem_get_stats(stats) lwmem_get_stats_ex(NULL, (stats))
 
+/**
+ * \note            This is a wrapper for \ref lwmem_get_free_info_ex function.
+ *                      It operates in default LwMEM instance
+ * \param[out]      largest: Size of the largest free block, can be `NULL`
+ * \param[out]      blocks: Number of free blocks, can be `NULL`
+ * \return          Total free memory for user in units of bytes
+ */
+#define lwmem_get_free_info(largest, blocks) \
+  lwmem_get_free_info_ex(NULL, (largest), (blocks))
+
 #if defined(LWMEM_DEV) && !__DOXYGEN__
 unsigned char lwmem_debug_create_regions(lwmem_region_t **regs_out,
                                          size_t count, size_t size);
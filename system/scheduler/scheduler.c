@@ -1,5 +1,12 @@
 #include "scheduler_internal.h"
 
+#if MOD_CFG_USE_OS_NONE && defined(SysTick)  // 主机移植层等无SysTick时使用延时
+#define _SCH_SYSTICK_SLEEP 1
+#else
+#define _SCH_SYSTICK_SLEEP 0
+#endif
+
+#if _SCH_SYSTICK_SLEEP
 /**
  * @brief 利用Systick中断配合WFI实现低功耗延时
  * @param  us 延时时间(us)
@@ -18,17 +25,18 @@ static void SysTick_Sleep(uint32_t us) {
   SysTick->VAL = val;
   SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
 }
+#endif  // _SCH_SYSTICK_SLEEP
 
 __weak void Scheduler_Idle_Callback(uint64_t idleTimeUs) {
   if (idleTimeUs > 1000) idleTimeUs = 1000;  // 最多休眠1ms以保证事件的及时响应
-#if !MOD_CFG_USE_OS_NONE
+#if !_SCH_SYSTICK_SLEEP
   m_delay_us(idleTimeUs);
 #else  // 关闭CPU
   SysTick_Sleep(idleTimeUs);
 #endif
 }
 
-uint64_t _INLINE Scheduler_Run(const uint8_t block) {
+_INLINE uint64_t Scheduler_Run(const uint8_t block) {
 // #define CHECK(rslp, name) LOG_LIMIT(1000, #name " rslp=%d", rslp)
 #define CHECK(rslp, name) ((void)0)
   uint64_t mslp, rslp;
@@ -34,6 +34,9 @@ extern "C" {
 #define SCH_CFG_DEBUG_REPORT 1  // 输出调度器统计信息(调试模式/低性能)
 #define SCH_CFG_DEBUG_PERIOD 5  // 调试报告打印周期(s)(超过10s的值可能导致溢出)
 #define SCH_CFG_DEBUG_MAXLINE 10  // 调试报告最大行数
+#define SCH_CFG_DEBUG_SAMPLE_SHIFT 0  // 统计采样率(1/2^N次调度), 0为全采样
+#define SCH_CFG_DEBUG_HISTOGRAM 0     // 记录任务调度延迟直方图(log2(us)分桶)
+#define SCH_CFG_DEBUG_HIST_BINS 8     // 直方图桶数
 
 #define SCH_CFG_ENABLE_TERMINAL 1  // 是否启用终端命令集(依赖embedded-cli)
 
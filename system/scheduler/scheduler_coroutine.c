@@ -11,8 +11,11 @@ typedef struct {        // 协程任务结构
   void *args;           // 协程主函数参数
   __cortn_handle_t hd;  // 协程句柄
 #if SCH_CFG_DEBUG_REPORT
+#if SCH_DEBUG_TRACK_MAX
   uint64_t max_cost;    // 协程最大执行时间(Tick)
+#endif
   uint64_t total_cost;  // 协程总执行时间(Tick)
+  uint32_t run_cnt;     // 协程执行次数
   float last_usage;     // 协程上次执行占用率
 #endif
 } scheduler_cortn_t;
@@ -77,16 +80,22 @@ _INLINE uint64_t Cortn_Runner(void) {
       cortn_handle_now->depth = 0;
       cortn_handle_now->sleepUntil = 0;
 #if SCH_CFG_DEBUG_REPORT
-      uint64_t _sch_debug_task_tick = get_sys_tick();
-      cortn->task(cortn_handle_now, cortn->args);
-      _sch_debug_task_tick = get_sys_tick() - _sch_debug_task_tick;
-      if (cortn->max_cost < _sch_debug_task_tick)
-        cortn->max_cost = _sch_debug_task_tick;
-      cortn->total_cost += _sch_debug_task_tick;
+      if (sch_debug_sampled(cortn->run_cnt++)) {
+        uint64_t _sch_debug_task_tick = get_sys_tick();
+        cortn->task(cortn_handle_now, cortn->args);
+        _sch_debug_task_tick = get_sys_tick() - _sch_debug_task_tick;
+#if SCH_DEBUG_TRACK_MAX
+        if (cortn->max_cost < _sch_debug_task_tick)
+          cortn->max_cost = _sch_debug_task_tick;
+#endif
+        cortn->total_cost += _sch_debug_task_tick;
+      } else {
+        cortn->task(cortn_handle_now, cortn->args);
+      }
 #else
       cortn->task(cortn_handle_now, cortn->args);
 #endif
-      if (cortn_handle_now->data[0].ptr == NULL) {
+      if (cortn_handle_now->data[0].ptr == 0) {
         cortn_handle_now->state = _CR_STATE_STOPPED;
         cortn_handle_now = NULL;
         sleep_us = 0;
@@ -127,8 +136,8 @@ uint8_t Sch_RunCortn(const char *name, cortn_func_t func, void *args) {
   }
   cortn.hd.data = (__cortn_data_t *)cortn.hd.dataList.data;
   cortn.hd.data[0].local = NULL;
-  cortn.hd.data[0].ptr = NULL;
-  uint16_t __chd_idx;
+  cortn.hd.data[0].ptr = 0;
+  uint16_t __chd_idx = 0;
   if (cortn_handle_now != NULL) {  // 列表添加可能会导致旧指针失效
     __chd_idx = cortn_handle_now - &(((scheduler_cortn_t *)cortnlist.data)->hd);
   }
@@ -228,7 +237,7 @@ _INLINE uint8_t __Internal_AwaitEnter(void) {
     // 更新指针，初始化
     cortn_handle_now->data = cortn_handle_now->dataList.data;
     cortn_handle_now->data[cortn_handle_now->depth].local = NULL;
-    cortn_handle_now->data[cortn_handle_now->depth].ptr = NULL;
+    cortn_handle_now->data[cortn_handle_now->depth].ptr = 0;
     cortn_handle_now->callDepth++;
   }
   return 1;
@@ -240,7 +249,7 @@ _INLINE uint8_t __Internal_AwaitEnter(void) {
  */
 _INLINE uint8_t __Internal_AwaitReturn(void) {
   cortn_handle_now->depth--;
-  if (cortn_handle_now->data[cortn_handle_now->depth + 1].ptr != NULL) {
+  if (cortn_handle_now->data[cortn_handle_now->depth + 1].ptr != 0) {
     // 嵌套协程未结束
     return 0;
   }
@@ -269,7 +278,7 @@ _INLINE void __Internal_Delay(uint64_t delayUs) {
  * @brief (内部函数)协程消息等待
  * @param  msgPtr 消息指针
  */
-_INLINE void __Internal_AwaitMsg(__async__, void **msgPtr) {
+void __Internal_AwaitMsg(__async__, void **msgPtr) {
   ASYNC_NOLOCAL
   if (__chd__->msg == NULL) {
     __chd__->state = _CR_STATE_AWAITING;
@@ -289,7 +298,7 @@ _STATIC_INLINE scheduler_cortn_mutex_t *get_mutex(const char *name) {
   if (ret == NULL) return NULL;
   ID_NAME_SET(ret->name, name);
   ret->locked = 0;
-  ulist_init(&ret->waitlist, sizeof(char *), 0, NULL, NULL);
+  ulist_init(&ret->waitlist, sizeof(char *), 0, 0, NULL);
   return ret;
 }
 
@@ -345,7 +354,7 @@ _STATIC_INLINE scheduler_cortn_barrier_t *get_barrier(const char *name,
   if (ret == NULL) return NULL;
   ID_NAME_SET(ret->name, name);
   ret->target = 0xffff;
-  ulist_init(&ret->waitlist, sizeof(char *), 0, NULL, NULL);
+  ulist_init(&ret->waitlist, sizeof(char *), 0, 0, NULL);
   return ret;
 }
 
@@ -433,7 +442,7 @@ void sch_cortn_add_debug(TT tt, uint64_t period, uint64_t *other) {
     TT_ITEM_GRID_LINE line =
         TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
     const char *head3[] = {"No", "State", "Depth", "Tmax", "Usage", "Name"};
-    for (int i = 0; i < sizeof(head3) / sizeof(char *); i++)
+    for (size_t i = 0; i < sizeof(head3) / sizeof(char *); i++)
       TT_GridLine_AddItem(line, TT_Str(al, f1, f2, head3[i]));
     int i = 0;
     ulist_foreach(&cortnlist, scheduler_cortn_t, cortn) {
@@ -443,7 +452,8 @@ void sch_cortn_add_debug(TT tt, uint64_t period, uint64_t *other) {
         break;
       }
       line = TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " "));
-      float usage = (float)cortn->total_cost / period * 100;
+      uint64_t cost = sch_debug_scale(cortn->total_cost, cortn->run_cnt);
+      float usage = (float)cost / period * 100;
       f1 = TT_FMT1_GREEN;
       f2 = TT_FMT2_NONE;
       TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%d", i));
@@ -451,8 +461,12 @@ void sch_cortn_add_debug(TT tt, uint64_t period, uint64_t *other) {
           line, TT_Str(al, f1, f2, get_cortn_state_str(cortn->hd.state)));
       TT_GridLine_AddItem(line,
                           TT_FmtStr(al, f1, f2, "%d", cortn->hd.callDepth));
+#if SCH_DEBUG_TRACK_MAX
       TT_GridLine_AddItem(
           line, TT_FmtStr(al, f1, f2, "%.2f", tick_to_us(cortn->max_cost)));
+#else
+      TT_GridLine_AddItem(line, TT_Str(al, f1, f2, "-"));
+#endif
       if ((cortn->last_usage != 0 && usage / cortn->last_usage > 2) ||
           usage > 20) {  // 任务占用率大幅度增加或者超过20%
         f1 = TT_FMT1_YELLOW;
@@ -464,21 +478,27 @@ void sch_cortn_add_debug(TT tt, uint64_t period, uint64_t *other) {
       TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%s", cortn->name));
 
       cortn->last_usage = usage;
-      *other -= cortn->total_cost;
+      *other -= cost;
       i++;
     }
   }
 }
 void sch_cortn_finish_debug(uint8_t first_print, uint64_t offset) {
+  (void)first_print;
+  (void)offset;
   ulist_foreach(&cortnlist, scheduler_cortn_t, cortn) {
+#if SCH_DEBUG_TRACK_MAX
     cortn->max_cost = 0;
+#endif
     cortn->total_cost = 0;
+    cortn->run_cnt = 0;
   }
 }
 #endif  // SCH_CFG_DEBUG_REPORT
 
 #if SCH_CFG_ENABLE_TERMINAL
 void cortn_cmd_func(EmbeddedCli *cli, char *args, void *context) {
+  (void)context;
   size_t argc = embeddedCliGetTokenCount(args);
   if (!argc) {
     embeddedCliPrintCurrentHelp(cli);
@@ -39,7 +39,7 @@ extern void __Internal_Delay(uint64_t delayUs);
 extern uint8_t __Internal_AcquireMutex(const char *name);
 extern void __Internal_ReleaseMutex(const char *name);
 extern uint8_t __Internal_WaitBarrier(const char *name);
-static void __Internal_AwaitMsg(__async__, void **msgPtr);
+extern void __Internal_AwaitMsg(__async__, void **msgPtr);
 
 #define __ASYNC_INIT                                     \
   __crap:;                                               \
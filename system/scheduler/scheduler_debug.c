@@ -18,6 +18,9 @@ _INLINE uint8_t DebugInfo_Runner(uint64_t sleep_us) {
     TT tt = TT_NewTable(-1);
 #if SCH_CFG_ENABLE_TASK
     sch_task_add_debug(tt, period, &other);
+#if SCH_CFG_DEBUG_HISTOGRAM
+    sch_task_add_hist_debug(tt);
+#endif  // SCH_CFG_DEBUG_HISTOGRAM
 #endif  // SCH_CFG_ENABLE_TASK
 #if SCH_CFG_ENABLE_EVENT
     sch_event_add_debug(tt, period, &other);
@@ -8,11 +8,14 @@ typedef struct {      // 事件结构
   event_func_t task;  // 事件回调函数指针
   uint8_t enable;     // 是否使能
 #if SCH_CFG_DEBUG_REPORT
+#if SCH_DEBUG_TRACK_MAX
   uint64_t max_cost;     // 事件最大执行时间(Tick)
-  uint64_t total_cost;   // 事件总执行时间(Tick)
   uint64_t max_lat;      // 事件调度延迟(Tick)
+#endif
+  uint64_t total_cost;   // 事件总执行时间(Tick)
   uint64_t total_lat;    // 事件调度延迟总和(Tick)
   uint32_t run_cnt;      // 事件执行次数
+  uint32_t sample_cnt;   // 采样的执行次数(触发时决定是否采样)
   uint32_t trigger_cnt;  // 触发次数
   float last_usage;      // 事件上次执行占用率
 #endif
@@ -22,7 +25,7 @@ typedef struct {              // 事件触发结构
   scheduler_event_arg_t arg;  // 事件参数
   uint8_t allocated;          // 动态分配的参数内存
 #if SCH_CFG_DEBUG_REPORT
-  uint64_t trigger_time;     // 触发时间(Tick)
+  uint64_t trigger_time;     // 触发时间(Tick), 0为未采样
   scheduler_event_t *event;  // 源事件指针
 #endif
 } scheduler_triggered_event_t;
@@ -58,15 +61,22 @@ _INLINE void Event_Runner(void) {
     triggered->task(triggered->arg);
 #else
     scheduler_event_t *event = triggered->event;
-    uint64_t now = get_sys_tick();
-    uint64_t _late = now - triggered->trigger_time;
-    triggered->task(triggered->arg);
-    now = get_sys_tick() - now;
-    if (event->max_cost < now) event->max_cost = now;
-    event->total_cost += now;
-    if (event->max_lat < _late) event->max_lat = _late;
-    event->total_lat += _late;
     event->run_cnt++;
+    if (triggered->trigger_time) {
+      event->sample_cnt++;
+      uint64_t now = get_sys_tick();
+      uint64_t _late = now - triggered->trigger_time;
+      triggered->task(triggered->arg);
+      now = get_sys_tick() - now;
+#if SCH_DEBUG_TRACK_MAX
+      if (event->max_cost < now) event->max_cost = now;
+      if (event->max_lat < _late) event->max_lat = _late;
+#endif
+      event->total_cost += now;
+      event->total_lat += _late;
+    } else {
+      triggered->task(triggered->arg);
+    }
 #endif  // !SCH_CFG_DEBUG_REPORT
     if (triggered->allocated) m_free(triggered->arg.ptr);
     cnt++;
@@ -127,9 +137,9 @@ uint8_t Sch_TriggerEvent(const char *name, uint8_t arg_type, void *arg_ptr,
                                                },
                                            .allocated = 0};
 #if SCH_CFG_DEBUG_REPORT
-  triggered.trigger_time = get_sys_tick();
+  triggered.trigger_time =
+      sch_debug_sampled(event->trigger_cnt++) ? get_sys_tick() : 0;
   triggered.event = event;
-  event->trigger_cnt++;
 #endif
   return ulist_append_copy(&triggered_eventlist, &triggered);
   return 1;
@@ -148,9 +158,9 @@ uint8_t Sch_TriggerEventEx(const char *name, uint8_t arg_type,
       .arg = {.type = arg_type, .ptr = args, .size = arg_size},
       .allocated = 1};
 #if SCH_CFG_DEBUG_REPORT
-  triggered.trigger_time = get_sys_tick();
+  triggered.trigger_time =
+      sch_debug_sampled(event->trigger_cnt++) ? get_sys_tick() : 0;
   triggered.event = event;
-  event->trigger_cnt++;
 #endif
   uint8_t ret = ulist_append_copy(&triggered_eventlist, &triggered);
   if (!ret) m_free(args);
@@ -183,7 +193,7 @@ void sch_event_add_debug(TT tt, uint64_t period, uint64_t *other) {
         TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
     const char *head2[] = {"No",    "Tri",   "Run",   "Tmax",
                            "Usage", "LTavg", "LTmax", "Event"};
-    for (int i = 0; i < sizeof(head2) / sizeof(char *); i++)
+    for (size_t i = 0; i < sizeof(head2) / sizeof(char *); i++)
       TT_GridLine_AddItem(line, TT_Str(al, f1, f2, head2[i]));
     int i = 0;
     ulist_foreach(&eventlist, scheduler_event_t, event) {
@@ -193,8 +203,11 @@ void sch_event_add_debug(TT tt, uint64_t period, uint64_t *other) {
         break;
       }
       line = TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " "));
-      if (event->enable && event->run_cnt) {
-        float usage = (float)event->total_cost / period * 100;
+      if (event->enable && event->sample_cnt) {
+        // 采样在触发时按trigger_cnt决定, 执行次数中的采样数需单独计数
+        uint32_t samples = event->sample_cnt;
+        uint64_t cost = event->total_cost * event->run_cnt / samples;
+        float usage = (float)cost / period * 100;
         f1 = TT_FMT1_GREEN;
         f2 = TT_FMT2_NONE;
         TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%d", i));
@@ -207,8 +220,12 @@ void sch_event_add_debug(TT tt, uint64_t period, uint64_t *other) {
         TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%d", event->run_cnt));
         f1 = TT_FMT1_GREEN;
         f2 = TT_FMT2_NONE;
+#if SCH_DEBUG_TRACK_MAX
         TT_GridLine_AddItem(
             line, TT_FmtStr(al, f1, f2, "%.2f", tick_to_us(event->max_cost)));
+#else
+        TT_GridLine_AddItem(line, TT_Str(al, f1, f2, "-"));
+#endif
         if ((event->last_usage != 0 && usage / event->last_usage > 2) ||
             usage > 20) {  // 事件占用率大幅度增加或者超过20%
           f1 = TT_FMT1_YELLOW;
@@ -219,12 +236,16 @@ void sch_event_add_debug(TT tt, uint64_t period, uint64_t *other) {
         f2 = TT_FMT2_NONE;
         TT_GridLine_AddItem(
             line, TT_FmtStr(al, f1, f2, "%.3f",
-                            tick_to_us(event->total_lat / event->run_cnt)));
+                            tick_to_us(event->total_lat / samples)));
+#if SCH_DEBUG_TRACK_MAX
         TT_GridLine_AddItem(
             line, TT_FmtStr(al, f1, f2, "%.2f", tick_to_us(event->max_lat)));
+#else
+        TT_GridLine_AddItem(line, TT_Str(al, f1, f2, "-"));
+#endif
         TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%s", event->name));
         event->last_usage = usage;
-        *other -= event->total_cost;
+        *other -= cost;
       } else {
         if (!event->enable) {
           f1 = TT_FMT1_WHITE;
@@ -249,12 +270,17 @@ void sch_event_add_debug(TT tt, uint64_t period, uint64_t *other) {
   }
 }
 void sch_event_finish_debug(uint8_t first_print, uint64_t offset) {
+  (void)first_print;
+  (void)offset;
   ulist_foreach(&eventlist, scheduler_event_t, event) {
+#if SCH_DEBUG_TRACK_MAX
     event->max_cost = 0;
+    event->max_lat = 0;
+#endif
     event->total_cost = 0;
     event->run_cnt = 0;
+    event->sample_cnt = 0;
     event->trigger_cnt = 0;
-    event->max_lat = 0;
     event->total_lat = 0;
   }
 }
@@ -262,6 +288,7 @@ void sch_event_finish_debug(uint8_t first_print, uint64_t offset) {
 
 #if SCH_CFG_ENABLE_TERMINAL
 void event_cmd_func(EmbeddedCli *cli, char *args, void *context) {
+  (void)context;
   size_t argc = embeddedCliGetTokenCount(args);
   if (!argc) {
     embeddedCliPrintCurrentHelp(cli);
@@ -302,8 +329,9 @@ void event_cmd_func(EmbeddedCli *cli, char *args, void *context) {
     LOG_RAWLN(T_FMT(T_BOLD, T_GREEN) "Event: %s deleted" T_RST, name);
   } else if (embeddedCliCheckToken(args, "-t", 1)) {
     if (argc < 4) {
-      LOG_RAWLN(T_FMT(T_BOLD, T_RED) "Event need argument (type/content)" T_RST,
-                name);
+      LOG_RAWLN(
+          T_FMT(T_BOLD, T_RED) "Event: %s need argument (type/content)" T_RST,
+          name);
       return;
     }
     Sch_TriggerEvent(name, atoi(embeddedCliGetToken(args, 3)),
@@ -90,10 +90,73 @@ extern uint8_t DebugInfo_Runner(uint64_t sleep_us);
 
 #if SCH_CFG_DEBUG_REPORT
 #include "term_table.h"
+
+#ifndef SCH_CFG_DEBUG_SAMPLE_SHIFT
+#define SCH_CFG_DEBUG_SAMPLE_SHIFT 0
+#endif
+#define SCH_DEBUG_SAMPLE_MASK ((1UL << SCH_CFG_DEBUG_SAMPLE_SHIFT) - 1)
+// 采样时最大值只来自部分调度, 不是真实的最大值, 不再记录(延迟分布见直方图)
+#define SCH_DEBUG_TRACK_MAX (SCH_CFG_DEBUG_SAMPLE_SHIFT == 0)
+
+/**
+ * @brief 判断本次调度是否需要采样统计
+ * @param  cnt             对象的调度计数(采样判断后再自增)
+ * @retval uint8_t         是否采样(1/0)
+ */
+_STATIC_INLINE uint8_t sch_debug_sampled(uint32_t cnt) {
+  return (cnt & SCH_DEBUG_SAMPLE_MASK) == 0;
+}
+
+/**
+ * @brief 获取实际采样次数
+ * @param  cnt             对象的调度计数
+ * @retval uint32_t        采样次数
+ */
+_STATIC_INLINE uint32_t sch_debug_sample_num(uint32_t cnt) {
+  return (cnt + SCH_DEBUG_SAMPLE_MASK) >> SCH_CFG_DEBUG_SAMPLE_SHIFT;
+}
+
+/**
+ * @brief 将采样累计值换算为全部调度的估计值
+ * @param  sum             采样累计值
+ * @param  cnt             对象的调度计数
+ * @retval uint64_t        估计值
+ */
+_STATIC_INLINE uint64_t sch_debug_scale(uint64_t sum, uint32_t cnt) {
+#if SCH_CFG_DEBUG_SAMPLE_SHIFT
+  uint32_t n = sch_debug_sample_num(cnt);
+  return n ? sum * cnt / n : 0;
+#else
+  (void)cnt;
+  return sum;
+#endif
+}
+
+#if SCH_CFG_DEBUG_HISTOGRAM
+/**
+ * @brief 计算延迟直方图桶号, bin[0] < 1us, bin[k] < 2^k us
+ * @param  tick            延迟(Tick)
+ * @retval uint8_t         桶号
+ */
+_STATIC_INLINE uint8_t sch_debug_hist_bin(uint64_t tick) {
+  static uint64_t tick_per_us = 0;
+  if (!tick_per_us) tick_per_us = get_sys_freq() / 1000000;
+  uint64_t th = tick_per_us;
+  uint8_t bin = 0;
+  while (tick >= th && bin < SCH_CFG_DEBUG_HIST_BINS - 1) {
+    th <<= 1;
+    bin++;
+  }
+  return bin;
+}
+#endif  // SCH_CFG_DEBUG_HISTOGRAM
 //////// 子模块向调试输出表添加数据的函数 ////////
 extern void sch_task_add_debug(TT tt, uint64_t period, uint64_t *other);
 extern void sch_event_add_debug(TT tt, uint64_t period, uint64_t *other);
 extern void sch_cortn_add_debug(TT tt, uint64_t period, uint64_t *other);
+#if SCH_CFG_DEBUG_HISTOGRAM
+extern void sch_task_add_hist_debug(TT tt);
+#endif
 extern void sch_task_finish_debug(uint8_t first_print, uint64_t offset);
 extern void sch_event_finish_debug(uint8_t first_print, uint64_t offset);
 extern void sch_cortn_finish_debug(uint8_t first_print, uint64_t offset);
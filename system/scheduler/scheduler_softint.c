@@ -33,6 +33,7 @@ _INLINE void SoftInt_Runner(void) {
 
 #if SCH_CFG_ENABLE_TERMINAL
 void softint_cmd_func(EmbeddedCli *cli, char *args, void *context) {
+  (void)context;
   size_t argc = embeddedCliGetTokenCount(args);
   if (!argc) {
     embeddedCliPrintCurrentHelp(cli);
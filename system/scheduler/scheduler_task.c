@@ -12,13 +12,18 @@ typedef struct {      // 用户任务结构
   uint8_t priority;   // 优先级
   void *args;         // 任务参数
 #if SCH_CFG_DEBUG_REPORT
+#if SCH_DEBUG_TRACK_MAX
   uint64_t max_cost;    // 任务最大执行时间(Tick)
-  uint64_t total_cost;  // 任务总执行时间(Tick)
   uint64_t max_lat;     // 任务调度延迟(Tick)
+#endif
+  uint64_t total_cost;  // 任务总执行时间(Tick)
   uint64_t total_lat;   // 任务调度延迟总和(Tick)
   uint32_t run_cnt;     // 任务执行次数
   float last_usage;     // 任务上次执行占用率
   uint8_t unsync;       // 丢失同步
+#if SCH_CFG_DEBUG_HISTOGRAM
+  uint16_t lat_hist[SCH_CFG_DEBUG_HIST_BINS];  // 调度延迟直方图
+#endif
 #endif
 } scheduler_task_t;
 #pragma pack()
@@ -79,15 +84,24 @@ _INLINE uint64_t Task_Runner(void) {
 #endif
   }
 #if SCH_CFG_DEBUG_REPORT
-  uint64_t _sch_debug_task_tick = get_sys_tick();
-  task->task(task->args);
-  _sch_debug_task_tick = get_sys_tick() - _sch_debug_task_tick;
-  if (task->max_cost < _sch_debug_task_tick)
-    task->max_cost = _sch_debug_task_tick;
-  if (latency > task->max_lat) task->max_lat = latency;
-  task->total_cost += _sch_debug_task_tick;
-  task->total_lat += latency;
-  task->run_cnt++;
+  if (sch_debug_sampled(task->run_cnt++)) {
+    uint64_t _sch_debug_task_tick = get_sys_tick();
+    task->task(task->args);
+    _sch_debug_task_tick = get_sys_tick() - _sch_debug_task_tick;
+#if SCH_DEBUG_TRACK_MAX
+    if (task->max_cost < _sch_debug_task_tick)
+      task->max_cost = _sch_debug_task_tick;
+    if (latency > task->max_lat) task->max_lat = latency;
+#endif
+    task->total_cost += _sch_debug_task_tick;
+    task->total_lat += latency;
+#if SCH_CFG_DEBUG_HISTOGRAM
+    uint16_t *bin = &task->lat_hist[sch_debug_hist_bin(latency)];
+    if (*bin < UINT16_MAX) (*bin)++;
+#endif
+  } else {
+    task->task(task->args);
+  }
 #else
   task->task(task->args);
 #endif  // SCH_CFG_DEBUG_REPORT
@@ -191,7 +205,7 @@ void sch_task_add_debug(TT tt, uint64_t period, uint64_t *other) {
         TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
     const char *head1[] = {"No",    "Pri",   "Run",   "Tmax",
                            "Usage", "LTavg", "LTmax", "Name"};
-    for (int i = 0; i < sizeof(head1) / sizeof(char *); i++)
+    for (size_t i = 0; i < sizeof(head1) / sizeof(char *); i++)
       TT_GridLine_AddItem(line, TT_Str(al, f1, f2, head1[i]));
     int i = 0;
     ulist_foreach(&tasklist, scheduler_task_t, task) {
@@ -202,7 +216,9 @@ void sch_task_add_debug(TT tt, uint64_t period, uint64_t *other) {
       }
       line = TT_Grid_AddLine(grid, TT_Str(al, f1, f2, " "));
       if (task->enable) {
-        float usage = (float)task->total_cost / period * 100;
+        uint64_t cost = sch_debug_scale(task->total_cost, task->run_cnt);
+        uint32_t samples = sch_debug_sample_num(task->run_cnt);
+        float usage = (float)cost / period * 100;
         f1 = TT_FMT1_GREEN;
         f2 = TT_FMT2_NONE;
         TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%d", i));
@@ -215,8 +231,12 @@ void sch_task_add_debug(TT tt, uint64_t period, uint64_t *other) {
         TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%d", task->run_cnt));
         f1 = TT_FMT1_GREEN;
         f2 = TT_FMT2_NONE;
+#if SCH_DEBUG_TRACK_MAX
         TT_GridLine_AddItem(
             line, TT_FmtStr(al, f1, f2, "%.2f", tick_to_us(task->max_cost)));
+#else
+        TT_GridLine_AddItem(line, TT_Str(al, f1, f2, "-"));
+#endif
         if ((task->last_usage != 0 && usage / task->last_usage > 2) ||
             usage > 20) {  // 任务占用率大幅度增加或者超过20%
           f1 = TT_FMT1_YELLOW;
@@ -227,12 +247,17 @@ void sch_task_add_debug(TT tt, uint64_t period, uint64_t *other) {
         f2 = TT_FMT2_NONE;
         TT_GridLine_AddItem(
             line, TT_FmtStr(al, f1, f2, "%.2f",
-                            tick_to_us(task->total_lat / task->run_cnt)));
+                            tick_to_us(samples ? task->total_lat / samples
+                                               : 0)));
+#if SCH_DEBUG_TRACK_MAX
         TT_GridLine_AddItem(
             line, TT_FmtStr(al, f1, f2, "%.2f", tick_to_us(task->max_lat)));
+#else
+        TT_GridLine_AddItem(line, TT_Str(al, f1, f2, "-"));
+#endif
         TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%s", task->name));
         task->last_usage = usage;
-        *other -= task->total_cost;
+        *other -= cost;
       } else {
         f1 = TT_FMT1_WHITE;
         f2 = TT_FMT2_NONE;
@@ -256,19 +281,60 @@ void sch_task_finish_debug(uint8_t first_print, uint64_t offset) {
       task->pendTime = get_sys_tick();
     else
       task->pendTime += offset;
+#if SCH_DEBUG_TRACK_MAX
     task->max_cost = 0;
+    task->max_lat = 0;
+#endif
     task->total_cost = 0;
     task->run_cnt = 0;
-    task->max_lat = 0;
     task->total_lat = 0;
     task->unsync = 0;
+#if SCH_CFG_DEBUG_HISTOGRAM
+    memset(task->lat_hist, 0, sizeof(task->lat_hist));
+#endif
   }
   pending_task = get_next_task();
 }
+
+#if SCH_CFG_DEBUG_HISTOGRAM
+void sch_task_add_hist_debug(TT tt) {
+  if (!tasklist.num) return;
+  TT_FMT1 f1 = TT_FMT1_BLUE;
+  TT_FMT2 f2 = TT_FMT2_BOLD;
+  TT_ALIGN al = TT_ALIGN_LEFT;
+  TT_AddTitle(tt, TT_Str(al, f1, f2, "[ Task Latency Histogram / us ]"), '-');
+  TT_ITEM_GRID grid = TT_AddGrid(tt, 0);
+  TT_ITEM_GRID_LINE line =
+      TT_Grid_AddLine(grid, TT_Str(TT_ALIGN_CENTER, f1, f2, " | "));
+  TT_GridLine_AddItem(line, TT_Str(al, f1, f2, "No"));
+  for (int b = 0; b < SCH_CFG_DEBUG_HIST_BINS - 1; b++)
+    TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "<%lu", 1UL << b));
+  TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, ">=%lu",
+                                      1UL << (SCH_CFG_DEBUG_HIST_BINS - 2)));
+  TT_GridLine_AddItem(line, TT_Str(al, f1, f2, "Name"));
+  int i = 0;
+  ulist_foreach(&tasklist, scheduler_task_t, task) {
+    if (i >= SCH_CFG_DEBUG_MAXLINE) {
+      TT_AddString(
+          tt, TT_Str(TT_ALIGN_CENTER, TT_FMT1_NONE, TT_FMT2_NONE, "..."), 0);
+      break;
+    }
+    f1 = task->enable ? TT_FMT1_GREEN : TT_FMT1_WHITE;
+    f2 = TT_FMT2_NONE;
+    line = TT_Grid_AddLine(grid, TT_Str(al, f1, f2, " "));
+    TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%d", i));
+    for (int b = 0; b < SCH_CFG_DEBUG_HIST_BINS; b++)
+      TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%d", task->lat_hist[b]));
+    TT_GridLine_AddItem(line, TT_FmtStr(al, f1, f2, "%s", task->name));
+    i++;
+  }
+}
+#endif  // SCH_CFG_DEBUG_HISTOGRAM
 #endif  // SCH_CFG_DEBUG_REPORT
 
 #if SCH_CFG_ENABLE_TERMINAL
 void task_cmd_func(EmbeddedCli *cli, char *args, void *context) {
+  (void)context;
   size_t argc = embeddedCliGetTokenCount(args);
   if (!argc) {
     embeddedCliPrintCurrentHelp(cli);
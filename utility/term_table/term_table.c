@@ -140,7 +140,7 @@ _INTERNAL void tt_free_str(TT_STR str) {
 
 _EXTERNAL TT TT_NewTable(int16_t tableMinWidth) {
   TT ret = (TT)tt_alloc(sizeof(term_table_t));
-  ret->items = ulist_new(sizeof(term_table_item_t), 0, NULL, NULL);
+  ret->items = ulist_new(sizeof(term_table_item_t), 0, 0, NULL);
   ret->tableMinWidth = tableMinWidth > 0 ? tableMinWidth : WIDTH_DISABLED;
   ret->tablePrintedHeight = 0;
   ret->tablePrintedWidth = 0;
@@ -243,7 +243,7 @@ _EXTERNAL TT_ITEM_KVPAIR TT_AddKVPair(TT tt, int16_t keyMinWidth) {
   TT_ITEM item = tt_new_item(tt, TT_ITEM_TYPE_KVPAIR);
   TT_ITEM_KVPAIR content = (TT_ITEM_KVPAIR)item->content;
   content->items =
-      ulist_new(sizeof(term_table_item_kvpair_item_t), 0, NULL, NULL);
+      ulist_new(sizeof(term_table_item_kvpair_item_t), 0, 0, NULL);
   content->keyMinWidth = keyMinWidth > 0 ? keyMinWidth : WIDTH_DISABLED;
   content->keyWidth = WIDTH_UNKNOWN;
   content->valueWidth = WIDTH_UNKNOWN;
@@ -267,8 +267,8 @@ _EXTERNAL TT_ITEM_GRID TT_AddGrid(TT tt, int16_t margin) {
   TT_ITEM item = tt_new_item(tt, TT_ITEM_TYPE_GRID);
   TT_ITEM_GRID content = (TT_ITEM_GRID)item->content;
   content->lines =
-      ulist_new(sizeof(term_table_item_grid_line_t), 0, NULL, NULL);
-  content->widths = ulist_new(sizeof(int16_t), 0, NULL, NULL);
+      ulist_new(sizeof(term_table_item_grid_line_t), 0, 0, NULL);
+  content->widths = ulist_new(sizeof(int16_t), 0, 0, NULL);
   content->margin = margin >= 0 ? margin : 0;
   content->separatorWidth = WIDTH_UNKNOWN;
   return content;
@@ -277,7 +277,7 @@ _EXTERNAL TT_ITEM_GRID TT_AddGrid(TT tt, int16_t margin) {
 _EXTERNAL TT_ITEM_GRID_LINE TT_Grid_AddLine(TT_ITEM_GRID grid,
                                             TT_STR separator) {
   TT_ITEM_GRID_LINE line = (TT_ITEM_GRID_LINE)ulist_append(grid->lines);
-  line->items = ulist_new(sizeof(term_table_item_grid_item_t), 0, NULL, NULL);
+  line->items = ulist_new(sizeof(term_table_item_grid_item_t), 0, 0, NULL);
   line->separator = separator;
   return line;
 }
@@ -348,9 +348,10 @@ _INTERNAL int16_t tt_calc_kvpair_width(TT_ITEM_KVPAIR kvpair) {
 }
 
 _INTERNAL int16_t tt_calc_grid_width(TT_ITEM_GRID grid, int16_t minWidth) {
+  (void)minWidth;
   int16_t max_line_item = 0;
   ulist_foreach(grid->lines, term_table_item_grid_line_t, grid_line) {
-    if (ulist_len(grid_line->items) > max_line_item)
+    if (ulist_len(grid_line->items) > (ulist_size_t)max_line_item)
       max_line_item = ulist_len(grid_line->items);
     if (grid_line->separator->width > grid->separatorWidth)
       grid->separatorWidth = grid_line->separator->width;
@@ -469,6 +470,7 @@ _INTERNAL void tt_print_string(TT tt, TT_ITEM_STRING string, int16_t minWidth) {
 }
 
 _INTERNAL void tt_print_kvpair(TT tt, TT_ITEM_KVPAIR kvpair, int16_t minWidth) {
+  (void)minWidth;
   ulist_foreach(kvpair->items, term_table_item_kvpair_item_t, kvpair_item) {
     if (kvpair_item->intent) {
       for (int16_t i = 0; i < kvpair_item->intent; i++) tt_putchar(' ');
@@ -482,6 +484,7 @@ _INTERNAL void tt_print_kvpair(TT tt, TT_ITEM_KVPAIR kvpair, int16_t minWidth) {
 }
 
 _INTERNAL void tt_print_grid(TT tt, TT_ITEM_GRID grid, int16_t minWidth) {
+  (void)minWidth;
   ulist_foreach(grid->lines, term_table_item_grid_line_t, grid_line) {
     if (grid->margin) {
       for (int16_t i = 0; i < grid->margin; i++) tt_putchar(' ');